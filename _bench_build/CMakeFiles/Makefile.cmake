@@ -0,0 +1,563 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeInstallation.cmake"
+  "/root/repo/CMakeLists.txt"
+  "/root/repo/COPYRIGHT"
+  "/root/repo/CTestCustom.cmake.in"
+  "/root/repo/FixBundle.cmake.in"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/hdf5/cmake_hdf5_test.c"
+  "/root/repo/cmake/check_hdf5.cmake"
+  "/root/repo/cmake/dependencies.cmake"
+  "/root/repo/cmake/deprecated.cmake"
+  "/root/repo/cmake/modules/FindBlosc.cmake"
+  "/root/repo/cmake/modules/FindBz2.cmake"
+  "/root/repo/cmake/modules/FindMakeDist.cmake"
+  "/root/repo/cmake/modules/FindSzip.cmake"
+  "/root/repo/cmake/modules/FindZLIB.cmake"
+  "/root/repo/cmake/modules/FindZstd.cmake"
+  "/root/repo/cmake/netcdf_functions_macros.cmake"
+  "/root/repo/cmake_uninstall.cmake.in"
+  "/root/repo/config.h.cmake.in"
+  "/root/repo/dap4_test/CMakeLists.txt"
+  "/root/repo/dap4_test/baseline/CMakeLists.txt"
+  "/root/repo/dap4_test/baselinehyrax/CMakeLists.txt"
+  "/root/repo/dap4_test/baselineraw/CMakeLists.txt"
+  "/root/repo/dap4_test/baselineremote/CMakeLists.txt"
+  "/root/repo/dap4_test/baselinethredds/CMakeLists.txt"
+  "/root/repo/dap4_test/cdltestfiles/CMakeLists.txt"
+  "/root/repo/dap4_test/rawtestfiles/CMakeLists.txt"
+  "/root/repo/docs/CMakeLists.txt"
+  "/root/repo/examples/C/CMakeLists.txt"
+  "/root/repo/examples/CDL/CMakeLists.txt"
+  "/root/repo/examples/CMakeLists.txt"
+  "/root/repo/h5_test/CMakeLists.txt"
+  "/root/repo/include/CMakeLists.txt"
+  "/root/repo/include/netcdf_dispatch.h.in"
+  "/root/repo/include/netcdf_meta.h.in"
+  "/root/repo/libdap2/CMakeLists.txt"
+  "/root/repo/libdap4/CMakeLists.txt"
+  "/root/repo/libdispatch/CMakeLists.txt"
+  "/root/repo/libhdf5/CMakeLists.txt"
+  "/root/repo/liblib/CMakeLists.txt"
+  "/root/repo/libncpoco/CMakeLists.txt"
+  "/root/repo/libncxml/CMakeLists.txt"
+  "/root/repo/libnczarr/CMakeLists.txt"
+  "/root/repo/libnetcdf.settings.in"
+  "/root/repo/libsrc/CMakeLists.txt"
+  "/root/repo/libsrc4/CMakeLists.txt"
+  "/root/repo/nc-config.cmake.in"
+  "/root/repo/nc_perf/CMakeLists.txt"
+  "/root/repo/nc_test/CMakeLists.txt"
+  "/root/repo/nc_test4/CMakeLists.txt"
+  "/root/repo/ncdap_test/CMakeLists.txt"
+  "/root/repo/ncdap_test/expected3/CMakeLists.txt"
+  "/root/repo/ncdap_test/expectremote3/CMakeLists.txt"
+  "/root/repo/ncdap_test/findtestserver.c.in"
+  "/root/repo/ncdap_test/pingurl.c"
+  "/root/repo/ncdap_test/testdata3/CMakeLists.txt"
+  "/root/repo/ncdump/CMakeLists.txt"
+  "/root/repo/ncdump/cdl/CMakeLists.txt"
+  "/root/repo/ncdump/expected/CMakeLists.txt"
+  "/root/repo/ncgen/CMakeLists.txt"
+  "/root/repo/ncgen3/CMakeLists.txt"
+  "/root/repo/nctest/CMakeLists.txt"
+  "/root/repo/nczarr_test/CMakeLists.txt"
+  "/root/repo/netCDFConfig.cmake.in"
+  "/root/repo/netcdf.pc.in"
+  "/root/repo/oc2/CMakeLists.txt"
+  "/root/repo/plugins/CMakeLists.txt"
+  "/root/repo/plugins/findplugin.in"
+  "/root/repo/s3cleanup.in"
+  "/root/repo/s3gc.in"
+  "/root/repo/test_common.in"
+  "/root/repo/unit_test/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-SameMajorVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FindCURL.cmake"
+  "/usr/share/cmake-3.25/Modules/FindHDF5.cmake"
+  "/usr/share/cmake-3.25/Modules/FindLibXml2.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/GenerateExportHeader.cmake"
+  "/usr/share/cmake-3.25/Modules/GetPrerequisites.cmake"
+  "/usr/share/cmake-3.25/Modules/InstallRequiredSystemLibraries.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  "/usr/share/cmake-3.25/Modules/TestBigEndian.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "DartConfiguration.tcl"
+  "config.h"
+  "FixBundle.cmake"
+  "netcdf.pc"
+  "CTestCustom.cmake"
+  "libnetcdf.settings"
+  "tmp/nc-config"
+  "include/netcdf_meta.h"
+  "include/netcdf_dispatch.h"
+  "test_common.sh"
+  "s3cleanup.sh"
+  "s3gc.sh"
+  "nc_test4/findplugin.sh"
+  "nczarr_test/findplugin.sh"
+  "v3_nczarr_test/findplugin.sh"
+  "plugins/findplugin.sh"
+  "h5_test/findplugin.sh"
+  "examples/C/findplugin.sh"
+  "ncdap_test/findtestserver.c"
+  "dap4_test/findtestserver4.c"
+  "dap4_test/pingurl4.c"
+  "CTestCustom.cmake"
+  "netCDFConfig.cmake"
+  "netCDFConfigVersion.cmake"
+  "COPYRIGHT.txt"
+  "cmake_uninstall.cmake"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "include/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libdispatch/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libsrc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libsrc4/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libhdf5/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "oc2/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libdap2/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libdap4/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libncxml/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libncpoco/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libnczarr/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "liblib/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "plugins/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ncgen/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ncgen3/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ncdump/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ncdump/cdl/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ncdump/expected/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "nctest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "nc_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "nc_test4/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "h5_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ncdap_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ncdap_test/testdata3/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ncdap_test/expected3/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ncdap_test/expectremote3/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dap4_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dap4_test/baseline/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dap4_test/baselineraw/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dap4_test/baselineremote/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dap4_test/baselinehyrax/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dap4_test/baselinethredds/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dap4_test/cdltestfiles/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dap4_test/rawtestfiles/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/C/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/CDL/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "nc_perf/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unit_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "nczarr_test/run_specific_filters.sh"
+  "nczarr_test/run_unknown.sh"
+  "nczarr_test/run_filter_vlen.sh"
+  "nczarr_test/run_mud.sh"
+  "nczarr_test/run_nccopy5.sh"
+  "nczarr_test/run_filter_misc.sh"
+  "nczarr_test/run_filter_vlen.sh"
+  "nczarr_test/run_specific_filters.sh"
+  "nczarr_test/run_unknown.sh"
+  "nczarr_test/run_mud.sh"
+  "nczarr_test/run_nccopy5.sh"
+  "nczarr_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "docs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/netcdf.dir/DependInfo.cmake"
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall.dir/DependInfo.cmake"
+  "libdispatch/CMakeFiles/dispatch.dir/DependInfo.cmake"
+  "libdispatch/CMakeFiles/ncrandom.dir/DependInfo.cmake"
+  "libsrc/CMakeFiles/netcdf3.dir/DependInfo.cmake"
+  "libsrc/CMakeFiles/manpage.dir/DependInfo.cmake"
+  "libsrc4/CMakeFiles/netcdf4.dir/DependInfo.cmake"
+  "libhdf5/CMakeFiles/netcdfhdf5.dir/DependInfo.cmake"
+  "oc2/CMakeFiles/oc2.dir/DependInfo.cmake"
+  "libdap2/CMakeFiles/dap2.dir/DependInfo.cmake"
+  "libdap4/CMakeFiles/dap4.dir/DependInfo.cmake"
+  "libncxml/CMakeFiles/ncxml.dir/DependInfo.cmake"
+  "libncpoco/CMakeFiles/ncpoco.dir/DependInfo.cmake"
+  "libnczarr/CMakeFiles/nczarr.dir/DependInfo.cmake"
+  "plugins/CMakeFiles/h5misc.dir/DependInfo.cmake"
+  "plugins/CMakeFiles/h5noop.dir/DependInfo.cmake"
+  "plugins/CMakeFiles/h5noop1.dir/DependInfo.cmake"
+  "plugins/CMakeFiles/h5unknown.dir/DependInfo.cmake"
+  "plugins/CMakeFiles/h5shuffle.dir/DependInfo.cmake"
+  "plugins/CMakeFiles/h5fletcher32.dir/DependInfo.cmake"
+  "plugins/CMakeFiles/h5deflate.dir/DependInfo.cmake"
+  "plugins/CMakeFiles/nczmisc.dir/DependInfo.cmake"
+  "plugins/CMakeFiles/nczhdf5filters.dir/DependInfo.cmake"
+  "plugins/CMakeFiles/nczstdfilters.dir/DependInfo.cmake"
+  "plugins/CMakeFiles/h5szip.dir/DependInfo.cmake"
+  "plugins/CMakeFiles/h5bzip2.dir/DependInfo.cmake"
+  "ncgen/CMakeFiles/ncgen.dir/DependInfo.cmake"
+  "ncgen3/CMakeFiles/ncgen3.dir/DependInfo.cmake"
+  "ncdump/CMakeFiles/ncdump.dir/DependInfo.cmake"
+  "ncdump/CMakeFiles/nccopy.dir/DependInfo.cmake"
+  "ncdump/CMakeFiles/ncvalidator.dir/DependInfo.cmake"
+  "ncdump/CMakeFiles/ncpathcvt.dir/DependInfo.cmake"
+  "ncdump/CMakeFiles/ncfilteravail.dir/DependInfo.cmake"
+  "ncdump/CMakeFiles/echon.dir/DependInfo.cmake"
+  "ncdump/CMakeFiles/nc4print.dir/DependInfo.cmake"
+  "ncdump/CMakeFiles/printfqn.dir/DependInfo.cmake"
+  "ncdump/CMakeFiles/nchdf5version.dir/DependInfo.cmake"
+  "ncdump/CMakeFiles/ocprint.dir/DependInfo.cmake"
+  "ncdump/CMakeFiles/rewrite-scalar.dir/DependInfo.cmake"
+  "ncdump/CMakeFiles/bom.dir/DependInfo.cmake"
+  "ncdump/CMakeFiles/tst_dimsizes.dir/DependInfo.cmake"
+  "ncdump/CMakeFiles/nctrunc.dir/DependInfo.cmake"
+  "ncdump/CMakeFiles/tst_fileinfo.dir/DependInfo.cmake"
+  "ncdump/CMakeFiles/tst_utf8.dir/DependInfo.cmake"
+  "ncdump/CMakeFiles/tst_fillbug.dir/DependInfo.cmake"
+  "ncdump/CMakeFiles/tst_h_rdc0.dir/DependInfo.cmake"
+  "ncdump/CMakeFiles/tst_unicode.dir/DependInfo.cmake"
+  "ncdump/CMakeFiles/tst_vlen_data.dir/DependInfo.cmake"
+  "ncdump/CMakeFiles/tst_create_files.dir/DependInfo.cmake"
+  "ncdump/CMakeFiles/tst_opaque_data.dir/DependInfo.cmake"
+  "ncdump/CMakeFiles/tst_string_data.dir/DependInfo.cmake"
+  "ncdump/CMakeFiles/tst_comp2.dir/DependInfo.cmake"
+  "ncdump/CMakeFiles/tst_nans.dir/DependInfo.cmake"
+  "ncdump/CMakeFiles/tst_h_scalar.dir/DependInfo.cmake"
+  "ncdump/CMakeFiles/tst_compress.dir/DependInfo.cmake"
+  "ncdump/CMakeFiles/tst_chunking.dir/DependInfo.cmake"
+  "ncdump/CMakeFiles/tst_group_data.dir/DependInfo.cmake"
+  "ncdump/CMakeFiles/tst_enum_data.dir/DependInfo.cmake"
+  "ncdump/CMakeFiles/tst_enum_undef.dir/DependInfo.cmake"
+  "ncdump/CMakeFiles/tst_comp.dir/DependInfo.cmake"
+  "ncdump/CMakeFiles/tst_special_atts.dir/DependInfo.cmake"
+  "ncdump/CMakeFiles/tst_udf_format_plugin.dir/DependInfo.cmake"
+  "ncdump/CMakeFiles/ref_ctest.dir/DependInfo.cmake"
+  "ncdump/CMakeFiles/ref_ctest64.dir/DependInfo.cmake"
+  "nctest/CMakeFiles/nctest.dir/DependInfo.cmake"
+  "nctest/CMakeFiles/tst_rename.dir/DependInfo.cmake"
+  "nc_test/CMakeFiles/nc_test.dir/DependInfo.cmake"
+  "nc_test/CMakeFiles/tst_diskless.dir/DependInfo.cmake"
+  "nc_test/CMakeFiles/tst_diskless3.dir/DependInfo.cmake"
+  "nc_test/CMakeFiles/tst_diskless4.dir/DependInfo.cmake"
+  "nc_test/CMakeFiles/tst_diskless5.dir/DependInfo.cmake"
+  "nc_test/CMakeFiles/tst_inmemory.dir/DependInfo.cmake"
+  "nc_test/CMakeFiles/tst_open_mem.dir/DependInfo.cmake"
+  "nc_test/CMakeFiles/tst_diskless2.dir/DependInfo.cmake"
+  "nc_test/CMakeFiles/nc_test_t_nc.dir/DependInfo.cmake"
+  "nc_test/CMakeFiles/nc_test_tst_small.dir/DependInfo.cmake"
+  "nc_test/CMakeFiles/nc_test_tst_misc.dir/DependInfo.cmake"
+  "nc_test/CMakeFiles/nc_test_tst_norm.dir/DependInfo.cmake"
+  "nc_test/CMakeFiles/nc_test_tst_names.dir/DependInfo.cmake"
+  "nc_test/CMakeFiles/nc_test_tst_nofill.dir/DependInfo.cmake"
+  "nc_test/CMakeFiles/nc_test_tst_nofill2.dir/DependInfo.cmake"
+  "nc_test/CMakeFiles/nc_test_tst_nofill3.dir/DependInfo.cmake"
+  "nc_test/CMakeFiles/nc_test_tst_meta.dir/DependInfo.cmake"
+  "nc_test/CMakeFiles/nc_test_tst_inq_type.dir/DependInfo.cmake"
+  "nc_test/CMakeFiles/nc_test_tst_utf8_phrases.dir/DependInfo.cmake"
+  "nc_test/CMakeFiles/nc_test_tst_global_fillval.dir/DependInfo.cmake"
+  "nc_test/CMakeFiles/nc_test_tst_max_var_dims.dir/DependInfo.cmake"
+  "nc_test/CMakeFiles/nc_test_tst_formats.dir/DependInfo.cmake"
+  "nc_test/CMakeFiles/nc_test_tst_def_var_fill.dir/DependInfo.cmake"
+  "nc_test/CMakeFiles/nc_test_tst_err_enddef.dir/DependInfo.cmake"
+  "nc_test/CMakeFiles/nc_test_tst_default_format.dir/DependInfo.cmake"
+  "nc_test/CMakeFiles/nc_test_tst_utf8_validate.dir/DependInfo.cmake"
+  "nc_test/CMakeFiles/nc_test_tst_diskless6.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/renamegroup.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/tst_charvlenbug.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/tst_vlenstr.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/tst_fillonly.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/build_fixedstring.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/tst_zero_len_att.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/tst_filterparser.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/test_filter.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/test_filter_misc.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/tst_multifilter.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/test_filter_order.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/test_filter_repeat.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/tst_filter_vlen.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/tst_empty_vlen_unlim.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/tst_udf_self_load_plugin.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_udf_self_load.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/test_szip.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/h5testszip.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_dims.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_dims2.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_dims3.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_files.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_files4.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_vars.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_varms.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_unlim_vars.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_converts.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_converts2.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_grps.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_grps2.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_compounds.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_compounds2.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_compounds3.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_opaques.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_strings.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_strings2.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_interops.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_interops4.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_interops6.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_interops_dims.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_enums.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_coords.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_coords2.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_coords3.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_vars3.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_vars4.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_chunks.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_chunks2.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_utf8.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_fills.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_fills2.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_fillbug.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_xplatform2.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_endian_fill.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_atts.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_t_type.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_cdm_sea_soundings.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_vl.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_atts1.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_atts2.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_vars2.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_files5.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_files6.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_sync.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_h_strbug.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_h_refs.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_h_scalar.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_rename.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_rename2.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_rename3.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_h5_endians.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_atts_string_rewrite.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_put_vars_two_unlim_dim.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_hdf5_file_compat.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_fill_attr_vanish.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_rehash.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_types.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_bug324.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_atts3.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_put_vars.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_elatefill.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_udf.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_udf_multi.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_udf_open_mode.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_bug1442.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_broken_files.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_quantize.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_h_transient_types.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_strided_write.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_varsperf.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_vlen_unlim.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_mem_safety.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_meta_block_size.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_xplatform.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_virtual_datasets.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_interops5.dir/DependInfo.cmake"
+  "nc_test4/CMakeFiles/nc_test4_tst_camrun.dir/DependInfo.cmake"
+  "h5_test/CMakeFiles/tst_h_files.dir/DependInfo.cmake"
+  "h5_test/CMakeFiles/tst_h_files2.dir/DependInfo.cmake"
+  "h5_test/CMakeFiles/tst_h_files4.dir/DependInfo.cmake"
+  "h5_test/CMakeFiles/tst_h_atts.dir/DependInfo.cmake"
+  "h5_test/CMakeFiles/tst_h_atts3.dir/DependInfo.cmake"
+  "h5_test/CMakeFiles/tst_h_atts4.dir/DependInfo.cmake"
+  "h5_test/CMakeFiles/tst_h_vars.dir/DependInfo.cmake"
+  "h5_test/CMakeFiles/tst_h_vars2.dir/DependInfo.cmake"
+  "h5_test/CMakeFiles/tst_h_vars3.dir/DependInfo.cmake"
+  "h5_test/CMakeFiles/tst_h_grps.dir/DependInfo.cmake"
+  "h5_test/CMakeFiles/tst_h_compounds.dir/DependInfo.cmake"
+  "h5_test/CMakeFiles/tst_h_compounds2.dir/DependInfo.cmake"
+  "h5_test/CMakeFiles/tst_h_wrt_cmp.dir/DependInfo.cmake"
+  "h5_test/CMakeFiles/tst_h_vl.dir/DependInfo.cmake"
+  "h5_test/CMakeFiles/tst_h_opaques.dir/DependInfo.cmake"
+  "h5_test/CMakeFiles/tst_h_strings.dir/DependInfo.cmake"
+  "h5_test/CMakeFiles/tst_h_strings1.dir/DependInfo.cmake"
+  "h5_test/CMakeFiles/tst_h_strings2.dir/DependInfo.cmake"
+  "h5_test/CMakeFiles/tst_h_ints.dir/DependInfo.cmake"
+  "h5_test/CMakeFiles/tst_h_dimscales.dir/DependInfo.cmake"
+  "h5_test/CMakeFiles/tst_h_dimscales1.dir/DependInfo.cmake"
+  "h5_test/CMakeFiles/tst_h_dimscales2.dir/DependInfo.cmake"
+  "h5_test/CMakeFiles/tst_h_dimscales3.dir/DependInfo.cmake"
+  "h5_test/CMakeFiles/tst_h_enums.dir/DependInfo.cmake"
+  "h5_test/CMakeFiles/tst_h_dimscales4.dir/DependInfo.cmake"
+  "h5_test/CMakeFiles/tst_h_rename.dir/DependInfo.cmake"
+  "h5_test/CMakeFiles/tst_h5_open_close.dir/DependInfo.cmake"
+  "ncdap_test/CMakeFiles/findtestserver.dir/DependInfo.cmake"
+  "ncdap_test/CMakeFiles/pingurl.dir/DependInfo.cmake"
+  "ncdap_test/CMakeFiles/ncdap_t_dap3a.dir/DependInfo.cmake"
+  "ncdap_test/CMakeFiles/ncdap_test_cvt.dir/DependInfo.cmake"
+  "ncdap_test/CMakeFiles/ncdap_test_vara.dir/DependInfo.cmake"
+  "dap4_test/CMakeFiles/findtestserver4.dir/DependInfo.cmake"
+  "dap4_test/CMakeFiles/pingurl4.dir/DependInfo.cmake"
+  "dap4_test/CMakeFiles/test_parse.dir/DependInfo.cmake"
+  "dap4_test/CMakeFiles/test_meta.dir/DependInfo.cmake"
+  "dap4_test/CMakeFiles/test_data.dir/DependInfo.cmake"
+  "examples/C/CMakeFiles/C_tests_simple_xy_wr.dir/DependInfo.cmake"
+  "examples/C/CMakeFiles/C_tests_simple_xy_rd.dir/DependInfo.cmake"
+  "examples/C/CMakeFiles/C_tests_sfc_pres_temp_wr.dir/DependInfo.cmake"
+  "examples/C/CMakeFiles/C_tests_sfc_pres_temp_rd.dir/DependInfo.cmake"
+  "examples/C/CMakeFiles/C_tests_pres_temp_4D_wr.dir/DependInfo.cmake"
+  "examples/C/CMakeFiles/C_tests_pres_temp_4D_rd.dir/DependInfo.cmake"
+  "examples/C/CMakeFiles/C_tests_format.dir/DependInfo.cmake"
+  "nc_perf/CMakeFiles/bm_file.dir/DependInfo.cmake"
+  "nc_perf/CMakeFiles/tst_chunks3.dir/DependInfo.cmake"
+  "nc_perf/CMakeFiles/tst_ar4.dir/DependInfo.cmake"
+  "nc_perf/CMakeFiles/tst_ar4_4d.dir/DependInfo.cmake"
+  "nc_perf/CMakeFiles/bm_many_objs.dir/DependInfo.cmake"
+  "nc_perf/CMakeFiles/tst_h_many_atts.dir/DependInfo.cmake"
+  "nc_perf/CMakeFiles/bm_many_atts.dir/DependInfo.cmake"
+  "nc_perf/CMakeFiles/tst_files2.dir/DependInfo.cmake"
+  "nc_perf/CMakeFiles/tst_knmi.dir/DependInfo.cmake"
+  "nc_perf/CMakeFiles/bm_netcdf4_recs.dir/DependInfo.cmake"
+  "nc_perf/CMakeFiles/bigmeta.dir/DependInfo.cmake"
+  "nc_perf/CMakeFiles/openbigmeta.dir/DependInfo.cmake"
+  "nc_perf/CMakeFiles/nc_perf_tst_ar4_3d.dir/DependInfo.cmake"
+  "nc_perf/CMakeFiles/nc_perf_tst_create_files.dir/DependInfo.cmake"
+  "nc_perf/CMakeFiles/nc_perf_tst_files3.dir/DependInfo.cmake"
+  "nc_perf/CMakeFiles/nc_perf_tst_mem.dir/DependInfo.cmake"
+  "nc_perf/CMakeFiles/nc_perf_tst_wrf_reads.dir/DependInfo.cmake"
+  "nc_perf/CMakeFiles/nc_perf_tst_attsperf.dir/DependInfo.cmake"
+  "nc_perf/CMakeFiles/nc_perf_tst_bm_rando.dir/DependInfo.cmake"
+  "nc_perf/CMakeFiles/nc_perf_tst_compress.dir/DependInfo.cmake"
+  "unit_test/CMakeFiles/unit_test_test_ncuri.dir/DependInfo.cmake"
+  "unit_test/CMakeFiles/unit_test_tst_udf_infermodel.dir/DependInfo.cmake"
+  "unit_test/CMakeFiles/unit_test_test_dauth.dir/DependInfo.cmake"
+  "unit_test/CMakeFiles/unit_test_tst_nclist.dir/DependInfo.cmake"
+  "unit_test/CMakeFiles/unit_test_tst_nc4internal.dir/DependInfo.cmake"
+  "unit_test/CMakeFiles/tst_reclaim.dir/DependInfo.cmake"
+  "unit_test/CMakeFiles/tst_pluginpaths.dir/DependInfo.cmake"
+  "unit_test/CMakeFiles/ncpluginpath.dir/DependInfo.cmake"
+  "unit_test/CMakeFiles/test_pathcvt.dir/DependInfo.cmake"
+  "unit_test/CMakeFiles/unit_test_tst_exhash.dir/DependInfo.cmake"
+  "unit_test/CMakeFiles/unit_test_tst_xcache.dir/DependInfo.cmake"
+  "unit_test/CMakeFiles/unit_test_tst_xcachelru.dir/DependInfo.cmake"
+  "nczarr_test/CMakeFiles/ut_util.dir/DependInfo.cmake"
+  "nczarr_test/CMakeFiles/test_utils.dir/DependInfo.cmake"
+  "nczarr_test/CMakeFiles/ut_map.dir/DependInfo.cmake"
+  "nczarr_test/CMakeFiles/ut_mapapi.dir/DependInfo.cmake"
+  "nczarr_test/CMakeFiles/ut_json.dir/DependInfo.cmake"
+  "nczarr_test/CMakeFiles/nczarr_test_ut_zinfer.dir/DependInfo.cmake"
+  "nczarr_test/CMakeFiles/test_fillonlyz.dir/DependInfo.cmake"
+  "nczarr_test/CMakeFiles/test_quantize.dir/DependInfo.cmake"
+  "nczarr_test/CMakeFiles/test_notzarr.dir/DependInfo.cmake"
+  "nczarr_test/CMakeFiles/nczarr_test_test_zmapmem.dir/DependInfo.cmake"
+  "nczarr_test/CMakeFiles/nczarr_test_test_zshard.dir/DependInfo.cmake"
+  "nczarr_test/CMakeFiles/nczarr_test_test_zarrv3.dir/DependInfo.cmake"
+  "nczarr_test/CMakeFiles/nczarr_test_test_zlazy.dir/DependInfo.cmake"
+  "nczarr_test/CMakeFiles/nczarr_test_test_jsonparse.dir/DependInfo.cmake"
+  "nczarr_test/CMakeFiles/bm_cslopen.dir/DependInfo.cmake"
+  "nczarr_test/CMakeFiles/nczarr_test_test_unlim_vars.dir/DependInfo.cmake"
+  "nczarr_test/CMakeFiles/nczarr_test_test_put_vars_two_unlim_dim.dir/DependInfo.cmake"
+  "nczarr_test/CMakeFiles/test_zchunks.dir/DependInfo.cmake"
+  "nczarr_test/CMakeFiles/test_zchunks2.dir/DependInfo.cmake"
+  "nczarr_test/CMakeFiles/test_zchunks3.dir/DependInfo.cmake"
+  "nczarr_test/CMakeFiles/test_unlim_io.dir/DependInfo.cmake"
+  "nczarr_test/CMakeFiles/test_chunking.dir/DependInfo.cmake"
+  "nczarr_test/CMakeFiles/zhex.dir/DependInfo.cmake"
+  "nczarr_test/CMakeFiles/zisjson.dir/DependInfo.cmake"
+  "nczarr_test/CMakeFiles/zs3parse.dir/DependInfo.cmake"
+  "nczarr_test/CMakeFiles/zmapio.dir/DependInfo.cmake"
+  "nczarr_test/CMakeFiles/ncdumpchunks.dir/DependInfo.cmake"
+  "nczarr_test/CMakeFiles/test_nczfilter.dir/DependInfo.cmake"
+  "nczarr_test/CMakeFiles/test_filter_vlen.dir/DependInfo.cmake"
+  "nczarr_test/CMakeFiles/testfilter.dir/DependInfo.cmake"
+  "nczarr_test/CMakeFiles/testfilter_misc.dir/DependInfo.cmake"
+  "nczarr_test/CMakeFiles/testfilter_multi.dir/DependInfo.cmake"
+  "nczarr_test/CMakeFiles/testfilter_order.dir/DependInfo.cmake"
+  "nczarr_test/CMakeFiles/testfilter_repeat.dir/DependInfo.cmake"
+  )
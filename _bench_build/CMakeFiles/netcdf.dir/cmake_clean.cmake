@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/netcdf.dir/liblib/nc_initialize.c.o"
+  "CMakeFiles/netcdf.dir/liblib/nc_initialize.c.o.d"
+  "libnetcdf.pdb"
+  "libnetcdf.so"
+  "libnetcdf.so.22"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/netcdf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
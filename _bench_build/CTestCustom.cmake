@@ -0,0 +1,21 @@
+# Copyright 1993, 1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001, 2002,
+# 2003, 2004, 2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014,
+# 2015, 2016, 2017, 2018
+# University Corporation for Atmospheric Research/Unidata.
+
+# See netcdf-c/COPYRIGHT file for more info.
+## This file is used to customize CTest.
+## See:
+##
+##  http://public.kitware.com/Wiki/CTest:Using_CTEST_and_CDASH_without_CMAKE
+##
+## for more information.
+
+set(CTEST_CUSTOM_MAXIMUM_NUMBER_OF_WARNINGS "500")
+
+IF(HAVE_BASH)
+IF(ENABLE_S3_TESTING)
+# Assume run in top-level CMAKE_BINARY_DIR
+set(CTEST_CUSTOM_POST_TEST "bash /root/repo/_bench_build/s3cleanup.sh")
+ENDIF()
+ENDIF()
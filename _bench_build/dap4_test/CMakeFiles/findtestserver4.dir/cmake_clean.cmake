@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/findtestserver4.dir/findtestserver4.c.o"
+  "CMakeFiles/findtestserver4.dir/findtestserver4.c.o.d"
+  "findtestserver4"
+  "findtestserver4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/findtestserver4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,25 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/dap4_test
+# Build directory: /root/repo/_bench_build/dap4_test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[dap4_test_test_parse]=] "bash" "-c" "export srcdir=/root/repo/dap4_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/dap4_test/test_parse.sh ")
+set_tests_properties([=[dap4_test_test_parse]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/dap4_test/CMakeLists.txt;47;add_sh_test;/root/repo/dap4_test/CMakeLists.txt;0;")
+add_test([=[dap4_test_test_raw]=] "bash" "-c" "export srcdir=/root/repo/dap4_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/dap4_test/test_raw.sh ")
+set_tests_properties([=[dap4_test_test_raw]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/dap4_test/CMakeLists.txt;48;add_sh_test;/root/repo/dap4_test/CMakeLists.txt;0;")
+add_test([=[dap4_test_test_meta]=] "bash" "-c" "export srcdir=/root/repo/dap4_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/dap4_test/test_meta.sh ")
+set_tests_properties([=[dap4_test_test_meta]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/dap4_test/CMakeLists.txt;49;add_sh_test;/root/repo/dap4_test/CMakeLists.txt;0;")
+add_test([=[dap4_test_test_data]=] "bash" "-c" "export srcdir=/root/repo/dap4_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/dap4_test/test_data.sh ")
+set_tests_properties([=[dap4_test_test_data]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/dap4_test/CMakeLists.txt;50;add_sh_test;/root/repo/dap4_test/CMakeLists.txt;0;")
+add_test([=[dap4_test_test_remote]=] "bash" "-c" "export srcdir=/root/repo/dap4_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/dap4_test/test_remote.sh ")
+set_tests_properties([=[dap4_test_test_remote]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/dap4_test/CMakeLists.txt;55;add_sh_test;/root/repo/dap4_test/CMakeLists.txt;0;")
+add_test([=[dap4_test_test_dap4url]=] "bash" "-c" "export srcdir=/root/repo/dap4_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/dap4_test/test_dap4url.sh ")
+set_tests_properties([=[dap4_test_test_dap4url]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/dap4_test/CMakeLists.txt;57;add_sh_test;/root/repo/dap4_test/CMakeLists.txt;0;")
+subdirs("baseline")
+subdirs("baselineraw")
+subdirs("baselineremote")
+subdirs("baselinehyrax")
+subdirs("baselinethredds")
+subdirs("cdltestfiles")
+subdirs("rawtestfiles")
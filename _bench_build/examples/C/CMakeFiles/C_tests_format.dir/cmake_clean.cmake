@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "*.nc"
+  "CMakeFiles/C_tests_format.dir/format.c.o"
+  "CMakeFiles/C_tests_format.dir/format.c.o.d"
+  "C_tests_format"
+  "C_tests_format.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/C_tests_format.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/examples/CDL
+# Build directory: /root/repo/_bench_build/examples/CDL
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[cdl_do_comps]=] "bash" "-c" "export srcdir=/root/repo/examples/CDL;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/examples/CDL/do_comps.sh ")
+set_tests_properties([=[cdl_do_comps]=] PROPERTIES  DEPENDS "C_test_pres_temp_4D_wr" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/examples/CDL/CMakeLists.txt;14;add_sh_test;/root/repo/examples/CDL/CMakeLists.txt;0;")
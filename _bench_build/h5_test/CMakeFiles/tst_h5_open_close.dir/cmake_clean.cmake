@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_h5_open_close.dir/tst_h5_open_close.c.o"
+  "CMakeFiles/tst_h5_open_close.dir/tst_h5_open_close.c.o.d"
+  "tst_h5_open_close"
+  "tst_h5_open_close.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_h5_open_close.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_h_atts.dir/tst_h_atts.c.o"
+  "CMakeFiles/tst_h_atts.dir/tst_h_atts.c.o.d"
+  "tst_h_atts"
+  "tst_h_atts.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_h_atts.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
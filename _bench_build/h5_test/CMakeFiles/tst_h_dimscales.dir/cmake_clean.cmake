@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_h_dimscales.dir/tst_h_dimscales.c.o"
+  "CMakeFiles/tst_h_dimscales.dir/tst_h_dimscales.c.o.d"
+  "tst_h_dimscales"
+  "tst_h_dimscales.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_h_dimscales.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
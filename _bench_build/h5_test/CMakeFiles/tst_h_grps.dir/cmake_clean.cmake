@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_h_grps.dir/tst_h_grps.c.o"
+  "CMakeFiles/tst_h_grps.dir/tst_h_grps.c.o.d"
+  "tst_h_grps"
+  "tst_h_grps.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_h_grps.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_h_ints.dir/tst_h_ints.c.o"
+  "CMakeFiles/tst_h_ints.dir/tst_h_ints.c.o.d"
+  "tst_h_ints"
+  "tst_h_ints.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_h_ints.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
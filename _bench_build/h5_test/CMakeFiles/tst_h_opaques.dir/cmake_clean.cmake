@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_h_opaques.dir/tst_h_opaques.c.o"
+  "CMakeFiles/tst_h_opaques.dir/tst_h_opaques.c.o.d"
+  "tst_h_opaques"
+  "tst_h_opaques.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_h_opaques.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
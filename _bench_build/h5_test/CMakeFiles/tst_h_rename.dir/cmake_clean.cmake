@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_h_rename.dir/tst_h_rename.c.o"
+  "CMakeFiles/tst_h_rename.dir/tst_h_rename.c.o.d"
+  "tst_h_rename"
+  "tst_h_rename.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_h_rename.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_h_strings.dir/tst_h_strings.c.o"
+  "CMakeFiles/tst_h_strings.dir/tst_h_strings.c.o.d"
+  "tst_h_strings"
+  "tst_h_strings.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_h_strings.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
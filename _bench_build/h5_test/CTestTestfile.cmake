@@ -0,0 +1,60 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/h5_test
+# Build directory: /root/repo/_bench_build/h5_test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[tst_h_files]=] "/tst_h_files")
+set_tests_properties([=[tst_h_files]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/h5_test/CMakeLists.txt;19;ADD_TEST;/root/repo/h5_test/CMakeLists.txt;0;")
+add_test([=[tst_h_files2]=] "/tst_h_files2")
+set_tests_properties([=[tst_h_files2]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/h5_test/CMakeLists.txt;19;ADD_TEST;/root/repo/h5_test/CMakeLists.txt;0;")
+add_test([=[tst_h_files4]=] "/tst_h_files4")
+set_tests_properties([=[tst_h_files4]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/h5_test/CMakeLists.txt;19;ADD_TEST;/root/repo/h5_test/CMakeLists.txt;0;")
+add_test([=[tst_h_atts]=] "/tst_h_atts")
+set_tests_properties([=[tst_h_atts]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/h5_test/CMakeLists.txt;19;ADD_TEST;/root/repo/h5_test/CMakeLists.txt;0;")
+add_test([=[tst_h_atts3]=] "/tst_h_atts3")
+set_tests_properties([=[tst_h_atts3]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/h5_test/CMakeLists.txt;19;ADD_TEST;/root/repo/h5_test/CMakeLists.txt;0;")
+add_test([=[tst_h_atts4]=] "/tst_h_atts4")
+set_tests_properties([=[tst_h_atts4]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/h5_test/CMakeLists.txt;19;ADD_TEST;/root/repo/h5_test/CMakeLists.txt;0;")
+add_test([=[tst_h_vars]=] "/tst_h_vars")
+set_tests_properties([=[tst_h_vars]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/h5_test/CMakeLists.txt;19;ADD_TEST;/root/repo/h5_test/CMakeLists.txt;0;")
+add_test([=[tst_h_vars2]=] "/tst_h_vars2")
+set_tests_properties([=[tst_h_vars2]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/h5_test/CMakeLists.txt;19;ADD_TEST;/root/repo/h5_test/CMakeLists.txt;0;")
+add_test([=[tst_h_vars3]=] "/tst_h_vars3")
+set_tests_properties([=[tst_h_vars3]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/h5_test/CMakeLists.txt;19;ADD_TEST;/root/repo/h5_test/CMakeLists.txt;0;")
+add_test([=[tst_h_grps]=] "/tst_h_grps")
+set_tests_properties([=[tst_h_grps]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/h5_test/CMakeLists.txt;19;ADD_TEST;/root/repo/h5_test/CMakeLists.txt;0;")
+add_test([=[tst_h_compounds]=] "/tst_h_compounds")
+set_tests_properties([=[tst_h_compounds]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/h5_test/CMakeLists.txt;19;ADD_TEST;/root/repo/h5_test/CMakeLists.txt;0;")
+add_test([=[tst_h_compounds2]=] "/tst_h_compounds2")
+set_tests_properties([=[tst_h_compounds2]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/h5_test/CMakeLists.txt;19;ADD_TEST;/root/repo/h5_test/CMakeLists.txt;0;")
+add_test([=[tst_h_wrt_cmp]=] "/tst_h_wrt_cmp")
+set_tests_properties([=[tst_h_wrt_cmp]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/h5_test/CMakeLists.txt;19;ADD_TEST;/root/repo/h5_test/CMakeLists.txt;0;")
+add_test([=[tst_h_vl]=] "/tst_h_vl")
+set_tests_properties([=[tst_h_vl]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/h5_test/CMakeLists.txt;19;ADD_TEST;/root/repo/h5_test/CMakeLists.txt;0;")
+add_test([=[tst_h_opaques]=] "/tst_h_opaques")
+set_tests_properties([=[tst_h_opaques]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/h5_test/CMakeLists.txt;19;ADD_TEST;/root/repo/h5_test/CMakeLists.txt;0;")
+add_test([=[tst_h_strings]=] "/tst_h_strings")
+set_tests_properties([=[tst_h_strings]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/h5_test/CMakeLists.txt;19;ADD_TEST;/root/repo/h5_test/CMakeLists.txt;0;")
+add_test([=[tst_h_strings1]=] "/tst_h_strings1")
+set_tests_properties([=[tst_h_strings1]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/h5_test/CMakeLists.txt;19;ADD_TEST;/root/repo/h5_test/CMakeLists.txt;0;")
+add_test([=[tst_h_strings2]=] "/tst_h_strings2")
+set_tests_properties([=[tst_h_strings2]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/h5_test/CMakeLists.txt;19;ADD_TEST;/root/repo/h5_test/CMakeLists.txt;0;")
+add_test([=[tst_h_ints]=] "/tst_h_ints")
+set_tests_properties([=[tst_h_ints]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/h5_test/CMakeLists.txt;19;ADD_TEST;/root/repo/h5_test/CMakeLists.txt;0;")
+add_test([=[tst_h_dimscales]=] "/tst_h_dimscales")
+set_tests_properties([=[tst_h_dimscales]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/h5_test/CMakeLists.txt;19;ADD_TEST;/root/repo/h5_test/CMakeLists.txt;0;")
+add_test([=[tst_h_dimscales1]=] "/tst_h_dimscales1")
+set_tests_properties([=[tst_h_dimscales1]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/h5_test/CMakeLists.txt;19;ADD_TEST;/root/repo/h5_test/CMakeLists.txt;0;")
+add_test([=[tst_h_dimscales2]=] "/tst_h_dimscales2")
+set_tests_properties([=[tst_h_dimscales2]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/h5_test/CMakeLists.txt;19;ADD_TEST;/root/repo/h5_test/CMakeLists.txt;0;")
+add_test([=[tst_h_dimscales3]=] "/tst_h_dimscales3")
+set_tests_properties([=[tst_h_dimscales3]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/h5_test/CMakeLists.txt;19;ADD_TEST;/root/repo/h5_test/CMakeLists.txt;0;")
+add_test([=[tst_h_enums]=] "/tst_h_enums")
+set_tests_properties([=[tst_h_enums]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/h5_test/CMakeLists.txt;19;ADD_TEST;/root/repo/h5_test/CMakeLists.txt;0;")
+add_test([=[tst_h_dimscales4]=] "/tst_h_dimscales4")
+set_tests_properties([=[tst_h_dimscales4]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/h5_test/CMakeLists.txt;19;ADD_TEST;/root/repo/h5_test/CMakeLists.txt;0;")
+add_test([=[tst_h_rename]=] "/tst_h_rename")
+set_tests_properties([=[tst_h_rename]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/h5_test/CMakeLists.txt;19;ADD_TEST;/root/repo/h5_test/CMakeLists.txt;0;")
+add_test([=[tst_h5_open_close]=] "/tst_h5_open_close")
+set_tests_properties([=[tst_h5_open_close]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/h5_test/CMakeLists.txt;19;ADD_TEST;/root/repo/h5_test/CMakeLists.txt;0;")
@@ -0,0 +1,1932 @@
+/* Copyright 2018, UCAR/Unidata.
+   See the COPYRIGHT file for more information.
+*/
+
+#ifndef NETCDF_JSON_H
+#define NETCDF_JSON_H 1
+
+#ifndef OPTEXPORT
+#ifdef NETCDF_JSON_H
+#define OPTEXPORT static
+#else /*!NETCDF_JSON_H*/
+#ifdef _WIN32
+#define OPTEXPORT __declspec(dllexport)
+#else /*!WIN32*/
+#define OPTEXPORT extern
+#endif /*WIN32*/
+#endif /*NETCDF_JSON_H*/
+#endif /*OPTEXPORT*/
+
+/**************************************************/
+
+/* Return codes */
+#define NCJ_OK 0 /* must equal NC_NOERR in netcdf.h */
+#define NCJ_ERR (-1) /* must equal NC_ERROR in netcdf.h */
+
+/* Json object sorts (note use of term sort rather than e.g. type or discriminant) */
+#define NCJ_UNDEF    0
+#define NCJ_STRING   1
+#define NCJ_INT      2
+#define NCJ_DOUBLE   3
+#define NCJ_BOOLEAN  4
+#define NCJ_DICT     5
+#define NCJ_ARRAY    6
+#define NCJ_NULL     7
+
+#define NCJ_NSORTS   8
+
+/* Parse/dump/text/unparse flags */
+#define NCJFLAG_NONE	    0
+#define NCJFLAG_INDENTED    1
+#define NCJFLAG_ARENA	    2 /* parse: allocate the whole tree from one arena that is freed with the root */
+
+/* Define a struct to store primitive values as unquoted
+   strings. The sort will provide more info.  Do not bother with
+   a union since the amount of saved space is minimal.
+*/
+
+typedef struct NCjson {
+    int sort;     /* of this object */
+    int flags;    /* private: which parts of this object belong to a parse arena */
+    char* string; /* sort != DICT|ARRAY */
+    struct NCjlist {
+	size_t alloc; /* 0 with len > 0 => contents belong to a parse arena */
+	size_t len;
+	struct NCjson** contents;
+	struct NCjindex* index; /* sort == DICT: hash index of the keys of a large dict; may be NULL */
+    } list; /* sort == DICT|ARRAY */
+} NCjson;
+
+/* Structure to hold result of convertinf one json sort to  value of another type;
+   don't use union so we can know when to reclaim sval
+*/
+struct NCJconst {int bval; long long ival; double dval; char* sval;};
+
+/* Event callbacks for NCJparsecb; any of them may be NULL.
+   Keys and atomic values are passed as nul terminated text that
+   is only valid for the duration of the call.
+   A callback that returns other than NCJ_OK stops the parse.
+*/
+typedef struct NCJcallbacks {
+    int (*begin)(void* state, int sort); /* start of an NCJ_DICT or NCJ_ARRAY */
+    int (*end)(void* state, int sort); /* end of the innermost NCJ_DICT or NCJ_ARRAY */
+    int (*key)(void* state, const char* key, size_t len); /* next key of a dict */
+    int (*value)(void* state, int sort, const char* text, size_t len); /* atomic value or NCJ_NULL */
+} NCJcallbacks;
+
+/**************************************************/
+/* Extended API */
+
+/* Return NCJ_OK if ok else NCJ_ERR */
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /*__cplusplus*/
+
+/* Parse a string to NCjson*/
+OPTEXPORT int NCJparse(const char* text, unsigned flags, NCjson** jsonp);
+
+/* Parse a counted string to NCjson*/
+OPTEXPORT int NCJparsen(size_t len, const char* text, unsigned flags, NCjson** jsonp);
+
+/* Parse a counted string, reporting its structure as events instead of building a tree */
+OPTEXPORT int NCJparsecb(size_t len, const char* text, unsigned flags, const NCJcallbacks* callbacks, void* state);
+
+/* Reclaim a JSON tree */
+OPTEXPORT void NCJreclaim(NCjson* json);
+
+/* Create a new JSON node of a given sort */
+OPTEXPORT int NCJnew(int sort, NCjson** objectp);
+
+/* Create new json object with given string content */
+OPTEXPORT int NCJnewstring(int sort, const char* value, NCjson** jsonp);
+
+/* Create new json object with given counted string content */
+OPTEXPORT int NCJnewstringn(int sort, size_t len, const char* value, NCjson** jsonp);
+
+/* Get dict key value by name */
+OPTEXPORT int NCJdictget(const NCjson* dict, const char* key, const NCjson** valuep);
+
+/* Functional version of NCJdictget */
+OPTEXPORT NCjson* NCJdictlookup(const NCjson* dict, const char* key);
+
+/* Convert one json sort to  value of another type; don't use union so we can know when to reclaim sval */
+OPTEXPORT int NCJcvt(const NCjson* value, int outsort, struct NCJconst* output);
+
+/* Append an atomic value to an array or dict object. */
+OPTEXPORT int NCJaddstring(NCjson* json, int sort, const char* s);
+
+/* Append value to an array or dict object. */
+OPTEXPORT int NCJappend(NCjson* object, NCjson* value);
+
+/* Append string value to an array or dict object. */
+OPTEXPORT int NCJappendstring(NCjson* object, int sort, const char* s);
+
+/* Append int value to an array or dict object. */
+OPTEXPORT int NCJappendint(NCjson* object, long long n);
+
+/* Insert (string)key-(NCjson*)value pair into a dict object. key will be copied; jvalue will not */
+OPTEXPORT int NCJinsert(NCjson* object, const char* key, NCjson* jvalue);
+
+/* Insert key-value pair into a dict object. key and value will be copied */
+OPTEXPORT int NCJinsertstring(NCjson* object, const char* key, const char* value);
+
+/* Overwrite key-value pair in a dict object. Act like NCJinsert if key not found */
+OPTEXPORT int NCJoverwrite(NCjson* object, const char* key, NCjson* value);
+
+/* Insert key-value pair into a dict object. key and value will be copied */
+OPTEXPORT int NCJinsertint(NCjson* object, const char* key, long long n);
+
+/* Unparser to convert NCjson object to text in buffer */
+OPTEXPORT int NCJunparse(const NCjson* json, unsigned flags, char** textp);
+
+/* Deep clone a json object */
+OPTEXPORT int NCJclone(const NCjson* json, NCjson** clonep);
+
+#ifndef NETCDF_JSON_H
+
+/* dump NCjson* object to output file */
+OPTEXPORT void NCJdump(const NCjson* json, unsigned flags, FILE*);
+
+/* convert NCjson* object to output string */
+OPTEXPORT const char* NCJtotext(const NCjson* json, unsigned flags);
+
+/* Sort a dictionary by key */
+OPTEXPORT void NCJdictsort(NCjson* jdict);
+
+#endif /*NETCDF_JSON_H*/
+
+#if defined(__cplusplus)
+}
+#endif /*__cplusplus*/
+
+/* Getters */
+#define NCJsort(x) ((x)==NULL?NCJ_UNDEF:(x)->sort)
+#define NCJstring(x) ((x)==NULL?(char*)(x):(x)->string)
+#define NCJarraylength(x) ((x)==NULL ? 0 : (x)->list.len)
+#define NCJdictlength(x) ((x)==NULL ? 0 : ((x)->list.len) / 2)
+#define NCJcontents(x) ((x)==NULL?(struct NCjson**)(x):(x)->list.contents)
+#define NCJith(x,i) ((x)->list.contents[i])
+#define NCJdictkey(x,i) ((x)->list.contents[(i)*2])
+#define NCJdictvalue(x,i) ((x)->list.contents[((i)*2)+1])
+
+/* Setters */
+#define NCJsetsort(x,s) (x)->sort=(s)
+#define NCJsetstring(x,y) (x)->string=(y)
+#define NCJsetcontents(x,c) (x)->list.contents=(c)
+#define NCJsetarraylength(x,l) (x)->list.len=(l)
+#define NCJsetdictlength(x,l) (x)->list.len=((l)*2)
+
+/* Misc */
+#define NCJisatomic(j) ((j)->sort != NCJ_ARRAY && (j)->sort != NCJ_DICT && (j)->sort != NCJ_NULL && (j)->sort != NCJ_UNDEF)
+
+/**************************************************/
+/* Error detection helper */
+#undef NCJDEBUG
+#ifdef NCJDEBUG
+static int
+NCJBREAKPOINT(int err)
+{
+    (void)NCJBREAKPOINT;
+    return err;
+}
+#else
+#define NCJBREAKPOINT(err) (err)
+#endif /*NCJDEBUG*/
+#define NCJcheck(expr) do{if((expr) < 0) {stat = NCJBREAKPOINT(NCJ_ERR); goto done;}}while(0)
+
+/**************************************************/
+
+#endif /*!NETCDF_JSON_H*/ /* Leave the ! as a tag for sed */
+#ifdef NETCDF_JSON_H
+/* Copyright 2018, UCAR/Unidata.
+   See the COPYRIGHT file for more information.
+*/
+
+/*
+TODO: make utf8 safe
+*/
+
+/*
+WARNING:
+If you modify this file,
+then you need to go to
+the include/ directory
+and do the command:
+    make netcdf_json.h
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif /*HAVE_CONFIG_H*/
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+
+
+#undef NCJCATCH
+#undef NCJDEBUG
+#undef NCJTRACE
+
+#ifdef NCJCATCH
+/* Warning: do not evaluate err more than once */
+#define NCJTHROW(err) ncjbreakpoint(err)
+static int ncjbreakpoint(int err) {return err;}
+#else /*!NCJCATCH*/
+#define NCJTHROW(err) (err)
+#endif /*NCJCATCH*/
+
+/**************************************************/
+
+#define NCJ_EOF -2
+
+#define NCJ_LBRACKET '['
+#define NCJ_RBRACKET ']'
+#define NCJ_LBRACE '{'
+#define NCJ_RBRACE '}'
+#define NCJ_COLON ':'
+#define NCJ_COMMA ','
+#define NCJ_QUOTE '"'
+#define NCJ_ESCAPE '\\'
+#define NCJ_TAG_TRUE "true"
+#define NCJ_TAG_FALSE "false"
+#define NCJ_TAG_NULL "null"
+
+/* JSON_WORD Subsumes Number also */
+#define JSON_WORD "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_$+-."
+#define NCJ_ISWORD(c) (((c) >= 'a' && (c) <= 'z') || ((c) >= 'A' && (c) <= 'Z') || ((c) >= '0' && (c) <= '9') \
+		       || (c) == '_' || (c) == '$' || (c) == '+' || (c) == '-' || (c) == '.')
+
+#define NCJ_DEFAULTALLOC 16
+
+/* Dicts with at least this many keys are given a hash index */
+#define NCJ_INDEX_THRESHOLD 16
+
+/**************************************************/
+/* Open addressing hash index over the keys of a dict.
+   It is kept up to date by the functions in this file that add
+   keys to a dict; lookups only read it, so concurrent lookups
+   are safe. A dict whose list was changed by other means is
+   detected (contents or len changed) and searched linearly.
+*/
+struct NCjindex {
+    size_t nslots; /* power of 2 */
+    size_t nkeys; /* no. of keys indexed: keys 0..nkeys-1 */
+    struct NCjson** contents; /* list contents that were indexed */
+    size_t* slots; /* 1 + key number; 0 => empty slot */
+};
+
+/**************************************************/
+typedef struct NCJparser {
+    char* text;
+    size_t textlen; /* |text| after trimming */
+    char* pos;
+    size_t yylen; /* space allocated for yytext */
+    char* yytext; /* string or word */
+    size_t yytextlen; /* strlen(yytext) */
+    int token; /* last token lexed */
+    long long num;
+    int tf;
+    int status; /* NCJ_ERR|NCJ_OK */
+    unsigned flags;
+#     define NCJ_TRACE 1
+    const NCJcallbacks* callbacks; /* receive the parse events */
+    void* state; /* passed to the callbacks */
+} NCJparser;
+
+/**************************************************/
+/* Arena for NCJFLAG_ARENA parses: the nodes, strings and lists
+   of the tree are carved from a few large blocks that are all
+   freed with the root. The parts of a node that live in the arena
+   are marked so that NCJreclaim leaves them alone; anything later
+   added to such a tree is allocated as usual and reclaimed as usual.
+   Nodes of an arena tree must not outlive its root.
+*/
+
+/* NCjson.flags */
+#define NCJ_ARENA_NODE   1 /* the node itself is in an arena */
+#define NCJ_ARENA_STRING 2 /* node->string is in an arena */
+#define NCJ_ARENA_ROOT   4 /* the node is the json field of a struct NCjarenaroot */
+
+#define NCJ_ARENA_MINBLOCK (16*1024)
+#define NCJ_ARENA_MAXBLOCK (1024*1024)
+
+struct NCjblock {
+    struct NCjblock* next;
+    size_t size; /* usable bytes following this header */
+    size_t used;
+};
+
+struct NCjarena {
+    struct NCjblock* blocks; /* the first one is being carved */
+    size_t blocksize; /* size of the next block */
+};
+
+struct NCjarenaroot {
+    NCjson json; /* must be first */
+    struct NCjarena arena;
+};
+
+/* State of the tree builder driven by the parse events */
+typedef struct NCJbuilder {
+    NCJparser* parser;
+    int arenamode;
+    struct NCjarena* arena; /* arenamode: set when the root is created */
+    size_t top, alloc;
+    NCjson** stack; /* finished values and open containers */
+    size_t depth, falloc;
+    size_t* frames; /* stack index of the first member of each open container */
+} NCJbuilder;
+
+/* This is used only by the unparser */
+typedef struct NCJbuf {
+    size_t len; /* |text|; does not include nul terminator */
+    char* text; /* NULL || nul terminated */
+} NCJbuf;
+
+/**************************************************/
+
+#if defined(_WIN32) && !defined(__MINGW32__)
+#define strdup _strdup
+#define strcasecmp _stricmp
+#else /*!WIN32 || __MINGW32*/
+#include <strings.h>
+#endif /*defined(_WIN32) && !defined(__MINGW32__)*/
+
+#ifndef nullfree
+#define nullfree(x) {if(x)free(x);}
+#endif /*nullfree*/
+#ifndef nulldup
+#define nulldup(x) ((x)?strdup(x):(x))
+#endif /*nulldup*/
+
+#if defined NCJDEBUG || defined NCJTRACE
+static char* tokenname(int token);
+#endif /*defined NCJDEBUG || defined NCJTRACE*/
+
+/**************************************************/
+/* Forward */
+static int NCJparserinit(NCJparser* parser, size_t len, const char* text, unsigned flags);
+static void NCJparserclear(NCJparser* parser);
+static int NCJparseT(NCJparser* parser);
+static int NCJparseR(NCJparser* parser, int token);
+static int NCJparseArray(NCJparser* parser);
+static int NCJparseDict(NCJparser* parser);
+static int buildbegin(void* state, int sort);
+static int buildend(void* state, int sort);
+static int buildkey(void* state, const char* key, size_t len);
+static int buildvalue(void* state, int sort, const char* text, size_t len);
+static void builderclear(NCJbuilder* builder);
+static void* arenaalloc(struct NCjarena* arena, size_t size, size_t align);
+static void arenafree(struct NCjarena* arena);
+static int testbool(const char* word);
+static int testint(const char* word);
+static int testdouble(const char* word);
+static int testnull(const char* word);
+static int NCJlex(NCJparser* parser);
+static int NCJyytext(NCJparser*, char* start, size_t pdlen);
+static void NCJreclaimArray(struct NCjlist*);
+static void NCJreclaimDict(struct NCjlist*);
+static int NCJunescape(NCJparser* parser);
+static char unescape1(char c);
+
+static int listappend(struct NCjlist* list, NCjson* element);
+static int listsetalloc(struct NCjlist* list, size_t sz);
+static int listlookup(const struct NCjlist* list, const char* key, size_t* indexp);
+static size_t keyhash(const char* key);
+static void indexfree(struct NCjlist* dict);
+static void indexsync(struct NCjlist* dict);
+
+static int NCJcloneArray(const NCjson* array, NCjson** clonep);
+static int NCJcloneDict(const NCjson* dict, NCjson** clonep);
+
+/* These are used only by the unparser */
+static int NCJunparseR(const NCjson* json, NCJbuf* buf, unsigned flags);
+static int bytesappendquoted(NCJbuf* buf, const char* s);
+static int bytesappend(NCJbuf* buf, const char* s);
+static int bytesappendc(NCJbuf* bufp, char c);
+
+/* Hide everything for plugins */
+#ifdef NETCDF_JSON_H
+#define OPTSTATIC static
+#else /*!NETCDF_JSON_H*/
+#define OPTSTATIC
+#endif /*NETCDF_JSON_H*/
+
+/* List legal nan and infinity names (lower case); keep in strcasecmp sorted order */
+static const char* NANINF[] = {"-infinity","infinity","-infinityf","infinityf","nan","nanf"};
+static const size_t NNANINF = 6;
+
+static const NCJcallbacks NCJbuildcallbacks = {buildbegin,buildend,buildkey,buildvalue};
+
+/**************************************************/
+
+OPTSTATIC int
+NCJparse(const char* text, unsigned flags, NCjson** jsonp)
+{
+    size_t textlen = strlen(text);
+    return NCJparsen(textlen,text,flags,jsonp);
+}
+
+OPTSTATIC int
+NCJparsen(size_t len, const char* text, unsigned flags, NCjson** jsonp)
+{
+    int stat = NCJ_OK;
+    NCJparser parser;
+    NCJbuilder builder;
+
+    memset(&parser,0,sizeof(parser));
+    memset(&builder,0,sizeof(builder));
+    builder.parser = &parser;
+    builder.arenamode = ((flags & NCJFLAG_ARENA) != 0);
+    if((stat = NCJparserinit(&parser,len,text,flags))==NCJ_ERR) goto done;
+    parser.callbacks = &NCJbuildcallbacks;
+    parser.state = &builder;
+    if((stat = NCJparseT(&parser))==NCJ_ERR) goto done;
+    if(builder.top != 1 || builder.depth != 0)
+	{stat = NCJTHROW(NCJ_ERR); goto done;}
+    *jsonp = builder.stack[0];
+    builder.top = 0;
+
+done:
+    NCJparserclear(&parser);
+    builderclear(&builder);
+    return NCJTHROW(stat);
+}
+
+OPTSTATIC int
+NCJparsecb(size_t len, const char* text, unsigned flags, const NCJcallbacks* callbacks, void* state)
+{
+    int stat = NCJ_OK;
+    NCJparser parser;
+
+    memset(&parser,0,sizeof(parser));
+    if(callbacks == NULL)
+	{stat = NCJTHROW(NCJ_ERR); goto done;}
+    if((stat = NCJparserinit(&parser,len,text,flags))==NCJ_ERR) goto done;
+    parser.callbacks = callbacks;
+    parser.state = state;
+    stat = NCJparseT(&parser);
+
+done:
+    NCJparserclear(&parser);
+    return NCJTHROW(stat);
+}
+
+/* Set up a parser on a private copy of the text */
+static int
+NCJparserinit(NCJparser* parser, size_t len, const char* text, unsigned flags)
+{
+    int stat = NCJ_OK;
+
+    memset(parser,0,sizeof(NCJparser));
+    parser->flags = flags;
+    parser->text = (char*)malloc(len+1+1);
+    if(parser->text == NULL)
+	{stat = NCJTHROW(NCJ_ERR); goto done;}
+    memcpy(parser->text,text,len);
+    /* trim trailing whitespace */
+    if(len > 0) {
+	char* p;
+        for(p=parser->text+(len-1);p >= parser->text;p--) {
+	   if(*p > ' ') break;
+	}
+	len = (size_t)((p - parser->text) + 1);
+    }
+    if(len == 0) 
+	{stat = NCJTHROW(NCJ_ERR); goto done;}
+    parser->text[len] = '\0';
+    parser->text[len+1] = '\0';
+    parser->textlen = len;
+    parser->pos = &parser->text[0];
+    parser->status = NCJ_OK;
+#ifdef NCJDEBUG
+fprintf(stderr,"json: |%s|\n",parser->text);
+#endif /*NCJDEBUG*/
+done:
+    return NCJTHROW(stat);
+}
+
+static void
+NCJparserclear(NCJparser* parser)
+{
+    nullfree(parser->text);
+    nullfree(parser->yytext);
+    parser->text = NULL;
+    parser->yytext = NULL;
+}
+
+/* Parse the whole text as a single value */
+static int
+NCJparseT(NCJparser* parser)
+{
+    int stat = NCJ_OK;
+
+    if((stat = NCJparseR(parser,NCJlex(parser)))==NCJ_ERR) goto done;
+    /* Must consume all of the input */
+    if(parser->pos != (parser->text+parser->textlen)) {stat = NCJTHROW(NCJ_ERR); goto done;}
+done:
+    return NCJTHROW(stat);
+}
+
+/*
+Simple recursive descent
+intertwined with dict and list parsers.
+Each value is reported to the parser callbacks as it is recognized.
+
+Invariants:
+1. The first token of the value has already been lexed and is passed as an argument.
+2. On return, the last token of the value has been consumed.
+*/
+
+static int
+NCJparseR(NCJparser* parser, int token)
+{
+    int stat = NCJ_OK;
+    const NCJcallbacks* cb = parser->callbacks;
+
+    switch (token) {
+    case NCJ_NULL:
+    case NCJ_BOOLEAN:
+    case NCJ_INT:
+    case NCJ_DOUBLE:
+    case NCJ_STRING:
+	if(cb->value != NULL && cb->value(parser->state,token,parser->yytext,parser->yytextlen) != NCJ_OK)
+	    {stat = NCJTHROW(NCJ_ERR); goto done;}
+	break;
+    case NCJ_LBRACE:
+	if((stat = NCJparseDict(parser))==NCJ_ERR) goto done;
+	break;
+    case NCJ_LBRACKET:
+	if((stat = NCJparseArray(parser))==NCJ_ERR) goto done;
+	break;
+    case NCJ_EOF:
+    case NCJ_UNDEF:
+    default:
+	stat = NCJTHROW(NCJ_ERR);
+	break;
+    }
+
+done:
+    return NCJTHROW(stat);
+}
+
+static int
+NCJparseArray(NCJparser* parser)
+{
+    int stat = NCJ_OK;
+    int token = NCJ_UNDEF;
+    const NCJcallbacks* cb = parser->callbacks;
+
+    /* [ ^e1,e2, ...en] */
+
+    if(cb->begin != NULL && cb->begin(parser->state,NCJ_ARRAY) != NCJ_OK)
+	{stat = NCJTHROW(NCJ_ERR); goto done;}
+    token = NCJlex(parser);
+    while(token != NCJ_RBRACKET) {
+	/* Recurse to get the value ei */
+	if((stat = NCJparseR(parser,token))==NCJ_ERR) goto done;
+	/* Next token should be comma or rbracket */
+	switch((token = NCJlex(parser))) {
+	case NCJ_RBRACKET:
+	    break;
+	case NCJ_COMMA:
+	    token = NCJlex(parser); /* a trailing comma is tolerated */
+	    break;
+	case NCJ_EOF:
+	case NCJ_UNDEF:
+	default:
+	    stat = NCJTHROW(NCJ_ERR);
+	    goto done;
+	}	
+    }	
+    if(cb->end != NULL && cb->end(parser->state,NCJ_ARRAY) != NCJ_OK)
+	{stat = NCJTHROW(NCJ_ERR); goto done;}
+
+done:
+    return NCJTHROW(stat);
+}
+
+static int
+NCJparseDict(NCJparser* parser)
+{
+    int stat = NCJ_OK;
+    int token = NCJ_UNDEF;
+    const NCJcallbacks* cb = parser->callbacks;
+
+    /* { ^k1:v1,k2:v2, ...kn:vn] */
+
+    if(cb->begin != NULL && cb->begin(parser->state,NCJ_DICT) != NCJ_OK)
+	{stat = NCJTHROW(NCJ_ERR); goto done;}
+    token = NCJlex(parser);
+    while(token != NCJ_RBRACE) {
+	/* The key must be a word of some sort */
+	switch(token) {
+	case NCJ_STRING:
+	case NCJ_BOOLEAN:
+	case NCJ_INT: case NCJ_DOUBLE:
+	    if(cb->key != NULL && cb->key(parser->state,parser->yytext,parser->yytextlen) != NCJ_OK)
+		{stat = NCJTHROW(NCJ_ERR); goto done;}
+	    break;
+	case NCJ_EOF: case NCJ_UNDEF:
+	default:
+	    stat = NCJTHROW(NCJ_ERR);
+	    goto done;
+	}
+	/* Next token must be colon*/
+   	switch((token = NCJlex(parser))) {
+	case NCJ_COLON: break;
+	case NCJ_UNDEF: case NCJ_EOF:
+	default: stat = NCJTHROW(NCJ_ERR); goto done;
+	}    
+	/* Get the value */
+	if((stat = NCJparseR(parser,NCJlex(parser)))==NCJ_ERR) goto done;
+        /* Next token must be comma or RBRACE */
+	switch((token = NCJlex(parser))) {
+	case NCJ_RBRACE:
+	    break;
+	case NCJ_COMMA:
+	    token = NCJlex(parser); /* a trailing comma is tolerated */
+	    break;
+	case NCJ_EOF:
+	case NCJ_UNDEF:
+	default:
+	    stat = NCJTHROW(NCJ_ERR);
+	    goto done;
+	}	
+    }	
+    if(cb->end != NULL && cb->end(parser->state,NCJ_DICT) != NCJ_OK)
+	{stat = NCJTHROW(NCJ_ERR); goto done;}
+
+done:
+    return NCJTHROW(stat);
+}
+
+/**************************************************/
+/* Build an NCjson tree from the parse events */
+
+/* Make room for one more entry on the builder stack */
+static int
+builderreserve(NCJbuilder* builder)
+{
+    if(builder->top >= builder->alloc) {
+	size_t alloc = (builder->alloc < NCJ_DEFAULTALLOC ? NCJ_DEFAULTALLOC : 2*builder->alloc);
+	NCjson** stack = (NCjson**)realloc(builder->stack,alloc*sizeof(NCjson*));
+	if(stack == NULL) return NCJTHROW(NCJ_ERR);
+	builder->stack = stack;
+	builder->alloc = alloc;
+    }
+    return NCJ_OK;
+}
+
+/* Create a node and push it on the builder stack */
+static int
+buildnode(NCJbuilder* builder, int sort, const char* text, size_t len)
+{
+    int stat = NCJ_OK;
+    NCjson* json = NULL;
+    char* string = NULL;
+
+    if((stat = builderreserve(builder))==NCJ_ERR) goto done;
+    if(!builder->arenamode) {
+	if((stat = NCJnew(sort,&json))==NCJ_ERR) goto done;
+	if(text != NULL) {
+	    if((json->string = (char*)malloc(len+1)) == NULL)
+		{NCJreclaim(json); stat = NCJTHROW(NCJ_ERR); goto done;}
+	    memcpy(json->string,text,len);
+	    json->string[len] = '\0';
+	}
+    } else {
+	if(builder->arena == NULL) {
+	    /* The first node is the root; it carries the arena */
+	    struct NCjarenaroot* root = (struct NCjarenaroot*)calloc(1,sizeof(struct NCjarenaroot));
+	    if(root == NULL) {stat = NCJTHROW(NCJ_ERR); goto done;}
+	    root->arena.blocksize = NCJ_ARENA_MINBLOCK;
+	    builder->arena = &root->arena;
+	    json = &root->json;
+	    json->flags = NCJ_ARENA_ROOT;
+	} else {
+	    if((json = (NCjson*)arenaalloc(builder->arena,sizeof(NCjson),sizeof(void*))) == NULL)
+		{stat = NCJTHROW(NCJ_ERR); goto done;}
+	    memset(json,0,sizeof(NCjson));
+	    json->flags = NCJ_ARENA_NODE;
+	}
+	json->sort = sort;
+	/* A failure from here on is reclaimed with the root */
+	builder->stack[builder->top++] = json;
+	if(text != NULL) {
+	    if((string = (char*)arenaalloc(builder->arena,len+1,1)) == NULL)
+		{stat = NCJTHROW(NCJ_ERR); goto done;}
+	    memcpy(string,text,len);
+	    string[len] = '\0';
+	    json->string = string;
+	    json->flags |= NCJ_ARENA_STRING;
+	}
+	goto done;
+    }
+    builder->stack[builder->top++] = json;
+done:
+    return NCJTHROW(stat);
+}
+
+static int
+buildbegin(void* state, int sort)
+{
+    NCJbuilder* builder = (NCJbuilder*)state;
+    if(builder->depth >= builder->falloc) {
+	size_t falloc = (builder->falloc < NCJ_DEFAULTALLOC ? NCJ_DEFAULTALLOC : 2*builder->falloc);
+	size_t* frames = (size_t*)realloc(builder->frames,falloc*sizeof(size_t));
+	if(frames == NULL) return NCJTHROW(NCJ_ERR);
+	builder->frames = frames;
+	builder->falloc = falloc;
+    }
+    if(buildnode(builder,sort,NULL,0)==NCJ_ERR) return NCJTHROW(NCJ_ERR);
+    builder->frames[builder->depth++] = builder->top;
+    return NCJ_OK;
+}
+
+/* Move the members of the innermost container off the stack into its list */
+static int
+buildend(void* state, int sort)
+{
+    NCJbuilder* builder = (NCJbuilder*)state;
+    size_t start, n;
+    NCjson* container = NULL;
+    NCjson** contents = NULL;
+
+    assert(builder->depth > 0);
+    start = builder->frames[--builder->depth];
+    container = builder->stack[start-1];
+    assert(container->sort == sort);
+    n = builder->top - start;
+    if(n > 0) {
+	if(builder->arenamode)
+	    contents = (NCjson**)arenaalloc(builder->arena,n*sizeof(NCjson*),sizeof(void*));
+	else
+	    contents = (NCjson**)malloc(n*sizeof(NCjson*));
+	if(contents == NULL) return NCJTHROW(NCJ_ERR);
+	memcpy(contents,&builder->stack[start],n*sizeof(NCjson*));
+	container->list.contents = contents;
+	container->list.len = n;
+	container->list.alloc = (builder->arenamode ? 0 : n);
+	builder->top = start;
+	if(sort == NCJ_DICT) indexsync(&container->list);
+    }
+    return NCJ_OK;
+}
+
+static int
+buildkey(void* state, const char* key, size_t len)
+{
+    NCJbuilder* builder = (NCJbuilder*)state;
+    /* Keep the sort of unquoted keys */
+    return NCJTHROW(buildnode(builder,builder->parser->token,key,len));
+}
+
+static int
+buildvalue(void* state, int sort, const char* text, size_t len)
+{
+    NCJbuilder* builder = (NCJbuilder*)state;
+    return NCJTHROW(buildnode(builder,sort,(sort == NCJ_NULL ? NULL : text),len));
+}
+
+/* Reclaim whatever is left on the builder stack */
+static void
+builderclear(NCJbuilder* builder)
+{
+    /* Top down, so that an arena root is reclaimed last */
+    while(builder->top > 0)
+	NCJreclaim(builder->stack[--builder->top]);
+    nullfree(builder->stack);
+    nullfree(builder->frames);
+    memset(builder,0,sizeof(NCJbuilder));
+}
+
+/**************************************************/
+/* Arena allocation */
+
+/* Carve size bytes aligned to align (a power of 2) from an arena */
+static void*
+arenaalloc(struct NCjarena* arena, size_t size, size_t align)
+{
+    struct NCjblock* block = arena->blocks;
+    size_t pad = 0;
+
+    if(block != NULL) pad = (align - (block->used & (align-1))) & (align-1);
+    if(block == NULL || block->used + pad + size > block->size) {
+	if(size > arena->blocksize / 4) {
+	    /* Large requests get a block of their own behind the current one */
+	    if((block = (struct NCjblock*)malloc(sizeof(struct NCjblock)+size)) == NULL) return NULL;
+	    block->size = size;
+	    block->used = size;
+	    if(arena->blocks == NULL) {
+		block->next = NULL;
+		arena->blocks = block;
+	    } else {
+		block->next = arena->blocks->next;
+		arena->blocks->next = block;
+	    }
+	    return (void*)(block+1);
+	}
+	if((block = (struct NCjblock*)malloc(sizeof(struct NCjblock)+arena->blocksize)) == NULL) return NULL;
+	block->size = arena->blocksize;
+	block->used = 0;
+	block->next = arena->blocks;
+	arena->blocks = block;
+	pad = 0;
+	if(arena->blocksize < NCJ_ARENA_MAXBLOCK) arena->blocksize *= 2;
+    }
+    block->used += pad;
+    block->used += size;
+    return (void*)(((char*)(block+1)) + (block->used - size));
+}
+
+static void
+arenafree(struct NCjarena* arena)
+{
+    while(arena->blocks != NULL) {
+	struct NCjblock* next = arena->blocks->next;
+	free(arena->blocks);
+	arena->blocks = next;
+    }
+}
+
+static int
+NCJlex(NCJparser* parser)
+{
+    int token = NCJ_UNDEF;
+    char* start;
+    size_t count;
+
+    while(token == 0) { /* avoid need to goto when retrying */
+	char c = *parser->pos;
+	if(c == '\0') {
+	    token = NCJ_EOF;
+	} else if(c <= ' ' || c == '\177') {/* ignore whitespace */
+	    parser->pos++;
+	    continue;
+	} else if(c == NCJ_ESCAPE) {
+	    parser->pos++;
+	    c = *parser->pos;
+	    *parser->pos = (char)unescape1(c);
+	    continue;
+	} else if(NCJ_ISWORD(c)) {
+	    start = parser->pos;
+	    for(;;) {
+		c = *parser->pos++;
+		if(!NCJ_ISWORD(c)) break; /* end of word */
+	    }
+	    /* Pushback c */
+	    parser->pos--;
+	    count = (size_t)((parser->pos) - start);
+	    if(NCJyytext(parser,start,count)) goto done;
+	    /* Discriminate the word string to get the proper sort */
+	    if(testbool(parser->yytext))
+		token = NCJ_BOOLEAN;
+	    /* do int test first since double subsumes int */
+	    else if(testint(parser->yytext))
+		token = NCJ_INT;
+	    else if(testdouble(parser->yytext))
+		token = NCJ_DOUBLE;
+	    else if(testnull(parser->yytext))
+		token = NCJ_NULL;
+	    else
+		token = NCJ_STRING;
+	} else if(c == NCJ_QUOTE) {
+	    parser->pos++;
+	    start = parser->pos;
+	    for(;;) {
+		c = *parser->pos++;
+		if(c == NCJ_ESCAPE) parser->pos++;
+		else if(c == NCJ_QUOTE || c == '\0') break;
+	    }
+	    if(c == '\0') {
+		parser->status = NCJ_ERR;
+		token = NCJ_UNDEF;
+		goto done;
+	    }
+	    count = (size_t)((parser->pos) - start) - 1; /* -1 for trailing quote */
+	    if(NCJyytext(parser,start,count)==NCJ_ERR) goto done;
+	    if(NCJunescape(parser)==NCJ_ERR) goto done;
+	    token = NCJ_STRING;
+	} else { /* single char token */
+	    if(NCJyytext(parser,parser->pos,1)==NCJ_ERR) goto done;
+	    token = *parser->pos++;
+	}
+#ifdef NCJDEBUG
+fprintf(stderr,"%s(%d): |%s|\n",tokenname(token),token,parser->yytext);
+#endif /*NCJDEBUG*/
+    } /*for(;;)*/
+done:
+    if(parser->status == NCJ_ERR)
+        token = NCJ_UNDEF;
+    parser->token = token;
+#ifdef NCJTRACE
+    if(parser->flags & NCJ_TRACE) {
+	const char* txt = NULL;
+	switch(token) {
+	case NCJ_STRING: case NCJ_INT: case NCJ_DOUBLE: case NCJ_BOOLEAN: txt = parser->yytext; break;
+        default: break;
+	}
+        fprintf(stderr,">>>> token=%s:'%s'\n",tokenname(token),(txt?txt:""));
+    }
+#endif /*NCJTRACE*/
+    return token;
+}
+
+static int
+testnull(const char* word)
+{
+    if(strcasecmp(word,NCJ_TAG_NULL)==0) return 1;
+    return 0;
+}
+
+static int
+testbool(const char* word)
+{
+    if(strcasecmp(word,NCJ_TAG_TRUE)==0
+       || strcasecmp(word,NCJ_TAG_FALSE)==0)
+	return 1;
+    return 0;
+}
+
+static int
+testint(const char* word)
+{
+    char* end = NULL;
+    /* Try to convert to number */
+    (void)strtoll(word,&end,10);
+    return (end != word && *end == '\0' ? 1 : 0);
+}
+
+static int
+nancmp(const void* keyp, const void* membpp)
+{
+    int cmp;    
+    const char* key = (const char*)keyp;
+    const char** membp = (const char**)membpp;
+    cmp = strcasecmp(key,*membp);
+    return cmp;
+}
+
+static int
+testdouble(const char* word)
+{
+    char* end = NULL;
+    void* pos = NULL;
+
+    /* Check for Nan and Infinity */
+    pos = bsearch(word, NANINF, NNANINF, sizeof(char*), nancmp);
+    if(pos != NULL) return 1;
+    /* Try to convert to number */
+    (void)strtod(word,&end);
+    return (end != word && *end == '\0' ? 1 : 0);
+}
+
+static int
+NCJyytext(NCJparser* parser, char* start, size_t pdlen)
+{
+    size_t len = (size_t)pdlen;
+    if(parser->yytext == NULL) {
+	parser->yytext = (char*)malloc(len+1);
+	parser->yylen = len;
+    } else if(parser->yylen <= len) {
+	parser->yytext = (char*) realloc(parser->yytext,len+1);
+	parser->yylen = len;
+    }
+    if(parser->yytext == NULL) return NCJTHROW(NCJ_ERR);
+    memcpy(parser->yytext,start,len);
+    parser->yytext[len] = '\0';
+    parser->yytextlen = len;
+    return NCJTHROW(NCJ_OK);
+}
+
+/**************************************************/
+
+OPTSTATIC void
+NCJreclaim(NCjson* json)
+{
+    if(json == NULL) return;
+    switch(json->sort) {
+    case NCJ_INT:
+    case NCJ_DOUBLE:
+    case NCJ_BOOLEAN:
+    case NCJ_STRING: 
+	if(!(json->flags & NCJ_ARENA_STRING)) nullfree(json->string);
+	break;
+    case NCJ_DICT:
+	NCJreclaimDict(&json->list);
+	break;
+    case NCJ_ARRAY:
+	NCJreclaimArray(&json->list);
+	break;
+    default: break; /* nothing to reclaim */
+    }
+    /* The members of an arena tree have been reclaimed, so the arena can go */
+    if(json->flags & NCJ_ARENA_ROOT)
+	arenafree(&((struct NCjarenaroot*)json)->arena);
+    if(!(json->flags & NCJ_ARENA_NODE))
+	free(json);
+}
+
+static void
+NCJreclaimArray(struct NCjlist* array)
+{
+    size_t i;
+    for(i=0;i<array->len;i++) {
+	NCJreclaim(array->contents[i]);
+    }
+    if(array->alloc > 0) nullfree(array->contents); /* else arena or empty */
+    array->contents = NULL;
+    array->len = 0;
+}
+
+static void
+NCJreclaimDict(struct NCjlist* dict)
+{
+   indexfree(dict);
+   NCJreclaimArray(dict);
+}
+
+/**************************************************/
+/* Build Functions */
+
+OPTSTATIC int
+NCJnew(int sort, NCjson** objectp)
+{
+    int stat = NCJ_OK;
+    NCjson* object = NULL;
+
+    if((object = (NCjson*)calloc(1,sizeof(NCjson))) == NULL)
+	{stat = NCJTHROW(NCJ_ERR); goto done;}
+    NCJsetsort(object,sort);
+    switch (sort) {
+    case NCJ_INT:
+    case NCJ_DOUBLE:
+    case NCJ_BOOLEAN:
+    case NCJ_STRING:
+    case NCJ_NULL:
+	break;
+    case NCJ_DICT:
+    case NCJ_ARRAY:
+	break;
+    default: 
+	stat = NCJTHROW(NCJ_ERR);
+	goto done;
+    }
+    if(objectp) {*objectp = object; object = NULL;}
+
+done:
+    if(stat) NCJreclaim(object);
+    return NCJTHROW(stat);
+}
+
+OPTSTATIC int
+NCJnewstring(int sort, const char* value, NCjson** jsonp)
+{
+    return NCJTHROW(NCJnewstringn(sort,strlen(value),value,jsonp));
+}
+
+OPTSTATIC int
+NCJnewstringn(int sort, size_t len, const char* value, NCjson** jsonp)
+{
+    int stat = NCJ_OK;
+    NCjson* json = NULL;
+
+    if(jsonp) *jsonp = NULL;
+    if(value == NULL)
+        {stat = NCJTHROW(NCJ_ERR); goto done;}
+    if((stat = NCJnew(sort,&json))==NCJ_ERR) goto done;
+    if((json->string = (char*)malloc(len+1))==NULL)
+        {stat = NCJTHROW(NCJ_ERR); goto done;}
+    memcpy(json->string,value,len);
+    json->string[len] = '\0';
+    if(jsonp) *jsonp = json;
+    json = NULL; /* avoid memory errors */
+done:
+    NCJreclaim(json);
+    return NCJTHROW(stat);
+}
+
+OPTSTATIC int
+NCJdictget(const NCjson* dict, const char* key, const NCjson** jvaluep)
+{
+    int stat = NCJ_OK;
+    size_t i;
+
+    if(dict == NULL || dict->sort != NCJ_DICT)
+        {stat = NCJTHROW(NCJ_ERR); goto done;}
+    if(jvaluep) {*jvaluep = NULL;}
+    if(listlookup(&dict->list,key,&i) == NCJ_OK) {
+	if(jvaluep) {*jvaluep = dict->list.contents[i+1];}
+    }
+
+done:
+    return NCJTHROW(stat);
+}
+
+/* Functional version of NCJdictget */
+OPTSTATIC NCjson*
+NCJdictlookup(const NCjson* dict, const char* key)
+{
+    int stat;
+    const NCjson* jvalue = NULL;
+    stat = NCJdictget(dict,key,&jvalue);
+    if(stat != NCJ_OK) jvalue = NULL;
+    return jvalue;
+}
+
+/* Unescape the text in parser->yytext; can
+   do in place because unescaped string will
+   always be shorter */
+static int
+NCJunescape(NCJparser* parser)
+{
+    char* p = parser->yytext;
+    char* q = p;
+    char c;
+    for(;(c=*p++);) {
+	if(c == NCJ_ESCAPE) {
+	    c = *p++;
+	    switch (c) {
+	    case 'b': c = '\b'; break;
+	    case 'f': c = '\f'; break;
+	    case 'n': c = '\n'; break;
+	    case 'r': c = '\r'; break;
+	    case 't': c = '\t'; break;
+	    case NCJ_QUOTE: break;
+	    case NCJ_ESCAPE: break;
+	    default: break;/* technically not Json conformant */
+	    }
+	}
+	*q++ = (char)c;
+    }
+    *q = '\0';
+    parser->yytextlen = (size_t)(q - parser->yytext);
+    return NCJTHROW(NCJ_OK);    
+}
+
+/* Unescape a single character */
+static char
+unescape1(char c)
+{
+    switch (c) {
+    case 'b': c = '\b'; break;
+    case 'f': c = '\f'; break;
+    case 'n': c = '\n'; break;
+    case 'r': c = '\r'; break;
+    case 't': c = '\t'; break;
+    default: break;/* technically not Json conformant */
+    }
+    return c;
+}
+
+#if defined NCJDEBUG || defined NCJTRACE
+static char*
+tokenname(int token)
+{
+    switch (token) {
+    case NCJ_STRING: return ("NCJ_STRING");
+    case NCJ_INT: return ("NCJ_INT");
+    case NCJ_DOUBLE: return ("NCJ_DOUBLE");
+    case NCJ_BOOLEAN: return ("NCJ_BOOLEAN");
+    case NCJ_DICT: return ("NCJ_DICT");
+    case NCJ_ARRAY: return ("NCJ_ARRAY");
+    case NCJ_NULL: return ("NCJ_NULL");
+    default:
+	if(token > ' ' && token <= 127) {
+	    static char s[4];
+	    s[0] = '\'';
+	    s[1] = (char)token;
+	    s[2] = '\'';
+	    s[3] = '\0';
+	    return (s);
+	} else
+	    break;
+    }
+    return ("NCJ_UNDEF");
+}
+#endif /*defined NCJDEBUG || defined NCJTRACE*/
+
+/* Convert a JSON value to an equivalent value of a specified sort */
+OPTSTATIC int
+NCJcvt(const NCjson* jvalue, int outsort, struct NCJconst* output)
+{
+    int stat = NCJ_OK;
+
+    if(output == NULL) goto done;
+
+#undef CASE
+#define CASE(t1,t2) ((t1)<<4 | (t2)) /* the shift constant must be larger than log2(NCJ_NSORTS) */
+    switch (CASE(jvalue->sort,outsort)) {
+
+    case CASE(NCJ_BOOLEAN,NCJ_BOOLEAN):
+	if(strcasecmp(jvalue->string,NCJ_TAG_FALSE)==0) output->bval = 0; else output->bval = 1;
+	break;
+    case CASE(NCJ_BOOLEAN,NCJ_INT):
+	if(strcasecmp(jvalue->string,NCJ_TAG_FALSE)==0) output->ival = 0; else output->ival = 1;
+	break;	
+    case CASE(NCJ_BOOLEAN,NCJ_DOUBLE):
+	if(strcasecmp(jvalue->string,NCJ_TAG_FALSE)==0) output->dval = 0.0; else output->dval = 1.0;
+	break;	
+    case CASE(NCJ_BOOLEAN,NCJ_STRING):
+        output->sval = nulldup(jvalue->string);
+	break;	
+
+    case CASE(NCJ_INT,NCJ_BOOLEAN):
+	sscanf(jvalue->string,"%lld",&output->ival);
+	output->bval = (output->ival?1:0);
+	break;	
+    case CASE(NCJ_INT,NCJ_INT):
+	sscanf(jvalue->string,"%lld",&output->ival);
+	break;	
+    case CASE(NCJ_INT,NCJ_DOUBLE):
+	sscanf(jvalue->string,"%lld",&output->ival);
+	output->dval = (double)output->ival;
+	break;	
+    case CASE(NCJ_INT,NCJ_STRING):
+        output->sval = nulldup(jvalue->string);
+	break;	
+
+    case CASE(NCJ_DOUBLE,NCJ_BOOLEAN):
+	sscanf(jvalue->string,"%lf",&output->dval);
+	output->bval = (output->dval == 0?0:1);
+	break;	
+    case CASE(NCJ_DOUBLE,NCJ_INT):
+	sscanf(jvalue->string,"%lf",&output->dval);
+	output->ival = (long long)output->dval;
+	break;	
+    case CASE(NCJ_DOUBLE,NCJ_DOUBLE):
+	sscanf(jvalue->string,"%lf",&output->dval);
+	break;	
+    case CASE(NCJ_DOUBLE,NCJ_STRING):
+        output->sval = nulldup(jvalue->string);
+	break;	
+
+    case CASE(NCJ_STRING,NCJ_BOOLEAN):
+	if(strcasecmp(jvalue->string,NCJ_TAG_FALSE)==0) output->bval = 0; else output->bval = 1;
+	break;
+    case CASE(NCJ_STRING,NCJ_INT):
+	sscanf(jvalue->string,"%lld",&output->ival);
+	break;
+    case CASE(NCJ_STRING,NCJ_DOUBLE):
+	sscanf(jvalue->string,"%lf",&output->dval);
+	break;
+    case CASE(NCJ_STRING,NCJ_STRING):
+        output->sval = nulldup(jvalue->string);
+	break;	
+
+    default:
+        stat = NCJTHROW(NCJ_ERR);
+	break;
+    }
+
+done:
+    return NCJTHROW(stat);
+}
+
+static int
+listappend(struct NCjlist* list, NCjson* json)
+{
+    int stat = NCJ_OK;
+
+    assert(list->len == 0 || list->contents != NULL);
+    if(json == NULL) {stat = NCJTHROW(NCJ_ERR); goto done;}
+    /* Grow geometrically so that building a large list is linear */
+    if(list->len >= list->alloc) {
+        if((stat = listsetalloc(list,(list->len < NCJ_DEFAULTALLOC ? NCJ_DEFAULTALLOC : 2*list->len)))<0) goto done;
+    }
+    /* Append the new item */
+    list->contents[list->len++] = json;
+
+done:
+    return NCJTHROW(stat);
+}
+
+/* Locate the index of a key in a list of (key,value) pairs.
+@param list pointer to the list
+@param key  for which to search
+@param indexp store index of match here
+@return NCJ_OK if key found, NCJ_EOF if not found, NCJ_ERR if error
+*/
+static int
+listlookup(const struct NCjlist* list, const char* key, size_t* indexp)
+{
+    int stat = NCJ_OK;
+    size_t i,len;
+    long long match = -1;
+    const struct NCjindex* index = NULL;
+
+    if(list == NULL || key == NULL)
+	{stat = NCJTHROW(NCJ_ERR); goto done;}
+    len = list->len - (list->len % 2); /* ignore a trailing key without value */
+    index = list->index;
+    if(index != NULL && index->contents == list->contents && index->nkeys == len/2) {
+	size_t mask = index->nslots - 1;
+	for(i=keyhash(key) & mask;index->slots[i] != 0;i=(i+1) & mask) {
+	    const NCjson* jkey = list->contents[2*(index->slots[i]-1)];
+	    if(jkey != NULL && jkey->string != NULL && strcmp(jkey->string,key)==0)
+		{match = (long long)(2*(index->slots[i]-1)); break;}
+	}
+    } else {
+	for(i=0;i<len;i+=2) {
+	    const NCjson* jkey = list->contents[i];
+	    if(jkey != NULL && jkey->string != NULL && strcmp(jkey->string,key)==0) {match = (long long)i;break;}
+	}
+    }
+    if(match < 0) {stat = NCJ_EOF;}  else {if(indexp) *indexp = (size_t)match;}
+done:
+    return NCJTHROW(stat);
+}
+
+/* FNV-1a */
+static size_t
+keyhash(const char* key)
+{
+    unsigned long long h = 14695981039346656037ULL;
+    for(;*key;key++) {h ^= (unsigned char)*key; h *= 1099511628211ULL;}
+    return (size_t)h;
+}
+
+static void
+indexfree(struct NCjlist* dict)
+{
+    if(dict->index != NULL) {
+	nullfree(dict->index->slots);
+	free(dict->index);
+	dict->index = NULL;
+    }
+}
+
+/* Add key number k; the first of duplicate keys wins, as for a linear search */
+static void
+indexadd(struct NCjindex* index, NCjson** contents, size_t k)
+{
+    size_t i, mask = index->nslots - 1;
+    const NCjson* jkey = contents[2*k];
+    if(jkey != NULL && jkey->string != NULL) {
+	for(i=keyhash(jkey->string) & mask;index->slots[i] != 0;i=(i+1) & mask) {
+	    const NCjson* jother = contents[2*(index->slots[i]-1)];
+	    if(jother != NULL && jother->string != NULL && strcmp(jother->string,jkey->string)==0)
+		break;
+	}
+	if(index->slots[i] == 0) index->slots[i] = k+1;
+    }
+    index->nkeys = k+1;
+}
+
+/* (Re)build the slots for at least nkeys keys */
+static int
+indexrehash(struct NCjlist* dict, size_t nkeys)
+{
+    struct NCjindex* index = dict->index;
+    size_t k, nslots = 2*NCJ_INDEX_THRESHOLD;
+    size_t* slots = NULL;
+
+    while(nslots < 2*nkeys) nslots *= 2; /* load <= 1/2 */
+    if((slots = (size_t*)calloc(nslots,sizeof(size_t))) == NULL) return NCJTHROW(NCJ_ERR);
+    nullfree(index->slots);
+    index->slots = slots;
+    index->nslots = nslots;
+    k = index->nkeys;
+    index->nkeys = 0;
+    while(index->nkeys < k) indexadd(index,dict->contents,index->nkeys);
+    return NCJ_OK;
+}
+
+/* Bring the index of a dict up to date with keys appended since
+   it was last synchronized, creating it once the dict is large enough.
+   Failure just leaves the dict unindexed.
+*/
+static void
+indexsync(struct NCjlist* dict)
+{
+    size_t nkeys = dict->len / 2;
+    struct NCjindex* index = dict->index;
+
+    if(index != NULL && (index->contents != dict->contents || index->nkeys > nkeys))
+	{indexfree(dict); index = NULL;} /* changed behind our back */
+    if(nkeys < NCJ_INDEX_THRESHOLD) return;
+    if(index == NULL) {
+	if((index = (struct NCjindex*)calloc(1,sizeof(struct NCjindex))) == NULL) return;
+	index->contents = dict->contents;
+	dict->index = index;
+	if(indexrehash(dict,nkeys)) {indexfree(dict); return;}
+    }
+    if(2*nkeys > index->nslots) {
+	if(indexrehash(dict,nkeys)) {indexfree(dict); return;}
+    }
+    while(index->nkeys < nkeys) indexadd(index,dict->contents,index->nkeys);
+}
+
+/* Increase the space available to dict/array.
+   Even if alloc is zero, ensure that the object's list alloc is >= 1.
+@param list pointer to the list
+@param alloc increase allocation to this size
+@return NCJ_ERR|NCJ_OK
+*/
+static int
+listsetalloc(struct NCjlist* list, size_t alloc)
+{
+    int stat = NCJ_OK;
+    NCjson** newcontents = NULL;
+
+    if(list == NULL) {stat = NCJTHROW(NCJ_ERR); goto done;}
+    assert(list->alloc == 0 || list->contents != NULL);
+    if(alloc == 0) alloc = 1; /* Guarantee that the list->content is not NULL */
+    if(list->alloc >= alloc) goto done;
+    if(alloc < list->len) alloc = list->len; /* arena contents are copied out whole */
+    /* Since alloc > list->alloc > 0, we need to allocate space */
+    if((newcontents=(NCjson**)calloc(alloc,sizeof(NCjson*))) == NULL) {stat = NCJTHROW(NCJ_ERR); goto done;}
+    if(list->contents != NULL && list->len > 0) {
+	/* Preserve any existing contents */
+	memcpy((void*)newcontents,
+		(void*)list->contents,
+		sizeof(NCjson*)*list->len);
+    }
+    if(list->index != NULL && list->index->contents == list->contents)
+	list->index->contents = newcontents; /* moved, not changed */
+    if(list->alloc > 0) free(list->contents); /* else it belongs to an arena */
+    list->alloc = alloc;
+    list->contents = newcontents; newcontents = NULL;
+    assert(list->alloc > 0 && list->contents != NULL);
+done:
+    if(newcontents != NULL) free(newcontents);
+    return NCJTHROW(stat);
+}
+
+/**************************************************/
+
+OPTSTATIC int
+NCJclone(const NCjson* json, NCjson** clonep)
+{
+    int stat = NCJ_OK;
+    NCjson* clone = NULL;
+
+    if(clonep) *clonep = NULL;
+    if(json == NULL) goto done;
+    switch(NCJsort(json)) {
+    case NCJ_INT:
+    case NCJ_DOUBLE:
+    case NCJ_BOOLEAN:
+    case NCJ_STRING:
+	if((stat=NCJnew(NCJsort(json),&clone))==NCJ_ERR) goto done;
+	NCJsetstring(clone,strdup(NCJstring(json)));
+	if(NCJstring(clone)==NULL)
+	    {stat = NCJTHROW(NCJ_ERR); goto done;}
+	break;
+    case NCJ_NULL:
+	if((stat=NCJnew(NCJsort(json),&clone))==NCJ_ERR) goto done;
+	break;
+    case NCJ_DICT:
+	if((stat=NCJcloneDict(json,&clone))==NCJ_ERR) goto done;
+	break;
+    case NCJ_ARRAY:
+	if((stat=NCJcloneArray(json,&clone))==NCJ_ERR) goto done;
+	break;
+    default: break; /* nothing to clone */
+    }
+done:
+    if(stat == NCJ_OK && clonep) {*clonep = clone; clone = NULL;}
+    NCJreclaim(clone);    
+    return NCJTHROW(stat);
+}
+
+static int
+NCJcloneArray(const NCjson* array, NCjson** clonep)
+{
+    int stat=NCJ_OK;
+    size_t i;
+    NCjson* clone = NULL;
+    if((stat=NCJnew(NCJ_ARRAY,&clone))==NCJ_ERR) goto done;
+    if((stat=listsetalloc(&clone->list,array->list.len))<0) goto done;
+    for(i=0;i<NCJarraylength(array);i++) {
+	NCjson* elem = NCJith(array,i);
+	NCjson* elemclone = NULL;
+	if((stat=NCJclone(elem,&elemclone))==NCJ_ERR) goto done;
+	NCJappend(clone,elemclone);
+    }
+done:
+    if(stat == NCJ_OK && clonep) {*clonep = clone; clone = NULL;}
+    NCJreclaim(clone);    
+    return stat;
+}
+
+static int
+NCJcloneDict(const NCjson* dict, NCjson** clonep)
+{
+    int stat=NCJ_OK;
+    size_t i;
+    NCjson* clone = NULL;
+    if((stat=NCJnew(NCJ_DICT,&clone))==NCJ_ERR) goto done;
+    if((stat=listsetalloc(&clone->list,dict->list.len))<0) goto done;
+    for(i=0;i<NCJarraylength(dict);i++) {
+	NCjson* elem = NCJith(dict,i);
+	NCjson* elemclone = NULL;
+	if((stat=NCJclone(elem,&elemclone))==NCJ_ERR) goto done;
+	NCJappend(clone,elemclone);
+    }
+done:
+    if(stat == NCJ_OK && clonep) {*clonep = clone; clone = NULL;}
+    NCJreclaim(clone);    
+    return NCJTHROW(stat);
+}
+
+OPTSTATIC int
+NCJaddstring(NCjson* json, int sort, const char* s)
+{
+    int stat = NCJ_OK;
+    NCjson* jtmp = NULL;
+
+    if(NCJsort(json) != NCJ_DICT && NCJsort(json) != NCJ_ARRAY)
+        {stat = NCJTHROW(NCJ_ERR); goto done;}
+    if((stat = NCJnewstring(sort, s, &jtmp))==NCJ_ERR) goto done;
+    if((stat = NCJappend(json,jtmp))==NCJ_ERR) goto done;
+    jtmp = NULL;
+    
+done:
+    NCJreclaim(jtmp);
+    return NCJTHROW(stat);
+}
+
+/* Insert key-value pair into a dict object. key will be strdup'd, jvalue will be used without copying.
+   If key already exists, then it's value is overwritten
+*/
+OPTSTATIC int
+NCJinsert(NCjson* jdict, const char* key, NCjson* jvalue)
+{
+    int stat = NCJ_OK;
+    size_t i;
+    NCjson* jkey = NULL;
+    NCjson* jprev = NULL;
+
+    if(jdict == NULL
+	|| NCJsort(jdict) != NCJ_DICT
+	|| key == NULL
+	|| jvalue == NULL) {stat = NCJTHROW(NCJ_ERR); goto done;}
+    if(listlookup(&jdict->list,key,&i) == NCJ_OK) {
+	jprev = jdict->list.contents[i+1];
+	// replace existing values for new key
+	NCJreclaim(jprev); // free old value
+	jdict->list.contents[i+1] = jvalue; jvalue = NULL;
+    } else { /* not found */
+        if((stat=listsetalloc(&jdict->list,jdict->list.len+2))<0) goto done;
+	NCJcheck(NCJnewstring(NCJ_STRING, key, (NCjson**)&jkey));
+	NCJcheck(NCJappend(jdict,jkey)); jkey = NULL;
+	NCJcheck(NCJappend(jdict,jvalue)); jvalue = NULL;
+    }
+done:
+    NCJreclaim(jkey);
+    NCJreclaim(jvalue);
+    return NCJTHROW(stat);
+}
+
+/* Insert key-value pair into a dict object. key will be strdup'd */
+OPTSTATIC int
+NCJinsertstring(NCjson* object, const char* key, const char* value)
+{
+    int stat = NCJ_OK;
+    NCjson* jkey = NULL;
+    NCjson* jvalue = NULL;
+    if(key == NULL || value == NULL)
+	{stat = NCJTHROW(NCJ_ERR); goto done;}
+    if((stat = NCJnewstring(NCJ_STRING,key,&jkey))==NCJ_ERR) goto done;
+    if((stat = NCJnewstring(NCJ_STRING,value,&jvalue))==NCJ_ERR) goto done;
+    if((stat = NCJappend(object,jkey))==NCJ_ERR) goto done;
+    if((stat = NCJappend(object,jvalue))==NCJ_ERR) goto done;
+done:
+    return NCJTHROW(stat);
+}
+
+/* Insert key-value pair into a dict object. key will be strdup'd */
+OPTSTATIC int
+NCJinsertint(NCjson* object, const char* key, long long value)
+{
+    int stat = NCJ_OK;
+    NCjson* jkey = NULL;
+    NCjson* jvalue = NULL;
+    char digits[64];
+ 
+    if(key == NULL)
+	{stat = NCJTHROW(NCJ_ERR); goto done;}
+    if((stat = NCJnewstring(NCJ_STRING,key,&jkey))==NCJ_ERR) goto done;
+    snprintf(digits,sizeof(digits),"%lld",value);
+    if((stat = NCJnewstring(NCJ_INT,digits,&jvalue))==NCJ_ERR) goto done;
+    listsetalloc(&object->list,object->list.len + 2);
+    if((stat = NCJappend(object,jkey))==NCJ_ERR) goto done;
+    if((stat = NCJappend(object,jvalue))==NCJ_ERR) goto done;
+done:
+    return NCJTHROW(stat);
+}
+
+/* Append value to an array or dict object. */
+OPTSTATIC int
+NCJappend(NCjson* object, NCjson* value)
+{
+    if(object == NULL || value == NULL)
+	return NCJTHROW(NCJ_ERR);
+    switch (object->sort) {
+    case NCJ_ARRAY:
+	listappend(&object->list,value);
+	break;
+    case NCJ_DICT:
+	listappend(&object->list,value);
+	indexsync(&object->list);
+	break;
+    default:
+	return NCJTHROW(NCJ_ERR);
+    }
+    return NCJTHROW(NCJ_OK);
+}
+
+/* Append string value to an array or dict object. */
+OPTSTATIC int
+NCJappendstring(NCjson* object, int sort, const char* s)
+{
+    NCjson* js = NULL;    
+    if(object == NULL || s == NULL)
+	return NCJTHROW(NCJ_ERR);
+    NCJnewstring(sort,s,&js);
+    switch (object->sort) {
+    case NCJ_ARRAY:
+    case NCJ_DICT:
+	listappend(&object->list,js);
+	break;
+    default:
+	return NCJTHROW(NCJ_ERR);
+    }
+    return NCJTHROW(NCJ_OK);
+}
+
+/* Append int value into an array/dict object. */
+OPTSTATIC int
+NCJappendint(NCjson* object, long long value)
+{
+    int stat = NCJ_OK;
+    NCjson* jvalue = NULL;
+    char digits[64];
+ 
+    snprintf(digits,sizeof(digits),"%lld",value);
+    NCJcheck(NCJnewstring(NCJ_INT,digits,&jvalue));
+    NCJcheck(NCJappend(object,jvalue)); jvalue = NULL;
+done:
+    NCJreclaim(jvalue);
+    return NCJTHROW(stat);
+}
+
+/* Overwrite key-value pair in a dict object.
+   If key does not exist, then act like NCJinsert().
+*/
+OPTSTATIC int
+NCJoverwrite(NCjson* dict, const char* key, NCjson* jvalue)
+{
+    int stat = NCJ_OK;
+    size_t index;
+    NCjson* jkey = NULL;
+    NCjson* oldvalue = NULL;
+
+    if(dict == NULL
+	|| dict->sort != NCJ_DICT
+	|| key == NULL
+	|| jvalue == NULL) {stat = NCJTHROW(NCJ_ERR); goto done;}
+    /* See if key already exists */
+    switch(stat=listlookup(&dict->list,key,&index)) {
+    case NCJ_OK:
+	/* Overwrite value part */
+	oldvalue = dict->list.contents[index+1];
+	dict->list.contents[index+1] = jvalue;
+	NCJreclaim(oldvalue);
+	break;
+    case NCJ_EOF: /* Not found */
+	if((stat=listsetalloc(&dict->list,dict->list.len+2))<0) goto done;
+	if((stat = NCJnewstring(NCJ_STRING,key,&jkey))==NCJ_ERR) goto done;
+	if((stat = NCJappend(dict,jkey))==NCJ_ERR) goto done;
+	jkey = NULL;
+	if((stat = NCJappend(dict,jvalue))==NCJ_ERR) goto done;
+	break;
+    case NCJ_ERR:
+    default: goto done;
+    }
+done:
+    return NCJTHROW(stat);
+}
+
+/**************************************************/
+/* Unparser to convert NCjson object to text in buffer */
+
+OPTSTATIC int
+NCJunparse(const NCjson* json, unsigned flags, char** textp)
+{
+    int stat = NCJ_OK;
+    NCJbuf buf = {0,NULL};
+    if((stat = NCJunparseR(json,&buf,flags))==NCJ_ERR)
+	goto done;
+    if(textp) {*textp = buf.text; buf.text = NULL; buf.len = 0;}
+done:
+    nullfree(buf.text);
+    return NCJTHROW(stat);
+}
+
+static int
+NCJunparseR(const NCjson* json, NCJbuf* buf, unsigned flags)
+{
+    int stat = NCJ_OK;
+    size_t i;
+
+    switch (NCJsort(json)) {
+    case NCJ_STRING:
+	bytesappendquoted(buf,json->string);
+	break;
+    case NCJ_INT:
+    case NCJ_DOUBLE:
+    case NCJ_BOOLEAN:
+	bytesappend(buf,json->string);
+	break;
+    case NCJ_DICT:
+	bytesappendc(buf,NCJ_LBRACE);
+	if(json->list.len > 0 && json->list.contents != NULL) {
+	    int shortlist = 0;
+	    for(i=0;!shortlist && i < json->list.len;i+=2) {
+		if(i > 0) {bytesappendc(buf,NCJ_COMMA);bytesappendc(buf,' ');};
+		NCJunparseR(json->list.contents[i],buf,flags); /* key */
+		bytesappendc(buf,NCJ_COLON);
+		bytesappendc(buf,' ');
+		/* Allow for the possibility of a short dict entry */
+		if(json->list.contents[i+1] == NULL) { /* short */
+	   	    bytesappendc(buf,'?');		
+		    shortlist = 1;
+		} else {
+		    NCJunparseR(json->list.contents[i+1],buf,flags);
+		}
+	    }
+	}
+	bytesappendc(buf,NCJ_RBRACE);
+	break;
+    case NCJ_ARRAY:
+	bytesappendc(buf,NCJ_LBRACKET);
+	if(json->list.len > 0 && json->list.contents != NULL) {
+	    for(i=0;i < json->list.len;i++) {
+	        if(i > 0) bytesappendc(buf,NCJ_COMMA);
+	        NCJunparseR(json->list.contents[i],buf,flags);
+	    }
+	}
+	bytesappendc(buf,NCJ_RBRACKET);
+	break;
+    case NCJ_NULL:
+	bytesappend(buf,"null");
+	break;
+    default:
+	stat = NCJTHROW(NCJ_ERR); goto done;
+    }
+done:
+    return NCJTHROW(stat);
+}
+
+/* Escape a string and append to buf */
+static int
+escape(const char* text, NCJbuf* buf)
+{
+    const char* p = text;
+    char c;
+    for(;(c=*p++);) {
+        char replace = 0;
+        switch (c) {
+	case '\b': replace = 'b'; break;
+	case '\f': replace = 'f'; break;
+	case '\n': replace = 'n'; break;
+	case '\r': replace = 'r'; break;
+	case '\t': replace = 't'; break;
+	case NCJ_QUOTE: replace = '\"'; break;
+	case NCJ_ESCAPE: replace = '\\'; break;
+	default: break;
+	}
+	if(replace) {
+	    bytesappendc(buf,NCJ_ESCAPE);
+	    bytesappendc(buf,replace);
+	} else
+	    bytesappendc(buf,(char)c);
+    }
+    return NCJTHROW(NCJ_OK);    
+}
+
+static int
+bytesappendquoted(NCJbuf* buf, const char* s)
+{
+    bytesappend(buf,"\"");
+    escape(s,buf);
+    bytesappend(buf,"\"");
+    return NCJTHROW(NCJ_OK);
+}
+
+static int
+bytesappend(NCJbuf* buf, const char* s)
+{
+    int stat = NCJ_OK;
+    char* newtext = NULL;
+    if(buf == NULL)
+        {stat = NCJTHROW(NCJ_ERR); goto done;}
+    if(s == NULL) s = "";
+    if(buf->len == 0) {
+	assert(buf->text == NULL);
+	buf->text = strdup(s);
+	if(buf->text == NULL)
+	    {stat = NCJTHROW(NCJ_ERR); goto done;}
+	buf->len = strlen(s);
+    } else {
+	size_t slen = strlen(s);
+	size_t newlen = buf->len + slen + 1;
+        if((newtext = (char*)malloc(newlen))==NULL)
+            {stat = NCJTHROW(NCJ_ERR); goto done;}
+        strcpy(newtext,buf->text);
+	strcat(newtext,s);	
+	free(buf->text); buf->text = NULL;
+	buf->text = newtext; newtext = NULL;
+	buf->len = newlen;
+    }
+
+done:
+    nullfree(newtext);
+    return NCJTHROW(stat);
+}
+
+static int
+bytesappendc(NCJbuf* bufp, const char c)
+{
+    char s[2];
+    s[0] = c;
+    s[1] = '\0';
+    return bytesappend(bufp,s);
+}
+
+OPTSTATIC const char*
+NCJtotext(const NCjson* json, unsigned flags)
+{
+    static char outtext[4096];
+    char* text = NULL;
+    NC_UNUSED(flags);
+    if(json == NULL) {strcpy(outtext,"<null>"); goto done;}
+    (void)NCJunparse(json,0,&text);
+    strncpy(outtext,text,sizeof(outtext));
+    nullfree(text);
+done:
+    return outtext;
+}
+
+OPTSTATIC void
+NCJdump(const NCjson* json, unsigned flags, FILE* out)
+{
+    const char* text = NCJtotext(json,flags);
+    if(out == NULL) out = stderr;
+    fprintf(out,"%s\n",text);
+    fflush(out);
+}
+
+static int
+pairsort(const void* a, const void* b)
+{
+    const NCjson** j1 = (const NCjson**)a;
+    const NCjson** j2 = (const NCjson**)b;
+    return strcmp(NCJstring(*j1),NCJstring(*j2));
+}
+
+OPTSTATIC void
+NCJdictsort(NCjson* jdict)
+{
+    assert(NCJsort(jdict) == NCJ_DICT);
+    qsort((void*)NCJcontents(jdict),NCJdictlength(jdict),2*sizeof(NCjson*),pairsort);
+    /* The keys have moved */
+    indexfree(&jdict->list);
+    indexsync(&jdict->list);
+}
+
+/* Hack to avoid static unused warning */
+static void
+netcdf_supresswarnings(void)
+{
+    void* ignore = NULL;
+    ignore = (void*)netcdf_supresswarnings;
+    ignore = (void*)NCJparse;
+    ignore = (void*)NCJparsen;
+    ignore = (void*)NCJparsecb;
+    ignore = (void*)NCJreclaim;
+    ignore = (void*)NCJnew;
+    ignore = (void*)NCJnewstring;
+    ignore = (void*)NCJnewstringn;
+    ignore = (void*)NCJdictget;
+    ignore = (void*)NCJdictlookup;
+    ignore = (void*)NCJcvt;
+    ignore = (void*)NCJaddstring;
+    ignore = (void*)NCJappend;
+    ignore = (void*)NCJappendstring;
+    ignore = (void*)NCJappendint;
+    ignore = (void*)NCJinsert;
+    ignore = (void*)NCJinsertstring;
+    ignore = (void*)NCJinsertint;
+    ignore = (void*)NCJoverwrite;
+    ignore = (void*)NCJdictsort;
+    ignore = (void*)NCJdump;
+    (void)ignore;
+}
+#endif /*NETCDF_JSON_H*/
@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libdap2/cache.c" "libdap2/CMakeFiles/dap2.dir/cache.c.o" "gcc" "libdap2/CMakeFiles/dap2.dir/cache.c.o.d"
+  "/root/repo/libdap2/cdf.c" "libdap2/CMakeFiles/dap2.dir/cdf.c.o" "gcc" "libdap2/CMakeFiles/dap2.dir/cdf.c.o.d"
+  "/root/repo/libdap2/constraints.c" "libdap2/CMakeFiles/dap2.dir/constraints.c.o" "gcc" "libdap2/CMakeFiles/dap2.dir/constraints.c.o.d"
+  "/root/repo/libdap2/dapattr.c" "libdap2/CMakeFiles/dap2.dir/dapattr.c.o" "gcc" "libdap2/CMakeFiles/dap2.dir/dapattr.c.o.d"
+  "/root/repo/libdap2/dapcvt.c" "libdap2/CMakeFiles/dap2.dir/dapcvt.c.o" "gcc" "libdap2/CMakeFiles/dap2.dir/dapcvt.c.o.d"
+  "/root/repo/libdap2/dapdebug.c" "libdap2/CMakeFiles/dap2.dir/dapdebug.c.o" "gcc" "libdap2/CMakeFiles/dap2.dir/dapdebug.c.o.d"
+  "/root/repo/libdap2/dapdump.c" "libdap2/CMakeFiles/dap2.dir/dapdump.c.o" "gcc" "libdap2/CMakeFiles/dap2.dir/dapdump.c.o.d"
+  "/root/repo/libdap2/dapodom.c" "libdap2/CMakeFiles/dap2.dir/dapodom.c.o" "gcc" "libdap2/CMakeFiles/dap2.dir/dapodom.c.o.d"
+  "/root/repo/libdap2/daputil.c" "libdap2/CMakeFiles/dap2.dir/daputil.c.o" "gcc" "libdap2/CMakeFiles/dap2.dir/daputil.c.o.d"
+  "/root/repo/libdap2/dceconstraints.c" "libdap2/CMakeFiles/dap2.dir/dceconstraints.c.o" "gcc" "libdap2/CMakeFiles/dap2.dir/dceconstraints.c.o.d"
+  "/root/repo/libdap2/dcelex.c" "libdap2/CMakeFiles/dap2.dir/dcelex.c.o" "gcc" "libdap2/CMakeFiles/dap2.dir/dcelex.c.o.d"
+  "/root/repo/libdap2/dceparse.c" "libdap2/CMakeFiles/dap2.dir/dceparse.c.o" "gcc" "libdap2/CMakeFiles/dap2.dir/dceparse.c.o.d"
+  "/root/repo/libdap2/dcetab.c" "libdap2/CMakeFiles/dap2.dir/dcetab.c.o" "gcc" "libdap2/CMakeFiles/dap2.dir/dcetab.c.o.d"
+  "/root/repo/libdap2/getvara.c" "libdap2/CMakeFiles/dap2.dir/getvara.c.o" "gcc" "libdap2/CMakeFiles/dap2.dir/getvara.c.o.d"
+  "/root/repo/libdap2/ncd2dispatch.c" "libdap2/CMakeFiles/dap2.dir/ncd2dispatch.c.o" "gcc" "libdap2/CMakeFiles/dap2.dir/ncd2dispatch.c.o.d"
+  "/root/repo/libdap2/ncdaperr.c" "libdap2/CMakeFiles/dap2.dir/ncdaperr.c.o" "gcc" "libdap2/CMakeFiles/dap2.dir/ncdaperr.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,36 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libdap4/d4chunk.c" "libdap4/CMakeFiles/dap4.dir/d4chunk.c.o" "gcc" "libdap4/CMakeFiles/dap4.dir/d4chunk.c.o.d"
+  "/root/repo/libdap4/d4curlfunctions.c" "libdap4/CMakeFiles/dap4.dir/d4curlfunctions.c.o" "gcc" "libdap4/CMakeFiles/dap4.dir/d4curlfunctions.c.o.d"
+  "/root/repo/libdap4/d4cvt.c" "libdap4/CMakeFiles/dap4.dir/d4cvt.c.o" "gcc" "libdap4/CMakeFiles/dap4.dir/d4cvt.c.o.d"
+  "/root/repo/libdap4/d4data.c" "libdap4/CMakeFiles/dap4.dir/d4data.c.o" "gcc" "libdap4/CMakeFiles/dap4.dir/d4data.c.o.d"
+  "/root/repo/libdap4/d4debug.c" "libdap4/CMakeFiles/dap4.dir/d4debug.c.o" "gcc" "libdap4/CMakeFiles/dap4.dir/d4debug.c.o.d"
+  "/root/repo/libdap4/d4dump.c" "libdap4/CMakeFiles/dap4.dir/d4dump.c.o" "gcc" "libdap4/CMakeFiles/dap4.dir/d4dump.c.o.d"
+  "/root/repo/libdap4/d4file.c" "libdap4/CMakeFiles/dap4.dir/d4file.c.o" "gcc" "libdap4/CMakeFiles/dap4.dir/d4file.c.o.d"
+  "/root/repo/libdap4/d4fix.c" "libdap4/CMakeFiles/dap4.dir/d4fix.c.o" "gcc" "libdap4/CMakeFiles/dap4.dir/d4fix.c.o.d"
+  "/root/repo/libdap4/d4http.c" "libdap4/CMakeFiles/dap4.dir/d4http.c.o" "gcc" "libdap4/CMakeFiles/dap4.dir/d4http.c.o.d"
+  "/root/repo/libdap4/d4meta.c" "libdap4/CMakeFiles/dap4.dir/d4meta.c.o" "gcc" "libdap4/CMakeFiles/dap4.dir/d4meta.c.o.d"
+  "/root/repo/libdap4/d4odom.c" "libdap4/CMakeFiles/dap4.dir/d4odom.c.o" "gcc" "libdap4/CMakeFiles/dap4.dir/d4odom.c.o.d"
+  "/root/repo/libdap4/d4parser.c" "libdap4/CMakeFiles/dap4.dir/d4parser.c.o" "gcc" "libdap4/CMakeFiles/dap4.dir/d4parser.c.o.d"
+  "/root/repo/libdap4/d4printer.c" "libdap4/CMakeFiles/dap4.dir/d4printer.c.o" "gcc" "libdap4/CMakeFiles/dap4.dir/d4printer.c.o.d"
+  "/root/repo/libdap4/d4read.c" "libdap4/CMakeFiles/dap4.dir/d4read.c.o" "gcc" "libdap4/CMakeFiles/dap4.dir/d4read.c.o.d"
+  "/root/repo/libdap4/d4swap.c" "libdap4/CMakeFiles/dap4.dir/d4swap.c.o" "gcc" "libdap4/CMakeFiles/dap4.dir/d4swap.c.o.d"
+  "/root/repo/libdap4/d4util.c" "libdap4/CMakeFiles/dap4.dir/d4util.c.o" "gcc" "libdap4/CMakeFiles/dap4.dir/d4util.c.o.d"
+  "/root/repo/libdap4/d4varx.c" "libdap4/CMakeFiles/dap4.dir/d4varx.c.o" "gcc" "libdap4/CMakeFiles/dap4.dir/d4varx.c.o.d"
+  "/root/repo/libdap4/ncd4dispatch.c" "libdap4/CMakeFiles/dap4.dir/ncd4dispatch.c.o" "gcc" "libdap4/CMakeFiles/dap4.dir/ncd4dispatch.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
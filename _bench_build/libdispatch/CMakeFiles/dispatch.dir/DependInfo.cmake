@@ -0,0 +1,78 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libdispatch/datt.c" "libdispatch/CMakeFiles/dispatch.dir/datt.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/datt.c.o.d"
+  "/root/repo/libdispatch/dattget.c" "libdispatch/CMakeFiles/dispatch.dir/dattget.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/dattget.c.o.d"
+  "/root/repo/libdispatch/dattinq.c" "libdispatch/CMakeFiles/dispatch.dir/dattinq.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/dattinq.c.o.d"
+  "/root/repo/libdispatch/dattput.c" "libdispatch/CMakeFiles/dispatch.dir/dattput.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/dattput.c.o.d"
+  "/root/repo/libdispatch/dauth.c" "libdispatch/CMakeFiles/dispatch.dir/dauth.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/dauth.c.o.d"
+  "/root/repo/libdispatch/daux.c" "libdispatch/CMakeFiles/dispatch.dir/daux.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/daux.c.o.d"
+  "/root/repo/libdispatch/dcompound.c" "libdispatch/CMakeFiles/dispatch.dir/dcompound.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/dcompound.c.o.d"
+  "/root/repo/libdispatch/dcopy.c" "libdispatch/CMakeFiles/dispatch.dir/dcopy.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/dcopy.c.o.d"
+  "/root/repo/libdispatch/dcrc32.c" "libdispatch/CMakeFiles/dispatch.dir/dcrc32.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/dcrc32.c.o.d"
+  "/root/repo/libdispatch/dcrc64.c" "libdispatch/CMakeFiles/dispatch.dir/dcrc64.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/dcrc64.c.o.d"
+  "/root/repo/libdispatch/ddim.c" "libdispatch/CMakeFiles/dispatch.dir/ddim.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/ddim.c.o.d"
+  "/root/repo/libdispatch/ddispatch.c" "libdispatch/CMakeFiles/dispatch.dir/ddispatch.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/ddispatch.c.o.d"
+  "/root/repo/libdispatch/denum.c" "libdispatch/CMakeFiles/dispatch.dir/denum.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/denum.c.o.d"
+  "/root/repo/libdispatch/derror.c" "libdispatch/CMakeFiles/dispatch.dir/derror.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/derror.c.o.d"
+  "/root/repo/libdispatch/dfile.c" "libdispatch/CMakeFiles/dispatch.dir/dfile.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/dfile.c.o.d"
+  "/root/repo/libdispatch/dfilter.c" "libdispatch/CMakeFiles/dispatch.dir/dfilter.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/dfilter.c.o.d"
+  "/root/repo/libdispatch/dglobal.c" "libdispatch/CMakeFiles/dispatch.dir/dglobal.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/dglobal.c.o.d"
+  "/root/repo/libdispatch/dgroup.c" "libdispatch/CMakeFiles/dispatch.dir/dgroup.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/dgroup.c.o.d"
+  "/root/repo/libdispatch/dhttp.c" "libdispatch/CMakeFiles/dispatch.dir/dhttp.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/dhttp.c.o.d"
+  "/root/repo/libdispatch/dinfermodel.c" "libdispatch/CMakeFiles/dispatch.dir/dinfermodel.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/dinfermodel.c.o.d"
+  "/root/repo/libdispatch/dinstance.c" "libdispatch/CMakeFiles/dispatch.dir/dinstance.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/dinstance.c.o.d"
+  "/root/repo/libdispatch/dinstance_intern.c" "libdispatch/CMakeFiles/dispatch.dir/dinstance_intern.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/dinstance_intern.c.o.d"
+  "/root/repo/libdispatch/dinternal.c" "libdispatch/CMakeFiles/dispatch.dir/dinternal.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/dinternal.c.o.d"
+  "/root/repo/libdispatch/dmissing.c" "libdispatch/CMakeFiles/dispatch.dir/dmissing.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/dmissing.c.o.d"
+  "/root/repo/libdispatch/dnotnc3.c" "libdispatch/CMakeFiles/dispatch.dir/dnotnc3.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/dnotnc3.c.o.d"
+  "/root/repo/libdispatch/dnotnc4.c" "libdispatch/CMakeFiles/dispatch.dir/dnotnc4.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/dnotnc4.c.o.d"
+  "/root/repo/libdispatch/doffsets.c" "libdispatch/CMakeFiles/dispatch.dir/doffsets.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/doffsets.c.o.d"
+  "/root/repo/libdispatch/dopaque.c" "libdispatch/CMakeFiles/dispatch.dir/dopaque.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/dopaque.c.o.d"
+  "/root/repo/libdispatch/dparallel.c" "libdispatch/CMakeFiles/dispatch.dir/dparallel.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/dparallel.c.o.d"
+  "/root/repo/libdispatch/dpathmgr.c" "libdispatch/CMakeFiles/dispatch.dir/dpathmgr.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/dpathmgr.c.o.d"
+  "/root/repo/libdispatch/dplugins.c" "libdispatch/CMakeFiles/dispatch.dir/dplugins.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/dplugins.c.o.d"
+  "/root/repo/libdispatch/drc.c" "libdispatch/CMakeFiles/dispatch.dir/drc.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/drc.c.o.d"
+  "/root/repo/libdispatch/dreadonly.c" "libdispatch/CMakeFiles/dispatch.dir/dreadonly.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/dreadonly.c.o.d"
+  "/root/repo/libdispatch/ds3util.c" "libdispatch/CMakeFiles/dispatch.dir/ds3util.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/ds3util.c.o.d"
+  "/root/repo/libdispatch/dstring.c" "libdispatch/CMakeFiles/dispatch.dir/dstring.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/dstring.c.o.d"
+  "/root/repo/libdispatch/dtype.c" "libdispatch/CMakeFiles/dispatch.dir/dtype.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/dtype.c.o.d"
+  "/root/repo/libdispatch/dudfplugins.c" "libdispatch/CMakeFiles/dispatch.dir/dudfplugins.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/dudfplugins.c.o.d"
+  "/root/repo/libdispatch/dutf8.c" "libdispatch/CMakeFiles/dispatch.dir/dutf8.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/dutf8.c.o.d"
+  "/root/repo/libdispatch/dutil.c" "libdispatch/CMakeFiles/dispatch.dir/dutil.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/dutil.c.o.d"
+  "/root/repo/libdispatch/dv2i.c" "libdispatch/CMakeFiles/dispatch.dir/dv2i.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/dv2i.c.o.d"
+  "/root/repo/libdispatch/dvar.c" "libdispatch/CMakeFiles/dispatch.dir/dvar.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/dvar.c.o.d"
+  "/root/repo/libdispatch/dvarget.c" "libdispatch/CMakeFiles/dispatch.dir/dvarget.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/dvarget.c.o.d"
+  "/root/repo/libdispatch/dvarinq.c" "libdispatch/CMakeFiles/dispatch.dir/dvarinq.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/dvarinq.c.o.d"
+  "/root/repo/libdispatch/dvarput.c" "libdispatch/CMakeFiles/dispatch.dir/dvarput.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/dvarput.c.o.d"
+  "/root/repo/libdispatch/dvlen.c" "libdispatch/CMakeFiles/dispatch.dir/dvlen.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/dvlen.c.o.d"
+  "/root/repo/libdispatch/nc.c" "libdispatch/CMakeFiles/dispatch.dir/nc.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/nc.c.o.d"
+  "/root/repo/libdispatch/ncbytes.c" "libdispatch/CMakeFiles/dispatch.dir/ncbytes.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/ncbytes.c.o.d"
+  "/root/repo/libdispatch/ncexhash.c" "libdispatch/CMakeFiles/dispatch.dir/ncexhash.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/ncexhash.c.o.d"
+  "/root/repo/libdispatch/nchashmap.c" "libdispatch/CMakeFiles/dispatch.dir/nchashmap.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/nchashmap.c.o.d"
+  "/root/repo/libdispatch/ncindex.c" "libdispatch/CMakeFiles/dispatch.dir/ncindex.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/ncindex.c.o.d"
+  "/root/repo/libdispatch/ncjson.c" "libdispatch/CMakeFiles/dispatch.dir/ncjson.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/ncjson.c.o.d"
+  "/root/repo/libdispatch/nclist.c" "libdispatch/CMakeFiles/dispatch.dir/nclist.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/nclist.c.o.d"
+  "/root/repo/libdispatch/nclistmgr.c" "libdispatch/CMakeFiles/dispatch.dir/nclistmgr.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/nclistmgr.c.o.d"
+  "/root/repo/libdispatch/nclog.c" "libdispatch/CMakeFiles/dispatch.dir/nclog.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/nclog.c.o.d"
+  "/root/repo/libdispatch/ncproplist.c" "libdispatch/CMakeFiles/dispatch.dir/ncproplist.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/ncproplist.c.o.d"
+  "/root/repo/libdispatch/ncthreadpool.c" "libdispatch/CMakeFiles/dispatch.dir/ncthreadpool.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/ncthreadpool.c.o.d"
+  "/root/repo/libdispatch/nctime.c" "libdispatch/CMakeFiles/dispatch.dir/nctime.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/nctime.c.o.d"
+  "/root/repo/libdispatch/ncuri.c" "libdispatch/CMakeFiles/dispatch.dir/ncuri.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/ncuri.c.o.d"
+  "/root/repo/libdispatch/ncxcache.c" "libdispatch/CMakeFiles/dispatch.dir/ncxcache.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/ncxcache.c.o.d"
+  "/root/repo/libdispatch/utf8proc.c" "libdispatch/CMakeFiles/dispatch.dir/utf8proc.c.o" "gcc" "libdispatch/CMakeFiles/dispatch.dir/utf8proc.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,127 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dispatch.dir/datt.c.o"
+  "CMakeFiles/dispatch.dir/datt.c.o.d"
+  "CMakeFiles/dispatch.dir/dattget.c.o"
+  "CMakeFiles/dispatch.dir/dattget.c.o.d"
+  "CMakeFiles/dispatch.dir/dattinq.c.o"
+  "CMakeFiles/dispatch.dir/dattinq.c.o.d"
+  "CMakeFiles/dispatch.dir/dattput.c.o"
+  "CMakeFiles/dispatch.dir/dattput.c.o.d"
+  "CMakeFiles/dispatch.dir/dauth.c.o"
+  "CMakeFiles/dispatch.dir/dauth.c.o.d"
+  "CMakeFiles/dispatch.dir/daux.c.o"
+  "CMakeFiles/dispatch.dir/daux.c.o.d"
+  "CMakeFiles/dispatch.dir/dcompound.c.o"
+  "CMakeFiles/dispatch.dir/dcompound.c.o.d"
+  "CMakeFiles/dispatch.dir/dcopy.c.o"
+  "CMakeFiles/dispatch.dir/dcopy.c.o.d"
+  "CMakeFiles/dispatch.dir/dcrc32.c.o"
+  "CMakeFiles/dispatch.dir/dcrc32.c.o.d"
+  "CMakeFiles/dispatch.dir/dcrc64.c.o"
+  "CMakeFiles/dispatch.dir/dcrc64.c.o.d"
+  "CMakeFiles/dispatch.dir/ddim.c.o"
+  "CMakeFiles/dispatch.dir/ddim.c.o.d"
+  "CMakeFiles/dispatch.dir/ddispatch.c.o"
+  "CMakeFiles/dispatch.dir/ddispatch.c.o.d"
+  "CMakeFiles/dispatch.dir/denum.c.o"
+  "CMakeFiles/dispatch.dir/denum.c.o.d"
+  "CMakeFiles/dispatch.dir/derror.c.o"
+  "CMakeFiles/dispatch.dir/derror.c.o.d"
+  "CMakeFiles/dispatch.dir/dfile.c.o"
+  "CMakeFiles/dispatch.dir/dfile.c.o.d"
+  "CMakeFiles/dispatch.dir/dfilter.c.o"
+  "CMakeFiles/dispatch.dir/dfilter.c.o.d"
+  "CMakeFiles/dispatch.dir/dglobal.c.o"
+  "CMakeFiles/dispatch.dir/dglobal.c.o.d"
+  "CMakeFiles/dispatch.dir/dgroup.c.o"
+  "CMakeFiles/dispatch.dir/dgroup.c.o.d"
+  "CMakeFiles/dispatch.dir/dhttp.c.o"
+  "CMakeFiles/dispatch.dir/dhttp.c.o.d"
+  "CMakeFiles/dispatch.dir/dinfermodel.c.o"
+  "CMakeFiles/dispatch.dir/dinfermodel.c.o.d"
+  "CMakeFiles/dispatch.dir/dinstance.c.o"
+  "CMakeFiles/dispatch.dir/dinstance.c.o.d"
+  "CMakeFiles/dispatch.dir/dinstance_intern.c.o"
+  "CMakeFiles/dispatch.dir/dinstance_intern.c.o.d"
+  "CMakeFiles/dispatch.dir/dinternal.c.o"
+  "CMakeFiles/dispatch.dir/dinternal.c.o.d"
+  "CMakeFiles/dispatch.dir/dmissing.c.o"
+  "CMakeFiles/dispatch.dir/dmissing.c.o.d"
+  "CMakeFiles/dispatch.dir/dnotnc3.c.o"
+  "CMakeFiles/dispatch.dir/dnotnc3.c.o.d"
+  "CMakeFiles/dispatch.dir/dnotnc4.c.o"
+  "CMakeFiles/dispatch.dir/dnotnc4.c.o.d"
+  "CMakeFiles/dispatch.dir/doffsets.c.o"
+  "CMakeFiles/dispatch.dir/doffsets.c.o.d"
+  "CMakeFiles/dispatch.dir/dopaque.c.o"
+  "CMakeFiles/dispatch.dir/dopaque.c.o.d"
+  "CMakeFiles/dispatch.dir/dparallel.c.o"
+  "CMakeFiles/dispatch.dir/dparallel.c.o.d"
+  "CMakeFiles/dispatch.dir/dpathmgr.c.o"
+  "CMakeFiles/dispatch.dir/dpathmgr.c.o.d"
+  "CMakeFiles/dispatch.dir/dplugins.c.o"
+  "CMakeFiles/dispatch.dir/dplugins.c.o.d"
+  "CMakeFiles/dispatch.dir/drc.c.o"
+  "CMakeFiles/dispatch.dir/drc.c.o.d"
+  "CMakeFiles/dispatch.dir/dreadonly.c.o"
+  "CMakeFiles/dispatch.dir/dreadonly.c.o.d"
+  "CMakeFiles/dispatch.dir/ds3util.c.o"
+  "CMakeFiles/dispatch.dir/ds3util.c.o.d"
+  "CMakeFiles/dispatch.dir/dstring.c.o"
+  "CMakeFiles/dispatch.dir/dstring.c.o.d"
+  "CMakeFiles/dispatch.dir/dtype.c.o"
+  "CMakeFiles/dispatch.dir/dtype.c.o.d"
+  "CMakeFiles/dispatch.dir/dudfplugins.c.o"
+  "CMakeFiles/dispatch.dir/dudfplugins.c.o.d"
+  "CMakeFiles/dispatch.dir/dutf8.c.o"
+  "CMakeFiles/dispatch.dir/dutf8.c.o.d"
+  "CMakeFiles/dispatch.dir/dutil.c.o"
+  "CMakeFiles/dispatch.dir/dutil.c.o.d"
+  "CMakeFiles/dispatch.dir/dv2i.c.o"
+  "CMakeFiles/dispatch.dir/dv2i.c.o.d"
+  "CMakeFiles/dispatch.dir/dvar.c.o"
+  "CMakeFiles/dispatch.dir/dvar.c.o.d"
+  "CMakeFiles/dispatch.dir/dvarget.c.o"
+  "CMakeFiles/dispatch.dir/dvarget.c.o.d"
+  "CMakeFiles/dispatch.dir/dvarinq.c.o"
+  "CMakeFiles/dispatch.dir/dvarinq.c.o.d"
+  "CMakeFiles/dispatch.dir/dvarput.c.o"
+  "CMakeFiles/dispatch.dir/dvarput.c.o.d"
+  "CMakeFiles/dispatch.dir/dvlen.c.o"
+  "CMakeFiles/dispatch.dir/dvlen.c.o.d"
+  "CMakeFiles/dispatch.dir/nc.c.o"
+  "CMakeFiles/dispatch.dir/nc.c.o.d"
+  "CMakeFiles/dispatch.dir/ncbytes.c.o"
+  "CMakeFiles/dispatch.dir/ncbytes.c.o.d"
+  "CMakeFiles/dispatch.dir/ncexhash.c.o"
+  "CMakeFiles/dispatch.dir/ncexhash.c.o.d"
+  "CMakeFiles/dispatch.dir/nchashmap.c.o"
+  "CMakeFiles/dispatch.dir/nchashmap.c.o.d"
+  "CMakeFiles/dispatch.dir/ncindex.c.o"
+  "CMakeFiles/dispatch.dir/ncindex.c.o.d"
+  "CMakeFiles/dispatch.dir/ncjson.c.o"
+  "CMakeFiles/dispatch.dir/ncjson.c.o.d"
+  "CMakeFiles/dispatch.dir/nclist.c.o"
+  "CMakeFiles/dispatch.dir/nclist.c.o.d"
+  "CMakeFiles/dispatch.dir/nclistmgr.c.o"
+  "CMakeFiles/dispatch.dir/nclistmgr.c.o.d"
+  "CMakeFiles/dispatch.dir/nclog.c.o"
+  "CMakeFiles/dispatch.dir/nclog.c.o.d"
+  "CMakeFiles/dispatch.dir/ncproplist.c.o"
+  "CMakeFiles/dispatch.dir/ncproplist.c.o.d"
+  "CMakeFiles/dispatch.dir/ncthreadpool.c.o"
+  "CMakeFiles/dispatch.dir/ncthreadpool.c.o.d"
+  "CMakeFiles/dispatch.dir/nctime.c.o"
+  "CMakeFiles/dispatch.dir/nctime.c.o.d"
+  "CMakeFiles/dispatch.dir/ncuri.c.o"
+  "CMakeFiles/dispatch.dir/ncuri.c.o.d"
+  "CMakeFiles/dispatch.dir/ncxcache.c.o"
+  "CMakeFiles/dispatch.dir/ncxcache.c.o.d"
+  "CMakeFiles/dispatch.dir/utf8proc.c.o"
+  "CMakeFiles/dispatch.dir/utf8proc.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dispatch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ncrandom.dir/ncrandom.c.o"
+  "CMakeFiles/ncrandom.dir/ncrandom.c.o.d"
+  "ncrandom"
+  "ncrandom.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ncrandom.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,45 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/netcdfhdf5.dir/H5FDhttp.c.o"
+  "CMakeFiles/netcdfhdf5.dir/H5FDhttp.c.o.d"
+  "CMakeFiles/netcdfhdf5.dir/hdf5attr.c.o"
+  "CMakeFiles/netcdfhdf5.dir/hdf5attr.c.o.d"
+  "CMakeFiles/netcdfhdf5.dir/hdf5create.c.o"
+  "CMakeFiles/netcdfhdf5.dir/hdf5create.c.o.d"
+  "CMakeFiles/netcdfhdf5.dir/hdf5debug.c.o"
+  "CMakeFiles/netcdfhdf5.dir/hdf5debug.c.o.d"
+  "CMakeFiles/netcdfhdf5.dir/hdf5dim.c.o"
+  "CMakeFiles/netcdfhdf5.dir/hdf5dim.c.o.d"
+  "CMakeFiles/netcdfhdf5.dir/hdf5dispatch.c.o"
+  "CMakeFiles/netcdfhdf5.dir/hdf5dispatch.c.o.d"
+  "CMakeFiles/netcdfhdf5.dir/hdf5file.c.o"
+  "CMakeFiles/netcdfhdf5.dir/hdf5file.c.o.d"
+  "CMakeFiles/netcdfhdf5.dir/hdf5filter.c.o"
+  "CMakeFiles/netcdfhdf5.dir/hdf5filter.c.o.d"
+  "CMakeFiles/netcdfhdf5.dir/hdf5grp.c.o"
+  "CMakeFiles/netcdfhdf5.dir/hdf5grp.c.o.d"
+  "CMakeFiles/netcdfhdf5.dir/hdf5internal.c.o"
+  "CMakeFiles/netcdfhdf5.dir/hdf5internal.c.o.d"
+  "CMakeFiles/netcdfhdf5.dir/hdf5open.c.o"
+  "CMakeFiles/netcdfhdf5.dir/hdf5open.c.o.d"
+  "CMakeFiles/netcdfhdf5.dir/hdf5plugins.c.o"
+  "CMakeFiles/netcdfhdf5.dir/hdf5plugins.c.o.d"
+  "CMakeFiles/netcdfhdf5.dir/hdf5set_format_compatibility.c.o"
+  "CMakeFiles/netcdfhdf5.dir/hdf5set_format_compatibility.c.o.d"
+  "CMakeFiles/netcdfhdf5.dir/hdf5type.c.o"
+  "CMakeFiles/netcdfhdf5.dir/hdf5type.c.o.d"
+  "CMakeFiles/netcdfhdf5.dir/hdf5var.c.o"
+  "CMakeFiles/netcdfhdf5.dir/hdf5var.c.o.d"
+  "CMakeFiles/netcdfhdf5.dir/nc4hdf.c.o"
+  "CMakeFiles/netcdfhdf5.dir/nc4hdf.c.o.d"
+  "CMakeFiles/netcdfhdf5.dir/nc4info.c.o"
+  "CMakeFiles/netcdfhdf5.dir/nc4info.c.o.d"
+  "CMakeFiles/netcdfhdf5.dir/nc4mem.c.o"
+  "CMakeFiles/netcdfhdf5.dir/nc4mem.c.o.d"
+  "CMakeFiles/netcdfhdf5.dir/nc4memcb.c.o"
+  "CMakeFiles/netcdfhdf5.dir/nc4memcb.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/netcdfhdf5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ncpoco.dir/cp_unix.c.o"
+  "CMakeFiles/ncpoco.dir/cp_unix.c.o.d"
+  "CMakeFiles/ncpoco.dir/ncpoco.c.o"
+  "CMakeFiles/ncpoco.dir/ncpoco.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ncpoco.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
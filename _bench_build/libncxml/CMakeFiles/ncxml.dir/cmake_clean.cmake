@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ncxml.dir/ncxml_xml2.c.o"
+  "CMakeFiles/ncxml.dir/ncxml_xml2.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ncxml.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,48 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libnczarr/zarr.c" "libnczarr/CMakeFiles/nczarr.dir/zarr.c.o" "gcc" "libnczarr/CMakeFiles/nczarr.dir/zarr.c.o.d"
+  "/root/repo/libnczarr/zattr.c" "libnczarr/CMakeFiles/nczarr.dir/zattr.c.o" "gcc" "libnczarr/CMakeFiles/nczarr.dir/zattr.c.o.d"
+  "/root/repo/libnczarr/zchunking.c" "libnczarr/CMakeFiles/nczarr.dir/zchunking.c.o" "gcc" "libnczarr/CMakeFiles/nczarr.dir/zchunking.c.o.d"
+  "/root/repo/libnczarr/zclose.c" "libnczarr/CMakeFiles/nczarr.dir/zclose.c.o" "gcc" "libnczarr/CMakeFiles/nczarr.dir/zclose.c.o.d"
+  "/root/repo/libnczarr/zcreate.c" "libnczarr/CMakeFiles/nczarr.dir/zcreate.c.o" "gcc" "libnczarr/CMakeFiles/nczarr.dir/zcreate.c.o.d"
+  "/root/repo/libnczarr/zcvt.c" "libnczarr/CMakeFiles/nczarr.dir/zcvt.c.o" "gcc" "libnczarr/CMakeFiles/nczarr.dir/zcvt.c.o.d"
+  "/root/repo/libnczarr/zdebug.c" "libnczarr/CMakeFiles/nczarr.dir/zdebug.c.o" "gcc" "libnczarr/CMakeFiles/nczarr.dir/zdebug.c.o.d"
+  "/root/repo/libnczarr/zdim.c" "libnczarr/CMakeFiles/nczarr.dir/zdim.c.o" "gcc" "libnczarr/CMakeFiles/nczarr.dir/zdim.c.o.d"
+  "/root/repo/libnczarr/zdispatch.c" "libnczarr/CMakeFiles/nczarr.dir/zdispatch.c.o" "gcc" "libnczarr/CMakeFiles/nczarr.dir/zdispatch.c.o.d"
+  "/root/repo/libnczarr/zfile.c" "libnczarr/CMakeFiles/nczarr.dir/zfile.c.o" "gcc" "libnczarr/CMakeFiles/nczarr.dir/zfile.c.o.d"
+  "/root/repo/libnczarr/zfilter.c" "libnczarr/CMakeFiles/nczarr.dir/zfilter.c.o" "gcc" "libnczarr/CMakeFiles/nczarr.dir/zfilter.c.o.d"
+  "/root/repo/libnczarr/zgrp.c" "libnczarr/CMakeFiles/nczarr.dir/zgrp.c.o" "gcc" "libnczarr/CMakeFiles/nczarr.dir/zgrp.c.o.d"
+  "/root/repo/libnczarr/zinfer.c" "libnczarr/CMakeFiles/nczarr.dir/zinfer.c.o" "gcc" "libnczarr/CMakeFiles/nczarr.dir/zinfer.c.o.d"
+  "/root/repo/libnczarr/zinternal.c" "libnczarr/CMakeFiles/nczarr.dir/zinternal.c.o" "gcc" "libnczarr/CMakeFiles/nczarr.dir/zinternal.c.o.d"
+  "/root/repo/libnczarr/zmap.c" "libnczarr/CMakeFiles/nczarr.dir/zmap.c.o" "gcc" "libnczarr/CMakeFiles/nczarr.dir/zmap.c.o.d"
+  "/root/repo/libnczarr/zmap_file.c" "libnczarr/CMakeFiles/nczarr.dir/zmap_file.c.o" "gcc" "libnczarr/CMakeFiles/nczarr.dir/zmap_file.c.o.d"
+  "/root/repo/libnczarr/zmap_mem.c" "libnczarr/CMakeFiles/nczarr.dir/zmap_mem.c.o" "gcc" "libnczarr/CMakeFiles/nczarr.dir/zmap_mem.c.o.d"
+  "/root/repo/libnczarr/zmetadata.c" "libnczarr/CMakeFiles/nczarr.dir/zmetadata.c.o" "gcc" "libnczarr/CMakeFiles/nczarr.dir/zmetadata.c.o.d"
+  "/root/repo/libnczarr/zmetadata2.c" "libnczarr/CMakeFiles/nczarr.dir/zmetadata2.c.o" "gcc" "libnczarr/CMakeFiles/nczarr.dir/zmetadata2.c.o.d"
+  "/root/repo/libnczarr/zmetadata3.c" "libnczarr/CMakeFiles/nczarr.dir/zmetadata3.c.o" "gcc" "libnczarr/CMakeFiles/nczarr.dir/zmetadata3.c.o.d"
+  "/root/repo/libnczarr/zodom.c" "libnczarr/CMakeFiles/nczarr.dir/zodom.c.o" "gcc" "libnczarr/CMakeFiles/nczarr.dir/zodom.c.o.d"
+  "/root/repo/libnczarr/zopen.c" "libnczarr/CMakeFiles/nczarr.dir/zopen.c.o" "gcc" "libnczarr/CMakeFiles/nczarr.dir/zopen.c.o.d"
+  "/root/repo/libnczarr/zplugins.c" "libnczarr/CMakeFiles/nczarr.dir/zplugins.c.o" "gcc" "libnczarr/CMakeFiles/nczarr.dir/zplugins.c.o.d"
+  "/root/repo/libnczarr/zprov.c" "libnczarr/CMakeFiles/nczarr.dir/zprov.c.o" "gcc" "libnczarr/CMakeFiles/nczarr.dir/zprov.c.o.d"
+  "/root/repo/libnczarr/zsync.c" "libnczarr/CMakeFiles/nczarr.dir/zsync.c.o" "gcc" "libnczarr/CMakeFiles/nczarr.dir/zsync.c.o.d"
+  "/root/repo/libnczarr/ztype.c" "libnczarr/CMakeFiles/nczarr.dir/ztype.c.o" "gcc" "libnczarr/CMakeFiles/nczarr.dir/ztype.c.o.d"
+  "/root/repo/libnczarr/zutil.c" "libnczarr/CMakeFiles/nczarr.dir/zutil.c.o" "gcc" "libnczarr/CMakeFiles/nczarr.dir/zutil.c.o.d"
+  "/root/repo/libnczarr/zvar.c" "libnczarr/CMakeFiles/nczarr.dir/zvar.c.o" "gcc" "libnczarr/CMakeFiles/nczarr.dir/zvar.c.o.d"
+  "/root/repo/libnczarr/zwalk.c" "libnczarr/CMakeFiles/nczarr.dir/zwalk.c.o" "gcc" "libnczarr/CMakeFiles/nczarr.dir/zwalk.c.o.d"
+  "/root/repo/libnczarr/zxcache.c" "libnczarr/CMakeFiles/nczarr.dir/zxcache.c.o" "gcc" "libnczarr/CMakeFiles/nczarr.dir/zxcache.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,67 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nczarr.dir/zarr.c.o"
+  "CMakeFiles/nczarr.dir/zarr.c.o.d"
+  "CMakeFiles/nczarr.dir/zattr.c.o"
+  "CMakeFiles/nczarr.dir/zattr.c.o.d"
+  "CMakeFiles/nczarr.dir/zchunking.c.o"
+  "CMakeFiles/nczarr.dir/zchunking.c.o.d"
+  "CMakeFiles/nczarr.dir/zclose.c.o"
+  "CMakeFiles/nczarr.dir/zclose.c.o.d"
+  "CMakeFiles/nczarr.dir/zcreate.c.o"
+  "CMakeFiles/nczarr.dir/zcreate.c.o.d"
+  "CMakeFiles/nczarr.dir/zcvt.c.o"
+  "CMakeFiles/nczarr.dir/zcvt.c.o.d"
+  "CMakeFiles/nczarr.dir/zdebug.c.o"
+  "CMakeFiles/nczarr.dir/zdebug.c.o.d"
+  "CMakeFiles/nczarr.dir/zdim.c.o"
+  "CMakeFiles/nczarr.dir/zdim.c.o.d"
+  "CMakeFiles/nczarr.dir/zdispatch.c.o"
+  "CMakeFiles/nczarr.dir/zdispatch.c.o.d"
+  "CMakeFiles/nczarr.dir/zfile.c.o"
+  "CMakeFiles/nczarr.dir/zfile.c.o.d"
+  "CMakeFiles/nczarr.dir/zfilter.c.o"
+  "CMakeFiles/nczarr.dir/zfilter.c.o.d"
+  "CMakeFiles/nczarr.dir/zgrp.c.o"
+  "CMakeFiles/nczarr.dir/zgrp.c.o.d"
+  "CMakeFiles/nczarr.dir/zinfer.c.o"
+  "CMakeFiles/nczarr.dir/zinfer.c.o.d"
+  "CMakeFiles/nczarr.dir/zinternal.c.o"
+  "CMakeFiles/nczarr.dir/zinternal.c.o.d"
+  "CMakeFiles/nczarr.dir/zmap.c.o"
+  "CMakeFiles/nczarr.dir/zmap.c.o.d"
+  "CMakeFiles/nczarr.dir/zmap_file.c.o"
+  "CMakeFiles/nczarr.dir/zmap_file.c.o.d"
+  "CMakeFiles/nczarr.dir/zmap_mem.c.o"
+  "CMakeFiles/nczarr.dir/zmap_mem.c.o.d"
+  "CMakeFiles/nczarr.dir/zmetadata.c.o"
+  "CMakeFiles/nczarr.dir/zmetadata.c.o.d"
+  "CMakeFiles/nczarr.dir/zmetadata2.c.o"
+  "CMakeFiles/nczarr.dir/zmetadata2.c.o.d"
+  "CMakeFiles/nczarr.dir/zmetadata3.c.o"
+  "CMakeFiles/nczarr.dir/zmetadata3.c.o.d"
+  "CMakeFiles/nczarr.dir/zodom.c.o"
+  "CMakeFiles/nczarr.dir/zodom.c.o.d"
+  "CMakeFiles/nczarr.dir/zopen.c.o"
+  "CMakeFiles/nczarr.dir/zopen.c.o.d"
+  "CMakeFiles/nczarr.dir/zplugins.c.o"
+  "CMakeFiles/nczarr.dir/zplugins.c.o.d"
+  "CMakeFiles/nczarr.dir/zprov.c.o"
+  "CMakeFiles/nczarr.dir/zprov.c.o.d"
+  "CMakeFiles/nczarr.dir/zsync.c.o"
+  "CMakeFiles/nczarr.dir/zsync.c.o.d"
+  "CMakeFiles/nczarr.dir/ztype.c.o"
+  "CMakeFiles/nczarr.dir/ztype.c.o.d"
+  "CMakeFiles/nczarr.dir/zutil.c.o"
+  "CMakeFiles/nczarr.dir/zutil.c.o.d"
+  "CMakeFiles/nczarr.dir/zvar.c.o"
+  "CMakeFiles/nczarr.dir/zvar.c.o.d"
+  "CMakeFiles/nczarr.dir/zwalk.c.o"
+  "CMakeFiles/nczarr.dir/zwalk.c.o.d"
+  "CMakeFiles/nczarr.dir/zxcache.c.o"
+  "CMakeFiles/nczarr.dir/zxcache.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nczarr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
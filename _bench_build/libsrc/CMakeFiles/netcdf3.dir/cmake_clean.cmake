@@ -0,0 +1,38 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/netcdf3.dir/attr.c.o"
+  "CMakeFiles/netcdf3.dir/attr.c.o.d"
+  "CMakeFiles/netcdf3.dir/dim.c.o"
+  "CMakeFiles/netcdf3.dir/dim.c.o.d"
+  "CMakeFiles/netcdf3.dir/httpio.c.o"
+  "CMakeFiles/netcdf3.dir/httpio.c.o.d"
+  "CMakeFiles/netcdf3.dir/lookup3.c.o"
+  "CMakeFiles/netcdf3.dir/lookup3.c.o.d"
+  "CMakeFiles/netcdf3.dir/memio.c.o"
+  "CMakeFiles/netcdf3.dir/memio.c.o.d"
+  "CMakeFiles/netcdf3.dir/mmapio.c.o"
+  "CMakeFiles/netcdf3.dir/mmapio.c.o.d"
+  "CMakeFiles/netcdf3.dir/nc3dispatch.c.o"
+  "CMakeFiles/netcdf3.dir/nc3dispatch.c.o.d"
+  "CMakeFiles/netcdf3.dir/nc3internal.c.o"
+  "CMakeFiles/netcdf3.dir/nc3internal.c.o.d"
+  "CMakeFiles/netcdf3.dir/ncio.c.o"
+  "CMakeFiles/netcdf3.dir/ncio.c.o.d"
+  "CMakeFiles/netcdf3.dir/ncx.c.o"
+  "CMakeFiles/netcdf3.dir/ncx.c.o.d"
+  "CMakeFiles/netcdf3.dir/posixio.c.o"
+  "CMakeFiles/netcdf3.dir/posixio.c.o.d"
+  "CMakeFiles/netcdf3.dir/putget.c.o"
+  "CMakeFiles/netcdf3.dir/putget.c.o.d"
+  "CMakeFiles/netcdf3.dir/v1hpg.c.o"
+  "CMakeFiles/netcdf3.dir/v1hpg.c.o.d"
+  "CMakeFiles/netcdf3.dir/var.c.o"
+  "CMakeFiles/netcdf3.dir/var.c.o.d"
+  "attr.c"
+  "ncx.c"
+  "putget.c"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/netcdf3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
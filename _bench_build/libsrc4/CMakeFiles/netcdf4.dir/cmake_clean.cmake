@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/netcdf4.dir/nc4attr.c.o"
+  "CMakeFiles/netcdf4.dir/nc4attr.c.o.d"
+  "CMakeFiles/netcdf4.dir/nc4cache.c.o"
+  "CMakeFiles/netcdf4.dir/nc4cache.c.o.d"
+  "CMakeFiles/netcdf4.dir/nc4dim.c.o"
+  "CMakeFiles/netcdf4.dir/nc4dim.c.o.d"
+  "CMakeFiles/netcdf4.dir/nc4dispatch.c.o"
+  "CMakeFiles/netcdf4.dir/nc4dispatch.c.o.d"
+  "CMakeFiles/netcdf4.dir/nc4grp.c.o"
+  "CMakeFiles/netcdf4.dir/nc4grp.c.o.d"
+  "CMakeFiles/netcdf4.dir/nc4internal.c.o"
+  "CMakeFiles/netcdf4.dir/nc4internal.c.o.d"
+  "CMakeFiles/netcdf4.dir/nc4type.c.o"
+  "CMakeFiles/netcdf4.dir/nc4type.c.o.d"
+  "CMakeFiles/netcdf4.dir/nc4var.c.o"
+  "CMakeFiles/netcdf4.dir/nc4var.c.o.d"
+  "CMakeFiles/netcdf4.dir/ncfunc.c.o"
+  "CMakeFiles/netcdf4.dir/ncfunc.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/netcdf4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bigmeta.dir/bigmeta.c.o"
+  "CMakeFiles/bigmeta.dir/bigmeta.c.o.d"
+  "CMakeFiles/bigmeta.dir/tst_utils.c.o"
+  "CMakeFiles/bigmeta.dir/tst_utils.c.o.d"
+  "bigmeta"
+  "bigmeta.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/bigmeta.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
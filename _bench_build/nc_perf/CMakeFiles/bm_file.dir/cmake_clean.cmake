@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bm_file.dir/bm_file.c.o"
+  "CMakeFiles/bm_file.dir/bm_file.c.o.d"
+  "CMakeFiles/bm_file.dir/tst_utils.c.o"
+  "CMakeFiles/bm_file.dir/tst_utils.c.o.d"
+  "bm_file"
+  "bm_file.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/bm_file.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
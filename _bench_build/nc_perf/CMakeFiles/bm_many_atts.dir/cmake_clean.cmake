@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bm_many_atts.dir/bm_many_atts.c.o"
+  "CMakeFiles/bm_many_atts.dir/bm_many_atts.c.o.d"
+  "CMakeFiles/bm_many_atts.dir/tst_utils.c.o"
+  "CMakeFiles/bm_many_atts.dir/tst_utils.c.o.d"
+  "bm_many_atts"
+  "bm_many_atts.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/bm_many_atts.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
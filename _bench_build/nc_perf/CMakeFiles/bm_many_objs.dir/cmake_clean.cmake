@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bm_many_objs.dir/bm_many_objs.c.o"
+  "CMakeFiles/bm_many_objs.dir/bm_many_objs.c.o.d"
+  "CMakeFiles/bm_many_objs.dir/tst_utils.c.o"
+  "CMakeFiles/bm_many_objs.dir/tst_utils.c.o.d"
+  "bm_many_objs"
+  "bm_many_objs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/bm_many_objs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/nc_perf/bm_netcdf4_recs.c" "nc_perf/CMakeFiles/bm_netcdf4_recs.dir/bm_netcdf4_recs.c.o" "gcc" "nc_perf/CMakeFiles/bm_netcdf4_recs.dir/bm_netcdf4_recs.c.o.d"
+  "/root/repo/nc_perf/tst_utils.c" "nc_perf/CMakeFiles/bm_netcdf4_recs.dir/tst_utils.c.o" "gcc" "nc_perf/CMakeFiles/bm_netcdf4_recs.dir/tst_utils.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/CMakeFiles/netcdf.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
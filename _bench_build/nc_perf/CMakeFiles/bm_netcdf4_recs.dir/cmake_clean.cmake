@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bm_netcdf4_recs.dir/bm_netcdf4_recs.c.o"
+  "CMakeFiles/bm_netcdf4_recs.dir/bm_netcdf4_recs.c.o.d"
+  "CMakeFiles/bm_netcdf4_recs.dir/tst_utils.c.o"
+  "CMakeFiles/bm_netcdf4_recs.dir/tst_utils.c.o.d"
+  "bm_netcdf4_recs"
+  "bm_netcdf4_recs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/bm_netcdf4_recs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
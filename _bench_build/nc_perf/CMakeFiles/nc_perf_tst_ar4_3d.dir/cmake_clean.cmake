@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_perf_tst_ar4_3d.dir/tst_ar4_3d.c.o"
+  "CMakeFiles/nc_perf_tst_ar4_3d.dir/tst_ar4_3d.c.o.d"
+  "CMakeFiles/nc_perf_tst_ar4_3d.dir/tst_utils.c.o"
+  "CMakeFiles/nc_perf_tst_ar4_3d.dir/tst_utils.c.o.d"
+  "nc_perf_tst_ar4_3d"
+  "nc_perf_tst_ar4_3d.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_perf_tst_ar4_3d.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
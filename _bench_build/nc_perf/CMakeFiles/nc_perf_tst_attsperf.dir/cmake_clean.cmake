@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_perf_tst_attsperf.dir/tst_attsperf.c.o"
+  "CMakeFiles/nc_perf_tst_attsperf.dir/tst_attsperf.c.o.d"
+  "CMakeFiles/nc_perf_tst_attsperf.dir/tst_utils.c.o"
+  "CMakeFiles/nc_perf_tst_attsperf.dir/tst_utils.c.o.d"
+  "nc_perf_tst_attsperf"
+  "nc_perf_tst_attsperf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_perf_tst_attsperf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_perf_tst_bm_rando.dir/tst_bm_rando.c.o"
+  "CMakeFiles/nc_perf_tst_bm_rando.dir/tst_bm_rando.c.o.d"
+  "CMakeFiles/nc_perf_tst_bm_rando.dir/tst_utils.c.o"
+  "CMakeFiles/nc_perf_tst_bm_rando.dir/tst_utils.c.o.d"
+  "nc_perf_tst_bm_rando"
+  "nc_perf_tst_bm_rando.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_perf_tst_bm_rando.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
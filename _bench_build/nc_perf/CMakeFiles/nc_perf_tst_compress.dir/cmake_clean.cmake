@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_perf_tst_compress.dir/tst_compress.c.o"
+  "CMakeFiles/nc_perf_tst_compress.dir/tst_compress.c.o.d"
+  "CMakeFiles/nc_perf_tst_compress.dir/tst_utils.c.o"
+  "CMakeFiles/nc_perf_tst_compress.dir/tst_utils.c.o.d"
+  "nc_perf_tst_compress"
+  "nc_perf_tst_compress.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_perf_tst_compress.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
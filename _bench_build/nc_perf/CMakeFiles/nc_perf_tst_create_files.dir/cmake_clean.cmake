@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_perf_tst_create_files.dir/tst_create_files.c.o"
+  "CMakeFiles/nc_perf_tst_create_files.dir/tst_create_files.c.o.d"
+  "CMakeFiles/nc_perf_tst_create_files.dir/tst_utils.c.o"
+  "CMakeFiles/nc_perf_tst_create_files.dir/tst_utils.c.o.d"
+  "nc_perf_tst_create_files"
+  "nc_perf_tst_create_files.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_perf_tst_create_files.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
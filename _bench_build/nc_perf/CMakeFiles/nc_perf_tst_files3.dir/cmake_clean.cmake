@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_perf_tst_files3.dir/tst_files3.c.o"
+  "CMakeFiles/nc_perf_tst_files3.dir/tst_files3.c.o.d"
+  "CMakeFiles/nc_perf_tst_files3.dir/tst_utils.c.o"
+  "CMakeFiles/nc_perf_tst_files3.dir/tst_utils.c.o.d"
+  "nc_perf_tst_files3"
+  "nc_perf_tst_files3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_perf_tst_files3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_perf_tst_mem.dir/tst_mem.c.o"
+  "CMakeFiles/nc_perf_tst_mem.dir/tst_mem.c.o.d"
+  "CMakeFiles/nc_perf_tst_mem.dir/tst_utils.c.o"
+  "CMakeFiles/nc_perf_tst_mem.dir/tst_utils.c.o.d"
+  "nc_perf_tst_mem"
+  "nc_perf_tst_mem.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_perf_tst_mem.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
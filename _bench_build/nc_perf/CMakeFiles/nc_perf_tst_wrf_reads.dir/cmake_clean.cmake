@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_perf_tst_wrf_reads.dir/tst_utils.c.o"
+  "CMakeFiles/nc_perf_tst_wrf_reads.dir/tst_utils.c.o.d"
+  "CMakeFiles/nc_perf_tst_wrf_reads.dir/tst_wrf_reads.c.o"
+  "CMakeFiles/nc_perf_tst_wrf_reads.dir/tst_wrf_reads.c.o.d"
+  "nc_perf_tst_wrf_reads"
+  "nc_perf_tst_wrf_reads.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_perf_tst_wrf_reads.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/openbigmeta.dir/openbigmeta.c.o"
+  "CMakeFiles/openbigmeta.dir/openbigmeta.c.o.d"
+  "CMakeFiles/openbigmeta.dir/tst_utils.c.o"
+  "CMakeFiles/openbigmeta.dir/tst_utils.c.o.d"
+  "openbigmeta"
+  "openbigmeta.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/openbigmeta.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_ar4.dir/tst_ar4.c.o"
+  "CMakeFiles/tst_ar4.dir/tst_ar4.c.o.d"
+  "CMakeFiles/tst_ar4.dir/tst_utils.c.o"
+  "CMakeFiles/tst_ar4.dir/tst_utils.c.o.d"
+  "tst_ar4"
+  "tst_ar4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_ar4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_ar4_4d.dir/tst_ar4_4d.c.o"
+  "CMakeFiles/tst_ar4_4d.dir/tst_ar4_4d.c.o.d"
+  "CMakeFiles/tst_ar4_4d.dir/tst_utils.c.o"
+  "CMakeFiles/tst_ar4_4d.dir/tst_utils.c.o.d"
+  "tst_ar4_4d"
+  "tst_ar4_4d.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_ar4_4d.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
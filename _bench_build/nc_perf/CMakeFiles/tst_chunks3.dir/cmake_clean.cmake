@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_chunks3.dir/tst_chunks3.c.o"
+  "CMakeFiles/tst_chunks3.dir/tst_chunks3.c.o.d"
+  "CMakeFiles/tst_chunks3.dir/tst_utils.c.o"
+  "CMakeFiles/tst_chunks3.dir/tst_utils.c.o.d"
+  "tst_chunks3"
+  "tst_chunks3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_chunks3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_files2.dir/tst_files2.c.o"
+  "CMakeFiles/tst_files2.dir/tst_files2.c.o.d"
+  "CMakeFiles/tst_files2.dir/tst_utils.c.o"
+  "CMakeFiles/tst_files2.dir/tst_utils.c.o.d"
+  "tst_files2"
+  "tst_files2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_files2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_h_many_atts.dir/tst_h_many_atts.c.o"
+  "CMakeFiles/tst_h_many_atts.dir/tst_h_many_atts.c.o.d"
+  "CMakeFiles/tst_h_many_atts.dir/tst_utils.c.o"
+  "CMakeFiles/tst_h_many_atts.dir/tst_utils.c.o.d"
+  "tst_h_many_atts"
+  "tst_h_many_atts.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_h_many_atts.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_knmi.dir/tst_knmi.c.o"
+  "CMakeFiles/tst_knmi.dir/tst_knmi.c.o.d"
+  "CMakeFiles/tst_knmi.dir/tst_utils.c.o"
+  "CMakeFiles/tst_knmi.dir/tst_utils.c.o.d"
+  "tst_knmi"
+  "tst_knmi.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_knmi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,32 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/nc_perf
+# Build directory: /root/repo/_bench_build/nc_perf
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[nc_perf_tst_ar4_3d]=] "/nc_perf_tst_ar4_3d")
+set_tests_properties([=[nc_perf_tst_ar4_3d]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_perf/CMakeLists.txt;21;add_bin_test;/root/repo/nc_perf/CMakeLists.txt;0;")
+add_test([=[nc_perf_tst_create_files]=] "/nc_perf_tst_create_files")
+set_tests_properties([=[nc_perf_tst_create_files]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_perf/CMakeLists.txt;22;add_bin_test;/root/repo/nc_perf/CMakeLists.txt;0;")
+add_test([=[nc_perf_tst_files3]=] "/nc_perf_tst_files3")
+set_tests_properties([=[nc_perf_tst_files3]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_perf/CMakeLists.txt;23;add_bin_test;/root/repo/nc_perf/CMakeLists.txt;0;")
+add_test([=[nc_perf_tst_mem]=] "/nc_perf_tst_mem")
+set_tests_properties([=[nc_perf_tst_mem]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_perf/CMakeLists.txt;24;add_bin_test;/root/repo/nc_perf/CMakeLists.txt;0;")
+add_test([=[nc_perf_tst_wrf_reads]=] "/nc_perf_tst_wrf_reads")
+set_tests_properties([=[nc_perf_tst_wrf_reads]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_perf/CMakeLists.txt;25;add_bin_test;/root/repo/nc_perf/CMakeLists.txt;0;")
+add_test([=[nc_perf_tst_attsperf]=] "/nc_perf_tst_attsperf")
+set_tests_properties([=[nc_perf_tst_attsperf]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_perf/CMakeLists.txt;26;add_bin_test;/root/repo/nc_perf/CMakeLists.txt;0;")
+add_test([=[nc_perf_tst_bm_rando]=] "/nc_perf_tst_bm_rando")
+set_tests_properties([=[nc_perf_tst_bm_rando]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_perf/CMakeLists.txt;27;add_bin_test;/root/repo/nc_perf/CMakeLists.txt;0;")
+add_test([=[nc_perf_tst_compress]=] "/nc_perf_tst_compress")
+set_tests_properties([=[nc_perf_tst_compress]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_perf/CMakeLists.txt;28;add_bin_test;/root/repo/nc_perf/CMakeLists.txt;0;")
+add_test([=[nc_perf_perftest]=] "bash" "-c" "export srcdir=/root/repo/nc_perf;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nc_perf/perftest.sh ")
+set_tests_properties([=[nc_perf_perftest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nc_perf/CMakeLists.txt;31;add_sh_test;/root/repo/nc_perf/CMakeLists.txt;0;")
+add_test([=[nc_perf_run_tst_chunks]=] "bash" "-c" "export srcdir=/root/repo/nc_perf;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nc_perf/run_tst_chunks.sh ")
+set_tests_properties([=[nc_perf_run_tst_chunks]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nc_perf/CMakeLists.txt;32;add_sh_test;/root/repo/nc_perf/CMakeLists.txt;0;")
+add_test([=[nc_perf_run_bm_elena]=] "bash" "-c" "export srcdir=/root/repo/nc_perf;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nc_perf/run_bm_elena.sh ")
+set_tests_properties([=[nc_perf_run_bm_elena]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nc_perf/CMakeLists.txt;33;add_sh_test;/root/repo/nc_perf/CMakeLists.txt;0;")
+add_test([=[nc_perf_run_bm_test1]=] "bash" "-c" "export srcdir=/root/repo/nc_perf;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nc_perf/run_bm_test1.sh ")
+set_tests_properties([=[nc_perf_run_bm_test1]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nc_perf/CMakeLists.txt;36;add_sh_test;/root/repo/nc_perf/CMakeLists.txt;0;")
+add_test([=[nc_perf_run_bm_test2]=] "bash" "-c" "export srcdir=/root/repo/nc_perf;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nc_perf/run_bm_test2.sh ")
+set_tests_properties([=[nc_perf_run_bm_test2]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nc_perf/CMakeLists.txt;37;add_sh_test;/root/repo/nc_perf/CMakeLists.txt;0;")
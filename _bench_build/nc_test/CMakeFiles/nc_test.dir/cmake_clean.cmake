@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test.dir/error.c.o"
+  "CMakeFiles/nc_test.dir/error.c.o.d"
+  "CMakeFiles/nc_test.dir/nc_test.c.o"
+  "CMakeFiles/nc_test.dir/nc_test.c.o.d"
+  "CMakeFiles/nc_test.dir/test_get.c.o"
+  "CMakeFiles/nc_test.dir/test_get.c.o.d"
+  "CMakeFiles/nc_test.dir/test_put.c.o"
+  "CMakeFiles/nc_test.dir/test_put.c.o.d"
+  "CMakeFiles/nc_test.dir/test_read.c.o"
+  "CMakeFiles/nc_test.dir/test_read.c.o.d"
+  "CMakeFiles/nc_test.dir/test_write.c.o"
+  "CMakeFiles/nc_test.dir/test_write.c.o.d"
+  "CMakeFiles/nc_test.dir/util.c.o"
+  "CMakeFiles/nc_test.dir/util.c.o.d"
+  "nc_test"
+  "nc_test.pdb"
+  "test_get.c"
+  "test_put.c"
+  "test_read.c"
+  "test_write.c"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
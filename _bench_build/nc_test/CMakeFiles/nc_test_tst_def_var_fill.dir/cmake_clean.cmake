@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test_tst_def_var_fill.dir/tst_def_var_fill.c.o"
+  "CMakeFiles/nc_test_tst_def_var_fill.dir/tst_def_var_fill.c.o.d"
+  "nc_test_tst_def_var_fill"
+  "nc_test_tst_def_var_fill.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test_tst_def_var_fill.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test_tst_default_format.dir/tst_default_format.c.o"
+  "CMakeFiles/nc_test_tst_default_format.dir/tst_default_format.c.o.d"
+  "nc_test_tst_default_format"
+  "nc_test_tst_default_format.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test_tst_default_format.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test_tst_diskless6.dir/tst_diskless6.c.o"
+  "CMakeFiles/nc_test_tst_diskless6.dir/tst_diskless6.c.o.d"
+  "nc_test_tst_diskless6"
+  "nc_test_tst_diskless6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test_tst_diskless6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test_tst_meta.dir/tst_meta.c.o"
+  "CMakeFiles/nc_test_tst_meta.dir/tst_meta.c.o.d"
+  "nc_test_tst_meta"
+  "nc_test_tst_meta.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test_tst_meta.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
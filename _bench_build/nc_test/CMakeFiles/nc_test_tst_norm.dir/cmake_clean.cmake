@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test_tst_norm.dir/tst_norm.c.o"
+  "CMakeFiles/nc_test_tst_norm.dir/tst_norm.c.o.d"
+  "nc_test_tst_norm"
+  "nc_test_tst_norm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test_tst_norm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test_tst_small.dir/tst_small.c.o"
+  "CMakeFiles/nc_test_tst_small.dir/tst_small.c.o.d"
+  "nc_test_tst_small"
+  "nc_test_tst_small.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test_tst_small.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test_tst_utf8_phrases.dir/tst_utf8_phrases.c.o"
+  "CMakeFiles/nc_test_tst_utf8_phrases.dir/tst_utf8_phrases.c.o.d"
+  "nc_test_tst_utf8_phrases"
+  "nc_test_tst_utf8_phrases.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test_tst_utf8_phrases.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
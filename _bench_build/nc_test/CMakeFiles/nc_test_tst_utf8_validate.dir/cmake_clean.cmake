@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test_tst_utf8_validate.dir/tst_utf8_validate.c.o"
+  "CMakeFiles/nc_test_tst_utf8_validate.dir/tst_utf8_validate.c.o.d"
+  "nc_test_tst_utf8_validate"
+  "nc_test_tst_utf8_validate.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test_tst_utf8_validate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_inmemory.dir/tst_inmemory.c.o"
+  "CMakeFiles/tst_inmemory.dir/tst_inmemory.c.o.d"
+  "tst_inmemory"
+  "tst_inmemory.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_inmemory.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_open_mem.dir/tst_open_mem.c.o"
+  "CMakeFiles/tst_open_mem.dir/tst_open_mem.c.o.d"
+  "tst_open_mem"
+  "tst_open_mem.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_open_mem.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,54 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/nc_test
+# Build directory: /root/repo/_bench_build/nc_test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[nc_test_t_nc]=] "/nc_test_t_nc")
+set_tests_properties([=[nc_test_t_nc]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test/CMakeLists.txt;99;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test([=[nc_test_tst_small]=] "/nc_test_tst_small")
+set_tests_properties([=[nc_test_tst_small]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test/CMakeLists.txt;99;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test([=[nc_test_tst_misc]=] "/nc_test_tst_misc")
+set_tests_properties([=[nc_test_tst_misc]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test/CMakeLists.txt;99;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test([=[nc_test_tst_norm]=] "/nc_test_tst_norm")
+set_tests_properties([=[nc_test_tst_norm]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test/CMakeLists.txt;99;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test([=[nc_test_tst_names]=] "/nc_test_tst_names")
+set_tests_properties([=[nc_test_tst_names]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test/CMakeLists.txt;99;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test([=[nc_test_tst_nofill]=] "/nc_test_tst_nofill")
+set_tests_properties([=[nc_test_tst_nofill]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test/CMakeLists.txt;99;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test([=[nc_test_tst_nofill2]=] "/nc_test_tst_nofill2")
+set_tests_properties([=[nc_test_tst_nofill2]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test/CMakeLists.txt;99;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test([=[nc_test_tst_nofill3]=] "/nc_test_tst_nofill3")
+set_tests_properties([=[nc_test_tst_nofill3]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test/CMakeLists.txt;99;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test([=[nc_test_tst_meta]=] "/nc_test_tst_meta")
+set_tests_properties([=[nc_test_tst_meta]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test/CMakeLists.txt;99;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test([=[nc_test_tst_inq_type]=] "/nc_test_tst_inq_type")
+set_tests_properties([=[nc_test_tst_inq_type]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test/CMakeLists.txt;99;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test([=[nc_test_tst_utf8_phrases]=] "/nc_test_tst_utf8_phrases")
+set_tests_properties([=[nc_test_tst_utf8_phrases]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test/CMakeLists.txt;99;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test([=[nc_test_tst_global_fillval]=] "/nc_test_tst_global_fillval")
+set_tests_properties([=[nc_test_tst_global_fillval]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test/CMakeLists.txt;99;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test([=[nc_test_tst_max_var_dims]=] "/nc_test_tst_max_var_dims")
+set_tests_properties([=[nc_test_tst_max_var_dims]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test/CMakeLists.txt;99;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test([=[nc_test_tst_formats]=] "/nc_test_tst_formats")
+set_tests_properties([=[nc_test_tst_formats]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test/CMakeLists.txt;99;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test([=[nc_test_tst_def_var_fill]=] "/nc_test_tst_def_var_fill")
+set_tests_properties([=[nc_test_tst_def_var_fill]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test/CMakeLists.txt;99;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test([=[nc_test_tst_err_enddef]=] "/nc_test_tst_err_enddef")
+set_tests_properties([=[nc_test_tst_err_enddef]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test/CMakeLists.txt;99;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test([=[nc_test_tst_default_format]=] "/nc_test_tst_default_format")
+set_tests_properties([=[nc_test_tst_default_format]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test/CMakeLists.txt;99;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test([=[nc_test_tst_utf8_validate]=] "/nc_test_tst_utf8_validate")
+set_tests_properties([=[nc_test_tst_utf8_validate]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test/CMakeLists.txt;99;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test([=[nc_test_tst_diskless6]=] "/nc_test_tst_diskless6")
+set_tests_properties([=[nc_test_tst_diskless6]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test/CMakeLists.txt;99;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test([=[nc_test]=] "/nc_test")
+set_tests_properties([=[nc_test]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/nc_test/CMakeLists.txt;102;ADD_TEST;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test([=[nc_test_run_diskless]=] "bash" "-c" "export srcdir=/root/repo/nc_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nc_test/run_diskless.sh ")
+set_tests_properties([=[nc_test_run_diskless]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nc_test/CMakeLists.txt;106;add_sh_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test([=[nc_test_run_mmap]=] "bash" "-c" "export srcdir=/root/repo/nc_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nc_test/run_mmap.sh ")
+set_tests_properties([=[nc_test_run_mmap]=] PROPERTIES  RUN_SERIAL "TRUE" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nc_test/CMakeLists.txt;108;add_sh_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test([=[nc_test_run_diskless5]=] "bash" "-c" "export srcdir=/root/repo/nc_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nc_test/run_diskless5.sh ")
+set_tests_properties([=[nc_test_run_diskless5]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nc_test/CMakeLists.txt;113;add_sh_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test([=[nc_test_run_inmemory]=] "bash" "-c" "export srcdir=/root/repo/nc_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nc_test/run_inmemory.sh ")
+set_tests_properties([=[nc_test_run_inmemory]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nc_test/CMakeLists.txt;114;add_sh_test;/root/repo/nc_test/CMakeLists.txt;0;")
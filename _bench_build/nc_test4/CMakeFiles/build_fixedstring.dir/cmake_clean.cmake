@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/build_fixedstring.dir/build_fixedstring.c.o"
+  "CMakeFiles/build_fixedstring.dir/build_fixedstring.c.o.d"
+  "build_fixedstring"
+  "build_fixedstring.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/build_fixedstring.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/h5testszip.dir/h5testszip.c.o"
+  "CMakeFiles/h5testszip.dir/h5testszip.c.o.d"
+  "h5testszip"
+  "h5testszip.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5testszip.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
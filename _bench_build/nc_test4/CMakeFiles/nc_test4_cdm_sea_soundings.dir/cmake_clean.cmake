@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_cdm_sea_soundings.dir/cdm_sea_soundings.c.o"
+  "CMakeFiles/nc_test4_cdm_sea_soundings.dir/cdm_sea_soundings.c.o.d"
+  "nc_test4_cdm_sea_soundings"
+  "nc_test4_cdm_sea_soundings.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_cdm_sea_soundings.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_t_type.dir/t_type.c.o"
+  "CMakeFiles/nc_test4_t_type.dir/t_type.c.o.d"
+  "nc_test4_t_type"
+  "nc_test4_t_type.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_t_type.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
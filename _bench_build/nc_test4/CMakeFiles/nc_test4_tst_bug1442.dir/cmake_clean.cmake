@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_bug1442.dir/tst_bug1442.c.o"
+  "CMakeFiles/nc_test4_tst_bug1442.dir/tst_bug1442.c.o.d"
+  "nc_test4_tst_bug1442"
+  "nc_test4_tst_bug1442.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_bug1442.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
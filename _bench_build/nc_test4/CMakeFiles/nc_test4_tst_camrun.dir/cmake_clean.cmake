@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_camrun.dir/tst_camrun.c.o"
+  "CMakeFiles/nc_test4_tst_camrun.dir/tst_camrun.c.o.d"
+  "nc_test4_tst_camrun"
+  "nc_test4_tst_camrun.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_camrun.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
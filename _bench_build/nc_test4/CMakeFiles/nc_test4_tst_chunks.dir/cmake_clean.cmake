@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_chunks.dir/tst_chunks.c.o"
+  "CMakeFiles/nc_test4_tst_chunks.dir/tst_chunks.c.o.d"
+  "nc_test4_tst_chunks"
+  "nc_test4_tst_chunks.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_chunks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_compounds.dir/tst_compounds.c.o"
+  "CMakeFiles/nc_test4_tst_compounds.dir/tst_compounds.c.o.d"
+  "nc_test4_tst_compounds"
+  "nc_test4_tst_compounds.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_compounds.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
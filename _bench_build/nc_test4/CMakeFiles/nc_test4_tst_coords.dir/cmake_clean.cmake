@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_coords.dir/tst_coords.c.o"
+  "CMakeFiles/nc_test4_tst_coords.dir/tst_coords.c.o.d"
+  "nc_test4_tst_coords"
+  "nc_test4_tst_coords.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_coords.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
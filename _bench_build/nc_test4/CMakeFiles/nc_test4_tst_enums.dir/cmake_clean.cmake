@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_enums.dir/tst_enums.c.o"
+  "CMakeFiles/nc_test4_tst_enums.dir/tst_enums.c.o.d"
+  "nc_test4_tst_enums"
+  "nc_test4_tst_enums.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_enums.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_fill_attr_vanish.dir/tst_fill_attr_vanish.c.o"
+  "CMakeFiles/nc_test4_tst_fill_attr_vanish.dir/tst_fill_attr_vanish.c.o.d"
+  "nc_test4_tst_fill_attr_vanish"
+  "nc_test4_tst_fill_attr_vanish.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_fill_attr_vanish.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_fillbug.dir/tst_fillbug.c.o"
+  "CMakeFiles/nc_test4_tst_fillbug.dir/tst_fillbug.c.o.d"
+  "nc_test4_tst_fillbug"
+  "nc_test4_tst_fillbug.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_fillbug.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_fills.dir/tst_fills.c.o"
+  "CMakeFiles/nc_test4_tst_fills.dir/tst_fills.c.o.d"
+  "nc_test4_tst_fills"
+  "nc_test4_tst_fills.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_fills.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
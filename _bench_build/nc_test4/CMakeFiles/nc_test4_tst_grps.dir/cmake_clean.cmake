@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_grps.dir/tst_grps.c.o"
+  "CMakeFiles/nc_test4_tst_grps.dir/tst_grps.c.o.d"
+  "nc_test4_tst_grps"
+  "nc_test4_tst_grps.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_grps.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_h_refs.dir/tst_h_refs.c.o"
+  "CMakeFiles/nc_test4_tst_h_refs.dir/tst_h_refs.c.o.d"
+  "nc_test4_tst_h_refs"
+  "nc_test4_tst_h_refs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_h_refs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_h_transient_types.dir/tst_h_transient_types.c.o"
+  "CMakeFiles/nc_test4_tst_h_transient_types.dir/tst_h_transient_types.c.o.d"
+  "nc_test4_tst_h_transient_types"
+  "nc_test4_tst_h_transient_types.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_h_transient_types.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
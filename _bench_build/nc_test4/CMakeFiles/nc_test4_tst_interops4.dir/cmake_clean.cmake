@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_interops4.dir/tst_interops4.c.o"
+  "CMakeFiles/nc_test4_tst_interops4.dir/tst_interops4.c.o.d"
+  "nc_test4_tst_interops4"
+  "nc_test4_tst_interops4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_interops4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_interops_dims.dir/tst_interops_dims.c.o"
+  "CMakeFiles/nc_test4_tst_interops_dims.dir/tst_interops_dims.c.o.d"
+  "nc_test4_tst_interops_dims"
+  "nc_test4_tst_interops_dims.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_interops_dims.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
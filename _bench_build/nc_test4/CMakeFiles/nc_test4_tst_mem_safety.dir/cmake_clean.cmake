@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_mem_safety.dir/tst_mem_safety.c.o"
+  "CMakeFiles/nc_test4_tst_mem_safety.dir/tst_mem_safety.c.o.d"
+  "nc_test4_tst_mem_safety"
+  "nc_test4_tst_mem_safety.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_mem_safety.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_meta_block_size.dir/tst_meta_block_size.c.o"
+  "CMakeFiles/nc_test4_tst_meta_block_size.dir/tst_meta_block_size.c.o.d"
+  "nc_test4_tst_meta_block_size"
+  "nc_test4_tst_meta_block_size.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_meta_block_size.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_opaques.dir/tst_opaques.c.o"
+  "CMakeFiles/nc_test4_tst_opaques.dir/tst_opaques.c.o.d"
+  "nc_test4_tst_opaques"
+  "nc_test4_tst_opaques.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_opaques.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
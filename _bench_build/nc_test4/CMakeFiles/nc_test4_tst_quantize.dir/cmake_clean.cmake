@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_quantize.dir/tst_quantize.c.o"
+  "CMakeFiles/nc_test4_tst_quantize.dir/tst_quantize.c.o.d"
+  "nc_test4_tst_quantize"
+  "nc_test4_tst_quantize.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_quantize.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_rehash.dir/tst_rehash.c.o"
+  "CMakeFiles/nc_test4_tst_rehash.dir/tst_rehash.c.o.d"
+  "nc_test4_tst_rehash"
+  "nc_test4_tst_rehash.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_rehash.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_strided_write.dir/tst_strided_write.c.o"
+  "CMakeFiles/nc_test4_tst_strided_write.dir/tst_strided_write.c.o.d"
+  "nc_test4_tst_strided_write"
+  "nc_test4_tst_strided_write.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_strided_write.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_sync.dir/tst_sync.c.o"
+  "CMakeFiles/nc_test4_tst_sync.dir/tst_sync.c.o.d"
+  "nc_test4_tst_sync"
+  "nc_test4_tst_sync.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_sync.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
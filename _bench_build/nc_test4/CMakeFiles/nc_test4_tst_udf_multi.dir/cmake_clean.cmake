@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_udf_multi.dir/tst_udf_multi.c.o"
+  "CMakeFiles/nc_test4_tst_udf_multi.dir/tst_udf_multi.c.o.d"
+  "nc_test4_tst_udf_multi"
+  "nc_test4_tst_udf_multi.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_udf_multi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_udf_open_mode.dir/tst_udf_open_mode.c.o"
+  "CMakeFiles/nc_test4_tst_udf_open_mode.dir/tst_udf_open_mode.c.o.d"
+  "nc_test4_tst_udf_open_mode"
+  "nc_test4_tst_udf_open_mode.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_udf_open_mode.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
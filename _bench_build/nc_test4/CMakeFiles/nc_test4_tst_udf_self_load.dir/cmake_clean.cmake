@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_udf_self_load.dir/tst_udf_self_load.c.o"
+  "CMakeFiles/nc_test4_tst_udf_self_load.dir/tst_udf_self_load.c.o.d"
+  "nc_test4_tst_udf_self_load"
+  "nc_test4_tst_udf_self_load.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_udf_self_load.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
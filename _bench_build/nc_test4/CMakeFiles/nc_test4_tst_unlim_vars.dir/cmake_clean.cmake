@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_unlim_vars.dir/tst_unlim_vars.c.o"
+  "CMakeFiles/nc_test4_tst_unlim_vars.dir/tst_unlim_vars.c.o.d"
+  "nc_test4_tst_unlim_vars"
+  "nc_test4_tst_unlim_vars.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_unlim_vars.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_vars2.dir/tst_vars2.c.o"
+  "CMakeFiles/nc_test4_tst_vars2.dir/tst_vars2.c.o.d"
+  "nc_test4_tst_vars2"
+  "nc_test4_tst_vars2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_vars2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
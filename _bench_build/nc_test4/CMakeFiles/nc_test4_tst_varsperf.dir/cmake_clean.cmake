@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_varsperf.dir/tst_varsperf.c.o"
+  "CMakeFiles/nc_test4_tst_varsperf.dir/tst_varsperf.c.o.d"
+  "nc_test4_tst_varsperf"
+  "nc_test4_tst_varsperf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_varsperf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_virtual_datasets.dir/tst_virtual_datasets.c.o"
+  "CMakeFiles/nc_test4_tst_virtual_datasets.dir/tst_virtual_datasets.c.o.d"
+  "nc_test4_tst_virtual_datasets"
+  "nc_test4_tst_virtual_datasets.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_virtual_datasets.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
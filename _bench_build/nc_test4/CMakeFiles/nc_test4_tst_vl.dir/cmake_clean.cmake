@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_vl.dir/tst_vl.c.o"
+  "CMakeFiles/nc_test4_tst_vl.dir/tst_vl.c.o.d"
+  "nc_test4_tst_vl"
+  "nc_test4_tst_vl.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_vl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
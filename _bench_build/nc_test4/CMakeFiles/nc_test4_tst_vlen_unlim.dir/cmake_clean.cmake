@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_vlen_unlim.dir/tst_vlen_unlim.c.o"
+  "CMakeFiles/nc_test4_tst_vlen_unlim.dir/tst_vlen_unlim.c.o.d"
+  "nc_test4_tst_vlen_unlim"
+  "nc_test4_tst_vlen_unlim.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_vlen_unlim.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_filter_misc.dir/test_filter_misc.c.o"
+  "CMakeFiles/test_filter_misc.dir/test_filter_misc.c.o.d"
+  "test_filter_misc"
+  "test_filter_misc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_filter_misc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
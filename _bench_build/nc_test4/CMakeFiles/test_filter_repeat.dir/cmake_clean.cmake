@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_filter_repeat.dir/test_filter_repeat.c.o"
+  "CMakeFiles/test_filter_repeat.dir/test_filter_repeat.c.o.d"
+  "test_filter_repeat"
+  "test_filter_repeat.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_filter_repeat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
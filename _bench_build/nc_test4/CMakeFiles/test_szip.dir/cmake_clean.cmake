@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_szip.dir/test_szip.c.o"
+  "CMakeFiles/test_szip.dir/test_szip.c.o.d"
+  "test_szip"
+  "test_szip.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_szip.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
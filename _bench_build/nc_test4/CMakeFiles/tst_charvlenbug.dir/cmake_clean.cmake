@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_charvlenbug.dir/tst_charvlenbug.c.o"
+  "CMakeFiles/tst_charvlenbug.dir/tst_charvlenbug.c.o.d"
+  "tst_charvlenbug"
+  "tst_charvlenbug.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_charvlenbug.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
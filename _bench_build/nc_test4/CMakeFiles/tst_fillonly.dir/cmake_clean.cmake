@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_fillonly.dir/tst_fillonly.c.o"
+  "CMakeFiles/tst_fillonly.dir/tst_fillonly.c.o.d"
+  "tst_fillonly"
+  "tst_fillonly.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_fillonly.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
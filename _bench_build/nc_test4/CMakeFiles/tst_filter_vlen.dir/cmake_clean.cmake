@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_filter_vlen.dir/tst_filter_vlen.c.o"
+  "CMakeFiles/tst_filter_vlen.dir/tst_filter_vlen.c.o.d"
+  "tst_filter_vlen"
+  "tst_filter_vlen.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_filter_vlen.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_filterparser.dir/tst_filterparser.c.o"
+  "CMakeFiles/tst_filterparser.dir/tst_filterparser.c.o.d"
+  "tst_filterparser"
+  "tst_filterparser.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_filterparser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
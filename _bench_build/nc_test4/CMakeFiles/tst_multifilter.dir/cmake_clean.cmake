@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_multifilter.dir/tst_multifilter.c.o"
+  "CMakeFiles/tst_multifilter.dir/tst_multifilter.c.o.d"
+  "tst_multifilter"
+  "tst_multifilter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_multifilter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_vlenstr.dir/tst_vlenstr.c.o"
+  "CMakeFiles/tst_vlenstr.dir/tst_vlenstr.c.o.d"
+  "tst_vlenstr"
+  "tst_vlenstr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_vlenstr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_zero_len_att.dir/tst_zero_len_att.c.o"
+  "CMakeFiles/tst_zero_len_att.dir/tst_zero_len_att.c.o.d"
+  "tst_zero_len_att"
+  "tst_zero_len_att.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_zero_len_att.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,188 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/nc_test4
+# Build directory: /root/repo/_bench_build/nc_test4
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[nc_test4_run_grp_rename]=] "bash" "-c" "export srcdir=/root/repo/nc_test4;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nc_test4/run_grp_rename.sh ")
+set_tests_properties([=[nc_test4_run_grp_rename]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nc_test4/CMakeLists.txt;38;add_sh_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_misc]=] "bash" "-c" "export srcdir=/root/repo/nc_test4;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nc_test4/tst_misc.sh ")
+set_tests_properties([=[nc_test4_tst_misc]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nc_test4/CMakeLists.txt;41;ADD_SH_TEST;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_test_fillonly]=] "bash" "-c" "export srcdir=/root/repo/nc_test4;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nc_test4/test_fillonly.sh ")
+set_tests_properties([=[nc_test4_test_fillonly]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nc_test4/CMakeLists.txt;43;ADD_SH_TEST;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_fixedstring]=] "bash" "-c" "export srcdir=/root/repo/nc_test4;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nc_test4/tst_fixedstring.sh ")
+set_tests_properties([=[nc_test4_tst_fixedstring]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nc_test4/CMakeLists.txt;46;ADD_SH_TEST;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_run_zero_len_att_test]=] "bash" "-c" "export srcdir=/root/repo/nc_test4;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nc_test4/run_zero_len_att_test.sh ")
+set_tests_properties([=[nc_test4_run_zero_len_att_test]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nc_test4/CMakeLists.txt;50;add_sh_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_filter]=] "bash" "-c" "export srcdir=/root/repo/nc_test4;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nc_test4/tst_filter.sh ")
+set_tests_properties([=[nc_test4_tst_filter]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nc_test4/CMakeLists.txt;60;ADD_SH_TEST;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_specific_filters]=] "bash" "-c" "export srcdir=/root/repo/nc_test4;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nc_test4/tst_specific_filters.sh ")
+set_tests_properties([=[nc_test4_tst_specific_filters]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nc_test4/CMakeLists.txt;62;ADD_SH_TEST;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_bloscfail]=] "bash" "-c" "export srcdir=/root/repo/nc_test4;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nc_test4/tst_bloscfail.sh ")
+set_tests_properties([=[nc_test4_tst_bloscfail]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nc_test4/CMakeLists.txt;63;ADD_SH_TEST;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_filter_vlen]=] "bash" "-c" "export srcdir=/root/repo/nc_test4;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nc_test4/tst_filter_vlen.sh ")
+set_tests_properties([=[nc_test4_tst_filter_vlen]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nc_test4/CMakeLists.txt;64;ADD_SH_TEST;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_run_empty_vlen_test]=] "bash" "-c" "export srcdir=/root/repo/nc_test4;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nc_test4/run_empty_vlen_test.sh ")
+set_tests_properties([=[nc_test4_run_empty_vlen_test]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nc_test4/CMakeLists.txt;89;ADD_SH_TEST;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_udf_self_load]=] "/nc_test4_tst_udf_self_load")
+set_tests_properties([=[nc_test4_tst_udf_self_load]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/nc_test4/CMakeLists.txt;110;add_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_szip]=] "bash" "-c" "export srcdir=/root/repo/nc_test4;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nc_test4/tst_szip.sh ")
+set_tests_properties([=[nc_test4_tst_szip]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nc_test4/CMakeLists.txt;139;add_sh_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_dims]=] "/nc_test4_tst_dims")
+set_tests_properties([=[nc_test4_tst_dims]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_dims2]=] "/nc_test4_tst_dims2")
+set_tests_properties([=[nc_test4_tst_dims2]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_dims3]=] "/nc_test4_tst_dims3")
+set_tests_properties([=[nc_test4_tst_dims3]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_files]=] "/nc_test4_tst_files")
+set_tests_properties([=[nc_test4_tst_files]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_files4]=] "/nc_test4_tst_files4")
+set_tests_properties([=[nc_test4_tst_files4]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_vars]=] "/nc_test4_tst_vars")
+set_tests_properties([=[nc_test4_tst_vars]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_varms]=] "/nc_test4_tst_varms")
+set_tests_properties([=[nc_test4_tst_varms]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_unlim_vars]=] "/nc_test4_tst_unlim_vars")
+set_tests_properties([=[nc_test4_tst_unlim_vars]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_converts]=] "/nc_test4_tst_converts")
+set_tests_properties([=[nc_test4_tst_converts]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_converts2]=] "/nc_test4_tst_converts2")
+set_tests_properties([=[nc_test4_tst_converts2]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_grps]=] "/nc_test4_tst_grps")
+set_tests_properties([=[nc_test4_tst_grps]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_grps2]=] "/nc_test4_tst_grps2")
+set_tests_properties([=[nc_test4_tst_grps2]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_compounds]=] "/nc_test4_tst_compounds")
+set_tests_properties([=[nc_test4_tst_compounds]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_compounds2]=] "/nc_test4_tst_compounds2")
+set_tests_properties([=[nc_test4_tst_compounds2]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_compounds3]=] "/nc_test4_tst_compounds3")
+set_tests_properties([=[nc_test4_tst_compounds3]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_opaques]=] "/nc_test4_tst_opaques")
+set_tests_properties([=[nc_test4_tst_opaques]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_strings]=] "/nc_test4_tst_strings")
+set_tests_properties([=[nc_test4_tst_strings]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_strings2]=] "/nc_test4_tst_strings2")
+set_tests_properties([=[nc_test4_tst_strings2]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_interops]=] "/nc_test4_tst_interops")
+set_tests_properties([=[nc_test4_tst_interops]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_interops4]=] "/nc_test4_tst_interops4")
+set_tests_properties([=[nc_test4_tst_interops4]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_interops6]=] "/nc_test4_tst_interops6")
+set_tests_properties([=[nc_test4_tst_interops6]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_interops_dims]=] "/nc_test4_tst_interops_dims")
+set_tests_properties([=[nc_test4_tst_interops_dims]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_enums]=] "/nc_test4_tst_enums")
+set_tests_properties([=[nc_test4_tst_enums]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_coords]=] "/nc_test4_tst_coords")
+set_tests_properties([=[nc_test4_tst_coords]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_coords2]=] "/nc_test4_tst_coords2")
+set_tests_properties([=[nc_test4_tst_coords2]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_coords3]=] "/nc_test4_tst_coords3")
+set_tests_properties([=[nc_test4_tst_coords3]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_vars3]=] "/nc_test4_tst_vars3")
+set_tests_properties([=[nc_test4_tst_vars3]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_vars4]=] "/nc_test4_tst_vars4")
+set_tests_properties([=[nc_test4_tst_vars4]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_chunks]=] "/nc_test4_tst_chunks")
+set_tests_properties([=[nc_test4_tst_chunks]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_chunks2]=] "/nc_test4_tst_chunks2")
+set_tests_properties([=[nc_test4_tst_chunks2]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_utf8]=] "/nc_test4_tst_utf8")
+set_tests_properties([=[nc_test4_tst_utf8]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_fills]=] "/nc_test4_tst_fills")
+set_tests_properties([=[nc_test4_tst_fills]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_fills2]=] "/nc_test4_tst_fills2")
+set_tests_properties([=[nc_test4_tst_fills2]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_fillbug]=] "/nc_test4_tst_fillbug")
+set_tests_properties([=[nc_test4_tst_fillbug]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_xplatform2]=] "/nc_test4_tst_xplatform2")
+set_tests_properties([=[nc_test4_tst_xplatform2]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_endian_fill]=] "/nc_test4_tst_endian_fill")
+set_tests_properties([=[nc_test4_tst_endian_fill]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_atts]=] "/nc_test4_tst_atts")
+set_tests_properties([=[nc_test4_tst_atts]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_t_type]=] "/nc_test4_t_type")
+set_tests_properties([=[nc_test4_t_type]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_cdm_sea_soundings]=] "/nc_test4_cdm_sea_soundings")
+set_tests_properties([=[nc_test4_cdm_sea_soundings]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_vl]=] "/nc_test4_tst_vl")
+set_tests_properties([=[nc_test4_tst_vl]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_atts1]=] "/nc_test4_tst_atts1")
+set_tests_properties([=[nc_test4_tst_atts1]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_atts2]=] "/nc_test4_tst_atts2")
+set_tests_properties([=[nc_test4_tst_atts2]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_vars2]=] "/nc_test4_tst_vars2")
+set_tests_properties([=[nc_test4_tst_vars2]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_files5]=] "/nc_test4_tst_files5")
+set_tests_properties([=[nc_test4_tst_files5]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_files6]=] "/nc_test4_tst_files6")
+set_tests_properties([=[nc_test4_tst_files6]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_sync]=] "/nc_test4_tst_sync")
+set_tests_properties([=[nc_test4_tst_sync]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_h_strbug]=] "/nc_test4_tst_h_strbug")
+set_tests_properties([=[nc_test4_tst_h_strbug]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_h_refs]=] "/nc_test4_tst_h_refs")
+set_tests_properties([=[nc_test4_tst_h_refs]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_h_scalar]=] "/nc_test4_tst_h_scalar")
+set_tests_properties([=[nc_test4_tst_h_scalar]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_rename]=] "/nc_test4_tst_rename")
+set_tests_properties([=[nc_test4_tst_rename]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_rename2]=] "/nc_test4_tst_rename2")
+set_tests_properties([=[nc_test4_tst_rename2]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_rename3]=] "/nc_test4_tst_rename3")
+set_tests_properties([=[nc_test4_tst_rename3]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_h5_endians]=] "/nc_test4_tst_h5_endians")
+set_tests_properties([=[nc_test4_tst_h5_endians]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_atts_string_rewrite]=] "/nc_test4_tst_atts_string_rewrite")
+set_tests_properties([=[nc_test4_tst_atts_string_rewrite]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_put_vars_two_unlim_dim]=] "/nc_test4_tst_put_vars_two_unlim_dim")
+set_tests_properties([=[nc_test4_tst_put_vars_two_unlim_dim]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_hdf5_file_compat]=] "/nc_test4_tst_hdf5_file_compat")
+set_tests_properties([=[nc_test4_tst_hdf5_file_compat]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_fill_attr_vanish]=] "/nc_test4_tst_fill_attr_vanish")
+set_tests_properties([=[nc_test4_tst_fill_attr_vanish]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_rehash]=] "/nc_test4_tst_rehash")
+set_tests_properties([=[nc_test4_tst_rehash]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_types]=] "/nc_test4_tst_types")
+set_tests_properties([=[nc_test4_tst_types]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_bug324]=] "/nc_test4_tst_bug324")
+set_tests_properties([=[nc_test4_tst_bug324]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_atts3]=] "/nc_test4_tst_atts3")
+set_tests_properties([=[nc_test4_tst_atts3]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_put_vars]=] "/nc_test4_tst_put_vars")
+set_tests_properties([=[nc_test4_tst_put_vars]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_elatefill]=] "/nc_test4_tst_elatefill")
+set_tests_properties([=[nc_test4_tst_elatefill]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_udf]=] "/nc_test4_tst_udf")
+set_tests_properties([=[nc_test4_tst_udf]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_udf_multi]=] "/nc_test4_tst_udf_multi")
+set_tests_properties([=[nc_test4_tst_udf_multi]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_udf_open_mode]=] "/nc_test4_tst_udf_open_mode")
+set_tests_properties([=[nc_test4_tst_udf_open_mode]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_bug1442]=] "/nc_test4_tst_bug1442")
+set_tests_properties([=[nc_test4_tst_bug1442]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_broken_files]=] "/nc_test4_tst_broken_files")
+set_tests_properties([=[nc_test4_tst_broken_files]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_quantize]=] "/nc_test4_tst_quantize")
+set_tests_properties([=[nc_test4_tst_quantize]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_h_transient_types]=] "/nc_test4_tst_h_transient_types")
+set_tests_properties([=[nc_test4_tst_h_transient_types]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_strided_write]=] "/nc_test4_tst_strided_write")
+set_tests_properties([=[nc_test4_tst_strided_write]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_varsperf]=] "/nc_test4_tst_varsperf")
+set_tests_properties([=[nc_test4_tst_varsperf]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_vlen_unlim]=] "/nc_test4_tst_vlen_unlim")
+set_tests_properties([=[nc_test4_tst_vlen_unlim]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_mem_safety]=] "/nc_test4_tst_mem_safety")
+set_tests_properties([=[nc_test4_tst_mem_safety]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_meta_block_size]=] "/nc_test4_tst_meta_block_size")
+set_tests_properties([=[nc_test4_tst_meta_block_size]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_xplatform]=] "/nc_test4_tst_xplatform")
+set_tests_properties([=[nc_test4_tst_xplatform]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_virtual_datasets]=] "/nc_test4_tst_virtual_datasets")
+set_tests_properties([=[nc_test4_tst_virtual_datasets]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_interops5]=] "/nc_test4_tst_interops5")
+set_tests_properties([=[nc_test4_tst_interops5]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test([=[nc_test4_tst_camrun]=] "/nc_test4_tst_camrun")
+set_tests_properties([=[nc_test4_tst_camrun]=] PROPERTIES  ENVIRONMENT "srcdir=/root/repo/nc_test4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nc_test4/CMakeLists.txt;160;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
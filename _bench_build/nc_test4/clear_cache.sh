@@ -0,0 +1,5 @@
+#!/bin/sh -x
+# Clear the disk caches.
+sync
+echo 3 > /proc/sys/vm/drop_caches
+
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ncdap_test_cvt.dir/test_cvt.c.o"
+  "CMakeFiles/ncdap_test_cvt.dir/test_cvt.c.o.d"
+  "ncdap_test_cvt"
+  "ncdap_test_cvt.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ncdap_test_cvt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
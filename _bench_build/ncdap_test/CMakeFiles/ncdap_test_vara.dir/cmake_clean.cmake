@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ncdap_test_vara.dir/test_vara.c.o"
+  "CMakeFiles/ncdap_test_vara.dir/test_vara.c.o.d"
+  "ncdap_test_vara"
+  "ncdap_test_vara.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ncdap_test_vara.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pingurl.dir/pingurl.c.o"
+  "CMakeFiles/pingurl.dir/pingurl.c.o.d"
+  "pingurl"
+  "pingurl.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/pingurl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/ncdap_test
+# Build directory: /root/repo/_bench_build/ncdap_test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[ncdap_tst_ncdap3]=] "bash" "-c" "export srcdir=/root/repo/ncdap_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdap_test/tst_ncdap3.sh ")
+set_tests_properties([=[ncdap_tst_ncdap3]=] PROPERTIES  RUN_SERIAL "TRUE" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdap_test/CMakeLists.txt;30;add_sh_test;/root/repo/ncdap_test/CMakeLists.txt;0;")
+add_test([=[ncdap_t_dap3a]=] "bash" "-c" "TOPSRCDIR=/root/repo/ncdap_test /root/repo/_bench_build/ncdap_test/ncdap_t_dap3a")
+set_tests_properties([=[ncdap_t_dap3a]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;135;add_test;/root/repo/ncdap_test/CMakeLists.txt;37;add_bin_env_test;/root/repo/ncdap_test/CMakeLists.txt;0;")
+add_test([=[ncdap_test_cvt]=] "bash" "-c" "TOPSRCDIR=/root/repo/ncdap_test /root/repo/_bench_build/ncdap_test/ncdap_test_cvt")
+set_tests_properties([=[ncdap_test_cvt]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;135;add_test;/root/repo/ncdap_test/CMakeLists.txt;38;add_bin_env_test;/root/repo/ncdap_test/CMakeLists.txt;0;")
+add_test([=[ncdap_test_vara]=] "bash" "-c" "TOPSRCDIR=/root/repo/ncdap_test /root/repo/_bench_build/ncdap_test/ncdap_test_vara")
+set_tests_properties([=[ncdap_test_vara]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;135;add_test;/root/repo/ncdap_test/CMakeLists.txt;39;add_bin_env_test;/root/repo/ncdap_test/CMakeLists.txt;0;")
+subdirs("testdata3")
+subdirs("expected3")
+subdirs("expectremote3")
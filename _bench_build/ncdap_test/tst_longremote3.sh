@@ -0,0 +1,4 @@
+#!/bin/sh
+
+export longtests=1
+bash ${srcdir}/tst_remote3.sh 
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/echon.dir/echon.c.o"
+  "CMakeFiles/echon.dir/echon.c.o.d"
+  "echon"
+  "echon.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/echon.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/ncdump/nc4print.c" "ncdump/CMakeFiles/nc4print.dir/nc4print.c.o" "gcc" "ncdump/CMakeFiles/nc4print.dir/nc4print.c.o.d"
+  "/root/repo/ncdump/nc4printer.c" "ncdump/CMakeFiles/nc4print.dir/nc4printer.c.o" "gcc" "ncdump/CMakeFiles/nc4print.dir/nc4printer.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/CMakeFiles/netcdf.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
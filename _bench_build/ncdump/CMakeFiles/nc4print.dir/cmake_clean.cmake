@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc4print.dir/nc4print.c.o"
+  "CMakeFiles/nc4print.dir/nc4print.c.o.d"
+  "CMakeFiles/nc4print.dir/nc4printer.c.o"
+  "CMakeFiles/nc4print.dir/nc4printer.c.o.d"
+  "nc4print"
+  "nc4print.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc4print.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
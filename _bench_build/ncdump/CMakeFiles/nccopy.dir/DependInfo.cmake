@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/ncdump/chunkspec.c" "ncdump/CMakeFiles/nccopy.dir/chunkspec.c.o" "gcc" "ncdump/CMakeFiles/nccopy.dir/chunkspec.c.o.d"
+  "/root/repo/ncdump/dimmap.c" "ncdump/CMakeFiles/nccopy.dir/dimmap.c.o" "gcc" "ncdump/CMakeFiles/nccopy.dir/dimmap.c.o.d"
+  "/root/repo/ncdump/list.c" "ncdump/CMakeFiles/nccopy.dir/list.c.o" "gcc" "ncdump/CMakeFiles/nccopy.dir/list.c.o.d"
+  "/root/repo/ncdump/nccopy.c" "ncdump/CMakeFiles/nccopy.dir/nccopy.c.o" "gcc" "ncdump/CMakeFiles/nccopy.dir/nccopy.c.o.d"
+  "/root/repo/ncdump/nciter.c" "ncdump/CMakeFiles/nccopy.dir/nciter.c.o" "gcc" "ncdump/CMakeFiles/nccopy.dir/nciter.c.o.d"
+  "/root/repo/ncdump/utils.c" "ncdump/CMakeFiles/nccopy.dir/utils.c.o" "gcc" "ncdump/CMakeFiles/nccopy.dir/utils.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/CMakeFiles/netcdf.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ncfilteravail.dir/ncfilteravail.c.o"
+  "CMakeFiles/ncfilteravail.dir/ncfilteravail.c.o.d"
+  "ncfilteravail"
+  "ncfilteravail.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ncfilteravail.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nchdf5version.dir/nchdf5version.c.o"
+  "CMakeFiles/nchdf5version.dir/nchdf5version.c.o.d"
+  "nchdf5version"
+  "nchdf5version.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nchdf5version.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
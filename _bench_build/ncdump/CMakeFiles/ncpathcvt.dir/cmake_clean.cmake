@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ncpathcvt.dir/ncpathcvt.c.o"
+  "CMakeFiles/ncpathcvt.dir/ncpathcvt.c.o.d"
+  "ncpathcvt"
+  "ncpathcvt.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ncpathcvt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/printfqn.dir/printfqn.c.o"
+  "CMakeFiles/printfqn.dir/printfqn.c.o.d"
+  "printfqn"
+  "printfqn.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/printfqn.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ref_ctest64.dir/ref_ctest64.c.o"
+  "CMakeFiles/ref_ctest64.dir/ref_ctest64.c.o.d"
+  "ref_ctest64"
+  "ref_ctest64.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ref_ctest64.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rewrite-scalar.dir/rewrite-scalar.c.o"
+  "CMakeFiles/rewrite-scalar.dir/rewrite-scalar.c.o.d"
+  "rewrite-scalar"
+  "rewrite-scalar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rewrite-scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
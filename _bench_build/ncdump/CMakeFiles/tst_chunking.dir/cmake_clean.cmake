@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_chunking.dir/tst_chunking.c.o"
+  "CMakeFiles/tst_chunking.dir/tst_chunking.c.o.d"
+  "tst_chunking"
+  "tst_chunking.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_chunking.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_compress.dir/tst_compress.c.o"
+  "CMakeFiles/tst_compress.dir/tst_compress.c.o.d"
+  "tst_compress"
+  "tst_compress.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_compress.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
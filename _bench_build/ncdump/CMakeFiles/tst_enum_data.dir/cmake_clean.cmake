@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_enum_data.dir/tst_enum_data.c.o"
+  "CMakeFiles/tst_enum_data.dir/tst_enum_data.c.o.d"
+  "tst_enum_data"
+  "tst_enum_data.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_enum_data.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_enum_undef.dir/tst_enum_undef.c.o"
+  "CMakeFiles/tst_enum_undef.dir/tst_enum_undef.c.o.d"
+  "tst_enum_undef"
+  "tst_enum_undef.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_enum_undef.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_fileinfo.dir/tst_fileinfo.c.o"
+  "CMakeFiles/tst_fileinfo.dir/tst_fileinfo.c.o.d"
+  "tst_fileinfo"
+  "tst_fileinfo.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_fileinfo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_fillbug.dir/tst_fillbug.c.o"
+  "CMakeFiles/tst_fillbug.dir/tst_fillbug.c.o.d"
+  "tst_fillbug"
+  "tst_fillbug.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_fillbug.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
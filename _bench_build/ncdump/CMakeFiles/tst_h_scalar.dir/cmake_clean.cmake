@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_h_scalar.dir/tst_h_scalar.c.o"
+  "CMakeFiles/tst_h_scalar.dir/tst_h_scalar.c.o.d"
+  "tst_h_scalar"
+  "tst_h_scalar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_h_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_opaque_data.dir/tst_opaque_data.c.o"
+  "CMakeFiles/tst_opaque_data.dir/tst_opaque_data.c.o.d"
+  "tst_opaque_data"
+  "tst_opaque_data.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_opaque_data.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_special_atts.dir/tst_special_atts.c.o"
+  "CMakeFiles/tst_special_atts.dir/tst_special_atts.c.o.d"
+  "tst_special_atts"
+  "tst_special_atts.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_special_atts.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
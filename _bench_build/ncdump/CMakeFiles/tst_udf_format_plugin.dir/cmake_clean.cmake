@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_udf_format_plugin.dir/tst_udf_format_plugin.c.o"
+  "CMakeFiles/tst_udf_format_plugin.dir/tst_udf_format_plugin.c.o.d"
+  "tst_udf_format_plugin.pdb"
+  "tst_udf_format_plugin.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_udf_format_plugin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
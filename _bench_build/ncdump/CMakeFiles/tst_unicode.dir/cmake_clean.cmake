@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_unicode.dir/tst_unicode.c.o"
+  "CMakeFiles/tst_unicode.dir/tst_unicode.c.o.d"
+  "tst_unicode"
+  "tst_unicode.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_unicode.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
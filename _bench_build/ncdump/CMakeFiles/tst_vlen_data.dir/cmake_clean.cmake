@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_vlen_data.dir/tst_vlen_data.c.o"
+  "CMakeFiles/tst_vlen_data.dir/tst_vlen_data.c.o.d"
+  "tst_vlen_data"
+  "tst_vlen_data.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_vlen_data.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
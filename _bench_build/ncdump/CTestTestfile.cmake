@@ -0,0 +1,96 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/ncdump
+# Build directory: /root/repo/_bench_build/ncdump
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[ref_ctest]=] "/ref_ctest")
+set_tests_properties([=[ref_ctest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;165;add_test;/root/repo/ncdump/CMakeLists.txt;235;add_bin_test_no_prefix;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ref_ctest64]=] "/ref_ctest64")
+set_tests_properties([=[ref_ctest64]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;165;add_test;/root/repo/ncdump/CMakeLists.txt;236;add_bin_test_no_prefix;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_run_tests]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/run_tests.sh ")
+set_tests_properties([=[ncdump_run_tests]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;238;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_tst_64bit]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/tst_64bit.sh ")
+set_tests_properties([=[ncdump_tst_64bit]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;239;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_tst_lengths]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/tst_lengths.sh ")
+set_tests_properties([=[ncdump_tst_lengths]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;240;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_tst_calendars]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/tst_calendars.sh ")
+set_tests_properties([=[ncdump_tst_calendars]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;241;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_run_utf8_tests]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/run_utf8_tests.sh ")
+set_tests_properties([=[ncdump_run_utf8_tests]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;242;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_tst_nccopy3_subset]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/tst_nccopy3_subset.sh ")
+set_tests_properties([=[ncdump_tst_nccopy3_subset]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;244;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_tst_charfill]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/tst_charfill.sh ")
+set_tests_properties([=[ncdump_tst_charfill]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;245;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_tst_formatx3]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/tst_formatx3.sh ")
+set_tests_properties([=[ncdump_tst_formatx3]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;246;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_tst_bom]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/tst_bom.sh ")
+set_tests_properties([=[ncdump_tst_bom]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;247;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_tst_dimsizes]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/tst_dimsizes.sh ")
+set_tests_properties([=[ncdump_tst_dimsizes]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;248;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_tst_inmemory_nc3]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/tst_inmemory_nc3.sh ")
+set_tests_properties([=[ncdump_tst_inmemory_nc3]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;249;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_tst_nccopy_w3]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/tst_nccopy_w3.sh ")
+set_tests_properties([=[ncdump_tst_nccopy_w3]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;250;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_run_ncgen_tests]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/run_ncgen_tests.sh ")
+set_tests_properties([=[ncdump_run_ncgen_tests]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;251;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_tst_inttags]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/tst_inttags.sh ")
+set_tests_properties([=[ncdump_tst_inttags]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;252;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_test_radix]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/test_radix.sh ")
+set_tests_properties([=[ncdump_test_radix]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;253;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_tst_ctests]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/tst_ctests.sh ")
+set_tests_properties([=[ncdump_tst_ctests]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;254;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_tst_null_byte_padding]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/tst_null_byte_padding.sh ")
+set_tests_properties([=[ncdump_tst_null_byte_padding]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;256;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_tst_output]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/tst_output.sh ")
+set_tests_properties([=[ncdump_tst_output]=] PROPERTIES  DEPENDS "ref_ctest;ref_ctest64" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;262;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_tst_nccopy3]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/tst_nccopy3.sh ")
+set_tests_properties([=[ncdump_tst_nccopy3]=] PROPERTIES  DEPENDS "ncdump_tst_calendars;ncdump_run_utf8_tests;ncdump_tst_output;ncdump_tst_64bit;ncdump_run_tests;ncdump_tst_lengths" RUN_SERIAL "TRUE" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;264;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_tst_netcdf4]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/tst_netcdf4.sh ")
+set_tests_properties([=[ncdump_tst_netcdf4]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;268;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_tst_formatx4]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/tst_formatx4.sh ")
+set_tests_properties([=[ncdump_tst_formatx4]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;278;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_tst_udf_format]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/tst_udf_format.sh ")
+set_tests_properties([=[ncdump_tst_udf_format]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;280;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_sh_tst_fillbug]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/tst_fillbug.sh ")
+set_tests_properties([=[ncdump_sh_tst_fillbug]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;282;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_shell_tst_h_scalar]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/tst_h_scalar.sh ")
+set_tests_properties([=[ncdump_shell_tst_h_scalar]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;283;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_tst_mud]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/tst_mud.sh ")
+set_tests_properties([=[ncdump_tst_mud]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;284;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_tst_grp_spec]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/tst_grp_spec.sh ")
+set_tests_properties([=[ncdump_tst_grp_spec]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;285;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_tst_inttags4]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/tst_inttags4.sh ")
+set_tests_properties([=[ncdump_tst_inttags4]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;286;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_run_utf8_nc4_tests]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/run_utf8_nc4_tests.sh ")
+set_tests_properties([=[ncdump_run_utf8_nc4_tests]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;287;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_tst_fileinfo]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/tst_fileinfo.sh ")
+set_tests_properties([=[ncdump_tst_fileinfo]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;288;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_tst_hdf5_offset]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/tst_hdf5_offset.sh ")
+set_tests_properties([=[ncdump_tst_hdf5_offset]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;289;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_tst_inmemory_nc4]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/tst_inmemory_nc4.sh ")
+set_tests_properties([=[ncdump_tst_inmemory_nc4]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;290;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_tst_nccopy_w4]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/tst_nccopy_w4.sh ")
+set_tests_properties([=[ncdump_tst_nccopy_w4]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;291;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_run_ncgen_nc4_tests]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/run_ncgen_nc4_tests.sh ")
+set_tests_properties([=[ncdump_run_ncgen_nc4_tests]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;292;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_tst_ncgen4]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/tst_ncgen4.sh ")
+set_tests_properties([=[ncdump_tst_ncgen4]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;293;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_tst_netcdf4_4]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/tst_netcdf4_4.sh ")
+set_tests_properties([=[ncdump_tst_netcdf4_4]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;294;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_tst_nccopy4]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/tst_nccopy4.sh ")
+set_tests_properties([=[ncdump_tst_nccopy4]=] PROPERTIES  DEPENDS "ncdump_ncgen_tests;ncdump_tst_ncgen4;ncdump_tst_fillbug;ncdump_tst_netcdf4_4;ncdump_tst_h_scalar;ncdump_tst_netcdf4;ncdump_run_ncgen_tests;ncdump_tst_output;ncdump_tst_ncgen4;ncdump_sh_tst_fillbug;tst_comp;tst_comp2;tst_nans;tst_opaque_data;tst_create_files;tst_special_atts;ncdump_tst_nccopy3" RUN_SERIAL "TRUE" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;295;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_tst_calendars_nc4]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/tst_calendars_nc4.sh ")
+set_tests_properties([=[ncdump_tst_calendars_nc4]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;299;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_tst_nccopy5]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/tst_nccopy5.sh ")
+set_tests_properties([=[ncdump_tst_nccopy5]=] PROPERTIES  DEPENDS "ncdump_tst_nccopy4" _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;300;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_test_unicode_directory]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/test_unicode_directory.sh ")
+set_tests_properties([=[ncdump_test_unicode_directory]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;328;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_test_unicode_path]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/test_unicode_path.sh ")
+set_tests_properties([=[ncdump_test_unicode_path]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;329;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_test_keywords]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/test_keywords.sh ")
+set_tests_properties([=[ncdump_test_keywords]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;333;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test([=[ncdump_test_scope]=] "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/ncdump/test_scope.sh ")
+set_tests_properties([=[ncdump_test_scope]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/ncdump/CMakeLists.txt;337;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+subdirs("cdl")
+subdirs("expected")
@@ -0,0 +1,43 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/ncgen/bindata.c" "ncgen/CMakeFiles/ncgen.dir/bindata.c.o" "gcc" "ncgen/CMakeFiles/ncgen.dir/bindata.c.o.d"
+  "/root/repo/ncgen/bytebuffer.c" "ncgen/CMakeFiles/ncgen.dir/bytebuffer.c.o" "gcc" "ncgen/CMakeFiles/ncgen.dir/bytebuffer.c.o.d"
+  "/root/repo/ncgen/cdata.c" "ncgen/CMakeFiles/ncgen.dir/cdata.c.o" "gcc" "ncgen/CMakeFiles/ncgen.dir/cdata.c.o.d"
+  "/root/repo/ncgen/cvt.c" "ncgen/CMakeFiles/ncgen.dir/cvt.c.o" "gcc" "ncgen/CMakeFiles/ncgen.dir/cvt.c.o.d"
+  "/root/repo/ncgen/data.c" "ncgen/CMakeFiles/ncgen.dir/data.c.o" "gcc" "ncgen/CMakeFiles/ncgen.dir/data.c.o.d"
+  "/root/repo/ncgen/debug.c" "ncgen/CMakeFiles/ncgen.dir/debug.c.o" "gcc" "ncgen/CMakeFiles/ncgen.dir/debug.c.o.d"
+  "/root/repo/ncgen/dump.c" "ncgen/CMakeFiles/ncgen.dir/dump.c.o" "gcc" "ncgen/CMakeFiles/ncgen.dir/dump.c.o.d"
+  "/root/repo/ncgen/escapes.c" "ncgen/CMakeFiles/ncgen.dir/escapes.c.o" "gcc" "ncgen/CMakeFiles/ncgen.dir/escapes.c.o.d"
+  "/root/repo/ncgen/f77data.c" "ncgen/CMakeFiles/ncgen.dir/f77data.c.o" "gcc" "ncgen/CMakeFiles/ncgen.dir/f77data.c.o.d"
+  "/root/repo/ncgen/genbin.c" "ncgen/CMakeFiles/ncgen.dir/genbin.c.o" "gcc" "ncgen/CMakeFiles/ncgen.dir/genbin.c.o.d"
+  "/root/repo/ncgen/genc.c" "ncgen/CMakeFiles/ncgen.dir/genc.c.o" "gcc" "ncgen/CMakeFiles/ncgen.dir/genc.c.o.d"
+  "/root/repo/ncgen/genchar.c" "ncgen/CMakeFiles/ncgen.dir/genchar.c.o" "gcc" "ncgen/CMakeFiles/ncgen.dir/genchar.c.o.d"
+  "/root/repo/ncgen/generate.c" "ncgen/CMakeFiles/ncgen.dir/generate.c.o" "gcc" "ncgen/CMakeFiles/ncgen.dir/generate.c.o.d"
+  "/root/repo/ncgen/generr.c" "ncgen/CMakeFiles/ncgen.dir/generr.c.o" "gcc" "ncgen/CMakeFiles/ncgen.dir/generr.c.o.d"
+  "/root/repo/ncgen/genf77.c" "ncgen/CMakeFiles/ncgen.dir/genf77.c.o" "gcc" "ncgen/CMakeFiles/ncgen.dir/genf77.c.o.d"
+  "/root/repo/ncgen/genj.c" "ncgen/CMakeFiles/ncgen.dir/genj.c.o" "gcc" "ncgen/CMakeFiles/ncgen.dir/genj.c.o.d"
+  "/root/repo/ncgen/genlib.c" "ncgen/CMakeFiles/ncgen.dir/genlib.c.o" "gcc" "ncgen/CMakeFiles/ncgen.dir/genlib.c.o.d"
+  "/root/repo/ncgen/getfill.c" "ncgen/CMakeFiles/ncgen.dir/getfill.c.o" "gcc" "ncgen/CMakeFiles/ncgen.dir/getfill.c.o.d"
+  "/root/repo/ncgen/jdata.c" "ncgen/CMakeFiles/ncgen.dir/jdata.c.o" "gcc" "ncgen/CMakeFiles/ncgen.dir/jdata.c.o.d"
+  "/root/repo/ncgen/list.c" "ncgen/CMakeFiles/ncgen.dir/list.c.o" "gcc" "ncgen/CMakeFiles/ncgen.dir/list.c.o.d"
+  "/root/repo/ncgen/main.c" "ncgen/CMakeFiles/ncgen.dir/main.c.o" "gcc" "ncgen/CMakeFiles/ncgen.dir/main.c.o.d"
+  "/root/repo/ncgen/ncgeny.c" "ncgen/CMakeFiles/ncgen.dir/ncgeny.c.o" "gcc" "ncgen/CMakeFiles/ncgen.dir/ncgeny.c.o.d"
+  "/root/repo/ncgen/semantics.c" "ncgen/CMakeFiles/ncgen.dir/semantics.c.o" "gcc" "ncgen/CMakeFiles/ncgen.dir/semantics.c.o.d"
+  "/root/repo/ncgen/util.c" "ncgen/CMakeFiles/ncgen.dir/util.c.o" "gcc" "ncgen/CMakeFiles/ncgen.dir/util.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/CMakeFiles/netcdf.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,62 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ncgen.dir/bindata.c.o"
+  "CMakeFiles/ncgen.dir/bindata.c.o.d"
+  "CMakeFiles/ncgen.dir/bytebuffer.c.o"
+  "CMakeFiles/ncgen.dir/bytebuffer.c.o.d"
+  "CMakeFiles/ncgen.dir/cdata.c.o"
+  "CMakeFiles/ncgen.dir/cdata.c.o.d"
+  "CMakeFiles/ncgen.dir/cvt.c.o"
+  "CMakeFiles/ncgen.dir/cvt.c.o.d"
+  "CMakeFiles/ncgen.dir/data.c.o"
+  "CMakeFiles/ncgen.dir/data.c.o.d"
+  "CMakeFiles/ncgen.dir/debug.c.o"
+  "CMakeFiles/ncgen.dir/debug.c.o.d"
+  "CMakeFiles/ncgen.dir/dump.c.o"
+  "CMakeFiles/ncgen.dir/dump.c.o.d"
+  "CMakeFiles/ncgen.dir/escapes.c.o"
+  "CMakeFiles/ncgen.dir/escapes.c.o.d"
+  "CMakeFiles/ncgen.dir/f77data.c.o"
+  "CMakeFiles/ncgen.dir/f77data.c.o.d"
+  "CMakeFiles/ncgen.dir/genbin.c.o"
+  "CMakeFiles/ncgen.dir/genbin.c.o.d"
+  "CMakeFiles/ncgen.dir/genc.c.o"
+  "CMakeFiles/ncgen.dir/genc.c.o.d"
+  "CMakeFiles/ncgen.dir/genchar.c.o"
+  "CMakeFiles/ncgen.dir/genchar.c.o.d"
+  "CMakeFiles/ncgen.dir/generate.c.o"
+  "CMakeFiles/ncgen.dir/generate.c.o.d"
+  "CMakeFiles/ncgen.dir/generr.c.o"
+  "CMakeFiles/ncgen.dir/generr.c.o.d"
+  "CMakeFiles/ncgen.dir/genf77.c.o"
+  "CMakeFiles/ncgen.dir/genf77.c.o.d"
+  "CMakeFiles/ncgen.dir/genj.c.o"
+  "CMakeFiles/ncgen.dir/genj.c.o.d"
+  "CMakeFiles/ncgen.dir/genlib.c.o"
+  "CMakeFiles/ncgen.dir/genlib.c.o.d"
+  "CMakeFiles/ncgen.dir/getfill.c.o"
+  "CMakeFiles/ncgen.dir/getfill.c.o.d"
+  "CMakeFiles/ncgen.dir/jdata.c.o"
+  "CMakeFiles/ncgen.dir/jdata.c.o.d"
+  "CMakeFiles/ncgen.dir/list.c.o"
+  "CMakeFiles/ncgen.dir/list.c.o.d"
+  "CMakeFiles/ncgen.dir/main.c.o"
+  "CMakeFiles/ncgen.dir/main.c.o.d"
+  "CMakeFiles/ncgen.dir/ncgeny.c.o"
+  "CMakeFiles/ncgen.dir/ncgeny.c.o.d"
+  "CMakeFiles/ncgen.dir/semantics.c.o"
+  "CMakeFiles/ncgen.dir/semantics.c.o.d"
+  "CMakeFiles/ncgen.dir/util.c.o"
+  "CMakeFiles/ncgen.dir/util.c.o.d"
+  "c0.nc"
+  "c0_4.nc"
+  "c0_4c.nc"
+  "c0_64.nc"
+  "ncgen"
+  "ncgen.pdb"
+  "ref_camrun.c"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ncgen.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/ncgen3/escapes.c" "ncgen3/CMakeFiles/ncgen3.dir/escapes.c.o" "gcc" "ncgen3/CMakeFiles/ncgen3.dir/escapes.c.o.d"
+  "/root/repo/ncgen3/genlib.c" "ncgen3/CMakeFiles/ncgen3.dir/genlib.c.o" "gcc" "ncgen3/CMakeFiles/ncgen3.dir/genlib.c.o.d"
+  "/root/repo/ncgen3/getfill.c" "ncgen3/CMakeFiles/ncgen3.dir/getfill.c.o" "gcc" "ncgen3/CMakeFiles/ncgen3.dir/getfill.c.o.d"
+  "/root/repo/ncgen3/init.c" "ncgen3/CMakeFiles/ncgen3.dir/init.c.o" "gcc" "ncgen3/CMakeFiles/ncgen3.dir/init.c.o.d"
+  "/root/repo/ncgen3/load.c" "ncgen3/CMakeFiles/ncgen3.dir/load.c.o" "gcc" "ncgen3/CMakeFiles/ncgen3.dir/load.c.o.d"
+  "/root/repo/ncgen3/main.c" "ncgen3/CMakeFiles/ncgen3.dir/main.c.o" "gcc" "ncgen3/CMakeFiles/ncgen3.dir/main.c.o.d"
+  "/root/repo/ncgen3/ncgeny.c" "ncgen3/CMakeFiles/ncgen3.dir/ncgeny.c.o" "gcc" "ncgen3/CMakeFiles/ncgen3.dir/ncgeny.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/CMakeFiles/netcdf.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,47 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nctest.dir/add.c.o"
+  "CMakeFiles/nctest.dir/add.c.o.d"
+  "CMakeFiles/nctest.dir/atttests.c.o"
+  "CMakeFiles/nctest.dir/atttests.c.o.d"
+  "CMakeFiles/nctest.dir/cdftests.c.o"
+  "CMakeFiles/nctest.dir/cdftests.c.o.d"
+  "CMakeFiles/nctest.dir/dimtests.c.o"
+  "CMakeFiles/nctest.dir/dimtests.c.o.d"
+  "CMakeFiles/nctest.dir/driver.c.o"
+  "CMakeFiles/nctest.dir/driver.c.o.d"
+  "CMakeFiles/nctest.dir/emalloc.c.o"
+  "CMakeFiles/nctest.dir/emalloc.c.o.d"
+  "CMakeFiles/nctest.dir/error.c.o"
+  "CMakeFiles/nctest.dir/error.c.o.d"
+  "CMakeFiles/nctest.dir/misctest.c.o"
+  "CMakeFiles/nctest.dir/misctest.c.o.d"
+  "CMakeFiles/nctest.dir/rec.c.o"
+  "CMakeFiles/nctest.dir/rec.c.o.d"
+  "CMakeFiles/nctest.dir/slabs.c.o"
+  "CMakeFiles/nctest.dir/slabs.c.o.d"
+  "CMakeFiles/nctest.dir/val.c.o"
+  "CMakeFiles/nctest.dir/val.c.o.d"
+  "CMakeFiles/nctest.dir/vardef.c.o"
+  "CMakeFiles/nctest.dir/vardef.c.o.d"
+  "CMakeFiles/nctest.dir/varget.c.o"
+  "CMakeFiles/nctest.dir/varget.c.o.d"
+  "CMakeFiles/nctest.dir/vargetg.c.o"
+  "CMakeFiles/nctest.dir/vargetg.c.o.d"
+  "CMakeFiles/nctest.dir/varput.c.o"
+  "CMakeFiles/nctest.dir/varput.c.o.d"
+  "CMakeFiles/nctest.dir/varputg.c.o"
+  "CMakeFiles/nctest.dir/varputg.c.o.d"
+  "CMakeFiles/nctest.dir/vartests.c.o"
+  "CMakeFiles/nctest.dir/vartests.c.o.d"
+  "CMakeFiles/nctest.dir/vputget.c.o"
+  "CMakeFiles/nctest.dir/vputget.c.o.d"
+  "CMakeFiles/nctest.dir/vputgetg.c.o"
+  "CMakeFiles/nctest.dir/vputgetg.c.o.d"
+  "nctest"
+  "nctest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nctest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
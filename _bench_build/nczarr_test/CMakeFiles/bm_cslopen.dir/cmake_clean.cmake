@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bm_cslopen.dir/bm_cslopen.c.o"
+  "CMakeFiles/bm_cslopen.dir/bm_cslopen.c.o.d"
+  "CMakeFiles/bm_cslopen.dir/timer_utils.c.o"
+  "CMakeFiles/bm_cslopen.dir/timer_utils.c.o.d"
+  "bm_cslopen"
+  "bm_cslopen.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/bm_cslopen.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
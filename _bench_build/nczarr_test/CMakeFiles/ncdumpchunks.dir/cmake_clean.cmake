@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ncdumpchunks.dir/ncdumpchunks.c.o"
+  "CMakeFiles/ncdumpchunks.dir/ncdumpchunks.c.o.d"
+  "ncdumpchunks"
+  "ncdumpchunks.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ncdumpchunks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
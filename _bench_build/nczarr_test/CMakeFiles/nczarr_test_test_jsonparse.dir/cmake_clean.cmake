@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nczarr_test_test_jsonparse.dir/test_jsonparse.c.o"
+  "CMakeFiles/nczarr_test_test_jsonparse.dir/test_jsonparse.c.o.d"
+  "nczarr_test_test_jsonparse"
+  "nczarr_test_test_jsonparse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nczarr_test_test_jsonparse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
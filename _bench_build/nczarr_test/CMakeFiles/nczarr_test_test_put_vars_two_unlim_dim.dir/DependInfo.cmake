@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_bench_build/nczarr_test/test_put_vars_two_unlim_dim.c" "nczarr_test/CMakeFiles/nczarr_test_test_put_vars_two_unlim_dim.dir/test_put_vars_two_unlim_dim.c.o" "gcc" "nczarr_test/CMakeFiles/nczarr_test_test_put_vars_two_unlim_dim.dir/test_put_vars_two_unlim_dim.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/nczarr_test/CMakeFiles/test_utils.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/CMakeFiles/netcdf.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
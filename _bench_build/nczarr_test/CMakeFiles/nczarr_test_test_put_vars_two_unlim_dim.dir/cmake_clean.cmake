@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nczarr_test_test_put_vars_two_unlim_dim.dir/test_put_vars_two_unlim_dim.c.o"
+  "CMakeFiles/nczarr_test_test_put_vars_two_unlim_dim.dir/test_put_vars_two_unlim_dim.c.o.d"
+  "nczarr_test_test_put_vars_two_unlim_dim"
+  "nczarr_test_test_put_vars_two_unlim_dim.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nczarr_test_test_put_vars_two_unlim_dim.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nczarr_test_test_unlim_vars.dir/test_unlim_vars.c.o"
+  "CMakeFiles/nczarr_test_test_unlim_vars.dir/test_unlim_vars.c.o.d"
+  "nczarr_test_test_unlim_vars"
+  "nczarr_test_test_unlim_vars.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nczarr_test_test_unlim_vars.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nczarr_test_test_zarrv3.dir/test_zarrv3.c.o"
+  "CMakeFiles/nczarr_test_test_zarrv3.dir/test_zarrv3.c.o.d"
+  "nczarr_test_test_zarrv3"
+  "nczarr_test_test_zarrv3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nczarr_test_test_zarrv3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
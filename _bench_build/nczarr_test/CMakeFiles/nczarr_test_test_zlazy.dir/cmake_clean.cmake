@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nczarr_test_test_zlazy.dir/test_zlazy.c.o"
+  "CMakeFiles/nczarr_test_test_zlazy.dir/test_zlazy.c.o.d"
+  "nczarr_test_test_zlazy"
+  "nczarr_test_test_zlazy.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nczarr_test_test_zlazy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
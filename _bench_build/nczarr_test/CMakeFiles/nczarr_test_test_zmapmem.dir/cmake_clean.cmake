@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nczarr_test_test_zmapmem.dir/test_zmapmem.c.o"
+  "CMakeFiles/nczarr_test_test_zmapmem.dir/test_zmapmem.c.o.d"
+  "nczarr_test_test_zmapmem"
+  "nczarr_test_test_zmapmem.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nczarr_test_test_zmapmem.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nczarr_test_test_zshard.dir/test_zshard.c.o"
+  "CMakeFiles/nczarr_test_test_zshard.dir/test_zshard.c.o.d"
+  "nczarr_test_test_zshard"
+  "nczarr_test_test_zshard.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nczarr_test_test_zshard.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libnczarr/zinfer.c" "nczarr_test/CMakeFiles/nczarr_test_ut_zinfer.dir/__/libnczarr/zinfer.c.o" "gcc" "nczarr_test/CMakeFiles/nczarr_test_ut_zinfer.dir/__/libnczarr/zinfer.c.o.d"
+  "/root/repo/libnczarr/zmetadata.c" "nczarr_test/CMakeFiles/nczarr_test_ut_zinfer.dir/__/libnczarr/zmetadata.c.o" "gcc" "nczarr_test/CMakeFiles/nczarr_test_ut_zinfer.dir/__/libnczarr/zmetadata.c.o.d"
+  "/root/repo/libnczarr/zmetadata2.c" "nczarr_test/CMakeFiles/nczarr_test_ut_zinfer.dir/__/libnczarr/zmetadata2.c.o" "gcc" "nczarr_test/CMakeFiles/nczarr_test_ut_zinfer.dir/__/libnczarr/zmetadata2.c.o.d"
+  "/root/repo/libnczarr/zmetadata3.c" "nczarr_test/CMakeFiles/nczarr_test_ut_zinfer.dir/__/libnczarr/zmetadata3.c.o" "gcc" "nczarr_test/CMakeFiles/nczarr_test_ut_zinfer.dir/__/libnczarr/zmetadata3.c.o.d"
+  "/root/repo/nczarr_test/ut_zinfer.c" "nczarr_test/CMakeFiles/nczarr_test_ut_zinfer.dir/ut_zinfer.c.o" "gcc" "nczarr_test/CMakeFiles/nczarr_test_ut_zinfer.dir/ut_zinfer.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/nczarr_test/CMakeFiles/ut_util.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/CMakeFiles/netcdf.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
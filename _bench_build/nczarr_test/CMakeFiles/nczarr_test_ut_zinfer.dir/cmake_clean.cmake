@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nczarr_test_ut_zinfer.dir/__/libnczarr/zinfer.c.o"
+  "CMakeFiles/nczarr_test_ut_zinfer.dir/__/libnczarr/zinfer.c.o.d"
+  "CMakeFiles/nczarr_test_ut_zinfer.dir/__/libnczarr/zmetadata.c.o"
+  "CMakeFiles/nczarr_test_ut_zinfer.dir/__/libnczarr/zmetadata.c.o.d"
+  "CMakeFiles/nczarr_test_ut_zinfer.dir/__/libnczarr/zmetadata2.c.o"
+  "CMakeFiles/nczarr_test_ut_zinfer.dir/__/libnczarr/zmetadata2.c.o.d"
+  "CMakeFiles/nczarr_test_ut_zinfer.dir/__/libnczarr/zmetadata3.c.o"
+  "CMakeFiles/nczarr_test_ut_zinfer.dir/__/libnczarr/zmetadata3.c.o.d"
+  "CMakeFiles/nczarr_test_ut_zinfer.dir/ut_zinfer.c.o"
+  "CMakeFiles/nczarr_test_ut_zinfer.dir/ut_zinfer.c.o.d"
+  "nczarr_test_ut_zinfer"
+  "nczarr_test_ut_zinfer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nczarr_test_ut_zinfer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
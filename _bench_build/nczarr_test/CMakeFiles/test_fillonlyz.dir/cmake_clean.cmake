@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_fillonlyz.dir/test_fillonlyz.c.o"
+  "CMakeFiles/test_fillonlyz.dir/test_fillonlyz.c.o.d"
+  "test_fillonlyz"
+  "test_fillonlyz.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_fillonlyz.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_filter_vlen.dir/test_filter_vlen.c.o"
+  "CMakeFiles/test_filter_vlen.dir/test_filter_vlen.c.o.d"
+  "test_filter_vlen"
+  "test_filter_vlen.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_filter_vlen.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
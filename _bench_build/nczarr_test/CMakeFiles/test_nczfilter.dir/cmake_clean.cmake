@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_nczfilter.dir/test_nczfilter.c.o"
+  "CMakeFiles/test_nczfilter.dir/test_nczfilter.c.o.d"
+  "test_nczfilter"
+  "test_nczfilter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_nczfilter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
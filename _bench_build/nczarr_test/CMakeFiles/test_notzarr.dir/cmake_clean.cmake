@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_notzarr.dir/test_notzarr.c.o"
+  "CMakeFiles/test_notzarr.dir/test_notzarr.c.o.d"
+  "test_notzarr"
+  "test_notzarr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_notzarr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_quantize.dir/test_quantize.c.o"
+  "CMakeFiles/test_quantize.dir/test_quantize.c.o.d"
+  "test_quantize"
+  "test_quantize.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_quantize.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
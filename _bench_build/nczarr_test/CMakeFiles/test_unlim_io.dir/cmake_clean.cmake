@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_unlim_io.dir/test_unlim_io.c.o"
+  "CMakeFiles/test_unlim_io.dir/test_unlim_io.c.o.d"
+  "test_unlim_io"
+  "test_unlim_io.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_unlim_io.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_zchunks.dir/test_zchunks.c.o"
+  "CMakeFiles/test_zchunks.dir/test_zchunks.c.o.d"
+  "test_zchunks"
+  "test_zchunks.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_zchunks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
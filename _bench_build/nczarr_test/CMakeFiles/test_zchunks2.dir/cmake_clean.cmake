@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_zchunks2.dir/test_zchunks2.c.o"
+  "CMakeFiles/test_zchunks2.dir/test_zchunks2.c.o.d"
+  "test_zchunks2"
+  "test_zchunks2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_zchunks2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_zchunks3.dir/test_zchunks3.c.o"
+  "CMakeFiles/test_zchunks3.dir/test_zchunks3.c.o.d"
+  "test_zchunks3"
+  "test_zchunks3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_zchunks3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testfilter.dir/testfilter.c.o"
+  "CMakeFiles/testfilter.dir/testfilter.c.o.d"
+  "testfilter"
+  "testfilter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/testfilter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testfilter_misc.dir/testfilter_misc.c.o"
+  "CMakeFiles/testfilter_misc.dir/testfilter_misc.c.o.d"
+  "testfilter_misc"
+  "testfilter_misc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/testfilter_misc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
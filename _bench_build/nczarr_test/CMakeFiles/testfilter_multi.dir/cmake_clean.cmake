@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testfilter_multi.dir/testfilter_multi.c.o"
+  "CMakeFiles/testfilter_multi.dir/testfilter_multi.c.o.d"
+  "testfilter_multi"
+  "testfilter_multi.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/testfilter_multi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
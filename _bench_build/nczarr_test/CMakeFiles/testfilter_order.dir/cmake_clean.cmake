@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testfilter_order.dir/testfilter_order.c.o"
+  "CMakeFiles/testfilter_order.dir/testfilter_order.c.o.d"
+  "testfilter_order"
+  "testfilter_order.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/testfilter_order.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
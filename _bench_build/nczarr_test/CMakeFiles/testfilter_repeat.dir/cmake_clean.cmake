@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testfilter_repeat.dir/testfilter_repeat.c.o"
+  "CMakeFiles/testfilter_repeat.dir/testfilter_repeat.c.o.d"
+  "testfilter_repeat"
+  "testfilter_repeat.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/testfilter_repeat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
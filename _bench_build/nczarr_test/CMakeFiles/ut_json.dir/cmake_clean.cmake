@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut_json.dir/ut_json.c.o"
+  "CMakeFiles/ut_json.dir/ut_json.c.o.d"
+  "ut_json"
+  "ut_json.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut_json.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
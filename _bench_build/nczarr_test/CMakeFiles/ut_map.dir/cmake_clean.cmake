@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut_map.dir/ut_map.c.o"
+  "CMakeFiles/ut_map.dir/ut_map.c.o.d"
+  "ut_map"
+  "ut_map.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut_map.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
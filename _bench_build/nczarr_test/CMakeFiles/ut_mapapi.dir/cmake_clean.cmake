@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut_mapapi.dir/ut_mapapi.c.o"
+  "CMakeFiles/ut_mapapi.dir/ut_mapapi.c.o.d"
+  "ut_mapapi"
+  "ut_mapapi.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut_mapapi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut_util.dir/ut_test.c.o"
+  "CMakeFiles/ut_util.dir/ut_test.c.o.d"
+  "CMakeFiles/ut_util.dir/ut_util.c.o"
+  "CMakeFiles/ut_util.dir/ut_util.c.o.d"
+  "libut_util.a"
+  "libut_util.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ut_util.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
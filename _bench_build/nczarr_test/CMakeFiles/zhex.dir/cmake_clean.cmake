@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zhex.dir/zhex.c.o"
+  "CMakeFiles/zhex.dir/zhex.c.o.d"
+  "zhex"
+  "zhex.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/zhex.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zisjson.dir/zisjson.c.o"
+  "CMakeFiles/zisjson.dir/zisjson.c.o.d"
+  "zisjson"
+  "zisjson.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/zisjson.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
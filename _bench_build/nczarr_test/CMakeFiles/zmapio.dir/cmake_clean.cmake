@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zmapio.dir/zmapio.c.o"
+  "CMakeFiles/zmapio.dir/zmapio.c.o.d"
+  "zmapio"
+  "zmapio.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/zmapio.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zs3parse.dir/zs3parse.c.o"
+  "CMakeFiles/zs3parse.dir/zs3parse.c.o.d"
+  "zs3parse"
+  "zs3parse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/zs3parse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,80 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/nczarr_test
+# Build directory: /root/repo/_bench_build/nczarr_test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[nczarr_test_ut_zinfer]=] "/nczarr_test_ut_zinfer")
+set_tests_properties([=[nczarr_test_ut_zinfer]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nczarr_test/CMakeLists.txt;88;add_bin_test;/root/repo/nczarr_test/CMakeLists.txt;105;add_bin_test_with_util_lib;/root/repo/nczarr_test/CMakeLists.txt;0;")
+add_test([=[nczarr_test_test_zmapmem]=] "/nczarr_test_test_zmapmem")
+set_tests_properties([=[nczarr_test_test_zmapmem]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nczarr_test/CMakeLists.txt;88;add_bin_test;/root/repo/nczarr_test/CMakeLists.txt;110;add_bin_test_with_util_lib;/root/repo/nczarr_test/CMakeLists.txt;0;")
+add_test([=[nczarr_test_test_zshard]=] "/nczarr_test_test_zshard")
+set_tests_properties([=[nczarr_test_test_zshard]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nczarr_test/CMakeLists.txt;88;add_bin_test;/root/repo/nczarr_test/CMakeLists.txt;111;add_bin_test_with_util_lib;/root/repo/nczarr_test/CMakeLists.txt;0;")
+add_test([=[nczarr_test_test_zarrv3]=] "/nczarr_test_test_zarrv3")
+set_tests_properties([=[nczarr_test_test_zarrv3]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nczarr_test/CMakeLists.txt;88;add_bin_test;/root/repo/nczarr_test/CMakeLists.txt;112;add_bin_test_with_util_lib;/root/repo/nczarr_test/CMakeLists.txt;0;")
+add_test([=[nczarr_test_test_zlazy]=] "/nczarr_test_test_zlazy")
+set_tests_properties([=[nczarr_test_test_zlazy]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nczarr_test/CMakeLists.txt;88;add_bin_test;/root/repo/nczarr_test/CMakeLists.txt;113;add_bin_test_with_util_lib;/root/repo/nczarr_test/CMakeLists.txt;0;")
+add_test([=[nczarr_test_test_jsonparse]=] "/nczarr_test_test_jsonparse")
+set_tests_properties([=[nczarr_test_test_jsonparse]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nczarr_test/CMakeLists.txt;88;add_bin_test;/root/repo/nczarr_test/CMakeLists.txt;114;add_bin_test_with_util_lib;/root/repo/nczarr_test/CMakeLists.txt;0;")
+add_test([=[nczarr_test_test_unlim_vars]=] "/nczarr_test_test_unlim_vars")
+set_tests_properties([=[nczarr_test_test_unlim_vars]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nczarr_test/CMakeLists.txt;88;add_bin_test;/root/repo/nczarr_test/CMakeLists.txt;126;add_bin_test_with_util_lib;/root/repo/nczarr_test/CMakeLists.txt;0;")
+add_test([=[nczarr_test_test_put_vars_two_unlim_dim]=] "/nczarr_test_test_put_vars_two_unlim_dim")
+set_tests_properties([=[nczarr_test_test_put_vars_two_unlim_dim]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/nczarr_test/CMakeLists.txt;88;add_bin_test;/root/repo/nczarr_test/CMakeLists.txt;127;add_bin_test_with_util_lib;/root/repo/nczarr_test/CMakeLists.txt;0;")
+add_test([=[nczarr_test_run_ut_map]=] "bash" "-c" "export srcdir=/root/repo/nczarr_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nczarr_test/run_ut_map.sh ")
+set_tests_properties([=[nczarr_test_run_ut_map]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nczarr_test/CMakeLists.txt;185;add_sh_test;/root/repo/nczarr_test/CMakeLists.txt;0;")
+add_test([=[nczarr_test_run_ut_mapapi]=] "bash" "-c" "export srcdir=/root/repo/nczarr_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nczarr_test/run_ut_mapapi.sh ")
+set_tests_properties([=[nczarr_test_run_ut_mapapi]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nczarr_test/CMakeLists.txt;186;add_sh_test;/root/repo/nczarr_test/CMakeLists.txt;0;")
+add_test([=[nczarr_test_run_ut_misc]=] "bash" "-c" "export srcdir=/root/repo/nczarr_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nczarr_test/run_ut_misc.sh ")
+set_tests_properties([=[nczarr_test_run_ut_misc]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nczarr_test/CMakeLists.txt;187;add_sh_test;/root/repo/nczarr_test/CMakeLists.txt;0;")
+add_test([=[nczarr_test_run_ncgen4]=] "bash" "-c" "export srcdir=/root/repo/nczarr_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nczarr_test/run_ncgen4.sh ")
+set_tests_properties([=[nczarr_test_run_ncgen4]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nczarr_test/CMakeLists.txt;188;add_sh_test;/root/repo/nczarr_test/CMakeLists.txt;0;")
+add_test([=[nczarr_test_run_nccopyz]=] "bash" "-c" "export srcdir=/root/repo/nczarr_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nczarr_test/run_nccopyz.sh ")
+set_tests_properties([=[nczarr_test_run_nccopyz]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nczarr_test/CMakeLists.txt;190;ADD_SH_TEST;/root/repo/nczarr_test/CMakeLists.txt;0;")
+add_test([=[nczarr_test_run_unlim_io]=] "bash" "-c" "export srcdir=/root/repo/nczarr_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nczarr_test/run_unlim_io.sh ")
+set_tests_properties([=[nczarr_test_run_unlim_io]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nczarr_test/CMakeLists.txt;191;ADD_SH_TEST;/root/repo/nczarr_test/CMakeLists.txt;0;")
+add_test([=[nczarr_test_run_nccopy5]=] "bash" "-c" "export srcdir=/root/repo/nczarr_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nczarr_test/run_nccopy5.sh ")
+set_tests_properties([=[nczarr_test_run_nccopy5]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nczarr_test/CMakeLists.txt;192;ADD_SH_TEST;/root/repo/nczarr_test/CMakeLists.txt;0;")
+add_test([=[nczarr_test_run_mud]=] "bash" "-c" "export srcdir=/root/repo/nczarr_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nczarr_test/run_mud.sh ")
+set_tests_properties([=[nczarr_test_run_mud]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nczarr_test/CMakeLists.txt;193;ADD_SH_TEST;/root/repo/nczarr_test/CMakeLists.txt;0;")
+add_test([=[nczarr_test_run_purezarr]=] "bash" "-c" "export srcdir=/root/repo/nczarr_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nczarr_test/run_purezarr.sh ")
+set_tests_properties([=[nczarr_test_run_purezarr]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nczarr_test/CMakeLists.txt;203;add_sh_test;/root/repo/nczarr_test/CMakeLists.txt;0;")
+add_test([=[nczarr_test_run_misc]=] "bash" "-c" "export srcdir=/root/repo/nczarr_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nczarr_test/run_misc.sh ")
+set_tests_properties([=[nczarr_test_run_misc]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nczarr_test/CMakeLists.txt;204;add_sh_test;/root/repo/nczarr_test/CMakeLists.txt;0;")
+add_test([=[nczarr_test_run_nczarr_fill]=] "bash" "-c" "export srcdir=/root/repo/nczarr_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nczarr_test/run_nczarr_fill.sh ")
+set_tests_properties([=[nczarr_test_run_nczarr_fill]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nczarr_test/CMakeLists.txt;205;add_sh_test;/root/repo/nczarr_test/CMakeLists.txt;0;")
+add_test([=[nczarr_test_run_jsonconvention]=] "bash" "-c" "export srcdir=/root/repo/nczarr_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nczarr_test/run_jsonconvention.sh ")
+set_tests_properties([=[nczarr_test_run_jsonconvention]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nczarr_test/CMakeLists.txt;206;add_sh_test;/root/repo/nczarr_test/CMakeLists.txt;0;")
+add_test([=[nczarr_test_run_strings]=] "bash" "-c" "export srcdir=/root/repo/nczarr_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nczarr_test/run_strings.sh ")
+set_tests_properties([=[nczarr_test_run_strings]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nczarr_test/CMakeLists.txt;207;add_sh_test;/root/repo/nczarr_test/CMakeLists.txt;0;")
+add_test([=[nczarr_test_run_scalar]=] "bash" "-c" "export srcdir=/root/repo/nczarr_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nczarr_test/run_scalar.sh ")
+set_tests_properties([=[nczarr_test_run_scalar]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nczarr_test/CMakeLists.txt;208;add_sh_test;/root/repo/nczarr_test/CMakeLists.txt;0;")
+add_test([=[nczarr_test_run_nulls]=] "bash" "-c" "export srcdir=/root/repo/nczarr_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nczarr_test/run_nulls.sh ")
+set_tests_properties([=[nczarr_test_run_nulls]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nczarr_test/CMakeLists.txt;209;add_sh_test;/root/repo/nczarr_test/CMakeLists.txt;0;")
+add_test([=[nczarr_test_run_external]=] "bash" "-c" "export srcdir=/root/repo/nczarr_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nczarr_test/run_external.sh ")
+set_tests_properties([=[nczarr_test_run_external]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nczarr_test/CMakeLists.txt;210;add_sh_test;/root/repo/nczarr_test/CMakeLists.txt;0;")
+add_test([=[nczarr_test_run_s3_credentials]=] "bash" "-c" "export srcdir=/root/repo/nczarr_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nczarr_test/run_s3_credentials.sh ")
+set_tests_properties([=[nczarr_test_run_s3_credentials]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nczarr_test/CMakeLists.txt;211;add_sh_test;/root/repo/nczarr_test/CMakeLists.txt;0;")
+add_test([=[nczarr_test_run_quantize]=] "bash" "-c" "export srcdir=/root/repo/nczarr_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nczarr_test/run_quantize.sh ")
+set_tests_properties([=[nczarr_test_run_quantize]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nczarr_test/CMakeLists.txt;212;add_sh_test;/root/repo/nczarr_test/CMakeLists.txt;0;")
+add_test([=[nczarr_test_run_notzarr]=] "bash" "-c" "export srcdir=/root/repo/nczarr_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nczarr_test/run_notzarr.sh ")
+set_tests_properties([=[nczarr_test_run_notzarr]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nczarr_test/CMakeLists.txt;213;add_sh_test;/root/repo/nczarr_test/CMakeLists.txt;0;")
+add_test([=[nczarr_test_run_oldkeys]=] "bash" "-c" "export srcdir=/root/repo/nczarr_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nczarr_test/run_oldkeys.sh ")
+set_tests_properties([=[nczarr_test_run_oldkeys]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nczarr_test/CMakeLists.txt;216;add_sh_test;/root/repo/nczarr_test/CMakeLists.txt;0;")
+add_test([=[nczarr_test_run_interop]=] "bash" "-c" "export srcdir=/root/repo/nczarr_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nczarr_test/run_interop.sh ")
+set_tests_properties([=[nczarr_test_run_interop]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nczarr_test/CMakeLists.txt;220;add_sh_test;/root/repo/nczarr_test/CMakeLists.txt;0;")
+add_test([=[nczarr_test_run_fillonlyz]=] "bash" "-c" "export srcdir=/root/repo/nczarr_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nczarr_test/run_fillonlyz.sh ")
+set_tests_properties([=[nczarr_test_run_fillonlyz]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nczarr_test/CMakeLists.txt;224;add_sh_test;/root/repo/nczarr_test/CMakeLists.txt;0;")
+add_test([=[nczarr_test_run_filter_errors]=] "bash" "-c" "export srcdir=/root/repo/nczarr_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nczarr_test/run_filter_errors.sh ")
+set_tests_properties([=[nczarr_test_run_filter_errors]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nczarr_test/CMakeLists.txt;229;add_sh_test;/root/repo/nczarr_test/CMakeLists.txt;0;")
+add_test([=[nczarr_test_run_nczfilter]=] "bash" "-c" "export srcdir=/root/repo/nczarr_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nczarr_test/run_nczfilter.sh ")
+set_tests_properties([=[nczarr_test_run_nczfilter]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nczarr_test/CMakeLists.txt;237;ADD_SH_TEST;/root/repo/nczarr_test/CMakeLists.txt;0;")
+add_test([=[nczarr_test_run_filter]=] "bash" "-c" "export srcdir=/root/repo/nczarr_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nczarr_test/run_filter.sh ")
+set_tests_properties([=[nczarr_test_run_filter]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nczarr_test/CMakeLists.txt;239;ADD_SH_TEST;/root/repo/nczarr_test/CMakeLists.txt;0;")
+add_test([=[nczarr_test_run_specific_filters]=] "bash" "-c" "export srcdir=/root/repo/nczarr_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nczarr_test/run_specific_filters.sh ")
+set_tests_properties([=[nczarr_test_run_specific_filters]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nczarr_test/CMakeLists.txt;241;ADD_SH_TEST;/root/repo/nczarr_test/CMakeLists.txt;0;")
+add_test([=[nczarr_test_run_filter_vlen]=] "bash" "-c" "export srcdir=/root/repo/nczarr_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nczarr_test/run_filter_vlen.sh ")
+set_tests_properties([=[nczarr_test_run_filter_vlen]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nczarr_test/CMakeLists.txt;242;ADD_SH_TEST;/root/repo/nczarr_test/CMakeLists.txt;0;")
+add_test([=[nczarr_test_run_corrupt]=] "bash" "-c" "export srcdir=/root/repo/nczarr_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nczarr_test/run_corrupt.sh ")
+set_tests_properties([=[nczarr_test_run_corrupt]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nczarr_test/CMakeLists.txt;256;ADD_SH_TEST;/root/repo/nczarr_test/CMakeLists.txt;0;")
+add_test([=[nczarr_test_run_xarray_misc]=] "bash" "-c" "export srcdir=/root/repo/nczarr_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/nczarr_test/run_xarray_misc.sh ")
+set_tests_properties([=[nczarr_test_run_xarray_misc]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/nczarr_test/CMakeLists.txt;259;ADD_SH_TEST;/root/repo/nczarr_test/CMakeLists.txt;0;")
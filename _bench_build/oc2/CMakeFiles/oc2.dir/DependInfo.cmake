@@ -0,0 +1,33 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/oc2/daplex.c" "oc2/CMakeFiles/oc2.dir/daplex.c.o" "gcc" "oc2/CMakeFiles/oc2.dir/daplex.c.o.d"
+  "/root/repo/oc2/dapparse.c" "oc2/CMakeFiles/oc2.dir/dapparse.c.o" "gcc" "oc2/CMakeFiles/oc2.dir/dapparse.c.o.d"
+  "/root/repo/oc2/dapy.c" "oc2/CMakeFiles/oc2.dir/dapy.c.o" "gcc" "oc2/CMakeFiles/oc2.dir/dapy.c.o.d"
+  "/root/repo/oc2/oc.c" "oc2/CMakeFiles/oc2.dir/oc.c.o" "gcc" "oc2/CMakeFiles/oc2.dir/oc.c.o.d"
+  "/root/repo/oc2/occompile.c" "oc2/CMakeFiles/oc2.dir/occompile.c.o" "gcc" "oc2/CMakeFiles/oc2.dir/occompile.c.o.d"
+  "/root/repo/oc2/occurlfunctions.c" "oc2/CMakeFiles/oc2.dir/occurlfunctions.c.o" "gcc" "oc2/CMakeFiles/oc2.dir/occurlfunctions.c.o.d"
+  "/root/repo/oc2/ocdata.c" "oc2/CMakeFiles/oc2.dir/ocdata.c.o" "gcc" "oc2/CMakeFiles/oc2.dir/ocdata.c.o.d"
+  "/root/repo/oc2/ocdebug.c" "oc2/CMakeFiles/oc2.dir/ocdebug.c.o" "gcc" "oc2/CMakeFiles/oc2.dir/ocdebug.c.o.d"
+  "/root/repo/oc2/ocdump.c" "oc2/CMakeFiles/oc2.dir/ocdump.c.o" "gcc" "oc2/CMakeFiles/oc2.dir/ocdump.c.o.d"
+  "/root/repo/oc2/ochttp.c" "oc2/CMakeFiles/oc2.dir/ochttp.c.o" "gcc" "oc2/CMakeFiles/oc2.dir/ochttp.c.o.d"
+  "/root/repo/oc2/ocinternal.c" "oc2/CMakeFiles/oc2.dir/ocinternal.c.o" "gcc" "oc2/CMakeFiles/oc2.dir/ocinternal.c.o.d"
+  "/root/repo/oc2/ocnode.c" "oc2/CMakeFiles/oc2.dir/ocnode.c.o" "gcc" "oc2/CMakeFiles/oc2.dir/ocnode.c.o.d"
+  "/root/repo/oc2/ocread.c" "oc2/CMakeFiles/oc2.dir/ocread.c.o" "gcc" "oc2/CMakeFiles/oc2.dir/ocread.c.o.d"
+  "/root/repo/oc2/ocutil.c" "oc2/CMakeFiles/oc2.dir/ocutil.c.o" "gcc" "oc2/CMakeFiles/oc2.dir/ocutil.c.o.d"
+  "/root/repo/oc2/xxdr.c" "oc2/CMakeFiles/oc2.dir/xxdr.c.o" "gcc" "oc2/CMakeFiles/oc2.dir/xxdr.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
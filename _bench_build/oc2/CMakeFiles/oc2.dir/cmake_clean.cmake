@@ -0,0 +1,37 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/oc2.dir/daplex.c.o"
+  "CMakeFiles/oc2.dir/daplex.c.o.d"
+  "CMakeFiles/oc2.dir/dapparse.c.o"
+  "CMakeFiles/oc2.dir/dapparse.c.o.d"
+  "CMakeFiles/oc2.dir/dapy.c.o"
+  "CMakeFiles/oc2.dir/dapy.c.o.d"
+  "CMakeFiles/oc2.dir/oc.c.o"
+  "CMakeFiles/oc2.dir/oc.c.o.d"
+  "CMakeFiles/oc2.dir/occompile.c.o"
+  "CMakeFiles/oc2.dir/occompile.c.o.d"
+  "CMakeFiles/oc2.dir/occurlfunctions.c.o"
+  "CMakeFiles/oc2.dir/occurlfunctions.c.o.d"
+  "CMakeFiles/oc2.dir/ocdata.c.o"
+  "CMakeFiles/oc2.dir/ocdata.c.o.d"
+  "CMakeFiles/oc2.dir/ocdebug.c.o"
+  "CMakeFiles/oc2.dir/ocdebug.c.o.d"
+  "CMakeFiles/oc2.dir/ocdump.c.o"
+  "CMakeFiles/oc2.dir/ocdump.c.o.d"
+  "CMakeFiles/oc2.dir/ochttp.c.o"
+  "CMakeFiles/oc2.dir/ochttp.c.o.d"
+  "CMakeFiles/oc2.dir/ocinternal.c.o"
+  "CMakeFiles/oc2.dir/ocinternal.c.o.d"
+  "CMakeFiles/oc2.dir/ocnode.c.o"
+  "CMakeFiles/oc2.dir/ocnode.c.o.d"
+  "CMakeFiles/oc2.dir/ocread.c.o"
+  "CMakeFiles/oc2.dir/ocread.c.o.d"
+  "CMakeFiles/oc2.dir/ocutil.c.o"
+  "CMakeFiles/oc2.dir/ocutil.c.o.d"
+  "CMakeFiles/oc2.dir/xxdr.c.o"
+  "CMakeFiles/oc2.dir/xxdr.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/oc2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
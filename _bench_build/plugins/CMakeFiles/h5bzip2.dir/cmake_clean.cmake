@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/h5bzip2.dir/H5Zbzip2.c.o"
+  "CMakeFiles/h5bzip2.dir/H5Zbzip2.c.o.d"
+  "lib__nch5bzip2.pdb"
+  "lib__nch5bzip2.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5bzip2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/h5deflate.dir/H5Zdeflate.c.o"
+  "CMakeFiles/h5deflate.dir/H5Zdeflate.c.o.d"
+  "lib__nch5deflate.pdb"
+  "lib__nch5deflate.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5deflate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/h5fletcher32.dir/H5Zfletcher32.c.o"
+  "CMakeFiles/h5fletcher32.dir/H5Zfletcher32.c.o.d"
+  "CMakeFiles/h5fletcher32.dir/H5checksum.c.o"
+  "CMakeFiles/h5fletcher32.dir/H5checksum.c.o.d"
+  "lib__nch5fletcher32.pdb"
+  "lib__nch5fletcher32.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5fletcher32.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/h5misc.dir/H5Zmisc.c.o"
+  "CMakeFiles/h5misc.dir/H5Zmisc.c.o.d"
+  "CMakeFiles/h5misc.dir/H5Zutil.c.o"
+  "CMakeFiles/h5misc.dir/H5Zutil.c.o.d"
+  "lib__nch5misc.pdb"
+  "lib__nch5misc.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5misc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/h5noop.dir/H5Znoop.c.o"
+  "CMakeFiles/h5noop.dir/H5Znoop.c.o.d"
+  "CMakeFiles/h5noop.dir/H5Zutil.c.o"
+  "CMakeFiles/h5noop.dir/H5Zutil.c.o.d"
+  "lib__nch5noop.pdb"
+  "lib__nch5noop.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5noop.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_bench_build/plugins/H5Znoop1.c" "plugins/CMakeFiles/h5noop1.dir/H5Znoop1.c.o" "gcc" "plugins/CMakeFiles/h5noop1.dir/H5Znoop1.c.o.d"
+  "/root/repo/plugins/H5Zutil.c" "plugins/CMakeFiles/h5noop1.dir/H5Zutil.c.o" "gcc" "plugins/CMakeFiles/h5noop1.dir/H5Zutil.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
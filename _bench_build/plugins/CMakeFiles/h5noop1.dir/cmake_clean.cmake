@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/h5noop1.dir/H5Znoop1.c.o"
+  "CMakeFiles/h5noop1.dir/H5Znoop1.c.o.d"
+  "CMakeFiles/h5noop1.dir/H5Zutil.c.o"
+  "CMakeFiles/h5noop1.dir/H5Zutil.c.o.d"
+  "lib__nch5noop1.pdb"
+  "lib__nch5noop1.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5noop1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
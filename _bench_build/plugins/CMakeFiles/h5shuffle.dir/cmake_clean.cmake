@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/h5shuffle.dir/H5Zshuffle.c.o"
+  "CMakeFiles/h5shuffle.dir/H5Zshuffle.c.o.d"
+  "lib__nch5shuffle.pdb"
+  "lib__nch5shuffle.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5shuffle.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
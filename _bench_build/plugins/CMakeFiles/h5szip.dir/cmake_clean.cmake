@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/h5szip.dir/H5Zszip.c.o"
+  "CMakeFiles/h5szip.dir/H5Zszip.c.o.d"
+  "lib__nch5szip.pdb"
+  "lib__nch5szip.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5szip.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/h5unknown.dir/H5Zunknown.c.o"
+  "CMakeFiles/h5unknown.dir/H5Zunknown.c.o.d"
+  "lib__nch5unknown.pdb"
+  "lib__nch5unknown.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5unknown.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
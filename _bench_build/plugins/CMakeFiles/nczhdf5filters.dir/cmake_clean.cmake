@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nczhdf5filters.dir/NCZhdf5filters.c.o"
+  "CMakeFiles/nczhdf5filters.dir/NCZhdf5filters.c.o.d"
+  "lib__nczhdf5filters.pdb"
+  "lib__nczhdf5filters.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nczhdf5filters.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nczmisc.dir/NCZmisc.c.o"
+  "CMakeFiles/nczmisc.dir/NCZmisc.c.o.d"
+  "lib__nczmisc.pdb"
+  "lib__nczmisc.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nczmisc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nczstdfilters.dir/NCZstdfilters.c.o"
+  "CMakeFiles/nczstdfilters.dir/NCZstdfilters.c.o.d"
+  "lib__nczstdfilters.pdb"
+  "lib__nczstdfilters.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nczstdfilters.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ncpluginpath.dir/ncpluginpath.c.o"
+  "CMakeFiles/ncpluginpath.dir/ncpluginpath.c.o.d"
+  "ncpluginpath"
+  "ncpluginpath.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ncpluginpath.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
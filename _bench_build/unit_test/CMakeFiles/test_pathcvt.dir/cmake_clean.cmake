@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_pathcvt.dir/test_pathcvt.c.o"
+  "CMakeFiles/test_pathcvt.dir/test_pathcvt.c.o.d"
+  "test_pathcvt"
+  "test_pathcvt.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_pathcvt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
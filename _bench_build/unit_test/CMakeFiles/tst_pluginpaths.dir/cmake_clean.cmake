@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_pluginpaths.dir/tst_pluginpaths.c.o"
+  "CMakeFiles/tst_pluginpaths.dir/tst_pluginpaths.c.o.d"
+  "tst_pluginpaths"
+  "tst_pluginpaths.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_pluginpaths.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_reclaim.dir/tst_reclaim.c.o"
+  "CMakeFiles/tst_reclaim.dir/tst_reclaim.c.o.d"
+  "tst_reclaim"
+  "tst_reclaim.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_reclaim.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
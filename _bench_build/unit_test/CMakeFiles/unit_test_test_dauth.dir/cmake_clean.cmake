@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit_test_test_dauth.dir/test_dauth.c.o"
+  "CMakeFiles/unit_test_test_dauth.dir/test_dauth.c.o.d"
+  "unit_test_test_dauth"
+  "unit_test_test_dauth.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unit_test_test_dauth.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit_test_tst_exhash.dir/timer_utils.c.o"
+  "CMakeFiles/unit_test_tst_exhash.dir/timer_utils.c.o.d"
+  "CMakeFiles/unit_test_tst_exhash.dir/tst_exhash.c.o"
+  "CMakeFiles/unit_test_tst_exhash.dir/tst_exhash.c.o.d"
+  "unit_test_tst_exhash"
+  "unit_test_tst_exhash.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unit_test_tst_exhash.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
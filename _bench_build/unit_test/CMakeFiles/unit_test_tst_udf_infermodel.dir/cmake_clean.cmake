@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit_test_tst_udf_infermodel.dir/tst_udf_infermodel.c.o"
+  "CMakeFiles/unit_test_tst_udf_infermodel.dir/tst_udf_infermodel.c.o.d"
+  "unit_test_tst_udf_infermodel"
+  "unit_test_tst_udf_infermodel.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unit_test_tst_udf_infermodel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit_test_tst_xcache.dir/timer_utils.c.o"
+  "CMakeFiles/unit_test_tst_xcache.dir/timer_utils.c.o.d"
+  "CMakeFiles/unit_test_tst_xcache.dir/tst_xcache.c.o"
+  "CMakeFiles/unit_test_tst_xcache.dir/tst_xcache.c.o.d"
+  "unit_test_tst_xcache"
+  "unit_test_tst_xcache.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unit_test_tst_xcache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/unit_test/timer_utils.c" "unit_test/CMakeFiles/unit_test_tst_xcachelru.dir/timer_utils.c.o" "gcc" "unit_test/CMakeFiles/unit_test_tst_xcachelru.dir/timer_utils.c.o.d"
+  "/root/repo/unit_test/tst_xcachelru.c" "unit_test/CMakeFiles/unit_test_tst_xcachelru.dir/tst_xcachelru.c.o" "gcc" "unit_test/CMakeFiles/unit_test_tst_xcachelru.dir/tst_xcachelru.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/CMakeFiles/netcdf.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
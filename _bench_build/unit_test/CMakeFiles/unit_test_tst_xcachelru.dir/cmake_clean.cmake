@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit_test_tst_xcachelru.dir/timer_utils.c.o"
+  "CMakeFiles/unit_test_tst_xcachelru.dir/timer_utils.c.o.d"
+  "CMakeFiles/unit_test_tst_xcachelru.dir/tst_xcachelru.c.o"
+  "CMakeFiles/unit_test_tst_xcachelru.dir/tst_xcachelru.c.o.d"
+  "unit_test_tst_xcachelru"
+  "unit_test_tst_xcachelru.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unit_test_tst_xcachelru.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,30 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/unit_test
+# Build directory: /root/repo/_bench_build/unit_test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[unit_test_test_ncuri]=] "/unit_test_test_ncuri")
+set_tests_properties([=[unit_test_test_ncuri]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/unit_test/CMakeLists.txt;21;add_bin_test;/root/repo/unit_test/CMakeLists.txt;0;")
+add_test([=[unit_test_tst_udf_infermodel]=] "/unit_test_tst_udf_infermodel")
+set_tests_properties([=[unit_test_tst_udf_infermodel]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/unit_test/CMakeLists.txt;22;add_bin_test;/root/repo/unit_test/CMakeLists.txt;0;")
+add_test([=[unit_test_test_dauth]=] "/unit_test_test_dauth")
+set_tests_properties([=[unit_test_test_dauth]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/unit_test/CMakeLists.txt;24;add_bin_test;/root/repo/unit_test/CMakeLists.txt;0;")
+add_test([=[unit_test_tst_nclist]=] "/unit_test_tst_nclist")
+set_tests_properties([=[unit_test_tst_nclist]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/unit_test/CMakeLists.txt;28;add_bin_test;/root/repo/unit_test/CMakeLists.txt;0;")
+add_test([=[unit_test_tst_nc4internal]=] "/unit_test_tst_nc4internal")
+set_tests_properties([=[unit_test_tst_nc4internal]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/unit_test/CMakeLists.txt;29;add_bin_test;/root/repo/unit_test/CMakeLists.txt;0;")
+add_test([=[unit_test_run_reclaim_tests]=] "bash" "-c" "export srcdir=/root/repo/unit_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/unit_test/run_reclaim_tests.sh ")
+set_tests_properties([=[unit_test_run_reclaim_tests]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/unit_test/CMakeLists.txt;33;add_sh_test;/root/repo/unit_test/CMakeLists.txt;0;")
+add_test([=[unit_test_run_pluginpaths]=] "bash" "-c" "export srcdir=/root/repo/unit_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/unit_test/run_pluginpaths.sh ")
+set_tests_properties([=[unit_test_run_pluginpaths]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/unit_test/CMakeLists.txt;36;add_sh_test;/root/repo/unit_test/CMakeLists.txt;0;")
+add_test([=[unit_test_run_dfaltpluginpath]=] "bash" "-c" "export srcdir=/root/repo/unit_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/unit_test/run_dfaltpluginpath.sh ")
+set_tests_properties([=[unit_test_run_dfaltpluginpath]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/unit_test/CMakeLists.txt;37;add_sh_test;/root/repo/unit_test/CMakeLists.txt;0;")
+add_test([=[unit_test_run_pathcvt]=] "bash" "-c" "export srcdir=/root/repo/unit_test;export TOPSRCDIR=/root/repo;/root/repo/_bench_build/unit_test/run_pathcvt.sh ")
+set_tests_properties([=[unit_test_run_pathcvt]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;272;add_test;/root/repo/unit_test/CMakeLists.txt;46;add_sh_test;/root/repo/unit_test/CMakeLists.txt;0;")
+add_test([=[unit_test_tst_exhash]=] "/unit_test_tst_exhash")
+set_tests_properties([=[unit_test_tst_exhash]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/unit_test/CMakeLists.txt;61;add_bin_test;/root/repo/unit_test/CMakeLists.txt;0;")
+add_test([=[unit_test_tst_xcache]=] "/unit_test_tst_xcache")
+set_tests_properties([=[unit_test_tst_xcache]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/unit_test/CMakeLists.txt;62;add_bin_test;/root/repo/unit_test/CMakeLists.txt;0;")
+add_test([=[unit_test_tst_xcachelru]=] "/unit_test_tst_xcachelru")
+set_tests_properties([=[unit_test_tst_xcachelru]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/netcdf_functions_macros.cmake;203;add_test;/root/repo/unit_test/CMakeLists.txt;63;add_bin_test;/root/repo/unit_test/CMakeLists.txt;0;")
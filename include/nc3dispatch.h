@@ -172,6 +172,26 @@ extern "C" {
                  const size_t *start, const size_t *count,
                  void *value, nc_type);
 
+    extern int
+    NC3_put_vars(int ncid, int varid,
+                 const size_t *start, const size_t *count,
+                 const ptrdiff_t *stride, const void *value, nc_type);
+
+    extern int
+    NC3_get_vars(int ncid, int varid,
+                 const size_t *start, const size_t *count,
+                 const ptrdiff_t *stride, void *value, nc_type);
+
+    extern int
+    NC3_get_vara_multi(int ncid, int nvars, const int *varids,
+                       const size_t *const *starts,
+                       const size_t *const *counts, void *const *values);
+
+    extern int
+    NC3_get_vara_ptr(int ncid, int varid,
+                     const size_t *start, const size_t *count,
+                     const void **datap);
+
 /* End _var */
 
     extern int NC3_initialize(void);
@@ -30,6 +30,13 @@ typedef struct NCglobalstate {
     struct GlobalZarr { /* Zarr specific parameters */
 	char dimension_separator;
 	int default_zarrformat;
+	size_t nthreads; /* Max concurrent chunk fetches; 0|1 => serial */
+	size_t openfiles; /* Max open files cached by the file storage format */
+	size_t writebehind; /* Max S3 writes in flight; 0 => synchronous */
+	size_t writebehind_bytes; /* Max bytes held by S3 writes in flight */
+	size_t multipart; /* S3 objects this large use multipart upload; 0 => never */
+	size_t multipart_partsize; /* Size of each part of a multipart upload */
+	size_t multipart_threads; /* Max parts of one upload in flight */
 	struct NClist* pluginpaths; /* NCZarr mirror of plugin paths */
 	struct NClist* codec_defaults;
 	struct NClist* default_libs;
@@ -35,9 +35,10 @@
 
 #define NCJ_NSORTS   8
 
-/* Dump/text/unparse flags */
+/* Parse/dump/text/unparse flags */
 #define NCJFLAG_NONE	    0
 #define NCJFLAG_INDENTED    1
+#define NCJFLAG_ARENA	    2 /* parse: allocate the whole tree from one arena that is freed with the root */
 
 /* Define a struct to store primitive values as unquoted
    strings. The sort will provide more info.  Do not bother with
@@ -46,11 +47,13 @@
 
 typedef struct NCjson {
     int sort;     /* of this object */
+    int flags;    /* private: which parts of this object belong to a parse arena */
     char* string; /* sort != DICT|ARRAY */
     struct NCjlist {
-	size_t alloc;
+	size_t alloc; /* 0 with len > 0 => contents belong to a parse arena */
 	size_t len;
 	struct NCjson** contents;
+	struct NCjindex* index; /* sort == DICT: hash index of the keys of a large dict; may be NULL */
     } list; /* sort == DICT|ARRAY */
 } NCjson;
 
@@ -59,6 +62,18 @@ typedef struct NCjson {
 */
 struct NCJconst {int bval; long long ival; double dval; char* sval;};
 
+/* Event callbacks for NCJparsecb; any of them may be NULL.
+   Keys and atomic values are passed as nul terminated text that
+   is only valid for the duration of the call.
+   A callback that returns other than NCJ_OK stops the parse.
+*/
+typedef struct NCJcallbacks {
+    int (*begin)(void* state, int sort); /* start of an NCJ_DICT or NCJ_ARRAY */
+    int (*end)(void* state, int sort); /* end of the innermost NCJ_DICT or NCJ_ARRAY */
+    int (*key)(void* state, const char* key, size_t len); /* next key of a dict */
+    int (*value)(void* state, int sort, const char* text, size_t len); /* atomic value or NCJ_NULL */
+} NCJcallbacks;
+
 /**************************************************/
 /* Extended API */
 
@@ -74,6 +89,9 @@ OPTEXPORT int NCJparse(const char* text, unsigned flags, NCjson** jsonp);
 /* Parse a counted string to NCjson*/
 OPTEXPORT int NCJparsen(size_t len, const char* text, unsigned flags, NCjson** jsonp);
 
+/* Parse a counted string, reporting its structure as events instead of building a tree */
+OPTEXPORT int NCJparsecb(size_t len, const char* text, unsigned flags, const NCJcallbacks* callbacks, void* state);
+
 /* Reclaim a JSON tree */
 OPTEXPORT void NCJreclaim(NCjson* json);
 
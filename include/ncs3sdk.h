@@ -45,6 +45,12 @@
 #define AWS_FRAG_REGION AWS_RC_REGION
 #define AWS_FRAG_DEFAULT_REGION AWS_RC_DEFAULT_REGION
 
+/* S3 limits on multipart uploads: every part but the last must hold
+   at least 5 MiB and at most 5 GiB, and an upload has at most 10000 parts */
+#define NCS3MINPARTSIZE (5ULL*1024*1024)
+#define NCS3MAXPARTSIZE (5ULL*1024*1024*1024)
+#define NCS3MAXPARTS 10000
+
 /* Track the server type, if known */
 typedef enum NCS3SVC {NCS3UNK=0, /* unknown */
 	NCS3=1,     /* s3.amazon.aws */
@@ -105,6 +111,7 @@ DECLSPEC int NC_s3sdkbucketcreate(void* s3client, const char* region, const char
 DECLSPEC int NC_s3sdkbucketdelete(void* s3client, NCS3INFO* info, char** errmsgp);
 DECLSPEC int NC_s3sdkinfo(void* client0, const char* bucket, const char* pathkey, unsigned long long* lenp, char** errmsgp);
 DECLSPEC int NC_s3sdkread(void* client0, const char* bucket, const char* pathkey, unsigned long long start, unsigned long long count, void* content, char** errmsgp);
+DECLSPEC int NC_s3sdkreadobject(void* client0, const char* bucket, const char* pathkey, unsigned long long* lenp, void** contentp, char** errmsgp);
 DECLSPEC int NC_s3sdkwriteobject(void* client0, const char* bucket, const char* pathkey, unsigned long long count, const void* content, char** errmsgp);
 DECLSPEC int NC_s3sdkclose(void* s3client0, char** errmsgp);
 DECLSPEC int NC_s3sdktruncate(void* s3client0, const char* bucket, const char* prefix, char** errmsgp);
@@ -120,6 +127,7 @@ DECLSPEC int NC_s3urlprocess(NCURI* url, NCS3INFO* s3, NCURI** newurlp);
 DECLSPEC int NC_s3clear(NCS3INFO* s3);
 DECLSPEC int NC_s3clone(NCS3INFO* s3, NCS3INFO** news3p);
 DECLSPEC const char* NC_s3dumps3info(NCS3INFO* info);
+DECLSPEC int NC_s3multipartsplit(unsigned long long count, unsigned long long partsize, unsigned long long* partsizep, size_t* npartsp);
 DECLSPEC void NC_s3freeprofilelist(struct NClist* profiles);
 DECLSPEC int NC_getactives3profile(NCURI* uri, const char** profilep);
 DECLSPEC int NC_s3profilelookup(const char* profile, const char* key, const char** valuep);
@@ -0,0 +1,53 @@
+/*
+Copyright (c) 1998-2018 University Corporation for Atmospheric Research/Unidata
+See COPYRIGHT for license information.
+*/
+
+#ifndef NCTHREADPOOL_H
+#define NCTHREADPOOL_H
+
+#include "ncexternl.h"
+
+/*
+A bounded pool of worker threads executing independent tasks.
+Tasks are submitted in FIFO order and the submitter waits for
+all outstanding tasks with ncthreadpoolwait, which returns the
+first non-zero task result (if any) since the previous wait.
+
+If the platform has no pthreads, or the pool was created with
+fewer than two threads, then tasks are executed synchronously
+inside ncthreadpoolsubmit, so callers need no separate serial path.
+*/
+
+/* A task returns an NC_XXX error code */
+typedef int (*NCtaskfcn)(void* arg);
+
+typedef struct NCthreadpool NCthreadpool; /* Opaque */
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/* Create a pool with nthreads workers; nthreads <= 1 => synchronous */
+EXTERNL int ncthreadpoolnew(size_t nthreads, NCthreadpool** poolp);
+
+/* Queue a task; may execute it immediately if the pool is synchronous */
+EXTERNL int ncthreadpoolsubmit(NCthreadpool* pool, NCtaskfcn fcn, void* arg);
+
+/* Wait for all submitted tasks to complete; return first task error */
+EXTERNL int ncthreadpoolwait(NCthreadpool* pool);
+
+/* Number of submitted tasks that have not yet completed */
+EXTERNL size_t ncthreadpoolpending(NCthreadpool* pool);
+
+/* Number of worker threads; 0 => synchronous */
+EXTERNL size_t ncthreadpoolsize(NCthreadpool* pool);
+
+/* Wait for outstanding tasks, then stop the workers and reclaim the pool */
+EXTERNL void ncthreadpoolfree(NCthreadpool* pool);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /*NCTHREADPOOL_H*/
@@ -58,6 +58,8 @@ EXTERNL int ncxcachenew(size_t initsize, NCxcache**) ;
 
 EXTERNL void* ncxcachefirst(NCxcache* cache);
 EXTERNL void* ncxcachelast(NCxcache* cache);
+/* Return the object following the one with key hkey in LRU order (i.e. the next less recently used); NULL => none */
+EXTERNL void* ncxcachenext(NCxcache* cache, ncexhashkey_t hkey);
 
 /* Return the hash key for specified key; takes key+size; an alias for the one in ncexhash */
 EXTERNL ncexhashkey_t ncxcachekey(const void* key, size_t size);
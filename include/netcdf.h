@@ -920,6 +920,12 @@ EXTERNL int
 nc_get_vara(int ncid, int varid,  const size_t *startp,
             const size_t *countp, void *ip);
 
+/* Read arrays of values from several variables at once. */
+EXTERNL int
+nc_get_vara_multi(int ncid, int nvars, const int *varids,
+                  const size_t *const *startps, const size_t *const *countps,
+                  void *const *ips);
+
 /* Write slices of an array of values. */
 EXTERNL int
 nc_put_vars(int ncid, int varid,  const size_t *startp,
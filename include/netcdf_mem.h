@@ -43,6 +43,13 @@ EXTERNL int nc_open_memio(const char* path, int mode, NC_memio* info, int* ncidp
 /* Close memory file and return the final memory state */
 EXTERNL int nc_close_memio(int ncid, NC_memio* info);
 
+/* Read-only pointer to a contiguous byte/ubyte/char slab of a
+   diskless, in-memory or mmap'd classic file; no copy is made.
+   See docs/inmemory.md
+ */
+EXTERNL int nc_get_vara_ptr(int ncid, int varid, const size_t* start,
+                            const size_t* count, const void** datap);
+
 #if defined(__cplusplus)
 }
 #endif
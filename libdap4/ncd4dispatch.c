@@ -1033,4 +1033,6 @@ NC_NOTNC4_def_var_quantize,
 NCD4_inq_var_quantize,
 
 NCD4_inq_filter_avail,
+
+NCDEFAULT_get_vara_multi,
 };
@@ -34,6 +34,7 @@
 #endif
 
 #include "ncdispatch.h"
+#include "nc3dispatch.h"
 #include "netcdf_mem.h"
 #include "ncpathmgr.h"
 #include "fbits.h"
@@ -1402,6 +1403,61 @@ nc_close_memio(int ncid, NC_memio* memio)
     return stat;
 }
 
+/** \ingroup datasets
+    Get a read-only pointer to a hyperslab of a resident classic file.
+
+    For a netCDF classic, 64-bit offset or CDF-5 file that was opened
+    or created with ::NC_DISKLESS, ::NC_INMEMORY or ::NC_MMAP, the whole
+    file already lives in memory. For a variable of type ::NC_BYTE,
+    ::NC_UBYTE or ::NC_CHAR the external representation is the native
+    one, so nc_get_vara_ptr() can hand back a pointer to the data
+    rather than copying it out the way nc_get_vara() does.
+
+    The requested slab has to be a single contiguous run in the file:
+    a count of one in the leading dimensions, then at most one partial
+    dimension, then the full extent of every faster varying one.
+    Records of different variables are interleaved, so for a record
+    variable that is not the only one in the file that means one
+    record at a time.
+
+    The memory belongs to the library and must not be written or
+    freed. The pointer is only valid until the next call that can
+    change the file's size or layout (a write past the current end,
+    nc_redef()/nc_enddef()) and never past nc_close().
+
+    \param ncid NetCDF ID, from a previous call to nc_open_mem(),
+    nc_open_memio(), nc_create_mem() or nc_open()/nc_create() with one
+    of the modes above.
+
+    \param varid Variable ID.
+
+    \param startp Start index vector, as for nc_get_vara().
+
+    \param countp Count vector, as for nc_get_vara(). NULL means the
+    whole variable.
+
+    \param datap Set to the first byte of the slab, or to NULL if the
+    slab is empty.
+
+    \returns ::NC_NOERR No error.
+    \returns ::NC_ENOTNC3 Not a classic model file.
+    \returns ::NC_EINMEMORY The file is not held in memory.
+    \returns ::NC_EBADTYPE The variable is not a byte, ubyte or char variable.
+    \returns ::NC_EINVAL The slab is not one contiguous run, or datap is NULL.
+    \returns ::NC_EINDEFINE The file is in define mode.
+    \returns ::NC_EINVALCOORDS, ::NC_EEDGE Bad start or count.
+*/
+int
+nc_get_vara_ptr(int ncid, int varid, const size_t* startp,
+                const size_t* countp, const void** datap)
+{
+    NC* ncp;
+    int stat = NC_check_id(ncid, &ncp);
+    if(stat != NC_NOERR) return stat;
+    if(ncp->dispatch != NC3_dispatch_table) return NC_ENOTNC3;
+    return NC3_get_vara_ptr(ncid,varid,startp,countp,datap);
+}
+
 /** \ingroup datasets
     Change the fill-value mode to improve write performance.
 
@@ -508,6 +508,26 @@ NC_s3dumps3info(NCS3INFO* info)
     return text;
 }
 
+/*
+Split an object of count bytes into the parts of a multipart upload:
+parts of the requested size, kept within the S3 bounds, and enlarged
+if need be to stay within the S3 limit on the number of parts.
+All parts but the last have the returned size.
+@return NC_EINVAL if the object is too large for a multipart upload.
+*/
+int
+NC_s3multipartsplit(unsigned long long count, unsigned long long partsize, unsigned long long* partsizep, size_t* npartsp)
+{
+    if(partsize < NCS3MINPARTSIZE) partsize = NCS3MINPARTSIZE;
+    if(partsize > NCS3MAXPARTSIZE) partsize = NCS3MAXPARTSIZE;
+    if((count + partsize - 1) / partsize > NCS3MAXPARTS)
+	partsize = (count + NCS3MAXPARTS - 1) / NCS3MAXPARTS;
+    if(partsize > NCS3MAXPARTSIZE) return NC_EINVAL;
+    if(partsizep) *partsizep = partsize;
+    if(npartsp) *npartsp = (size_t)((count + partsize - 1) / partsize);
+    return NC_NOERR;
+}
+
 /* Find, load, and parse the aws config &/or credentials file */
 int
 NC_aws_load_credentials(NCglobalstate* gstate)
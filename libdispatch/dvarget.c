@@ -279,6 +279,24 @@ NCDEFAULT_get_vars(int ncid, int varid, const size_t * start,
    return status;
 }
 
+/** \internal
+\ingroup variables
+ Read several variables one nc_get_vara() at a time, for dispatch
+ tables with no better way; see nc_get_vara_multi().
+*/
+int
+NCDEFAULT_get_vara_multi(int ncid, int nvars, const int *varids,
+	    const size_t *const *startps, const size_t *const *countps,
+	    void *const *ips)
+{
+   int i;
+   for(i = 0; i < nvars; i++) {
+      int stat = nc_get_vara(ncid, varids[i], startps[i], countps[i], ips[i]);
+      if(stat != NC_NOERR) return stat;
+   }
+   return NC_NOERR;
+}
+
 /** \internal
 \ingroup variables
  */
@@ -357,6 +375,7 @@ NCDEFAULT_get_varm(int ncid, int varid, const size_t *start,
       size_t *length; /* edge lengths in bytes */
       ptrdiff_t *mystride;
       ptrdiff_t *mymap;
+      ptrdiff_t *iostride; /* stride of each I/O call */
       size_t varshape[NC_MAX_VAR_DIMS];
       int isrecvar;
       size_t numrecs;
@@ -390,7 +409,7 @@ NCDEFAULT_get_varm(int ncid, int varid, const size_t *start,
 
       /* assert(sizeof(ptrdiff_t) >= sizeof(size_t)); */
       /* Allocate space for mystart,mystride,mymap etc.all at once */
-      mystart = (size_t *)calloc((size_t)(varndims * 7), sizeof(ptrdiff_t));
+      mystart = (size_t *)calloc((size_t)(varndims * 8), sizeof(ptrdiff_t));
       if(mystart == NULL) return NC_ENOMEM;
       myedges = mystart + varndims;
       iocount = myedges + varndims;
@@ -398,6 +417,7 @@ NCDEFAULT_get_varm(int ncid, int varid, const size_t *start,
       length = stop + varndims;
       mystride = (ptrdiff_t *)(length + varndims);
       mymap = mystride + varndims;
+      iostride = mymap + varndims;
 
       /*
        * Check start, edges
@@ -480,6 +500,7 @@ NCDEFAULT_get_varm(int ncid, int varid, const size_t *start,
 	       mymap[idim + 1] * (ptrdiff_t) myedges[idim + 1];
 #endif
 	 iocount[idim] = 1;
+	 iostride[idim] = 1;
 	 length[idim] = ((size_t)mymap[idim]) * myedges[idim];
 	 stop[idim] = (mystart[idim] + myedges[idim] * (size_t)mystride[idim]);
       }
@@ -498,6 +519,18 @@ NCDEFAULT_get_varm(int ncid, int varid, const size_t *start,
 	 mystride[maxidim] = (ptrdiff_t) myedges[maxidim];
 	 mymap[maxidim] = (ptrdiff_t) length[maxidim];
       }
+      /*
+       * Likewise, when only the internal stride of the fastest
+       * dimension is unity, move a whole row with one strided call
+       * rather than an element at a time.
+       */
+      else if (mymap[maxidim] == 1)
+      {
+	 iostride[maxidim] = mystride[maxidim];
+	 iocount[maxidim] = myedges[maxidim];
+	 mystride[maxidim] *= (ptrdiff_t) myedges[maxidim];
+	 mymap[maxidim] = (ptrdiff_t) length[maxidim];
+      }
 
       /*
        * Perform I/O.  Exit when done.
@@ -505,8 +538,8 @@ NCDEFAULT_get_varm(int ncid, int varid, const size_t *start,
       for (;;)
       {
 	 /* TODO: */
-	 int lstatus = NC_get_vara(ncid, varid, mystart, iocount,
-				   value, memtype);
+	 int lstatus = ncp->dispatch->get_vars(ncid, varid, mystart, iocount,
+					       iostride, value, memtype);
 	 if (lstatus != NC_NOERR) {
 	    if(status == NC_NOERR || lstatus != NC_ERANGE)
 	       status = lstatus;
@@ -855,6 +888,68 @@ nc_get_vara_string(int ncid, int varid, const size_t *startp,
 
 /**@}*/
 
+/** \ingroup variables
+Read an array of values from each of several variables.
+
+This is equivalent to calling nc_get_vara() once for each variable,
+with the same start, count and destination arguments, but lets the
+library order the reads to suit the file. In a classic, 64-bit offset
+or CDF5 file the record variables are interleaved record by record, so
+reading a range of records of N record variables with nc_get_vara()
+goes over that part of the file N times. nc_get_vara_multi() goes over
+it once, fetching as many records as fit in one I/O request at a time
+and copying out each variable's part of every record. For other
+formats it simply loops over the variables.
+
+As with nc_get_vara(), no data conversion is done: each buffer must
+be of the type of its variable.
+
+\param ncid NetCDF or group ID, from a previous call to nc_open(),
+nc_create(), nc_def_grp(), or associated inquiry functions such as
+nc_inq_ncid().
+
+\param nvars Number of variables to read.
+
+\param varids Array of nvars variable IDs.
+
+\param startps Array of nvars start vectors, one for each variable,
+as for nc_get_vara().
+
+\param countps Array of nvars count vectors, one for each variable,
+as for nc_get_vara(). A NULL entry means the whole variable.
+
+\param ips Array of nvars pointers to where the data of each variable
+will be copied.
+
+\returns ::NC_NOERR No error.
+\returns ::NC_EINVAL nvars is negative, or a required array is NULL.
+\returns ::NC_ENOTVAR Variable not found.
+\returns ::NC_EINVALCOORDS Index exceeds dimension bound.
+\returns ::NC_EEDGE Start+count exceeds dimension bound.
+\returns ::NC_EINDEFINE Operation not allowed in define mode.
+\returns ::NC_EBADID Bad ncid.
+
+For a classic, 64-bit offset or CDF5 file every request is checked
+before anything is read, so an error means no buffer has been touched. For other formats
+the variables before the one in error have been read.
+*/
+int
+nc_get_vara_multi(int ncid, int nvars, const int *varids,
+                  const size_t *const *startps,
+                  const size_t *const *countps, void *const *ips)
+{
+   NC* ncp;
+   int stat = NC_check_id(ncid, &ncp);
+   if(stat != NC_NOERR) return stat;
+
+   if(nvars < 0) return NC_EINVAL;
+   if(nvars == 0) return NC_NOERR;
+   if(varids == NULL || startps == NULL || countps == NULL || ips == NULL)
+      return NC_EINVAL;
+
+   return ncp->dispatch->get_vara_multi(ncid, nvars, varids, startps, countps, ips);
+}
+
 /** \ingroup variables
 Read a single datum from a variable.
 
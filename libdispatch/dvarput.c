@@ -370,6 +370,7 @@ NCDEFAULT_put_varm(
       size_t *length = 0; /* edge lengths in bytes */
       ptrdiff_t *mystride = 0;
       ptrdiff_t *mymap= 0;
+      ptrdiff_t *iostride = 0; /* stride of each I/O call */
       size_t varshape[NC_MAX_VAR_DIMS];
       int isrecvar;
       size_t numrecs;
@@ -403,7 +404,7 @@ NCDEFAULT_put_varm(
       NC_getshape(ncid,varid,varndims,varshape);
 
       /* assert(sizeof(ptrdiff_t) >= sizeof(size_t)); */
-      mystart = (size_t *)calloc((size_t)(varndims * 7), sizeof(ptrdiff_t));
+      mystart = (size_t *)calloc((size_t)(varndims * 8), sizeof(ptrdiff_t));
       if(mystart == NULL) return NC_ENOMEM;
       myedges = mystart + varndims;
       iocount = myedges + varndims;
@@ -411,6 +412,7 @@ NCDEFAULT_put_varm(
       length = stop + varndims;
       mystride = (ptrdiff_t *)(length + varndims);
       mymap = mystride + varndims;
+      iostride = mymap + varndims;
 
       /*
        * Check start, edges
@@ -465,6 +467,7 @@ NCDEFAULT_put_varm(
 	        : mymap[idim + 1] * (ptrdiff_t) myedges[idim + 1];
 
 	 iocount[idim] = 1;
+	 iostride[idim] = 1;
 	 length[idim] = ((size_t)mymap[idim]) * myedges[idim];
 	 stop[idim] = mystart[idim] + myedges[idim] * (size_t)mystride[idim];
       }
@@ -483,6 +486,18 @@ NCDEFAULT_put_varm(
 	 mystride[maxidim] = (ptrdiff_t) myedges[maxidim];
 	 mymap[maxidim] = (ptrdiff_t) length[maxidim];
       }
+      /*
+       * Likewise, when only the internal stride of the fastest
+       * dimension is unity, move a whole row with one strided call
+       * rather than an element at a time.
+       */
+      else if (mymap[maxidim] == 1)
+      {
+	 iostride[maxidim] = mystride[maxidim];
+	 iocount[maxidim] = myedges[maxidim];
+	 mystride[maxidim] *= (ptrdiff_t) myedges[maxidim];
+	 mymap[maxidim] = (ptrdiff_t) length[maxidim];
+      }
 
       /*
        * Perform I/O.  Exit when done.
@@ -490,8 +505,8 @@ NCDEFAULT_put_varm(
       for (;;)
       {
 	 /* TODO: */
-	 int lstatus = NC_put_vara(ncid, varid, mystart, iocount,
-				   value, memtype);
+	 int lstatus = ncp->dispatch->put_vars(ncid, varid, mystart, iocount,
+					       iostride, value, memtype);
 	 if (lstatus != NC_NOERR) {
 	    if(status == NC_NOERR || lstatus != NC_ERANGE)
 	       status = lstatus;
@@ -92,6 +92,7 @@
 
 #include "netcdf.h"
 #include "ncuri.h"
+#include "nclist.h"
 #include "ncutil.h"
 #include "netcdf_vutils.h"
 #include "nclog.h"
@@ -101,6 +102,11 @@
 #include "ncs3sdk.h"
 #include "nch5s3comms.h" /* S3 Communications */
 
+#if defined(HAVE_PTHREAD_H) && !defined(_WIN32)
+#define USEPTHREADS
+#include <pthread.h>
+#endif
+
 /****************/
 /* Local Macros */
 /****************/
@@ -270,9 +276,11 @@ done:
  */
 struct s3r_cbstruct {
     unsigned long magic;
-    VString*    data;
+    VString*    data; /* writecallback: response body; headcallback: header line */
     const char* key; /* headcallback: header search key */
-    size_t      pos; /* readcallback: write from this point in data */
+    VString*    payload; /* readcallback: request body */
+    size_t      pos; /* readcallback: write from this point in payload */
+    CURL*       curl; /* writecallback: drop the body of error responses */
 };
 #define S3COMMS_CALLBACK_STRUCT_MAGIC 0x28c2b2ul
 
@@ -281,11 +289,13 @@ struct s3r_cbstruct {
 /********************/
 
 /* Forward */
-static int NCH5_s3comms_s3r_execute(s3r_t *handle, const char* url, HTTPVerb verb, const char* byterange, const char* header, const char** otherheaders, long* httpcodep, VString* data);
+static int NCH5_s3comms_s3r_execute(s3r_t *handle, const char* url, HTTPVerb verb, const char* byterange, const char* header, const char** otherheaders, VString* payload, long* httpcodep, VString* data);
 static size_t curlwritecallback(char *ptr, size_t size, size_t nmemb, void *userdata);
 static size_t curlheadercallback(char *ptr, size_t size, size_t nmemb, void *userdata);
+static size_t curldiscardcallback(char *ptr, size_t size, size_t nmemb, void *userdata);
 static int curl_reset(s3r_t* handle);
 static int perform_request(s3r_t* handle, long* httpcode);
+static int s3r_put(s3r_t *handle, const char* url, const s3r_buf_t* data, const char* header, char** valuep, long* httpcodep);
 static int build_request(s3r_t* handle, NCURI* purl, const char* byterange, const char** otherheaders, VString* payload, HTTPVerb verb);
 static int request_setup(s3r_t* handle, const char* url, HTTPVerb verb, struct s3r_cbstruct*);
 static int validate_handle(s3r_t* handle, const char* url);
@@ -367,6 +377,13 @@ curlwritecallback(char *ptr, size_t size, size_t nmemb, void *userdata)
     if (sds->magic != S3COMMS_CALLBACK_STRUCT_MAGIC)
         return written;
 
+    if (sds->curl != NULL) {
+        long httpcode = 0;
+        /* An error body is not data; consume it so the connection can be reused */
+        if (CURLE_OK == curl_easy_getinfo(sds->curl, CURLINFO_RESPONSE_CODE, &httpcode) && httpcode >= 400)
+            return product;
+    }
+
     if (product > 0) { 
         vsappendn(sds->data,ptr,product);
         written = product;
@@ -375,6 +392,23 @@ curlwritecallback(char *ptr, size_t size, size_t nmemb, void *userdata)
     return written;
 } /* end curlwritecallback() */
 
+/*----------------------------------------------------------------------------
+ * Function: curldiscardcallback()
+ * Purpose:
+ *     Function called by CURL to write the body of a response
+ *     whose content is not wanted (e.g. PUT or DELETE).
+ * Return:
+ *     - Number of bytes passed to callback.
+ *----------------------------------------------------------------------------
+ */
+static size_t
+curldiscardcallback(char *ptr, size_t size, size_t nmemb, void *userdata)
+{
+    (void)ptr;
+    (void)userdata;
+    return size * nmemb;
+} /* end curldiscardcallback() */
+
 /*----------------------------------------------------------------------------
  * Function: curlreadcallback()
  * Purpose:
@@ -400,10 +434,10 @@ curlreadcallback(char *ptr, size_t size, size_t nmemb, void *userdata)
     if (sds->magic != S3COMMS_CALLBACK_STRUCT_MAGIC)
         return CURL_READFUNC_ABORT;
 
-    avail = (vslength(sds->data) - sds->pos);
+    avail = (vslength(sds->payload) - sds->pos);
     towrite = (product > avail ? avail : product);
     if (towrite > 0) {
-	const char* data = vscontents(sds->data);
+	const char* data = vscontents(sds->payload);
 	memcpy(ptr,&data[sds->pos],towrite);
     }
     sds->pos += towrite;
@@ -716,6 +750,264 @@ hrb_node_free(hrb_node_t *node)
     }
 }
 
+/****************************************************************************
+ * CONNECTION POOL
+ ****************************************************************************/
+
+/*
+All request handles share one libcurl share object, so the DNS lookups
+and the TLS sessions are available to every later handle for the same
+endpoint, and a new handle resumes a TLS session rather than doing a
+full handshake. libcurl does not let threads share connections, but
+an easy handle keeps its own connections open between requests, so
+NCH5_s3comms_s3r_close does not destroy its easy handle: the handle is
+reset and kept idle under the root url it was opened for, and the next
+NCH5_s3comms_s3r_open for that root takes it, live connection and all.
+So opening many datasets on one endpoint one after the other uses one
+connection, and concurrent handles use one each. The reachability
+check of NCH5_s3comms_s3r_connect is done once per endpoint for a
+while. HTTP/2 is negotiated if libcurl supports it; servers without it
+are spoken to with HTTP/1.1.
+*/
+
+/* Seconds for which a reached endpoint is not checked again */
+#define S3POOL_ENDPOINT_TTL 60
+
+/* Most idle easy handles kept per endpoint */
+#define S3POOL_MAXIDLE 16
+
+/* An endpoint that NCH5_s3comms_s3r_connect has reached */
+typedef struct S3ENDPOINT {
+    char* url;
+    time_t reached;
+} S3ENDPOINT;
+
+/* An easy handle not in use by any request handle */
+typedef struct S3IDLE {
+    char* root; /* as given to NCH5_s3comms_s3r_open */
+    CURL* curl;
+} S3IDLE;
+
+static struct S3POOL {
+    int initialized;
+    CURLSH* share; /* NULL => nothing is shared */
+    long httpversion;
+    NClist* endpoints; /* NClist<S3ENDPOINT*> */
+    NClist* idle; /* NClist<S3IDLE*> */
+#ifdef USEPTHREADS
+    pthread_mutex_t locks[CURL_LOCK_DATA_LAST]; /* one per kind of shared data; see s3poolshare */
+#endif
+} s3pool = {.initialized = 0, .share = NULL, .httpversion = CURL_HTTP_VERSION_1_1, .endpoints = NULL, .idle = NULL};
+
+#ifdef USEPTHREADS
+static pthread_mutex_t s3poollock = PTHREAD_MUTEX_INITIALIZER;
+#define POOLLOCK() pthread_mutex_lock(&s3poollock)
+#define POOLUNLOCK() pthread_mutex_unlock(&s3poollock)
+
+static void
+s3poolsharelock(CURL* curl, curl_lock_data data, curl_lock_access access, void* userptr)
+{
+    NC_UNUSED(curl); NC_UNUSED(access); NC_UNUSED(userptr);
+    pthread_mutex_lock(&s3pool.locks[data]);
+}
+
+static void
+s3poolshareunlock(CURL* curl, curl_lock_data data, void* userptr)
+{
+    NC_UNUSED(curl); NC_UNUSED(userptr);
+    pthread_mutex_unlock(&s3pool.locks[data]);
+}
+#else
+#define POOLLOCK()
+#define POOLUNLOCK()
+#endif
+
+/* Create the pool on first use; return the share object and HTTP version to use */
+static CURLSH*
+s3poolshare(long* httpversionp)
+{
+    CURLSH* share = NULL;
+
+    POOLLOCK();
+    if(!s3pool.initialized) {
+	curl_version_info_data* info = curl_version_info(CURLVERSION_NOW);
+	s3pool.initialized = 1;
+	s3pool.endpoints = nclistnew();
+	s3pool.idle = nclistnew();
+	if(info != NULL && (info->features & CURL_VERSION_HTTP2))
+	    s3pool.httpversion = CURL_HTTP_VERSION_2TLS;
+	if((s3pool.share = curl_share_init()) != NULL) {
+#ifdef USEPTHREADS
+	    int i;
+	    for(i=0;i<CURL_LOCK_DATA_LAST;i++)
+		pthread_mutex_init(&s3pool.locks[i],NULL);
+	    (void)curl_share_setopt(s3pool.share,CURLSHOPT_LOCKFUNC,s3poolsharelock);
+	    (void)curl_share_setopt(s3pool.share,CURLSHOPT_UNLOCKFUNC,s3poolshareunlock);
+#endif
+	    (void)curl_share_setopt(s3pool.share,CURLSHOPT_SHARE,CURL_LOCK_DATA_DNS);
+	    (void)curl_share_setopt(s3pool.share,CURLSHOPT_SHARE,CURL_LOCK_DATA_SSL_SESSION);
+	}
+    }
+    share = s3pool.share;
+    if(httpversionp) *httpversionp = s3pool.httpversion;
+    POOLUNLOCK();
+    return share;
+}
+
+/* Find the entry for url; pool lock held */
+static S3ENDPOINT*
+s3poolendpoint(const char* url)
+{
+    size_t i;
+    for(i=0;i<nclistlength(s3pool.endpoints);i++) {
+	S3ENDPOINT* ep = (S3ENDPOINT*)nclistget(s3pool.endpoints,i);
+	if(strcmp(ep->url,url)==0) return ep;
+    }
+    return NULL;
+}
+
+/* Has NCH5_s3comms_s3r_connect reached url within the last S3POOL_ENDPOINT_TTL seconds? */
+static int
+s3poolknown(const char* url)
+{
+    S3ENDPOINT* ep = NULL;
+    int known = 0;
+
+    POOLLOCK();
+    if((ep = s3poolendpoint(url)) != NULL)
+	known = (difftime(time(NULL),ep->reached) < S3POOL_ENDPOINT_TTL);
+    POOLUNLOCK();
+    return known;
+}
+
+static void
+s3poolremember(const char* url)
+{
+    S3ENDPOINT* ep = NULL;
+
+    POOLLOCK();
+    if(s3pool.endpoints != NULL) {
+	if((ep = s3poolendpoint(url)) == NULL
+	   && (ep = (S3ENDPOINT*)calloc(1,sizeof(S3ENDPOINT))) != NULL) {
+	    if((ep->url = strdup(url)) == NULL)
+		{free(ep); ep = NULL;}
+	    else
+		nclistpush(s3pool.endpoints,ep);
+	}
+	if(ep != NULL)
+	    ep->reached = time(NULL);
+    }
+    POOLUNLOCK();
+}
+
+/* Take an idle easy handle for root, if there is one */
+static CURL*
+s3pooltake(const char* root)
+{
+    CURL* curl = NULL;
+    size_t i;
+
+    if(root == NULL) return NULL;
+    POOLLOCK();
+    for(i=nclistlength(s3pool.idle);i-->0;) {
+	S3IDLE* idle = (S3IDLE*)nclistget(s3pool.idle,i);
+	if(strcmp(idle->root,root)==0) {
+	    (void)nclistremove(s3pool.idle,i);
+	    curl = idle->curl;
+	    free(idle->root);
+	    free(idle);
+	    break;
+	}
+    }
+    POOLUNLOCK();
+    return curl;
+}
+
+/* Keep curl idle for root; return 0 if the pool has no room for it */
+static int
+s3poolgive(const char* root, CURL* curl)
+{
+    S3IDLE* idle = NULL;
+    size_t i, count = 0;
+
+    if(root == NULL) return 0;
+    if((idle = (S3IDLE*)calloc(1,sizeof(S3IDLE))) == NULL) return 0;
+    if((idle->root = strdup(root)) == NULL) {free(idle); return 0;}
+    /* Forget the last request, but not the connections */
+    curl_easy_reset(curl);
+    idle->curl = curl;
+    POOLLOCK();
+    for(i=0;i<nclistlength(s3pool.idle);i++) {
+	S3IDLE* other = (S3IDLE*)nclistget(s3pool.idle,i);
+	if(strcmp(other->root,root)==0) count++;
+    }
+    if(s3pool.idle != NULL && count < S3POOL_MAXIDLE) {
+	nclistpush(s3pool.idle,idle);
+	idle = NULL;
+    }
+    POOLUNLOCK();
+    if(idle != NULL) {
+	free(idle->root);
+	free(idle);
+	return 0;
+    }
+    return 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Function: NCH5_s3comms_finalize()
+ * Purpose:
+ *     Reclaim the idle easy handles, the shared caches and the list
+ *     of reached endpoints.
+ *     Must not be called while any request handle is open.
+ * Return:
+ *     - SUCCESS: `SUCCEED`
+ *----------------------------------------------------------------------------
+ */
+int
+NCH5_s3comms_finalize(void)
+{
+    POOLLOCK();
+    if(s3pool.initialized) {
+	/* The idle handles use the share object */
+	while(nclistlength(s3pool.idle) > 0) {
+	    S3IDLE* idle = (S3IDLE*)nclistpop(s3pool.idle);
+	    curl_easy_cleanup(idle->curl);
+	    free(idle->root);
+	    free(idle);
+	}
+	if(s3pool.share != NULL) {
+	    if(curl_share_cleanup(s3pool.share) != CURLSHE_OK)
+		goto done; /* still in use; keep it */
+#ifdef USEPTHREADS
+	    {
+		int i;
+		for(i=0;i<CURL_LOCK_DATA_LAST;i++)
+		    pthread_mutex_destroy(&s3pool.locks[i]);
+	    }
+#endif
+	    s3pool.share = NULL;
+	}
+	{
+	    size_t i;
+	    for(i=0;i<nclistlength(s3pool.endpoints);i++) {
+		S3ENDPOINT* ep = (S3ENDPOINT*)nclistget(s3pool.endpoints,i);
+		nullfree(ep->url);
+		free(ep);
+	    }
+	}
+	nclistfree(s3pool.endpoints);
+	s3pool.endpoints = NULL;
+	nclistfree(s3pool.idle);
+	s3pool.idle = NULL;
+	s3pool.httpversion = CURL_HTTP_VERSION_1_1;
+	s3pool.initialized = 0;
+    }
+done:
+    POOLUNLOCK();
+    return SUCCEED;
+}
+
 /****************************************************************************
  * S3R FUNCTIONS
  ****************************************************************************/
@@ -753,7 +1045,9 @@ NCH5_s3comms_s3r_close(s3r_t *handle)
         curl_slist_free_all(handle->curlheaders);
         handle->curlheaders = NULL;
     }
-    curl_easy_cleanup(handle->curlhandle);
+    /* Keep the easy handle, and so its connection, for the next open */
+    if(handle->curlhandle != NULL && !s3poolgive(handle->rootpath,handle->curlhandle))
+        curl_easy_cleanup(handle->curlhandle);
 
     nullfree(handle->rootpath);
     nullfree(handle->region);
@@ -859,7 +1153,7 @@ NCH5_s3comms_s3r_deletekey(s3r_t *handle, const char* url, long* httpcodep)
      * Execute           *
      *********************/
 
-    if((ret_value = NCH5_s3comms_s3r_execute(handle, url, HTTPDELETE, NULL, NULL, NULL, &httpcode, data)))
+    if((ret_value = NCH5_s3comms_s3r_execute(handle, url, HTTPDELETE, NULL, NULL, NULL, NULL, &httpcode, data)))
         HGOTO_ERROR(H5E_ARGS, ret_value, FAIL, "execute failed.");
     
     /* Apparently, aws delivers a 204 response if it successfully deletes the key */
@@ -906,7 +1200,7 @@ NCH5_s3comms_s3r_head(s3r_t *handle, const char* url, const char* header, const
 
      /* only http metadata will be sent by server and recorded by s3comms
      */
-    if (SUCCEED != NCH5_s3comms_s3r_execute(handle, url, HTTPHEAD, NULL, header, NULL, &httpcode, data))
+    if (SUCCEED != NCH5_s3comms_s3r_execute(handle, url, HTTPHEAD, NULL, header, NULL, NULL, &httpcode, data))
         HGOTO_ERROR(H5E_ARGS, NC_EINVAL, FAIL, "problem in reading during getsize.");
 
     if(header != NULL) {
@@ -945,6 +1239,9 @@ done:
  * Function: NCH5_s3comms_s3r_execute()
  * Purpose:
  *     Execute an HTTP verb and optionally return the response.
+ *     `payload` is the body sent by PUT and POST; `data` receives the
+ *     body returned by GET and POST, or the `searchheader` line
+ *     returned by HEAD and PUT.
  *     Uses configured "curl easy handle" to perform request.
  *     In event of error, buffer should remain unaltered.
  *     If handle is set to authorize a request, creates a new (temporary)
@@ -964,12 +1261,13 @@ NCH5_s3comms_s3r_execute(s3r_t *handle, const char* url,
 			 const char* range,
 			 const char* searchheader,
 		         const char** otherheaders,
+			 VString* payload,
 			 long* httpcodep,
 			 VString* data)
 {
     int    ret_value = SUCCEED;
     NCURI* purl= NULL;
-    struct s3r_cbstruct sds = {S3COMMS_CALLBACK_STRUCT_MAGIC, NULL, NULL, 0};
+    struct s3r_cbstruct sds = {S3COMMS_CALLBACK_STRUCT_MAGIC, NULL, NULL, NULL, 0, NULL};
     long httpcode = 0;
 
 #ifdef DEBUG
@@ -997,14 +1295,16 @@ NCH5_s3comms_s3r_execute(s3r_t *handle, const char* url,
      *********************/
 
     sds.data = data;
-    if (verb == HTTPHEAD)
+    sds.payload = payload;
+    sds.curl = handle->curlhandle;
+    if (verb == HTTPHEAD || verb == HTTPPUT)
 	sds.key = searchheader;
 
     /*******************
      * COMPILE REQUEST *
      *******************/
 
-    if((ret_value = build_request(handle,purl,range,otherheaders,data,verb)))
+    if((ret_value = build_request(handle,purl,range,otherheaders,payload,verb)))
         HGOTO_ERROR(H5E_ARGS, ret_value, FAIL, "unable to build request.");
 
     /*********************
@@ -1063,6 +1363,8 @@ NCH5_s3comms_s3r_open(const char* root, NCS3SVC svc, const char *region, const c
     int ret_value = SUCCEED;
     size_t         tmplen    = 0;
     CURL          *curlh     = NULL;
+    CURLSH        *share     = NULL;
+    long           httpversion = CURL_HTTP_VERSION_1_1;
     s3r_t         *handle    = NULL;
     unsigned char *signing_key = NULL;
     char           iso8601now[ISO8601_SIZE];
@@ -1159,15 +1461,27 @@ NCH5_s3comms_s3r_open(const char* root, NCS3SVC svc, const char *region, const c
      * INITIATE CURL HANDLE *
      ************************/
 
-    curlh = curl_easy_init();
+    /* Use the process-wide DNS and TLS session caches */
+    share = s3poolshare(&httpversion);
+
+    /* Prefer an idle handle to this endpoint, which has a connection open */
+    if ((curlh = s3pooltake(root)) == NULL)
+        curlh = curl_easy_init();
     if (curlh == NULL)
         HGOTO_ERROR(H5E_ARGS, NC_EINVAL, NULL, "problem creating curl easy handle!");
 
-    if (CURLE_OK != curl_easy_setopt(curlh, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_1_1))
+    if (share != NULL && CURLE_OK != curl_easy_setopt(curlh, CURLOPT_SHARE, share))
+        HGOTO_ERROR(H5E_ARGS, NC_EINVAL, NULL, "error while setting CURL option (CURLOPT_SHARE).");
+
+    if (CURLE_OK != curl_easy_setopt(curlh, CURLOPT_HTTP_VERSION, httpversion))
         HGOTO_ERROR(H5E_ARGS, NC_EINVAL, NULL, "error while setting CURL option (CURLOPT_HTTP_VERSION).");
 
-    if (CURLE_OK != curl_easy_setopt(curlh, CURLOPT_FAILONERROR, 1L))
-        HGOTO_ERROR(H5E_ARGS, NC_EINVAL, NULL, "error while setting CURL option (CURLOPT_FAILONERROR).");
+    /* Keep the handle's idle connections alive */
+    (void)curl_easy_setopt(curlh, CURLOPT_TCP_KEEPALIVE, 1L);
+
+    /* No CURLOPT_FAILONERROR: it makes curl drop the connection on every
+       4xx, and missing keys are routine; the write callback discards
+       error bodies instead and callers test the http code. */
 
     handle->curlhandle = curlh;
 
@@ -1214,6 +1528,9 @@ done:
  */
 int NCH5_s3comms_s3r_connect(s3r_t *handle, const char *url, const char **err) {
   int ret_value = NC_NOERR;
+  /* An endpoint reached before is not checked again */
+  if (s3poolknown(url))
+    return NC_NOERR;
   if (CURLE_OK != curl_easy_setopt(handle->curlhandle, CURLOPT_URL, url)) {
     HGOTO_ERROR(H5E_ARGS, NC_ECURL, NULL,
                 "error while setting CURL option (CURLOPT_URL).");
@@ -1236,6 +1553,7 @@ int NCH5_s3comms_s3r_connect(s3r_t *handle, const char *url, const char **err) {
   CURLcode result = CURLE_OK;
   if (CURLE_OK == (result = curl_easy_perform(handle->curlhandle))) {
     ret_value = NC_NOERR;
+    s3poolremember(url);
   } else { // log and save error msg
     const char *basic_err = curl_easy_strerror(result);
     if (err) {
@@ -1298,8 +1616,9 @@ NCH5_s3comms_s3r_read(s3r_t *handle, const char* url, size_t offset, size_t len,
     vssetcontents(wrap,dest->content,dest->count);
     vssetlength(wrap,0);
 
-    if((ret_value = NCH5_s3comms_s3r_execute(handle, url, HTTPGET, rangebytesstr, NULL, NULL, &httpcode, wrap)))
+    if((ret_value = NCH5_s3comms_s3r_execute(handle, url, HTTPGET, rangebytesstr, NULL, NULL, NULL, &httpcode, wrap)))
         HGOTO_ERROR(H5E_ARGS, ret_value, FAIL, "execute failed.");
+    dest->count = vslength(wrap); /* short if the range runs past the end of the object */
 
 done:
     if(httpcodep) *httpcodep = httpcode;
@@ -1311,6 +1630,48 @@ done:
     return UNTRACE(ret_value);;
 } /* NCH5_s3comms_s3r_read */
 
+/*----------------------------------------------------------------------------
+ * Function: NCH5_s3comms_s3r_getobject()
+ * Purpose:
+ *     Read the whole of the object at `url` with a single GET and no
+ *     byterange; the content is malloc'd, nul-terminated,
+ *     and returned thru `data`.
+ * Return:
+ *     - SUCCESS: `SUCCEED`
+ *     - FAILURE: `FAIL`
+ *----------------------------------------------------------------------------
+ */
+int
+NCH5_s3comms_s3r_getobject(s3r_t *handle, const char* url, s3r_buf_t* data, long* httpcodep)
+{
+    int ret_value = SUCCEED;
+    long httpcode = 0;
+    VString* content = vsnew();
+
+    TRACE(0,"handle=%p url=%s data=%p",handle,url,data);
+
+#if S3COMMS_DEBUG_TRACE
+    fprintf(stdout, "called NCH5_s3comms_s3r_getobject.\n");
+#endif
+
+    /*********************
+     * Execute           *
+     *********************/
+
+    if((ret_value = NCH5_s3comms_s3r_execute(handle, url, HTTPGET, NULL, NULL, NULL, NULL, &httpcode, content)))
+        HGOTO_ERROR(H5E_ARGS, ret_value, FAIL, "execute failed.");
+    if(data) {
+	data->count = vslength(content);
+	data->content = vsextract(content);
+    }
+
+done:
+    if(httpcodep) *httpcodep = httpcode;
+    vsfree(content);
+    curl_reset(handle);
+    return UNTRACE(ret_value);
+} /* NCH5_s3comms_s3r_getobject */
+
 /*----------------------------------------------------------------------------
  * Function: NCH5_s3comms_s3r_write()
  * Return:
@@ -1321,14 +1682,109 @@ done:
  */
 int
 NCH5_s3comms_s3r_write(s3r_t *handle, const char* url, const s3r_buf_t* data, long* httpcodep)
+{
+    int ret_value = SUCCEED;
+
+    TRACE(0,"handle=%p url=%s |data|=%d",handle,url,data->count);
+
+#if S3COMMS_DEBUG_TRACE
+    fprintf(stdout, "called NCH5_s3comms_s3r_write.\n");
+#endif
+
+    ret_value = s3r_put(handle, url, data, NULL, NULL, httpcodep);
+    return UNTRACE(ret_value);
+} /* NCH5_s3comms_s3r_write */
+
+/*----------------------------------------------------------------------------
+ * Function: NCH5_s3comms_s3r_uploadpart()
+ * Purpose:
+ *     PUT one part of a multipart upload; `url` carries the partNumber
+ *     and uploadId query.  The ETag returned for the part, which is
+ *     needed to complete the upload, is returned in `etagp`
+ *     (including its quotes).
+ * Return:
+ *     - SUCCESS: `SUCCEED`
+ *     - FAILURE: `FAIL`
+ *----------------------------------------------------------------------------
+ */
+int
+NCH5_s3comms_s3r_uploadpart(s3r_t *handle, const char* url, const s3r_buf_t* data, char** etagp, long* httpcodep)
+{
+    int ret_value = SUCCEED;
+    char* line = NULL;
+    char* value = NULL;
+    size_t len;
+
+    TRACE(0,"handle=%p url=%s |data|=%d",handle,url,data->count);
+
+    if((ret_value = s3r_put(handle, url, data, "ETag", &line, httpcodep)))
+        HGOTO_ERROR(H5E_ARGS, ret_value, FAIL, "s3r_put failed.");
+
+    /* line is "ETag: <value>\r\n" */
+    if(line != NULL && (value = strchr(line,':')) != NULL) {
+        for(value++;*value == ' ' || *value == '\t';value++);
+        for(len=strlen(value);len > 0 && isspace((unsigned char)value[len-1]);len--);
+        value[len] = '\0';
+        if(etagp) *etagp = strdup(value);
+    }
+
+done:
+    nullfree(line);
+    return UNTRACE(ret_value);
+} /* NCH5_s3comms_s3r_uploadpart */
+
+/*----------------------------------------------------------------------------
+ * Function: NCH5_s3comms_s3r_post()
+ * Purpose:
+ *     POST `body` (may be NULL) with the given Content-Type
+ *     and return the response body.
+ * Return:
+ *     - SUCCESS: `SUCCEED`
+ *     - FAILURE: `FAIL`
+ *----------------------------------------------------------------------------
+ */
+int
+NCH5_s3comms_s3r_post(s3r_t *handle, const char* url, const char* contenttype, const s3r_buf_t* body, s3r_buf_t* response, long* httpcodep)
+{
+    int ret_value = SUCCEED;
+    const char* otherheaders[3] = {"Content-Type", NULL, NULL};
+    long httpcode = 0;
+    VString* wrap = vsnew();
+    VString* content = vsnew();
+
+    TRACE(0,"handle=%p url=%s",handle,url);
+
+    otherheaders[1] = contenttype;
+    if(body != NULL && body->count > 0) {
+        vssetcontents(wrap,body->content,body->count);
+        vssetlength(wrap,body->count);
+    }
+    if((ret_value = NCH5_s3comms_s3r_execute(handle, url, HTTPPOST, NULL, NULL, otherheaders, wrap, &httpcode, content)))
+        HGOTO_ERROR(H5E_ARGS, ret_value, FAIL, "execute failed.");
+    if(response) {
+        response->count = vslength(content);
+        response->content = vsextract(content);
+    }
+
+done:
+    if(httpcodep) *httpcodep = httpcode;
+    if(vslength(wrap) > 0) (void)vsextract(wrap); /* the body is the caller's */
+    vsfree(wrap);
+    vsfree(content);
+    curl_reset(handle);
+    return UNTRACE(ret_value);
+} /* NCH5_s3comms_s3r_post */
+
+/* PUT data to url; if header is defined, return the response's header line in valuep */
+static int
+s3r_put(s3r_t *handle, const char* url, const s3r_buf_t* data, const char* header, char** valuep, long* httpcodep)
 {
     int ret_value = SUCCEED;
     VList* otherheaders = vlistnew();
     char digits[64];
     long httpcode = 0;
     VString* wrap = vsnew();
-
-    TRACE(0,"handle=%p url=%s |data|=%d",handle,url,data->count);
+    VString* line = (header != NULL ? vsnew() : NULL);
 
     snprintf(digits,sizeof(digits),"%llu",(unsigned long long)data->count);
 
@@ -1338,29 +1794,27 @@ NCH5_s3comms_s3r_write(s3r_t *handle, const char* url, const s3r_buf_t* data, lo
     vlistpush(otherheaders,strdup("binary/octet-stream"));
     vlistpush(otherheaders,NULL);
 
-#if S3COMMS_DEBUG_TRACE
-    fprintf(stdout, "called NCH5_s3comms_s3r_write.\n");
-#endif
-
     /*********************
      * Execute           *
      *********************/
 
     vssetcontents(wrap,data->content,data->count);
     vssetlength(wrap,data->count);
-    if((ret_value = NCH5_s3comms_s3r_execute(handle, url, HTTPPUT, NULL, NULL, (const char**)vlistcontents(otherheaders), &httpcode, wrap)))
+    if((ret_value = NCH5_s3comms_s3r_execute(handle, url, HTTPPUT, NULL, header, (const char**)vlistcontents(otherheaders), wrap, &httpcode, line)))
         HGOTO_ERROR(H5E_ARGS, ret_value, FAIL, "execute failed.");
+    if(valuep && vslength(line) > 0)
+        *valuep = vsextract(line);
 
-    
 done:
     if(httpcodep) *httpcodep = httpcode;
     (void)vsextract(wrap);
     vsfree(wrap);
+    vsfree(line);
     /* clean any malloc'd resources */
     vlistfreeall(otherheaders);
     curl_reset(handle);
-    return UNTRACE(ret_value);
-} /* NCH5_s3comms_s3r_write */
+    return ret_value;
+}
 
 /*----------------------------------------------------------------------------
  * Function: NCH5_s3comms_s3r_getkeys()
@@ -1388,7 +1842,7 @@ NCH5_s3comms_s3r_getkeys(s3r_t *handle, const char* url, s3r_buf_t* response, lo
      * Execute           *
      *********************/
 
-    if((SUCCEED != NCH5_s3comms_s3r_execute(handle, url, HTTPGET, NULL, NULL, otherheaders, &httpcode, content)))
+    if((SUCCEED != NCH5_s3comms_s3r_execute(handle, url, HTTPGET, NULL, NULL, otherheaders, NULL, &httpcode, content)))
         HGOTO_ERROR(H5E_ARGS, ret_value, FAIL, "execute failed.");
     if(response) {
 	response->count = vslength(content);
@@ -1475,6 +1929,7 @@ NCH5_s3comms_aws_canonical_request(VString* canonical_request_dest, VString* sig
     
     const char* sverb = verbtext(verb);
     const char* query_params = (query?query:"");
+    const char* p;
 
     /* "query params" refers to the optional element in the URL, e.g.
      *     http://bucket.aws.com/myfile.txt?max-keys=2&prefix=J
@@ -1504,7 +1959,17 @@ NCH5_s3comms_aws_canonical_request(VString* canonical_request_dest, VString* sig
     vscat(canonical_request_dest,"\n");
     vscat(canonical_request_dest,http_request->resource);
     vscat(canonical_request_dest,"\n");
-    vscat(canonical_request_dest,query_params);
+    /* Every parameter needs its '=', even with no value ("?uploads");
+       the parameters are assumed to be encoded and sorted already */
+    for(p=query_params;*p;) {
+        const char* end = strchr(p,'&');
+        size_t len = (end == NULL ? strlen(p) : (size_t)(end - p));
+        if(p != query_params) vscat(canonical_request_dest,"&");
+        if(len > 0) vsappendn(canonical_request_dest,p,len); /* n == 0 means strlen */
+        if(memchr(p,'=',len) == NULL) vscat(canonical_request_dest,"=");
+        p += len;
+        if(*p == '&') p++;
+    }
     vscat(canonical_request_dest,"\n");
     
     /* write in canonical headers, building signed headers concurrently */
@@ -2385,6 +2850,10 @@ request_setup(s3r_t* handle, const char* url, HTTPVerb verb, struct s3r_cbstruct
     /* Common setup (possibly overridden below) */
     if (CURLE_OK != curl_easy_setopt(curlh, CURLOPT_URL, url))
         HGOTO_ERROR(H5E_ARGS, NC_EINVAL, NULL, "error while setting CURL option (CURLOPT_URL).");
+    if (CURLE_OK != curl_easy_setopt(curlh, CURLOPT_WRITEDATA, NULL))
+        HGOTO_ERROR(H5E_ARGS, NC_EINVAL, FAIL, "error while setting CURL option (CURLOPT_WRITEDATA).");
+    if (CURLE_OK != curl_easy_setopt(curlh, CURLOPT_WRITEFUNCTION, curldiscardcallback))
+        HGOTO_ERROR(H5E_ARGS, NC_EINVAL, NULL, "error while setting CURL option (CURLOPT_WRITEFUNCTION).");
 
     switch (verb) {
     case HTTPGET:
@@ -2402,6 +2871,24 @@ request_setup(s3r_t* handle, const char* url, HTTPVerb verb, struct s3r_cbstruct
             HGOTO_ERROR(H5E_ARGS, NC_EINVAL, FAIL, "error while setting CURL option (CURLOPT_READDATA).");
         if (CURLE_OK != curl_easy_setopt(curlh, CURLOPT_READFUNCTION, curlreadcallback))
             HGOTO_ERROR(H5E_ARGS, NC_EINVAL, NULL, "error while setting CURL option (CURLOPT_READFUNCTION).");
+        if (sds->key != NULL) {
+            if (CURLE_OK != curl_easy_setopt(curlh, CURLOPT_HEADERDATA, sds))
+                HGOTO_ERROR(H5E_ARGS, NC_EINVAL, FAIL, "error while setting CURL option (CURLOPT_HEADERDATA).");
+            if (CURLE_OK != curl_easy_setopt(curlh, CURLOPT_HEADERFUNCTION, curlheadercallback))
+                HGOTO_ERROR(H5E_ARGS, NC_EINVAL, NULL, "error while setting CURL option (CURLOPT_HEADERFUNCTION).");
+        }
+        break;
+    case HTTPPOST:
+        if (CURLE_OK != curl_easy_setopt(curlh, CURLOPT_POST, 1L))
+            HGOTO_ERROR(H5E_ARGS, NC_EINVAL, NULL, "error while setting CURL option (CURLOPT_POST).");
+        if (CURLE_OK != curl_easy_setopt(curlh, CURLOPT_POSTFIELDSIZE_LARGE, (curl_off_t)vslength(sds->payload)))
+            HGOTO_ERROR(H5E_ARGS, NC_EINVAL, NULL, "error while setting CURL option (CURLOPT_POSTFIELDSIZE_LARGE).");
+        if (CURLE_OK != curl_easy_setopt(curlh, CURLOPT_POSTFIELDS, (vslength(sds->payload) > 0 ? vscontents(sds->payload) : "")))
+            HGOTO_ERROR(H5E_ARGS, NC_EINVAL, NULL, "error while setting CURL option (CURLOPT_POSTFIELDS).");
+        if (CURLE_OK != curl_easy_setopt(curlh, CURLOPT_WRITEDATA, sds))
+            HGOTO_ERROR(H5E_ARGS, NC_EINVAL, FAIL, "error while setting CURL option (CURLOPT_WRITEDATA).");
+        if (CURLE_OK != curl_easy_setopt(curlh, CURLOPT_WRITEFUNCTION, curlwritecallback))
+            HGOTO_ERROR(H5E_ARGS, NC_EINVAL, NULL, "error while setting CURL option (CURLOPT_WRITEFUNCTION).");
         break;
     case HTTPHEAD:
         if (CURLE_OK != curl_easy_setopt(curlh, CURLOPT_NOBODY, 1L))
@@ -2419,7 +2906,6 @@ request_setup(s3r_t* handle, const char* url, HTTPVerb verb, struct s3r_cbstruct
         if (CURLE_OK != curl_easy_setopt(curlh, CURLOPT_HEADERFUNCTION, curlheadercallback))
             HGOTO_ERROR(H5E_ARGS, NC_EINVAL, NULL, "error while setting CURL option (CURLOPT_HEADERFUNCTION).");
        break;
-    case HTTPPOST:
     default: 
             HGOTO_ERROR(H5E_ARGS, NC_EINVAL, NULL, "Illegal verb: %d.",(int)verb);
             break;
@@ -2511,7 +2997,7 @@ build_request(s3r_t* handle, NCURI* purl,
             HGOTO_ERROR(H5E_ARGS, NC_EINVAL, FAIL, "unable to set x-amz-date header");
 
     /* Compute SHA256 of upload data, if any */
-    if(verb == HTTPPUT && payload != NULL) {
+    if((verb == HTTPPUT || verb == HTTPPOST) && payload != NULL) {
             unsigned char sha256csum[SHA256_DIGEST_LENGTH];
 #if 0
             SHA256((const unsigned char*)vscontents(payload),vslength(payload),sha256csum);
@@ -2753,6 +3239,10 @@ curl_reset(s3r_t* handle)
     if(CURLE_OK != curl_easy_setopt(curlh, CURLOPT_CUSTOMREQUEST, NULL))
         HGOTO_ERROR(H5E_ARGS, NC_EINVAL, FAIL, "error while setting CURL option (CURLOPT_CUSTOMREQUEST).");
 
+    if (CURLE_OK != curl_easy_setopt(curlh, CURLOPT_POSTFIELDS, NULL))
+        HGOTO_ERROR(H5E_ARGS, NC_EINVAL, FAIL, "error while setting CURL option (CURLOPT_POSTFIELDS).");
+
+    /* Must follow CURLOPT_POSTFIELDS, which selects POST */
     if (CURLE_OK != curl_easy_setopt(curlh, CURLOPT_HTTPGET, 1L))
         HGOTO_ERROR(H5E_ARGS, NC_EINVAL, NULL, "error while setting CURL option (CURLOPT_HTTPGET).");
 
@@ -502,6 +502,8 @@ EXTERNL hrb_t *NCH5_s3comms_hrb_init_request(const char *resource, const char *h
  * DECLARATION OF S3REQUEST ROUTINES *
  *************************************/
 
+EXTERNL int NCH5_s3comms_finalize(void);
+
 EXTERNL s3r_t *NCH5_s3comms_s3r_open(const char* root, NCS3SVC svc, const char* region, const char* id, const char* access_key);
 
 EXTERNL int NCH5_s3comms_s3r_close(s3r_t *handle);
@@ -510,8 +512,14 @@ EXTERNL int NCH5_s3comms_s3r_connect(s3r_t *handle, const char *url, const char
 
 EXTERNL int NCH5_s3comms_s3r_read(s3r_t *handle, const char* url, size_t offset, size_t len, s3r_buf_t* data, long* httpcodep);
 
+EXTERNL int NCH5_s3comms_s3r_getobject(s3r_t *handle, const char* url, s3r_buf_t* data, long* httpcodep);
+
 EXTERNL int NCH5_s3comms_s3r_write(s3r_t *handle, const char* url, const s3r_buf_t* data, long* httpcodep);
 
+EXTERNL int NCH5_s3comms_s3r_uploadpart(s3r_t *handle, const char* url, const s3r_buf_t* data, char** etagp, long* httpcodep);
+
+EXTERNL int NCH5_s3comms_s3r_post(s3r_t *handle, const char* url, const char* contenttype, const s3r_buf_t* body, s3r_buf_t* response, long* httpcodep);
+
 EXTERNL int NCH5_s3comms_s3r_getkeys(s3r_t *handle, const char* url, s3r_buf_t* response, long* httpcodep);
 
 EXTERNL int NCH5_s3comms_s3r_getsize(s3r_t *handle, const char* url, long long * sizep, long* httpcodep);
@@ -55,22 +55,90 @@ static int ncjbreakpoint(int err) {return err;}
 
 /* JSON_WORD Subsumes Number also */
 #define JSON_WORD "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_$+-."
+#define NCJ_ISWORD(c) (((c) >= 'a' && (c) <= 'z') || ((c) >= 'A' && (c) <= 'Z') || ((c) >= '0' && (c) <= '9') \
+		       || (c) == '_' || (c) == '$' || (c) == '+' || (c) == '-' || (c) == '.')
 
 #define NCJ_DEFAULTALLOC 16
 
+/* Dicts with at least this many keys are given a hash index */
+#define NCJ_INDEX_THRESHOLD 16
+
+/**************************************************/
+/* Open addressing hash index over the keys of a dict.
+   It is kept up to date by the functions in this file that add
+   keys to a dict; lookups only read it, so concurrent lookups
+   are safe. A dict whose list was changed by other means is
+   detected (contents or len changed) and searched linearly.
+*/
+struct NCjindex {
+    size_t nslots; /* power of 2 */
+    size_t nkeys; /* no. of keys indexed: keys 0..nkeys-1 */
+    struct NCjson** contents; /* list contents that were indexed */
+    size_t* slots; /* 1 + key number; 0 => empty slot */
+};
+
 /**************************************************/
 typedef struct NCJparser {
     char* text;
+    size_t textlen; /* |text| after trimming */
     char* pos;
-    size_t yylen; /* |yytext| */
+    size_t yylen; /* space allocated for yytext */
     char* yytext; /* string or word */
+    size_t yytextlen; /* strlen(yytext) */
+    int token; /* last token lexed */
     long long num;
     int tf;
     int status; /* NCJ_ERR|NCJ_OK */
     unsigned flags;
 #     define NCJ_TRACE 1
+    const NCJcallbacks* callbacks; /* receive the parse events */
+    void* state; /* passed to the callbacks */
 } NCJparser;
 
+/**************************************************/
+/* Arena for NCJFLAG_ARENA parses: the nodes, strings and lists
+   of the tree are carved from a few large blocks that are all
+   freed with the root. The parts of a node that live in the arena
+   are marked so that NCJreclaim leaves them alone; anything later
+   added to such a tree is allocated as usual and reclaimed as usual.
+   Nodes of an arena tree must not outlive its root.
+*/
+
+/* NCjson.flags */
+#define NCJ_ARENA_NODE   1 /* the node itself is in an arena */
+#define NCJ_ARENA_STRING 2 /* node->string is in an arena */
+#define NCJ_ARENA_ROOT   4 /* the node is the json field of a struct NCjarenaroot */
+
+#define NCJ_ARENA_MINBLOCK (16*1024)
+#define NCJ_ARENA_MAXBLOCK (1024*1024)
+
+struct NCjblock {
+    struct NCjblock* next;
+    size_t size; /* usable bytes following this header */
+    size_t used;
+};
+
+struct NCjarena {
+    struct NCjblock* blocks; /* the first one is being carved */
+    size_t blocksize; /* size of the next block */
+};
+
+struct NCjarenaroot {
+    NCjson json; /* must be first */
+    struct NCjarena arena;
+};
+
+/* State of the tree builder driven by the parse events */
+typedef struct NCJbuilder {
+    NCJparser* parser;
+    int arenamode;
+    struct NCjarena* arena; /* arenamode: set when the root is created */
+    size_t top, alloc;
+    NCjson** stack; /* finished values and open containers */
+    size_t depth, falloc;
+    size_t* frames; /* stack index of the first member of each open container */
+} NCJbuilder;
+
 /* This is used only by the unparser */
 typedef struct NCJbuf {
     size_t len; /* |text|; does not include nul terminator */
@@ -99,9 +167,19 @@ static char* tokenname(int token);
 
 /**************************************************/
 /* Forward */
-static int NCJparseR(NCJparser* parser, NCjson**);
-static int NCJparseArray(NCJparser* parser, struct NCjlist* array);
-static int NCJparseDict(NCJparser* parser, struct NCjlist* dict);
+static int NCJparserinit(NCJparser* parser, size_t len, const char* text, unsigned flags);
+static void NCJparserclear(NCJparser* parser);
+static int NCJparseT(NCJparser* parser);
+static int NCJparseR(NCJparser* parser, int token);
+static int NCJparseArray(NCJparser* parser);
+static int NCJparseDict(NCJparser* parser);
+static int buildbegin(void* state, int sort);
+static int buildend(void* state, int sort);
+static int buildkey(void* state, const char* key, size_t len);
+static int buildvalue(void* state, int sort, const char* text, size_t len);
+static void builderclear(NCJbuilder* builder);
+static void* arenaalloc(struct NCjarena* arena, size_t size, size_t align);
+static void arenafree(struct NCjarena* arena);
 static int testbool(const char* word);
 static int testint(const char* word);
 static int testdouble(const char* word);
@@ -116,6 +194,9 @@ static char unescape1(char c);
 static int listappend(struct NCjlist* list, NCjson* element);
 static int listsetalloc(struct NCjlist* list, size_t sz);
 static int listlookup(const struct NCjlist* list, const char* key, size_t* indexp);
+static size_t keyhash(const char* key);
+static void indexfree(struct NCjlist* dict);
+static void indexsync(struct NCjlist* dict);
 
 static int NCJcloneArray(const NCjson* array, NCjson** clonep);
 static int NCJcloneDict(const NCjson* dict, NCjson** clonep);
@@ -137,6 +218,8 @@ static int bytesappendc(NCJbuf* bufp, char c);
 static const char* NANINF[] = {"-infinity","infinity","-infinityf","infinityf","nan","nanf"};
 static const size_t NNANINF = 6;
 
+static const NCJcallbacks NCJbuildcallbacks = {buildbegin,buildend,buildkey,buildvalue};
+
 /**************************************************/
 
 OPTSTATIC int
@@ -150,12 +233,54 @@ OPTSTATIC int
 NCJparsen(size_t len, const char* text, unsigned flags, NCjson** jsonp)
 {
     int stat = NCJ_OK;
-    NCJparser* parser = NULL;
-    NCjson* json = NULL;
+    NCJparser parser;
+    NCJbuilder builder;
+
+    memset(&parser,0,sizeof(parser));
+    memset(&builder,0,sizeof(builder));
+    builder.parser = &parser;
+    builder.arenamode = ((flags & NCJFLAG_ARENA) != 0);
+    if((stat = NCJparserinit(&parser,len,text,flags))==NCJ_ERR) goto done;
+    parser.callbacks = &NCJbuildcallbacks;
+    parser.state = &builder;
+    if((stat = NCJparseT(&parser))==NCJ_ERR) goto done;
+    if(builder.top != 1 || builder.depth != 0)
+	{stat = NCJTHROW(NCJ_ERR); goto done;}
+    *jsonp = builder.stack[0];
+    builder.top = 0;
+
+done:
+    NCJparserclear(&parser);
+    builderclear(&builder);
+    return NCJTHROW(stat);
+}
 
-    parser = calloc(1,sizeof(NCJparser));
-    if(parser == NULL)
+OPTSTATIC int
+NCJparsecb(size_t len, const char* text, unsigned flags, const NCJcallbacks* callbacks, void* state)
+{
+    int stat = NCJ_OK;
+    NCJparser parser;
+
+    memset(&parser,0,sizeof(parser));
+    if(callbacks == NULL)
 	{stat = NCJTHROW(NCJ_ERR); goto done;}
+    if((stat = NCJparserinit(&parser,len,text,flags))==NCJ_ERR) goto done;
+    parser.callbacks = callbacks;
+    parser.state = state;
+    stat = NCJparseT(&parser);
+
+done:
+    NCJparserclear(&parser);
+    return NCJTHROW(stat);
+}
+
+/* Set up a parser on a private copy of the text */
+static int
+NCJparserinit(NCJparser* parser, size_t len, const char* text, unsigned flags)
+{
+    int stat = NCJ_OK;
+
+    memset(parser,0,sizeof(NCJparser));
     parser->flags = flags;
     parser->text = (char*)malloc(len+1+1);
     if(parser->text == NULL)
@@ -173,122 +298,101 @@ NCJparsen(size_t len, const char* text, unsigned flags, NCjson** jsonp)
 	{stat = NCJTHROW(NCJ_ERR); goto done;}
     parser->text[len] = '\0';
     parser->text[len+1] = '\0';
+    parser->textlen = len;
     parser->pos = &parser->text[0];
     parser->status = NCJ_OK;
 #ifdef NCJDEBUG
 fprintf(stderr,"json: |%s|\n",parser->text);
 #endif /*NCJDEBUG*/
-    if((stat=NCJparseR(parser,&json))==NCJ_ERR) goto done;
-    /* Must consume all of the input */
-    if(parser->pos != (parser->text+len)) {stat = NCJ_ERR; goto done;}
-    *jsonp = json;
-    json = NULL;
+done:
+    return NCJTHROW(stat);
+}
+
+static void
+NCJparserclear(NCJparser* parser)
+{
+    nullfree(parser->text);
+    nullfree(parser->yytext);
+    parser->text = NULL;
+    parser->yytext = NULL;
+}
+
+/* Parse the whole text as a single value */
+static int
+NCJparseT(NCJparser* parser)
+{
+    int stat = NCJ_OK;
 
+    if((stat = NCJparseR(parser,NCJlex(parser)))==NCJ_ERR) goto done;
+    /* Must consume all of the input */
+    if(parser->pos != (parser->text+parser->textlen)) {stat = NCJTHROW(NCJ_ERR); goto done;}
 done:
-    if(parser != NULL) {
-	nullfree(parser->text);
-	nullfree(parser->yytext);
-	free(parser);
-    }
-    (void)NCJreclaim(json);
     return NCJTHROW(stat);
 }
 
 /*
 Simple recursive descent
 intertwined with dict and list parsers.
+Each value is reported to the parser callbacks as it is recognized.
 
 Invariants:
-1. The json argument is provided by caller and filled in by NCJparseR.
-2. Each call pushed back last unconsumed token
+1. The first token of the value has already been lexed and is passed as an argument.
+2. On return, the last token of the value has been consumed.
 */
 
 static int
-NCJparseR(NCJparser* parser, NCjson** jsonp)
+NCJparseR(NCJparser* parser, int token)
 {
     int stat = NCJ_OK;
-    int token = NCJ_UNDEF;
-    NCjson* json = NULL;
+    const NCJcallbacks* cb = parser->callbacks;
 
-    if(jsonp == NULL)
-	{stat = NCJTHROW(NCJ_ERR); goto done;}
-    if((token = NCJlex(parser)) == NCJ_UNDEF)
-	{stat = NCJTHROW(NCJ_ERR); goto done;}
     switch (token) {
-    case NCJ_EOF:
-	break;
     case NCJ_NULL:
-        if((stat = NCJnew(NCJ_NULL,&json))==NCJ_ERR) goto done;
-	break;
     case NCJ_BOOLEAN:
-        if((stat = NCJnew(NCJ_BOOLEAN,&json))==NCJ_ERR) goto done;
-	json->string = strdup(parser->yytext);
-	break;
     case NCJ_INT:
-        if((stat = NCJnew(NCJ_INT,&json))==NCJ_ERR) goto done;
-	json->string = strdup(parser->yytext);
-	break;
     case NCJ_DOUBLE:
-        if((stat = NCJnew(NCJ_DOUBLE,&json))==NCJ_ERR) goto done;
-	json->string = strdup(parser->yytext);
-	break;
     case NCJ_STRING:
-        if((stat = NCJnew(NCJ_STRING,&json))==NCJ_ERR) goto done;
-	json->string = strdup(parser->yytext);
+	if(cb->value != NULL && cb->value(parser->state,token,parser->yytext,parser->yytextlen) != NCJ_OK)
+	    {stat = NCJTHROW(NCJ_ERR); goto done;}
 	break;
     case NCJ_LBRACE:
-        if((stat = NCJnew(NCJ_DICT,&json))==NCJ_ERR) goto done;
-	if((stat = NCJparseDict(parser, &json->list))==NCJ_ERR) goto done;
+	if((stat = NCJparseDict(parser))==NCJ_ERR) goto done;
 	break;
     case NCJ_LBRACKET:
-        if((stat = NCJnew(NCJ_ARRAY,&json))==NCJ_ERR) goto done;
-	if((stat = NCJparseArray(parser, &json->list))==NCJ_ERR) goto done;
-	break;
-    case NCJ_RBRACE: /* We hit end of the dict we are parsing */
-	parser->pos--; /* pushback so NCJparseArray will catch */
-	json = NULL;
-	break;
-    case NCJ_RBRACKET:
-	parser->pos--; /* pushback so NCJparseDict will catch */
-	json = NULL;
+	if((stat = NCJparseArray(parser))==NCJ_ERR) goto done;
 	break;
+    case NCJ_EOF:
+    case NCJ_UNDEF:
     default:
 	stat = NCJTHROW(NCJ_ERR);
 	break;
     }
-    if(jsonp && json) {*jsonp = json; json = NULL;}
 
 done:
-    NCJreclaim(json);
     return NCJTHROW(stat);
 }
 
 static int
-NCJparseArray(NCJparser* parser, struct NCjlist* arrayp)
+NCJparseArray(NCJparser* parser)
 {
     int stat = NCJ_OK;
     int token = NCJ_UNDEF;
-    NCjson* element = NULL;
-    int stop = 0;
+    const NCJcallbacks* cb = parser->callbacks;
 
     /* [ ^e1,e2, ...en] */
 
-    while(!stop) {
-	/* Recurse to get the value ei (might be null) */
-	if((stat = NCJparseR(parser,&element))==NCJ_ERR) goto done;
-	token = NCJlex(parser); /* Get next token */
+    if(cb->begin != NULL && cb->begin(parser->state,NCJ_ARRAY) != NCJ_OK)
+	{stat = NCJTHROW(NCJ_ERR); goto done;}
+    token = NCJlex(parser);
+    while(token != NCJ_RBRACKET) {
+	/* Recurse to get the value ei */
+	if((stat = NCJparseR(parser,token))==NCJ_ERR) goto done;
 	/* Next token should be comma or rbracket */
-	switch(token) {
+	switch((token = NCJlex(parser))) {
 	case NCJ_RBRACKET:
-	    if(element != NULL) listappend(arrayp,element);
-	    element = NULL;
-	    stop = 1;
 	    break;
 	case NCJ_COMMA:
-	    /* Append the ei to the list */
-	    if(element == NULL) {stat = NCJTHROW(NCJ_ERR); goto done;} /* error */
-	    listappend(arrayp,element);
-	    element = NULL;
+	    token = NCJlex(parser); /* a trailing comma is tolerated */
 	    break;
 	case NCJ_EOF:
 	case NCJ_UNDEF:
@@ -297,36 +401,34 @@ NCJparseArray(NCJparser* parser, struct NCjlist* arrayp)
 	    goto done;
 	}	
     }	
+    if(cb->end != NULL && cb->end(parser->state,NCJ_ARRAY) != NCJ_OK)
+	{stat = NCJTHROW(NCJ_ERR); goto done;}
 
 done:
-    if(element != NULL)
-	NCJreclaim(element);
     return NCJTHROW(stat);
 }
 
 static int
-NCJparseDict(NCJparser* parser, struct NCjlist* dictp)
+NCJparseDict(NCJparser* parser)
 {
     int stat = NCJ_OK;
     int token = NCJ_UNDEF;
-    NCjson* value = NULL;
-    NCjson* key = NULL;
-    int stop = 0;
+    const NCJcallbacks* cb = parser->callbacks;
 
     /* { ^k1:v1,k2:v2, ...kn:vn] */
 
-    while(!stop) {
-	/* Get the key, which must be a word of some sort */
-	token = NCJlex(parser);
+    if(cb->begin != NULL && cb->begin(parser->state,NCJ_DICT) != NCJ_OK)
+	{stat = NCJTHROW(NCJ_ERR); goto done;}
+    token = NCJlex(parser);
+    while(token != NCJ_RBRACE) {
+	/* The key must be a word of some sort */
 	switch(token) {
 	case NCJ_STRING:
 	case NCJ_BOOLEAN:
-	case NCJ_INT: case NCJ_DOUBLE: {
- 	    if((stat=NCJnewstring(token,parser->yytext,&key))==NCJ_ERR) goto done;
-	    } break;
-	case NCJ_RBRACE: /* End of containing Dict */
-	    stop = 1;
-	    continue; /* leave loop */
+	case NCJ_INT: case NCJ_DOUBLE:
+	    if(cb->key != NULL && cb->key(parser->state,parser->yytext,parser->yytextlen) != NCJ_OK)
+		{stat = NCJTHROW(NCJ_ERR); goto done;}
+	    break;
 	case NCJ_EOF: case NCJ_UNDEF:
 	default:
 	    stat = NCJTHROW(NCJ_ERR);
@@ -339,18 +441,13 @@ NCJparseDict(NCJparser* parser, struct NCjlist* dictp)
 	default: stat = NCJTHROW(NCJ_ERR); goto done;
 	}    
 	/* Get the value */
-	if((stat = NCJparseR(parser,&value))==NCJ_ERR) goto done;
+	if((stat = NCJparseR(parser,NCJlex(parser)))==NCJ_ERR) goto done;
         /* Next token must be comma or RBRACE */
 	switch((token = NCJlex(parser))) {
 	case NCJ_RBRACE:
-	    stop = 1;
-	    /* fall thru */
+	    break;
 	case NCJ_COMMA:
-	    /* Insert key value into dict: key first, then value */
-	    listappend(dictp,key);
-	    key = NULL;
-	    listappend(dictp,value);
-	    value = NULL;
+	    token = NCJlex(parser); /* a trailing comma is tolerated */
 	    break;
 	case NCJ_EOF:
 	case NCJ_UNDEF:
@@ -359,15 +456,202 @@ NCJparseDict(NCJparser* parser, struct NCjlist* dictp)
 	    goto done;
 	}	
     }	
+    if(cb->end != NULL && cb->end(parser->state,NCJ_DICT) != NCJ_OK)
+	{stat = NCJTHROW(NCJ_ERR); goto done;}
 
 done:
-    if(key != NULL)
-	NCJreclaim(key);
-    if(value != NULL)
-	NCJreclaim(value);
     return NCJTHROW(stat);
 }
 
+/**************************************************/
+/* Build an NCjson tree from the parse events */
+
+/* Make room for one more entry on the builder stack */
+static int
+builderreserve(NCJbuilder* builder)
+{
+    if(builder->top >= builder->alloc) {
+	size_t alloc = (builder->alloc < NCJ_DEFAULTALLOC ? NCJ_DEFAULTALLOC : 2*builder->alloc);
+	NCjson** stack = (NCjson**)realloc(builder->stack,alloc*sizeof(NCjson*));
+	if(stack == NULL) return NCJTHROW(NCJ_ERR);
+	builder->stack = stack;
+	builder->alloc = alloc;
+    }
+    return NCJ_OK;
+}
+
+/* Create a node and push it on the builder stack */
+static int
+buildnode(NCJbuilder* builder, int sort, const char* text, size_t len)
+{
+    int stat = NCJ_OK;
+    NCjson* json = NULL;
+    char* string = NULL;
+
+    if((stat = builderreserve(builder))==NCJ_ERR) goto done;
+    if(!builder->arenamode) {
+	if((stat = NCJnew(sort,&json))==NCJ_ERR) goto done;
+	if(text != NULL) {
+	    if((json->string = (char*)malloc(len+1)) == NULL)
+		{NCJreclaim(json); stat = NCJTHROW(NCJ_ERR); goto done;}
+	    memcpy(json->string,text,len);
+	    json->string[len] = '\0';
+	}
+    } else {
+	if(builder->arena == NULL) {
+	    /* The first node is the root; it carries the arena */
+	    struct NCjarenaroot* root = (struct NCjarenaroot*)calloc(1,sizeof(struct NCjarenaroot));
+	    if(root == NULL) {stat = NCJTHROW(NCJ_ERR); goto done;}
+	    root->arena.blocksize = NCJ_ARENA_MINBLOCK;
+	    builder->arena = &root->arena;
+	    json = &root->json;
+	    json->flags = NCJ_ARENA_ROOT;
+	} else {
+	    if((json = (NCjson*)arenaalloc(builder->arena,sizeof(NCjson),sizeof(void*))) == NULL)
+		{stat = NCJTHROW(NCJ_ERR); goto done;}
+	    memset(json,0,sizeof(NCjson));
+	    json->flags = NCJ_ARENA_NODE;
+	}
+	json->sort = sort;
+	/* A failure from here on is reclaimed with the root */
+	builder->stack[builder->top++] = json;
+	if(text != NULL) {
+	    if((string = (char*)arenaalloc(builder->arena,len+1,1)) == NULL)
+		{stat = NCJTHROW(NCJ_ERR); goto done;}
+	    memcpy(string,text,len);
+	    string[len] = '\0';
+	    json->string = string;
+	    json->flags |= NCJ_ARENA_STRING;
+	}
+	goto done;
+    }
+    builder->stack[builder->top++] = json;
+done:
+    return NCJTHROW(stat);
+}
+
+static int
+buildbegin(void* state, int sort)
+{
+    NCJbuilder* builder = (NCJbuilder*)state;
+    if(builder->depth >= builder->falloc) {
+	size_t falloc = (builder->falloc < NCJ_DEFAULTALLOC ? NCJ_DEFAULTALLOC : 2*builder->falloc);
+	size_t* frames = (size_t*)realloc(builder->frames,falloc*sizeof(size_t));
+	if(frames == NULL) return NCJTHROW(NCJ_ERR);
+	builder->frames = frames;
+	builder->falloc = falloc;
+    }
+    if(buildnode(builder,sort,NULL,0)==NCJ_ERR) return NCJTHROW(NCJ_ERR);
+    builder->frames[builder->depth++] = builder->top;
+    return NCJ_OK;
+}
+
+/* Move the members of the innermost container off the stack into its list */
+static int
+buildend(void* state, int sort)
+{
+    NCJbuilder* builder = (NCJbuilder*)state;
+    size_t start, n;
+    NCjson* container = NULL;
+    NCjson** contents = NULL;
+
+    assert(builder->depth > 0);
+    start = builder->frames[--builder->depth];
+    container = builder->stack[start-1];
+    assert(container->sort == sort);
+    n = builder->top - start;
+    if(n > 0) {
+	if(builder->arenamode)
+	    contents = (NCjson**)arenaalloc(builder->arena,n*sizeof(NCjson*),sizeof(void*));
+	else
+	    contents = (NCjson**)malloc(n*sizeof(NCjson*));
+	if(contents == NULL) return NCJTHROW(NCJ_ERR);
+	memcpy(contents,&builder->stack[start],n*sizeof(NCjson*));
+	container->list.contents = contents;
+	container->list.len = n;
+	container->list.alloc = (builder->arenamode ? 0 : n);
+	builder->top = start;
+	if(sort == NCJ_DICT) indexsync(&container->list);
+    }
+    return NCJ_OK;
+}
+
+static int
+buildkey(void* state, const char* key, size_t len)
+{
+    NCJbuilder* builder = (NCJbuilder*)state;
+    /* Keep the sort of unquoted keys */
+    return NCJTHROW(buildnode(builder,builder->parser->token,key,len));
+}
+
+static int
+buildvalue(void* state, int sort, const char* text, size_t len)
+{
+    NCJbuilder* builder = (NCJbuilder*)state;
+    return NCJTHROW(buildnode(builder,sort,(sort == NCJ_NULL ? NULL : text),len));
+}
+
+/* Reclaim whatever is left on the builder stack */
+static void
+builderclear(NCJbuilder* builder)
+{
+    /* Top down, so that an arena root is reclaimed last */
+    while(builder->top > 0)
+	NCJreclaim(builder->stack[--builder->top]);
+    nullfree(builder->stack);
+    nullfree(builder->frames);
+    memset(builder,0,sizeof(NCJbuilder));
+}
+
+/**************************************************/
+/* Arena allocation */
+
+/* Carve size bytes aligned to align (a power of 2) from an arena */
+static void*
+arenaalloc(struct NCjarena* arena, size_t size, size_t align)
+{
+    struct NCjblock* block = arena->blocks;
+    size_t pad = 0;
+
+    if(block != NULL) pad = (align - (block->used & (align-1))) & (align-1);
+    if(block == NULL || block->used + pad + size > block->size) {
+	if(size > arena->blocksize / 4) {
+	    /* Large requests get a block of their own behind the current one */
+	    if((block = (struct NCjblock*)malloc(sizeof(struct NCjblock)+size)) == NULL) return NULL;
+	    block->size = size;
+	    block->used = size;
+	    if(arena->blocks == NULL) {
+		block->next = NULL;
+		arena->blocks = block;
+	    } else {
+		block->next = arena->blocks->next;
+		arena->blocks->next = block;
+	    }
+	    return (void*)(block+1);
+	}
+	if((block = (struct NCjblock*)malloc(sizeof(struct NCjblock)+arena->blocksize)) == NULL) return NULL;
+	block->size = arena->blocksize;
+	block->used = 0;
+	block->next = arena->blocks;
+	arena->blocks = block;
+	pad = 0;
+	if(arena->blocksize < NCJ_ARENA_MAXBLOCK) arena->blocksize *= 2;
+    }
+    block->used += pad;
+    block->used += size;
+    return (void*)(((char*)(block+1)) + (block->used - size));
+}
+
+static void
+arenafree(struct NCjarena* arena)
+{
+    while(arena->blocks != NULL) {
+	struct NCjblock* next = arena->blocks->next;
+	free(arena->blocks);
+	arena->blocks = next;
+    }
+}
+
 static int
 NCJlex(NCJparser* parser)
 {
@@ -387,11 +671,11 @@ NCJlex(NCJparser* parser)
 	    c = *parser->pos;
 	    *parser->pos = (char)unescape1(c);
 	    continue;
-	} else if(strchr(JSON_WORD, c) != NULL) {
+	} else if(NCJ_ISWORD(c)) {
 	    start = parser->pos;
 	    for(;;) {
 		c = *parser->pos++;
-		if(c == '\0' || strchr(JSON_WORD,c) == NULL) break; /* end of word */
+		if(!NCJ_ISWORD(c)) break; /* end of word */
 	    }
 	    /* Pushback c */
 	    parser->pos--;
@@ -437,6 +721,7 @@ fprintf(stderr,"%s(%d): |%s|\n",tokenname(token),token,parser->yytext);
 done:
     if(parser->status == NCJ_ERR)
         token = NCJ_UNDEF;
+    parser->token = token;
 #ifdef NCJTRACE
     if(parser->flags & NCJ_TRACE) {
 	const char* txt = NULL;
@@ -469,12 +754,10 @@ testbool(const char* word)
 static int
 testint(const char* word)
 {
-    int ncvt;
-    long long i;
-    int count = 0;
+    char* end = NULL;
     /* Try to convert to number */
-    ncvt = sscanf(word,"%lld%n",&i,&count);
-    return (ncvt == 1 && strlen(word)==((size_t)count) ? 1 : 0);
+    (void)strtoll(word,&end,10);
+    return (end != word && *end == '\0' ? 1 : 0);
 }
 
 static int
@@ -490,17 +773,15 @@ nancmp(const void* keyp, const void* membpp)
 static int
 testdouble(const char* word)
 {
-    int ncvt;
-    double d;
-    int count = 0;
+    char* end = NULL;
     void* pos = NULL;
 
     /* Check for Nan and Infinity */
     pos = bsearch(word, NANINF, NNANINF, sizeof(char*), nancmp);
     if(pos != NULL) return 1;
     /* Try to convert to number */
-    ncvt = sscanf(word,"%lg%n",&d,&count); 
-    return (ncvt == 1 && strlen(word)==((size_t)count) ? 1 : 0);
+    (void)strtod(word,&end);
+    return (end != word && *end == '\0' ? 1 : 0);
 }
 
 static int
@@ -517,6 +798,7 @@ NCJyytext(NCJparser* parser, char* start, size_t pdlen)
     if(parser->yytext == NULL) return NCJTHROW(NCJ_ERR);
     memcpy(parser->yytext,start,len);
     parser->yytext[len] = '\0';
+    parser->yytextlen = len;
     return NCJTHROW(NCJ_OK);
 }
 
@@ -531,7 +813,7 @@ NCJreclaim(NCjson* json)
     case NCJ_DOUBLE:
     case NCJ_BOOLEAN:
     case NCJ_STRING: 
-	nullfree(json->string);
+	if(!(json->flags & NCJ_ARENA_STRING)) nullfree(json->string);
 	break;
     case NCJ_DICT:
 	NCJreclaimDict(&json->list);
@@ -541,7 +823,11 @@ NCJreclaim(NCjson* json)
 	break;
     default: break; /* nothing to reclaim */
     }
-    free(json);
+    /* The members of an arena tree have been reclaimed, so the arena can go */
+    if(json->flags & NCJ_ARENA_ROOT)
+	arenafree(&((struct NCjarenaroot*)json)->arena);
+    if(!(json->flags & NCJ_ARENA_NODE))
+	free(json);
 }
 
 static void
@@ -551,7 +837,7 @@ NCJreclaimArray(struct NCjlist* array)
     for(i=0;i<array->len;i++) {
 	NCJreclaim(array->contents[i]);
     }
-    nullfree(array->contents);
+    if(array->alloc > 0) nullfree(array->contents); /* else arena or empty */
     array->contents = NULL;
     array->len = 0;
 }
@@ -559,6 +845,7 @@ NCJreclaimArray(struct NCjlist* array)
 static void
 NCJreclaimDict(struct NCjlist* dict)
 {
+   indexfree(dict);
    NCJreclaimArray(dict);
 }
 
@@ -631,13 +918,8 @@ NCJdictget(const NCjson* dict, const char* key, const NCjson** jvaluep)
     if(dict == NULL || dict->sort != NCJ_DICT)
         {stat = NCJTHROW(NCJ_ERR); goto done;}
     if(jvaluep) {*jvaluep = NULL;}
-    for(i=0;i<NCJdictlength(dict);i++) {
-	NCjson* jkey = NCJdictkey(dict,i);
-	NCjson* jvalue  = NCJdictvalue(dict,i);
-	if(jkey->string != NULL && strcmp(jkey->string,key)==0) {
-	    if(jvaluep) {*jvaluep = jvalue;}
-	    break;
-	}	    
+    if(listlookup(&dict->list,key,&i) == NCJ_OK) {
+	if(jvaluep) {*jvaluep = dict->list.contents[i+1];}
     }
 
 done:
@@ -681,6 +963,7 @@ NCJunescape(NCJparser* parser)
 	*q++ = (char)c;
     }
     *q = '\0';
+    parser->yytextlen = (size_t)(q - parser->yytext);
     return NCJTHROW(NCJ_OK);    
 }
 
@@ -810,8 +1093,10 @@ listappend(struct NCjlist* list, NCjson* json)
 
     assert(list->len == 0 || list->contents != NULL);
     if(json == NULL) {stat = NCJTHROW(NCJ_ERR); goto done;}
-    /* Make space for two new elements; better than one, but still probably not optimal */
-    if((stat = listsetalloc(list,list->len + 2))<0) goto done;
+    /* Grow geometrically so that building a large list is linear */
+    if(list->len >= list->alloc) {
+        if((stat = listsetalloc(list,(list->len < NCJ_DEFAULTALLOC ? NCJ_DEFAULTALLOC : 2*list->len)))<0) goto done;
+    }
     /* Append the new item */
     list->contents[list->len++] = json;
 
@@ -829,20 +1114,112 @@ static int
 listlookup(const struct NCjlist* list, const char* key, size_t* indexp)
 {
     int stat = NCJ_OK;
-    int i,len,match = -1;
+    size_t i,len;
+    long long match = -1;
+    const struct NCjindex* index = NULL;
 
-    if(list == NULL || key == NULL || strlen(key) == 0 || list->len %2 == 1)
+    if(list == NULL || key == NULL)
 	{stat = NCJTHROW(NCJ_ERR); goto done;}
-    len = (int)list->len; /* => |list| < 2 billion or do */
-    for(i=0;i<len;i+=2) {
-	const NCjson* jkey = list->contents[i];
-	if(jkey != NULL && jkey->string != NULL && strcmp(jkey->string,key)==0) {match = i;break;}	    
+    len = list->len - (list->len % 2); /* ignore a trailing key without value */
+    index = list->index;
+    if(index != NULL && index->contents == list->contents && index->nkeys == len/2) {
+	size_t mask = index->nslots - 1;
+	for(i=keyhash(key) & mask;index->slots[i] != 0;i=(i+1) & mask) {
+	    const NCjson* jkey = list->contents[2*(index->slots[i]-1)];
+	    if(jkey != NULL && jkey->string != NULL && strcmp(jkey->string,key)==0)
+		{match = (long long)(2*(index->slots[i]-1)); break;}
+	}
+    } else {
+	for(i=0;i<len;i+=2) {
+	    const NCjson* jkey = list->contents[i];
+	    if(jkey != NULL && jkey->string != NULL && strcmp(jkey->string,key)==0) {match = (long long)i;break;}
+	}
     }
     if(match < 0) {stat = NCJ_EOF;}  else {if(indexp) *indexp = (size_t)match;}
 done:
     return NCJTHROW(stat);
 }
 
+/* FNV-1a */
+static size_t
+keyhash(const char* key)
+{
+    unsigned long long h = 14695981039346656037ULL;
+    for(;*key;key++) {h ^= (unsigned char)*key; h *= 1099511628211ULL;}
+    return (size_t)h;
+}
+
+static void
+indexfree(struct NCjlist* dict)
+{
+    if(dict->index != NULL) {
+	nullfree(dict->index->slots);
+	free(dict->index);
+	dict->index = NULL;
+    }
+}
+
+/* Add key number k; the first of duplicate keys wins, as for a linear search */
+static void
+indexadd(struct NCjindex* index, NCjson** contents, size_t k)
+{
+    size_t i, mask = index->nslots - 1;
+    const NCjson* jkey = contents[2*k];
+    if(jkey != NULL && jkey->string != NULL) {
+	for(i=keyhash(jkey->string) & mask;index->slots[i] != 0;i=(i+1) & mask) {
+	    const NCjson* jother = contents[2*(index->slots[i]-1)];
+	    if(jother != NULL && jother->string != NULL && strcmp(jother->string,jkey->string)==0)
+		break;
+	}
+	if(index->slots[i] == 0) index->slots[i] = k+1;
+    }
+    index->nkeys = k+1;
+}
+
+/* (Re)build the slots for at least nkeys keys */
+static int
+indexrehash(struct NCjlist* dict, size_t nkeys)
+{
+    struct NCjindex* index = dict->index;
+    size_t k, nslots = 2*NCJ_INDEX_THRESHOLD;
+    size_t* slots = NULL;
+
+    while(nslots < 2*nkeys) nslots *= 2; /* load <= 1/2 */
+    if((slots = (size_t*)calloc(nslots,sizeof(size_t))) == NULL) return NCJTHROW(NCJ_ERR);
+    nullfree(index->slots);
+    index->slots = slots;
+    index->nslots = nslots;
+    k = index->nkeys;
+    index->nkeys = 0;
+    while(index->nkeys < k) indexadd(index,dict->contents,index->nkeys);
+    return NCJ_OK;
+}
+
+/* Bring the index of a dict up to date with keys appended since
+   it was last synchronized, creating it once the dict is large enough.
+   Failure just leaves the dict unindexed.
+*/
+static void
+indexsync(struct NCjlist* dict)
+{
+    size_t nkeys = dict->len / 2;
+    struct NCjindex* index = dict->index;
+
+    if(index != NULL && (index->contents != dict->contents || index->nkeys > nkeys))
+	{indexfree(dict); index = NULL;} /* changed behind our back */
+    if(nkeys < NCJ_INDEX_THRESHOLD) return;
+    if(index == NULL) {
+	if((index = (struct NCjindex*)calloc(1,sizeof(struct NCjindex))) == NULL) return;
+	index->contents = dict->contents;
+	dict->index = index;
+	if(indexrehash(dict,nkeys)) {indexfree(dict); return;}
+    }
+    if(2*nkeys > index->nslots) {
+	if(indexrehash(dict,nkeys)) {indexfree(dict); return;}
+    }
+    while(index->nkeys < nkeys) indexadd(index,dict->contents,index->nkeys);
+}
+
 /* Increase the space available to dict/array.
    Even if alloc is zero, ensure that the object's list alloc is >= 1.
 @param list pointer to the list
@@ -859,16 +1236,19 @@ listsetalloc(struct NCjlist* list, size_t alloc)
     assert(list->alloc == 0 || list->contents != NULL);
     if(alloc == 0) alloc = 1; /* Guarantee that the list->content is not NULL */
     if(list->alloc >= alloc) goto done;
+    if(alloc < list->len) alloc = list->len; /* arena contents are copied out whole */
     /* Since alloc > list->alloc > 0, we need to allocate space */
     if((newcontents=(NCjson**)calloc(alloc,sizeof(NCjson*))) == NULL) {stat = NCJTHROW(NCJ_ERR); goto done;}
-    list->alloc = alloc;
     if(list->contents != NULL && list->len > 0) {
 	/* Preserve any existing contents */
 	memcpy((void*)newcontents,
 		(void*)list->contents,
 		sizeof(NCjson*)*list->len);
     }
-    free(list->contents);
+    if(list->index != NULL && list->index->contents == list->contents)
+	list->index->contents = newcontents; /* moved, not changed */
+    if(list->alloc > 0) free(list->contents); /* else it belongs to an arena */
+    list->alloc = alloc;
     list->contents = newcontents; newcontents = NULL;
     assert(list->alloc > 0 && list->contents != NULL);
 done:
@@ -980,25 +1360,16 @@ NCJinsert(NCjson* jdict, const char* key, NCjson* jvalue)
     size_t i;
     NCjson* jkey = NULL;
     NCjson* jprev = NULL;
-    int found;
 
     if(jdict == NULL
 	|| NCJsort(jdict) != NCJ_DICT
 	|| key == NULL
 	|| jvalue == NULL) {stat = NCJTHROW(NCJ_ERR); goto done;}
-    for(found=(-1),i=0;i < NCJdictlength(jdict); i++) {
-	jkey = NCJdictkey(jdict,i);
-	if (jkey != NULL && strcmp(NCJstring(jkey), key) == 0) {
-	    found = (int)i;
-	    break;
-	}
-    }
-    if(found >= 0) {
-	jprev = NCJdictvalue(jdict,found);
+    if(listlookup(&jdict->list,key,&i) == NCJ_OK) {
+	jprev = jdict->list.contents[i+1];
 	// replace existing values for new key
 	NCJreclaim(jprev); // free old value
-	NCJdictvalue(jdict,found) = jvalue; jvalue = NULL;
-	jkey = NULL; /* avoid reclamation */
+	jdict->list.contents[i+1] = jvalue; jvalue = NULL;
     } else { /* not found */
         if((stat=listsetalloc(&jdict->list,jdict->list.len+2))<0) goto done;
 	NCJcheck(NCJnewstring(NCJ_STRING, key, (NCjson**)&jkey));
@@ -1057,8 +1428,11 @@ NCJappend(NCjson* object, NCjson* value)
 	return NCJTHROW(NCJ_ERR);
     switch (object->sort) {
     case NCJ_ARRAY:
+	listappend(&object->list,value);
+	break;
     case NCJ_DICT:
 	listappend(&object->list,value);
+	indexsync(&object->list);
 	break;
     default:
 	return NCJTHROW(NCJ_ERR);
@@ -1120,13 +1494,15 @@ NCJoverwrite(NCjson* dict, const char* key, NCjson* jvalue)
     switch(stat=listlookup(&dict->list,key,&index)) {
     case NCJ_OK:
 	/* Overwrite value part */
-	oldvalue = dict->list.contents[index];
-	dict->list.contents[index] = jvalue;
+	oldvalue = dict->list.contents[index+1];
+	dict->list.contents[index+1] = jvalue;
 	NCJreclaim(oldvalue);
 	break;
     case NCJ_EOF: /* Not found */
 	if((stat=listsetalloc(&dict->list,dict->list.len+2))<0) goto done;
+	if((stat = NCJnewstring(NCJ_STRING,key,&jkey))==NCJ_ERR) goto done;
 	if((stat = NCJappend(dict,jkey))==NCJ_ERR) goto done;
+	jkey = NULL;
 	if((stat = NCJappend(dict,jvalue))==NCJ_ERR) goto done;
 	break;
     case NCJ_ERR:
@@ -1319,6 +1695,9 @@ NCJdictsort(NCjson* jdict)
 {
     assert(NCJsort(jdict) == NCJ_DICT);
     qsort((void*)NCJcontents(jdict),NCJdictlength(jdict),2*sizeof(NCjson*),pairsort);
+    /* The keys have moved */
+    indexfree(&jdict->list);
+    indexsync(&jdict->list);
 }
 
 /* Hack to avoid static unused warning */
@@ -1329,6 +1708,7 @@ netcdf_supresswarnings(void)
     ignore = (void*)netcdf_supresswarnings;
     ignore = (void*)NCJparse;
     ignore = (void*)NCJparsen;
+    ignore = (void*)NCJparsecb;
     ignore = (void*)NCJreclaim;
     ignore = (void*)NCJnew;
     ignore = (void*)NCJnewstring;
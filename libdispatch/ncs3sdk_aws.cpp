@@ -521,8 +521,19 @@ NC_s3sdkread(void* s3client0, const char* bucket, const char* pathkey, size64_t
     object_request.SetRange(range);
     auto get_object_result = AWSS3GET(s3client)->GetObject(object_request);
     if(!get_object_result.IsSuccess()) {
-	if(errmsgp) *errmsgp = makeerrmsg(get_object_result.GetError(),key);
-	stat = NC_ES3;
+	switch (get_object_result.GetError().GetErrorType()) {
+	case Aws::S3::S3Errors::NO_SUCH_KEY:
+	case Aws::S3::S3Errors::RESOURCE_NOT_FOUND:
+	    stat = NC_EEMPTY;
+	    break;
+	default:
+	    /* A range starting past the end of the object */
+	    if(get_object_result.GetError().GetResponseCode() == Aws::Http::HttpResponseCode::REQUESTED_RANGE_NOT_SATISFIABLE)
+		{stat = NC_EEDGE; break;}
+	    if(errmsgp) *errmsgp = makeerrmsg(get_object_result.GetError(),key);
+	    stat = NC_ES3;
+	    break;
+	}
     } else {
 	/* Get the whole result */
 	Aws::IOStream &result = get_object_result.GetResultWithOwnership().GetBody();
@@ -530,6 +541,7 @@ NC_s3sdkread(void* s3client0, const char* bucket, const char* pathkey, size64_t
 	/* Verify actual result size */
 	size_t slen = str.size();
 	if(slen > count) return NC_ES3;
+	if(slen < count) stat = NC_EEDGE; /* range runs past the end of the object */
 	const char* s = str.c_str();
 	if(content)
 	    memcpy(content,s,slen);
@@ -538,6 +550,60 @@ NC_s3sdkread(void* s3client0, const char* bucket, const char* pathkey, size64_t
     return NCUNTRACE(stat);
 }
 
+/*
+Read a whole object with a single GET (no Range header),
+so the caller does not need a prior HEAD to get its size.
+@return NC_NOERR if success
+@return NC_EEMPTY if object at key has no content.
+@return NC_EXXX if fail
+*/
+/*EXTERNL*/ int
+NC_s3sdkreadobject(void* s3client0, const char* bucket, const char* pathkey, size64_t* lenp, void** contentp, char** errmsgp)
+{
+    int stat = NC_NOERR;
+    const char* key = NULL;
+
+    NCTRACE(11,"bucket=%s pathkey=%s",bucket,pathkey);
+
+    AWSS3CLIENT s3client = (AWSS3CLIENT)s3client0;
+
+    if(errmsgp) *errmsgp = NULL;
+    if(*pathkey != '/') return NC_EINTERNAL;
+    if((stat = makes3key(pathkey,&key))) return NCUNTRACE(stat);
+
+    Aws::S3::Model::GetObjectRequest object_request;
+    object_request.SetBucket(bucket);
+    object_request.SetKey(key);
+    auto get_object_result = AWSS3GET(s3client)->GetObject(object_request);
+    if(!get_object_result.IsSuccess()) {
+	switch (get_object_result.GetError().GetErrorType()) {
+	case Aws::S3::S3Errors::NO_SUCH_KEY:
+	case Aws::S3::S3Errors::RESOURCE_NOT_FOUND:
+	    stat = NC_EEMPTY;
+	    break;
+	case Aws::S3::S3Errors::ACCESS_DENIED:
+	    stat = NC_EACCESS;
+	    /* fall thru */
+	default:
+	    if(!stat) stat = NC_ES3;
+	    if(errmsgp) *errmsgp = makeerrmsg(get_object_result.GetError(),key);
+	    break;
+	}
+    } else {
+	/* Get the whole result */
+	Aws::IOStream &result = get_object_result.GetResultWithOwnership().GetBody();
+	std::string str((std::istreambuf_iterator<char>(result)),std::istreambuf_iterator<char>());
+	size_t slen = str.size();
+	char* content = (char*)malloc(slen+1);
+	if(content == NULL) return NCUNTRACE(NC_ENOMEM);
+	memcpy(content,str.c_str(),slen);
+	content[slen] = '\0';
+	if(lenp) *lenp = (size64_t)slen;
+	if(contentp) *contentp = content; else free(content);
+    }
+    return NCUNTRACEX(stat,"len=%d",(int)(lenp?*lenp:-1));
+}
+
 /*
 For S3, I can see no way to do a byterange write;
 so we are effectively writing the whole object
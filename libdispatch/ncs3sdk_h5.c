@@ -15,11 +15,13 @@
 #include "ncrc.h"
 #include "ncxml.h"
 #include "ncutil.h"
+#include "ncglobal.h"
+#include "ncthreadpool.h"
 
 #include "ncs3sdk.h"
 #include "nch5s3comms.h"
 
-#define NCTRACING
+#undef NCTRACING /* The trace stack is process-wide; clients may be used by concurrent threads */
 #ifdef NCTRACING
 #define NCTRACE(level,fmt,...) nctrace((level),__func__,fmt,##__VA_ARGS__)
 #define NCTRACEMORE(level,fmt,...) nctracemore((level),fmt,##__VA_ARGS__)
@@ -50,8 +52,34 @@ extern char* strdup(const char*);
 typedef struct NCS3CLIENT {
     char*	rooturl;      /* The URL (minus any fragment) for the dataset root path (excludes bucket on down) */ 
     s3r_t*	h5s3client; /* From h5s3comms */  
+    /* Multipart uploads: see s3multipartwrite */
+    NCS3SVC	svc;
+    char*	region;
+    char*	accessid;
+    char*	accesskey;
+    NClist*	lanes; /* NClist<s3r_t*>: extra handles for concurrent part uploads */
+    NCthreadpool* pool; /* created on first multipart upload */
 } NCS3CLIENT;
 
+/* A multipart upload in progress */
+struct S3UPLOAD {
+    const char* url; /* of the object */
+    const char* uploadquery; /* "uploadId=<encoded id>" */
+    const char* content;
+    size64 count;
+    size64 partsize;
+    size_t nparts;
+    size_t nlanes;
+    char** etags; /* [nparts] */
+};
+
+/* Lane i uploads parts i, i+nlanes, i+2*nlanes, ... over its own handle */
+struct S3LANE {
+    struct S3UPLOAD* upload;
+    s3r_t* handle;
+    size_t lane;
+};
+
 struct Object {
     NClist* checksumalgorithms; /* NClist<char*> */
     NClist* checksumtypes; /* NClist<char*> */
@@ -105,6 +133,10 @@ static int s3commonprefixes(NClist* list, NClist* keys);
 static int mergekeysets(NClist*,NClist*,NClist*);
 static int rawtokeys(s3r_buf_t* response, NClist* keys, NClist* lengths, struct LISTOBJECTSV2** listv2p);
 static int httptonc(long httpcode);
+static int s3multipartwrite(NCS3CLIENT* s3client, const char* url, size64 count, const void* content);
+static int s3uploadlane(void* arg);
+static int parse_initiatemultipartuploadresult(char* xml, unsigned long long xmllen, char** uploadidp);
+static int parse_completemultipartuploadresult(char* xml, unsigned long long xmllen);
 
 static int queryadd(NClist* query, const char* key, const char* value);
 static int queryend(NClist* query, char** querystring);
@@ -137,6 +169,8 @@ NC_s3sdkfinalize(void)
     if(!ncs3_finalized) {
 	ncs3_initialized = 0;
 	ncs3_finalized = 1;
+	/* Release the shared DNS and TLS session caches */
+	(void)NCH5_s3comms_finalize();
     }
     return NC_NOERR;
 }
@@ -188,6 +222,11 @@ NC_s3sdkcreateclient(NCS3INFO* info)
     if(s3client == NULL) goto done;
     NC_s3getcredentials(info->profile, NULL, &accessid, &accesskey);
     if((s3client->rooturl = makes3rooturl(info))==NULL) {stat = NC_ENOMEM; goto done;}
+    s3client->svc = info->svc;
+    s3client->region = nulldup(info->region);
+    s3client->accessid = (accessid == NULL ? NULL : strdup(accessid));
+    s3client->accesskey = (accesskey == NULL ? NULL : strdup(accesskey));
+    s3client->lanes = nclistnew();
     s3client->h5s3client = NCH5_s3comms_s3r_open(s3client->rooturl,info->svc,info->region,accessid,accesskey);
     if(s3client->h5s3client == NULL) {stat = NC_ES3; goto done;}
 
@@ -289,6 +328,8 @@ done:
 
 /*
 @return NC_NOERR if success
+@return NC_ENOOBJECT if object at key does not exist
+@return NC_EEDGE if the range runs past the end of the object
 @return NC_EXXX if fail
 */
 /*EXTERNL*/ int
@@ -308,12 +349,43 @@ NC_s3sdkread(void* s3client0, const char* bucket, const char* pathkey, size64_t
     data.count = count;
     data.content = content;
     if((stat = NCH5_s3comms_s3r_read(s3client->h5s3client,ncbytescontents(url),(size_t)start,(size_t)count,&data,&httpcode))) goto done;
-    stat = httptonc(httpcode);    
+    if(httpcode == 416) {stat = NC_EEDGE; goto done;} /* Range Not Satisfiable */
+    if((stat = httptonc(httpcode))) goto done;
+    if(data.count < count) stat = NC_EEDGE;
 done:
     ncbytesfree(url);
     return NCUNTRACE(stat);
 }
 
+/*
+Read a whole object with one GET.
+@return NC_NOERR if success
+@return NC_ENOOBJECT if object at key does not exist
+@return NC_EXXX if fail
+*/
+/*EXTERNL*/ int
+NC_s3sdkreadobject(void* s3client0, const char* bucket, const char* pathkey, size64_t* lenp, void** contentp, char** errmsgp)
+{
+    int stat = NC_NOERR;
+    NCS3CLIENT* s3client = (NCS3CLIENT*)s3client0;
+    NCbytes* url = ncbytesnew();
+    struct s3r_buf_t data = {0,NULL};
+    long httpcode = 0;
+
+    NCTRACE(11,"bucket=%s pathkey=%s",bucket,pathkey);
+
+    if((stat = makes3fullpath(s3client->rooturl,bucket,pathkey,NULL,url))) goto done;
+
+    if((stat = NCH5_s3comms_s3r_getobject(s3client->h5s3client,ncbytescontents(url),&data,&httpcode))) goto done;
+    if((stat = httptonc(httpcode))) goto done;
+    if(lenp) *lenp = data.count;
+    if(contentp) {*contentp = data.content; data.content = NULL;}
+done:
+    nullfree(data.content);
+    ncbytesfree(url);
+    return NCUNTRACEX(stat,"len=%d",PTRVAL(int,lenp,-1));
+}
+
 /*
 For S3, I can see no way to do a byterange write;
 so we are effectively writing the whole object
@@ -326,11 +398,18 @@ NC_s3sdkwriteobject(void* s3client0, const char* bucket, const char* pathkey,  s
     NCbytes* url = ncbytesnew();
     s3r_buf_t data;
     long httpcode = 0;
+    size_t threshold = NC_getglobalstate()->zarr.multipart;
 
     NCTRACE(11,"bucket=%s pathkey=%s count=%llu content=%p",bucket,pathkey,count,content);
 
     if((stat = makes3fullpath(s3client->rooturl,bucket,pathkey,NULL,url))) goto done;
 
+    /* Large objects are uploaded in parts */
+    if(threshold > 0 && count >= threshold && count > NCS3MINPARTSIZE) {
+	stat = s3multipartwrite(s3client,ncbytescontents(url),count,content);
+	goto done;
+    }
+
     /* Write the data */
     data.count = count;
     data.content = (void*)content;
@@ -626,15 +705,254 @@ static void
 s3client_destroy(NCS3CLIENT* s3client)
 {
     if(s3client) {
+	size_t i;
+	if(s3client->pool) ncthreadpoolfree(s3client->pool);
+	for(i=0;i<nclistlength(s3client->lanes);i++)
+	    (void)NCH5_s3comms_s3r_close((s3r_t*)nclistget(s3client->lanes,i));
+	nclistfree(s3client->lanes);
 	nullfree(s3client->rooturl);
+	nullfree(s3client->region);
+	nullfree(s3client->accessid);
+	nullfree(s3client->accesskey);
         (void)NCH5_s3comms_s3r_close(s3client->h5s3client);
         free(s3client);
     }
 }
 
+/**************************************************/
+/* Multipart upload */
+
+/*
+Upload count bytes of content to url as a multipart upload:
+initiate the upload, PUT its parts with up to ZARR.S3.MULTIPART.THREADS
+in flight, each lane over its own request handle (the handles share
+TLS sessions), then complete the upload with the parts' ETags.
+On failure the upload is aborted so the server discards its parts.
+The parts are sent straight from content, which is not copied.
+*/
+static int
+s3multipartwrite(NCS3CLIENT* s3client, const char* url, size64 count, const void* content)
+{
+    int stat = NC_NOERR;
+    NCglobalstate* gs = NC_getglobalstate();
+    struct S3UPLOAD upload;
+    struct S3LANE* lanes = NULL;
+    NClist* query = nclistnew();
+    char* uploadquery = NULL;
+    char* uploadid = NULL;
+    NCbytes* buf = ncbytesnew();
+    s3r_buf_t response = {0,NULL};
+    s3r_buf_t body;
+    long httpcode = 0;
+    size_t i, nthreads;
+    char digits[64];
+
+    memset(&upload,0,sizeof(upload));
+    upload.url = url;
+    upload.content = (const char*)content;
+    upload.count = count;
+    if((stat = NC_s3multipartsplit(count,gs->zarr.multipart_partsize,&upload.partsize,&upload.nparts))) goto done;
+    nthreads = (gs->zarr.multipart_threads == 0 ? 1 : gs->zarr.multipart_threads);
+    upload.nlanes = (upload.nparts < nthreads ? upload.nparts : nthreads);
+    if((upload.etags = (char**)calloc(upload.nparts,sizeof(char*)))==NULL) {stat = NC_ENOMEM; goto done;}
+    if((lanes = (struct S3LANE*)calloc(upload.nlanes,sizeof(struct S3LANE)))==NULL) {stat = NC_ENOMEM; goto done;}
+
+    /* Initiate */
+    ncbytescat(buf,url);
+    ncbytescat(buf,"?uploads=");
+    if((stat = NCH5_s3comms_s3r_post(s3client->h5s3client,ncbytescontents(buf),"binary/octet-stream",NULL,&response,&httpcode))) goto done;
+    if((stat = httptonc(httpcode))) goto done;
+    if((stat = parse_initiatemultipartuploadresult(response.content,response.count,&uploadid))) goto done;
+    if((stat = queryadd(query,"uploadId",uploadid))) goto done;
+    if((stat = queryend(query,&uploadquery))) goto done;
+    upload.uploadquery = uploadquery;
+
+    /* Upload the parts */
+    if(s3client->pool == NULL && (stat = ncthreadpoolnew(nthreads,&s3client->pool))) goto abort;
+    while(nclistlength(s3client->lanes) + 1 < upload.nlanes) {
+	s3r_t* handle = NCH5_s3comms_s3r_open(s3client->rooturl,s3client->svc,s3client->region,s3client->accessid,s3client->accesskey);
+	if(handle == NULL) {stat = NC_ES3; goto abort;}
+	nclistpush(s3client->lanes,handle);
+    }
+    for(i=0;i<upload.nlanes;i++) {
+	lanes[i].upload = &upload;
+	lanes[i].lane = i;
+	lanes[i].handle = (i == 0 ? s3client->h5s3client : (s3r_t*)nclistget(s3client->lanes,i-1));
+	if((stat = ncthreadpoolsubmit(s3client->pool,s3uploadlane,&lanes[i]))) break;
+    }
+    {int stat2 = ncthreadpoolwait(s3client->pool); if(stat == NC_NOERR) stat = stat2;}
+    if(stat) goto abort;
+
+    /* Complete */
+    ncbytesclear(buf);
+    ncbytescat(buf,"<CompleteMultipartUpload>");
+    for(i=0;i<upload.nparts;i++) {
+	snprintf(digits,sizeof(digits),"<Part><PartNumber>%zu</PartNumber><ETag>",i+1);
+	ncbytescat(buf,digits);
+	ncbytescat(buf,upload.etags[i]);
+	ncbytescat(buf,"</ETag></Part>");
+    }
+    ncbytescat(buf,"</CompleteMultipartUpload>");
+    body.count = ncbyteslength(buf);
+    body.content = ncbytescontents(buf);
+    nullfree(response.content); response.content = NULL; response.count = 0;
+    {
+	NCbytes* completeurl = ncbytesnew();
+	ncbytescat(completeurl,url);
+	ncbytescat(completeurl,"?");
+	ncbytescat(completeurl,uploadquery);
+	stat = NCH5_s3comms_s3r_post(s3client->h5s3client,ncbytescontents(completeurl),"application/xml",&body,&response,&httpcode);
+	ncbytesfree(completeurl);
+    }
+    if(stat) goto abort;
+    if((stat = httptonc(httpcode))) goto abort;
+    /* A failed completion may still return 200, with an <Error> body */
+    if((stat = parse_completemultipartuploadresult(response.content,response.count))) goto abort;
+    goto done;
+
+abort:
+    ncbytesclear(buf);
+    ncbytescat(buf,url);
+    ncbytescat(buf,"?");
+    ncbytescat(buf,uploadquery);
+    (void)NCH5_s3comms_s3r_deletekey(s3client->h5s3client,ncbytescontents(buf),&httpcode);
+
+done:
+    if(upload.etags != NULL) {
+	for(i=0;i<upload.nparts;i++) nullfree(upload.etags[i]);
+	free(upload.etags);
+    }
+    nullfree(lanes);
+    nclistfreeall(query);
+    nullfree(uploadquery);
+    nullfree(uploadid);
+    nullfree(response.content);
+    ncbytesfree(buf);
+    return NCTHROW(stat);
+}
+
+/* Upload the parts of one lane */
+static int
+s3uploadlane(void* arg)
+{
+    int stat = NC_NOERR;
+    struct S3LANE* lane = (struct S3LANE*)arg;
+    struct S3UPLOAD* upload = lane->upload;
+    NCbytes* url = ncbytesnew();
+    s3r_buf_t data;
+    long httpcode = 0;
+    size_t part;
+    char digits[64];
+
+    for(part=lane->lane;part<upload->nparts;part+=upload->nlanes) {
+	size64 offset = (size64)part * upload->partsize;
+	data.count = (upload->count - offset < upload->partsize ? upload->count - offset : upload->partsize);
+	data.content = (void*)(upload->content + offset);
+	/* Query keys must be in sorted order for signing */
+	snprintf(digits,sizeof(digits),"?partNumber=%zu&",part+1);
+	ncbytesclear(url);
+	ncbytescat(url,upload->url);
+	ncbytescat(url,digits);
+	ncbytescat(url,upload->uploadquery);
+	if((stat = NCH5_s3comms_s3r_uploadpart(lane->handle,ncbytescontents(url),&data,&upload->etags[part],&httpcode))) goto done;
+	if((stat = httptonc(httpcode))) goto done;
+	if(upload->etags[part] == NULL) {stat = NC_ES3; goto done;}
+    }
+done:
+    ncbytesfree(url);
+    return stat;
+}
+
 /**************************************************/
 /* XML Response Parser(s) */
 
+/**
+Action: Create multipart upload
+Response XML:
+=========================
+HTTP/1.1 200
+<?xml version="1.0" encoding="UTF-8"?>
+<InitiateMultipartUploadResult>
+   <Bucket>string</Bucket>
+   <Key>string</Key>
+   <UploadId>string</UploadId>
+</InitiateMultipartUploadResult>
+=========================
+*/
+
+static int
+parse_initiatemultipartuploadresult(char* xml, unsigned long long xmllen, char** uploadidp)
+{
+    int stat = NC_NOERR;
+    ncxml_doc_t doc = NULL;
+    ncxml_t x;
+    char* uploadid = NULL;
+
+    if(xml == NULL || (doc = ncxml_parse(xml,xmllen)) == NULL) {stat = NC_ES3; goto done;}
+    ncxml_t dom = ncxml_root(doc);
+
+    /* Verify top level element */
+    if(strcmp(ncxml_name(dom),"InitiateMultipartUploadResult")!=0) {
+	nclog(NCLOGERR,"Expected: <InitiateMultipartUploadResult> actual: <%s>",ncxml_name(dom));
+	stat = NC_ES3;
+	goto done;
+    }
+    for(x=ncxml_child_first(dom);x != NULL;x=ncxml_child_next(x)) {
+	if(strcmp(ncxml_name(x),"UploadId")==0) {
+	    nullfree(uploadid);
+	    uploadid = trim(ncxml_text(x),RECLAIM);
+	}
+    }
+    if(uploadid == NULL || *uploadid == '\0') {stat = NC_ES3; goto done;}
+    if(uploadidp) {*uploadidp = uploadid; uploadid = NULL;}
+
+done:
+    nullfree(uploadid);
+    if(doc) ncxml_free(doc);
+    return NCTHROW(stat);
+}
+
+/**
+Action: Complete multipart upload
+Response XML:
+=========================
+HTTP/1.1 200
+<?xml version="1.0" encoding="UTF-8"?>
+<CompleteMultipartUploadResult>
+   <Location>string</Location>
+   <Bucket>string</Bucket>
+   <Key>string</Key>
+   <ETag>string</ETag>
+</CompleteMultipartUploadResult>
+=========================
+or, when the completion fails after the 200 has been sent:
+<Error>
+   <Code>string</Code>
+   <Message>string</Message>
+</Error>
+*/
+
+static int
+parse_completemultipartuploadresult(char* xml, unsigned long long xmllen)
+{
+    int stat = NC_NOERR;
+    ncxml_doc_t doc = NULL;
+
+    if(xml == NULL || (doc = ncxml_parse(xml,xmllen)) == NULL) {stat = NC_ES3; goto done;}
+    const char* root = ncxml_name(ncxml_root(doc));
+
+    /* Verify top level element */
+    if(root == NULL || strcmp(root,"CompleteMultipartUploadResult")!=0) {
+	nclog(NCLOGERR,"Expected: <CompleteMultipartUploadResult> actual: <%s>",NT(root));
+	stat = NC_ES3;
+	goto done;
+    }
+
+done:
+    if(doc) ncxml_free(doc);
+    return NCTHROW(stat);
+}
+
 /**
 Action: List objects (V2)
 Response XML:
@@ -0,0 +1,237 @@
+/*
+  Copyright (c) 1998-2018 University Corporation for Atmospheric Research/Unidata
+  See LICENSE.txt for license information.
+*/
+
+/** \file \internal
+    Internal netcdf-4 functions.
+
+    This file contains functions for manipulating NCthreadpool objects.
+    The pool is deliberately minimal: a FIFO of (function,argument)
+    pairs drained by a fixed set of worker threads. It is used by
+    the storage layers to overlap independent I/O and (de)compression
+    operations while the caller waits.
+*/
+
+#include "config.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "netcdf.h"
+#include "ncthreadpool.h"
+
+#if defined(HAVE_PTHREAD_H) && !defined(_WIN32)
+#define USEPTHREADS
+#include <pthread.h>
+#endif
+
+/* Upper limit on the number of workers in one pool */
+#define MAXTHREADS 64
+
+typedef struct NCtask {
+    struct NCtask* next;
+    NCtaskfcn fcn;
+    void* arg;
+} NCtask;
+
+struct NCthreadpool {
+    size_t nthreads; /* 0 => synchronous */
+    size_t pending; /* |queued| + |running| */
+    int stat; /* first task error since last wait */
+    int shutdown;
+    NCtask* head; /* FIFO of queued tasks */
+    NCtask* tail;
+#ifdef USEPTHREADS
+    pthread_mutex_t lock;
+    pthread_cond_t work; /* signalled when a task is queued or on shutdown */
+    pthread_cond_t idle; /* signalled when pending drops to zero */
+    pthread_t* threads;
+#endif
+};
+
+/* Record a task result; caller holds the lock */
+static void
+recordstat(NCthreadpool* pool, int stat)
+{
+    if(stat != NC_NOERR && pool->stat == NC_NOERR)
+        pool->stat = stat;
+}
+
+#ifdef USEPTHREADS
+static void*
+worker(void* arg)
+{
+    NCthreadpool* pool = (NCthreadpool*)arg;
+    for(;;) {
+	NCtask* task = NULL;
+	int stat;
+	pthread_mutex_lock(&pool->lock);
+	while(pool->head == NULL && !pool->shutdown)
+	    pthread_cond_wait(&pool->work,&pool->lock);
+	if(pool->head == NULL) { /* shutdown and nothing left to do */
+	    pthread_mutex_unlock(&pool->lock);
+	    break;
+	}
+	task = pool->head;
+	pool->head = task->next;
+	if(pool->head == NULL) pool->tail = NULL;
+	pthread_mutex_unlock(&pool->lock);
+
+	stat = task->fcn(task->arg);
+	free(task);
+
+	pthread_mutex_lock(&pool->lock);
+	recordstat(pool,stat);
+	assert(pool->pending > 0);
+	pool->pending--;
+	if(pool->pending == 0)
+	    pthread_cond_broadcast(&pool->idle);
+	pthread_mutex_unlock(&pool->lock);
+    }
+    return NULL;
+}
+#endif /*USEPTHREADS*/
+
+int
+ncthreadpoolnew(size_t nthreads, NCthreadpool** poolp)
+{
+    int stat = NC_NOERR;
+    NCthreadpool* pool = NULL;
+
+    if(poolp == NULL) return NC_EINVAL;
+    *poolp = NULL;
+    if((pool = calloc(1,sizeof(NCthreadpool))) == NULL)
+        {stat = NC_ENOMEM; goto done;}
+#ifdef USEPTHREADS
+    if(nthreads > MAXTHREADS) nthreads = MAXTHREADS;
+    if(nthreads > 1) {
+	size_t i;
+	pthread_mutex_init(&pool->lock,NULL);
+	pthread_cond_init(&pool->work,NULL);
+	pthread_cond_init(&pool->idle,NULL);
+	if((pool->threads = calloc(nthreads,sizeof(pthread_t))) == NULL)
+	    {stat = NC_ENOMEM; goto done;}
+	for(i=0;i<nthreads;i++) {
+	    if(pthread_create(&pool->threads[i],NULL,worker,pool) != 0)
+	        break; /* Run with however many we got */
+	    pool->nthreads++;
+	}
+	if(pool->nthreads == 0) { /* Could not start any worker */
+	    nullfree(pool->threads);
+	    pool->threads = NULL;
+	    pthread_cond_destroy(&pool->idle);
+	    pthread_cond_destroy(&pool->work);
+	    pthread_mutex_destroy(&pool->lock);
+	}
+    }
+#else
+    (void)nthreads;
+#endif
+    *poolp = pool; pool = NULL;
+done:
+    if(pool) {
+#ifdef USEPTHREADS
+	nullfree(pool->threads);
+#endif
+	free(pool);
+    }
+    return stat;
+}
+
+int
+ncthreadpoolsubmit(NCthreadpool* pool, NCtaskfcn fcn, void* arg)
+{
+    NCtask* task = NULL;
+
+    if(pool == NULL || fcn == NULL) return NC_EINVAL;
+    if(pool->nthreads == 0) {
+	/* Synchronous execution */
+        recordstat(pool,fcn(arg));
+	return NC_NOERR;
+    }
+#ifdef USEPTHREADS
+    if((task = calloc(1,sizeof(NCtask))) == NULL) return NC_ENOMEM;
+    task->fcn = fcn;
+    task->arg = arg;
+    pthread_mutex_lock(&pool->lock);
+    if(pool->tail == NULL)
+        pool->head = task;
+    else
+        pool->tail->next = task;
+    pool->tail = task;
+    pool->pending++;
+    pthread_cond_signal(&pool->work);
+    pthread_mutex_unlock(&pool->lock);
+#else
+    (void)task;
+#endif
+    return NC_NOERR;
+}
+
+int
+ncthreadpoolwait(NCthreadpool* pool)
+{
+    int stat = NC_NOERR;
+    if(pool == NULL) return NC_EINVAL;
+#ifdef USEPTHREADS
+    if(pool->nthreads > 0) {
+        pthread_mutex_lock(&pool->lock);
+	while(pool->pending > 0)
+	    pthread_cond_wait(&pool->idle,&pool->lock);
+	stat = pool->stat;
+	pool->stat = NC_NOERR;
+        pthread_mutex_unlock(&pool->lock);
+	return stat;
+    }
+#endif
+    stat = pool->stat;
+    pool->stat = NC_NOERR;
+    return stat;
+}
+
+size_t
+ncthreadpoolpending(NCthreadpool* pool)
+{
+    size_t pending = 0;
+    if(pool == NULL) return 0;
+#ifdef USEPTHREADS
+    if(pool->nthreads > 0) {
+        pthread_mutex_lock(&pool->lock);
+	pending = pool->pending;
+        pthread_mutex_unlock(&pool->lock);
+    }
+#endif
+    return pending;
+}
+
+size_t
+ncthreadpoolsize(NCthreadpool* pool)
+{
+    return (pool == NULL ? 0 : pool->nthreads);
+}
+
+void
+ncthreadpoolfree(NCthreadpool* pool)
+{
+    if(pool == NULL) return;
+#ifdef USEPTHREADS
+    if(pool->nthreads > 0) {
+	size_t i;
+	(void)ncthreadpoolwait(pool);
+        pthread_mutex_lock(&pool->lock);
+	pool->shutdown = 1;
+	pthread_cond_broadcast(&pool->work);
+        pthread_mutex_unlock(&pool->lock);
+	for(i=0;i<pool->nthreads;i++)
+	    pthread_join(pool->threads[i],NULL);
+	nullfree(pool->threads);
+	pthread_cond_destroy(&pool->idle);
+	pthread_cond_destroy(&pool->work);
+	pthread_mutex_destroy(&pool->lock);
+    }
+#endif
+    assert(pool->head == NULL);
+    free(pool);
+}
@@ -276,6 +276,19 @@ ncxcachelast(NCxcache* cache)
     return cache->lru.prev->content;
 }
 
+void*
+ncxcachenext(NCxcache* cache, ncexhashkey_t hkey)
+{
+    uintptr_t inode = 0;
+    NCxnode* node = NULL;
+
+    if(cache == NULL) return NULL;
+    if(ncexhashget(cache->map,hkey,&inode)) return NULL; /* not present */
+    node = (NCxnode*)inode;
+    if(node->next == &cache->lru) return NULL; /* end of chain */
+    return node->next->content;
+}
+
 /* Insert node after current */
 static void
 insertafter(NCxnode* current, NCxnode* node)
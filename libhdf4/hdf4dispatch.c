@@ -112,6 +112,8 @@ static const NC_Dispatch HDF4_dispatcher = {
     NC_NOTNC4_inq_var_quantize,
 
     NC_NOOP_inq_filter_avail,
+
+    NCDEFAULT_get_vara_multi,
 };
 
 const NC_Dispatch *HDF4_dispatch_table = NULL;
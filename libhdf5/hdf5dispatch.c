@@ -111,6 +111,8 @@ static const NC_Dispatch HDF5_dispatcher = {
     NC4_inq_var_quantize,
     
     NC4_hdf5_inq_filter_avail,
+
+    NCDEFAULT_get_vara_multi,
 };
 
 const NC_Dispatch* HDF5_dispatch_table = NULL; /* moved here from ddispatch.c */
@@ -148,8 +148,13 @@ ncz_open_dataset(NC_FILE_INFO_T* file, NClist* controls)
 	    goto done;
     }
 
+    /* An in-memory image can only be used to initialize an in-memory store */
+    if(file->mem.inmemory && zinfo->controls.mapimpl != NCZM_MEM)
+	{stat = NC_EINMEMORY; goto done;}
+
     /* initialize map handle*/
-    if((stat = NCZ_get_map(file, uri, mode, zinfo->controls.flags,NULL,&zinfo->map))){
+    if((stat = NCZ_get_map(file, uri, mode, zinfo->controls.flags,
+			   (file->mem.inmemory ? &file->mem.memio : NULL),&zinfo->map))){
     	goto done;
     }
 
@@ -277,11 +282,20 @@ applycontrols(NCZ_FILE_INFO_T* zinfo)
 	    zinfo->controls.flags |= FLAG_PUREZARR;
 	else if(strcasecmp(p,NOXARRAYCONTROL)==0)
 	    noflags |= FLAG_XARRAYDIMS;
+	else if(strcasecmp(p,ZARRV2CONTROL)==0)
+	    zinfo->format.zarr = ZARRFORMAT2; /* on open, overridden by the dataset's own format */
+	else if(strcasecmp(p,ZARRV3CONTROL)==0)
+	    zinfo->format.zarr = ZARRFORMAT3;
 	else if(strcasecmp(p,"zip")==0) zinfo->controls.mapimpl = NCZM_ZIP;
 	else if(strcasecmp(p,"file")==0) zinfo->controls.mapimpl = NCZM_FILE;
 	else if(strcasecmp(p,"s3")==0) zinfo->controls.mapimpl = NCZM_S3;
+	else if(strcasecmp(p,"mem")==0) zinfo->controls.mapimpl = NCZM_MEM;
 	else if(strcasecmp(p,"consolidated") == 0)
 	        zinfo->controls.flags |= FLAG_CONSOLIDATED;
+	else if(strcasecmp(p,MMAPCONTROL) == 0)
+	        zinfo->controls.flags |= FLAG_MMAP;
+	else if(strcasecmp(p,INVENTORYCONTROL) == 0)
+	        zinfo->controls.flags |= FLAG_INVENTORY;
     }
     /* Apply negative controls by turning off negative flags */
     /* This is necessary to avoid order dependence of mode flags when both positive and negative flags are defined */
@@ -296,6 +310,15 @@ applycontrols(NCZ_FILE_INFO_T* zinfo)
 	if(strcasecmp(value,"fetch")==0)
 	    zinfo->controls.flags |= FLAG_SHOWFETCH;
     }
+    zinfo->controls.nthreads = NC_getglobalstate()->zarr.nthreads;
+    if((value = controllookup(zinfo->controllist,"nthreads")) != NULL) {
+	long n = strtol(value,NULL,10);
+	if(n >= 0) zinfo->controls.nthreads = (size_t)n;
+    }
+    if((value = controllookup(zinfo->controllist,"shard")) != NULL) {
+	long n = strtol(value,NULL,10);
+	if(n >= 0) zinfo->controls.shard = (size_t)n;
+    }
 done:
     nclistfreeall(modelist);
     return stat;
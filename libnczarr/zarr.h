@@ -38,11 +38,13 @@ EXTERNL int NCZ_get_superblock(NC_FILE_INFO_T* file, int* superblockp);
 EXTERNL int ncz_unload_jatts(NCZ_FILE_INFO_T*, NC_OBJ* container, NCjson* jattrs, NCjson* jtypes);
 
 /* zclose.c */
-EXTERNL int ncz_close_file(NC_FILE_INFO_T* file, int abort);
+EXTERNL int ncz_close_file(NC_FILE_INFO_T* file, int abort, NC_memio* memio);
 
 /* zcvt.c */
 EXTERNL int NCZ_json2cvt(const NCjson* jsrc, struct ZCVT* zcvt, nc_type* typeidp);
+EXTERNL int NCZ_text2cvt(int sort, const char* text, struct ZCVT* zcvt, nc_type* typeidp);
 EXTERNL int NCZ_convert1(const NCjson* jsrc, nc_type, NCbytes*);
+EXTERNL int NCZ_convert1text(int sort, const char* text, nc_type, NCbytes*);
 EXTERNL int NCZ_stringconvert1(nc_type typid, char* src, NCjson* jvalue);
 EXTERNL int NCZ_stringconvert(nc_type typid, size_t len, void* data0, NCjson** jdatap);
 
@@ -70,9 +72,11 @@ EXTERNL int ncz_fill_value_sort(nc_type nctype, int*);
 EXTERNL int NCZ_createobject(NCZMAP* zmap, const char* key, size64_t size);
 EXTERNL int NCZ_uploadjson(NCZMAP* zmap, const char* key, const NCjson* json);
 EXTERNL int NCZ_downloadjson(NCZMAP* zmap, const char* key, NCjson** jsonp);
+EXTERNL int NCZ_downloadjsonx(NCZMAP* zmap, const char* key, unsigned flags, NCjson** jsonp);
 EXTERNL int NCZ_subobjects(NCZMAP* map, const char* prefix, const char* tag, char dimsep, NClist* objlist);
 EXTERNL int NCZ_grpname_full(int gid, char** pathp);
 EXTERNL int ncz_get_var_meta(NC_FILE_INFO_T* file, NC_VAR_INFO_T* var);
+EXTERNL int ncz_probe_vars(NC_FILE_INFO_T* file, NC_GRP_INFO_T* grp);
 EXTERNL int NCZ_comma_parse(const char* s, NClist* list);
 EXTERNL int NCZ_swapatomicdata(size_t datalen, void* data, int typesize);
 EXTERNL char** NCZ_clonestringvec(size_t len, const char** vec);
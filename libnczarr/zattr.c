@@ -51,10 +51,17 @@ ncz_getattlist(NC_GRP_INFO_T *grp, int varid, NC_VAR_INFO_T **varp, NCindex **at
     {
         NC_VAR_INFO_T *var;
 
+        if ((retval = ncz_probe_vars(file, grp)))
+            return retval;
         if (!(var = (NC_VAR_INFO_T *)ncindexith(grp->vars, (size_t)varid)))
             return NC_ENOTVAR;
         assert(var->hdr.id == varid);
 
+        /* The attributes depend on the var's type */
+        if (!var->meta_read)
+            if ((retval = ncz_get_var_meta(file, var)))
+                return retval;
+
         /* Do we need to read the atts? */
         if (!var->atts_read)
             if ((retval = ncz_read_atts(file, (NC_OBJ*)var)))
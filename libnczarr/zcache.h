@@ -23,7 +23,7 @@ struct NCxcache;
 */
 
 typedef struct NCZCacheEntry {
-    struct List {void* next; void* prev; void* unused;} list;
+    struct List {void* next; void* prev; void* unused;} list; /* must be first; overlays NCxnode */
     int modified;
     size64_t indices[NC_MAX_VAR_DIMS];
     struct ChunkKey {
@@ -31,8 +31,15 @@ typedef struct NCZCacheEntry {
         char* chunkkey; /* name of the chunk */
     } key;
     size64_t hashkey;
+    struct ShardRef {
+        size64_t pos; /* position of the chunk in its shard */
+        size64_t offset; /* where the raw chunk is in the shard; NCZ_SHARD_EMPTY => not stored */
+        size64_t nbytes;
+    } shard; /* used only if the variable is sharded; key then names the shard */
     int isfiltered; /* 1=>data contains filtered data else real data */
     int isfixedstring; /* 1 => data contains the fixed strings, 0 => data contains pointers to strings */
+    int ismapped; /* 1 => data is a mapping of the stored chunk (see nczmap_mapobject) */
+    int absent; /* 1 => the chunk inventory shows the chunk is not stored */
     size64_t size; /* |data| */
     void* data; /* contains either filtered or real data */
 } NCZCacheEntry;
@@ -46,11 +53,32 @@ typedef struct NCZChunkCache {
     void* fillchunk; /* enough fillvalues to fill a real chunk */
     struct ChunkCache params;
     size_t used; /* How much total space is being used */
-    NClist* mru; /* NClist<NCZCacheEntry> all cache entries in mru order */
-    struct NCxcache* xcache;
+    struct NCxcache* xcache; /* hash index plus intrusive LRU chain through NCZCacheEntry.list */
     char dimension_separator;
+    size64_t shardcount; /* chunks per shard; 0 => not sharded */
+    NC_hashmap* shardindex; /* shard key -> shard index (2*shardcount size64_t) */
+    int shardflags; /* NCZ_SHARD_INDEX_XXX */
+    int inventoried; /* 1 => inventory has been built or has failed */
+    NC_hashmap* inventory; /* keys of the stored chunk (or shard) objects; NULL => unknown */
 } NCZChunkCache;
 
+/* A sharded chunk is stored as a run of bytes in its shard object.
+   The shard ends with an index holding the (offset,nbytes) pair of
+   each of its chunks in row-major order, as 8-byte little-endian
+   integers; both are NCZ_SHARD_EMPTY for a chunk not stored.
+*/
+#define NCZ_SHARD_EMPTY 0xffffffffffffffffULL
+#define NCZ_SHARD_ENTRYLEN (2*sizeof(size64_t))
+
+/* Variations used by the Zarr V3 sharding_indexed codec: the index
+   may instead come first in the shard, and may be followed by its
+   CRC-32C as a 4-byte little-endian integer. Chunk offsets are always
+   from the start of the shard.
+*/
+#define NCZ_SHARD_INDEX_START 1
+#define NCZ_SHARD_INDEX_CRC32C 2
+#define NCZ_SHARD_CRCLEN 4
+
 /**************************************************/
 
 #define FILTERED(cache) (nclistlength((NClist*)(cache)->var->filters))
@@ -60,6 +88,10 @@ extern int NCZ_adjust_var_cache(NC_VAR_INFO_T *var);
 extern int NCZ_create_chunk_cache(NC_VAR_INFO_T* var, size64_t, char dimsep, NCZChunkCache** cachep);
 extern void NCZ_free_chunk_cache(NCZChunkCache* cache);
 extern int NCZ_read_cache_chunk(NCZChunkCache* cache, const size64_t* indices, void** datap);
+extern int NCZ_prefetch_cache_chunks(NCZChunkCache* cache, size_t nchunks, const size64_t* chunkindices);
+extern size_t NCZ_cache_prefetch_limit(NCZChunkCache* cache);
+extern int NCZ_read_cache_chunks_direct(NCZChunkCache* cache, size_t nchunks, const size64_t* chunkindices, void** memory, int retain);
+extern int NCZ_cache_retain_direct(NCZChunkCache* cache, size64_t nchunks);
 extern int NCZ_flush_chunk_cache(NCZChunkCache* cache);
 extern size64_t NCZ_cache_entrysize(NCZChunkCache* cache);
 extern NCZCacheEntry* NCZ_cache_entry(NCZChunkCache* cache, const size64_t* indices);
@@ -13,6 +13,7 @@ static int pcounter = 0;
 static int compute_intersection(const NCZSlice* slice, size64_t chunklen, unsigned char isunlimited, NCZChunkRange* range);
 static void skipchunk(const NCZSlice* slice, NCZProjection* projection);
 static int verifyslice(const NCZSlice* slice);
+static int fullslice(const NCZSlice* slice);
 
 /**************************************************/
 /* Goal:create a vector of chunk ranges: one for each slice in
@@ -275,9 +276,50 @@ done:
     return stat;
 }
 
+/*
+Collapse each trailing dimension that is wholly covered, with stride 1,
+by both the chunk slice and the memory slice into the preceding
+dimension; the preceding dimension must also have stride 1.
+The collapsed slices address exactly the same values, but the last
+dimension is longer, so NCZ_walk copies larger contiguous runs:
+e.g. a slab covering whole lat/lon chunk extents is one run per chunk.
+
+@param rank no. of dimensions
+@param slpslices chunk slices; modified in place
+@param memslices memory slices; modified in place
+@return the (possibly reduced) rank of the slices
+*/
+int
+NCZ_mergeslices(int rank, NCZSlice* slpslices, NCZSlice* memslices)
+{
+    while(rank > 1) {
+	NCZSlice* slp = &slpslices[rank-1];
+	NCZSlice* mem = &memslices[rank-1];
+	NCZSlice* slpprev = &slpslices[rank-2];
+	NCZSlice* memprev = &memslices[rank-2];
+	if(!fullslice(slp) || !fullslice(mem)) break;
+	if(slpprev->stride != 1 || memprev->stride != 1) break;
+	slpprev->start *= slp->len;
+	slpprev->stop *= slp->len;
+	slpprev->len *= slp->len;
+	memprev->start *= mem->len;
+	memprev->stop *= mem->len;
+	memprev->len *= mem->len;
+	rank--;
+    }
+    return rank;
+}
+
 /**************************************************/
 /* Utilities */
     
+/* return 1 if slice covers all of 0..len-1 with stride 1; 0 otherwise */
+static int
+fullslice(const NCZSlice* slice)
+{
+    return (slice->start == 0 && slice->stride == 1 && slice->stop == slice->len);
+}
+
 /* return 0 if slice is malformed; 1 otherwise */
 static int
 verifyslice(const NCZSlice* slice)
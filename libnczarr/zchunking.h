@@ -9,7 +9,13 @@
 #include "ncexternl.h"
 
 typedef int (*NCZ_reader)(void* source, size64_t* chunkindices, void** chunkdata);
-struct Reader {void* source; NCZ_reader read;};
+/* Optionally load a batch of chunks ahead of the reads; NULL => no prefetch */
+typedef int (*NCZ_prefetcher)(void* source, size_t nchunks, const size64_t* chunkindices);
+/* Copy n fixed-size atomic values between strided vectors; strides count values, not bytes */
+typedef void (*NCZ_copier)(unsigned char* dst, size_t dststride, const unsigned char* src, size_t srcstride, size_t n);
+/* Optionally read whole chunks straight into memory; NULL => always read through the cache */
+typedef int (*NCZ_directreader)(void* source, size_t nchunks, const size64_t* chunkindices, void** memory, int retain);
+struct Reader {void* source; NCZ_reader read; NCZ_prefetcher prefetch; size_t batch; NCZ_directreader direct; int retain;};
 
 /* Define the intersecting set of chunks for a slice
    in terms of chunk indices (not absolute positions)
@@ -76,6 +82,7 @@ struct Common {
     NCZSliceProjections* allprojections;
     /* Parametric chunk reader */
     struct Reader reader;
+    NCZ_copier copy; /* NULL => use NCZ_copy_data */
 };
 
 /**************************************************/
@@ -84,6 +91,7 @@ EXTERNL int NCZ_compute_chunk_ranges(struct Common*, const NCZSlice*, NCZChunkRa
 EXTERNL int NCZ_compute_projections(struct Common*, int r, size64_t chunkindex, const NCZSlice* slice, size_t n, NCZProjection* projections);
 EXTERNL int NCZ_compute_per_slice_projections(struct Common*, int rank, const NCZSlice*, const NCZChunkRange*, NCZSliceProjections* slp);
 EXTERNL int NCZ_compute_all_slice_projections(struct Common*, const NCZSlice* slices, const NCZChunkRange*, NCZSliceProjections*);
+EXTERNL int NCZ_mergeslices(int rank, NCZSlice* slpslices, NCZSlice* memslices);
 
 /* From zwalk.c */
 EXTERNL int ncz_chunking_init(void);
@@ -23,13 +23,14 @@ static int zwrite_vars(NC_GRP_INFO_T *grp);
  *
  * @param file Pointer to ZARR file info struct.
  * @param abort True if this is an abort.
+ * @param memio If not NULL, return the image of an in-memory store here.
  *
  * @return ::NC_NOERR No error.
  * @return ::NC_ENCZARR could not close the file.
  * @author Dennis Heimbigner
  */
 int
-ncz_close_file(NC_FILE_INFO_T* file, int abort)
+ncz_close_file(NC_FILE_INFO_T* file, int abort, NC_memio* memio)
 {
     int stat = NC_NOERR;
     NCZ_FILE_INFO_T* zinfo = NULL;
@@ -47,8 +48,27 @@ ncz_close_file(NC_FILE_INFO_T* file, int abort)
 
     zinfo = file->format_file_info;
 
-    if((stat = nczmap_close(zinfo->map,(abort && zinfo->creating)?1:0)))
-	goto done;
+    /* All chunk I/O is complete, so the workers can be stopped */
+    ncthreadpoolfree(zinfo->pool);
+    zinfo->pool = NULL;
+
+    /* Hand the content of an in-memory store back to the caller */
+    if(!abort && memio != NULL && zinfo->map->format == NCZM_MEM) {
+	size64_t size = 0;
+	void* image = NULL;
+	if((stat = nczmap_mem_extract(zinfo->map,&size,&image))) goto done;
+	memio->size = (size_t)size;
+	memio->memory = image;
+	memio->flags = 0;
+    }
+
+    /* Wait for deferred writes; the map is closed even if one failed */
+    if(!abort)
+        stat = nczmap_flush(zinfo->map);
+    {
+	int stat2 = nczmap_close(zinfo->map,(abort && zinfo->creating)?1:0);
+	if(stat == NC_NOERR) stat = stat2;
+    }
     nclistfreeall(zinfo->controllist);
     NC_authfree(zinfo->auth);
     NCZMD_free_metadata_handler(&(zinfo->metadata));
@@ -178,6 +198,7 @@ NCZ_zclose_var1(NC_VAR_INFO_T* var)
     if(zvar->cache) NCZ_free_chunk_cache(zvar->cache);
     /* reclaim xarray */
     if(zvar->xarray) nclistfreeall(zvar->xarray);
+    nullfree(zvar->shards);
     nullfree(zvar->zarray.prefix);
     NCJreclaim(zvar->zarray.obj);
     NCJreclaim(zvar->zarray.atts);
@@ -102,30 +102,40 @@ done:
 /* Warning: not free returned zcvt.strv; it may point into a string in jsrc */
 int
 NCZ_json2cvt(const NCjson* jsrc, struct ZCVT* zcvt, nc_type* typeidp)
+{
+    return NCZ_text2cvt(NCJsort(jsrc),NCJstring(jsrc),zcvt,typeidp);
+}
+
+/* Convert the text of an atomic JSON value of the given sort,
+   as held in an NCjson node or passed to an NCJparsecb callback.
+   Warning: not free returned zcvt.strv; it points to text */
+int
+NCZ_text2cvt(int sort, const char* text, struct ZCVT* zcvt, nc_type* typeidp)
 {
     int stat = NC_NOERR;
     nc_type srctype = NC_NAT;
     double naninf;
     float naninff;
+    char* end = NULL;
     
-    /* Convert the incoming jsrc to a restricted set of values */
-    switch (NCJsort(jsrc)) {
+    /* Convert the incoming text to a restricted set of values */
+    switch (sort) {
     case NCJ_INT: /* convert to (u)int64 */
-	if(NCJstring(jsrc)[0] == '-') {
-	    if(sscanf(NCJstring(jsrc),"%lld",&zcvt->int64v) != 1)
-		{stat = NC_EINVAL; goto done;}
+	if(text[0] == '-') {
+	    zcvt->int64v = strtoll(text,&end,10);
+	    if(end == text) {stat = NC_EINVAL; goto done;}
 	    srctype = NC_INT64;
 	} else {
-	    if(sscanf(NCJstring(jsrc),"%llu",&zcvt->uint64v) != 1)
-		{stat = NC_EINVAL; goto done;}
+	    zcvt->uint64v = strtoull(text,&end,10);
+	    if(end == text) {stat = NC_EINVAL; goto done;}
 	    srctype = NC_UINT64;
 	}
 	break;
     case NCJ_DOUBLE:
-	switch (naninftest(NCJstring(jsrc),&naninf,&naninff)) {
+	switch (naninftest(text,&naninf,&naninff)) {
 	case NC_NAT:
-	    if(sscanf(NCJstring(jsrc),"%lg",&zcvt->float64v) != 1)
-	        {stat = NC_EINVAL; goto done;}
+	    zcvt->float64v = strtod(text,&end);
+	    if(end == text) {stat = NC_EINVAL; goto done;}
 	    break;
 	default:
 	    zcvt->float64v = naninf;
@@ -135,14 +145,14 @@ NCZ_json2cvt(const NCjson* jsrc, struct ZCVT* zcvt, nc_type* typeidp)
 	break;
     case NCJ_BOOLEAN:
 	srctype = NC_UINT64;
-	if(strcasecmp(NCJstring(jsrc),"false")==0)
+	if(strcasecmp(text,"false")==0)
 	    zcvt->uint64v = 0;
 	else
 	    zcvt->uint64v = 1;
 	break;
     case NCJ_STRING:
 	srctype = NC_STRING;
-	zcvt->strv = NCJstring(jsrc);
+	zcvt->strv = (char*)text;
 	break;
     default: stat = NC_EINTERNAL; goto done;
     }
@@ -155,6 +165,14 @@ done:
 /* Convert a singleton NCjson value to a memory equivalent value of specified dsttype; */
 int
 NCZ_convert1(const NCjson* jsrc, nc_type dsttype, NCbytes* buf)
+{
+    return NCZ_convert1text(NCJsort(jsrc),NCJstring(jsrc),dsttype,buf);
+}
+
+/* Convert the text of an atomic JSON value of the given sort
+   to a memory equivalent value of specified dsttype; */
+int
+NCZ_convert1text(int sort, const char* text, nc_type dsttype, NCbytes* buf)
 {
     int stat = NC_NOERR;
     nc_type srctype;
@@ -166,9 +184,9 @@ NCZ_convert1(const NCjson* jsrc, nc_type dsttype, NCbytes* buf)
 
     assert(dsttype != NC_NAT && dsttype <= NC_MAX_ATOMIC_TYPE && buf);
 
-    switch (NCJsort(jsrc)) {
+    switch (sort) {
     case NCJ_STRING: case NCJ_INT: case NCJ_DOUBLE: case NCJ_BOOLEAN:
-        if((stat = NCZ_json2cvt(jsrc,&zcvt,&srctype))) goto done;
+        if((stat = NCZ_text2cvt(sort,text,&zcvt,&srctype))) goto done;
 	break;
     default: stat = NC_EINVAL; goto done; /* Illegal JSON */
     }
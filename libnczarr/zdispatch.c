@@ -108,6 +108,7 @@ static const NC_Dispatch NCZ_dispatcher = {
     NCZ_def_var_quantize,
     NCZ_inq_var_quantize,
     NCZ_inq_filter_avail,
+    NCDEFAULT_get_vara_multi,
 };
 
 const NC_Dispatch* NCZ_dispatch_table = NULL; /* moved here from ddispatch.c */
@@ -235,8 +236,13 @@ int
 NCZ_inq_varid(int ncid, const char* name, int *varidp)
 {
     int stat = NC_NOERR;
+    NC_FILE_INFO_T* file = NULL;
+    NC_GRP_INFO_T* grp = NULL;
     ZTRACE(0,"NC4_inq_varid(ncid,name,varidp)");
+    if((stat = nc4_find_grp_h5(ncid,&grp,&file))) goto done;
+    if((stat = ncz_probe_vars(file,grp))) goto done;
     stat = NC4_inq_varid(ncid,name,varidp);
+done:
     return ZUNTRACE(stat);
 }
 
@@ -298,8 +304,13 @@ int
 NCZ_inq_varids(int ncid, int* nvars, int* varids)
 {
     int stat = NC_NOERR;
+    NC_FILE_INFO_T* file = NULL;
+    NC_GRP_INFO_T* grp = NULL;
     ZTRACE(0,"NC4_inq_varids(ncid,nvars,varids)");
+    if((stat = nc4_find_grp_h5(ncid,&grp,&file))) goto done;
+    if((stat = ncz_probe_vars(file,grp))) goto done;
     stat = NC4_inq_varids(ncid,nvars,varids);
+done:
     return ZUNTRACE(stat);
 }
 
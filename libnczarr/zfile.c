@@ -235,8 +235,6 @@ ncz_closeorabort(NC_FILE_INFO_T* h5, void* params, int abort)
 
     assert(h5);
 
-    NC_UNUSED(params);
-
     ZTRACE(3,"file=%s abort=%d",h5->hdr.name,abort);
 
     LOG((2, "%s: file: %p", __func__, h5));
@@ -255,7 +253,7 @@ ncz_closeorabort(NC_FILE_INFO_T* h5, void* params, int abort)
     /* Reclaim memory */
 
     /* Free any zarr-related data, including the map */
-    if ((stat = ncz_close_file(h5, abort)))
+    if ((stat = ncz_close_file(h5, abort, (NC_memio*)params)))
 	goto done;
 
     /* Reclaim provenance info */
@@ -312,6 +310,8 @@ NCZ_inq(int ncid, int *ndimsp, int *nvarsp, int *nattsp, int *unlimdimidp)
     }
     if (nvarsp)
     {
+        if ((stat = ncz_probe_vars(file, grp)))
+            return stat;
         *nvarsp = ncindexcount(grp->vars);
     }
     if (nattsp)
@@ -689,6 +689,31 @@ NCZ_filter_finalize(void)
 done:
     return ZUNTRACE(stat);
 }
+
+/* Make sure every filter in the chain has working parameters.
+   NCZ_applyfilterchain will do this on demand, but doing so modifies
+   the filter, so it must be done once before the chain is applied
+   concurrently to several chunks. Incomplete filters are left for
+   NCZ_applyfilterchain to report.
+*/
+int
+NCZ_filter_ensure_working(NC_VAR_INFO_T* var)
+{
+    size_t i;
+    int stat = NC_NOERR;
+    NClist* chain = (NClist*)var->filters;
+
+    for(i=0;i<nclistlength(chain);i++) {
+	struct NCZ_Filter* f = (struct NCZ_Filter*)nclistget(chain,i);
+	if(FILTERINCOMPLETE(f)) continue;
+	if(!(f->flags & FLAG_WORKING)) {
+	    if((stat = ensure_working(var,f))) goto done;
+	}
+    }
+done:
+    return THROW(stat);
+}
+
 int
 NCZ_applyfilterchain(const NC_FILE_INFO_T* file, NC_VAR_INFO_T* var, NClist* chain, size_t inlen, void* indata, size_t* outlenp, void** outdatap, int encode)
 {
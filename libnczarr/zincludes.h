@@ -48,6 +48,7 @@ extern "C" {
 #include "ncindex.h"
 #include "ncjson.h"
 #include "ncproplist.h"
+#include "ncthreadpool.h"
 #include "ncutil.h"
 
 #include "zmap.h"
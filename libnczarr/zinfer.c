@@ -35,8 +35,8 @@ int NCZ_infer_nczarr_format(NC_FILE_INFO_T *file) {
   int zarrformat = zfile->format.zarr;
   int nczarrformat = NCZARRFORMAT0;
 
-  if (zarrformat == ZARRFORMAT2) {
-    /* Fetch /.zattrs and /.zgroup contents */
+  if (zarrformat == ZARRFORMAT2 || zarrformat == ZARRFORMAT3) {
+    /* Fetch the root group and its attributes (/.zgroup and /.zattrs in V2) */
     if ((stat = NCZMD_fetch_json_group(zfile, "/", &zobjs->obj)) ||
         (stat = NCZMD_fetch_json_attrs(zfile, "/", &zobjs->atts))) {
       stat = NC_ENCZARR;
@@ -102,7 +102,7 @@ int NCZ_get_map(NC_FILE_INFO_T *file, NCURI *uri, mode_t mode,
         nczmap_create(impl, path, (int)mode, zfile->controls.flags, NULL, mapp);
   } else {
     stat =
-        nczmap_open(impl, path, (int)mode, zfile->controls.flags, NULL, mapp);
+        nczmap_open(impl, path, (int)mode, zfile->controls.flags, params, mapp);
   }
 
 done:
@@ -55,6 +55,10 @@ NCZ_initialize_internal(void)
 {
     int stat = NC_NOERR;
     char* dimsep = NULL;
+    const char* nthreads = NULL;
+    const char* openfiles = NULL;
+    const char* writebehind = NULL;
+    const char* multipart = NULL;
     NCglobalstate* ngs = NULL;
 
     ncz_initialized = 1;
@@ -68,6 +72,48 @@ NCZ_initialize_internal(void)
 	    if(dimsep != NULL && strlen(dimsep) == 1 && islegaldimsep(dimsep[0]))
 		ngs->zarr.dimension_separator = dimsep[0];
         }    
+	ngs->zarr.nthreads = DFALT_NTHREADS;
+        nthreads = NC_rclookup("ZARR.NTHREADS",NULL,NULL);
+        if(nthreads != NULL) {
+	    long n = strtol(nthreads,NULL,10);
+	    if(n >= 0) ngs->zarr.nthreads = (size_t)n;
+	}
+	ngs->zarr.openfiles = DFALT_OPENFILES;
+        openfiles = NC_rclookup("ZARR.OPENFILES",NULL,NULL);
+        if(openfiles != NULL) {
+	    long n = strtol(openfiles,NULL,10);
+	    if(n >= 0) ngs->zarr.openfiles = (size_t)n;
+	}
+	ngs->zarr.writebehind = DFALT_WRITEBEHIND;
+        writebehind = NC_rclookup("ZARR.S3.WRITEBEHIND",NULL,NULL);
+        if(writebehind != NULL) {
+	    long n = strtol(writebehind,NULL,10);
+	    if(n >= 0) ngs->zarr.writebehind = (size_t)n;
+	}
+	ngs->zarr.writebehind_bytes = DFALT_WRITEBEHIND_BYTES;
+        writebehind = NC_rclookup("ZARR.S3.WRITEBEHIND.BYTES",NULL,NULL);
+        if(writebehind != NULL) {
+	    long long n = strtoll(writebehind,NULL,10);
+	    if(n > 0) ngs->zarr.writebehind_bytes = (size_t)n;
+	}
+	ngs->zarr.multipart = DFALT_MULTIPART;
+        multipart = NC_rclookup("ZARR.S3.MULTIPART",NULL,NULL);
+        if(multipart != NULL) {
+	    long long n = strtoll(multipart,NULL,10);
+	    if(n >= 0) ngs->zarr.multipart = (size_t)n;
+	}
+	ngs->zarr.multipart_partsize = DFALT_MULTIPART_PARTSIZE;
+        multipart = NC_rclookup("ZARR.S3.MULTIPART.PARTSIZE",NULL,NULL);
+        if(multipart != NULL) {
+	    long long n = strtoll(multipart,NULL,10);
+	    if(n > 0) ngs->zarr.multipart_partsize = (size_t)n;
+	}
+	ngs->zarr.multipart_threads = DFALT_MULTIPART_THREADS;
+        multipart = NC_rclookup("ZARR.S3.MULTIPART.THREADS",NULL,NULL);
+        if(multipart != NULL) {
+	    long n = strtol(multipart,NULL,10);
+	    if(n >= 0) ngs->zarr.multipart_threads = (size_t)n;
+	}
     }
 
     return stat;
@@ -517,9 +563,14 @@ ncz_find_grp_file_var(int ncid, int varid, NC_FILE_INFO_T **h5,
                          NC_GRP_INFO_T **grp, NC_VAR_INFO_T **var)
 {
     NC_FILE_INFO_T *my_h5;
+    NC_GRP_INFO_T *my_grp;
     NC_VAR_INFO_T *my_var;
     int retval;
 
+    /* Varids are not settled until suppressed variables are removed */
+    if((retval = nc4_find_grp_h5(ncid,&my_grp,&my_h5))) return retval;
+    if((retval = ncz_probe_vars(my_h5,my_grp))) return retval;
+
     /* Delegate to libsrc4 */
     if((retval = nc4_find_grp_h5_var(ncid,varid,&my_h5,grp,&my_var))) return retval;
 
@@ -808,3 +859,39 @@ NCZ_inq_format_extended(int ncid, int *formatp, int *modep)
 
     return NC_NOERR;
 }
+
+/**
+ * @internal Get the worker pool used to overlap chunk I/O for a
+ * file, creating it on first use. The pool is sized by the
+ * "nthreads" fragment key or, failing that, by the ZARR.NTHREADS
+ * .rc key.
+ *
+ * @param file Pointer to file info struct.
+ * @param poolp Pointer that gets the pool; set to NULL if chunk I/O
+ * should be done serially, either because fewer than two threads
+ * were requested or because the map implementation cannot be used
+ * concurrently.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_ENOMEM Out of memory.
+ * @author Dennis Heimbigner
+ */
+int
+NCZ_get_threadpool(NC_FILE_INFO_T* file, struct NCthreadpool** poolp)
+{
+    int stat = NC_NOERR;
+    NCZ_FILE_INFO_T* zinfo = (NCZ_FILE_INFO_T*)file->format_file_info;
+
+    assert(poolp != NULL);
+    *poolp = NULL;
+    if(zinfo == NULL || zinfo->map == NULL) goto done;
+    if(zinfo->controls.nthreads <= 1) goto done;
+    if(nczmap_features(zinfo->map->format) & NCZM_NOCONCURRENCY) goto done;
+    if(zinfo->pool == NULL) {
+	if((stat = ncthreadpoolnew(zinfo->controls.nthreads,&zinfo->pool))) goto done;
+    }
+    if(ncthreadpoolsize(zinfo->pool) > 1)
+        *poolp = zinfo->pool;
+done:
+    return stat;
+}
@@ -13,6 +13,7 @@
 #define ZINTERNAL_H
 
 #define ZARRFORMAT2 2
+#define ZARRFORMAT3 3
 
 /* Define the possible NCZarr format versions */
 /* These are independent of the Zarr specification version */
@@ -54,6 +55,7 @@
 #define Z2GROUP ".zgroup"
 #define Z2ATTRS ".zattrs"
 #define Z2ARRAY ".zarray"
+#define Z3OBJECT "zarr.json"
 
 /* V2 Reserved Attributes */
 /*
@@ -91,6 +93,10 @@ Inserted into any .zattrs
 #define PUREZARRCONTROL "zarr"
 #define XARRAYCONTROL "xarray"
 #define NOXARRAYCONTROL "noxarray"
+#define ZARRV2CONTROL "v2"
+#define ZARRV3CONTROL "v3"
+#define MMAPCONTROL "mmap"
+#define INVENTORYCONTROL "inventory"
 #define XARRAYSCALAR "_scalar_"
 
 #define NC_NCZARR_MAXSTRLEN_ATTR "_nczarr_maxstrlen"
@@ -99,6 +105,24 @@ Inserted into any .zattrs
 #define LEGAL_DIM_SEPARATORS "./"
 #define DFALT_DIM_SEPARATOR '.'
 
+/* Default number of concurrent chunk fetches; 0 => serial */
+#define DFALT_NTHREADS 0
+
+/* Default number of open files cached per file storage dataset */
+#define DFALT_OPENFILES 64
+
+/* Default number of S3 writes kept in flight; 0 => write synchronously */
+#define DFALT_WRITEBEHIND 0
+/* Default bound on the bytes held by S3 writes in flight */
+#define DFALT_WRITEBEHIND_BYTES (64*1024*1024)
+
+/* Default size at which an S3 object is uploaded in parts; 0 => never */
+#define DFALT_MULTIPART (64*1024*1024)
+/* Default size of each part; S3 requires at least 5 MiB */
+#define DFALT_MULTIPART_PARTSIZE (16*1024*1024)
+/* Default number of parts of one upload kept in flight */
+#define DFALT_MULTIPART_THREADS 4
+
 #define islegaldimsep(c) ((c) != '\0' && strchr(LEGAL_DIM_SEPARATORS,(c)) != NULL)
 
 /* Default max string length for fixed length strings */
@@ -120,6 +144,7 @@ struct NCjson;
 struct NCauth;
 struct NCZMAP;
 struct NCZChunkCache;
+struct NCthreadpool;
 
 /**************************************************/
 /* Define annotation data for NCZ objects */
@@ -150,8 +175,13 @@ typedef struct NCZ_FILE_INFO {
 #		define FLAG_XARRAYDIMS  8
 #		define FLAG_NCZARR_KEY  16 /* _nczarr_xxx keys are stored in object and not in _nczarr_attrs */
 #		define FLAG_CONSOLIDATED 32
+#		define FLAG_MMAP        64 /* map unfiltered chunks of read-only datasets */
+#		define FLAG_INVENTORY  128 /* list the stored chunks of read-only datasets */
 	NCZM_IMPL mapimpl;
+	size_t nthreads; /* from the "nthreads" fragment key or ZARR.NTHREADS */
+	size_t shard; /* from the "shard" fragment key: chunks per shard along each dimension of new variables; 0|1 => no sharding */
     } controls;
+    struct NCthreadpool* pool; /* created on first use; NULL => serial */
     int default_maxstrlen; /* default max str size for variables of type string */
 } NCZ_FILE_INFO_T;
 
@@ -175,6 +205,7 @@ typedef struct NCZ_GRP_INFO {
 	NCjson* atts;
         int nczv1;   /* 1 => _nczarr_xxx are in obj and not attributes */
     } zgroup;
+    int varsprobed; /* 1 => suppressed variables have been removed; see ncz_probe_vars */
 } NCZ_GRP_INFO_T;
 
 /* Struct to hold ZARR-specific info for a variable. */
@@ -187,6 +218,9 @@ typedef struct NCZ_VAR_INFO {
     struct NCZChunkCache* cache;
     struct NClist* xarray; /* names from _ARRAY_DIMENSIONS */
     char dimension_separator; /* '.' | '/' */
+    size64_t* shards; /* no. of chunks per shard along each dimension; NULL => each chunk is its own object */
+    int shardflags; /* NCZ_SHARD_INDEX_XXX layout of the shard index */
+    int v3chunkkeys; /* 1 => chunk keys use the V3 "default" encoding: "c" prefix */
     NClist* incompletefilters;
     int maxstrlen; /* max length of strings for this variable */
     /* Read .zarray and .zattrs once */
@@ -238,6 +272,7 @@ int ncz_find_grp_var_att(int ncid, int varid, const char *name, int attnum,
                               NC_GRP_INFO_T** grp, NC_VAR_INFO_T** var,
                               NC_ATT_INFO_T** att);
 int NCZ_set_log_level(void);
+int NCZ_get_threadpool(NC_FILE_INFO_T* file, struct NCthreadpool** poolp);
 
 /* zcache.c */
 int ncz_adjust_var_cache(NC_GRP_INFO_T* grp, NC_VAR_INFO_T* var);
@@ -20,6 +20,7 @@ nczmap_features(NCZM_IMPL impl)
 {
     switch (impl) {
     case NCZM_FILE: return zmap_file.features;
+    case NCZM_MEM: return zmap_mem.features;
 #ifdef NETCDF_ENABLE_NCZARR_ZIP
     case NCZM_ZIP: return zmap_zip.features;
 #endif
@@ -53,6 +54,10 @@ nczmap_create(NCZM_IMPL impl, const char *path, int mode, size64_t flags, void*
         stat = zmap_file.create(path, mode, flags, parameters, &map);
 	if(stat) goto done;
 	break;
+    case NCZM_MEM:
+        stat = zmap_mem.create(path, mode, flags, parameters, &map);
+	if(stat) goto done;
+	break;
 #ifdef NETCDF_ENABLE_NCZARR_ZIP
     case NCZM_ZIP:
         stat = zmap_zip.create(path, mode, flags, parameters, &map);
@@ -91,6 +96,10 @@ nczmap_open(NCZM_IMPL impl, const char *path, int mode, size64_t flags, void* pa
         stat = zmap_file.open(path, mode, flags, parameters, &map);
 	if(stat) goto done;
 	break;
+    case NCZM_MEM:
+        stat = zmap_mem.open(path, mode, flags, parameters, &map);
+	if(stat) goto done;
+	break;
 #ifdef NETCDF_ENABLE_NCZARR_ZIP
     case NCZM_ZIP:
         stat = zmap_zip.open(path, mode, flags, parameters, &map);
@@ -123,6 +132,9 @@ nczmap_truncate(NCZM_IMPL impl, const char *path)
     case NCZM_FILE:
         if((stat = zmap_file.truncate(path))) goto done;
 	break;
+    case NCZM_MEM:
+        if((stat = zmap_mem.truncate(path))) goto done;
+	break;
 #ifdef NETCDF_ENABLE_NCZARR_ZIP
     case NCZM_ZIP:
         if((stat = zmap_zip.truncate(path))) goto done;
@@ -170,6 +182,58 @@ nczmap_read(NCZMAP* map, const char* key, size64_t start, size64_t count, void*
     return map->api->read(map, key, start, count, content);
 }
 
+int
+nczmap_readobject(NCZMAP* map, const char* key, size64_t* sizep, void** contentp)
+{
+    int stat = NC_NOERR;
+    size64_t size = 0;
+    char* content = NULL;
+
+    if(map->api->readobject != NULL)
+        return map->api->readobject(map, key, sizep, contentp);
+    /* Fall back to a length request followed by a read */
+    if((stat = map->api->len(map, key, &size))) goto done;
+    if((content = malloc(size+1)) == NULL) {stat = NC_ENOMEM; goto done;}
+    if(size > 0 && (stat = map->api->read(map, key, 0, size, content))) goto done;
+    content[size] = '\0';
+    if(sizep) *sizep = size;
+    if(contentp) {*contentp = content; content = NULL;}
+done:
+    nullfree(content);
+    return stat;
+}
+
+int
+nczmap_mapobject(NCZMAP* map, const char* key, size64_t* sizep, void** contentp, int* mappedp)
+{
+    int stat = NC_NOERR;
+
+    if(mappedp) *mappedp = 0;
+    if(map->api->mapobject != NULL) {
+	/* NC_ENOTBUILT => this object cannot be mapped */
+	switch (stat = map->api->mapobject(map, key, sizep, contentp)) {
+	case NC_NOERR: if(mappedp) *mappedp = 1; return stat;
+	case NC_ENOTBUILT: break;
+	default: return stat;
+	}
+    }
+    return nczmap_readobject(map, key, sizep, contentp);
+}
+
+int
+nczmap_unmapobject(NCZMAP* map, void* content, size64_t size)
+{
+    if(map->api->unmapobject == NULL) return NC_EINTERNAL;
+    return map->api->unmapobject(map, content, size);
+}
+
+int
+nczmap_flush(NCZMAP* map)
+{
+    if(map->api->flush == NULL) return NC_NOERR;
+    return map->api->flush(map);
+}
+
 int
 nczmap_write(NCZMAP* map, const char* key, size64_t count, const void* content)
 {
@@ -199,6 +263,20 @@ nczmap_search(NCZMAP* map, const char* prefix, NClist* matches)
     return stat;
 }
 
+int
+nczmap_listall(NCZMAP* map, const char* prefix, NClist* keys)
+{
+    int stat = NC_NOERR;
+    if(map->api->listall == NULL) return NC_ENOTBUILT;
+    if((stat = map->api->listall(map, prefix, keys)) == NC_NOERR) {
+        if(nclistlength(keys) > 1) {
+	    void* base = nclistcontents(keys);
+            qsort(base, nclistlength(keys), sizeof(char*), cmp_strings);
+	}
+    }
+    return stat;
+}
+
 /**************************************************/
 /* Utilities */
 
@@ -150,10 +150,11 @@ typedef struct NCZMAP_API NCZMAP_API;
 
 /* Define the space of implemented (eventually) map implementations */
 typedef enum NCZM_IMPL {
-NCZM_UNDEF=0, /* In-memory implementation */
+NCZM_UNDEF=0, /* Undefined */
 NCZM_FILE=1,	/* File system directory-based implementation */
 NCZM_ZIP=2,	/* Zip-file based implementation */
 NCZM_S3=3,	/* Amazon S3 implementation */
+NCZM_MEM=4,	/* In-memory implementation */
 } NCZM_IMPL;
 
 /* Define the default map implementation */
@@ -164,6 +165,7 @@ typedef size64_t NCZM_FEATURES;
 /* powers of 2 */
 #define NCZM_UNIMPLEMENTED 1 /* Unknown/ unimplemented */
 #define NCZM_WRITEONCE 2     /* Objects can only be written once */
+#define NCZM_NOCONCURRENCY 4 /* Object API must not be called concurrently */
 
 /*
 For each dataset, we create what amounts to a class
@@ -202,6 +204,15 @@ struct NCZMAP_API {
 	int (*read)(NCZMAP* map, const char* key, size64_t start, size64_t count, void* content);
 	int (*write)(NCZMAP* map, const char* key, size64_t count, const void* content);
         int (*search)(NCZMAP* map, const char* prefix, struct NClist* matches);
+    /* Optional; if NULL, then len+read is used */
+	int (*readobject)(NCZMAP* map, const char* key, size64_t* sizep, void** contentp);
+    /* Optional; if NULL, then readobject is used */
+	int (*mapobject)(NCZMAP* map, const char* key, size64_t* sizep, void** contentp);
+	int (*unmapobject)(NCZMAP* map, void* content, size64_t size);
+    /* Optional; if NULL, then writes are never deferred */
+	int (*flush)(NCZMAP* map);
+    /* Optional; if NULL, then search is used one level at a time */
+	int (*listall)(NCZMAP* map, const char* prefix, struct NClist* keys);
 };
 
 /* Define the Dataset level API */
@@ -214,6 +225,7 @@ typedef struct NCZMAP_DS_API {
 } NCZMAP_DS_API;
 
 extern NCZMAP_DS_API zmap_file;
+extern NCZMAP_DS_API zmap_mem;
 #ifdef USE_HDF5
 extern NCZMAP_DS_API zmap_nz4;
 #endif
@@ -275,6 +287,56 @@ Read the content of a specified content-bearing object.
 */
 EXTERNL int nczmap_read(NCZMAP* map, const char* key, size64_t start, size64_t count, void* content);
 
+/**
+Read the whole content of a specified content-bearing object
+in a single request to the underlying storage.
+The content is malloc'd, nul-terminated (the nul is not included
+in the size), and must be free'd by the caller.
+@param map -- the containing map
+@param key -- the key specifying the content-bearing object
+@param sizep -- the object's size is returned thru this pointer.
+@param contentp -- the object's content is returned thru this pointer.
+@return NC_NOERR if the operation succeeded
+@return NC_EEMPTY if the object is not content-bearing.
+@return NC_EXXX if the operation failed for one of several possible reasons
+*/
+EXTERNL int nczmap_readobject(NCZMAP* map, const char* key, size64_t* sizep, void** contentp);
+
+/**
+Like nczmap_readobject, but if the implementation can, the content
+is a private, writable memory mapping of the object rather than a
+copy; pages are only copied if they are modified.
+Such content must be released with nczmap_unmapobject, not free'd,
+and is not nul-terminated.
+@param map -- the containing map
+@param key -- the key specifying the content-bearing object
+@param sizep -- the object's size is returned thru this pointer.
+@param contentp -- the object's content is returned thru this pointer.
+@param mappedp -- set to 1 if the content is mapped, 0 if it is malloc'd.
+@return NC_NOERR if the operation succeeded
+@return NC_EEMPTY if the object is not content-bearing.
+@return NC_EXXX if the operation failed for one of several possible reasons
+*/
+EXTERNL int nczmap_mapobject(NCZMAP* map, const char* key, size64_t* sizep, void** contentp, int* mappedp);
+
+/**
+Release content returned by nczmap_mapobject with *mappedp == 1.
+@param map -- the containing map
+@param content -- the mapped content
+@param size -- its size as returned by nczmap_mapobject
+@return NC_NOERR if the operation succeeded
+@return NC_EXXX if the operation failed for one of several possible reasons
+*/
+EXTERNL int nczmap_unmapobject(NCZMAP* map, void* content, size64_t size);
+
+/**
+Wait for all writes that the implementation has deferred.
+@param map -- the map to flush
+@return NC_NOERR if every deferred write succeeded
+@return NC_EXXX the error of the earliest deferred write that failed
+*/
+EXTERNL int nczmap_flush(NCZMAP* map);
+
 /**
 Write the content of a specified content-bearing object.
 This assumes that it is not possible to write a subset of an object.
@@ -301,6 +363,33 @@ next segment of legal objects that are immediately contained by the prefix key.
 */
 EXTERNL int nczmap_search(NCZMAP* map, const char* prefix, struct NClist* matches);
 
+/**
+Return a vector of the keys, relative to the prefix key, of all the
+content-bearing objects anywhere below the prefix key, using as few
+requests to the underlying storage as possible (a single listing for S3).
+@param map -- the containing map
+@param prefix -- the key into the tree where the search is to occur
+@param keys -- return the set of relative keys in this list; might be empty
+@return NC_NOERR if the operation succeeded
+@return NC_ENOTBUILT if the implementation cannot list recursively;
+        use nczmap_search one level at a time instead
+@return NC_EXXX if the operation failed for one of several possible reasons
+*/
+EXTERNL int nczmap_listall(NCZMAP* map, const char* prefix, struct NClist* keys);
+
+/**
+Convert the store behind an in-memory (NCZM_MEM) map to a single
+contiguous image. The store itself is released: it is discarded
+when the last map that references it is closed.
+The image can later be given to nc_open_memio to recreate the store.
+@param map -- the in-memory map
+@param sizep -- return the size of the image here
+@param imagep -- return the malloc'd image here
+@return NC_NOERR if the operation succeeded
+@return NC_EINVAL if the map is not an in-memory map
+*/
+EXTERNL int nczmap_mem_extract(NCZMAP* map, size64_t* sizep, void** imagep);
+
 /**
 "Truncate" the storage associated with a map. Delete all contents except
 the root, which is sized to zero.
@@ -29,6 +29,9 @@
 #ifdef HAVE_DIRENT_H
 #include <dirent.h>
 #endif
+#ifdef USE_MMAP
+#include <sys/mman.h>
+#endif
 
 #ifdef _WIN32
 #include <windows.h>
@@ -46,6 +49,13 @@
 
 #include "fbits.h"
 #include "ncpathmgr.h"
+#include "nchashmap.h"
+
+/* Without pread/pwrite a shared descriptor cannot be used concurrently */
+#if defined(HAVE_PTHREAD_H) && !defined(_WIN32)
+#define USEPTHREADS
+#include <pthread.h>
+#endif
 
 #define VERIFY
 
@@ -101,6 +111,15 @@ For the object API, the mapping is as follows:
 2. The meta data containing files are assumed to contain
    UTF-8 character data.
 3. The chunk containing files are assumed to contain raw unsigned 8-bit byte data.
+
+Opening a file costs a stat and an open (and later a close), which on
+parallel file systems are metadata server round trips. So the most
+recently used content-bearing files are kept open in a small LRU cache
+of file descriptors, indexed by key, and are read and written with
+pread/pwrite so that a descriptor can be shared by concurrent chunk I/O.
+A descriptor in use is never evicted; if every cached descriptor is in
+use, a new one is simply closed when its operation completes.
+The cache size is set by the ZARR.OPENFILES .rc key.
 */
 
 /* define the var name containing an objects content */
@@ -112,20 +131,53 @@ typedef struct FD {
 
 static FD FDNUL = {-1};
 
+/* An open content-bearing object */
+typedef struct ZFOBJ {
+    char* key;
+    FD fd;
+    size_t refs; /* # of operations using fd */
+    int cached; /* => in the descriptor cache */
+    struct ZFOBJ* prev; /* LRU list; most recently used first */
+    struct ZFOBJ* next;
+} ZFOBJ;
+
 /* Define the "subclass" of NCZMAP */
 typedef struct ZFMAP {
     NCZMAP map;
     char* root;
+    struct ZFcache { /* Open file descriptors */
+	size_t capacity; /* 0 => do not cache */
+	NC_hashmap* index; /* key -> ZFOBJ* */
+	ZFOBJ* head;
+	ZFOBJ* tail;
+#ifdef USEPTHREADS
+	pthread_mutex_t lock; /* chunk I/O may be concurrent */
+#endif
+    } cache;
 } ZFMAP;
 
+#ifdef USEPTHREADS
+#define LOCK(zfmap) pthread_mutex_lock(&(zfmap)->cache.lock)
+#define UNLOCK(zfmap) pthread_mutex_unlock(&(zfmap)->cache.lock)
+#else
+#define LOCK(zfmap)
+#define UNLOCK(zfmap)
+#endif
+
 /* Forward */
 static NCZMAP_API zapi;
 static int zfileclose(NCZMAP* map, int delete);
 static int zfcreategroup(ZFMAP*, const char* key, int nskip);
-static int zflookupobj(ZFMAP*, const char* key, FD* fd);
+static int zflookupobj(ZFMAP*, const char* key, ZFOBJ** objp);
+static int zfcreateobj(ZFMAP*, const char* key, ZFOBJ** objp);
 static int zfparseurl(const char* path0, NCURI** urip);
 static int zffullpath(ZFMAP* zfmap, const char* key, char**);
-static void zfrelease(ZFMAP* zfmap, FD* fd);
+static void zfrelease(ZFMAP* zfmap, ZFOBJ* obj);
+static int zfcacheinit(ZFMAP* zfmap);
+static ZFOBJ* zfcacheget(ZFMAP* zfmap, const char* key);
+static int zfcacheput(ZFMAP* zfmap, const char* key, FD* fd, ZFOBJ** objp);
+static void zfcacheclear(ZFMAP* zfmap);
+static void zfobjfree(ZFOBJ* obj);
 static void zfunlink(const char* canonpath);
 
 static int platformerr(int err);
@@ -135,9 +187,10 @@ static int platformopenfile(int mode, const char* truepath, FD* fd);
 static int platformopendir(int mode, const char* truepath);
 static int platformdircontent(const char* path, NClist* contents);
 static int platformdelete(const char* path, int delroot);
-static int platformseek(FD* fd, int pos, size64_t* offset);
-static int platformread(FD* fd, size64_t count, void* content);
-static int platformwrite(FD* fd, size64_t count, const void* content);
+static int platformlen(FD* fd, size64_t* lenp);
+static int platformread(FD* fd, size64_t start, size64_t count, void* content);
+static int platformwrite(FD* fd, size64_t start, size64_t count, const void* content);
+static int platformtruncate(FD* fd, size64_t len);
 static void platformrelease(FD* fd);
 static int platformtestcontentbearing(const char* truepath);
 
@@ -224,6 +277,7 @@ zfilecreate(const char *path, int mode, size64_t flags, void* parameters, NCZMAP
     zfmap->map.api = &zapi;
     zfmap->root = abspath;
         abspath = NULL;
+    if((stat = zfcacheinit(zfmap))) goto done;
 
     /* If NC_CLOBBER, then delete below file tree */
     if(!fIsSet(mode,NC_NOCLOBBER))
@@ -297,6 +351,7 @@ zfileopen(const char *path, int mode, size64_t flags, void* parameters, NCZMAP**
     zfmap->map.api = (NCZMAP_API*)&zapi;
     zfmap->root = abspath;
 	abspath = NULL;
+    if((stat = zfcacheinit(zfmap))) goto done;
     
     /* Verify root dir exists */
     if((stat = platformopendir(zfmap->map.mode,zfmap->root)))
@@ -337,16 +392,16 @@ zfileexists(NCZMAP* map, const char* key)
 {
     int stat = NC_NOERR;
     ZFMAP* zfmap = (ZFMAP*)map;
-    FD fd = FDNUL;
+    ZFOBJ* obj = NULL;
 
     ZTRACE(5,"map=%s key=%s",zfmap->map.url,key);
-    switch(stat=zflookupobj(zfmap,key,&fd)) {
+    switch(stat=zflookupobj(zfmap,key,&obj)) {
     case NC_NOERR: break;
     case NC_ENOOBJECT: stat = NC_EEMPTY;
     case NC_EEMPTY: break;
     default: break;
     }
-    zfrelease(zfmap,&fd);    
+    zfrelease(zfmap,obj);
     return ZUNTRACE(stat);
 }
 
@@ -356,23 +411,23 @@ zfilelen(NCZMAP* map, const char* key, size64_t* lenp)
     int stat = NC_NOERR;
     ZFMAP* zfmap = (ZFMAP*)map;
     size64_t len = 0;
-    FD fd = FDNUL;
+    ZFOBJ* obj = NULL;
 
     ZTRACE(5,"map=%s key=%s",map->url,key);
 
-    switch (stat=zflookupobj(zfmap,key,&fd)) {
+    switch (stat=zflookupobj(zfmap,key,&obj)) {
     case NC_NOERR:
         /* Get file size */
-        if((stat=platformseek(&fd, SEEK_END, &len))) goto done;
+        if((stat=platformlen(&obj->fd, &len))) goto done;
 	break;
     case NC_ENOOBJECT: stat = NC_EEMPTY;
     case NC_EEMPTY: break;
     default: break;
     }
-    zfrelease(zfmap,&fd);
     if(lenp) *lenp = len;
 
 done:
+    zfrelease(zfmap,obj);
     return ZUNTRACEX(stat,"len=%llu",(lenp?*lenp:777777777777));
 }
 
@@ -380,7 +435,7 @@ static int
 zfileread(NCZMAP* map, const char* key, size64_t start, size64_t count, void* content)
 {
     int stat = NC_NOERR;
-    FD fd = FDNUL;
+    ZFOBJ* obj = NULL;
     ZFMAP* zfmap = (ZFMAP*)map; /* cast to true type */
     
     ZTRACE(5,"map=%s key=%s start=%llu count=%llu",map->url,key,start,count);
@@ -390,10 +445,9 @@ zfileread(NCZMAP* map, const char* key, size64_t start, size64_t count, void* co
         assert(!"expected file, have dir");
 #endif
 
-    switch (stat = zflookupobj(zfmap,key,&fd)) {
+    switch (stat = zflookupobj(zfmap,key,&obj)) {
     case NC_NOERR:
-        if((stat = platformseek(&fd, SEEK_SET, &start))) goto done;
-        if((stat = platformread(&fd, count, content))) goto done;
+        if((stat = platformread(&obj->fd, start, count, content))) goto done;
 	break;
     case NC_ENOOBJECT: stat = NC_EEMPTY;
     case NC_EEMPTY: break;
@@ -401,47 +455,117 @@ zfileread(NCZMAP* map, const char* key, size64_t start, size64_t count, void* co
     }
     
 done:
-    zfrelease(zfmap,&fd);
+    zfrelease(zfmap,obj);
     return ZUNTRACE(stat);
 }
 
+/* Read the whole object with a single open of the file */
+static int
+zfilereadobject(NCZMAP* map, const char* key, size64_t* lenp, void** contentp)
+{
+    int stat = NC_NOERR;
+    ZFOBJ* obj = NULL;
+    ZFMAP* zfmap = (ZFMAP*)map; /* cast to true type */
+    size64_t len = 0;
+    char* content = NULL;
+
+    ZTRACE(5,"map=%s key=%s",map->url,key);
+
+    switch (stat = zflookupobj(zfmap,key,&obj)) {
+    case NC_NOERR:
+        if((stat = platformlen(&obj->fd, &len))) goto done;
+	if((content = malloc(len+1)) == NULL) {stat = NC_ENOMEM; goto done;}
+        if((stat = platformread(&obj->fd, 0, len, content))) goto done;
+	content[len] = '\0';
+	break;
+    case NC_ENOOBJECT: stat = NC_EEMPTY;
+    case NC_EEMPTY: goto done;
+    default: goto done;
+    }
+    if(lenp) *lenp = len;
+    if(contentp) {*contentp = content; content = NULL;}
+
+done:
+    nullfree(content);
+    zfrelease(zfmap,obj);
+    return ZUNTRACEX(stat,"len=%llu",len);
+}
+
+#ifdef USE_MMAP
+/* Map the whole object copy-on-write, so that the content
+   shares the page cache until it is modified.
+*/
+static int
+zfilemapobject(NCZMAP* map, const char* key, size64_t* lenp, void** contentp)
+{
+    int stat = NC_NOERR;
+    ZFOBJ* obj = NULL;
+    ZFMAP* zfmap = (ZFMAP*)map; /* cast to true type */
+    size64_t len = 0;
+    void* content = NULL;
+
+    ZTRACE(5,"map=%s key=%s",map->url,key);
+
+    switch (stat = zflookupobj(zfmap,key,&obj)) {
+    case NC_NOERR:
+        if((stat = platformlen(&obj->fd, &len))) goto done;
+	/* An empty object cannot be mapped */
+	if(len == 0) {stat = NC_ENOTBUILT; goto done;}
+	content = mmap(NULL,(size_t)len,PROT_READ|PROT_WRITE,MAP_PRIVATE,obj->fd.fd,0);
+	if(content == MAP_FAILED) {stat = NC_ENOTBUILT; goto done;}
+	break;
+    case NC_ENOOBJECT: stat = NC_EEMPTY;
+    case NC_EEMPTY: goto done;
+    default: goto done;
+    }
+    if(lenp) *lenp = len;
+    if(contentp) *contentp = content;
+
+done:
+    errno = 0;
+    zfrelease(zfmap,obj);
+    return ZUNTRACEX(stat,"len=%llu",len);
+}
+
+static int
+zfileunmapobject(NCZMAP* map, void* content, size64_t len)
+{
+    NC_UNUSED(map);
+    if(munmap(content,(size_t)len) < 0) return platformerr(errno);
+    return NC_NOERR;
+}
+#endif /*USE_MMAP*/
+
 static int
 zfilewrite(NCZMAP* map, const char* key, size64_t count, const void* content)
 {
     int stat = NC_NOERR;
-    FD fd = FDNUL;
+    ZFOBJ* obj = NULL;
     ZFMAP* zfmap = (ZFMAP*)map; /* cast to true type */
-    char* truepath = NULL;
-    size64_t start = 0;
 
-    ZTRACE(5,"map=%s key=%s start=%llu count=%llu",map->url,key,start,count);
+    ZTRACE(5,"map=%s key=%s count=%llu",map->url,key,count);
 
 #ifdef VERIFY
     if(!verifykey(key,!FLAG_ISDIR))
         assert(!"expected file, have dir");
 #endif
 
-    switch (stat = zflookupobj(zfmap,key,&fd)) {
+    switch (stat = zflookupobj(zfmap,key,&obj)) {
     case NC_ENOOBJECT:
     case NC_EEMPTY:
-	stat = NC_NOERR;
-	/* Create the directories leading to this */
-	if((stat = zfcreategroup(zfmap,key,SKIPLAST))) goto done;
-        /* Create truepath */
-        if((stat = zffullpath(zfmap,key,&truepath))) goto done;
-	/* Create file */
-	if((stat = platformcreatefile(zfmap->map.mode,truepath,&fd))) goto done;
+	/* Create the file and the directories leading to it */
+	if((stat = zfcreateobj(zfmap,key,&obj))) goto done;
 	/* Fall thru to write the object */
     case NC_NOERR:
-        if((stat = platformseek(&fd, SEEK_SET, &start))) goto done;
-        if((stat = platformwrite(&fd, count, content))) goto done;
+        if((stat = platformwrite(&obj->fd, 0, count, content))) goto done;
+	/* The new content replaces all of any longer, older content */
+        if((stat = platformtruncate(&obj->fd, count))) goto done;
 	break;
     default: break;
     }
 
 done:
-    nullfree(truepath);
-    zfrelease(zfmap,&fd);
+    zfrelease(zfmap,obj);
     return ZUNTRACE(stat);
 }
 
@@ -453,6 +577,8 @@ zfileclose(NCZMAP* map, int delete)
 
     ZTRACE(5,"map=%s delete=%d",map->url,delete);
     if(zfmap == NULL) return NC_NOERR;
+
+    zfcacheclear(zfmap);
     
     /* Delete the subtree below the root and the root */
     if(delete) {
@@ -462,6 +588,12 @@ zfileclose(NCZMAP* map, int delete)
     nczm_clear(map);
     nullfree(zfmap->root);
     zfmap->root = NULL;
+    if(zfmap->cache.index != NULL) {
+	NC_hashmapfree(zfmap->cache.index);
+#ifdef USEPTHREADS
+	pthread_mutex_destroy(&zfmap->cache.lock);
+#endif
+    }
     free(zfmap);
     return ZUNTRACE(stat);
 }
@@ -566,13 +698,18 @@ done:
 @return NC_ENOOBJECT if not found
 */
 static int
-zflookupobj(ZFMAP* zfmap, const char* key, FD* fd)
+zflookupobj(ZFMAP* zfmap, const char* key, ZFOBJ** objp)
 {
     int stat = NC_NOERR;
     char* path = NULL;
+    FD fd = FDNUL;
 
     ZTRACE(5,"map=%s key=%s",zfmap->map.url,key);
 
+    /* An open file is known to be content-bearing */
+    if((*objp = zfcacheget(zfmap,key)) != NULL)
+	goto done;
+
     if((stat = zffullpath(zfmap,key,&path)))
 	{goto done;}    
 
@@ -581,24 +718,197 @@ zflookupobj(ZFMAP* zfmap, const char* key, FD* fd)
 	goto done;        
 
     /* Open the file */
-    if((stat = platformopenfile(zfmap->map.mode,path,fd)))
+    if((stat = platformopenfile(zfmap->map.mode,path,&fd)))
         goto done;
 
+    if((stat = zfcacheput(zfmap,key,&fd,objp)))
+	goto done;
+
 done:
     errno = 0;
+    platformrelease(&fd);
+    nullfree(path);
+    return ZUNTRACE(stat);
+}
+
+/* Create a content-bearing object; the caller
+   has determined that it does not exist.
+*/
+static int
+zfcreateobj(ZFMAP* zfmap, const char* key, ZFOBJ** objp)
+{
+    int stat = NC_NOERR;
+    char* path = NULL;
+    FD fd = FDNUL;
+
+    ZTRACE(5,"map=%s key=%s",zfmap->map.url,key);
+
+    /* Create the directories leading to this */
+    if((stat = zfcreategroup(zfmap,key,SKIPLAST))) goto done;
+    /* Create truepath */
+    if((stat = zffullpath(zfmap,key,&path))) goto done;
+    /* Create file */
+    if((stat = platformcreatefile(zfmap->map.mode,path,&fd))) goto done;
+    if((stat = zfcacheput(zfmap,key,&fd,objp))) goto done;
+
+done:
+    platformrelease(&fd);
     nullfree(path);
     return ZUNTRACE(stat);
 }
 
 /* When we are finished accessing object */
 static void
-zfrelease(ZFMAP* zfmap, FD* fd)
+zfrelease(ZFMAP* zfmap, ZFOBJ* obj)
 {
-    ZTRACE(5,"map=%s fd=%d",zfmap->map.url,(fd?fd->fd:-1));
-    platformrelease(fd);
+    int unused = 0;
+
+    if(obj == NULL) return;
+    ZTRACE(5,"map=%s fd=%d",zfmap->map.url,obj->fd.fd);
+    LOCK(zfmap);
+    obj->refs--;
+    unused = (!obj->cached && obj->refs == 0);
+    UNLOCK(zfmap);
+    if(unused) zfobjfree(obj);
     (void)ZUNTRACE(NC_NOERR);
 }
 
+/**************************************************/
+/* File descriptor cache */
+
+static int
+zfcacheinit(ZFMAP* zfmap)
+{
+    NCglobalstate* ngs = NC_getglobalstate();
+
+    zfmap->cache.capacity = (ngs == NULL ? DFALT_OPENFILES : ngs->zarr.openfiles);
+#ifdef _WIN32
+    zfmap->cache.capacity = 0; /* no pread/pwrite */
+#endif
+    if((zfmap->cache.index = NC_hashmapnew(zfmap->cache.capacity)) == NULL)
+	return NC_ENOMEM;
+#ifdef USEPTHREADS
+    pthread_mutex_init(&zfmap->cache.lock,NULL);
+#endif
+    return NC_NOERR;
+}
+
+static void
+zfobjfree(ZFOBJ* obj)
+{
+    platformrelease(&obj->fd);
+    nullfree(obj->key);
+    free(obj);
+}
+
+static void
+zfcacheunlink(ZFMAP* zfmap, ZFOBJ* obj)
+{
+    if(obj->prev) obj->prev->next = obj->next; else zfmap->cache.head = obj->next;
+    if(obj->next) obj->next->prev = obj->prev; else zfmap->cache.tail = obj->prev;
+    obj->prev = obj->next = NULL;
+}
+
+static void
+zfcachepush(ZFMAP* zfmap, ZFOBJ* obj)
+{
+    obj->prev = NULL;
+    obj->next = zfmap->cache.head;
+    if(zfmap->cache.head) zfmap->cache.head->prev = obj; else zfmap->cache.tail = obj;
+    zfmap->cache.head = obj;
+}
+
+/* Close least recently used descriptors that are not in use
+   until there is room for one more; caller holds the lock.
+   @return 1 if there is room
+*/
+static int
+zfcacheevict(ZFMAP* zfmap)
+{
+    ZFOBJ* obj = zfmap->cache.tail;
+
+    while(obj != NULL && NC_hashmapcount(zfmap->cache.index) >= zfmap->cache.capacity) {
+	ZFOBJ* prev = obj->prev;
+	if(obj->refs == 0) {
+	    NC_hashmapremove(zfmap->cache.index,obj->key,strlen(obj->key),NULL);
+	    zfcacheunlink(zfmap,obj);
+	    zfobjfree(obj);
+	}
+	obj = prev;
+    }
+    return (NC_hashmapcount(zfmap->cache.index) < zfmap->cache.capacity);
+}
+
+/* Return a cached open object, marked as in use, or NULL */
+static ZFOBJ*
+zfcacheget(ZFMAP* zfmap, const char* key)
+{
+    uintptr_t data = 0;
+    ZFOBJ* obj = NULL;
+
+    if(zfmap->cache.capacity == 0) return NULL;
+    LOCK(zfmap);
+    if(NC_hashmapget(zfmap->cache.index,key,strlen(key),&data)) {
+	obj = (ZFOBJ*)data;
+	obj->refs++;
+	zfcacheunlink(zfmap,obj);
+	zfcachepush(zfmap,obj);
+    }
+    UNLOCK(zfmap);
+    return obj;
+}
+
+/* Wrap a newly opened file, taking ownership of *fd, and
+   cache it if there is room.
+*/
+static int
+zfcacheput(ZFMAP* zfmap, const char* key, FD* fd, ZFOBJ** objp)
+{
+    uintptr_t data = 0;
+    ZFOBJ* obj = NULL;
+
+    if((obj = (ZFOBJ*)calloc(1,sizeof(ZFOBJ))) == NULL) return NC_ENOMEM;
+    if((obj->key = strdup(key)) == NULL) {free(obj); return NC_ENOMEM;}
+    obj->fd = *fd;
+    *fd = FDNUL;
+    obj->refs = 1;
+    if(zfmap->cache.capacity > 0) {
+	LOCK(zfmap);
+	if(NC_hashmapget(zfmap->cache.index,key,strlen(key),&data)) {
+	    /* Another thread got here first; use its descriptor */
+	    ZFOBJ* other = (ZFOBJ*)data;
+	    other->refs++;
+	    UNLOCK(zfmap);
+	    zfobjfree(obj);
+	    *objp = other;
+	    return NC_NOERR;
+	}
+	if(zfcacheevict(zfmap)) {
+	    NC_hashmapadd(zfmap->cache.index,(uintptr_t)obj,key,strlen(key));
+	    zfcachepush(zfmap,obj);
+	    obj->cached = 1;
+	}
+	UNLOCK(zfmap);
+    }
+    *objp = obj;
+    return NC_NOERR;
+}
+
+/* Close all cached descriptors; no operations may be in progress */
+static void
+zfcacheclear(ZFMAP* zfmap)
+{
+    ZFOBJ* obj = NULL;
+
+    if(zfmap->cache.index == NULL) return;
+    while((obj = zfmap->cache.head) != NULL) {
+	assert(obj->refs == 0);
+	NC_hashmapremove(zfmap->cache.index,obj->key,strlen(obj->key),NULL);
+	zfcacheunlink(zfmap,obj);
+	zfobjfree(obj);
+    }
+}
+
 /**************************************************/
 /* External API objects */
 
@@ -618,6 +928,16 @@ static NCZMAP_API zapi = {
     zfileread,
     zfilewrite,
     zfilesearch,
+    zfilereadobject,
+#ifdef USE_MMAP
+    zfilemapobject,
+    zfileunmapobject,
+#else
+    NULL, /* mapobject */
+    NULL, /* unmapobject */
+#endif
+    NULL, /* flush */
+    NULL, /* listall */
 };
 
 static int
@@ -801,8 +1121,10 @@ platformcreatedir(int mode, const char* canonpath)
 	if(fIsSet(mode,NC_WRITE)) {
 	    /* Try to create it */
             /* Create the directory using mkdir */
-   	    if(NCmkdir(canonpath,(mode_t)NC_DEFAULT_DIR_PERMS) < 0)
-	        {ret = platformerr(errno); goto done;}
+   	    if(NCmkdir(canonpath,(mode_t)NC_DEFAULT_DIR_PERMS) < 0) {
+		/* Another writer may have created it concurrently */
+		if(errno != EEXIST) {ret = platformerr(errno); goto done;}
+	    }
 	    /* try to access again */
 	    ret = NCaccess(canonpath,ACCESS_MODE_EXISTS);
     	    if(ret < 0)
@@ -1059,30 +1381,31 @@ done:
 }
 
 static int
-platformseek(FD* fd, int pos, size64_t* sizep)
+platformlen(FD* fd, size64_t* lenp)
 {
     int ret = NC_NOERR;
-    size64_t size, newsize;
     struct stat statbuf;    
     
     assert(fd && fd->fd >= 0);
     
-    ZTRACE(6,"fd=%d pos=%d",(fd?fd->fd:-1),pos);
+    ZTRACE(6,"fd=%d",(fd?fd->fd:-1));
 
     errno = 0;
     ret = NCfstat(fd->fd, &statbuf);    
     if(ret < 0)
 	{ret = platformerr(errno); goto done;}
-    if(sizep) size = *sizep; else size = 0;
-    newsize = (size64_t)lseek(fd->fd,(off_t)size,pos);
-    if(sizep) *sizep = newsize;
+    if(lenp) *lenp = (size64_t)statbuf.st_size;
 done:
     errno = 0;
-    return ZUNTRACEX(ret,"sizep=%llu",*sizep);
+    return ZUNTRACEX(ret,"len=%llu",(lenp?*lenp:0));
 }
 
+/* Positioned reads and writes do not move the file offset,
+   so a descriptor can be shared; otherwise the descriptor
+   is private to one operation (see zfcacheinit).
+*/
 static int
-platformread(FD* fd, size64_t count, void* content)
+platformread(FD* fd, size64_t start, size64_t count, void* content)
 {
     int stat = NC_NOERR;
     size_t need = count;
@@ -1090,14 +1413,26 @@ platformread(FD* fd, size64_t count, void* content)
 
     assert(fd && fd->fd >= 0);
 
-    ZTRACE(6,"fd=%d count=%llu",(fd?fd->fd:-1),count);
+    ZTRACE(6,"fd=%d start=%llu count=%llu",(fd?fd->fd:-1),start,count);
 
+#ifdef _WIN32
+    if(lseek(fd->fd,(off_t)start,SEEK_SET) < 0)
+	{stat = platformerr(errno); goto done;}
+#endif
     while(need > 0) {
         ssize_t red;
-        if((red = read(fd->fd,readpoint,need)) <= 0)
-	    {stat = errno; goto done;}
-        need -= red;
+#ifdef _WIN32
+        red = read(fd->fd,readpoint,need);
+#else
+        red = pread(fd->fd,readpoint,need,(off_t)start);
+#endif
+        if(red < 0)
+	    {stat = platformerr(errno); goto done;}
+        if(red == 0) /* the object ends before start+count */
+	    {stat = NC_EEDGE; goto done;}
+        need -= (size_t)red;
 	readpoint += red;
+	start += (size64_t)red;
     }
 done:
     errno = 0;
@@ -1105,7 +1440,7 @@ done:
 }
 
 static int
-platformwrite(FD* fd, size64_t count, const void* content)
+platformwrite(FD* fd, size64_t start, size64_t count, const void* content)
 {
     int ret = NC_NOERR;
     size_t need = count;
@@ -1113,19 +1448,49 @@ platformwrite(FD* fd, size64_t count, const void* content)
 
     assert(fd && fd->fd >= 0);
     
-    ZTRACE(6,"fd=%d count=%llu",(fd?fd->fd:-1),count);
+    ZTRACE(6,"fd=%d start=%llu count=%llu",(fd?fd->fd:-1),start,count);
 
+#ifdef _WIN32
+    if(lseek(fd->fd,(off_t)start,SEEK_SET) < 0)
+	{ret = platformerr(errno); goto done;}
+#endif
     while(need > 0) {
         ssize_t red = 0;
-        if((red = write(fd->fd,(void*)writepoint,need)) <= 0)	
+#ifdef _WIN32
+        red = write(fd->fd,(void*)writepoint,need);
+#else
+        red = pwrite(fd->fd,(void*)writepoint,need,(off_t)start);
+#endif
+        if(red <= 0)	
 	    {ret = NC_EACCESS; goto done;}
-        need -= red;
+        need -= (size_t)red;
 	writepoint += red;
+	start += (size64_t)red;
     }
 done:
     return ZUNTRACE(ret);
 }
 
+static int
+platformtruncate(FD* fd, size64_t len)
+{
+    int ret = NC_NOERR;
+
+    assert(fd && fd->fd >= 0);
+
+    ZTRACE(6,"fd=%d len=%llu",(fd?fd->fd:-1),len);
+
+    errno = 0;
+#ifdef _WIN32
+    if(_chsize_s(fd->fd,(__int64)len) != 0)
+#else
+    if(ftruncate(fd->fd,(off_t)len) < 0)
+#endif
+	ret = platformerr(errno);
+    errno = 0;
+    return ZUNTRACE(ret);
+}
+
 #if 0
 static int
 platformcwd(char** cwdp)
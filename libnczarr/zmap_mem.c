@@ -0,0 +1,691 @@
+/*
+ *	Copyright 2018, University Corporation for Atmospheric Research
+ *      See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ */
+
+#include "zincludes.h"
+#include "nchashmap.h"
+#include "fbits.h"
+
+#if defined(HAVE_PTHREAD_H) && !defined(_WIN32)
+#define USEPTHREADS
+#include <pthread.h>
+#endif
+
+#define NCZM_MEM_V1 1
+
+#define ZMEM_PROPERTIES (0)
+
+/*
+Do a simple mapping of our simplified map model
+to an in-memory store.
+
+A store is a hash-indexed set of (key,content) pairs; there are
+no directories, so the "directory" structure is implied by the
+keys themselves, as with S3.
+
+Every store is named by the path part of the url used to create
+or open it, and all stores live in a process-wide registry. So a
+dataset created with, e.g. "file:///tmp/x.zarr#mode=nczarr,mem"
+is still available to nc_open with the same url after nc_close,
+but no file system operations are ever performed.
+
+A store can be converted to and from a single contiguous image
+(see nczmap_mem_extract and zmemopen) so that it can be moved
+between processes or persisted by the client; this is how
+nc_close_memio and nc_open_memio operate on such datasets.
+
+The image format is as follows; all integers are 8-byte
+little-endian unsigned values.
+    magic: the 8 characters ZMEM_MAGIC
+    nobjects: the number of objects
+    then for each object:
+        keylen: the length of the key
+        key: keylen bytes (no trailing nul)
+        size: the length of the content
+        content: size bytes
+*/
+
+#define ZMEM_MAGIC "NCZMEM01"
+#define ZMEM_MAGICLEN 8
+#define ZMEM_INTLEN 8
+
+/* Define the "subclass" of NCZMAP */
+typedef struct ZMEMOBJ {
+    size64_t size;
+    void* content;
+} ZMEMOBJ;
+
+typedef struct ZMEMSTORE {
+    char* name;
+    size_t refcount; /* |maps open on this store| */
+    int released; /* extracted or deleted; discard when refcount goes to zero */
+    NC_hashmap* objects; /* key -> ZMEMOBJ* */
+#ifdef USEPTHREADS
+    pthread_mutex_t lock; /* chunk I/O may be concurrent */
+#endif
+} ZMEMSTORE;
+
+typedef struct ZMEMMAP {
+    NCZMAP map;
+    ZMEMSTORE* store;
+} ZMEMMAP;
+
+#ifdef USEPTHREADS
+#define LOCK(store) pthread_mutex_lock(&(store)->lock)
+#define UNLOCK(store) pthread_mutex_unlock(&(store)->lock)
+#else
+#define LOCK(store)
+#define UNLOCK(store)
+#endif
+
+/* Forward */
+static NCZMAP_API zapi;
+static int zmemclose(NCZMAP* map, int delete);
+static int zmemparseurl(const char* path, char** namep);
+static ZMEMSTORE* storelookup(const char* name);
+static int storenew(const char* name, ZMEMSTORE** storep);
+static void storeclear(ZMEMSTORE* store);
+static void storefree(ZMEMSTORE* store);
+static void storerelease(ZMEMSTORE* store);
+static int storeput(ZMEMSTORE* store, const char* key, size64_t size, const void* content);
+static int storeinject(ZMEMSTORE* store, size_t size, const unsigned char* image);
+
+/* The registry of all stores; NClist<ZMEMSTORE*> */
+static NClist* zmemstores = NULL;
+
+/**************************************************/
+/* Define the Dataset level API */
+
+/*
+@param path url whose path part names the store
+@param mode the netcdf-c mode flags
+@param flags extra flags
+@param parameters unused
+@param mapp return the map object in this
+*/
+
+static int
+zmemcreate(const char *path, int mode, size64_t flags, void* parameters, NCZMAP** mapp)
+{
+    int stat = NC_NOERR;
+    char* name = NULL;
+    ZMEMMAP* zmmap = NULL;
+    ZMEMSTORE* store = NULL;
+
+    NC_UNUSED(parameters);
+    ZTRACE(5,"path=%s mode=%d flag=%llu",path,mode,flags);
+
+    /* Fixup mode flags */
+    mode |= (NC_NETCDF4 | NC_WRITE);
+
+    if((stat = zmemparseurl(path,&name))) goto done;
+
+    if((store = storelookup(name)) != NULL) {
+        if(fIsSet(mode,NC_NOCLOBBER)) {stat = NC_EEXIST; goto done;}
+	/* Clobber the contents */
+	LOCK(store);
+	storeclear(store);
+	UNLOCK(store);
+    } else if((stat = storenew(name,&store))) goto done;
+
+    /* Build the zmap state */
+    if((zmmap = calloc(1,sizeof(ZMEMMAP))) == NULL)
+	{stat = NC_ENOMEM; goto done;}
+    zmmap->map.format = NCZM_MEM;
+    zmmap->map.url = strdup(path);
+    zmmap->map.flags = flags;
+    /* create => NC_WRITE */
+    zmmap->map.mode = mode;
+    zmmap->map.api = &zapi;
+    zmmap->store = store;
+    store->refcount++;
+
+    if(mapp) {*mapp = (NCZMAP*)zmmap; zmmap = NULL;}
+
+done:
+    nullfree(name);
+    if(zmmap) zmemclose((NCZMAP*)zmmap,1);
+    return ZUNTRACE(stat);
+}
+
+/*
+@param path url whose path part names the store
+@param mode the netcdf-c mode flags
+@param flags extra flags
+@param parameters if not NULL, then an NC_memio* whose
+       image (re)initializes the store
+@param mapp return the map object in this
+*/
+
+static int
+zmemopen(const char *path, int mode, size64_t flags, void* parameters, NCZMAP** mapp)
+{
+    int stat = NC_NOERR;
+    char* name = NULL;
+    ZMEMMAP* zmmap = NULL;
+    ZMEMSTORE* store = NULL;
+    NC_memio* memio = (NC_memio*)parameters;
+
+    ZTRACE(5,"path=%s mode=%d flags=%llu",path,mode,flags);
+
+    /* Fixup mode flags */
+    mode = (NC_NETCDF4 | mode);
+
+    if((stat = zmemparseurl(path,&name))) goto done;
+
+    store = storelookup(name);
+    if(memio != NULL) {
+	/* Inject the image, replacing any current content */
+	if(store == NULL && (stat = storenew(name,&store))) goto done;
+	LOCK(store);
+	storeclear(store);
+	stat = storeinject(store,memio->size,(const unsigned char*)memio->memory);
+	UNLOCK(store);
+	if(stat) {if(store->refcount == 0) storerelease(store); goto done;}
+    } else if(store == NULL)
+	{stat = NC_ENOOBJECT; goto done;}
+
+    /* Build the zmap state */
+    if((zmmap = calloc(1,sizeof(ZMEMMAP))) == NULL)
+	{stat = NC_ENOMEM; goto done;}
+    zmmap->map.format = NCZM_MEM;
+    zmmap->map.url = strdup(path);
+    zmmap->map.flags = flags;
+    zmmap->map.mode = mode;
+    zmmap->map.api = (NCZMAP_API*)&zapi;
+    zmmap->store = store;
+    store->refcount++;
+
+    if(mapp) {*mapp = (NCZMAP*)zmmap; zmmap = NULL;}
+
+done:
+    nullfree(name);
+    if(zmmap) zmemclose((NCZMAP*)zmmap,0);
+    return ZUNTRACE(stat);
+}
+
+static int
+zmemtruncate(const char* surl)
+{
+    int stat = NC_NOERR;
+    char* name = NULL;
+    ZMEMSTORE* store = NULL;
+
+    ZTRACE(6,"url=%s",surl);
+    if((stat = zmemparseurl(surl,&name))) goto done;
+    if((store = storelookup(name)) != NULL) {
+	LOCK(store);
+	storeclear(store);
+	UNLOCK(store);
+    }
+done:
+    nullfree(name);
+    return ZUNTRACE(stat);
+}
+
+/**************************************************/
+/* Object API */
+
+static int
+zmemexists(NCZMAP* map, const char* key)
+{
+    int stat = NC_NOERR;
+    ZMEMMAP* zmmap = (ZMEMMAP*)map;
+
+    ZTRACE(5,"map=%s key=%s",map->url,key);
+    LOCK(zmmap->store);
+    if(!NC_hashmapget(zmmap->store->objects,key,strlen(key),NULL))
+	stat = NC_EEMPTY;
+    UNLOCK(zmmap->store);
+    return ZUNTRACE(stat);
+}
+
+static int
+zmemlen(NCZMAP* map, const char* key, size64_t* lenp)
+{
+    int stat = NC_NOERR;
+    ZMEMMAP* zmmap = (ZMEMMAP*)map;
+    uintptr_t data = 0;
+    size64_t len = 0;
+
+    ZTRACE(5,"map=%s key=%s",map->url,key);
+    LOCK(zmmap->store);
+    if(NC_hashmapget(zmmap->store->objects,key,strlen(key),&data))
+	len = ((ZMEMOBJ*)data)->size;
+    else
+	stat = NC_EEMPTY;
+    UNLOCK(zmmap->store);
+    if(lenp) *lenp = len;
+    return ZUNTRACEX(stat,"len=%llu",len);
+}
+
+static int
+zmemread(NCZMAP* map, const char* key, size64_t start, size64_t count, void* content)
+{
+    int stat = NC_NOERR;
+    ZMEMMAP* zmmap = (ZMEMMAP*)map;
+    uintptr_t data = 0;
+    ZMEMOBJ* obj = NULL;
+
+    ZTRACE(5,"map=%s key=%s start=%llu count=%llu",map->url,key,start,count);
+    LOCK(zmmap->store);
+    if(!NC_hashmapget(zmmap->store->objects,key,strlen(key),&data))
+	{stat = NC_EEMPTY; goto done;}
+    obj = (ZMEMOBJ*)data;
+    if(start > obj->size || count > obj->size - start)
+	{stat = NC_EEDGE; goto done;}
+    if(count > 0)
+	memcpy(content,((char*)obj->content)+start,(size_t)count);
+done:
+    UNLOCK(zmmap->store);
+    return ZUNTRACE(stat);
+}
+
+static int
+zmemwrite(NCZMAP* map, const char* key, size64_t count, const void* content)
+{
+    int stat = NC_NOERR;
+    ZMEMMAP* zmmap = (ZMEMMAP*)map;
+
+    ZTRACE(5,"map=%s key=%s count=%llu",map->url,key,count);
+    LOCK(zmmap->store);
+    stat = storeput(zmmap->store,key,count,content);
+    UNLOCK(zmmap->store);
+    return ZUNTRACE(stat);
+}
+
+static int
+zmemclose(NCZMAP* map, int delete)
+{
+    int stat = NC_NOERR;
+    ZMEMMAP* zmmap = (ZMEMMAP*)map;
+    ZMEMSTORE* store = NULL;
+
+    ZTRACE(5,"map=%s delete=%d",map->url,delete);
+    if(zmmap == NULL) return NC_NOERR;
+    if((store = zmmap->store) != NULL) {
+	assert(store->refcount > 0);
+	store->refcount--;
+	if(delete) store->released = 1;
+	if(store->released && store->refcount == 0)
+	    storerelease(store);
+    }
+    nczm_clear(map);
+    free(zmmap);
+    return ZUNTRACE(stat);
+}
+
+/*
+Return a list of names immediately "below" a specified prefix key.
+The prefix key is not included.
+*/
+static int
+zmemsearch(NCZMAP* map, const char* prefixkey, NClist* matches)
+{
+    int stat = NC_NOERR;
+    ZMEMMAP* zmmap = (ZMEMMAP*)map;
+    NC_hashmap* seen = NC_hashmapnew(0);
+    size_t i, plen;
+
+    ZTRACE(5,"map=%s prefixkey=%s",map->url,prefixkey);
+
+    /* Ignore any trailing separator on the prefix */
+    if(prefixkey == NULL) prefixkey = "";
+    plen = strlen(prefixkey);
+    if(plen > 0 && prefixkey[plen-1] == NCZM_SEP[0]) plen--;
+
+    LOCK(zmmap->store);
+    for(i=0;i<zmmap->store->objects->alloc;i++) {
+	const char* key = NULL;
+	const char* name = NULL;
+	const char* q = NULL;
+	size_t nlen;
+	char* segment = NULL;
+	(void)NC_hashmapith(zmmap->store->objects,i,NULL,&key);
+	if(key == NULL) continue;
+	/* key must be of the form <prefix>/<name>... */
+	if(strncmp(key,prefixkey,plen) != 0 || key[plen] != NCZM_SEP[0]) continue;
+	name = key+plen+1;
+	q = strchr(name,NCZM_SEP[0]);
+	nlen = (q == NULL ? strlen(name) : (size_t)(q - name));
+	if(nlen == 0 || NC_hashmapget(seen,name,nlen,NULL)) continue;
+	if((segment = malloc(nlen+1)) == NULL) {stat = NC_ENOMEM; break;}
+	memcpy(segment,name,nlen);
+	segment[nlen] = '\0';
+	NC_hashmapadd(seen,0,segment,nlen);
+	nclistpush(matches,segment);
+    }
+    UNLOCK(zmmap->store);
+    NC_hashmapfree(seen);
+    return ZUNTRACEX(stat,"|matches|=%d",(int)nclistlength(matches));
+}
+
+/*
+Return the keys, relative to a specified prefix key, of all
+objects anywhere below it; the store is flat, so this is a
+single pass like zmemsearch.
+*/
+static int
+zmemlistall(NCZMAP* map, const char* prefixkey, NClist* keys)
+{
+    int stat = NC_NOERR;
+    ZMEMMAP* zmmap = (ZMEMMAP*)map;
+    size_t i, plen;
+
+    ZTRACE(5,"map=%s prefixkey=%s",map->url,prefixkey);
+
+    /* Ignore any trailing separator on the prefix */
+    if(prefixkey == NULL) prefixkey = "";
+    plen = strlen(prefixkey);
+    if(plen > 0 && prefixkey[plen-1] == NCZM_SEP[0]) plen--;
+
+    LOCK(zmmap->store);
+    for(i=0;i<zmmap->store->objects->alloc;i++) {
+	const char* key = NULL;
+	char* relative = NULL;
+	(void)NC_hashmapith(zmmap->store->objects,i,NULL,&key);
+	if(key == NULL) continue;
+	/* key must be of the form <prefix>/<relative> */
+	if(strncmp(key,prefixkey,plen) != 0 || key[plen] != NCZM_SEP[0] || key[plen+1] == '\0') continue;
+	if((relative = strdup(key+plen+1)) == NULL) {stat = NC_ENOMEM; break;}
+	nclistpush(keys,relative);
+    }
+    UNLOCK(zmmap->store);
+    return ZUNTRACEX(stat,"|keys|=%d",(int)nclistlength(keys));
+}
+
+/* Return a private copy of the whole object */
+static int
+zmemreadobject(NCZMAP* map, const char* key, size64_t* lenp, void** contentp)
+{
+    int stat = NC_NOERR;
+    ZMEMMAP* zmmap = (ZMEMMAP*)map;
+    uintptr_t data = 0;
+    ZMEMOBJ* obj = NULL;
+    char* content = NULL;
+
+    ZTRACE(5,"map=%s key=%s",map->url,key);
+    LOCK(zmmap->store);
+    if(!NC_hashmapget(zmmap->store->objects,key,strlen(key),&data))
+	{stat = NC_EEMPTY; goto done;}
+    obj = (ZMEMOBJ*)data;
+    if((content = malloc((size_t)obj->size+1)) == NULL)
+	{stat = NC_ENOMEM; goto done;}
+    if(obj->size > 0) memcpy(content,obj->content,(size_t)obj->size);
+    content[obj->size] = '\0';
+    if(lenp) *lenp = obj->size;
+    if(contentp) {*contentp = content; content = NULL;}
+done:
+    UNLOCK(zmmap->store);
+    nullfree(content);
+    return ZUNTRACE(stat);
+}
+
+/**************************************************/
+/* Image conversion */
+
+static void
+encodeint(size64_t v, unsigned char* p)
+{
+    int i;
+    for(i=0;i<ZMEM_INTLEN;i++) {p[i] = (unsigned char)(v & 0xff); v >>= 8;}
+}
+
+static size64_t
+decodeint(const unsigned char* p)
+{
+    int i;
+    size64_t v = 0;
+    for(i=ZMEM_INTLEN-1;i>=0;i--) {v = (v << 8) | p[i];}
+    return v;
+}
+
+/**
+Convert the store behind an in-memory map to a single contiguous
+image and release the store; it is discarded when the last map
+referencing it is closed.
+@param map -- an NCZM_MEM map
+@param sizep -- return the image size here
+@param imagep -- return the malloc'd image here
+@return NC_NOERR if the operation succeeded
+@return NC_EINVAL if the map is not an in-memory map
+*/
+int
+nczmap_mem_extract(NCZMAP* map, size64_t* sizep, void** imagep)
+{
+    int stat = NC_NOERR;
+    ZMEMMAP* zmmap = (ZMEMMAP*)map;
+    ZMEMSTORE* store = NULL;
+    size_t i, pass;
+    size64_t size = 0;
+    unsigned char* image = NULL;
+    unsigned char* p = NULL;
+
+    if(map == NULL || map->format != NCZM_MEM) return NC_EINVAL;
+    store = zmmap->store;
+
+    LOCK(store);
+    /* Pass 0 computes the size, pass 1 fills the image */
+    for(pass=0;pass<2;pass++) {
+	if(pass == 0)
+	    size = ZMEM_MAGICLEN + ZMEM_INTLEN;
+	else {
+	    if((image = malloc((size_t)size)) == NULL) {stat = NC_ENOMEM; goto done;}
+	    memcpy(image,ZMEM_MAGIC,ZMEM_MAGICLEN);
+	    encodeint(NC_hashmapcount(store->objects),image+ZMEM_MAGICLEN);
+	    p = image + ZMEM_MAGICLEN + ZMEM_INTLEN;
+	}
+	for(i=0;i<store->objects->alloc;i++) {
+	    const char* key = NULL;
+	    uintptr_t data = 0;
+	    ZMEMOBJ* obj = NULL;
+	    size_t keylen;
+	    (void)NC_hashmapith(store->objects,i,&data,&key);
+	    if(key == NULL) continue;
+	    obj = (ZMEMOBJ*)data;
+	    keylen = strlen(key);
+	    if(pass == 0)
+		size += ZMEM_INTLEN + keylen + ZMEM_INTLEN + obj->size;
+	    else {
+		encodeint(keylen,p); p += ZMEM_INTLEN;
+		memcpy(p,key,keylen); p += keylen;
+		encodeint(obj->size,p); p += ZMEM_INTLEN;
+		if(obj->size > 0) memcpy(p,obj->content,(size_t)obj->size);
+		p += obj->size;
+	    }
+	}
+    }
+    assert(p == image + size);
+    store->released = 1;
+    if(sizep) *sizep = size;
+    if(imagep) {*imagep = image; image = NULL;}
+done:
+    UNLOCK(store);
+    nullfree(image);
+    return stat;
+}
+
+/* Load the objects of an image into an (empty) store; caller holds the lock */
+static int
+storeinject(ZMEMSTORE* store, size_t size, const unsigned char* image)
+{
+    int stat = NC_NOERR;
+    const unsigned char* p = image;
+    const unsigned char* endp = image + size;
+    size64_t i, nobjects;
+    char* key = NULL;
+
+    if(image == NULL || size < ZMEM_MAGICLEN + ZMEM_INTLEN
+       || memcmp(image,ZMEM_MAGIC,ZMEM_MAGICLEN) != 0)
+	{stat = NC_ENOTZARR; goto done;}
+    p += ZMEM_MAGICLEN;
+    nobjects = decodeint(p); p += ZMEM_INTLEN;
+    for(i=0;i<nobjects;i++) {
+	size64_t keylen, objsize;
+	if((size_t)(endp - p) < ZMEM_INTLEN) {stat = NC_ENOTZARR; goto done;}
+	keylen = decodeint(p); p += ZMEM_INTLEN;
+	if(keylen == 0 || (size_t)(endp - p) < keylen + ZMEM_INTLEN) {stat = NC_ENOTZARR; goto done;}
+	if((key = malloc((size_t)keylen+1)) == NULL) {stat = NC_ENOMEM; goto done;}
+	memcpy(key,p,(size_t)keylen); key[keylen] = '\0'; p += keylen;
+	objsize = decodeint(p); p += ZMEM_INTLEN;
+	if((size64_t)(endp - p) < objsize) {stat = NC_ENOTZARR; goto done;}
+	if((stat = storeput(store,key,objsize,p))) goto done;
+	p += objsize;
+	nullfree(key); key = NULL;
+    }
+done:
+    nullfree(key);
+    if(stat) storeclear(store);
+    return stat;
+}
+
+/**************************************************/
+/* Store management */
+
+/* Name the store by the path part of the url */
+static int
+zmemparseurl(const char* path, char** namep)
+{
+    int stat = NC_NOERR;
+    NCURI* uri = NULL;
+
+    ncuriparse(path,&uri);
+    if(uri == NULL || uri->path == NULL || strlen(uri->path) == 0)
+	{stat = NC_EURL; goto done;}
+    if(namep) {*namep = strdup(uri->path); if(*namep == NULL) stat = NC_ENOMEM;}
+done:
+    ncurifree(uri);
+    return stat;
+}
+
+static ZMEMSTORE*
+storelookup(const char* name)
+{
+    size_t i;
+    for(i=0;i<nclistlength(zmemstores);i++) {
+	ZMEMSTORE* store = (ZMEMSTORE*)nclistget(zmemstores,i);
+	if(!store->released && strcmp(store->name,name)==0) return store;
+    }
+    return NULL;
+}
+
+static int
+storenew(const char* name, ZMEMSTORE** storep)
+{
+    int stat = NC_NOERR;
+    ZMEMSTORE* store = NULL;
+
+    if((store = calloc(1,sizeof(ZMEMSTORE))) == NULL) {stat = NC_ENOMEM; goto done;}
+    if((store->name = strdup(name)) == NULL) {stat = NC_ENOMEM; goto done;}
+    if((store->objects = NC_hashmapnew(0)) == NULL) {stat = NC_ENOMEM; goto done;}
+#ifdef USEPTHREADS
+    pthread_mutex_init(&store->lock,NULL);
+#endif
+    if(zmemstores == NULL) zmemstores = nclistnew();
+    nclistpush(zmemstores,store);
+    if(storep) *storep = store;
+    store = NULL;
+done:
+    if(store) {
+	nullfree(store->name);
+	if(store->objects) NC_hashmapfree(store->objects);
+	free(store);
+    }
+    return stat;
+}
+
+/* Insert or replace an object; caller holds the lock */
+static int
+storeput(ZMEMSTORE* store, const char* key, size64_t size, const void* content)
+{
+    int stat = NC_NOERR;
+    size_t keylen = strlen(key);
+    uintptr_t data = 0;
+    ZMEMOBJ* obj = NULL;
+    void* copy = NULL;
+
+    if((copy = malloc((size_t)size+1)) == NULL) {stat = NC_ENOMEM; goto done;}
+    if(size > 0) memcpy(copy,content,(size_t)size);
+    if(NC_hashmapget(store->objects,key,keylen,&data)) {
+	obj = (ZMEMOBJ*)data;
+	nullfree(obj->content);
+    } else {
+	if((obj = calloc(1,sizeof(ZMEMOBJ))) == NULL) {stat = NC_ENOMEM; goto done;}
+	if(!NC_hashmapadd(store->objects,(uintptr_t)obj,key,keylen))
+	    {free(obj); stat = NC_ENOMEM; goto done;}
+    }
+    obj->size = size;
+    obj->content = copy; copy = NULL;
+done:
+    nullfree(copy);
+    return stat;
+}
+
+/* Reclaim all objects; caller holds the lock */
+static void
+storeclear(ZMEMSTORE* store)
+{
+    size_t i;
+    for(i=0;i<store->objects->alloc;i++) {
+	uintptr_t data = 0;
+	const char* key = NULL;
+	(void)NC_hashmapith(store->objects,i,&data,&key);
+	if(key == NULL) continue;
+	nullfree(((ZMEMOBJ*)data)->content);
+	free((ZMEMOBJ*)data);
+    }
+    NC_hashmapfree(store->objects);
+    store->objects = NC_hashmapnew(0);
+}
+
+static void
+storefree(ZMEMSTORE* store)
+{
+    if(store == NULL) return;
+    storeclear(store);
+    NC_hashmapfree(store->objects);
+#ifdef USEPTHREADS
+    pthread_mutex_destroy(&store->lock);
+#endif
+    nullfree(store->name);
+    free(store);
+}
+
+/* Remove from the registry and reclaim */
+static void
+storerelease(ZMEMSTORE* store)
+{
+    size_t i;
+    for(i=0;i<nclistlength(zmemstores);i++) {
+	if(nclistget(zmemstores,i) == store) {nclistremove(zmemstores,i); break;}
+    }
+    if(nclistlength(zmemstores) == 0) {nclistfree(zmemstores); zmemstores = NULL;}
+    storefree(store);
+}
+
+/**************************************************/
+/* External API objects */
+
+NCZMAP_DS_API zmap_mem = {
+    NCZM_MEM_V1,
+    ZMEM_PROPERTIES,
+    zmemcreate,
+    zmemopen,
+    zmemtruncate,
+};
+
+static NCZMAP_API zapi = {
+    NCZM_MEM_V1,
+    zmemclose,
+    zmemexists,
+    zmemlen,
+    zmemread,
+    zmemwrite,
+    zmemsearch,
+    zmemreadobject,
+    NULL, /* mapobject */
+    NULL, /* unmapobject */
+    NULL, /* flush */
+    zmemlistall,
+};
@@ -6,6 +6,12 @@
 #include "zincludes.h"
 #include "zmap.h"
 #include "ncs3sdk.h"
+#include "zqueue.h"
+
+#if defined(HAVE_PTHREAD_H) && !defined(_WIN32)
+#define USEPTHREADS
+#include <pthread.h>
+#endif
 
 #undef S3DEBUG
 
@@ -31,6 +37,24 @@ all keys are assumed to exist, but may have no content.
 Notes:
 1. Our canonical URLs use path style rather than virtual-host, although
    virtual-host URLs will be accepted and converted to path-style.
+
+Deferred writes:
+If the ZARR.S3.WRITEBEHIND rc key is two or more, then zs3write
+copies the content and returns at once, and the PUT is done by one of
+that many worker threads, each with its own S3 client (see zqueue.h).
+The writer blocks while the queued content would exceed
+ZARR.S3.WRITEBEHIND.BYTES. Reads, length requests, and searches wait
+for the writes they could observe. zs3flush (called on nc_sync and
+nc_close) waits for all writes and returns the error of the earliest
+write that failed. Since the content of a failed write is lost, every
+later flush reports the same error.
+
+Concurrency:
+An S3 client must not be used by two threads at once, so each
+operation takes an idle client from the map (creating one if all are
+in use) and returns it when done; chunk reads done by the worker pool
+(see NCZ_get_threadpool) thus each have their own client, and each
+operation keeps its own error message.
 */
 
 #undef DEBUG
@@ -38,16 +62,28 @@ Notes:
 
 #define NCZM_S3SDK_V1 1
 
+/* Every operation has its own client and errmsg; see zs3getclient */
 #define ZS3_PROPERTIES (0)
 
 /* Define the "subclass" of NCZMAP */
 typedef struct ZS3MAP {
     NCZMAP map;
     NCS3INFO s3;
-    void* s3client;
-    char* errmsg;
+    NClist* clients; /* idle S3 clients */
+#ifdef USEPTHREADS
+    pthread_mutex_t lock; /* guards clients */
+#endif
+    NCZqueue* queue; /* Deferred writes; NULL => write synchronously */
 } ZS3MAP;
 
+#ifdef USEPTHREADS
+#define LOCK(z3map) pthread_mutex_lock(&(z3map)->lock)
+#define UNLOCK(z3map) pthread_mutex_unlock(&(z3map)->lock)
+#else
+#define LOCK(z3map)
+#define UNLOCK(z3map)
+#endif
+
 /* Forward */
 static NCZMAP_API nczs3sdkapi; // c++ will not allow static forward variables
 static int zs3len(NCZMAP* map, const char* key, size64_t* lenp);
@@ -59,30 +95,28 @@ static int s3clear(void* s3client, const char* bucket, const char* key);
 
 static int maketruekey(const char* rootpath, const char* key, char** truekeyp);
 
+static int zs3queueinit(ZS3MAP* z3map);
+static int zs3flush(NCZMAP* map);
+static int zs3getclient(ZS3MAP* z3map, void** s3clientp);
+static void zs3putclient(ZS3MAP* z3map, void* s3client);
+
 static void
-errclear(ZS3MAP* z3map)
+errclear(char** errmsgp)
 {
-    if(z3map) {
-        if(z3map->errmsg)
-            free(z3map->errmsg);
-	z3map->errmsg = NULL;
-    }
+    nullfree(*errmsgp);
+    *errmsgp = NULL;
 }
 
-#ifdef DEBUGERRORS
 static void
-reporterr(ZS3MAP* z3map)
+reporterr(char** errmsgp)
 {
-    if(z3map) {
-        if(z3map->errmsg) {
-            nclog(NCLOGERR,z3map->errmsg);
-	}
-	errclear(z3map);
+#ifdef DEBUGERRORS
+    if(*errmsgp) {
+        nclog(NCLOGERR,"%s",*errmsgp);
     }
-}
-#else
-#define reporterr(map)
 #endif
+    errclear(errmsgp);
+}
 
 /* Define the Dataset level API */
 
@@ -112,6 +146,8 @@ zs3create(const char *path, int mode, size64_t flags, void* parameters, NCZMAP**
     NCURI* url = NULL;
     char* prefix = NULL;
     char* truekey = NULL;
+    void* s3client = NULL;
+    char* errmsg = NULL;
 	
     NC_UNUSED(flags);
     NC_UNUSED(parameters);
@@ -123,12 +159,17 @@ zs3create(const char *path, int mode, size64_t flags, void* parameters, NCZMAP**
     /* Build the z3 state */
     if((z3map = (ZS3MAP*)calloc(1,sizeof(ZS3MAP))) == NULL)
 	{stat = NC_ENOMEM; goto done;}
+    z3map->clients = nclistnew();
+#ifdef USEPTHREADS
+    pthread_mutex_init(&z3map->lock,NULL);
+#endif
 
     z3map->map.format = NCZM_S3;
     z3map->map.url = strdup(path);
     z3map->map.mode = mode;
     z3map->map.flags = flags;
     z3map->map.api = (NCZMAP_API*)&nczs3sdkapi;
+    if((stat = zs3queueinit(z3map))) goto done;
 
     /* Parse the URL */
     ncuriparse(path,&url);
@@ -141,37 +182,38 @@ zs3create(const char *path, int mode, size64_t flags, void* parameters, NCZMAP**
     if(z3map->s3.rootkey == NULL)
         {stat = NC_EURL; goto done;}
 
-    z3map->s3client = NC_s3sdkcreateclient(&z3map->s3);
+    if((stat = zs3getclient(z3map,&s3client))) goto done;
 
     {
 	int exists = 0;
         /* Does bucket already exist */
-	if((stat = NC_s3sdkbucketexists(z3map->s3client,z3map->s3.bucket,&exists, &z3map->errmsg))) goto done;
+	if((stat = NC_s3sdkbucketexists(s3client,z3map->s3.bucket,&exists, &errmsg))) goto done;
 	if(!exists) {
 	    /* create it */
-	    if((stat = NC_s3sdkbucketcreate(z3map->s3client,z3map->s3.region,z3map->s3.bucket,&z3map->errmsg)))
+	    if((stat = NC_s3sdkbucketcreate(s3client,z3map->s3.region,z3map->s3.bucket,&errmsg)))
 	        goto done;
 	}
 	/* The root object may or may not already exist */
-        switch (stat = NC_s3sdkinfo(z3map->s3client,z3map->s3.bucket,z3map->s3.rootkey,NULL,&z3map->errmsg)) {
+        switch (stat = NC_s3sdkinfo(s3client,z3map->s3.bucket,z3map->s3.rootkey,NULL,&errmsg)) {
 	case NC_EEMPTY: case NC_ENOOBJECT: /* no such object */
 	    stat = NC_NOERR;  /* which is what we want */
-	    errclear(z3map);
+	    errclear(&errmsg);
 	    break;
 	case NC_NOERR:
 	    stat = NC_EOBJECT;
-	    errclear(z3map);
+	    errclear(&errmsg);
             /* Delete objects inside root object tree */
-            s3clear(z3map->s3client,z3map->s3.bucket,z3map->s3.rootkey);
+            s3clear(s3client,z3map->s3.bucket,z3map->s3.rootkey);
 	    goto done; /* already exists */
-	default: reporterr(z3map); goto done;
+	default: reporterr(&errmsg); goto done;
 	}
     }
     
     if(mapp) *mapp = (NCZMAP*)z3map;    
 
 done:
-    reporterr(z3map);
+    reporterr(&errmsg);
+    if(s3client) zs3putclient(z3map,s3client);
     ncurifree(url);
     nullfree(prefix);
     nullfree(truekey);
@@ -191,6 +233,7 @@ zs3open(const char *path, int mode, size64_t flags, void* parameters, NCZMAP** m
     NCURI* url = NULL;
     NClist* content = NULL;
     size_t nkeys = 0;
+    void* s3client = NULL;
 
     NC_UNUSED(flags);
     NC_UNUSED(parameters);
@@ -202,12 +245,17 @@ zs3open(const char *path, int mode, size64_t flags, void* parameters, NCZMAP** m
     /* Build the z3 state */
     if((z3map = (ZS3MAP*)calloc(1,sizeof(ZS3MAP))) == NULL)
 	{stat = NC_ENOMEM; goto done;}
+    z3map->clients = nclistnew();
+#ifdef USEPTHREADS
+    pthread_mutex_init(&z3map->lock,NULL);
+#endif
 
     z3map->map.format = NCZM_S3;
     z3map->map.url = strdup(path);
     z3map->map.mode = mode;
     z3map->map.flags = flags;
     z3map->map.api = (NCZMAP_API*)&nczs3sdkapi;
+    if((stat = zs3queueinit(z3map))) goto done;
 
     /* Parse the URL */
     if((stat = ncuriparse(path,&url))) goto done;
@@ -220,15 +268,13 @@ zs3open(const char *path, int mode, size64_t flags, void* parameters, NCZMAP** m
     if(z3map->s3.rootkey == NULL)
         {stat = NC_EURL; goto done;}
 
-    z3map->s3client = NC_s3sdkcreateclient(&z3map->s3);
-    if(z3map->s3client == NULL) {
-        stat = NC_ES3; goto done;
-    }
+    /* Make sure that the service can be reached */
+    if((stat = zs3getclient(z3map,&s3client))) goto done;
+    zs3putclient(z3map,s3client);
 
     if(mapp) *mapp = (NCZMAP*)z3map;    
 
 done:
-    reporterr(z3map);
     nclistfreeall(content);
     ncurifree(url);
     if(stat) nczmap_close((NCZMAP*)z3map,0);
@@ -246,6 +292,7 @@ zs3truncate(const char *s3url)
     NCS3INFO info;
 
     ZTRACE(6,"url=%s",s3url);
+    memset(&info,0,sizeof(info));
     ncuriparse(s3url,&url);
     if(url == NULL) {stat = NC_EURL; goto done;}
     if((stat=NC_s3urlprocess(url,&info,&purl))) goto done;
@@ -289,12 +336,16 @@ zs3len(NCZMAP* map, const char* key, size64_t* lenp)
     int stat = NC_NOERR;
     ZS3MAP* z3map = (ZS3MAP*)map;
     char* truekey = NULL;
+    void* s3client = NULL;
+    char* errmsg = NULL;
 
     ZTRACE(6,"map=%s key=%s",map->url,key);
 
     if((stat = maketruekey(z3map->s3.rootkey,key,&truekey))) goto done;
+    NCZ_queuewait(z3map->queue,truekey);
+    if((stat = zs3getclient(z3map,&s3client))) goto done;
 
-    switch (stat = NC_s3sdkinfo(z3map->s3client,z3map->s3.bucket,truekey,lenp,&z3map->errmsg)) {
+    switch (stat = NC_s3sdkinfo(s3client,z3map->s3.bucket,truekey,lenp,&errmsg)) {
     case NC_NOERR: break;
     case NC_EEMPTY: case NC_ENOOBJECT:
 	if(lenp) *lenp = 0;
@@ -303,14 +354,18 @@ zs3len(NCZMAP* map, const char* key, size64_t* lenp)
         goto done;
     }
 done:
+    if(s3client) zs3putclient(z3map,s3client);
     nullfree(truekey);
-    reporterr(z3map);
+    reporterr(&errmsg);
     return ZUNTRACE(stat);
 }
 
 /*
+Read with a single ranged GET; the SDK reports a range
+that runs past the end of the object.
 @return NC_NOERR if object at key was read
 @return NC_EEMPTY if object at key has no content.
+@return NC_EEDGE if the object is shorter than start+count
 @return NC_EXXX return true error
 */
 static int
@@ -318,31 +373,65 @@ zs3read(NCZMAP* map, const char* key, size64_t start, size64_t count, void* cont
 {
     int stat = NC_NOERR;
     ZS3MAP* z3map = (ZS3MAP*)map; /* cast to true type */
-    size64_t size = 0;
     char* truekey = NULL;
+    void* s3client = NULL;
+    char* errmsg = NULL;
     
     ZTRACE(6,"map=%s key=%s start=%llu count=%llu",map->url,key,start,count);
 
     if((stat = maketruekey(z3map->s3.rootkey,key,&truekey))) goto done;
+    NCZ_queuewait(z3map->queue,truekey);
     
-    switch (stat=NC_s3sdkinfo(z3map->s3client, z3map->s3.bucket, truekey, &size, &z3map->errmsg)) {
-    case NC_NOERR: break;
-    case NC_EEMPTY: case NC_ENOOBJECT: goto done;
-    default: goto done; 	
-    }
-    /* Sanity checks */
-    if(start >= size || start+count > size)
-        {stat = NC_EEDGE; goto done;}
     if(count > 0)  {
-        if((stat = NC_s3sdkread(z3map->s3client, z3map->s3.bucket, truekey, start, count, content, &z3map->errmsg)))
-            goto done;
+        if((stat = zs3getclient(z3map,&s3client))) goto done;
+        switch (stat = NC_s3sdkread(s3client, z3map->s3.bucket, truekey, start, count, content, &errmsg)) {
+        case NC_NOERR: break;
+        case NC_EEMPTY: case NC_ENOOBJECT: stat = NC_EEMPTY; goto done;
+        default: goto done;
+        }
     }
 done:
+    if(s3client) zs3putclient(z3map,s3client);
     nullfree(truekey);
-    reporterr(z3map);
+    reporterr(&errmsg);
     return ZUNTRACE(stat);
 }
 
+/*
+Read the whole object with a single GET (no HEAD, no Range).
+@return NC_NOERR if object at key was read
+@return NC_EEMPTY if object at key has no content.
+@return NC_EXXX return true error
+*/
+static int
+zs3readobject(NCZMAP* map, const char* key, size64_t* lenp, void** contentp)
+{
+    int stat = NC_NOERR;
+    ZS3MAP* z3map = (ZS3MAP*)map; /* cast to true type */
+    char* truekey = NULL;
+    size64_t len = 0;
+    void* s3client = NULL;
+    char* errmsg = NULL;
+
+    ZTRACE(6,"map=%s key=%s",map->url,key);
+
+    if((stat = maketruekey(z3map->s3.rootkey,key,&truekey))) goto done;
+    NCZ_queuewait(z3map->queue,truekey);
+    if((stat = zs3getclient(z3map,&s3client))) goto done;
+
+    switch (stat=NC_s3sdkreadobject(s3client, z3map->s3.bucket, truekey, &len, contentp, &errmsg)) {
+    case NC_NOERR: break;
+    case NC_EEMPTY: case NC_ENOOBJECT: stat = NC_EEMPTY; goto done;
+    default: goto done; 	
+    }
+    if(lenp) *lenp = len;
+done:
+    if(s3client) zs3putclient(z3map,s3client);
+    nullfree(truekey);
+    reporterr(&errmsg);
+    return ZUNTRACEX(stat,"len=%llu",len);
+}
+
 /*
 @return NC_NOERR if key content was written
 @return NC_EEMPTY if object at key has no content.
@@ -355,36 +444,36 @@ zs3write(NCZMAP* map, const char* key, size64_t count, const void* content)
     ZS3MAP* z3map = (ZS3MAP*)map; /* cast to true type */
     char* chunk = NULL; /* use char* so we can do arithmetic with it */
     char* truekey = NULL;
-    size64_t objsize;
+    void* s3client = NULL;
+    char* errmsg = NULL;
 	
     ZTRACE(6,"map=%s key=%s count=%llu",map->url,key,count);
 
     if((stat = maketruekey(z3map->s3.rootkey,key,&truekey))) goto done;
 
-    /* Apparently S3 has no write byterange operation, so we need to read the whole object,
-       copy data, and then rewrite */       
-    switch (stat=NC_s3sdkinfo(z3map->s3client, z3map->s3.bucket, truekey, &objsize, &z3map->errmsg)) {
-    case NC_NOERR: /* Figure out the new size of the object */
-        break;
-    case NC_EEMPTY: case NC_ENOOBJECT:
-	stat = NC_NOERR; /* reset */
-        break;
-    default: reporterr(z3map); goto done;
-    }
-
-    chunk = (char*)calloc(1,count); /* initialize it */
+    /* Apparently S3 has no write byterange operation, so the whole object
+       is always (re-)written */
+    chunk = (char*)calloc(1,(count > 0 ? count : 1)); /* initialize it */
     if(chunk == NULL)
 	{stat = NC_ENOMEM; goto done;}
-    /* overwrite the relevant part of the memory with the contents */
     if(count > 0)
         memcpy((char*)chunk,content,count);
+    if(z3map->queue != NULL) {
+	/* Defer the write; the queue takes both the key and the copy */
+	stat = NCZ_queuewrite(z3map->queue,truekey,count,chunk);
+	truekey = NULL;
+	chunk = NULL;
+	goto done;
+    }
     /* (re-)write */
-    if((stat = NC_s3sdkwriteobject(z3map->s3client, z3map->s3.bucket, truekey, count, (void*)chunk, &z3map->errmsg)))
+    if((stat = zs3getclient(z3map,&s3client))) goto done;
+    if((stat = NC_s3sdkwriteobject(s3client, z3map->s3.bucket, truekey, count, (void*)chunk, &errmsg)))
         goto done;
 
 done:
+    if(s3client) zs3putclient(z3map,s3client);
     nullfree(truekey);
-    reporterr(z3map);
+    reporterr(&errmsg);
     nullfree(chunk);
     return ZUNTRACE(stat);
 }
@@ -394,18 +483,31 @@ zs3close(NCZMAP* map, int deleteit)
 {
     int stat = NC_NOERR;
     ZS3MAP* z3map = (ZS3MAP*)map;
+    void* s3client = NULL;
+    char* errmsg = NULL;
+    size_t i;
 
     ZTRACE(6,"map=%s deleteit=%d",map->url, deleteit);
 
-    if(deleteit) 
-        s3clear(z3map->s3client,z3map->s3.bucket,z3map->s3.rootkey);
-     if(z3map->s3client && z3map->s3.bucket && z3map->s3.rootkey) {
-        NC_s3sdkclose(z3map->s3client, &z3map->errmsg);
+    /* Complete the deferred writes before clearing or closing anything */
+    stat = zs3flush(map);
+    NCZ_queuefree(z3map->queue);
+    z3map->queue = NULL;
+    if(deleteit && z3map->s3.bucket && z3map->s3.rootkey
+       && zs3getclient(z3map,&s3client) == NC_NOERR) {
+        s3clear(s3client,z3map->s3.bucket,z3map->s3.rootkey);
+        zs3putclient(z3map,s3client);
     }
-    reporterr(z3map);
-    z3map->s3client = NULL;
+    /* No operation is in progress, so every client is idle */
+    for(i=0;i<nclistlength(z3map->clients);i++) {
+        NC_s3sdkclose(nclistget(z3map->clients,i), &errmsg);
+        reporterr(&errmsg);
+    }
+    nclistfree(z3map->clients);
+#ifdef USEPTHREADS
+    pthread_mutex_destroy(&z3map->lock);
+#endif
     NC_s3clear(&z3map->s3);
-    nullfree(z3map->errmsg);
     nczm_clear(map);
     nullfree(map);
     return ZUNTRACE(stat);
@@ -431,13 +533,17 @@ zs3search(NCZMAP* map, const char* prefix, NClist* matches)
     char* trueprefix = NULL;
     char* newkey = NULL;
     const char* p;
+    void* s3client = NULL;
+    char* errmsg = NULL;
 
     ZTRACE(6,"map=%s prefix0=%s",map->url,prefix);
     
     if((stat = maketruekey(z3map->s3.rootkey,prefix,&trueprefix))) goto done;
+    NCZ_queuewait(z3map->queue,NULL);
     
-    if(*trueprefix != '/') return NC_EINTERNAL;
-    if((stat = NC_s3sdklist(z3map->s3client,z3map->s3.bucket,trueprefix,&nkeys,&list,&z3map->errmsg)))
+    if(*trueprefix != '/') {stat = NC_EINTERNAL; goto done;}
+    if((stat = zs3getclient(z3map,&s3client))) goto done;
+    if((stat = NC_s3sdklist(s3client,z3map->s3.bucket,trueprefix,&nkeys,&list,&errmsg)))
         goto done;
     if(nkeys > 0) {
 	size_t tplen = strlen(trueprefix);
@@ -476,14 +582,152 @@ zs3search(NCZMAP* map, const char* prefix, NClist* matches)
 #endif
 
 done:
+    if(s3client) zs3putclient(z3map,s3client);
     nullfree(newkey);
     nullfree(trueprefix);
-    reporterr(z3map);
+    reporterr(&errmsg);
     nclistfreeall(tmp);
     freevector(nkeys,list);
     return ZUNTRACEX(stat,"|matches|=%d",(int)nclistlength(matches));
 }
 
+/*
+Return the keys, relative to prefix, of all objects anywhere
+below prefix, from a single (paged) listing without a delimiter.
+@return NC_NOERR if the operation succeeded
+@return NC_EXXX return true error
+*/
+static int
+zs3listall(NCZMAP* map, const char* prefix, NClist* keys)
+{
+    int stat = NC_NOERR;
+    size_t i;
+    ZS3MAP* z3map = (ZS3MAP*)map;
+    char** list = NULL;
+    size_t nkeys = 0;
+    char* trueprefix = NULL;
+    size_t tplen;
+    void* s3client = NULL;
+    char* errmsg = NULL;
+
+    ZTRACE(6,"map=%s prefix0=%s",map->url,prefix);
+
+    if((stat = maketruekey(z3map->s3.rootkey,prefix,&trueprefix))) goto done;
+    NCZ_queuewait(z3map->queue,NULL);
+
+    if(*trueprefix != '/') {stat = NC_EINTERNAL; goto done;}
+    if((stat = zs3getclient(z3map,&s3client))) goto done;
+    if((stat = NC_s3sdklistall(s3client,z3map->s3.bucket,trueprefix,&nkeys,&list,&errmsg)))
+        goto done;
+    tplen = strlen(trueprefix);
+    for(i=0;i<nkeys;i++) {
+	const char* l = list[i];
+	char* relative = NULL;
+	/* Keep only keys strictly below trueprefix, without it */
+	if(memcmp(trueprefix,l,tplen) != 0 || l[tplen] != '/' || l[tplen+1] == '\0') continue;
+	if((relative = strdup(l+tplen+1)) == NULL) {stat = NC_ENOMEM; goto done;}
+	nclistpush(keys,relative);
+    }
+
+done:
+    if(s3client) zs3putclient(z3map,s3client);
+    nullfree(trueprefix);
+    reporterr(&errmsg);
+    freevector(nkeys,list);
+    return ZUNTRACEX(stat,"|keys|=%d",(int)nclistlength(keys));
+}
+
+/**************************************************/
+/* Clients */
+
+/* Take an idle client, or create one if every client is in use */
+static int
+zs3getclient(ZS3MAP* z3map, void** s3clientp)
+{
+    void* s3client = NULL;
+
+    LOCK(z3map);
+    s3client = nclistpop(z3map->clients);
+    UNLOCK(z3map);
+    if(s3client == NULL && (s3client = NC_s3sdkcreateclient(&z3map->s3)) == NULL)
+	return NC_ES3;
+    *s3clientp = s3client;
+    return NC_NOERR;
+}
+
+/* Return a client taken by zs3getclient */
+static void
+zs3putclient(ZS3MAP* z3map, void* s3client)
+{
+    LOCK(z3map);
+    nclistpush(z3map->clients,s3client);
+    UNLOCK(z3map);
+}
+
+/**************************************************/
+/* Deferred writes */
+
+/* Worker callbacks; each worker has its own client */
+static int
+zs3newclient(void* state, void** clientp)
+{
+    ZS3MAP* z3map = (ZS3MAP*)state;
+    if((*clientp = NC_s3sdkcreateclient(&z3map->s3)) == NULL)
+	return NC_ES3;
+    return NC_NOERR;
+}
+
+static void
+zs3freeclient(void* state, void* s3client)
+{
+    NC_UNUSED(state);
+    (void)NC_s3sdkclose(s3client,NULL);
+}
+
+static int
+zs3put(void* state, void* s3client, const char* truekey, size64_t count, const void* content)
+{
+    int stat = NC_NOERR;
+    ZS3MAP* z3map = (ZS3MAP*)state;
+    char* errmsg = NULL;
+
+    stat = NC_s3sdkwriteobject(s3client, z3map->s3.bucket, truekey, count, content, &errmsg);
+    if(errmsg != NULL) {
+	nclog(NCLOGERR,"%s",errmsg);
+	free(errmsg);
+    }
+    return stat;
+}
+
+static const NCZqueueops zs3queueops = {zs3newclient, zs3freeclient, zs3put};
+
+static int
+zs3queueinit(ZS3MAP* z3map)
+{
+    NCglobalstate* ngs = NC_getglobalstate();
+    size_t maxputs = (ngs == NULL ? DFALT_WRITEBEHIND : ngs->zarr.writebehind);
+    size64_t maxbytes = (ngs == NULL ? DFALT_WRITEBEHIND_BYTES : ngs->zarr.writebehind_bytes);
+
+    return NCZ_queuenew(maxputs,maxbytes,&zs3queueops,z3map,&z3map->queue);
+}
+
+/*
+Wait for all deferred writes.
+@return NC_NOERR if all deferred writes succeeded
+@return NC_EXXX the error of the earliest of them that failed
+*/
+static int
+zs3flush(NCZMAP* map)
+{
+    int stat = NC_NOERR;
+    ZS3MAP* z3map = (ZS3MAP*)map;
+
+    if(z3map->queue == NULL) return NC_NOERR;
+    ZTRACE(6,"map=%s",map->url);
+    stat = NCZ_queueflush(z3map->queue);
+    return ZUNTRACE(stat);
+}
+
 /**************************************************/
 /* S3 Utilities */
 
@@ -584,4 +828,9 @@ nczs3sdkapi = {
     zs3read,
     zs3write,
     zs3search,
+    zs3readobject,
+    NULL, /* mapobject */
+    NULL, /* unmapobject */
+    zs3flush,
+    zs3listall,
 };
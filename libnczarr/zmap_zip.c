@@ -29,7 +29,7 @@
 
 #define NCZM_ZIP_V1 1
 
-#define ZIP_PROPERTIES (NCZM_WRITEONCE)
+#define ZIP_PROPERTIES (NCZM_WRITEONCE|NCZM_NOCONCURRENCY)
 
 /*
 Do a simple mapping of our simplified map model
@@ -406,14 +406,14 @@ zipread(NCZMAP* map, const char* key, size64_t start, size64_t count, void* cont
     if(start == 0) { /*optimize to read directly into content */
         if((red = zip_fread(zfile, content, (zip_uint64_t)count)) < 0)
 	    {stat = (zipmaperr(zzmap)); goto done;}
-	if(red < count) {stat = NC_EINTERNAL; goto done;}
+	if(red < count) {stat = NC_EEDGE; goto done;}
     } else {
         endpoint = start + count;
         if((buffer = malloc(endpoint))==NULL) /* consider caching this */
             {stat = NC_ENOMEM; goto done;}
         if((red = zip_fread(zfile, buffer, (zip_uint64_t)endpoint)) < 0)
 	    {stat = (zipmaperr(zzmap)); goto done;}
-	if(red < endpoint) {stat = NC_EINTERNAL; goto done;}
+	if(red < endpoint) {stat = NC_EEDGE; goto done;}
         /* Extract what we need */
         memcpy(content,buffer+start,count);
     }
@@ -426,6 +426,49 @@ done:
     return ZUNTRACE(stat);
 }
 
+/* Read the whole (decompressed) object in one pass */
+static int
+zipreadobject(NCZMAP* map, const char* key, size64_t* lenp, void** contentp)
+{
+    int stat = NC_NOERR;
+    ZZMAP* zzmap = (ZZMAP*)map; /* cast to true type */
+    zip_file_t* zfile = NULL;
+    ZINDEX zindex = -1;
+    zip_flags_t zipflags = 0;
+    int zerrno;
+    size64_t len = 0;
+    char* content = NULL;
+    zip_int64_t red = 0;
+
+    ZTRACE(6,"map=%s key=%s",map->url,key);
+
+    switch(stat = zzlookupobj(zzmap,key,&zindex)) {
+    case NC_NOERR: break;
+    case NC_ENOOBJECT: stat = NC_EEMPTY; /* fall thru */
+    case NC_EEMPTY: /* its a dir; fall thru*/
+    default: goto done;
+    }
+    if((stat = zzlen(zzmap,zindex,&len))) goto done;
+    if((content = malloc(len+1)) == NULL) {stat = NC_ENOMEM; goto done;}
+
+    zfile = zip_fopen_index(zzmap->archive, (zip_uint64_t)zindex, zipflags);
+    if(zfile == NULL)
+	{stat = (zipmaperr(zzmap)); goto done;}
+    if((red = zip_fread(zfile, content, (zip_uint64_t)len)) < 0)
+	{stat = (zipmaperr(zzmap)); goto done;}
+    if(red < len) {stat = NC_EINTERNAL; goto done;}
+    content[len] = '\0';
+
+    if(lenp) *lenp = len;
+    if(contentp) {*contentp = content; content = NULL;}
+
+done:
+    nullfree(content);
+    if(zfile != NULL && (zerrno=zip_fclose(zfile)) != 0)
+        {stat = ziperrno(zerrno);}
+    return ZUNTRACEX(stat,"len=%llu",len);
+}
+
 static int
 zipwrite(NCZMAP* map, const char* key, size64_t count, const void* content)
 {
@@ -748,6 +791,11 @@ static NCZMAP_API zapi = {
     zipread,
     zipwrite,
     zipsearch,
+    zipreadobject,
+    NULL, /* mapobject */
+    NULL, /* unmapobject */
+    NULL, /* flush */
+    NULL, /* listall */
 };
 
 static int
@@ -78,6 +78,12 @@ int NCZMD_get_metadata_format(NCZ_FILE_INFO_T *zfile, int *zarrformat)
 		return NC_NOERR;
 	}
 
+	if (nczmap_exists(zfile->map, Z3METADATA) == NC_NOERR)
+	{
+		*zarrformat = ZARRFORMAT3;
+		return NC_NOERR;
+	}
+
 	if (!nczmap_exists(zfile->map, "/" Z2ATTRS) && !nczmap_exists(zfile->map, "/" Z2GROUP) && !nczmap_exists(zfile->map, "/" Z2ARRAY))
 	{
 		return NC_ENOTZARR;
@@ -100,6 +106,16 @@ int use_consolidated_metadata(NCZ_FILE_INFO_T *zfile) {
 
 int NCZMD_set_metadata_handler(NCZ_FILE_INFO_T *zfile) {
     NCjson *jcsl = NULL;
+    const NCZ_Metadata *plain = NCZ_metadata_handler2;
+    const NCZ_Metadata *csl = NCZ_csl_metadata_handler2;
+    const char *cslkey = Z2METADATA;
+
+    if (zfile->format.zarr == ZARRFORMAT3) {
+        /* V3 keeps the consolidated view inside the root zarr.json */
+        plain = NCZ_metadata_handler3;
+        csl = NCZ_csl_metadata_handler3;
+        cslkey = Z3METADATA;
+    }
 
     int use_consolidated = use_consolidated_metadata(zfile);
     if (!use_consolidated){
@@ -107,40 +123,50 @@ int NCZMD_set_metadata_handler(NCZ_FILE_INFO_T *zfile) {
     }
 
     if (use_consolidated && zfile->creating) {
-        zfile->metadata = *NCZ_csl_metadata_handler2;
+        zfile->metadata = *csl;
         return NC_NOERR;
     }
 
-	zfile->metadata = *NCZ_metadata_handler2;
+	zfile->metadata = *plain;
     if (!use_consolidated)
         return NC_NOERR;
 
-    if (NCZ_downloadjson(zfile->map, Z2METADATA, &jcsl) || jcsl == NULL) {
+    /* The consolidated metadata can be large and is only ever cloned from
+       or added to, so parse it into a single arena */
+    if (NCZ_downloadjsonx(zfile->map, cslkey, NCJFLAG_ARENA, &jcsl) || jcsl == NULL) {
         nclog(NCLOGNOTE, "Dataset not consolidated! Doing so will improve performance");
         return NC_NOERR;
     }
 
-    if (NCZ_csl_metadata_handler2->validate_consolidated(jcsl) != NC_NOERR) {
+    if (csl->validate_consolidated(jcsl) != NC_NOERR) {
+        if (zfile->format.zarr == ZARRFORMAT3) {
+            /* A root zarr.json without a consolidated view is legal */
+            NCJreclaim(jcsl);
+            nclog(NCLOGNOTE, "Dataset not consolidated! Doing so will improve performance");
+            return NC_NOERR;
+        }
         nclog(NCLOGWARN,"Consolidated metadata is invalid, ignoring it!");
         return NC_EZARRMETA;
     }
 
-    zfile->metadata = *NCZ_csl_metadata_handler2;
+    zfile->metadata = *csl;
     zfile->metadata.jcsl = jcsl;
     return NC_NOERR;
 }
 
 void NCZMD_free_metadata_handler(NCZ_Metadata * zmd){
 	if (zmd == NULL) return;
+	NCZMD_v2_free_csltree(zmd->csltree);
+    zmd->csltree = NULL;
 	NCJreclaim(zmd->jcsl);
     zmd->jcsl = NULL;
+	NCJreclaim(zmd->jnodes);
+    zmd->jnodes = NULL;
+	NCJreclaim(zmd->jpending);
+    zmd->jpending = NULL;
 }
 
 int NCZMD_consolidate(NCZ_FILE_INFO_T *zfile)
 {
-	int stat = NC_NOERR;
-	if (zfile->creating == 1 && zfile->metadata.jcsl !=NULL){
-		stat = NCZ_uploadjson(zfile->map, Z2METADATA ,zfile->metadata.jcsl);
-	}
-	return stat;
+	return zfile->metadata.consolidate(zfile);
 }
@@ -18,8 +18,11 @@ filesystem access, content reading of the JSON metadata files
 	Directly read from filesystem/objectstore or retrieve the JSON
 	object from the consolidated view respective to the group or variable
 
-Note: This will also be the case of zarr v3
-(the elements will be extracted from zarr.json instead)
+For zarr v3, the elements are extracted from the single zarr.json
+object of each node and presented in the same (v2) form, so that the
+rest of the code need not know which format is being used.
+Writes are held back and flushed as one zarr.json per node by the
+consolidate operation.
 */
 
 #ifndef ZMETADATA_H
@@ -27,6 +30,7 @@ Note: This will also be the case of zarr v3
 
 /* Opaque */
 struct NCZ_FILE_INFO;
+struct NCZ_CSLTree;
 
 #if defined(__cplusplus)
 extern "C"
@@ -35,11 +39,13 @@ extern "C"
 /* This is the version of the metadata table. It should be changed
  * when new functions are added to the metadata table. */
 #ifndef NCZ_METADATA_VERSION
-#define NCZ_METADATA_VERSION 1
+#define NCZ_METADATA_VERSION 2
 #endif /*NCZ_METADATA_VERSION*/
 
 #define Z2METADATA "/.zmetadata"
 #define ZARRFORMAT2 2
+#define Z3METADATA "/zarr.json"
+#define ZARRFORMAT3 3
 
 /* The name of the env var for controlling .zmetadata use*/
 #define NCZARR_CONSOLIDATED_KEY_ENV "NCZARR_METADATA_CONSOLIDATED_KEY"
@@ -48,6 +54,7 @@ extern "C"
 
 #define ZARR_NOT_CONSOLIDATED 0
 #define ZARR_CONSOLIDATED 1
+#define ZARR_CSL_MODIFIED 2 /* the consolidated view has changes not yet written */
 
 typedef enum {
 	NCZMD_NULL,
@@ -62,16 +69,22 @@ typedef struct NCZ_Metadata
 	int dispatch_version;   /* Dispatch table version*/
 	size64_t flags;			/* Metadata handling flags */
 	NCjson *jcsl; // Consolidated JSON view or NULL
+	struct NCZ_CSLTree *csltree; // V2: jcsl indexed by node path, built on first use
+	NCjson *jnodes; // V3: zarr.json objects read so far, by key
+	NCjson *jpending; // V3: node content waiting to be written, by key
 	int (*list_nodes)(struct NCZ_FILE_INFO*, const char * key, NClist *groups, NClist *vars);
 	int (*list_groups)(struct NCZ_FILE_INFO*, const char * key, NClist *subgrpnames);
 	int (*list_variables)(struct NCZ_FILE_INFO*, const char * key, NClist *varnames);
 	int (*fetch_json_content)(struct NCZ_FILE_INFO*, NCZMD_MetadataType, const char *name, NCjson **jobj);
 	int (*update_json_content)(struct NCZ_FILE_INFO*, NCZMD_MetadataType, const char *name, const NCjson *jobj);
 	int (*validate_consolidated)(const NCjson *jobj);
+	int (*consolidate)(struct NCZ_FILE_INFO*);
 } NCZ_Metadata;
 
 extern const NCZ_Metadata *NCZ_metadata_handler2;
 extern const NCZ_Metadata *NCZ_csl_metadata_handler2;
+extern const NCZ_Metadata *NCZ_metadata_handler3;
+extern const NCZ_Metadata *NCZ_csl_metadata_handler3;
 
 /// @brief Sets the metadata handler for the given zarr file based on
 /// 	environment variables, file creation mode, and dataset contents.
@@ -89,7 +102,12 @@ extern int NCZMD_get_metadata_format(struct NCZ_FILE_INFO* zfile, int *zarrforma
 /// @param zmd - Potinter to the metadata handler structure
 extern void NCZMD_free_metadata_handler(NCZ_Metadata * zmd);
 
-/// @brief Upload the .zmetadata object
+/// @brief Frees the path index of a V2 consolidated view
+/// @param tree - The index, may be NULL
+extern void NCZMD_v2_free_csltree(struct NCZ_CSLTree *tree);
+
+/// @brief Write out any held back metadata and the consolidated view
+/// 	(.zmetadata for V2, "consolidated_metadata" in /zarr.json for V3)
 /// @param zfile - The zarr file info structure
 extern int NCZMD_consolidate(struct NCZ_FILE_INFO* zfile);
 
@@ -4,6 +4,7 @@
  *********************************************************************/
 
 #include "zincludes.h"
+#include "nchashmap.h"
 
 #define  MINIMIM_CSL_REP_RAW "{\"metadata\":{},\"zarr_consolidated_format\":1}"
 
@@ -95,6 +96,16 @@ int validate_consolidated_json_noop_v2(const NCjson *json);
 /// @return `NC_NOERR` if valid, `NC_EZARRMETA` otherwise
 int validate_consolidated_json_v2(const NCjson *json);
 
+/// @brief Place holder for non consolidated handler; everything is written as it is updated
+/// @param zfile - Not used!
+/// @return `NC_NOERR` always
+int consolidate_noop_v2(NCZ_FILE_INFO_T *zfile);
+
+/// @brief Upload the consolidated representation as the .zmetadata object
+/// @param zfile - The zarr file info structure
+/// @return `NC_NOERR` if succeeding
+int consolidate_v2(NCZ_FILE_INFO_T *zfile);
+
 static const NCZ_Metadata NCZ_md2_table = {
 	ZARRFORMAT2,
 	NCZ_METADATA_VERSION,
@@ -108,6 +119,7 @@ static const NCZ_Metadata NCZ_md2_table = {
 	.fetch_json_content = fetch_json_content_v2,
 	.update_json_content = update_json_content_v2,
     .validate_consolidated = validate_consolidated_json_noop_v2,
+	.consolidate = consolidate_noop_v2,
 };
 
 const NCZ_Metadata *NCZ_metadata_handler2 = &NCZ_md2_table;
@@ -125,6 +137,7 @@ static const NCZ_Metadata NCZ_csl_md2_table = {
 	.fetch_json_content = fetch_csl_json_content_v2,
 	.update_json_content = update_csl_json_content_v2,
     .validate_consolidated = validate_consolidated_json_v2,
+	.consolidate = consolidate_v2,
 };
 
 const NCZ_Metadata *NCZ_csl_metadata_handler2 = &NCZ_csl_md2_table;
@@ -172,50 +185,177 @@ done:
 	return stat;
 }
 
-int NCZMD_v2_csl_list_nodes(NCZ_FILE_INFO_T *zfile, const char * key, NClist *groups, NClist *variables)
+/**************************************************/
+/* Path index of the consolidated view.
+
+The keys of the consolidated "metadata" dict are flat object keys
+such as "g/v/.zarray". Rather than rescanning and splitting all of
+them for every group that is listed, they are sorted once into one
+node per group or array path, holding the names of its child groups
+and arrays and (borrowed) pointers to its .zgroup, .zattrs and
+.zarray content. Listing and fetching are then a single hash lookup.
+The tree is built on first use and kept up to date by
+update_csl_json_content_v2.
+*/
+
+typedef struct NCZ_CSLNode {
+	NClist *groups; /* names of the child groups */
+	NClist *vars; /* names of the child arrays */
+	const NCjson *jgroup; /* owned by jcsl */
+	const NCjson *jattrs;
+	const NCjson *jarray;
+} NCZ_CSLNode;
+
+struct NCZ_CSLTree {
+	NC_hashmap *nodes; /* absolute path ("/", "/g", "/g/v") -> NCZ_CSLNode* */
+	NClist *all; /* all NCZ_CSLNode*, for reclamation */
+};
+
+/* Convert key to the absolute path form used by the tree: leading '/', no trailing '/' */
+static char *
+csl_path(const char *key, size_t len)
+{
+	char *path = NULL;
+	while (len > 0 && key[0] == '/') {key++; len--;}
+	while (len > 0 && key[len-1] == '/') len--;
+	if ((path = (char*)malloc(len + 2)) == NULL)
+		return NULL;
+	path[0] = '/';
+	memcpy(path + 1, key, len);
+	path[len + 1] = '\0';
+	return path;
+}
+
+static NCZ_CSLNode *
+csl_getnode(struct NCZ_CSLTree *tree, const char *path)
+{
+	uintptr_t data = 0;
+	if (NC_hashmapget(tree->nodes, path, strlen(path), &data))
+		return (NCZ_CSLNode *)data;
+	return NULL;
+}
+
+static NCZ_CSLNode *
+csl_makenode(struct NCZ_CSLTree *tree, const char *path)
+{
+	NCZ_CSLNode *node = csl_getnode(tree, path);
+	if (node != NULL)
+		return node;
+	if ((node = (NCZ_CSLNode *)calloc(1, sizeof(NCZ_CSLNode))) == NULL)
+		return NULL;
+	node->groups = nclistnew();
+	node->vars = nclistnew();
+	nclistpush(tree->all, node);
+	if (!NC_hashmapadd(tree->nodes, (uintptr_t)node, path, strlen(path)))
+		return NULL;
+	return node;
+}
+
+/* Enter one consolidated key and its content into the tree */
+static int
+csl_addkey(struct NCZ_CSLTree *tree, const char *key, const NCjson *jvalue)
 {
-	size_t i;
 	int stat = NC_NOERR;
-	char *subkey = NULL;
-	char *zgroup = NULL;
-	NClist *segments = nclistnew();
+	const char *suffix = strrchr(key, NCZM_SEP[0]);
+	const char *name = NULL;
+	char *path = NULL;
+	char *parentpath = NULL;
+	NCZ_CSLNode *node = NULL;
+	NCZ_CSLNode *parent = NULL;
+	const NCjson **slot = NULL;
+	int visible = 0;
+
+	suffix = (suffix == NULL ? key : suffix + 1);
+	if ((path = csl_path(key, (size_t)(suffix - key))) == NULL) {stat = NC_ENOMEM; goto done;}
+	if ((node = csl_makenode(tree, path)) == NULL) {stat = NC_ENOMEM; goto done;}
+	if (strcmp(suffix, Z2GROUP) == 0) slot = &node->jgroup;
+	else if (strcmp(suffix, Z2ATTRS) == 0) slot = &node->jattrs;
+	else if (strcmp(suffix, Z2ARRAY) == 0) slot = &node->jarray;
+	else goto done; /* not a metadata object */
+
+	/* A node becomes visible in its parent when its .zgroup or .zarray first appears */
+	visible = (*slot == NULL && slot != &node->jattrs && path[1] != '\0');
+	*slot = jvalue;
+	if (visible) {
+		name = strrchr(path, '/');
+		if ((parentpath = csl_path(path, (size_t)(name - path))) == NULL) {stat = NC_ENOMEM; goto done;}
+		if ((parent = csl_makenode(tree, parentpath)) == NULL) {stat = NC_ENOMEM; goto done;}
+		nclistpush((slot == &node->jgroup ? parent->groups : parent->vars), strdup(name + 1));
+	}
+done:
+	nullfree(path);
+	nullfree(parentpath);
+	return stat;
+}
 
-	const char *group = key + (key[0] == '/');
-	size_t lgroup = strlen(group);
+void
+NCZMD_v2_free_csltree(struct NCZ_CSLTree *tree)
+{
+	size_t i;
+	if (tree == NULL) return;
+	for (i = 0; i < nclistlength(tree->all); i++) {
+		NCZ_CSLNode *node = (NCZ_CSLNode *)nclistget(tree->all, i);
+		nclistfreeall(node->groups);
+		nclistfreeall(node->vars);
+		free(node);
+	}
+	nclistfree(tree->all);
+	NC_hashmapfree(tree->nodes);
+	free(tree);
+}
 
+/* Return the path index of the consolidated view, building it if necessary */
+static int
+csl_tree(NCZ_FILE_INFO_T *zfile, struct NCZ_CSLTree **treep)
+{
+	int stat = NC_NOERR;
+	size_t i;
+	struct NCZ_CSLTree *tree = NULL;
 	const NCjson *jmetadata = NULL;
-	NCJdictget(zfile->metadata.jcsl, "metadata", &jmetadata);
-	for (i = 0; i < NCJdictlength(jmetadata); i++)
-	{
-		NCjson *jname = NCJdictkey(jmetadata, i);
-		const char *fullname = NCJstring(jname);
-		size_t lfullname = strlen(fullname);
-		if (lfullname < lgroup ||
-			strncmp(fullname, group, lgroup) ||
-			(lgroup > 0 && fullname[lgroup] != NCZM_SEP[0]))
-		{
-			continue;
-		}
-
-		nclistclearall(segments);
-		NC_split_delim(fullname + lgroup + (lgroup > 0), NCZM_SEP[0] ,segments);
-		size_t slen = nclistlength(segments);
-		if (slen != 2) {
-			continue;
-		}
 
-		if (strncmp(Z2GROUP, nclistget(segments,1), sizeof(Z2GROUP)) == 0 && groups != NULL)
-		{
-			nclistpush(groups, strdup(nclistget(segments,0)));
-		}
-		else if (strncmp(Z2ARRAY, nclistget(segments,1), sizeof(Z2ARRAY)) == 0 && variables != NULL)
-		{
-			nclistpush(variables, strdup(nclistget(segments,0)));
+	if (zfile->metadata.csltree == NULL) {
+		if ((tree = (struct NCZ_CSLTree *)calloc(1, sizeof(struct NCZ_CSLTree))) == NULL)
+			{stat = NC_ENOMEM; goto done;}
+		tree->all = nclistnew();
+		if ((tree->nodes = NC_hashmapnew(0)) == NULL || csl_makenode(tree, "/") == NULL)
+			{stat = NC_ENOMEM; goto done;}
+		NCJdictget(zfile->metadata.jcsl, "metadata", &jmetadata);
+		if (jmetadata != NULL && NCJsort(jmetadata) == NCJ_DICT) {
+			for (i = 0; i < NCJdictlength(jmetadata); i++) {
+				const NCjson *jkey = NCJdictkey(jmetadata, i);
+				if (NCJsort(jkey) != NCJ_STRING || NCJstring(jkey) == NULL) continue;
+				if ((stat = csl_addkey(tree, NCJstring(jkey), NCJdictvalue(jmetadata, i))))
+					goto done;
+			}
 		}
+		zfile->metadata.csltree = tree;
+		tree = NULL;
 	}
-	nullfree(subkey);
-	nullfree(zgroup);
-	nclistfreeall(segments);
+	*treep = zfile->metadata.csltree;
+done:
+	NCZMD_v2_free_csltree(tree);
+	return stat;
+}
+
+int NCZMD_v2_csl_list_nodes(NCZ_FILE_INFO_T *zfile, const char * key, NClist *groups, NClist *variables)
+{
+	size_t i;
+	int stat = NC_NOERR;
+	char *path = NULL;
+	struct NCZ_CSLTree *tree = NULL;
+	const NCZ_CSLNode *node = NULL;
+
+	if ((stat = csl_tree(zfile, &tree)))
+		goto done;
+	if ((path = csl_path(key, strlen(key))) == NULL) {stat = NC_ENOMEM; goto done;}
+	if ((node = csl_getnode(tree, path)) == NULL)
+		goto done;
+	for (i = 0; groups != NULL && i < nclistlength(node->groups); i++)
+		nclistpush(groups, strdup((const char *)nclistget(node->groups, i)));
+	for (i = 0; variables != NULL && i < nclistlength(node->vars); i++)
+		nclistpush(variables, strdup((const char *)nclistget(node->vars, i)));
+done:
+	nullfree(path);
 	return stat;
 }
 
@@ -276,27 +416,27 @@ done:
 int fetch_csl_json_content_v2(NCZ_FILE_INFO_T *zfile, NCZMD_MetadataType zobj_t, const char *prefix, NCjson **jobj)
 {
 	int stat = NC_NOERR;
+	char *path = NULL;
+	struct NCZ_CSLTree *tree = NULL;
+	const NCZ_CSLNode *node = NULL;
 	const NCjson *jtmp = NULL;
-	const char *suffix;
-	char * key = NULL;
-	if ( (stat = zarr_obj_type2suffix(zobj_t, &suffix))
-	   ||(stat = nczm_concat(prefix, suffix, &key))){
-		return stat;
-	}
 
-	if (NCJdictget(zfile->metadata.jcsl, "metadata", &jtmp) == 0
-	&& jtmp && NCJsort(jtmp) == NCJ_DICT)
-	{
-		NCjson *tmp = NULL;
-		if ((stat = NCJdictget(jtmp, key + (key[0] == '/'), (const NCjson**)&tmp)))
-			goto done;
-		if (tmp)
-			NCJclone(tmp, jobj);
+	if ((stat = csl_tree(zfile, &tree)))
+		goto done;
+	if ((path = csl_path(prefix, strlen(prefix))) == NULL) {stat = NC_ENOMEM; goto done;}
+	if ((node = csl_getnode(tree, path)) == NULL)
+		goto done;
+	switch (zobj_t) {
+	case NCZMD_GROUP: jtmp = node->jgroup; break;
+	case NCZMD_ATTRS: jtmp = node->jattrs; break;
+	case NCZMD_ARRAY: jtmp = node->jarray; break;
+	default: stat = NC_EINVAL; goto done;
 	}
+	if (jtmp)
+		NCJclone(jtmp, jobj);
 done:
-	nullfree(key);
+	nullfree(path);
 	return stat;
-
 }
 
 int update_csl_json_content_v2(NCZ_FILE_INFO_T *zfile, NCZMD_MetadataType zobj_t, const char *prefix, const NCjson *jobj)
@@ -326,6 +466,10 @@ int update_csl_json_content_v2(NCZ_FILE_INFO_T *zfile, NCZMD_MetadataType zobj_t
 	NCjson * jval = NULL;
 	NCJclone(jobj,&jval);
 	NCJinsert(jrep, mdkey, jval);
+	zfile->metadata.flags |= ZARR_CSL_MODIFIED;
+	/* jval now belongs to jrep; keep the path index, if any, in step */
+	if (zfile->metadata.csltree != NULL)
+		stat = csl_addkey(zfile->metadata.csltree, mdkey, jval);
 done:
 	free(key);
 	return stat;
@@ -370,3 +514,19 @@ int validate_consolidated_json_v2(const NCjson *json)
 
     return NC_NOERR;
 }
+
+int consolidate_noop_v2(NCZ_FILE_INFO_T *zfile){
+    NC_UNUSED(zfile);
+    return NC_NOERR;
+}
+
+int consolidate_v2(NCZ_FILE_INFO_T *zfile)
+{
+	int stat = NC_NOERR;
+	/* Rewrite .zmetadata whenever it has changed, also in a dataset opened for writing */
+	if ((zfile->metadata.flags & ZARR_CSL_MODIFIED) && zfile->metadata.jcsl != NULL){
+		if ((stat = NCZ_uploadjson(zfile->map, Z2METADATA ,zfile->metadata.jcsl)) == NC_NOERR)
+			zfile->metadata.flags &= ~((size64_t)ZARR_CSL_MODIFIED);
+	}
+	return stat;
+}
@@ -0,0 +1,1060 @@
+/*********************************************************************
+ *   Copyright 2018, UCAR/Unidata
+ *   See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ *********************************************************************/
+
+#include "zincludes.h"
+
+/*
+Zarr V3 keeps everything about a node in a single zarr.json object:
+{"zarr_format": 3, "node_type": "group"|"array", "attributes": {...}, ...}.
+This handler presents the group, array and attribute parts of that
+object in the V2 form (.zgroup, .zarray, .zattrs) that the rest of
+libnczarr understands, and converts them back when writing.
+A node's zarr.json is read once no matter how many parts are asked for,
+and updates are held back until consolidate so that each node is
+written with a single request.
+
+The consolidated view, if any, is stored in the root zarr.json as
+"consolidated_metadata": {"kind": "inline", "must_understand": false,
+"metadata": {"<path>": <zarr.json of path>, ...}}.
+
+V2 form extensions produced and accepted for arrays:
+"chunk_key_encoding": "default"|"v2"
+"shards": [<no. of chunks per shard along each dimension>] (sharding_indexed codec)
+"shard_index": {"location": "start"|"end", "crc32c": 0|1}
+*/
+
+#define CSLKEY "consolidated_metadata"
+
+/// @brief Retrieve the group and variable names contained within a group specified by `key` on the storage. The order of the names may be arbitrary
+/// @param zfile - The zarr file info structure
+/// @param key - the key of the node - group
+/// @param groups - NClist where names will be added
+/// @param variables - NClist where names will be added
+/// @return `NC_NOERR` if succeeding
+int NCZMD_v3_list_nodes(NCZ_FILE_INFO_T *zfile, const char * key, NClist *groups, NClist *vars);
+
+/// @brief Retrieve the group and variable names contained within a group specified by `key` on the consolidated representation. The order of the names may be arbitrary
+/// @param zfile - The zarr file info structure
+/// @param key - the key of the node - group
+/// @param groups - NClist where names will be added
+/// @param variables - NClist where names will be added
+/// @return `NC_NOERR` if succeeding
+int NCZMD_v3_csl_list_nodes(NCZ_FILE_INFO_T *zfile, const char * key, NClist *groups, NClist *vars);
+
+int NCZMD_v3_list_groups(NCZ_FILE_INFO_T *zfile, const char * key, NClist *groups);
+int NCZMD_v3_csl_list_groups(NCZ_FILE_INFO_T *zfile, const char * key, NClist *groups);
+int NCZMD_v3_list_variables(NCZ_FILE_INFO_T *zfile, const char * key, NClist * variables);
+int NCZMD_v3_csl_list_variables(NCZ_FILE_INFO_T *zfile, const char * key, NClist *variables);
+
+/// @brief Retrieve, in V2 form, the JSON metadata of a given type for the specified `key`
+/// 	from the node's zarr.json, or from the consolidated representation if there is one
+/// @param zfile - The zarr file info structure
+///	@param zobj - The type of metadata to get
+/// @param key - the key of the node - group or array
+/// @param jobj - set to the V2 form or NULL if the node has no such metadata
+/// @return `NC_NOERR` if succeeding
+int fetch_json_content_v3(NCZ_FILE_INFO_T *zfile, NCZMD_MetadataType zarr_obj_type, const char *key, NCjson **jobj);
+
+/// @brief Hold V2 form JSON metadata of a given type for the specified `key` until consolidate
+/// @param zfile - The zarr file info structure
+///	@param zobj - The type of metadata to set
+/// @param key - the key of the node - group or array
+/// @param jobj - JSON to be written
+/// @return `NC_NOERR` if succeeding
+int update_json_content_v3(NCZ_FILE_INFO_T *zfile, NCZMD_MetadataType zobj, const char *key, const NCjson *jobj);
+
+/// @brief Place holder for non consolidated handler
+/// @param json - Not used!
+/// @return `NC_NOERR` always
+int validate_consolidated_json_noop_v3(const NCjson *json);
+
+///@brief Checks if `json`, the root zarr.json, holds a consolidated view:
+///		- `consolidated_metadata` is a dict whose `metadata` is a dict
+/// 	- its `kind`, if present, is `inline`
+/// @param json corresponding to the full root zarr.json content
+/// @return `NC_NOERR` if valid, `NC_EZARRMETA` otherwise
+int validate_consolidated_json_v3(const NCjson *json);
+
+/// @brief Write a zarr.json for every node updated since the last call
+/// @param zfile - The zarr file info structure
+/// @return `NC_NOERR` if succeeding
+int consolidate_v3(NCZ_FILE_INFO_T *zfile);
+
+/// @brief Write a zarr.json for every node updated since the last call
+/// 	and the consolidated view into the root zarr.json
+/// @param zfile - The zarr file info structure
+/// @return `NC_NOERR` if succeeding
+int consolidate_csl_v3(NCZ_FILE_INFO_T *zfile);
+
+static const NCZ_Metadata NCZ_md3_table = {
+	ZARRFORMAT3,
+	NCZ_METADATA_VERSION,
+	ZARR_NOT_CONSOLIDATED,
+	.jcsl = NULL,
+
+	.list_nodes = NCZMD_v3_list_nodes,
+	.list_groups = NCZMD_v3_list_groups,
+	.list_variables = NCZMD_v3_list_variables,
+
+	.fetch_json_content = fetch_json_content_v3,
+	.update_json_content = update_json_content_v3,
+    .validate_consolidated = validate_consolidated_json_noop_v3,
+	.consolidate = consolidate_v3,
+};
+
+const NCZ_Metadata *NCZ_metadata_handler3 = &NCZ_md3_table;
+
+static const NCZ_Metadata NCZ_csl_md3_table = {
+	ZARRFORMAT3,
+	NCZ_METADATA_VERSION,
+	ZARR_CONSOLIDATED,
+	.jcsl = NULL,
+
+	.list_nodes = NCZMD_v3_csl_list_nodes,
+	.list_groups = NCZMD_v3_csl_list_groups,
+	.list_variables = NCZMD_v3_csl_list_variables,
+
+	.fetch_json_content = fetch_json_content_v3,
+	.update_json_content = update_json_content_v3,
+    .validate_consolidated = validate_consolidated_json_v3,
+	.consolidate = consolidate_csl_v3,
+};
+
+const NCZ_Metadata *NCZ_csl_metadata_handler3 = &NCZ_csl_md3_table;
+
+/**************************************************/
+/* Utilities */
+
+/* Path of a node as used in the consolidated view; "" for the root */
+static const char *
+relpath(const char *prefix)
+{
+	while (*prefix == NCZM_SEP[0]) prefix++;
+	return prefix;
+}
+
+static const char *
+nodetype(const NCjson *jnode)
+{
+	const NCjson *jtype = NCJdictlookup(jnode, "node_type");
+	return (NCJsort(jtype) == NCJ_STRING ? NCJstring(jtype) : "");
+}
+
+/* The "name" of a codec or chunk grid; "" if it has none */
+static const char *
+objname(const NCjson *jobj)
+{
+	const NCjson *jname = NCJdictlookup(jobj, "name");
+	return (NCJsort(jname) == NCJ_STRING ? NCJstring(jname) : "");
+}
+
+static const NCjson *
+csl_metadata(const NCjson *jroot)
+{
+	return NCJdictlookup(NCJdictlookup(jroot, CSLKEY), "metadata");
+}
+
+static int
+getint(const NCjson *jvalue, long long *ip)
+{
+	struct NCJconst c = {0,0,0,NULL};
+	if (NCJsort(jvalue) != NCJ_INT || NCJcvt(jvalue, NCJ_INT, &c) < 0)
+		return NC_ENCZARR;
+	*ip = c.ival;
+	return NC_NOERR;
+}
+
+/* Get the zarr.json of the node named by prefix; NULL if there is none */
+static int
+get_node(NCZ_FILE_INFO_T *zfile, const char *prefix, const NCjson **jnodep)
+{
+	int stat = NC_NOERR;
+	char *key = NULL;
+	NCjson *jnode = NULL;
+	const NCjson *jtmp = NULL;
+
+	*jnodep = NULL;
+	if (zfile->metadata.jcsl != NULL) {
+		const char *path = relpath(prefix);
+		if (*path == '\0')
+			jtmp = zfile->metadata.jcsl;
+		else
+			jtmp = NCJdictlookup(csl_metadata(zfile->metadata.jcsl), path);
+	} else {
+		if ((stat = nczm_concat(prefix, Z3OBJECT, &key)))
+			goto done;
+		if (zfile->metadata.jnodes == NULL)
+			NCJnew(NCJ_DICT, &zfile->metadata.jnodes);
+		if ((jtmp = NCJdictlookup(zfile->metadata.jnodes, key)) == NULL) {
+			if ((stat = NCZ_downloadjson(zfile->map, key, &jnode)))
+				goto done;
+			if (jnode == NULL)
+				NCJnew(NCJ_NULL, &jnode); /* remember that it does not exist */
+			jtmp = jnode;
+			if (NCJinsert(zfile->metadata.jnodes, key, jnode) < 0) {stat = NC_ENOMEM; goto done;}
+			jnode = NULL;
+		}
+	}
+	if (NCJsort(jtmp) == NCJ_DICT) {
+		long long format = 0;
+		if (getint(NCJdictlookup(jtmp, "zarr_format"), &format) || format != ZARRFORMAT3)
+			{stat = NC_ENCZARR; goto done;}
+		*jnodep = jtmp;
+	}
+done:
+	NCJreclaim(jnode);
+	nullfree(key);
+	return stat;
+}
+
+/**************************************************/
+/* Conversion of data types and codecs */
+
+static const struct V3Type {
+	const char *name; /* V3 data_type */
+	char tchar; /* V2 dtype base type */
+	int size;
+} v3types[] = {
+	{"bool", 'u', 1},
+	{"int8", 'i', 1},
+	{"uint8", 'u', 1},
+	{"int16", 'i', 2},
+	{"uint16", 'u', 2},
+	{"int32", 'i', 4},
+	{"uint32", 'u', 4},
+	{"int64", 'i', 8},
+	{"uint64", 'u', 8},
+	{"float32", 'f', 4},
+	{"float64", 'f', 8},
+	{NULL, 0, 0},
+};
+
+/* Map a V3 data_type, the endianness from the bytes codec, and a
+   possible NCZarr type alias to a V2 dtype */
+static int
+v3_dtype2v2(const char *dtype, const char *endian, const char *alias, char *v2dtype, size_t len)
+{
+	const struct V3Type *t;
+	char e = (endian != NULL && strcmp(endian, "big") == 0 ? '>' : '<');
+	long bits;
+
+	if (dtype == NULL) return NC_ENCZARR;
+	if (dtype[0] == 'r' && (bits = strtol(dtype+1, NULL, 10)) > 0 && (bits % 8) == 0) {
+		/* raw bits hold fixed length strings */
+		snprintf(v2dtype, len, "|S%ld", bits / 8);
+		return NC_NOERR;
+	}
+	if (strcmp(dtype, "uint8") == 0 && alias != NULL && strcmp(alias, "char") == 0) {
+		snprintf(v2dtype, len, ">S1");
+		return NC_NOERR;
+	}
+	for (t = v3types; t->name != NULL; t++) {
+		if (strcmp(dtype, t->name) == 0) {
+			snprintf(v2dtype, len, "%c%c%d", (t->size == 1 ? '|' : e), t->tchar, t->size);
+			return NC_NOERR;
+		}
+	}
+	return NC_EBADTYPE;
+}
+
+/* Inverse of v3_dtype2v2; *sizep is the atomic size (0 for strings),
+   *aliasp is set to "char" if the type must be recorded as an alias */
+static int
+v2_dtype2v3(const char *v2dtype, char *dtype, size_t len, const char **endianp, const char **aliasp, int *sizep)
+{
+	const struct V3Type *t;
+	char e, tchar;
+	int size = 0;
+
+	*endianp = NULL;
+	*aliasp = NULL;
+	*sizep = 0;
+	if (v2dtype == NULL || strlen(v2dtype) < 3) return NC_EBADTYPE;
+	e = v2dtype[0];
+	tchar = v2dtype[1];
+	if (sscanf(v2dtype+2, "%d", &size) != 1 || size <= 0) return NC_EBADTYPE;
+	if (tchar == 'S') {
+		if (e == '>' && size == 1) { /* NC_CHAR */
+			snprintf(dtype, len, "uint8");
+			*aliasp = "char";
+		} else
+			snprintf(dtype, len, "r%d", 8*size);
+		return NC_NOERR;
+	}
+	for (t = v3types+1; t->name != NULL; t++) {
+		if (t->tchar == tchar && t->size == size) break;
+	}
+	if (t->name == NULL) return NC_EBADTYPE;
+	snprintf(dtype, len, "%s", t->name);
+	*sizep = size;
+	if (size > 1) {
+		if (e == '|') e = (NC_isLittleEndian() ? '<' : '>');
+		*endianp = (e == '>' ? "big" : "little");
+	}
+	return NC_NOERR;
+}
+
+static const char *blosc_shuffles[] = {"noshuffle", "shuffle", "bitshuffle", NULL};
+
+/* {"name": n, "configuration": {...}} => {"id": n, ...} */
+static int
+v3_codec2v2(const NCjson *jcodec, NCjson **jfilterp)
+{
+	int stat = NC_NOERR;
+	size_t i;
+	NCjson *jfilter = NULL;
+	const char *name = objname(jcodec);
+	const NCjson *jconfig = NCJdictlookup(jcodec, "configuration");
+
+	if (*name == '\0') {stat = NC_EFILTER; goto done;}
+	NCJnew(NCJ_DICT, &jfilter);
+	NCJcheck(NCJinsertstring(jfilter, "id", name));
+	for (i = 0; i < NCJdictlength(jconfig); i++) {
+		const char *pname = NCJstring(NCJdictkey(jconfig, i));
+		const NCjson *jparam = NCJdictvalue(jconfig, i);
+		NCjson *jvalue = NULL;
+		if (strcmp(name, "blosc") == 0 && strcmp(pname, "shuffle") == 0
+			&& NCJsort(jparam) == NCJ_STRING) {
+			int k;
+			for (k = 0; blosc_shuffles[k] != NULL; k++)
+				if (strcmp(blosc_shuffles[k], NCJstring(jparam)) == 0) break;
+			if (blosc_shuffles[k] == NULL) {stat = NC_EFILTER; goto done;}
+			NCJcheck(NCJinsertint(jfilter, pname, k));
+			continue;
+		}
+		NCJcheck(NCJclone(jparam, &jvalue));
+		NCJcheck(NCJinsert(jfilter, pname, jvalue));
+	}
+	*jfilterp = jfilter; jfilter = NULL;
+done:
+	NCJreclaim(jfilter);
+	return (stat < 0 ? NC_ENOMEM : stat);
+}
+
+/* {"id": n, ...} => {"name": n, "configuration": {...}} */
+static int
+v2_codec2v3(const NCjson *jfilter, NCjson **jcodecp)
+{
+	int stat = NC_NOERR;
+	size_t i;
+	NCjson *jcodec = NULL;
+	NCjson *jconfig = NULL;
+	const NCjson *jid = NCJdictlookup(jfilter, "id");
+
+	if (NCJsort(jid) != NCJ_STRING) {stat = NC_EFILTER; goto done;}
+	NCJnew(NCJ_DICT, &jcodec);
+	NCJnew(NCJ_DICT, &jconfig);
+	NCJcheck(NCJinsertstring(jcodec, "name", NCJstring(jid)));
+	for (i = 0; i < NCJdictlength(jfilter); i++) {
+		const char *pname = NCJstring(NCJdictkey(jfilter, i));
+		const NCjson *jparam = NCJdictvalue(jfilter, i);
+		NCjson *jvalue = NULL;
+		if (strcmp(pname, "id") == 0) continue;
+		if (strcmp(NCJstring(jid), "blosc") == 0 && strcmp(pname, "shuffle") == 0
+			&& NCJsort(jparam) == NCJ_INT) {
+			long long k = 0;
+			if (getint(jparam, &k) || k < 0 || k > 2) {stat = NC_EFILTER; goto done;}
+			NCJcheck(NCJinsertstring(jconfig, pname, blosc_shuffles[k]));
+			continue;
+		}
+		NCJcheck(NCJclone(jparam, &jvalue));
+		NCJcheck(NCJinsert(jconfig, pname, jvalue));
+	}
+	NCJcheck(NCJinsert(jcodec, "configuration", jconfig));
+	jconfig = NULL;
+	*jcodecp = jcodec; jcodec = NULL;
+done:
+	NCJreclaim(jcodec);
+	NCJreclaim(jconfig);
+	return (stat < 0 ? NC_ENOMEM : stat);
+}
+
+/**************************************************/
+/* Conversion of array metadata */
+
+static int
+array_rank(const NCjson *jshape, size_t rank)
+{
+	return (NCJsort(jshape) == NCJ_ARRAY && NCJarraylength(jshape) == rank);
+}
+
+/* Convert the V3 fill value of a string or char array to its V2 form */
+static int
+v3_fill2v2(const NCjson *jfill, const char *v2dtype, NCjson **jfillp)
+{
+	int stat = NC_NOERR;
+	size_t i;
+	char *s = NULL;
+
+	if (v2dtype[1] == 'S' && NCJsort(jfill) == NCJ_ARRAY) {
+		/* raw bits fill: list of bytes */
+		if ((s = calloc(NCJarraylength(jfill)+1, 1)) == NULL) {stat = NC_ENOMEM; goto done;}
+		for (i = 0; i < NCJarraylength(jfill); i++) {
+			long long b = 0;
+			if ((stat = getint(NCJith(jfill, i), &b))) goto done;
+			s[i] = (char)b;
+		}
+		NCJcheck(NCJnewstring(NCJ_STRING, s, jfillp));
+	} else if (v2dtype[1] == 'S' && NCJsort(jfill) == NCJ_INT) {
+		/* char stored as uint8 */
+		long long b = 0;
+		char c[2];
+		if ((stat = getint(jfill, &b))) goto done;
+		c[0] = (char)b; c[1] = '\0';
+		NCJcheck(NCJnewstring(NCJ_STRING, c, jfillp));
+	} else
+		NCJcheck(NCJclone(jfill, jfillp));
+done:
+	nullfree(s);
+	return (stat < 0 ? NC_ENOMEM : stat);
+}
+
+/* Convert a V2 fill value to V3; V3 has no null fill value */
+static int
+v2_fill2v3(const NCjson *jfill, const char *dtype, NCjson **jfillp)
+{
+	int stat = NC_NOERR;
+	const char *s = (NCJsort(jfill) == NCJ_STRING ? NCJstring(jfill) : "");
+
+	if (dtype[0] == 'r') {
+		size_t i, n = (size_t)(strtol(dtype+1, NULL, 10) / 8);
+		size_t slen = strlen(s);
+		NCJnew(NCJ_ARRAY, jfillp);
+		for (i = 0; i < n; i++)
+			NCJcheck(NCJappendint(*jfillp, (i < slen ? (unsigned char)s[i] : 0)));
+	} else if (NCJsort(jfill) == NCJ_NULL) {
+		NCJcheck(NCJnewstring((strcmp(dtype, "bool") == 0 ? NCJ_BOOLEAN : NCJ_INT),
+					(strcmp(dtype, "bool") == 0 ? "false" : "0"), jfillp));
+	} else if (NCJsort(jfill) == NCJ_STRING && strcmp(dtype, "uint8") == 0) {
+		/* a char fill value */
+		NCJcheck(NCJnewstring(NCJ_INT, "0", jfillp));
+		if (*s != '\0') {
+			char digits[16];
+			snprintf(digits, sizeof(digits), "%u", (unsigned)(unsigned char)*s);
+			NCJreclaim(*jfillp);
+			NCJcheck(NCJnewstring(NCJ_INT, digits, jfillp));
+		}
+	} else
+		NCJcheck(NCJclone(jfill, jfillp));
+done:
+	return (stat < 0 ? NC_ENOMEM : stat);
+}
+
+/* Convert an array's zarr.json to the V2 .zarray form */
+static int
+v3_array2v2(const NCjson *jnode, NCjson **jarrayp)
+{
+	int stat = NC_NOERR;
+	size_t i, rank;
+	NCjson *jarray = NULL;
+	NCjson *jtmp = NULL;
+	NCjson *jfilters = NULL;
+	const NCjson *jshape = NCJdictlookup(jnode, "shape");
+	const NCjson *jgrid = NCJdictlookup(jnode, "chunk_grid");
+	const NCjson *jchunks = NULL;
+	const NCjson *jcodecs = NCJdictlookup(jnode, "codecs");
+	const NCjson *jshard = NULL;
+	const NCjson *jkeys = NCJdictlookup(jnode, "chunk_key_encoding");
+	const NCjson *jalias = NULL;
+	const char *endian = NULL;
+	const char *encoding = "default";
+	const char *sep = NULL;
+	char v2dtype[64];
+	size_t ncodecs, first;
+
+	if (NCJsort(jshape) != NCJ_ARRAY) {stat = NC_ENCZARR; goto done;}
+	rank = NCJarraylength(jshape);
+	if (strcmp(objname(jgrid), "regular") != 0)
+		{stat = NC_ENCZARR; goto done;}
+	jchunks = NCJdictlookup(NCJdictlookup(jgrid, "configuration"), "chunk_shape");
+	if (!array_rank(jchunks, rank)) {stat = NC_ENCZARR; goto done;}
+	if (NCJsort(jcodecs) != NCJ_ARRAY || NCJarraylength(jcodecs) == 0) {stat = NC_ENCZARR; goto done;}
+
+	/* A sharded array has the sharding codec alone; its configuration holds the chunk codecs */
+	if (strcmp(objname(NCJith(jcodecs, 0)), "sharding_indexed") == 0) {
+		jshard = NCJdictlookup(NCJith(jcodecs, 0), "configuration");
+		if (NCJarraylength(jcodecs) != 1 || NCJsort(jshard) != NCJ_DICT) {stat = NC_ENCZARR; goto done;}
+		jcodecs = NCJdictlookup(jshard, "codecs");
+		if (NCJsort(jcodecs) != NCJ_ARRAY || NCJarraylength(jcodecs) == 0) {stat = NC_ENCZARR; goto done;}
+	}
+
+	/* The array -> bytes codec must come first; array -> array codecs (e.g. transpose) are not supported */
+	ncodecs = NCJarraylength(jcodecs);
+	if (strcmp(objname(NCJith(jcodecs, 0)), "bytes") != 0)
+		{stat = NC_EFILTER; goto done;}
+	endian = NCJstring(NCJdictlookup(NCJdictlookup(NCJith(jcodecs, 0), "configuration"), "endian"));
+	first = 1;
+
+	NCJnew(NCJ_DICT, &jarray);
+	NCJcheck(NCJinsertint(jarray, "zarr_format", ZARRFORMAT3));
+	NCJcheck(NCJclone(jshape, &jtmp));
+	NCJcheck(NCJinsert(jarray, "shape", jtmp)); jtmp = NULL;
+
+	/* dtype */
+	jalias = NCJdictlookup(NCJdictlookup(NCJdictlookup(jnode, "attributes"), NCZ_V2_ARRAY), "type_alias");
+	if ((stat = v3_dtype2v2(NCJstring(NCJdictlookup(jnode, "data_type")), endian, NCJstring(jalias), v2dtype, sizeof(v2dtype))))
+		goto done;
+	NCJcheck(NCJinsertstring(jarray, "dtype", v2dtype));
+
+	/* chunks, and the shard shape in chunks */
+	if (jshard != NULL) {
+		const NCjson *jinner = NCJdictlookup(jshard, "chunk_shape");
+		const NCjson *jindex = NCJdictlookup(jshard, "index_codecs");
+		const NCjson *jloc = NCJdictlookup(jshard, "index_location");
+		NCjson *jshards = NULL;
+		int crc = 0;
+		if (!array_rank(jinner, rank)) {stat = NC_ENCZARR; goto done;}
+		NCJnew(NCJ_ARRAY, &jshards);
+		NCJcheck(NCJinsert(jarray, "shards", jshards));
+		for (i = 0; i < rank; i++) {
+			long long outer = 0, inner = 0;
+			if ((stat = getint(NCJith(jchunks, i), &outer)) || (stat = getint(NCJith(jinner, i), &inner)))
+				goto done;
+			if (inner <= 0 || outer <= 0 || (outer % inner) != 0) {stat = NC_ENCZARR; goto done;}
+			NCJcheck(NCJappendint(jshards, outer / inner));
+		}
+		jchunks = jinner;
+		/* The index must be little endian bytes, optionally followed by a crc32c */
+		if (NCJsort(jindex) != NCJ_ARRAY || NCJarraylength(jindex) == 0 || NCJarraylength(jindex) > 2
+			|| strcmp(objname(NCJith(jindex, 0)), "bytes") != 0)
+			{stat = NC_ENCZARR; goto done;}
+		endian = NCJstring(NCJdictlookup(NCJdictlookup(NCJith(jindex, 0), "configuration"), "endian"));
+		if (endian != NULL && strcmp(endian, "little") != 0) {stat = NC_ENCZARR; goto done;}
+		if (NCJarraylength(jindex) == 2) {
+			if (strcmp(objname(NCJith(jindex, 1)), "crc32c") != 0) {stat = NC_ENCZARR; goto done;}
+			crc = 1;
+		}
+		if (jloc != NULL && (NCJsort(jloc) != NCJ_STRING
+			|| (strcmp(NCJstring(jloc), "start") != 0 && strcmp(NCJstring(jloc), "end") != 0)))
+			{stat = NC_ENCZARR; goto done;}
+		NCJnew(NCJ_DICT, &jtmp);
+		NCJcheck(NCJinsertstring(jtmp, "location", (jloc == NULL ? "end" : NCJstring(jloc))));
+		NCJcheck(NCJinsertint(jtmp, "crc32c", crc));
+		NCJcheck(NCJinsert(jarray, "shard_index", jtmp)); jtmp = NULL;
+	}
+	NCJcheck(NCJclone(jchunks, &jtmp));
+	NCJcheck(NCJinsert(jarray, "chunks", jtmp)); jtmp = NULL;
+
+	/* fill_value */
+	if ((stat = v3_fill2v2(NCJdictlookup(jnode, "fill_value"), v2dtype, &jtmp))) goto done;
+	NCJcheck(NCJinsert(jarray, "fill_value", jtmp)); jtmp = NULL;
+
+	NCJcheck(NCJinsertstring(jarray, "order", "C"));
+
+	/* bytes -> bytes codecs: the last is the compressor, the rest are filters */
+	if (ncodecs > first) {
+		if ((stat = v3_codec2v2(NCJith(jcodecs, ncodecs-1), &jtmp))) goto done;
+	} else
+		NCJnew(NCJ_NULL, &jtmp);
+	NCJcheck(NCJinsert(jarray, "compressor", jtmp)); jtmp = NULL;
+	if (ncodecs > first+1) {
+		NCJnew(NCJ_ARRAY, &jfilters);
+		for (i = first; i < ncodecs-1; i++) {
+			if ((stat = v3_codec2v2(NCJith(jcodecs, i), &jtmp))) goto done;
+			NCJcheck(NCJappend(jfilters, jtmp)); jtmp = NULL;
+		}
+	} else
+		NCJnew(NCJ_NULL, &jfilters);
+	NCJcheck(NCJinsert(jarray, "filters", jfilters)); jfilters = NULL;
+
+	/* chunk key encoding */
+	if (jkeys != NULL) {
+		const char *name = NCJstring(NCJdictlookup(jkeys, "name"));
+		if (name == NULL || (strcmp(name, "default") != 0 && strcmp(name, "v2") != 0))
+			{stat = NC_ENCZARR; goto done;}
+		encoding = name;
+		sep = NCJstring(NCJdictlookup(NCJdictlookup(jkeys, "configuration"), "separator"));
+	}
+	if (sep == NULL)
+		sep = (strcmp(encoding, "default") == 0 ? "/" : ".");
+	NCJcheck(NCJinsertstring(jarray, "dimension_separator", sep));
+	NCJcheck(NCJinsertstring(jarray, "chunk_key_encoding", encoding));
+
+	*jarrayp = jarray; jarray = NULL;
+done:
+	NCJreclaim(jarray);
+	NCJreclaim(jtmp);
+	NCJreclaim(jfilters);
+	return (stat < 0 ? NC_ENCZARR : stat);
+}
+
+/* Convert the attributes of a zarr.json to the V2 .zattrs form;
+   dimension_names reappear as the xarray attribute */
+static int
+v3_attrs2v2(const NCjson *jnode, NCjson **jattrsp)
+{
+	int stat = NC_NOERR;
+	size_t i;
+	NCjson *jattrs = NULL;
+	NCjson *jtmp = NULL;
+	const NCjson *jsrc = NCJdictlookup(jnode, "attributes");
+	const NCjson *jdimnames = NCJdictlookup(jnode, "dimension_names");
+	int usenames = (NCJsort(jdimnames) == NCJ_ARRAY && NCJarraylength(jdimnames) > 0);
+
+	for (i = 0; usenames && i < NCJarraylength(jdimnames); i++)
+		if (NCJsort(NCJith(jdimnames, i)) != NCJ_STRING) usenames = 0;
+	if (NCJsort(jsrc) == NCJ_DICT)
+		NCJcheck(NCJclone(jsrc, &jattrs));
+	else if (usenames)
+		NCJnew(NCJ_DICT, &jattrs);
+	if (usenames && NCJdictlookup(jattrs, NC_XARRAY_DIMS) == NULL) {
+		NCJcheck(NCJclone(jdimnames, &jtmp));
+		NCJcheck(NCJinsert(jattrs, NC_XARRAY_DIMS, jtmp)); jtmp = NULL;
+	}
+	*jattrsp = jattrs; jattrs = NULL;
+done:
+	NCJreclaim(jattrs);
+	NCJreclaim(jtmp);
+	return (stat < 0 ? NC_ENOMEM : stat);
+}
+
+/* Build a group's zarr.json from its held back V2 parts */
+static int
+v2_group2v3(const NCjson *jpending, NCjson **jnodep)
+{
+	int stat = NC_NOERR;
+	NCjson *jnode = NULL;
+	NCjson *jtmp = NULL;
+	const NCjson *jattrs = NCJdictlookup(jpending, "attributes");
+
+	NCJnew(NCJ_DICT, &jnode);
+	NCJcheck(NCJinsertint(jnode, "zarr_format", ZARRFORMAT3));
+	NCJcheck(NCJinsertstring(jnode, "node_type", "group"));
+	if (NCJsort(jattrs) == NCJ_DICT) {
+		NCJcheck(NCJclone(jattrs, &jtmp));
+		NCJcheck(NCJinsert(jnode, "attributes", jtmp)); jtmp = NULL;
+	}
+	*jnodep = jnode; jnode = NULL;
+done:
+	NCJreclaim(jnode);
+	NCJreclaim(jtmp);
+	return (stat < 0 ? NC_ENOMEM : stat);
+}
+
+/* Build an array's zarr.json from its held back V2 parts */
+static int
+v2_array2v3(const NCjson *jpending, NCjson **jnodep)
+{
+	int stat = NC_NOERR;
+	size_t i, rank;
+	NCjson *jnode = NULL;
+	NCjson *jtmp = NULL;
+	NCjson *jcodecs = NULL;
+	NCjson *jattrs = NULL;
+	NCjson *jgrid = NULL;
+	NCjson *jshape = NULL;
+	const NCjson *jarray = NCJdictlookup(jpending, "array");
+	const NCjson *jsrcattrs = NCJdictlookup(jpending, "attributes");
+	const NCjson *jchunks = NCJdictlookup(jarray, "chunks");
+	const NCjson *jshards = NCJdictlookup(jarray, "shards");
+	const NCjson *jfilters = NCJdictlookup(jarray, "filters");
+	const NCjson *jcompressor = NCJdictlookup(jarray, "compressor");
+	const NCjson *jdimnames = NULL;
+	const char *sep = NCJstring(NCJdictlookup(jarray, "dimension_separator"));
+	const char *encoding = NCJstring(NCJdictlookup(jarray, "chunk_key_encoding"));
+	const char *endian = NULL;
+	const char *alias = NULL;
+	char dtype[64];
+	int size = 0;
+
+	if (NCJsort(jarray) != NCJ_DICT) {stat = NC_ENCZARR; goto done;}
+	if (NCJsort(NCJdictlookup(jarray, "shape")) != NCJ_ARRAY) {stat = NC_ENCZARR; goto done;}
+	rank = NCJarraylength(NCJdictlookup(jarray, "shape"));
+	if (!array_rank(jchunks, rank)) {stat = NC_ENCZARR; goto done;}
+	if ((stat = v2_dtype2v3(NCJstring(NCJdictlookup(jarray, "dtype")), dtype, sizeof(dtype), &endian, &alias, &size)))
+		goto done;
+
+	/* Attributes; the xarray attribute becomes dimension_names */
+	if (NCJsort(jsrcattrs) == NCJ_DICT) {
+		NCJnew(NCJ_DICT, &jattrs);
+		for (i = 0; i < NCJdictlength(jsrcattrs); i++) {
+			const char *aname = NCJstring(NCJdictkey(jsrcattrs, i));
+			const NCjson *jvalue = NCJdictvalue(jsrcattrs, i);
+			if (strcmp(aname, NC_XARRAY_DIMS) == 0 && array_rank(jvalue, rank)) {
+				jdimnames = jvalue;
+				continue;
+			}
+			NCJcheck(NCJclone(jvalue, &jtmp));
+			/* Record the types that V3 lacks */
+			if (strcmp(aname, NCZ_V2_ARRAY) == 0 && alias != NULL && NCJsort(jtmp) == NCJ_DICT)
+				NCJcheck(NCJinsertstring(jtmp, "type_alias", alias));
+			NCJcheck(NCJinsert(jattrs, aname, jtmp)); jtmp = NULL;
+		}
+	}
+
+	NCJnew(NCJ_DICT, &jnode);
+	NCJcheck(NCJinsertint(jnode, "zarr_format", ZARRFORMAT3));
+	NCJcheck(NCJinsertstring(jnode, "node_type", "array"));
+	NCJcheck(NCJclone(NCJdictlookup(jarray, "shape"), &jtmp));
+	NCJcheck(NCJinsert(jnode, "shape", jtmp)); jtmp = NULL;
+	NCJcheck(NCJinsertstring(jnode, "data_type", dtype));
+
+	/* chunk_grid: with sharding, the grid is of shards */
+	NCJnew(NCJ_DICT, &jgrid);
+	NCJcheck(NCJinsertstring(jgrid, "name", "regular"));
+	NCJnew(NCJ_DICT, &jtmp);
+	NCJnew(NCJ_ARRAY, &jshape);
+	for (i = 0; i < rank; i++) {
+		long long chunk = 0, shard = 1;
+		if ((stat = getint(NCJith(jchunks, i), &chunk))) goto done;
+		if (jshards != NULL && (!array_rank(jshards, rank) || (stat = getint(NCJith(jshards, i), &shard))))
+			{stat = NC_ENCZARR; goto done;}
+		NCJcheck(NCJappendint(jshape, chunk * shard));
+	}
+	NCJcheck(NCJinsert(jtmp, "chunk_shape", jshape)); jshape = NULL;
+	NCJcheck(NCJinsert(jgrid, "configuration", jtmp)); jtmp = NULL;
+	NCJcheck(NCJinsert(jnode, "chunk_grid", jgrid)); jgrid = NULL;
+
+	/* chunk_key_encoding */
+	NCJnew(NCJ_DICT, &jtmp);
+	if (encoding == NULL) encoding = "default";
+	if (sep == NULL) sep = (strcmp(encoding, "v2") == 0 ? "." : "/");
+	NCJcheck(NCJinsertstring(jtmp, "name", encoding));
+	NCJnew(NCJ_DICT, &jshape);
+	NCJcheck(NCJinsertstring(jshape, "separator", sep));
+	NCJcheck(NCJinsert(jtmp, "configuration", jshape)); jshape = NULL;
+	NCJcheck(NCJinsert(jnode, "chunk_key_encoding", jtmp)); jtmp = NULL;
+
+	if ((stat = v2_fill2v3(NCJdictlookup(jarray, "fill_value"), dtype, &jtmp))) goto done;
+	NCJcheck(NCJinsert(jnode, "fill_value", jtmp)); jtmp = NULL;
+
+	/* codecs: bytes, then the filters, then the compressor */
+	NCJnew(NCJ_ARRAY, &jcodecs);
+	NCJnew(NCJ_DICT, &jtmp);
+	NCJcheck(NCJinsertstring(jtmp, "name", "bytes"));
+	if (endian != NULL) {
+		NCJnew(NCJ_DICT, &jshape);
+		NCJcheck(NCJinsertstring(jshape, "endian", endian));
+		NCJcheck(NCJinsert(jtmp, "configuration", jshape)); jshape = NULL;
+	}
+	NCJcheck(NCJappend(jcodecs, jtmp)); jtmp = NULL;
+	for (i = 0; i < NCJarraylength(jfilters); i++) {
+		if ((stat = v2_codec2v3(NCJith(jfilters, i), &jtmp))) goto done;
+		NCJcheck(NCJappend(jcodecs, jtmp)); jtmp = NULL;
+	}
+	if (NCJsort(jcompressor) == NCJ_DICT) {
+		if ((stat = v2_codec2v3(jcompressor, &jtmp))) goto done;
+		NCJcheck(NCJappend(jcodecs, jtmp)); jtmp = NULL;
+	}
+	if (jshards != NULL) {
+		/* Wrap the chunk codecs in the sharding codec */
+		const NCjson *jindex = NCJdictlookup(jarray, "shard_index");
+		const char *loc = NCJstring(NCJdictlookup(jindex, "location"));
+		long long crc = 0;
+		NCjson *jconfig = NULL;
+		NCjson *jsharding = NULL;
+		(void)getint(NCJdictlookup(jindex, "crc32c"), &crc);
+		NCJnew(NCJ_DICT, &jconfig);
+		NCJcheck(NCJclone(jchunks, &jtmp));
+		NCJcheck(NCJinsert(jconfig, "chunk_shape", jtmp)); jtmp = NULL;
+		NCJcheck(NCJinsert(jconfig, "codecs", jcodecs)); jcodecs = NULL;
+		NCJcheck(NCJparse((crc ? "[{\"name\":\"bytes\",\"configuration\":{\"endian\":\"little\"}},{\"name\":\"crc32c\"}]"
+				       : "[{\"name\":\"bytes\",\"configuration\":{\"endian\":\"little\"}}]"), 0, &jtmp));
+		NCJcheck(NCJinsert(jconfig, "index_codecs", jtmp)); jtmp = NULL;
+		NCJcheck(NCJinsertstring(jconfig, "index_location", (loc == NULL ? "end" : loc)));
+		NCJnew(NCJ_DICT, &jsharding);
+		NCJcheck(NCJinsertstring(jsharding, "name", "sharding_indexed"));
+		NCJcheck(NCJinsert(jsharding, "configuration", jconfig));
+		NCJnew(NCJ_ARRAY, &jcodecs);
+		NCJcheck(NCJappend(jcodecs, jsharding));
+	}
+	NCJcheck(NCJinsert(jnode, "codecs", jcodecs)); jcodecs = NULL;
+
+	if (jattrs != NULL) {
+		NCJcheck(NCJinsert(jnode, "attributes", jattrs)); jattrs = NULL;
+	}
+	if (jdimnames != NULL) {
+		NCJcheck(NCJclone(jdimnames, &jtmp));
+		NCJcheck(NCJinsert(jnode, "dimension_names", jtmp)); jtmp = NULL;
+	}
+	*jnodep = jnode; jnode = NULL;
+done:
+	NCJreclaim(jnode);
+	NCJreclaim(jtmp);
+	NCJreclaim(jcodecs);
+	NCJreclaim(jattrs);
+	NCJreclaim(jgrid);
+	NCJreclaim(jshape);
+	return (stat < 0 ? NC_ENOMEM : stat);
+}
+
+/**************************************************/
+/* Handler API */
+
+int NCZMD_v3_list_nodes(NCZ_FILE_INFO_T *zfile, const char * key, NClist *groups, NClist *variables)
+{
+	size_t i;
+	int stat = NC_NOERR;
+	char *subkey = NULL;
+	NClist *matches = nclistnew();
+
+	if ((stat = nczmap_search(zfile->map, key, matches)))
+		goto done;
+	for (i = 0; i < nclistlength(matches); i++)
+	{
+		const char *name = nclistget(matches, i);
+		const NCjson *jnode = NULL;
+		if (name[0] == NCZM_DOT || strcmp(name, Z3OBJECT) == 0)
+			continue;
+		if ((stat = nczm_concat(key, name, &subkey)))
+			goto done;
+		if ((stat = get_node(zfile, subkey, &jnode)))
+			goto done;
+		if (jnode != NULL && strcmp(nodetype(jnode), "group") == 0 && groups != NULL)
+			nclistpush(groups, strdup(name));
+		else if (jnode != NULL && strcmp(nodetype(jnode), "array") == 0 && variables != NULL)
+			nclistpush(variables, strdup(name));
+		nullfree(subkey);
+		subkey = NULL;
+	}
+
+done:
+	nullfree(subkey);
+	nclistfreeall(matches);
+	return stat;
+}
+
+int NCZMD_v3_csl_list_nodes(NCZ_FILE_INFO_T *zfile, const char * key, NClist *groups, NClist *variables)
+{
+	size_t i;
+	const char *group = relpath(key);
+	size_t lgroup = strlen(group);
+	const NCjson *jmetadata = csl_metadata(zfile->metadata.jcsl);
+
+	for (i = 0; i < NCJdictlength(jmetadata); i++)
+	{
+		const char *fullname = NCJstring(NCJdictkey(jmetadata, i));
+		const NCjson *jnode = NCJdictvalue(jmetadata, i);
+		const char *name;
+		if (strlen(fullname) <= lgroup ||
+			strncmp(fullname, group, lgroup) ||
+			(lgroup > 0 && fullname[lgroup] != NCZM_SEP[0]))
+		{
+			continue;
+		}
+		name = fullname + lgroup + (lgroup > 0);
+		if (*name == '\0' || strchr(name, NCZM_SEP[0]) != NULL)
+			continue; /* not an immediate child */
+		if (strcmp(nodetype(jnode), "group") == 0 && groups != NULL)
+			nclistpush(groups, strdup(name));
+		else if (strcmp(nodetype(jnode), "array") == 0 && variables != NULL)
+			nclistpush(variables, strdup(name));
+	}
+	return NC_NOERR;
+}
+
+int NCZMD_v3_list_groups(NCZ_FILE_INFO_T *zfile, const char * key, NClist *groups)
+{
+	return NCZMD_v3_list_nodes(zfile, key, groups, NULL);
+}
+
+int NCZMD_v3_csl_list_groups(NCZ_FILE_INFO_T *zfile, const char * key, NClist *groups)
+{
+	return NCZMD_v3_csl_list_nodes(zfile, key, groups, NULL);
+}
+
+int NCZMD_v3_list_variables(NCZ_FILE_INFO_T *zfile, const char * key, NClist *variables)
+{
+	return NCZMD_v3_list_nodes(zfile, key, NULL, variables);
+}
+
+int NCZMD_v3_csl_list_variables(NCZ_FILE_INFO_T *zfile, const char* key, NClist *variables)
+{
+	return NCZMD_v3_csl_list_nodes(zfile, key, NULL, variables);
+}
+
+int fetch_json_content_v3(NCZ_FILE_INFO_T *zfile, NCZMD_MetadataType zobj, const char *prefix, NCjson **jobj)
+{
+	int stat = NC_NOERR;
+	const NCjson *jnode = NULL;
+
+	*jobj = NULL;
+	if ((stat = get_node(zfile, prefix, &jnode)) || jnode == NULL)
+		goto done;
+	switch (zobj)
+	{
+		case NCZMD_GROUP:
+			if (strcmp(nodetype(jnode), "group") != 0)
+				break;
+			NCJnew(NCJ_DICT, jobj);
+			if (NCJinsertint(*jobj, "zarr_format", ZARRFORMAT3) < 0)
+				stat = NC_ENOMEM;
+			break;
+		case NCZMD_ARRAY:
+			if (strcmp(nodetype(jnode), "array") != 0)
+				break;
+			stat = v3_array2v2(jnode, jobj);
+			break;
+		case NCZMD_ATTRS:
+			stat = v3_attrs2v2(jnode, jobj);
+			break;
+		default:
+			stat = NC_EINVAL;
+			break;
+	}
+done:
+	return stat;
+}
+
+int update_json_content_v3(NCZ_FILE_INFO_T *zfile, NCZMD_MetadataType zobj, const char *prefix, const NCjson *jobj)
+{
+	int stat = NC_NOERR;
+	char *key = NULL;
+	NCjson *jpending = NULL;
+	NCjson *jvalue = NULL;
+	const char *part = NULL;
+
+	switch (zobj)
+	{
+		case NCZMD_GROUP: part = "group"; break;
+		case NCZMD_ARRAY: part = "array"; break;
+		case NCZMD_ATTRS: part = "attributes"; break;
+		default: stat = NC_EINVAL; goto done;
+	}
+	if ((stat = nczm_concat(prefix, Z3OBJECT, &key)))
+		goto done;
+	if (zfile->metadata.jpending == NULL)
+		NCJnew(NCJ_DICT, &zfile->metadata.jpending);
+	if ((jpending = NCJdictlookup(zfile->metadata.jpending, key)) == NULL) {
+		NCJnew(NCJ_DICT, &jpending);
+		if (NCJinsert(zfile->metadata.jpending, key, jpending) < 0)
+			{NCJreclaim(jpending); stat = NC_ENOMEM; goto done;}
+	}
+	if (NCJclone(jobj, &jvalue) < 0 || NCJinsert(jpending, part, jvalue) < 0)
+		{NCJreclaim(jvalue); stat = NC_ENOMEM; goto done;}
+done:
+	nullfree(key);
+	return stat;
+}
+
+int validate_consolidated_json_noop_v3(const NCjson *json){
+    NC_UNUSED(json);
+    return NC_NOERR;
+}
+
+int validate_consolidated_json_v3(const NCjson *json)
+{
+    const NCjson *jcsl = NULL;
+    const NCjson *jkind = NULL;
+
+    if (json == NULL || NCJsort(json) != NCJ_DICT)
+        return NC_EZARRMETA;
+    jcsl = NCJdictlookup(json, CSLKEY);
+    if (NCJsort(jcsl) != NCJ_DICT || NCJsort(NCJdictlookup(jcsl, "metadata")) != NCJ_DICT)
+        return NC_EZARRMETA;
+    jkind = NCJdictlookup(jcsl, "kind");
+    if (jkind != NULL && (NCJsort(jkind) != NCJ_STRING || strcmp(NCJstring(jkind), "inline") != 0))
+        return NC_EZARRMETA;
+    return NC_NOERR;
+}
+
+/* Write each held back node; if jmetadata is not NULL, also
+   collect the non-root nodes into it and return the root node */
+static int
+flush_pending(NCZ_FILE_INFO_T *zfile, NCjson *jmetadata, NCjson **jrootp)
+{
+	int stat = NC_NOERR;
+	size_t i;
+	NCjson *jnode = NULL;
+	NCjson *jpending = zfile->metadata.jpending;
+
+	zfile->metadata.jpending = NULL;
+	for (i = 0; i < NCJdictlength(jpending); i++)
+	{
+		const char *key = NCJstring(NCJdictkey(jpending, i));
+		const NCjson *jparts = NCJdictvalue(jpending, i);
+		const char *path = relpath(key);
+		size_t lpath = strlen(path) - strlen(Z3OBJECT);
+
+		if (NCJdictlookup(jparts, "array") != NULL)
+			stat = v2_array2v3(jparts, &jnode);
+		else
+			stat = v2_group2v3(jparts, &jnode);
+		if (stat) goto done;
+		if (jmetadata != NULL && lpath == 0) { /* the root; written by the caller */
+			NCJreclaim(*jrootp);
+			*jrootp = jnode; jnode = NULL;
+			continue;
+		}
+		if ((stat = NCZ_uploadjson(zfile->map, key, jnode)))
+			goto done;
+		if (jmetadata != NULL) {
+			char *name = strdup(path);
+			if (name == NULL) {stat = NC_ENOMEM; goto done;}
+			name[lpath > 0 ? lpath-1 : 0] = '\0'; /* strip "/zarr.json" */
+			stat = (NCJinsert(jmetadata, name, jnode) < 0 ? NC_ENOMEM : NC_NOERR);
+			free(name);
+			if (stat) goto done;
+			jnode = NULL;
+		}
+		NCJreclaim(jnode); jnode = NULL;
+	}
+	/* Anything read before is now stale */
+	NCJreclaim(zfile->metadata.jnodes);
+	zfile->metadata.jnodes = NULL;
+done:
+	NCJreclaim(jnode);
+	NCJreclaim(jpending);
+	return stat;
+}
+
+int consolidate_v3(NCZ_FILE_INFO_T *zfile)
+{
+	return flush_pending(zfile, NULL, NULL);
+}
+
+int consolidate_csl_v3(NCZ_FILE_INFO_T *zfile)
+{
+	int stat = NC_NOERR;
+	size_t i;
+	NCjson *jroot = NULL;
+	NCjson *jcsl = NULL;
+	NCjson *jmetadata = NULL;
+	NCjson *jtmp = NULL;
+	const NCjson *jold = NULL;
+
+	if (zfile->metadata.jpending == NULL)
+		goto done;
+	/* Start from the current view so that unchanged nodes are kept */
+	if ((jold = csl_metadata(zfile->metadata.jcsl)) != NULL) {
+		if (NCJclone(jold, &jmetadata) < 0) {stat = NC_ENOMEM; goto done;}
+	} else
+		NCJnew(NCJ_DICT, &jmetadata);
+	if ((stat = flush_pending(zfile, jmetadata, &jroot)))
+		goto done;
+	if (jroot == NULL) {
+		/* Root unchanged: reuse it without its old view */
+		const NCjson *jprev = zfile->metadata.jcsl;
+		NCJnew(NCJ_DICT, &jroot);
+		for (i = 0; i < NCJdictlength(jprev); i++) {
+			const char *name = NCJstring(NCJdictkey(jprev, i));
+			if (strcmp(name, CSLKEY) == 0) continue;
+			if (NCJclone(NCJdictvalue(jprev, i), &jtmp) < 0 || NCJinsert(jroot, name, jtmp) < 0)
+				{stat = NC_ENOMEM; goto done;}
+			jtmp = NULL;
+		}
+	}
+	NCJnew(NCJ_DICT, &jcsl);
+	if (NCJinsertstring(jcsl, "kind", "inline") < 0
+		|| NCJnewstring(NCJ_BOOLEAN, "false", &jtmp) < 0
+		|| NCJinsert(jcsl, "must_understand", jtmp) < 0)
+		{stat = NC_ENOMEM; goto done;}
+	jtmp = NULL;
+	if (NCJinsert(jcsl, "metadata", jmetadata) < 0) {stat = NC_ENOMEM; goto done;}
+	jmetadata = NULL;
+	if (NCJinsert(jroot, CSLKEY, jcsl) < 0) {stat = NC_ENOMEM; goto done;}
+	jcsl = NULL;
+	if ((stat = NCZ_uploadjson(zfile->map, Z3METADATA, jroot)))
+		goto done;
+	/* The new root is the consolidated view */
+	NCJreclaim(zfile->metadata.jcsl);
+	zfile->metadata.jcsl = jroot; jroot = NULL;
+done:
+	NCJreclaim(jroot);
+	NCJreclaim(jcsl);
+	NCJreclaim(jmetadata);
+	NCJreclaim(jtmp);
+	return stat;
+}
@@ -52,6 +52,7 @@ check_for_classic_model(NC_GRP_INFO_T *root_grp, int *is_classic)
  * @param path The file name of the new file.
  * @param mode The open mode flag.
  * @param fraglist uri fragment list in envv form
+ * @param memio store image if NC_INMEMORY is set; NULL otherwise
  * @param nc Pointer to NC file info.
  *
  * @return ::NC_NOERR No error.
@@ -64,7 +65,7 @@ check_for_classic_model(NC_GRP_INFO_T *root_grp, int *is_classic)
  * @author Dennis Heimbigner, Ed Hartnett
  */
 static int
-ncz_open_file(const char *path, int mode, NClist* controls, int ncid)
+ncz_open_file(const char *path, int mode, NClist* controls, NC_memio* memio, int ncid)
 {
     int stat = NC_NOERR;
     NC_FILE_INFO_T *h5 = NULL;
@@ -90,6 +91,10 @@ ncz_open_file(const char *path, int mode, NClist* controls, int ncid)
     h5->mem.inmemory = ((mode & NC_INMEMORY) == NC_INMEMORY);
     h5->mem.diskless = ((mode & NC_DISKLESS) == NC_DISKLESS);
     h5->mem.persist = ((mode & NC_PERSIST) == NC_PERSIST);
+    if(h5->mem.inmemory) {
+	if(memio == NULL) {stat = NC_EINMEMORY; goto exit;}
+	h5->mem.memio = *memio; /* image for an in-memory store */
+    }
 
     /* Does the mode specify that this file is read-only? */
     if ((mode & NC_WRITE) == 0)
@@ -153,8 +158,6 @@ NCZ_open(const char *path, int mode, int basepe, size_t *chunksizehintp,
 
     ZTRACE(0,"path=%s,mode=%d,ncid=%d)",path,mode,ncid);
 
-    NC_UNUSED(parameters);
-
     assert(path && dispatch);
 
     LOG((1, "%s: path %s mode %d ",
@@ -181,7 +184,7 @@ NCZ_open(const char *path, int mode, int basepe, size_t *chunksizehintp,
     if(uri == NULL) goto done;
 
     /* Open the file. */
-    if((stat = ncz_open_file(path, mode, ncurifragmentparams(uri), ncid)))
+    if((stat = ncz_open_file(path, mode, ncurifragmentparams(uri), (NC_memio*)parameters, ncid)))
 	goto done;
 
 done:
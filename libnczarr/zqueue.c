@@ -0,0 +1,240 @@
+/*
+ *	Copyright 2018, University Corporation for Atmospheric Research
+ *      See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ */
+
+#include "zincludes.h"
+#include "nchashmap.h"
+#include "zqueue.h"
+
+#if defined(HAVE_PTHREAD_H) && !defined(_WIN32)
+#define USEPTHREADS
+#include <pthread.h>
+#endif
+
+/* A deferred write */
+typedef struct NCZput {
+    struct NCZqueue* q;
+    char* key;
+    size64_t count;
+    void* content;
+    size_t seq; /* order of submission */
+    int started; /* a worker has taken the content */
+} NCZput;
+
+struct NCZqueue {
+    const NCZqueueops* ops;
+    void* state;
+    size_t maxputs; /* max writes in flight */
+    size64_t maxbytes; /* max bytes held by deferred writes */
+    size64_t bytes; /* bytes currently held */
+    size_t seq; /* number of the next write */
+    NCthreadpool* pool; /* created by the first write */
+    NC_hashmap* pending; /* key -> NCZput*, queued or in flight */
+    NClist* ctxs; /* idle worker contexts */
+    int stat; /* error of the earliest failed write */
+    size_t errseq; /* its seq */
+#ifdef USEPTHREADS
+    pthread_mutex_t lock;
+    pthread_cond_t cond; /* broadcast whenever a write leaves the queue */
+#endif
+};
+
+#ifdef USEPTHREADS
+#define LOCK(q) pthread_mutex_lock(&(q)->lock)
+#define UNLOCK(q) pthread_mutex_unlock(&(q)->lock)
+#define WAIT(q) pthread_cond_wait(&(q)->cond,&(q)->lock)
+#define BROADCAST(q) pthread_cond_broadcast(&(q)->cond)
+#else
+#define LOCK(q)
+#define UNLOCK(q)
+#define WAIT(q) ((void)0)
+#define BROADCAST(q)
+#endif
+
+static void
+putfree(NCZput* put)
+{
+    if(put == NULL) return;
+    nullfree(put->key);
+    nullfree(put->content);
+    free(put);
+}
+
+int
+NCZ_queuenew(size_t maxputs, size64_t maxbytes, const NCZqueueops* ops, void* state, NCZqueue** qp)
+{
+    NCZqueue* q = NULL;
+
+    *qp = NULL;
+#ifndef USEPTHREADS
+    maxputs = 0;
+#endif
+    if(maxputs < 2) /* a pool of one thread would be synchronous anyway */
+	return NC_NOERR;
+    if((q = (NCZqueue*)calloc(1,sizeof(NCZqueue))) == NULL)
+	return NC_ENOMEM;
+    q->ops = ops;
+    q->state = state;
+    q->maxputs = maxputs;
+    q->maxbytes = maxbytes;
+    if((q->pending = NC_hashmapnew(0)) == NULL)
+	{free(q); return NC_ENOMEM;}
+    q->ctxs = nclistnew();
+#ifdef USEPTHREADS
+    pthread_mutex_init(&q->lock,NULL);
+    pthread_cond_init(&q->cond,NULL);
+#endif
+    *qp = q;
+    return NC_NOERR;
+}
+
+void
+NCZ_queuefree(NCZqueue* q)
+{
+    size_t i;
+
+    if(q == NULL) return;
+    ncthreadpoolfree(q->pool); /* waits for the writes in flight */
+    for(i=0;i<nclistlength(q->ctxs);i++)
+	q->ops->freectx(q->state,nclistget(q->ctxs,i));
+    nclistfree(q->ctxs);
+    NC_hashmapfree(q->pending);
+#ifdef USEPTHREADS
+    pthread_cond_destroy(&q->cond);
+    pthread_mutex_destroy(&q->lock);
+#endif
+    free(q);
+}
+
+/* Remove a write from the queue and wake up everyone waiting on it; lock held */
+static void
+dequeue(NCZqueue* q, NCZput* put)
+{
+    (void)NC_hashmapremove(q->pending,put->key,strlen(put->key),NULL);
+    q->bytes -= put->count;
+    BROADCAST(q);
+}
+
+/* Executed by a worker: do one deferred write */
+static int
+queueput(void* arg)
+{
+    int stat = NC_NOERR;
+    NCZput* put = (NCZput*)arg;
+    NCZqueue* q = put->q;
+    void* ctx = NULL;
+
+    LOCK(q);
+    put->started = 1; /* the content can no longer be replaced */
+    ctx = nclistpop(q->ctxs);
+    UNLOCK(q);
+
+    if(ctx == NULL)
+	stat = q->ops->newctx(q->state,&ctx);
+    if(stat == NC_NOERR)
+	stat = q->ops->write(q->state,ctx,put->key,put->count,put->content);
+
+    LOCK(q);
+    if(ctx != NULL)
+	nclistpush(q->ctxs,ctx);
+    if(stat != NC_NOERR && (q->stat == NC_NOERR || put->seq < q->errseq)) {
+	q->stat = stat;
+	q->errseq = put->seq;
+    }
+    dequeue(q,put);
+    UNLOCK(q);
+    putfree(put);
+    return NC_NOERR; /* errors are reported by NCZ_queueflush */
+}
+
+int
+NCZ_queuewrite(NCZqueue* q, char* key, size64_t count, void* content)
+{
+    int stat = NC_NOERR;
+    NCZput* put = NULL;
+    NCZput* prev = NULL;
+    uintptr_t data = 0;
+    size_t keylen = strlen(key);
+    size64_t held;
+
+    LOCK(q);
+    /* Writers may be concurrent, so the pool is created under the lock */
+    if(q->pool == NULL && (stat = ncthreadpoolnew(q->maxputs,&q->pool)))
+	{UNLOCK(q); goto done;}
+    for(;;) {
+	/* Only one write of a key is in flight at a time, so they complete in order */
+	prev = NULL;
+	if(NC_hashmapget(q->pending,key,keylen,&data)) {
+	    prev = (NCZput*)data;
+	    if(prev->started) {WAIT(q); continue;}
+	}
+	/* Bound the memory held by deferred writes; a merge releases prev's content */
+	held = q->bytes - (prev == NULL ? 0 : prev->count);
+	if(held > 0 && held + count > q->maxbytes) {WAIT(q); continue;}
+	break;
+    }
+    if(prev != NULL) {
+	/* Merge with the queued write of the same key */
+	q->bytes = held + count;
+	nullfree(prev->content);
+	prev->content = content; content = NULL;
+	prev->count = count;
+	BROADCAST(q); /* the content held may have shrunk */
+	UNLOCK(q);
+	goto done;
+    }
+    if((put = (NCZput*)calloc(1,sizeof(NCZput))) == NULL)
+	{UNLOCK(q); stat = NC_ENOMEM; goto done;}
+    put->q = q;
+    put->key = key; key = NULL;
+    put->count = count;
+    put->content = content; content = NULL;
+    put->seq = q->seq++;
+    if(!NC_hashmapadd(q->pending,(uintptr_t)put,put->key,keylen))
+	{UNLOCK(q); stat = NC_ENOMEM; goto done;}
+    q->bytes += count;
+    UNLOCK(q);
+
+    if((stat = ncthreadpoolsubmit(q->pool,queueput,put))) {
+	LOCK(q);
+	dequeue(q,put);
+	UNLOCK(q);
+	goto done;
+    }
+    put = NULL; /* owned by the worker */
+
+done:
+    putfree(put);
+    nullfree(key);
+    nullfree(content);
+    return THROW(stat);
+}
+
+void
+NCZ_queuewait(NCZqueue* q, const char* key)
+{
+    if(q == NULL || q->pool == NULL) return;
+    LOCK(q);
+    if(key == NULL) {
+	while(NC_hashmapcount(q->pending) > 0)
+	    WAIT(q);
+    } else {
+	while(NC_hashmapget(q->pending,key,strlen(key),NULL))
+	    WAIT(q);
+    }
+    UNLOCK(q);
+}
+
+int
+NCZ_queueflush(NCZqueue* q)
+{
+    int stat = NC_NOERR;
+
+    if(q == NULL) return NC_NOERR;
+    NCZ_queuewait(q,NULL);
+    LOCK(q);
+    stat = q->stat; /* the content of a failed write is lost, so the error sticks */
+    UNLOCK(q);
+    return stat;
+}
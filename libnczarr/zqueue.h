@@ -0,0 +1,42 @@
+/*********************************************************************
+ *   Copyright 2018, UCAR/Unidata
+ *   See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ *********************************************************************/
+
+#ifndef ZQUEUE_H
+#define ZQUEUE_H
+
+/*
+A queue of deferred whole-object writes, done by a pool of worker
+threads. Writes of the same key complete in order; a write queued
+behind another write of the same key that has not yet started
+simply replaces its content. The writer blocks while the queued
+content would exceed maxbytes. NCZ_queueflush waits for all
+writes and returns the error of the earliest write that failed, so
+the error reported does not depend on the order in which the
+workers happened to finish.
+*/
+
+/* How the workers do the writes */
+typedef struct NCZqueueops {
+    /* Create the context (e.g. a client) used by one worker */
+    int (*newctx)(void* state, void** ctxp);
+    void (*freectx)(void* state, void* ctx);
+    int (*write)(void* state, void* ctx, const char* key, size64_t count, const void* content);
+} NCZqueueops;
+
+typedef struct NCZqueue NCZqueue; /* Opaque */
+
+/* Create a queue; *qp is set to NULL if the writes should be done
+   synchronously (maxputs < 2 or no threads) */
+extern int NCZ_queuenew(size_t maxputs, size64_t maxbytes, const NCZqueueops* ops, void* state, NCZqueue** qp);
+/* Queue a write; takes ownership of both key and content */
+extern int NCZ_queuewrite(NCZqueue* q, char* key, size64_t count, void* content);
+/* Wait for the writes of key, or of all keys if key is NULL */
+extern void NCZ_queuewait(NCZqueue* q, const char* key);
+/* Wait for all writes and return the error of the earliest that failed */
+extern int NCZ_queueflush(NCZqueue* q);
+/* Wait for all writes and reclaim the queue */
+extern void NCZ_queuefree(NCZqueue* q);
+
+#endif /*ZQUEUE_H*/
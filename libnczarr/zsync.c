@@ -32,6 +32,7 @@ static int define_grp(NC_FILE_INFO_T* file, NC_GRP_INFO_T* grp);
 static int define_dims(NC_FILE_INFO_T* file, NC_GRP_INFO_T* grp, NClist* diminfo);
 static int define_vars(NC_FILE_INFO_T* file, NC_GRP_INFO_T* grp, NClist* varnames);
 static int define_var1(NC_FILE_INFO_T* file, NC_GRP_INFO_T* grp, const char* varname);
+static int read_var_meta(NC_FILE_INFO_T* file, NC_VAR_INFO_T* var, int* suppressp);
 static int define_subgrps(NC_FILE_INFO_T* file, NC_GRP_INFO_T* grp, NClist* subgrpnames);
 static int searchvars(NCZ_FILE_INFO_T*, NC_GRP_INFO_T*, NClist*);
 static int searchsubgrps(NCZ_FILE_INFO_T*, NC_GRP_INFO_T*, NClist*);
@@ -83,7 +84,11 @@ ncz_sync_file(NC_FILE_INFO_T* file, int isclose)
     if((stat = ncz_sync_grp(file, file->root_grp, isclose)))
         goto done;
 
-    stat = NCZMD_consolidate((NCZ_FILE_INFO_T*)file->format_file_info);
+    if((stat = NCZMD_consolidate((NCZ_FILE_INFO_T*)file->format_file_info)))
+        goto done;
+
+    /* Wait for any writes that the storage has deferred */
+    stat = nczmap_flush(((NCZ_FILE_INFO_T*)file->format_file_info)->map);
 done:
     NCJreclaim(json);
     return ZUNTRACE(stat);
@@ -478,6 +483,26 @@ ncz_sync_var_meta(NC_FILE_INFO_T* file, NC_VAR_INFO_T* var, int isclose)
         jtmp = NULL;
     }
 
+    /* Zarr V3 keys: the metadata handler turns these into the
+       chunk_key_encoding and the sharding_indexed codec */
+    if(zinfo->format.zarr == ZARRFORMAT3) {
+	if((stat = NCJinsertstring(jvar,"chunk_key_encoding",(zvar->v3chunkkeys?"default":"v2")))<0) {stat = NC_EINVAL; goto done;}
+	if(zvar->shards != NULL) {
+	    NCJnew(NCJ_ARRAY,&jtmp);
+	    for(i=0;i<var->ndims;i++) {
+		snprintf(number,sizeof(number),"%lld",zvar->shards[i]);
+		NCJaddstring(jtmp,NCJ_INT,number);
+	    }
+	    if((stat = NCJinsert(jvar,"shards",jtmp))<0) {stat = NC_EINVAL; goto done;}
+	    jtmp = NULL;
+	    NCJnew(NCJ_DICT,&jtmp);
+	    if((stat = NCJinsertstring(jtmp,"location",((zvar->shardflags & NCZ_SHARD_INDEX_START)?"start":"end")))<0
+	       || (stat = NCJinsertint(jtmp,"crc32c",((zvar->shardflags & NCZ_SHARD_INDEX_CRC32C)?1:0)))<0
+	       || (stat = NCJinsert(jvar,"shard_index",jtmp))<0) {stat = NC_EINVAL; goto done;}
+	    jtmp = NULL;
+	}
+    }
+
     nullfree(key);
     key = NULL;
     NCZ_varkey(var, &key);
@@ -521,6 +546,16 @@ ncz_sync_var_meta(NC_FILE_INFO_T* file, NC_VAR_INFO_T* var, int isclose)
 	NCJnewstring(NCJ_STRING,"chunked",&jtmp);
 	if((stat = NCJinsert(jncvar,"storage",jtmp))<0) {stat = NC_EINVAL; goto done;}
 	jtmp = NULL;
+	/* Record the no. of chunks per shard, if sharded; V3 says so itself */
+	if(zvar->shards != NULL && zinfo->format.zarr == ZARRFORMAT2) {
+	    NCJnew(NCJ_ARRAY,&jtmp);
+	    for(i=0;i<var->ndims;i++) {
+		snprintf(number,sizeof(number),"%lld",zvar->shards[i]);
+		NCJaddstring(jtmp,NCJ_INT,number);
+	    }
+	    if((stat = NCJinsert(jncvar,"shards",jtmp))<0) {stat = NC_EINVAL; goto done;}
+	    jtmp = NULL;
+	}
     }
 
     /* Build .zattrs object */
@@ -935,6 +970,8 @@ zconvert(const NCjson* src, nc_type typeid, size_t typelen, int* countp, NCbytes
 	    count = ncbyteslength(dst);
         } else {
 	    count = NCJarraylength(src);
+	    /* Size the buffer once: appending grows it only to the exact length */
+	    ncbytessetalloc(dst,ncbyteslength(dst)+(size_t)count*typelen);
 	    for(i=0;i<count;i++) {
 	        NCjson* value = NCJith(src,i);
                 if((stat = NCZ_convert1(value, typeid, dst))) goto done;
@@ -1368,6 +1405,10 @@ done:
 /**
  * @internal Materialize single var into memory;
  * Take xarray and purezarr into account.
+ * In a read-only NCZarr dataset, all dimensions are defined
+ * by the groups, so only the name is entered here and the
+ * .zarray and .zattrs objects are read when the variable is
+ * first used; see ncz_get_var_meta.
  *
  * @param file Pointer to file info struct.
  * @param grp Pointer to grp info struct.
@@ -1378,6 +1419,135 @@ done:
  */
 static int
 define_var1(NC_FILE_INFO_T* file, NC_GRP_INFO_T* grp, const char* varname)
+{
+    int stat = NC_NOERR;
+    NCZ_FILE_INFO_T* zinfo = NULL;
+    NC_VAR_INFO_T* var = NULL;
+    NCZ_VAR_INFO_T* zvar = NULL;
+    int suppress = 0;
+
+    ZTRACE(3,"file=%s grp=%s varname=%s",file->controller->path,grp->hdr.name,varname);
+
+    zinfo = file->format_file_info;
+
+    if((stat = nc4_var_list_add2(grp, varname, &var)))
+	goto done;
+
+    /* And its annotation */
+    if((zvar = calloc(1,sizeof(NCZ_VAR_INFO_T)))==NULL)
+	{stat = NC_ENOMEM; goto done;}
+    var->format_var_info = zvar;
+    zvar->common.file = file;
+
+    /* pretend it was created */
+    var->created = 1;
+
+    /* Indicate we do not have quantizer yet */
+    var->quantize_mode = -1;
+
+    if(file->no_write && (zinfo->controls.flags & FLAG_PUREZARR) == 0) {
+	var->meta_read = NC_FALSE; /* defer */
+	goto done;
+    }
+
+    /* Set first: filter setup may inquire about the var */
+    var->meta_read = NC_TRUE;
+    if((stat = read_var_meta(file,var,&suppress))) goto done;
+    if(suppress) {
+	/* Reclaim NCZarr variable specific info */
+	(void)NCZ_zclose_var1(var);
+	/* Remove from list of variables and reclaim the top level var object */
+	(void)nc4_var_list_del(grp, var);
+	var = NULL;
+    }
+
+done:
+    return ZUNTRACE(stat);
+}
+
+/**
+ * @internal Remove from a group the variables whose metadata was
+ * deferred at open but that an eager open would have suppressed
+ * (see read_var_meta). Only the .zarray object of each variable is
+ * read here. Removing a variable renumbers the ones after it, so
+ * this must run before any varid of the group is used or returned.
+ * A .zarray that cannot be read is left for ncz_get_var_meta
+ * to report.
+ *
+ * @param file Pointer to file info struct.
+ * @param grp Pointer to grp info struct.
+ *
+ * @return ::NC_NOERR No error.
+ * @author Dennis Heimbigner
+ */
+int
+ncz_probe_vars(NC_FILE_INFO_T* file, NC_GRP_INFO_T* grp)
+{
+    int stat = NC_NOERR;
+    size_t i;
+    int deletedid;
+    NCZ_FILE_INFO_T* zinfo = file->format_file_info;
+    NCZ_GRP_INFO_T* zgrp = grp->format_grp_info;
+    char* key = NULL;
+
+    /* Only a read-only open defers variable metadata */
+    if(!file->no_write || zgrp->varsprobed) return NC_NOERR;
+
+    ZTRACE(3,"file=%s grp=%s",file->controller->path,grp->hdr.name);
+
+    for(i=0;i<ncindexsize(grp->vars);) {
+	NC_VAR_INFO_T* var = (NC_VAR_INFO_T*)ncindexith(grp->vars,i);
+	NCZ_VAR_INFO_T* zvar = NULL;
+	const NCjson* jshape = NULL;
+	size_t j;
+
+	i++;
+	if(var == NULL || var->meta_read) continue;
+	zvar = var->format_var_info;
+	if(zvar->zarray.obj == NULL) {
+	    if((stat = NCZ_varkey(var,&key))) goto done;
+	    /* A failure is reported when the metadata is read */
+	    (void)NCZMD_fetch_json_array(zinfo, key, &zvar->zarray.obj);
+	    nullfree(key); key = NULL;
+	}
+	if(NCJsort(zvar->zarray.obj) != NCJ_DICT) continue;
+	jshape = NCJdictlookup(zvar->zarray.obj,"shape");
+	if(NCJsort(jshape) != NCJ_ARRAY || NCJarraylength(jshape) > 0) continue;
+	/* Empty shape: suppress variable */
+	ZLOG(NCLOGWARN,"Empty shape for variable %s suppressed",var->hdr.name);
+	deletedid = var->hdr.id;
+	(void)NCZ_zclose_var1(var);
+	(void)nc4_var_list_del(grp, var);
+	/* Renumber all variables with higher indices. */
+	for(j=0;j<ncindexsize(grp->vars);j++) {
+	    NC_VAR_INFO_T* v = (NC_VAR_INFO_T*)ncindexith(grp->vars,j);
+	    if(v != NULL && v->hdr.id > deletedid) v->hdr.id--;
+	}
+	/* Rebuild the index. */
+	if(!ncindexrebuild(grp->vars)) {stat = NC_EINTERNAL; goto done;}
+	i--; /* the next variable moved into this slot */
+    }
+    zgrp->varsprobed = 1;
+
+done:
+    nullfree(key);
+    return ZUNTRACE(stat);
+}
+
+/**
+ * @internal Read the .zarray and .zattrs objects of a variable
+ * and fill in its type, shape, chunking, fill value, filters,
+ * and dimensions.
+ *
+ * @param file Pointer to file info struct.
+ * @param var Pointer to var info struct.
+ * @param suppressp Set to 1 if the variable cannot be represented
+ *
+ * @return ::NC_NOERR No error.
+ * @author Dennis Heimbigner
+ */
+static int
+read_var_meta(NC_FILE_INFO_T* file, NC_VAR_INFO_T* var, int* suppressp)
 {
     int stat = NC_NOERR;
     size_t j;
@@ -1385,8 +1555,8 @@ define_var1(NC_FILE_INFO_T* file, NC_GRP_INFO_T* grp, const char* varname)
     int purezarr = 0;
     int xarray = 0;
     /* per-variable info */
-    NC_VAR_INFO_T* var = NULL;
-    NCZ_VAR_INFO_T* zvar = NULL;
+    NC_GRP_INFO_T* grp = var->container;
+    NCZ_VAR_INFO_T* zvar = var->format_var_info;
     const NCjson* jvar = NULL;
     const NCjson* jatts = NULL; /* corresponding to jvar */
     const NCjson* jncvar = NULL;
@@ -1401,12 +1571,13 @@ define_var1(NC_FILE_INFO_T* file, NC_GRP_INFO_T* grp, const char* varname)
     int vtypelen = 0;
     size_t rank = 0;
     size_t zarr_rank = 0; /* Need to watch out for scalars */
+    size_t nshards = 0; /* rank of the shard shape */
 #ifdef NETCDF_ENABLE_NCZARR_FILTERS
     const NCjson* jfilter = NULL;
     int chainindex = 0;
 #endif
 
-    ZTRACE(3,"file=%s grp=%s varname=%s",file->controller->path,grp->hdr.name,varname);
+    ZTRACE(3,"file=%s var=%s",file->controller->path,var->hdr.name);
 
     zinfo = file->format_file_info;
 
@@ -1415,26 +1586,12 @@ define_var1(NC_FILE_INFO_T* file, NC_GRP_INFO_T* grp, const char* varname)
 
     dimnames = nclistnew();
 
-    if((stat = nc4_var_list_add2(grp, varname, &var)))
-	goto done;
-
-    /* And its annotation */
-    if((zvar = calloc(1,sizeof(NCZ_VAR_INFO_T)))==NULL)
-	{stat = NC_ENOMEM; goto done;}
-    var->format_var_info = zvar;
-    zvar->common.file = file;
-
-    /* pretend it was created */
-    var->created = 1;
-
-    /* Indicate we do not have quantizer yet */
-    var->quantize_mode = -1;
-
     /* Construct var path */
     if((stat = NCZ_varkey(var,&key)))
 	goto done;
 
-    if ((stat = NCZMD_fetch_json_array(zinfo, key, &zvar->zarray.obj)) \
+    /* The .zarray may already have been fetched by ncz_probe_vars */
+    if ((zvar->zarray.obj == NULL && (stat = NCZMD_fetch_json_array(zinfo, key, &zvar->zarray.obj))) \
     || (stat = NCZMD_fetch_json_attrs(zinfo, key, &zvar->zarray.atts))) {
         goto done;
     }
@@ -1517,6 +1674,40 @@ define_var1(NC_FILE_INFO_T* file, NC_GRP_INFO_T* grp, const char* varname)
 	    }
 	    jdimrefs = NULL; /* avoid double free */
 	} /* else  simulate it from the shape of the variable */
+	/* Extract the shard shape, if any; rank is verified with the chunks */
+	if((stat = NCJdictget(jncvar,"shards",&jvalue))<0) {stat = NC_EINVAL; goto done;}
+	if(jvalue != NULL && !zvar->scalar) {
+	    if(NCJsort(jvalue) != NCJ_ARRAY || NCJarraylength(jvalue) == 0)
+		{stat = (THROW(NC_ENCZARR)); goto done;}
+	    nshards = NCJarraylength(jvalue);
+	    if((zvar->shards = (size64_t*)malloc(sizeof(size64_t)*(size_t)nshards)) == NULL)
+		{stat = NC_ENOMEM; goto done;}
+	    if((stat = decodeints(jvalue, zvar->shards))) goto done;
+	}
+    }
+
+    /* Zarr V3 chunk keys and shards (must precede chunk cache creation) */
+    if(zinfo->format.zarr == ZARRFORMAT3) {
+	if((stat = NCJdictget(jvar,"chunk_key_encoding",&jvalue))<0) {stat = NC_EINVAL; goto done;}
+	if(NCJsort(jvalue) == NCJ_STRING && strcmp(NCJstring(jvalue),"default")==0)
+	    zvar->v3chunkkeys = 1;
+	if((stat = NCJdictget(jvar,"shards",&jvalue))<0) {stat = NC_EINVAL; goto done;}
+	if(jvalue != NULL && zvar->shards == NULL && !zvar->scalar) {
+	    const NCjson* jindex = NCJdictlookup(jvar,"shard_index");
+	    const NCjson* jflag = NULL;
+	    if(NCJsort(jvalue) != NCJ_ARRAY || NCJarraylength(jvalue) == 0)
+		{stat = (THROW(NC_ENCZARR)); goto done;}
+	    nshards = NCJarraylength(jvalue);
+	    if((zvar->shards = (size64_t*)malloc(sizeof(size64_t)*(size_t)nshards)) == NULL)
+		{stat = NC_ENOMEM; goto done;}
+	    if((stat = decodeints(jvalue, zvar->shards))) goto done;
+	    jflag = NCJdictlookup(jindex,"location");
+	    if(NCJsort(jflag) == NCJ_STRING && strcmp(NCJstring(jflag),"start")==0)
+		zvar->shardflags |= NCZ_SHARD_INDEX_START;
+	    jflag = NCJdictlookup(jindex,"crc32c");
+	    if(NCJsort(jflag) == NCJ_INT && strcmp(NCJstring(jflag),"0")!=0)
+		zvar->shardflags |= NCZ_SHARD_INDEX_CRC32C;
+	}
     }
 
     /* Capture dimension_separator (must precede chunk cache creation) */
@@ -1616,6 +1807,13 @@ define_var1(NC_FILE_INFO_T* file, NC_GRP_INFO_T* grp, const char* varname)
 		zvar->chunkproduct *= chunks[j];
 	    }
 	    zvar->chunksize = zvar->chunkproduct * var->type_info->size;
+	    /* validate the shard shape */
+	    if(zvar->shards != NULL) {
+		if(nshards != rank) {stat = (THROW(NC_ENCZARR)); goto done;}
+		for(j=0;j<rank;j++) {
+		    if(zvar->shards[j] == 0) {stat = (THROW(NC_ENCZARR)); goto done;}
+		}
+	    }
 	    /* Create the cache */
 	    if((stat = NCZ_create_chunk_cache(var,var->type_info->size*zvar->chunkproduct,zvar->dimension_separator,&zvar->cache)))
 		goto done;
@@ -1690,13 +1888,7 @@ define_var1(NC_FILE_INFO_T* file, NC_GRP_INFO_T* grp, const char* varname)
 #endif
 
 suppressvar:
-    if(suppress) {
-	/* Reclaim NCZarr variable specific info */
-	(void)NCZ_zclose_var1(var);
-	/* Remove from list of variables and reclaim the top level var object */
-	(void)nc4_var_list_del(grp, var);
-	var = NULL;
-    }
+    *suppressp = suppress;
 
 done:
     nclistfreeall(dimnames); dimnames = NULL;
@@ -2006,21 +2198,23 @@ done:
 }
 
 /**
- * @internal Get the metadata for a variable.
+ * @internal Get the metadata for a variable whose .zarray
+ * and .zattrs objects were not read at open; see define_var1.
  *
+ * @param file Pointer to file info struct.
  * @param var Pointer to var info struct.
  *
  * @return ::NC_NOERR No error.
- * @return ::NC_EBADID Bad ncid.
  * @return ::NC_ENOMEM Out of memory.
- * @return ::NC_EHDFERR HDF5 returned error.
- * @return ::NC_EVARMETA Error with var metadata.
- * @author Ed Hartnett
+ * @return ::NC_ENCZARR Variable metadata is malformed or
+ * describes a variable that cannot be represented.
+ * @author Ed Hartnett, Dennis Heimbigner
  */
 int
 ncz_get_var_meta(NC_FILE_INFO_T* file, NC_VAR_INFO_T* var)
 {
     int retval = NC_NOERR;
+    int suppress = 0;
 
     assert(file && var && var->format_var_info);
     LOG((3, "%s: var %s", __func__, var->hdr.name));
@@ -2030,49 +2224,14 @@ ncz_get_var_meta(NC_FILE_INFO_T* file, NC_VAR_INFO_T* var)
     if (var->meta_read)
 	goto done;
 
-#ifdef LOOK
-    /* Get the current chunk cache settings. */
-    if ((access_pid = H5Dget_access_plist(hdf5_var->hdf_datasetid)) < 0)
-	BAIL(NC_EVARMETA);
-
-    /* Learn about current chunk cache settings. */
-    if ((H5Pget_chunk_cache(access_pid, &(var->chunk_cache_nelems),
-			    &(var->chunk_cache_size), &rdcc_w0)) < 0)
-	BAIL(NC_EHDFERR);
-    var->chunk_cache_preemption = rdcc_w0;
-
-    /* Get the dataset creation properties. */
-    if ((propid = H5Dget_create_plist(hdf5_var->hdf_datasetid)) < 0)
-	BAIL(NC_EHDFERR);
-
-    /* Get var chunking info. */
-    if ((retval = get_chunking_info(propid, var)))
-	BAIL(retval);
-
-    /* Get filter info for a var. */
-    if ((retval = get_filter_info(propid, var)))
-	BAIL(retval);
-
-    /* Get fill value, if defined. */
-    if ((retval = get_fill_info(propid, var)))
-	BAIL(retval);
-
-    /* Is this a deflated variable with a chunksize greater than the
-     * current cache size? */
-    if ((retval = nc4_adjust_var_cache(var)))
-	BAIL(retval);
-
-    /* Is there an attribute which means quantization was used? */
-    if ((retval = get_quantize_info(var)))
-	BAIL(retval);
-
-    if (var->coords_read && !var->dimscale)
-	if ((retval = get_attached_info(var, hdf5_var, var->ndims, hdf5_var->hdf_datasetid)))
-	    goto done;;
-#endif
-
-    /* Remember that we have read the metadata for this var. */
+    /* Remember that we have read the metadata for this var;
+       set first, since filter setup may inquire about the var. */
     var->meta_read = NC_TRUE;
+    if ((retval = read_var_meta(file, var, &suppress)))
+	{var->meta_read = NC_FALSE; goto done;}
+    /* ncz_probe_vars has already removed the variables with an empty shape */
+    if (suppress)
+	{retval = NC_ENCZARR; goto done;}
 done:
     return ZUNTRACE(retval);
 }
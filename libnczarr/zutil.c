@@ -233,25 +233,35 @@ ncz_splitkey(const char* key, NClist* segments)
 */
 int
 NCZ_downloadjson(NCZMAP* zmap, const char* key, NCjson** jsonp)
+{
+    return NCZ_downloadjsonx(zmap,key,NCJFLAG_NONE,jsonp);
+}
+
+/**
+@internal Down load a .z... structure into memory using specific parse flags
+@param zmap - [in] controlling zarr map
+@param key - [in] .z... object to load
+@param flags - [in] NCJparse flags; NCJFLAG_ARENA suits large objects that are only read
+@param jsonp - [out] root of the loaded json (NULL if key does not exist)
+@return NC_NOERR
+@return NC_EXXX
+*/
+int
+NCZ_downloadjsonx(NCZMAP* zmap, const char* key, unsigned flags, NCjson** jsonp)
 {
     int stat = NC_NOERR;
     size64_t len;
     char* content = NULL;
     NCjson* json = NULL;
 
-    switch(stat = nczmap_len(zmap, key, &len)) {
+    switch(stat = nczmap_readobject(zmap, key, &len, (void**)&content)) {
     case NC_NOERR: break;
     case NC_ENOOBJECT: case NC_EEMPTY:
         stat = NC_NOERR;
         goto exit;
     default: goto done;
     }
-    if((content = malloc(len+1)) == NULL)
-	{stat = NC_ENOMEM; goto done;}
-    if((stat = nczmap_read(zmap, key, 0, len, (void*)content)))
-	goto done;
-    content[len] = '\0';
-    if((stat = NCJparse(content,0,&json)) < 0)
+    if((stat = NCJparse(content,flags,&json)) < 0)
 	{stat = NC_ENCZARR; goto done;}
 
 exit:
@@ -384,6 +384,23 @@ NCZ_def_var(int ncid, const char *name, nc_type xtype, int ndims,
     zvar->dimension_separator = gstate->zarr.dimension_separator;
     assert(zvar->dimension_separator != 0);
 
+    {
+	NCZ_FILE_INFO_T* zinfo = (NCZ_FILE_INFO_T*)h5->format_file_info;
+	int v3 = (zinfo->format.zarr == ZARRFORMAT3);
+	/* Zarr V3 arrays use the "default" chunk key encoding: c/i/j/... */
+	if(v3) {
+	    zvar->dimension_separator = '/';
+	    zvar->v3chunkkeys = 1;
+	}
+	/* Pack the chunks into shards if asked; pure Zarr V2 has no way to say so */
+	if(ndims > 0 && zinfo->controls.shard > 1 && (v3 || (zinfo->controls.flags & FLAG_PUREZARR) == 0)) {
+	    if((zvar->shards = (size64_t*)malloc(sizeof(size64_t)*(size_t)ndims)) == NULL)
+		BAIL(NC_ENOMEM);
+	    for(d=0;d<ndims;d++) zvar->shards[d] = zinfo->controls.shard;
+	    zvar->shardflags = (v3 ? NCZ_SHARD_INDEX_CRC32C : 0);
+	}
+    }
+
     /* Set these state flags for the var. */
     var->is_new_var = NC_TRUE;
     var->meta_read = NC_TRUE;
@@ -1173,7 +1190,7 @@ NCZ_inq_var_quantize(int ncid, int varid, int *quantize_modep,
 
     /* Find info for this file and group, and set pointer to each. */
     /* Get pointer to the var. */
-    if ((retval = nc4_find_grp_h5_var(ncid, varid, NULL, NULL, &var)))
+    if ((retval = ncz_find_grp_file_var(ncid, varid, NULL, NULL, &var)))
         return retval;
     if (!var)
         return NC_ENOTVAR;	
@@ -1863,7 +1880,7 @@ NCZ_get_vars(int ncid, int varid, const size_t *startp, const size_t *countp,
     NCZ_VAR_INFO_T* zvar = NULL;
 
     /* Find info for this file, group, and var. */
-    if ((retval = nc4_find_grp_h5_var(ncid, varid, &h5, &grp, &var)))
+    if ((retval = ncz_find_grp_file_var(ncid, varid, &h5, &grp, &var)))
 	return THROW(retval);
     assert(h5 && grp && var && var->hdr.id == varid && var->format_var_info &&
 	   var->type_info && var->type_info->size &&
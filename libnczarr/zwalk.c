@@ -22,10 +22,17 @@ static unsigned int wdebug = 1;
 static int NCZ_walk(NCZProjection** projv, NCZOdometer* chunkodom, NCZOdometer* slpodom, NCZOdometer* memodom, const struct Common* common, void* chunkdata);
 static int rangecount(NCZChunkRange range);
 static int readfromcache(void* source, size64_t* chunkindices, void** chunkdata);
+static int prefetchcache(void* source, size_t nchunks, const size64_t* chunkindices);
+static int prefetchbatch(struct Common* common, NCZOdometer* aheadodom, size64_t* batch, size_t* aheadp);
+static int readdirect(void* source, size_t nchunks, const size64_t* chunkindices, void** memory, int retain);
+static int directbatch(struct Common* common, size_t nchunks, size64_t* chunkindices, void** memory);
+static int isskipped(const struct Common* common, const size64_t* chunkindices);
+static int isdirect(const struct Common* common, const size64_t* chunkindices);
 static int iswholechunk(struct Common* common,NCZSlice*);
 static int wholechunk_indices(struct Common* common, NCZSlice* slices, size64_t* chunkindices);
 #ifdef TRANSFERN
 static int transfern(const struct Common* common, unsigned char* slpptr, unsigned char* memptr, size_t avail, size_t slpstride, void* chunkdata);
+static NCZ_copier selectcopier(const struct Common* common);
 #endif
 
 #if 0
@@ -173,6 +180,18 @@ NCZ_transferslice(NC_VAR_INFO_T* var, int reading,
 
     common.reader.source = ((NCZ_VAR_INFO_T*)(var->format_var_info))->cache;
     common.reader.read = readfromcache;
+    if(reading) {
+	/* Overlap the chunk reads if the file has a worker pool */
+	NCthreadpool* pool = NULL;
+	if((stat = NCZ_get_threadpool(common.file,&pool))) goto done;
+	if(pool != NULL) {
+	    common.reader.prefetch = prefetchcache;
+	    common.reader.batch = NCZ_cache_prefetch_limit(common.cache);
+	}
+	/* Whole chunks of fixed-size types can skip the cache entry */
+	if(typecode < NC_STRING)
+	    common.reader.direct = readdirect;
+    }
 
     if(common.scalar) {
         if((stat = NCZ_transferscalar(&common))) goto done;
@@ -200,6 +219,13 @@ NCZ_transfer(struct Common* common, NCZSlice* slices)
     NCZOdometer* memodom = NULL;
     void* chunkdata = NULL;
     int wholechunk = 0;
+    NCZOdometer* aheadodom = NULL; /* runs ahead of chunkodom to collect prefetch batches */
+    size64_t* batch = NULL;
+    size_t ahead = 0; /* no. of chunkodom positions already covered by a prefetch */
+    size64_t* direct = NULL; /* whole chunks waiting for reader.direct */
+    void** directmem = NULL; /* |direct| destinations */
+    size_t ndirect = 0;
+    size_t maxdirect = 0;
 
     /*
      We will need three sets of odometers.
@@ -216,6 +242,11 @@ NCZ_transfer(struct Common* common, NCZSlice* slices)
     if(wdebug >= 2)
 	fprintf(stderr,"slices=%s\n",nczprint_slices(common->rank,slices));
 
+#ifdef TRANSFERN
+    /* Pick the copy kernel once for the whole transfer */
+    common->copy = selectcopier(common);
+#endif
+
     if((stat = NCZ_projectslices(common, slices, &chunkodom)))
 	goto done;
 
@@ -237,6 +268,12 @@ NCZ_transfer(struct Common* common, NCZSlice* slices)
 	if((stat=wholechunk_indices(common,slices,chunkindices))) goto done;
 	if(wdebug >= 1)
 	    fprintf(stderr,"case: wholechunk: chunkindices: %s\n",nczprint_vector(common->rank,chunkindices));
+	if(common->reader.direct != NULL) {
+	    void* memory = common->memory;
+	    common->reader.retain = NCZ_cache_retain_direct(common->cache,1);
+	    stat = directbatch(common,1,chunkindices,&memory);
+	    goto done;
+	}
 	/* Read the chunk; handles fixed vs char* strings*/
         switch ((stat = common->reader.read(common->reader.source, chunkindices, &chunkdata))) {
         case NC_EEMPTY: /* cache created the chunk */
@@ -268,6 +305,25 @@ NCZ_transfer(struct Common* common, NCZSlice* slices)
 	goto done;
     }
 
+    if(common->reading && common->reader.direct != NULL) {
+	size64_t nchunks = 1;
+	int r;
+	for(r=0;r<common->rank;r++) nchunks *= (chunkodom->stop[r] - chunkodom->start[r]);
+	common->reader.retain = NCZ_cache_retain_direct(common->cache,nchunks);
+	maxdirect = (common->reader.batch > 1 ? common->reader.batch : 1);
+	if((direct = malloc(sizeof(size64_t)*maxdirect*(size_t)common->rank))==NULL)
+	    {stat = NC_ENOMEM; goto done;}
+	if((directmem = malloc(sizeof(void*)*maxdirect))==NULL)
+	    {stat = NC_ENOMEM; goto done;}
+    }
+
+    if(common->reading && common->reader.prefetch != NULL && common->reader.batch > 1) {
+	if((aheadodom = nczodom_new(common->rank,chunkodom->start,chunkodom->stop,chunkodom->stride,chunkodom->len))==NULL)
+	    {stat = NC_ENOMEM; goto done;}
+	if((batch = malloc(sizeof(size64_t)*common->reader.batch*(size_t)common->rank))==NULL)
+	    {stat = NC_ENOMEM; goto done;}
+    }
+
     /* iterate over the odometer: all combination of chunk
        indices in the projections */
     for(;nczodom_more(chunkodom);) {
@@ -277,6 +333,11 @@ NCZ_transfer(struct Common* common, NCZSlice* slices)
         NCZSlice memslices[NC_MAX_VAR_DIMS];
         NCZProjection* proj[NC_MAX_VAR_DIMS];
 	size64_t shape[NC_MAX_VAR_DIMS];
+	int walkrank;
+
+	if(aheadodom != NULL && ahead == 0) {
+	    if((stat = prefetchbatch(common,aheadodom,batch,&ahead))) goto done;
+	}
 
 	chunkindices = nczodom_indices(chunkodom);
 	if(wdebug >= 1)
@@ -309,6 +370,21 @@ NCZ_transfer(struct Common* common, NCZSlice* slices)
 	    if(proj[r]->skip) goto next;
 	}
 
+	/* Whole chunks go straight to memory, a batch at a time */
+	if(direct != NULL && isdirect(common,chunkindices)) {
+	    size64_t memstart[NC_MAX_VAR_DIMS];
+	    for(r=0;r<common->rank;r++) memstart[r] = proj[r]->memslice.start;
+	    memcpy(&direct[ndirect*(size_t)common->rank],chunkindices,sizeof(size64_t)*(size_t)common->rank);
+	    directmem[ndirect] = ((unsigned char*)common->memory)
+			+ (NCZ_computelinearoffset((size_t)common->rank,memstart,common->memshape) * common->typesize);
+	    ndirect++;
+	    if(ndirect == maxdirect) {
+		if((stat = directbatch(common,ndirect,direct,directmem))) goto done;
+		ndirect = 0;
+	    }
+	    goto next;
+	}
+
 	for(r=0;r<common->rank;r++) {
 	    slpslices[r] = proj[r]->chunkslice;
 	    memslices[r] = proj[r]->memslice;
@@ -327,8 +403,11 @@ NCZ_transfer(struct Common* common, NCZSlice* slices)
         default: goto done;
         }
 
-	slpodom = nczodom_fromslices(common->rank,slpslices);
-	memodom = nczodom_fromslices(common->rank,memslices);
+	/* Walk the longest contiguous runs the slices allow */
+	walkrank = NCZ_mergeslices(common->rank,slpslices,memslices);
+
+	slpodom = nczodom_fromslices(walkrank,slpslices);
+	memodom = nczodom_fromslices(walkrank,memslices);
 
 	{ /* walk with odometer */
 	    if(wdebug >= 1)
@@ -343,11 +422,111 @@ next:
         nczodom_free(slpodom); slpodom = NULL;
         nczodom_free(memodom); memodom = NULL;
         nczodom_next(chunkodom);
+	if(ahead > 0) ahead--;
+    }
+    if(ndirect > 0) {
+	if((stat = directbatch(common,ndirect,direct,directmem))) goto done;
     }
 done:
     nczodom_free(slpodom);
     nczodom_free(memodom);
     nczodom_free(chunkodom);
+    nczodom_free(aheadodom);
+    nullfree(batch);
+    nullfree(direct);
+    nullfree(directmem);
+    return stat;
+}
+
+/*
+Advance aheadodom over up to common->reader.batch non-skipped
+chunks, and prefetch them as one batch.
+@param common common parameters
+@param aheadodom odometer positioned at the chunk after the last prefetched one
+@param batch space for common->reader.batch chunk indices
+@param aheadp return no. of odometer positions consumed
+*/
+static int
+prefetchbatch(struct Common* common, NCZOdometer* aheadodom, size64_t* batch, size_t* aheadp)
+{
+    int stat = NC_NOERR;
+    size_t n = 0;
+    size_t ahead = 0;
+    size_t rank = (size_t)common->rank;
+
+    while(n < common->reader.batch && nczodom_more(aheadodom)) {
+	size64_t* indices = nczodom_indices(aheadodom);
+	/* Whole chunks that bypass the cache are not prefetched */
+	if(!isskipped(common,indices) && !isdirect(common,indices)) {
+	    memcpy(&batch[n*rank],indices,sizeof(size64_t)*rank);
+	    n++;
+	}
+	ahead++;
+	nczodom_next(aheadodom);
+    }
+    if(wdebug >= 1)
+	fprintf(stderr,"prefetch: %u chunks\n",(unsigned)n);
+    if(n > 1) {
+	if((stat = common->reader.prefetch(common->reader.source,n,batch))) goto done;
+    }
+    *aheadp = ahead;
+done:
+    return stat;
+}
+
+/* Will the walk skip this chunk? */
+static int
+isskipped(const struct Common* common, const size64_t* chunkindices)
+{
+    int r;
+    for(r=0;r<common->rank;r++) {
+	NCZSliceProjections* slp = &common->allprojections[r];
+	if(slp->projections[chunkindices[r] - slp->range.start].skip) return 1;
+    }
+    return 0;
+}
+
+/*
+Return 1 if the chunk is read whole and lands in one contiguous
+region of memory, so that reader.direct can read it in place.
+*/
+static int
+isdirect(const struct Common* common, const size64_t* chunkindices)
+{
+    int r;
+    if(common->reader.direct == NULL) return 0;
+    for(r=0;r<common->rank;r++) {
+	const NCZSliceProjections* slp = &common->allprojections[r];
+	const NCZProjection* proj = &slp->projections[chunkindices[r] - slp->range.start];
+	if(proj->skip) return 0;
+	if(proj->chunkslice.start != 0 || proj->chunkslice.stride != 1
+	   || proj->chunkslice.stop != common->chunklens[r])
+	    return 0;
+	/* All but the first dimension must span the whole memory row */
+	if(r > 0 && (proj->memslice.start != 0 || proj->memslice.stop != proj->memslice.len))
+	    return 0;
+    }
+    return 1;
+}
+
+/*
+Read a batch of whole chunks with reader.direct and put
+them in memory byte order.
+*/
+static int
+directbatch(struct Common* common, size_t nchunks, size64_t* chunkindices, void** memory)
+{
+    int stat = NC_NOERR;
+    size_t i;
+
+    if(wdebug >= 1)
+	fprintf(stderr,"direct: %u chunks\n",(unsigned)nchunks);
+    if((stat = common->reader.direct(common->reader.source,nchunks,chunkindices,memory,common->reader.retain))) goto done;
+    if(common->swap) {
+	for(i=0;i<nchunks;i++)
+	    NCZ_swapatomicdata((size_t)(common->chunkcount*common->typesize),memory[i],(int)common->typesize);
+    }
+done:
     return stat;
 }
 
@@ -428,7 +607,7 @@ NCZ_walk(NCZProjection** projv, NCZOdometer* chunkodom, NCZOdometer* slpodom, NC
 	     zutest->print(UTEST_WALK, common, chunkodom, slpodom, memodom);
 #endif
 	/* See if we can transfer multiple values at one shot */
-	laststride = slpodom->stride[common->rank-1];
+	laststride = nczodom_laststride(slpodom);
 	if(laststride == 1) {
 	    slpavail = nczodom_avail(slpodom); /* How much can we read? */
 	    memavail = nczodom_avail(memodom);
@@ -436,7 +615,17 @@ NCZ_walk(NCZProjection** projv, NCZOdometer* chunkodom, NCZOdometer* slpodom, NC
 	    nczodom_skipavail(slpodom);
 	    nczodom_skipavail(memodom);
 	} else {
+#ifdef TRANSFERN
+	    /* transfern can gather/scatter a strided run, so move all the
+	       values in the last dimension at once; memory is contiguous */
+	    memavail = nczodom_avail(memodom);
+	    assert(ceildiv(nczodom_avail(slpodom),laststride) == memavail);
+	    slpavail = memavail;
+	    nczodom_skipavail(slpodom);
+	    nczodom_skipavail(memodom);
+#else
 	    slpavail = 1;
+#endif
         }
    	if(slpavail > 0) {
 if(wdebug > 0) {wdebug2(common,slpptr0,memptr0,slpavail,laststride,chunkdata);}
@@ -495,6 +684,11 @@ wdebug1(const struct Common* common, unsigned char* srcptr, unsigned char* dstpt
 #endif /*0*/
 
 #ifdef TRANSFERN
+/*
+Transfer avail values between the chunk and memory.
+The memory values are contiguous; the chunk values are
+slpstride values apart.
+*/
 static int
 transfern(const struct Common* common, unsigned char* slpptr, unsigned char* memptr, size_t avail, size_t slpstride, void* chunkdata)
 {
@@ -502,43 +696,91 @@ transfern(const struct Common* common, unsigned char* slpptr, unsigned char* mem
     nc_type xtype = common->var->type_info->hdr.id;
     size_t typesize = common->typesize;
     size_t len = typesize*avail;
-    size_t m,s;
+    size_t m;
+
+    NC_UNUSED(chunkdata);
 
     if(common->reading) {
-	if(slpstride == 1) {
+	if(common->copy != NULL) {
+	    common->copy(memptr,1,slpptr,slpstride,avail);
+	} else if(slpstride == 1) {
 	    if((stat=NCZ_copy_data(common->file,common->var,slpptr,avail,common->reading,memptr))) goto done;
-///            memcpy(memptr,slpptr,len); /* straight copy */
 	} else {
-	    for(m=0,s=0;s<avail;s+=slpstride,m++) {
-		size_t soffset = s*typesize;
+	    for(m=0;m<avail;m++) {
+		size_t soffset = m*slpstride*typesize;
 		size_t moffset = m*typesize;
  	        if((stat=NCZ_copy_data(common->file,common->var,slpptr+soffset,1,common->reading,memptr+moffset))) goto done;
-///	    memcpy(memptr+moffset,slpptr+soffset,typesize);
 	    }
 	}
         if(common->swap && xtype < NC_STRING)
-            NCZ_swapatomicdata(len,memptr,common->typesize);
+            NCZ_swapatomicdata(len,memptr,(int)common->typesize);
     } else { /*writing*/
-unsigned char* srcbase = (common->reading?chunkdata:common->memory);
-unsigned srcoff = (unsigned)(memptr - srcbase);
-unsigned srcidx = srcoff / sizeof(unsigned); (void)srcidx;
-	if(slpstride == 1) {
+	if(common->copy != NULL) {
+	    common->copy(slpptr,slpstride,memptr,1,avail);
+	} else if(slpstride == 1) {
 	    if((stat=NCZ_copy_data(common->file,common->var,memptr,avail,common->reading,slpptr))) goto done;
-///            memcpy(slpptr,memptr,len); /* straight copy */
 	} else {
-	    for(m=0,s=0;s<avail;s+=slpstride,m++) {
-		size_t soffset = s*typesize;
+	    for(m=0;m<avail;m++) {
+		size_t soffset = m*slpstride*typesize;
 		size_t moffset = m*typesize;
  	        if((stat=NCZ_copy_data(common->file,common->var,memptr+moffset,1,common->reading,slpptr+soffset))) goto done;
-///		memcpy(slpptr+soffset,memptr+moffset,typesize);
 	    }
 	}
-        if(common->swap && xtype < NC_STRING)
-            NCZ_swapatomicdata(len,slpptr,common->typesize);
+        if(common->swap && xtype < NC_STRING) {
+	    if(slpstride == 1)
+                NCZ_swapatomicdata(len,slpptr,(int)common->typesize);
+	    else for(m=0;m<avail;m++)
+                NCZ_swapatomicdata(typesize,slpptr+(m*slpstride*typesize),(int)common->typesize);
+	}
     }
 done:
     return THROW(stat);
 }
+
+/*
+Copy kernels for each atomic type size.
+The fixed-size memcpy compiles to a single (unaligned) load and store,
+and the stride 1 case lets the compiler vectorize the loop.
+*/
+#define COPIER(N) \
+static void \
+copy##N(unsigned char* dst, size_t dststride, const unsigned char* src, size_t srcstride, size_t n) \
+{ \
+    size_t i; \
+    if(dststride == 1 && srcstride == 1) \
+	{memcpy(dst,src,n*N); return;} \
+    if(dststride == 1) { \
+	for(i=0;i<n;i++) memcpy(dst+(i*N),src+(i*srcstride*N),N); \
+    } else if(srcstride == 1) { \
+	for(i=0;i<n;i++) memcpy(dst+(i*dststride*N),src+(i*N),N); \
+    } else { \
+	for(i=0;i<n;i++) memcpy(dst+(i*dststride*N),src+(i*srcstride*N),N); \
+    } \
+}
+COPIER(1)
+COPIER(2)
+COPIER(4)
+COPIER(8)
+
+/*
+Select the copy kernel for the variable's type: only fixed-size
+atomic types can bypass NCZ_copy_data.
+@return kernel or NULL
+*/
+static NCZ_copier
+selectcopier(const struct Common* common)
+{
+    if(common->var == NULL || common->var->type_info == NULL) return NULL;
+    if(common->var->type_info->hdr.id >= NC_STRING) return NULL;
+    switch (common->typesize) {
+    case 1: return copy1;
+    case 2: return copy2;
+    case 4: return copy4;
+    case 8: return copy8;
+    default: break;
+    }
+    return NULL;
+}
 #endif /*TRANSFERN*/
 
 #if 0
@@ -717,6 +959,18 @@ readfromcache(void* source, size64_t* chunkindices, void** chunkdatap)
     return NCZ_read_cache_chunk((struct NCZChunkCache*)source, chunkindices, chunkdatap);
 }
 
+static int
+prefetchcache(void* source, size_t nchunks, const size64_t* chunkindices)
+{
+    return NCZ_prefetch_cache_chunks((struct NCZChunkCache*)source, nchunks, chunkindices);
+}
+
+static int
+readdirect(void* source, size_t nchunks, const size64_t* chunkindices, void** memory, int retain)
+{
+    return NCZ_read_cache_chunks_direct((struct NCZChunkCache*)source, nchunks, chunkindices, memory, retain);
+}
+
 void
 NCZ_clearcommon(struct Common* common)
 {
@@ -803,7 +1057,7 @@ NCZ_read_chunk(int ncid, int varid, size64_t* zindices, void* chunkdata)
     struct NCZChunkCache* cache = NULL;
     void* cachedata = NULL;
 
-    if ((stat = nc4_find_grp_h5_var(ncid, varid, &h5, NULL, &var)))
+    if ((stat = ncz_find_grp_file_var(ncid, varid, &h5, NULL, &var)))
 	return THROW(stat);
     zvar = (NCZ_VAR_INFO_T*)var->format_var_info;
     cache = zvar->cache;
@@ -26,8 +26,19 @@
 
 /* Forward */
 static int get_chunk(NCZChunkCache* cache, NCZCacheEntry* entry);
+static int read_chunk(NCZChunkCache* cache, NCZCacheEntry* entry, int* emptyp);
+static int decode_chunk(NCZChunkCache* cache, NCZCacheEntry* entry);
+static int complete_chunk(NCZChunkCache* cache, NCZCacheEntry* entry, int empty);
 static int put_chunk(NCZChunkCache* cache, NCZCacheEntry*);
+static int put_chunks(NCZChunkCache* cache, size_t nentries, NCZCacheEntry** entries);
+static int prepare_chunk(NCZChunkCache* cache, NCZCacheEntry* entry);
+static int encode_chunk(NCZChunkCache* cache, NCZCacheEntry* entry);
+static int write_chunk(NCZChunkCache* cache, NCZCacheEntry* entry);
 static int verifycache(NCZChunkCache* cache);
+static int locate_chunk(NCZChunkCache* cache, NCZCacheEntry* entry);
+static int build_inventory(NCZChunkCache* cache, NCZCacheEntry* entry);
+static int get_shard_index(NCZChunkCache* cache, NCZCacheEntry* entry, size64_t** indexp);
+static int put_shards(NCZChunkCache* cache, size_t nentries, NCZCacheEntry** entries);
 static int flushcache(NCZChunkCache* cache);
 static int constraincache(NCZChunkCache* cache, size64_t needed);
 
@@ -78,18 +89,23 @@ NCZ_set_var_chunk_cache(int ncid, int varid, size_t cachesize, size_t nelems, fl
     assert(grp && h5);
 
     /* Find the var. */
+    if ((retval = ncz_probe_vars(h5, grp)))
+        goto done;
     if (!(var = (NC_VAR_INFO_T *)ncindexith(grp->vars, (size_t)varid)))
         {retval = NC_ENOTVAR; goto done;}
     assert(var && var->hdr.id == varid);
 
     zvar = (NCZ_VAR_INFO_T*)var->format_var_info;
-    assert(zvar != NULL && zvar->cache != NULL);
+    assert(zvar != NULL && (zvar->cache != NULL || !var->meta_read));
 
     /* Set the values. */
     var->chunkcache.size = cachesize;
     var->chunkcache.nelems = nelems;
     var->chunkcache.preemption = preemption;
 
+    /* A variable whose metadata has not been read yet picks these up when its cache is created */
+    if(!var->meta_read) goto done;
+
     /* Fix up cache */
     if((retval = NCZ_adjust_var_cache(var))) goto done;
 done:
@@ -202,9 +218,14 @@ NCZ_create_chunk_cache(NC_VAR_INFO_T* var, size64_t chunksize, char dimsep, NCZC
         var->hdr.name,(unsigned long)cache->maxentries,(unsigned long)cache->maxsize);
 #endif
     if((stat = ncxcachenew(LEAFLEN,&cache->xcache))) goto done;
-    if((cache->mru = nclistnew()) == NULL)
-	{stat = NC_ENOMEM; goto done;}
-    nclistsetalloc(cache->mru,cache->params.nelems);
+
+    if(zvar->shards != NULL) {
+	size_t i;
+	cache->shardcount = 1;
+	for(i=0;i<var->ndims;i++) cache->shardcount *= zvar->shards[i];
+	cache->shardflags = zvar->shardflags;
+	if((cache->shardindex = NC_hashmapnew(0)) == NULL) {stat = NC_ENOMEM; goto done;}
+    }
 
     if(cachep) {*cachep = cache; cache = NULL;}
 done:
@@ -218,9 +239,14 @@ free_cache_entry(NCZChunkCache* cache, NCZCacheEntry* entry)
 {
     if(entry) {
         int tid = cache->var->type_info->hdr.id;
-	if(tid == NC_STRING && !entry->isfixedstring) {
+	if(tid == NC_STRING && !entry->isfixedstring && entry->data != NULL) {
             NC_reclaim_data(cache->var->container->nc4_info->controller,tid,entry->data,cache->chunkcount);
 	}
+	if(entry->ismapped) {
+	    NCZ_FILE_INFO_T* zfile = cache->var->container->nc4_info->format_file_info;
+	    (void)nczmap_unmapobject(zfile->map,entry->data,entry->size);
+	    entry->data = NULL;
+	}
 	nullfree(entry->data);
 	nullfree(entry->key.varkey);
 	nullfree(entry->key.chunkkey);
@@ -236,19 +262,33 @@ NCZ_free_chunk_cache(NCZChunkCache* cache)
     ZTRACE(4,"cache.var=%s",cache->var->hdr.name);
 
     /* Iterate over the entries */
-    while(nclistlength(cache->mru) > 0) {
-	void* ptr;
-        NCZCacheEntry* entry = nclistremove(cache->mru,0);
-	(void)ncxcacheremove(cache->xcache,entry->hashkey,&ptr);
-	assert(ptr == entry);
-        free_cache_entry(cache,entry);
+    if(cache->xcache != NULL) {
+	NCZCacheEntry* entry = NULL;
+        while((entry = ncxcachelast(cache->xcache)) != NULL) {
+	    void* ptr;
+	    (void)ncxcacheremove(cache->xcache,entry->hashkey,&ptr);
+	    assert(ptr == entry);
+            free_cache_entry(cache,entry);
+	}
     }
 #ifdef DEBUG
-fprintf(stderr,"|cache.free|=%ld\n",nclistlength(cache->mru));
+fprintf(stderr,"|cache.free|=%ld\n",ncxcachecount(cache->xcache));
 #endif
     ncxcachefree(cache->xcache);
-    nclistfree(cache->mru);
-    cache->mru = NULL;
+    cache->xcache = NULL;
+    if(cache->shardindex != NULL) {
+	size_t i;
+	for(i=0;i<cache->shardindex->alloc;i++) {
+	    uintptr_t index = 0;
+	    const char* key = NULL;
+	    (void)NC_hashmapith(cache->shardindex,i,&index,&key);
+	    if(key != NULL) nullfree((void*)index);
+	}
+	NC_hashmapfree(cache->shardindex);
+	cache->shardindex = NULL;
+    }
+    NC_hashmapfree(cache->inventory);
+    cache->inventory = NULL;
     (void)NCZ_reclaim_fill_chunk(cache);
     nullfree(cache);
     (void)ZUNTRACE(NC_NOERR);
@@ -266,7 +306,7 @@ size64_t
 NCZ_cache_size(NCZChunkCache* cache)
 {
     assert(cache);
-    return nclistlength(cache->mru);
+    return (size64_t)ncxcachecount(cache->xcache);
 }
 
 int
@@ -301,18 +341,18 @@ NCZ_read_cache_chunk(NCZChunkCache* cache, const size64_t* indices, void** datap
         /* Create the key for this cache */
         if((stat = NCZ_buildchunkpath(cache,indices,&entry->key))) goto done;
         entry->hashkey = hkey;
+	if((stat = locate_chunk(cache,entry))) goto done;
 	assert(entry->data == NULL && entry->size == 0);
 	/* Try to read the object from "disk"; might change size; will create if non-existent */
 	if((stat=get_chunk(cache,entry))) goto done;
 	assert(entry->data != NULL);
 	/* Ensure cache constraints not violated; but do it before entry is added */
 	if((stat=verifycache(cache))) goto done;
-        nclistpush(cache->mru,entry);
 	if((stat = ncxcacheinsert(cache->xcache,entry->hashkey,entry))) goto done;
     }
 
 #ifdef DEBUG
-fprintf(stderr,"|cache.read.lru|=%ld\n",nclistlength(cache->mru));
+fprintf(stderr,"|cache.read.lru|=%ld\n",ncxcachecount(cache->xcache));
 #endif
     if(datap) *datap = entry->data;
     entry = NULL;
@@ -349,9 +389,9 @@ NCZ_write_cache_chunk(NCZChunkCache* cache, const size64_t* indices, void* conte
 	memcpy(entry->data,content,cache->chunksize);
     }
     setmodified(entry,1);
-    nclistpush(cache->mru,entry); /* MRU order */
+    ncxcacheinsert(cache->xcache,entry->hashkey,entry); /* MRU order */
 #ifdef DEBUG
-fprintf(stderr,"|cache.write|=%ld\n",nclistlength(cache->mru));
+fprintf(stderr,"|cache.write|=%ld\n",ncxcachecount(cache->xcache));
 #endif
     entry = NULL;
 
@@ -372,7 +412,7 @@ verifycache(NCZChunkCache* cache)
 
 #if 0
     /* Sanity check; make sure at least one entry is always allowed */
-    if(nclistlength(cache->mru) == 1)
+    if(ncxcachecount(cache->xcache) == 1)
 	goto done;
 #endif
     if((stat = constraincache(cache,USEPARAMSIZE))) goto done;
@@ -411,44 +451,47 @@ constraincache(NCZChunkCache* cache, size64_t needed)
 {
     int stat = NC_NOERR;
     size64_t final_size;
+    NClist* evicted = nclistnew(); /* NClist<NCZCacheEntry*> */
+    NClist* dirty = nclistnew(); /* evicted entries that must be written */
 
     /* If the cache is empty then do nothing */
     if(cache->used == 0) goto done;
 
     if(needed == USEPARAMSIZE)
         final_size = cache->params.size;
-    else if(cache->used > needed)
-        final_size = cache->used - needed;
+    else if(cache->params.size > needed)
+        final_size = cache->params.size - needed;
     else
         final_size = 0;
 
     /* Flush from LRU end if we are at capacity */
-    while(nclistlength(cache->mru) > cache->params.nelems || cache->used > final_size) {
-	size_t i;
+    while((size_t)ncxcachecount(cache->xcache) > cache->params.nelems || cache->used > final_size) {
 	void* ptr;
 	NCZCacheEntry* e = ncxcachelast(cache->xcache); /* last entry is the least recently used */
 	if(e == NULL) break;
         if((stat = ncxcacheremove(cache->xcache,e->hashkey,&ptr))) goto done;
    	assert(e == ptr);
-        for(i=0;i<nclistlength(cache->mru);i++) {
-	    e = nclistget(cache->mru,i);
-	    if(ptr == e) break;
-	}
-  	assert(e != NULL);
-	assert(i >= 0 && i < nclistlength(cache->mru));
-	nclistremove(cache->mru,i);
 	assert(cache->used >= e->size);
 	/* Note that |old chunk data| may not be same as |new chunk data| because of filters */
 	cache->used -= e->size; /* old size */
-	if(e->modified) /* flush to file */
-	    stat=put_chunk(cache,e);
-	/* reclaim */
-        nullfree(e->data); nullfree(e->key.varkey); nullfree(e->key.chunkkey); nullfree(e);
+	nclistpush(evicted,e);
+	if(e->modified) nclistpush(dirty,e);
     }
 #ifdef DEBUG
-fprintf(stderr,"|cache.makeroom|=%ld\n",nclistlength(cache->mru));
+fprintf(stderr,"|cache.makeroom|=%ld\n",ncxcachecount(cache->xcache));
 #endif
 done:
+    /* Flush the modified evictees to file, then reclaim all of them */
+    if(nclistlength(dirty) > 0) {
+	int pstat = put_chunks(cache,nclistlength(dirty),(NCZCacheEntry**)nclistcontents(dirty));
+	if(stat == NC_NOERR) stat = pstat;
+    }
+    while(nclistlength(evicted) > 0) {
+	NCZCacheEntry* e = nclistpop(evicted);
+	free_cache_entry(cache,e);
+    }
+    nclistfree(evicted);
+    nclistfree(dirty);
     return stat;
 }
 
@@ -462,33 +505,31 @@ int
 NCZ_flush_chunk_cache(NCZChunkCache* cache)
 {
     int stat = NC_NOERR;
-    size_t i;
+    NCZCacheEntry* entry = NULL;
+    NClist* dirty = NULL; /* NClist<NCZCacheEntry*> */
 
-    ZTRACE(4,"cache.var=%s |cache|=%d",cache->var->hdr.name,(int)nclistlength(cache->mru));
+    ZTRACE(4,"cache.var=%s |cache|=%d",cache->var->hdr.name,(int)ncxcachecount(cache->xcache));
 
     if(NCZ_cache_size(cache) == 0) goto done;
     
-    /* Iterate over the entries in hashmap */
-    for(i=0;i<nclistlength(cache->mru);i++) {
-        NCZCacheEntry* entry = nclistget(cache->mru,i);
-        if(entry->modified) {
-	    /* Write out this chunk in toto*/
-  	    if((stat=put_chunk(cache,entry)))
-	        goto done;
-	}
-        setmodified(entry,0);
+    /* Collect the modified entries and write them out in toto */
+    dirty = nclistnew();
+    for(entry=ncxcachefirst(cache->xcache);entry != NULL;entry=ncxcachenext(cache->xcache,entry->hashkey)) {
+        if(entry->modified) nclistpush(dirty,entry);
     }
+    if((stat = put_chunks(cache,nclistlength(dirty),(NCZCacheEntry**)nclistcontents(dirty))))
+	goto done;
     /* Re-compute space used */
     cache->used = 0;
-    for(i=0;i<nclistlength(cache->mru);i++) {
-        NCZCacheEntry* entry = nclistget(cache->mru,i);
+    for(entry=ncxcachefirst(cache->xcache);entry != NULL;entry=ncxcachenext(cache->xcache,entry->hashkey)) {
+        setmodified(entry,0);
         cache->used += entry->size;
     }
     /* Make sure cache size and nelems are correct */
     if((stat=verifycache(cache))) goto done;
 
-
 done:
+    nclistfree(dirty);
     return ZUNTRACE(stat);
 }
 
@@ -631,10 +672,8 @@ NCZ_buildchunkkey(size_t R, const size64_t* chunkindices, char dimsep, char** ke
  * @internal Push data to chunk of a file.
  * If chunk does not exist, create it
  *
- * @param file Pointer to file info struct.
- * @param proj Chunk projection
- * @param datalen size of data
- * @param data Buffer containing the chunk data to write
+ * @param cache Pointer to parent cache
+ * @param entry cache entry to write
  *
  * @return ::NC_NOERR No error.
  * @author Dennis Heimbigner
@@ -643,22 +682,36 @@ static int
 put_chunk(NCZChunkCache* cache, NCZCacheEntry* entry)
 {
     int stat = NC_NOERR;
-    NC_FILE_INFO_T* file = NULL;
-    NCZ_FILE_INFO_T* zfile = NULL;
-    NCZMAP* map = NULL;
-    char* path = NULL;
-    nc_type tid = NC_NAT;
-    void* strchunk = NULL;
 
     ZTRACE(5,"cache.var=%s entry.key=%s",cache->var->hdr.name,entry->key);
     LOG((3, "%s: var: %p", __func__, cache->var));
 
-    file = (cache->var->container)->nc4_info;
-    zfile = file->format_file_info;
-    map = zfile->map;
+    if((stat = prepare_chunk(cache,entry))) goto done;
+    if((stat = encode_chunk(cache,entry))) goto done;
+    if((stat = write_chunk(cache,entry))) goto done;
+done:
+    return ZUNTRACE(stat);
+}
 
-    /* Collect some info */
-    tid = cache->var->type_info->hdr.id;
+/**
+ * @internal Convert a chunk of strings from char* to char[maxstrlen]
+ * form in preparation for writing it.
+ * This touches the variable's metadata and so must not be invoked
+ * concurrently.
+ *
+ * @param cache Pointer to parent cache
+ * @param entry cache entry to convert
+ *
+ * @return ::NC_NOERR No error.
+ * @author Dennis Heimbigner
+ */
+static int
+prepare_chunk(NCZChunkCache* cache, NCZCacheEntry* entry)
+{
+    int stat = NC_NOERR;
+    NC_FILE_INFO_T* file = (cache->var->container)->nc4_info;
+    nc_type tid = cache->var->type_info->hdr.id;
+    void* strchunk = NULL;
 
     if(tid == NC_STRING && !entry->isfixedstring) {
         /* Convert from char* to char[strlen] format */
@@ -674,12 +727,31 @@ put_chunk(NCZChunkCache* cache, NCZCacheEntry* entry)
         entry->size = (cache->chunkcount * (size64_t)maxstrlen);
         entry->isfixedstring = 1;
     }
+done:
+    nullfree(strchunk);
+    return THROW(stat);
+}
 
-
+/**
+ * @internal Apply the filter chain to a chunk about to be written.
+ * The filter working parameters must already have been set up if
+ * this is invoked concurrently.
+ *
+ * @param cache Pointer to parent cache
+ * @param entry cache entry to encode
+ *
+ * @return ::NC_NOERR No error.
+ * @author Dennis Heimbigner
+ */
+static int
+encode_chunk(NCZChunkCache* cache, NCZCacheEntry* entry)
+{
+    int stat = NC_NOERR;
 #ifdef NETCDF_ENABLE_NCZARR_FILTERS
     /* Make sure the entry is in filtered state */
     if(!entry->isfiltered) {
         NC_VAR_INFO_T* var = cache->var;
+        NC_FILE_INFO_T* file = (var->container)->nc4_info;
         void* filtered = NULL; /* pointer to the filtered data */
 	size_t flen; /* length of filtered data */
 	/* Get the filter chain to apply */
@@ -694,29 +766,121 @@ put_chunk(NCZChunkCache* cache, NCZCacheEntry* entry)
             entry->isfiltered = 1;
 	}
     }
+done:
+#else
+    (void)cache;
+    (void)entry;
 #endif
+    return THROW(stat);
+}
+
+/**
+ * @internal Write the raw (possibly filtered) data of a chunk.
+ * This touches only the map and the entry, so it may be invoked
+ * concurrently for distinct entries when the map allows it.
+ *
+ * @param cache Pointer to parent cache
+ * @param entry cache entry to write
+ *
+ * @return ::NC_NOERR No error.
+ * @author Dennis Heimbigner
+ */
+static int
+write_chunk(NCZChunkCache* cache, NCZCacheEntry* entry)
+{
+    int stat = NC_NOERR;
+    NC_FILE_INFO_T* file = (cache->var->container)->nc4_info;
+    NCZ_FILE_INFO_T* zfile = file->format_file_info;
+    char* path = NULL;
 
     path = NCZ_chunkpath(entry->key);
-    stat = nczmap_write(map,path,entry->size,entry->data);
-    nullfree(path); path = NULL;
+    stat = nczmap_write(zfile->map,path,entry->size,entry->data);
+    nullfree(path);
+    return THROW(stat);
+}
 
-    switch(stat) {
-    case NC_NOERR:
-	break;
-    case NC_ENOOBJECT: case NC_EEMPTY:
-    default: goto done;
+/* One encode+write task */
+typedef struct NCZStore {
+    NCZChunkCache* cache;
+    NCZCacheEntry* entry;
+} NCZStore;
+
+static int
+storetask(void* arg)
+{
+    int stat = NC_NOERR;
+    NCZStore* store = (NCZStore*)arg;
+
+    if((stat = encode_chunk(store->cache,store->entry))) goto done;
+    if((stat = write_chunk(store->cache,store->entry))) goto done;
+done:
+    return stat;
+}
+
+/**
+ * @internal Write out a set of modified entries. If the file has a
+ * worker pool, then the filter encoding and the writes of different
+ * entries are overlapped; otherwise the entries are written one
+ * at a time.
+ *
+ * @param cache Pointer to parent cache
+ * @param nentries number of entries
+ * @param entries the entries to write
+ *
+ * @return ::NC_NOERR No error.
+ * @author Dennis Heimbigner
+ */
+static int
+put_chunks(NCZChunkCache* cache, size_t nentries, NCZCacheEntry** entries)
+{
+    int stat = NC_NOERR;
+    size_t i;
+    NCthreadpool* pool = NULL;
+    NCZStore* stores = NULL;
+    NC_FILE_INFO_T* file = (cache->var->container)->nc4_info;
+
+    if(nentries == 0) goto done;
+    if(cache->shardcount > 0) {
+	stat = put_shards(cache,nentries,entries);
+	goto done;
+    }
+    if(nentries > 1) {
+        if((stat = NCZ_get_threadpool(file,&pool))) goto done;
+    }
+    if(pool == NULL) {
+	for(i=0;i<nentries;i++) {
+	    if((stat = put_chunk(cache,entries[i]))) goto done;
+	}
+	goto done;
+    }
+
+    /* Do the parts that touch shared state serially */
+    for(i=0;i<nentries;i++) {
+	if((stat = prepare_chunk(cache,entries[i]))) goto done;
+    }
+    if(FILTERED(cache)) {
+	if((stat = NCZ_filter_ensure_working(cache->var))) goto done;
+    }
+
+    if((stores = calloc(nentries,sizeof(NCZStore)))==NULL)
+	{stat = NC_ENOMEM; goto done;}
+    for(i=0;i<nentries;i++) {
+	stores[i].cache = cache;
+	stores[i].entry = entries[i];
+	if((stat = ncthreadpoolsubmit(pool,storetask,&stores[i]))) break;
     }
+    /* Always wait so no task is still referencing stores */
+    {int wstat = ncthreadpoolwait(pool); if(stat == NC_NOERR) stat = wstat;}
+
 done:
-    nullfree(strchunk);
-    nullfree(path);
-    return ZUNTRACE(stat);
+    nullfree(stores);
+    return THROW(stat);
 }
 
 /**
- * @internal Push data from memory to file.
+ * @internal Pull data from file into memory.
  *
  * @param cache Pointer to parent cache
- * @param key chunk key
  * @param entry cache entry to read into
  *
  * @return ::NC_NOERR No error.
@@ -724,83 +888,137 @@ done:
  */
 static int
 get_chunk(NCZChunkCache* cache, NCZCacheEntry* entry)
+{
+    int stat = NC_NOERR;
+    int empty = 0;
+
+    ZTRACE(5,"cache.var=%s entry.key=%s sep=%d",cache->var->hdr.name,entry->key,cache->dimension_separator);
+    
+    if((stat = read_chunk(cache,entry,&empty))) goto done;
+    /* make room in the cache */
+    if((stat = constraincache(cache,(empty?0:entry->size)))) goto done;    
+    if(!empty) {
+	if((stat = decode_chunk(cache,entry))) goto done;
+    }
+    if((stat = complete_chunk(cache,entry,empty))) goto done;
+
+done:
+    return ZUNTRACE(stat);
+}
+
+/* Can chunks be used straight from a mapping of the stored object?
+   Only unfiltered, non-string chunks of a read-only dataset are,
+   since those are never modified or replaced in the cache.
+*/
+static int
+mappable(NCZChunkCache* cache)
+{
+    NC_FILE_INFO_T* file = (cache->var->container)->nc4_info;
+    NCZ_FILE_INFO_T* zfile = file->format_file_info;
+
+    return ((zfile->controls.flags & FLAG_MMAP) != 0
+	    && file->no_write
+	    && !FILTERED(cache)
+	    && cache->var->type_info->hdr.id != NC_STRING);
+}
+
+/**
+ * @internal Read the raw (possibly filtered) data for a chunk.
+ * This touches only the map and the entry, so it may be invoked
+ * concurrently for distinct entries when the map allows it.
+ *
+ * @param cache Pointer to parent cache
+ * @param entry cache entry to read into
+ * @param emptyp set to 1 if the chunk does not exist
+ *
+ * @return ::NC_NOERR No error.
+ * @author Dennis Heimbigner
+ */
+static int
+read_chunk(NCZChunkCache* cache, NCZCacheEntry* entry, int* emptyp)
 {
     int stat = NC_NOERR;
     NCZMAP* map = NULL;
     NC_FILE_INFO_T* file = NULL;
     NCZ_FILE_INFO_T* zfile = NULL;
-    NC_TYPE_INFO_T* xtype = NULL;
-    char** strchunk = NULL;
-    size64_t size;
+    size64_t size = 0;
     int empty = 0;
     char* path = NULL;
-    int tid;
-
-    ZTRACE(5,"cache.var=%s entry.key=%s sep=%d",cache->var->hdr.name,entry->key,cache->dimension_separator);
-    
-    LOG((3, "%s: file: %p", __func__, file));
 
     file = (cache->var->container)->nc4_info;
     zfile = file->format_file_info;
     map = zfile->map;
     assert(map);
 
-    /* Collect some info */
-    xtype = cache->var->type_info;
-    tid = xtype->hdr.id;
+    LOG((3, "%s: file: %p", __func__, file));
 
-    /* get size of the "raw" data on "disk" */
     path = NCZ_chunkpath(entry->key);
-    stat = nczmap_len(map,path,&size);
-    nullfree(path); path = NULL;
+    if(entry->absent) {
+	stat = NC_EEMPTY;
+    } else if(cache->shardcount > 0) {
+	/* Read just this chunk's bytes from its shard */
+	if(entry->shard.offset == NCZ_SHARD_EMPTY)
+	    stat = NC_EEMPTY;
+	else if((entry->data = malloc((size_t)entry->shard.nbytes)) == NULL)
+	    stat = NC_ENOMEM;
+	else {
+	    size = entry->shard.nbytes;
+	    stat = nczmap_read(map,path,entry->shard.offset,size,entry->data);
+	}
+    } else if(mappable(cache)) {
+	/* Unfiltered data is used as stored, so share the page cache */
+        stat = nczmap_mapobject(map,path,&size,&entry->data,&entry->ismapped);
+    } else {
+	/* Get the "raw" data and its size with a single request */
+        stat = nczmap_readobject(map,path,&size,&entry->data);
+    }
     switch(stat) {
     case NC_NOERR: entry->size = size; break;
-    case NC_ENOOBJECT: case NC_EEMPTY: empty = 1; stat = NC_NOERR; break;
+    case NC_ENOOBJECT: case NC_EEMPTY:
+	empty = 1; stat = NC_NOERR;
+	nullfree(entry->data); entry->data = NULL;
+	break;
     default: goto done;
     }
-
-    /* make room in the cache */
-    if((stat = constraincache(cache,size))) goto done;    
-
+    /* Touching a mapping beyond the end of the object faults */
+    if(entry->ismapped && entry->size < cache->chunksize)
+	{stat = NC_ENCZARR; goto done;}
     if(!empty) {
-        /* Make sure we have a place to read it */
-        if((entry->data = (void*)calloc(1,entry->size)) == NULL)
-	    {stat = NC_ENOMEM; goto done;}
-	/* Read the raw data */
-        path = NCZ_chunkpath(entry->key);
-        stat = nczmap_read(map,path,0,entry->size,(char*)entry->data);
-        nullfree(path); path = NULL;
-        switch (stat) {
-        case NC_NOERR: break;
-        case NC_ENOOBJECT: case NC_EEMPTY: empty = 1; stat = NC_NOERR;break;
-	default: goto done;
-	}
         entry->isfiltered = (int)FILTERED(cache); /* Is the data being read filtered? */
-	if(tid == NC_STRING)
+	if(cache->var->type_info->hdr.id == NC_STRING)
 	    entry->isfixedstring = 1; /* fill cache is in char[maxstrlen] format */
     }
-    if(empty) {
-	/* fake the chunk */
-        setmodified(entry,(file->no_write?0:1));
-	entry->size = cache->chunksize;
-	entry->data = NULL;
-        entry->isfixedstring = 0;
-        entry->isfiltered = 0;
-        /* apply fill value */
-	if(cache->fillchunk == NULL)
-	    {if((stat = NCZ_ensure_fill_chunk(cache))) goto done;}
-	if((entry->data = calloc(1,entry->size))==NULL) {stat = NC_ENOMEM; goto done;}
-	if((stat = NCZ_copy_data(file,cache->var,cache->fillchunk,cache->chunkcount,ZREADING,entry->data))) goto done;
-	stat = NC_NOERR;
-    }
+    *emptyp = empty;
+
+done:
+    nullfree(path);
+    return THROW(stat);
+}
+
+/**
+ * @internal Convert the raw data of a chunk to its unfiltered
+ * form. The filter working parameters must already have been
+ * set up if this is invoked concurrently.
+ *
+ * @param cache Pointer to parent cache
+ * @param entry cache entry to convert
+ *
+ * @return ::NC_NOERR No error.
+ * @author Dennis Heimbigner
+ */
+static int
+decode_chunk(NCZChunkCache* cache, NCZCacheEntry* entry)
+{
+    int stat = NC_NOERR;
 #ifdef NETCDF_ENABLE_NCZARR_FILTERS
     /* Make sure the entry is in unfiltered state */
-    if(!empty && entry->isfiltered) {
+    if(entry->isfiltered) {
         NC_VAR_INFO_T* var = cache->var;
+        NC_FILE_INFO_T* file = (var->container)->nc4_info;
         void* unfiltered = NULL; /* pointer to the unfiltered data */
         void* filtered = NULL; /* pointer to the filtered data */
 	size_t unflen; /* length of unfiltered data */
-	assert(tid != NC_STRING || entry->isfixedstring);
+	assert(var->type_info->hdr.id != NC_STRING || entry->isfixedstring);
 	/* Get the filter chain to apply */
 	NClist* filterchain = (NClist*)var->filters;
 	if(nclistlength(filterchain) == 0) {stat = NC_EFILTER; goto done;}
@@ -813,7 +1031,48 @@ get_chunk(NCZChunkCache* cache, NCZCacheEntry* entry)
 	entry->size = unflen;
 	entry->isfiltered = 0;
     }
+done:
+#else
+    (void)cache;
+    (void)entry;
 #endif
+    return THROW(stat);
+}
+
+/**
+ * @internal Finish setting up an entry: fill a missing chunk,
+ * convert fixed strings to char*, and account for the space used.
+ * This modifies the cache and so must not be invoked concurrently.
+ *
+ * @param cache Pointer to parent cache
+ * @param entry cache entry to complete
+ * @param empty 1 if the chunk does not exist
+ *
+ * @return ::NC_NOERR No error.
+ * @author Dennis Heimbigner
+ */
+static int
+complete_chunk(NCZChunkCache* cache, NCZCacheEntry* entry, int empty)
+{
+    int stat = NC_NOERR;
+    NC_FILE_INFO_T* file = (cache->var->container)->nc4_info;
+    int tid = cache->var->type_info->hdr.id;
+    char** strchunk = NULL;
+
+    if(empty) {
+	/* fake the chunk */
+        setmodified(entry,(file->no_write?0:1));
+	entry->size = cache->chunksize;
+	entry->data = NULL;
+        entry->isfixedstring = 0;
+        entry->isfiltered = 0;
+        /* apply fill value */
+	if(cache->fillchunk == NULL)
+	    {if((stat = NCZ_ensure_fill_chunk(cache))) goto done;}
+	if((entry->data = calloc(1,entry->size))==NULL) {stat = NC_ENOMEM; goto done;}
+	if((stat = NCZ_copy_data(file,cache->var,cache->fillchunk,cache->chunkcount,ZREADING,entry->data))) goto done;
+	stat = NC_NOERR;
+    }
 
     if(tid == NC_STRING && entry->isfixedstring) {
         /* Convert from char[strlen] to char* format */
@@ -836,20 +1095,836 @@ get_chunk(NCZChunkCache* cache, NCZCacheEntry* entry)
 
 done:
     nullfree(strchunk);
-    nullfree(path);
-    return ZUNTRACE(stat);
+    return THROW(stat);
 }
 
-int
-NCZ_buildchunkpath(NCZChunkCache* cache, const size64_t* chunkindices, struct ChunkKey* key)
+/**************************************************/
+/* Shards */
+
+static void
+shard_encode_index(size64_t count, const size64_t* index, unsigned char* buf)
 {
-    int stat = NC_NOERR;
-    char* chunkname = NULL;
-    char* varkey = NULL;
+    size64_t i;
+    int b;
+    for(i=0;i<2*count;i++) {
+	size64_t v = index[i];
+	for(b=0;b<8;b++) {*buf++ = (unsigned char)(v & 0xff); v >>= 8;}
+    }
+}
 
-    assert(key != NULL);
-    /* Get the chunk object name */
-    if((stat = NCZ_buildchunkkey(cache->ndims, chunkindices, cache->dimension_separator, &chunkname))) goto done;
+static void
+shard_decode_index(size64_t count, const unsigned char* buf, size64_t* index)
+{
+    size64_t i;
+    int b;
+    for(i=0;i<2*count;i++) {
+	size64_t v = 0;
+	for(b=7;b>=0;b--) v = (v << 8) | buf[b];
+	index[i] = v;
+	buf += 8;
+    }
+}
+
+/* CRC-32C (Castagnoli), as required by the V3 crc32c codec */
+static unsigned int
+shard_crc32c(const unsigned char* buf, size64_t len)
+{
+    unsigned int crc = 0xffffffffU;
+    int b;
+    while(len-- > 0) {
+	crc ^= *buf++;
+	for(b=0;b<8;b++) crc = (crc >> 1) ^ (0x82F63B78U & (0U - (crc & 1U)));
+    }
+    return ~crc;
+}
+
+/* Total size of the encoded index of a shard */
+static size64_t
+shard_indexlen(NCZChunkCache* cache)
+{
+    return cache->shardcount*NCZ_SHARD_ENTRYLEN
+	   + ((cache->shardflags & NCZ_SHARD_INDEX_CRC32C) ? NCZ_SHARD_CRCLEN : 0);
+}
+
+static void
+shard_encode(NCZChunkCache* cache, const size64_t* index, unsigned char* buf)
+{
+    shard_encode_index(cache->shardcount,index,buf);
+    if(cache->shardflags & NCZ_SHARD_INDEX_CRC32C) {
+	size64_t len = cache->shardcount*NCZ_SHARD_ENTRYLEN;
+	unsigned int crc = shard_crc32c(buf,len);
+	size64_t b;
+	for(b=0;b<NCZ_SHARD_CRCLEN;b++) {buf[len+b] = (unsigned char)(crc & 0xff); crc >>= 8;}
+    }
+}
+
+static int
+shard_decode(NCZChunkCache* cache, const unsigned char* buf, size64_t* index)
+{
+    if(cache->shardflags & NCZ_SHARD_INDEX_CRC32C) {
+	size64_t len = cache->shardcount*NCZ_SHARD_ENTRYLEN;
+	unsigned int crc = 0;
+	size64_t b;
+	for(b=NCZ_SHARD_CRCLEN;b>0;b--) crc = (crc << 8) | buf[len+b-1];
+	if(crc != shard_crc32c(buf,len)) return NC_ENCZARR;
+    }
+    shard_decode_index(cache->shardcount,buf,index);
+    return NC_NOERR;
+}
+
+/**
+ * @internal Get the index of the shard holding a chunk, reading it
+ * from the shard object the first time. The index of a shard that
+ * does not exist yet has every chunk marked NCZ_SHARD_EMPTY.
+ * This modifies the cache and so must not be invoked concurrently.
+ *
+ * @param cache Pointer to parent cache
+ * @param entry entry whose key names the shard
+ * @param indexp return the index (owned by the cache)
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_ENCZARR Malformed shard.
+ * @author Dennis Heimbigner
+ */
+static int
+get_shard_index(NCZChunkCache* cache, NCZCacheEntry* entry, size64_t** indexp)
+{
+    int stat = NC_NOERR;
+    NC_FILE_INFO_T* file = (cache->var->container)->nc4_info;
+    NCZ_FILE_INFO_T* zfile = file->format_file_info;
+    const char* skey = entry->key.chunkkey;
+    uintptr_t data = 0;
+    size64_t* index = NULL;
+    unsigned char* buf = NULL;
+    char* path = NULL;
+    size64_t i, size = 0;
+    size64_t indexlen = shard_indexlen(cache);
+    size64_t first, last; /* where the chunks may lie */
+
+    if(NC_hashmapget(cache->shardindex,skey,strlen(skey),&data)) {
+	*indexp = (size64_t*)data;
+	goto done;
+    }
+    if((index = (size64_t*)malloc((size_t)(2*cache->shardcount)*sizeof(size64_t))) == NULL)
+	{stat = NC_ENOMEM; goto done;}
+    path = NCZ_chunkpath(entry->key);
+    switch ((stat = nczmap_len(zfile->map,path,&size))) {
+    case NC_NOERR:
+	if(size < indexlen) {stat = NC_ENCZARR; goto done;}
+	if(cache->shardflags & NCZ_SHARD_INDEX_START) {
+	    first = indexlen; last = size;
+	} else {
+	    first = 0; last = size - indexlen;
+	}
+	if((buf = (unsigned char*)malloc((size_t)indexlen)) == NULL) {stat = NC_ENOMEM; goto done;}
+	if((stat = nczmap_read(zfile->map,path,(first == 0 ? last : 0),indexlen,buf))) goto done;
+	if((stat = shard_decode(cache,buf,index))) goto done;
+	for(i=0;i<cache->shardcount;i++) {
+	    size64_t offset = index[2*i];
+	    size64_t nbytes = index[2*i+1];
+	    if(offset == NCZ_SHARD_EMPTY) continue;
+	    if(offset < first || offset > last || nbytes > last - offset)
+		{stat = NC_ENCZARR; goto done;}
+	}
+	break;
+    case NC_ENOOBJECT: case NC_EEMPTY: /* shard not written yet */
+	stat = NC_NOERR;
+	for(i=0;i<2*cache->shardcount;i++) index[i] = NCZ_SHARD_EMPTY;
+	break;
+    default: goto done;
+    }
+    if(!NC_hashmapadd(cache->shardindex,(uintptr_t)index,skey,strlen(skey))) {stat = NC_ENOMEM; goto done;}
+    *indexp = index; index = NULL;
+done:
+    nullfree(index);
+    nullfree(buf);
+    nullfree(path);
+    return THROW(stat);
+}
+
+/**
+ * @internal Find where a chunk lives in its shard. Must be done,
+ * serially, before the chunk is read.
+ *
+ * @param cache Pointer to parent cache
+ * @param entry entry with indices and key
+ *
+ * @return ::NC_NOERR No error.
+ * @author Dennis Heimbigner
+ */
+static int
+locate_chunk(NCZChunkCache* cache, NCZCacheEntry* entry)
+{
+    int stat = NC_NOERR;
+    NCZ_VAR_INFO_T* zvar = (NCZ_VAR_INFO_T*)cache->var->format_var_info;
+    size64_t* index = NULL;
+    size64_t pos = 0;
+    size_t r;
+
+    if(!cache->inventoried) {
+	if((stat = build_inventory(cache,entry))) goto done;
+    }
+    if(cache->inventory != NULL
+       && !NC_hashmapget(cache->inventory,entry->key.chunkkey,strlen(entry->key.chunkkey),NULL)) {
+	entry->absent = 1;
+	entry->shard.offset = NCZ_SHARD_EMPTY;
+	goto done;
+    }
+    if(cache->shardcount == 0) goto done;
+    /* Row-major position of the chunk within its shard */
+    for(r=0;r<cache->ndims;r++)
+	pos = (pos * zvar->shards[r]) + (entry->indices[r] % zvar->shards[r]);
+    if((stat = get_shard_index(cache,entry,&index))) goto done;
+    entry->shard.pos = pos;
+    entry->shard.offset = index[2*pos];
+    entry->shard.nbytes = index[2*pos+1];
+done:
+    return THROW(stat);
+}
+
+/* Add the keys of the objects below prefix, depth levels down,
+   to the inventory, from a single recursive listing.
+   Returns NC_ENOTBUILT if the map cannot list recursively.
+*/
+static int
+inventory_list(NCZMAP* map, NC_hashmap* inventory, const char* prefix, int depth)
+{
+    int stat = NC_NOERR;
+    NClist* keys = nclistnew();
+    size_t i;
+
+    switch (stat = nczmap_listall(map,prefix,keys)) {
+    case NC_NOERR: break;
+    case NC_ENOOBJECT: case NC_EEMPTY: stat = NC_NOERR; goto done; /* nothing stored below */
+    default: goto done;
+    }
+    for(i=0;i<nclistlength(keys);i++) {
+	const char* key = (const char*)nclistget(keys,i);
+	const char* p;
+	int nsegs = 1;
+	for(p=key;*p;p++) {if(*p == '/') nsegs++;}
+	if(nsegs != depth) continue; /* cannot be a chunk key */
+	if(!NC_hashmapadd(inventory,(uintptr_t)0,key,strlen(key))) {stat = NC_ENOMEM; goto done;}
+    }
+done:
+    nclistfreeall(keys);
+    return stat;
+}
+
+/* Add the keys of the objects below prefix, depth levels down,
+   to the inventory, searching one level at a time;
+   relative is the key of prefix relative to the variable.
+*/
+static int
+inventory_walk(NCZMAP* map, NC_hashmap* inventory, const char* prefix, const char* relative, int depth)
+{
+    int stat = NC_NOERR;
+    NClist* names = nclistnew();
+    char* path = NULL;
+    char* key = NULL;
+    size_t i;
+
+    switch (stat = nczmap_search(map,prefix,names)) {
+    case NC_NOERR: break;
+    case NC_ENOOBJECT: case NC_EEMPTY: stat = NC_NOERR; goto done; /* nothing stored below */
+    default: goto done;
+    }
+    for(i=0;i<nclistlength(names);i++) {
+	const char* name = (const char*)nclistget(names,i);
+	if(relative == NULL)
+	    key = strdup(name);
+	else if((stat = nczm_concat(relative,name,&key))) goto done;
+	if(key == NULL) {stat = NC_ENOMEM; goto done;}
+	if(depth <= 1) {
+	    if(!NC_hashmapadd(inventory,(uintptr_t)0,key,strlen(key))) {stat = NC_ENOMEM; goto done;}
+	} else if(name[0] != '.' && strcmp(name,Z3OBJECT) != 0) {
+	    /* Metadata objects have nothing below them */
+	    if((stat = nczm_concat(prefix,name,&path))) goto done;
+	    if((stat = inventory_walk(map,inventory,path,key,depth-1))) goto done;
+	    nullfree(path); path = NULL;
+	}
+	nullfree(key); key = NULL;
+    }
+done:
+    nullfree(path);
+    nullfree(key);
+    nclistfreeall(names);
+    return stat;
+}
+
+/**
+ * @internal Build the chunk inventory of a variable: the set of
+ * the keys of its stored chunk (or shard) objects, obtained by
+ * listing the variable's objects once. A chunk not in the
+ * inventory can then be filled without a request to the storage.
+ * If the map can list recursively, this is a single listing;
+ * otherwise it descends one level for each '/' in a chunk key.
+ * This is done only if asked for by mode=inventory and only for
+ * read-only datasets, whose stored chunks cannot change; if the
+ * listing fails, chunks are looked up one at a time as usual.
+ * This modifies the cache and so must not be invoked concurrently.
+ *
+ * @param cache Pointer to parent cache
+ * @param entry any entry of the variable, providing the key layout
+ *
+ * @return ::NC_NOERR No error.
+ * @author Dennis Heimbigner
+ */
+static int
+build_inventory(NCZChunkCache* cache, NCZCacheEntry* entry)
+{
+    int stat = NC_NOERR;
+    NC_FILE_INFO_T* file = (cache->var->container)->nc4_info;
+    NCZ_FILE_INFO_T* zfile = file->format_file_info;
+    NC_hashmap* inventory = NULL;
+    const char* p;
+    int depth = 1;
+
+    cache->inventoried = 1;
+    if((zfile->controls.flags & FLAG_INVENTORY) == 0 || !file->no_write) goto done;
+    for(p=entry->key.chunkkey;*p;p++) {if(*p == '/') depth++;}
+    if((inventory = NC_hashmapnew(0)) == NULL) {stat = NC_ENOMEM; goto done;}
+    stat = inventory_list(zfile->map,inventory,entry->key.varkey,depth);
+    if(stat == NC_ENOTBUILT)
+	stat = inventory_walk(zfile->map,inventory,entry->key.varkey,NULL,depth);
+    switch (stat) {
+    case NC_NOERR:
+	cache->inventory = inventory; inventory = NULL;
+	break;
+    case NC_ENOMEM: goto done;
+    default: stat = NC_NOERR; break; /* probe each chunk instead */
+    }
+done:
+    NC_hashmapfree(inventory);
+    return THROW(stat);
+}
+
+/**
+ * @internal Rewrite one shard with a set of its chunks replaced:
+ * the chunks not being replaced are carried over from the stored
+ * shard, and the whole shard is written with a single request.
+ *
+ * @param cache Pointer to parent cache
+ * @param nentries number of entries
+ * @param entries encoded entries, all in the same shard
+ *
+ * @return ::NC_NOERR No error.
+ * @author Dennis Heimbigner
+ */
+static int
+write_shard(NCZChunkCache* cache, size_t nentries, NCZCacheEntry** entries)
+{
+    int stat = NC_NOERR;
+    NC_FILE_INFO_T* file = (cache->var->container)->nc4_info;
+    NCZ_FILE_INFO_T* zfile = file->format_file_info;
+    size64_t n = cache->shardcount;
+    size64_t* index = NULL;
+    size64_t* newindex = NULL;
+    NCZCacheEntry** bypos = NULL;
+    unsigned char* old = NULL;
+    unsigned char* shard = NULL;
+    char* path = NULL;
+    size64_t pos, size, oldsize = 0;
+    size64_t indexlen = shard_indexlen(cache);
+    size64_t base = ((cache->shardflags & NCZ_SHARD_INDEX_START) ? indexlen : 0);
+    size_t i;
+    int keepold = 0;
+
+    if((stat = get_shard_index(cache,entries[0],&index))) goto done;
+    if((bypos = (NCZCacheEntry**)calloc((size_t)n,sizeof(NCZCacheEntry*))) == NULL)
+	{stat = NC_ENOMEM; goto done;}
+    if((newindex = (size64_t*)malloc((size_t)(2*n)*sizeof(size64_t))) == NULL)
+	{stat = NC_ENOMEM; goto done;}
+    for(i=0;i<nentries;i++) bypos[entries[i]->shard.pos] = entries[i];
+
+    /* Compute the new layout */
+    size = base;
+    for(pos=0;pos<n;pos++) {
+	size64_t nbytes;
+	if(bypos[pos] != NULL)
+	    nbytes = bypos[pos]->size;
+	else if(index[2*pos] != NCZ_SHARD_EMPTY) {
+	    nbytes = index[2*pos+1];
+	    keepold = 1;
+	} else {
+	    newindex[2*pos] = NCZ_SHARD_EMPTY;
+	    newindex[2*pos+1] = NCZ_SHARD_EMPTY;
+	    continue;
+	}
+	newindex[2*pos] = size;
+	newindex[2*pos+1] = nbytes;
+	size += nbytes;
+    }
+
+    path = NCZ_chunkpath(entries[0]->key);
+    if(keepold) {
+	if((stat = nczmap_readobject(zfile->map,path,&oldsize,(void**)&old))) goto done;
+    }
+    if((shard = (unsigned char*)malloc((size_t)(size + indexlen - base))) == NULL)
+	{stat = NC_ENOMEM; goto done;}
+    for(pos=0;pos<n;pos++) {
+	if(newindex[2*pos] == NCZ_SHARD_EMPTY) continue;
+	if(bypos[pos] != NULL)
+	    memcpy(shard+newindex[2*pos],bypos[pos]->data,(size_t)newindex[2*pos+1]);
+	else {
+	    if(index[2*pos] + index[2*pos+1] > oldsize) {stat = NC_ENCZARR; goto done;}
+	    memcpy(shard+newindex[2*pos],old+index[2*pos],(size_t)newindex[2*pos+1]);
+	}
+    }
+    shard_encode(cache,newindex,(base > 0 ? shard : shard+size));
+    if((stat = nczmap_write(zfile->map,path,size + indexlen - base,shard))) goto done;
+
+    /* The cached index now describes the new shard */
+    memcpy(index,newindex,(size_t)(2*n)*sizeof(size64_t));
+    for(i=0;i<nentries;i++) {
+	entries[i]->shard.offset = index[2*entries[i]->shard.pos];
+	entries[i]->shard.nbytes = index[2*entries[i]->shard.pos+1];
+    }
+done:
+    nullfree(bypos);
+    nullfree(newindex);
+    nullfree(old);
+    nullfree(shard);
+    nullfree(path);
+    return THROW(stat);
+}
+
+static int
+encodetask(void* arg)
+{
+    NCZStore* store = (NCZStore*)arg;
+    return encode_chunk(store->cache,store->entry);
+}
+
+/**
+ * @internal Write out a set of modified entries of a sharded
+ * variable. The entries are encoded (concurrently if the file has
+ * a worker pool) and then each affected shard is rewritten once.
+ *
+ * @param cache Pointer to parent cache
+ * @param nentries number of entries
+ * @param entries the entries to write
+ *
+ * @return ::NC_NOERR No error.
+ * @author Dennis Heimbigner
+ */
+static int
+put_shards(NCZChunkCache* cache, size_t nentries, NCZCacheEntry** entries)
+{
+    int stat = NC_NOERR;
+    size_t i,j,ngroup;
+    NCthreadpool* pool = NULL;
+    NCZStore* stores = NULL;
+    NCZCacheEntry** group = NULL;
+    char* written = NULL;
+    NC_FILE_INFO_T* file = (cache->var->container)->nc4_info;
+
+    for(i=0;i<nentries;i++) {
+	if((stat = prepare_chunk(cache,entries[i]))) goto done;
+    }
+    if(FILTERED(cache)) {
+	if((stat = NCZ_filter_ensure_working(cache->var))) goto done;
+    }
+    if(nentries > 1) {
+        if((stat = NCZ_get_threadpool(file,&pool))) goto done;
+    }
+    if(pool == NULL) {
+	for(i=0;i<nentries;i++) {
+	    if((stat = encode_chunk(cache,entries[i]))) goto done;
+	}
+    } else {
+	if((stores = calloc(nentries,sizeof(NCZStore)))==NULL)
+	    {stat = NC_ENOMEM; goto done;}
+	for(i=0;i<nentries;i++) {
+	    stores[i].cache = cache;
+	    stores[i].entry = entries[i];
+	    if((stat = ncthreadpoolsubmit(pool,encodetask,&stores[i]))) break;
+	}
+	/* Always wait so no task is still referencing stores */
+	{int wstat = ncthreadpoolwait(pool); if(stat == NC_NOERR) stat = wstat;}
+	if(stat) goto done;
+    }
+
+    /* Rewrite each shard once with all of its entries */
+    if((group = (NCZCacheEntry**)malloc(nentries*sizeof(NCZCacheEntry*)))==NULL)
+	{stat = NC_ENOMEM; goto done;}
+    if((written = (char*)calloc(nentries,1))==NULL)
+	{stat = NC_ENOMEM; goto done;}
+    for(i=0;i<nentries;i++) {
+	if(written[i]) continue;
+	ngroup = 0;
+	for(j=i;j<nentries;j++) {
+	    if(!written[j] && strcmp(entries[j]->key.chunkkey,entries[i]->key.chunkkey)==0) {
+		group[ngroup++] = entries[j];
+		written[j] = 1;
+	    }
+	}
+	if((stat = write_shard(cache,ngroup,group))) goto done;
+    }
+
+done:
+    nullfree(stores);
+    nullfree(group);
+    nullfree(written);
+    return THROW(stat);
+}
+
+/**************************************************/
+/* Concurrent chunk prefetch */
+
+/* One fetch+decode task */
+typedef struct NCZFetch {
+    NCZChunkCache* cache;
+    NCZCacheEntry* entry;
+    int empty;
+} NCZFetch;
+
+static int
+fetchtask(void* arg)
+{
+    int stat = NC_NOERR;
+    NCZFetch* fetch = (NCZFetch*)arg;
+
+    if((stat = read_chunk(fetch->cache,fetch->entry,&fetch->empty))) goto done;
+    if(!fetch->empty) {
+	if((stat = decode_chunk(fetch->cache,fetch->entry))) goto done;
+    }
+done:
+    return stat;
+}
+
+/**
+Load a set of chunks into the cache, reading and decoding them
+concurrently through the file's worker pool.
+Chunks already in the cache are skipped. Once all the fetches
+have finished, the entries are completed and inserted in
+the cache serially, in the order given, so later chunks are
+the most recently used.
+If the file has no worker pool then this is a no-op and the
+chunks will be read on demand by NCZ_read_cache_chunk.
+
+@param cache
+@param nchunks number of chunks
+@param chunkindices nchunks*cache->ndims chunk indices
+@return NC_EXXX error
+*/
+int
+NCZ_prefetch_cache_chunks(NCZChunkCache* cache, size_t nchunks, const size64_t* chunkindices)
+{
+    int stat = NC_NOERR;
+    size_t i,nfetch = 0;
+    NCthreadpool* pool = NULL;
+    NCZFetch* fetches = NULL;
+    NC_FILE_INFO_T* file = (cache->var->container)->nc4_info;
+    size_t rank = (size_t)cache->ndims;
+
+    ZTRACE(4,"cache.var=%s nchunks=%u",cache->var->hdr.name,(unsigned)nchunks);
+
+    if(nchunks <= 1) goto done;
+    if((stat = NCZ_get_threadpool(file,&pool))) goto done;
+    if(pool == NULL) goto done;
+
+    if((fetches = calloc(nchunks,sizeof(NCZFetch)))==NULL)
+	{stat = NC_ENOMEM; goto done;}
+
+    /* Create an entry for each chunk not already cached */
+    for(i=0;i<nchunks;i++) {
+	const size64_t* indices = &chunkindices[i*rank];
+	ncexhashkey_t hkey = ncxcachekey(indices,sizeof(size64_t)*rank);
+	void* found = NULL;
+	NCZCacheEntry* entry = NULL;
+	size_t j;
+        if(ncxcachelookup(cache->xcache,hkey,&found) == NC_NOERR) continue;
+	/* Ignore duplicates */
+	for(j=0;j<nfetch;j++) {if(fetches[j].entry->hashkey == hkey) break;}
+	if(j < nfetch) continue;
+	if((entry = calloc(1,sizeof(NCZCacheEntry)))==NULL)
+	    {stat = NC_ENOMEM; goto done;}
+	fetches[nfetch].cache = cache;
+	fetches[nfetch].entry = entry;
+	nfetch++;
+	memcpy(entry->indices,indices,rank*sizeof(size64_t));
+        if((stat = NCZ_buildchunkpath(cache,indices,&entry->key))) goto done;
+        entry->hashkey = hkey;
+	if((stat = locate_chunk(cache,entry))) goto done;
+    }
+    if(nfetch <= 1) goto done; /* nothing to overlap; leave it to the demand read */
+
+    /* Filter state must be set up before the chain is applied concurrently */
+    if(FILTERED(cache)) {
+	if((stat = NCZ_filter_ensure_working(cache->var))) goto done;
+    }
+
+    for(i=0;i<nfetch;i++) {
+	if((stat = ncthreadpoolsubmit(pool,fetchtask,&fetches[i]))) break;
+    }
+    /* Always wait so no task is still referencing fetches */
+    {int wstat = ncthreadpoolwait(pool); if(stat == NC_NOERR) stat = wstat;}
+    if(stat) goto done;
+
+    /* Complete and insert the entries */
+    for(i=0;i<nfetch;i++) {
+	NCZCacheEntry* entry = fetches[i].entry;
+	if((stat = complete_chunk(cache,entry,fetches[i].empty))) goto done;
+	fetches[i].entry = NULL;
+	if((stat = ncxcacheinsert(cache->xcache,entry->hashkey,entry))) goto done;
+	if((stat = verifycache(cache))) goto done;
+    }
+
+done:
+    if(fetches != NULL) {
+	for(i=0;i<nfetch;i++) free_cache_entry(cache,fetches[i].entry);
+	free(fetches);
+    }
+    return ZUNTRACE(stat);
+}
+
+/**************************************************/
+/* Whole chunk reads that bypass the cache */
+
+/* One direct read task */
+typedef struct NCZDirect {
+    NCZChunkCache* cache;
+    NCZCacheEntry* entry;
+    void* memory; /* where the chunk goes */
+    int empty;
+} NCZDirect;
+
+/**
+ * @internal Read the data of an unfiltered chunk straight into
+ * memory. This touches only the map, so it may be invoked
+ * concurrently for distinct chunks when the map allows it.
+ *
+ * @param cache Pointer to parent cache
+ * @param entry entry providing the chunk key
+ * @param memory where to put the chunk
+ * @param emptyp set to 1 if the chunk does not exist
+ *
+ * @return ::NC_NOERR No error.
+ * @author Dennis Heimbigner
+ */
+static int
+read_chunk_into(NCZChunkCache* cache, NCZCacheEntry* entry, void* memory, int* emptyp)
+{
+    int stat = NC_NOERR;
+    NC_FILE_INFO_T* file = (cache->var->container)->nc4_info;
+    NCZ_FILE_INFO_T* zfile = file->format_file_info;
+    char* path = NULL;
+
+    path = NCZ_chunkpath(entry->key);
+    if(entry->absent) {*emptyp = 1; goto done;}
+    if(cache->shardcount > 0) {
+	if(entry->shard.offset == NCZ_SHARD_EMPTY) {*emptyp = 1; goto done;}
+	if(entry->shard.nbytes != cache->chunksize) {stat = NC_ENCZARR; goto done;}
+	stat = nczmap_read(zfile->map,path,entry->shard.offset,entry->shard.nbytes,memory);
+	if(stat == NC_EEDGE) stat = NC_ENCZARR; /* shard shorter than its index */
+	goto done;
+    }
+    /* One request: the map reports a missing or short object */
+    switch ((stat = nczmap_read(zfile->map,path,0,cache->chunksize,memory))) {
+    case NC_NOERR: break;
+    case NC_ENOOBJECT: case NC_EEMPTY:
+	*emptyp = 1; stat = NC_NOERR;
+	break;
+    case NC_EEDGE: stat = NC_ENCZARR; break;
+    default: break;
+    }
+done:
+    nullfree(path);
+    return THROW(stat);
+}
+
+static int
+directtask(void* arg)
+{
+    int stat = NC_NOERR;
+    NCZDirect* direct = (NCZDirect*)arg;
+    NCZChunkCache* cache = direct->cache;
+    NCZCacheEntry* entry = direct->entry;
+
+    if(!FILTERED(cache)) {
+	stat = read_chunk_into(cache,entry,direct->memory,&direct->empty);
+	goto done;
+    }
+    /* The filter chain allocates its output, so decode and then copy */
+    if((stat = read_chunk(cache,entry,&direct->empty))) goto done;
+    if(direct->empty) goto done;
+    if((stat = decode_chunk(cache,entry))) goto done;
+    if(entry->size != cache->chunksize) {stat = NC_ENCZARR; goto done;}
+    memcpy(direct->memory,entry->data,(size_t)entry->size);
+done:
+    return stat;
+}
+
+/**
+Read a set of whole chunks of a fixed-size type directly into the
+caller's memory without going through a cache entry: unfiltered
+chunks are read straight into memory and filtered chunks are
+decoded and copied once. If the file has a worker pool, the
+chunks are read concurrently.
+A chunk that is already cached is copied from the cache, since
+the cached copy may be newer than the stored one. A missing chunk
+is filled as usual and is kept in the cache if the file is writable,
+so that the fill chunk is still written out.
+
+@param cache
+@param nchunks number of chunks
+@param chunkindices nchunks*cache->ndims chunk indices
+@param memory nchunks destinations, each cache->chunksize bytes
+@param retain 1 => also put the chunks in the cache
+@return NC_EXXX error
+*/
+int
+NCZ_read_cache_chunks_direct(NCZChunkCache* cache, size_t nchunks, const size64_t* chunkindices, void** memory, int retain)
+{
+    int stat = NC_NOERR;
+    size_t i,nread = 0;
+    NCthreadpool* pool = NULL;
+    NCZDirect* directs = NULL;
+    NC_FILE_INFO_T* file = (cache->var->container)->nc4_info;
+    size_t rank = (size_t)cache->ndims;
+
+    ZTRACE(4,"cache.var=%s nchunks=%u retain=%d",cache->var->hdr.name,(unsigned)nchunks,retain);
+
+    if(nchunks == 0) goto done;
+    if((directs = calloc(nchunks,sizeof(NCZDirect)))==NULL)
+	{stat = NC_ENOMEM; goto done;}
+
+    /* Serve cached chunks from the cache; create an entry for the rest */
+    for(i=0;i<nchunks;i++) {
+	const size64_t* indices = &chunkindices[i*rank];
+	ncexhashkey_t hkey = ncxcachekey(indices,sizeof(size64_t)*rank);
+	NCZCacheEntry* entry = NULL;
+        if(ncxcachelookup(cache->xcache,hkey,(void**)&entry) == NC_NOERR) {
+	    (void)ncxcachetouch(cache->xcache,hkey);
+	    memcpy(memory[i],entry->data,(size_t)cache->chunksize);
+	    continue;
+	}
+	if((entry = calloc(1,sizeof(NCZCacheEntry)))==NULL)
+	    {stat = NC_ENOMEM; goto done;}
+	directs[nread].cache = cache;
+	directs[nread].entry = entry;
+	directs[nread].memory = memory[i];
+	nread++;
+	memcpy(entry->indices,indices,rank*sizeof(size64_t));
+        if((stat = NCZ_buildchunkpath(cache,indices,&entry->key))) goto done;
+        entry->hashkey = hkey;
+	if((stat = locate_chunk(cache,entry))) goto done;
+    }
+
+    if(FILTERED(cache)) {
+	if((stat = NCZ_filter_ensure_working(cache->var))) goto done;
+    }
+    if(nread > 1) {
+        if((stat = NCZ_get_threadpool(file,&pool))) goto done;
+    }
+    if(pool == NULL) {
+	for(i=0;i<nread;i++) {
+	    if((stat = directtask(&directs[i]))) goto done;
+	}
+    } else {
+	for(i=0;i<nread;i++) {
+	    if((stat = ncthreadpoolsubmit(pool,directtask,&directs[i]))) break;
+	}
+	/* Always wait so no task is still referencing directs */
+	{int wstat = ncthreadpoolwait(pool); if(stat == NC_NOERR) stat = wstat;}
+	if(stat) goto done;
+    }
+
+    /* Fill missing chunks and decide which entries the cache keeps */
+    for(i=0;i<nread;i++) {
+	NCZCacheEntry* entry = directs[i].entry;
+	if(directs[i].empty) {
+	    if(!retain && file->no_write) {
+		if(cache->fillchunk == NULL)
+		    {if((stat = NCZ_ensure_fill_chunk(cache))) goto done;}
+		memcpy(directs[i].memory,cache->fillchunk,(size_t)cache->chunksize);
+		continue;
+	    }
+	    if((stat = complete_chunk(cache,entry,1))) goto done;
+	    memcpy(directs[i].memory,entry->data,(size_t)cache->chunksize);
+	} else if(!retain) {
+	    continue;
+	} else {
+	    if(!FILTERED(cache)) {
+	        /* So far the data only exists in memory */
+		if((entry->data = malloc((size_t)cache->chunksize))==NULL)
+		    {stat = NC_ENOMEM; goto done;}
+		memcpy(entry->data,directs[i].memory,(size_t)cache->chunksize);
+		entry->size = cache->chunksize;
+	    }
+	    if((stat = complete_chunk(cache,entry,0))) goto done;
+	}
+	directs[i].entry = NULL;
+	if((stat = ncxcacheinsert(cache->xcache,entry->hashkey,entry))) goto done;
+	if((stat = verifycache(cache))) goto done;
+    }
+
+done:
+    if(directs != NULL) {
+	for(i=0;i<nread;i++) free_cache_entry(cache,directs[i].entry);
+	free(directs);
+    }
+    return ZUNTRACE(stat);
+}
+
+/**
+Decide whether whole chunks read with NCZ_read_cache_chunks_direct
+should also be kept in the cache: only if all the chunks of the
+request fit in the cache at once, and the preemption policy does
+not ask for fully read chunks to be discarded (preemption == 1).
+@param cache
+@param nchunks number of chunks touched by the request
+@return 1 => keep the chunks; 0 => bypass the cache
+*/
+int
+NCZ_cache_retain_direct(NCZChunkCache* cache, size64_t nchunks)
+{
+    if(cache->params.preemption >= 1.0f) return 0;
+    return (nchunks <= (size64_t)NCZ_cache_prefetch_limit(cache));
+}
+
+/**
+Return the number of chunks that can be prefetched in one batch
+without the cache evicting any of them.
+@param cache
+@return batch size; <= 1 => no prefetch
+*/
+size_t
+NCZ_cache_prefetch_limit(NCZChunkCache* cache)
+{
+    size_t limit = cache->params.nelems;
+    if(cache->chunksize > 0 && cache->params.size / cache->chunksize < limit)
+        limit = (size_t)(cache->params.size / cache->chunksize);
+    return limit;
+}
+
+int
+NCZ_buildchunkpath(NCZChunkCache* cache, const size64_t* chunkindices, struct ChunkKey* key)
+{
+    int stat = NC_NOERR;
+    char* chunkname = NULL;
+    char* varkey = NULL;
+
+    assert(key != NULL);
+    /* Get the chunk object name; a sharded chunk is stored in the object of its shard */
+    if(cache->shardcount > 0) {
+	NCZ_VAR_INFO_T* zvar = (NCZ_VAR_INFO_T*)cache->var->format_var_info;
+	size64_t shardindices[NC_MAX_VAR_DIMS];
+	size_t r;
+	for(r=0;r<cache->ndims;r++) shardindices[r] = chunkindices[r] / zvar->shards[r];
+	if((stat = NCZ_buildchunkkey(cache->ndims, shardindices, cache->dimension_separator, &chunkname))) goto done;
+    } else
+    if((stat = NCZ_buildchunkkey(cache->ndims, chunkindices, cache->dimension_separator, &chunkname))) goto done;
+    /* The V3 default chunk key encoding puts all chunks under "c" */
+    if(((NCZ_VAR_INFO_T*)cache->var->format_var_info)->v3chunkkeys) {
+	size_t len = strlen(chunkname) + 3;
+	char* v3name = (char*)malloc(len);
+	if(v3name == NULL) {stat = NC_ENOMEM; goto done;}
+	snprintf(v3name,len,"c%c%s",cache->dimension_separator,chunkname);
+	nullfree(chunkname);
+	chunkname = v3name;
+    }
     /* Get the var object key */
     if((stat = NCZ_varkey(cache->var,&varkey))) goto done;
     key->varkey = varkey; varkey = NULL;
@@ -893,6 +1968,7 @@ NCZ_printxcache(NCZChunkCache* cache)
     NCbytes* buf = ncbytesnew();
     char s[8192];
     size_t i;
+    NCZCacheEntry* e = NULL;
 
     ncbytescat(buf,"NCZChunkCache:\n");
     snprintf(s,sizeof(s),"\tvar=%s\n\tndims=%u\n\tchunksize=%u\n\tchunkcount=%u\n\tfillchunk=%p\n",
@@ -912,12 +1988,11 @@ NCZ_printxcache(NCZChunkCache* cache)
 	);
     ncbytescat(buf,s);
     
-    snprintf(s,sizeof(s),"\tmru: (%u)\n",(unsigned)nclistlength(cache->mru));
+    snprintf(s,sizeof(s),"\tmru: (%u)\n",(unsigned)ncxcachecount(cache->xcache));
     ncbytescat(buf,s);
-    if(nclistlength(cache->mru)==0)    
+    if(ncxcachecount(cache->xcache)==0)    
         ncbytescat(buf,"\t\t<empty>\n");
-    for(i=0;i<nclistlength(cache->mru);i++) {
-	NCZCacheEntry* e = (NCZCacheEntry*)nclistget(cache->mru,i);
+    for(i=0,e=ncxcachefirst(cache->xcache);e != NULL;i++,e=ncxcachenext(cache->xcache,e->hashkey)) {
 	snprintf(s,sizeof(s),"\t\t[%zu] ", i);
 	ncbytescat(buf,s);
 	if(e == NULL)
@@ -116,8 +116,8 @@ NC3_inq_varid,
 NC3_rename_var,
 NC3_get_vara,
 NC3_put_vara,
-NCDEFAULT_get_vars,
-NCDEFAULT_put_vars,
+NC3_get_vars,
+NC3_put_vars,
 NCDEFAULT_get_varm,
 NCDEFAULT_put_varm,
 
@@ -171,6 +171,8 @@ NC_NOTNC4_def_var_quantize,
 NC_NOTNC4_inq_var_quantize,
 
 NC_NOOP_inq_filter_avail,
+
+NC3_get_vara_multi,
 };
 
 const NC_Dispatch* NC3_dispatch_table = NULL; /*!< NC3 Dispatch table, moved here from ddispatch.c */
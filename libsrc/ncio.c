@@ -174,6 +174,24 @@ ncio_close(ncio* const nciop, int doUnlink)
     return status;
 }
 
+/*
+Return 1 if the whole file lives in memory (diskless, in-memory
+or mmap'd), so that ncio_get of any extent is just a pointer
+into that memory and costs no copy.
+*/
+int
+ncio_resident(ncio* const nciop)
+{
+    if(fIsSet(nciop->ioflags,NC_DISKLESS)
+       || fIsSet(nciop->ioflags,NC_INMEMORY))
+        return 1;
+#  ifdef USE_MMAP
+    if(fIsSet(nciop->ioflags,NC_MMAP))
+        return 1;
+#  endif /*USE_MMAP*/
+    return 0;
+}
+
 /* URL utilities */
 
 /*
@@ -50,6 +50,7 @@ ifdef(`PNETCDF',`
 `#'include "macro.h"',`
 `#'pragma GCC diagnostic ignored "-Wdeprecated"
 `#'include "ncx.h"
+`#'include "ncx_simd.h"
 `#'include "nc3dispatch.h"')
 
 define(`IntType',  `ifdef(`PNETCDF', `MPI_Offset', `size_t')')dnl
@@ -304,11 +305,16 @@ inline static void
 swapn2b(void *dst, const void *src, IntType nn)
 {
     /* it is OK if dst == src */
-    IntType i;
+    IntType i = 0;
     char *op = (char*) dst;
     char *ip = (char*) src;
     uint16_t tmp;
-    for (i=0; i<nn; i++) {
+#ifdef NCX_SIMD
+    i = (IntType)ncx_simd_swapn2b(dst, src, (size_t)nn);
+    op += i * sizeof(uint16_t);
+    ip += i * sizeof(uint16_t);
+#endif
+    for (; i<nn; i++) {
         /* memcpy is used to handle the case of unaligned memory */
         memcpy(&tmp, ip, sizeof(tmp));
         tmp = SWAP2(tmp);
@@ -333,11 +339,16 @@ swap4b(void *dst, const void *src)
 inline static void
 swapn4b(void *dst, const void *src, IntType nn)
 {
-    IntType i;
+    IntType i = 0;
     char *op = (char*) dst;
     char *ip = (char*) src;
     uint32_t tmp;
-    for (i=0; i<nn; i++) {
+#ifdef NCX_SIMD
+    i = (IntType)ncx_simd_swapn4b(dst, src, (size_t)nn);
+    op += i * sizeof(uint32_t);
+    ip += i * sizeof(uint32_t);
+#endif
+    for (; i<nn; i++) {
         /* memcpy is used to handle the case of unaligned memory */
         memcpy(&tmp, ip, sizeof(tmp));
         tmp = SWAP4(tmp);
@@ -363,11 +374,16 @@ swap8b(void *dst, const void *src)
 inline static void
 swapn8b(void *dst, const void *src, IntType nn)
 {
-    IntType i;
+    IntType i = 0;
     char *op = (char*) dst;
     char *ip = (char*) src;
     uint64_t tmp;
-    for (i=0; i<nn; i++) {
+#ifdef NCX_SIMD
+    i = (IntType)ncx_simd_swapn8b(dst, src, (size_t)nn);
+    op += i * sizeof(uint64_t);
+    ip += i * sizeof(uint64_t);
+#endif
+    for (; i<nn; i++) {
         /* memcpy is used to handle the case of unaligned memory */
         memcpy(&tmp, ip, sizeof(tmp));
         tmp = SWAP8(tmp);
@@ -2350,6 +2366,37 @@ APIPrefix`x_pad_getn_'NC_TYPE($1)_$2(const void **xpp, IntType nelems, $2 *tp)
 ')dnl
 dnl dnl dnl
 dnl
+dnl NCX_SIMD_PREFIX(getn|putn, xtype, itype)
+dnl
+dnl Hand the leading elements to the ncx_simd.c kernel for this pair
+dnl and leave the rest (including any range error) to the scalar loop
+dnl that follows.
+dnl
+define(`NCX_SIMD_PREFIX',dnl
+`ifdef(`PNETCDF',,`dnl
+`#'if defined(NCX_SIMD) && !defined(NO_IEEE_FLOAT)
+	{
+		const IntType nv = (IntType) ncx_simd_$1_$2_$3(xp, (size_t)nelems, tp);
+		xp += nv * Xsizeof($2);
+		tp += nv;
+		nelems -= nv;
+	}
+`#'endif
+')')dnl
+dnl
+dnl NCX_SIMD_GETN(xtype, itype) and NCX_SIMD_PUTN(xtype, itype):
+dnl the pairs that have a vector kernel
+dnl
+define(`NCX_SIMD_GETN',dnl
+`ifelse(`$1$2', `floatdouble', `NCX_SIMD_PREFIX(getn, $1, $2)',
+        `$1$2', `doublefloat', `NCX_SIMD_PREFIX(getn, $1, $2)',
+        `$1$2', `shortfloat',  `NCX_SIMD_PREFIX(getn, $1, $2)',
+        `$1$2', `intfloat',    `NCX_SIMD_PREFIX(getn, $1, $2)')')dnl
+define(`NCX_SIMD_PUTN',dnl
+`ifelse(`$1$2', `doublefloat', `NCX_SIMD_PREFIX(putn, $1, $2)',
+        `$1$2', `floatdouble', `NCX_SIMD_PREFIX(putn, $1, $2)')')dnl
+dnl dnl dnl
+dnl
 dnl NCX_GETN(xtype, itype)
 dnl
 define(`NCX_GETN',dnl
@@ -2406,6 +2453,7 @@ APIPrefix`x_getn_'NC_TYPE($1)_$2(const void **xpp, IntType nelems, $2 *tp)
 #else   /* not SX */
 	const char *xp = (const char *) *xpp;
 	int status = NC_NOERR;
+NCX_SIMD_GETN($1, $2)dnl
 
 	for( ; nelems != 0; nelems--, xp += Xsizeof($1), tp++)
 	{
@@ -2615,6 +2663,7 @@ ifelse( $1$2, intfloat,dnl
 
 	char *xp = (char *) *xpp;
 	int status = NC_NOERR;
+NCX_SIMD_PUTN($1, $2)dnl
 
 	for( ; nelems != 0; nelems--, xp += Xsizeof($1), tp++)
 	{
@@ -0,0 +1,585 @@
+/*
+ *	Copyright 2018, University Corporation for Atmospheric Research
+ *	See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ */
+
+/*
+ * Vector kernels for ncx.c; see ncx_simd.h for the contract.
+ *
+ * Every kernel is written once per instruction set and selected at
+ * run time, so the library itself is still built for the baseline
+ * target: the x86 kernels carry their own target attributes and are
+ * only called after the cpu has been checked for them.
+ */
+
+#include "config.h"
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+
+#include "ncx_simd.h"
+
+#ifdef NCX_SIMD
+
+#ifdef NCX_SIMD_X86
+#include <immintrin.h>
+#endif
+#ifdef NCX_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+/* Instruction sets, in increasing order of preference */
+#define NCX_ISA_NONE 0
+#define NCX_ISA_SSE2 1
+#define NCX_ISA_AVX2 2
+#define NCX_ISA_NEON 3
+
+#define NCX_ISA_UNKNOWN (-1)
+
+static int ncx_isa = NCX_ISA_UNKNOWN;
+
+/* Pick the widest instruction set the cpu has, capped by
+   NETCDF_NCX_SIMD. Racing first callers all compute the same
+   answer, so the unsynchronized store is harmless. */
+static int
+ncx_simd_isa(void)
+{
+    int isa = ncx_isa;
+    const char* cap;
+
+    if(isa != NCX_ISA_UNKNOWN) return isa;
+    isa = NCX_ISA_NONE;
+#ifdef NCX_SIMD_X86
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2")) isa = NCX_ISA_AVX2;
+    else if(__builtin_cpu_supports("sse2")) isa = NCX_ISA_SSE2;
+#endif
+#ifdef NCX_SIMD_NEON
+    isa = NCX_ISA_NEON; /* NEON is mandatory on aarch64 */
+#endif
+    if((cap = getenv("NETCDF_NCX_SIMD")) != NULL) {
+	if(strcmp(cap,"none")==0) isa = NCX_ISA_NONE;
+	else if(strcmp(cap,"sse2")==0 && isa == NCX_ISA_AVX2) isa = NCX_ISA_SSE2;
+    }
+    ncx_isa = isa;
+    return isa;
+}
+
+/**************************************************/
+/* x86: SSE2 and AVX2 */
+
+#ifdef NCX_SIMD_X86
+
+#define NCX_SSE2 __attribute__((target("sse2")))
+#define NCX_AVX2 __attribute__((target("avx2")))
+
+/* SSE2 has no byte shuffle, so swap the 16 bit words around with
+   pshuflw/pshufhw and then the bytes within each word. */
+
+NCX_SSE2 static inline __m128i
+sse2_swap16(__m128i v)
+{
+    return _mm_or_si128(_mm_slli_epi16(v,8),_mm_srli_epi16(v,8));
+}
+
+NCX_SSE2 static inline __m128i
+sse2_swap32(__m128i v)
+{
+    v = _mm_shufflelo_epi16(v,_MM_SHUFFLE(2,3,0,1));
+    v = _mm_shufflehi_epi16(v,_MM_SHUFFLE(2,3,0,1));
+    return sse2_swap16(v);
+}
+
+NCX_SSE2 static inline __m128i
+sse2_swap64(__m128i v)
+{
+    v = _mm_shufflelo_epi16(v,_MM_SHUFFLE(0,1,2,3));
+    v = _mm_shufflehi_epi16(v,_MM_SHUFFLE(0,1,2,3));
+    return sse2_swap16(v);
+}
+
+#define SSE2_LOAD(p) _mm_loadu_si128((const __m128i*)(p))
+#define SSE2_STORE(p,v) _mm_storeu_si128((__m128i*)(p),(v))
+
+/* AVX2 swaps with vpshufb; the masks repeat per 128 bit lane */
+
+NCX_AVX2 static inline __m256i
+avx2_swap16(__m256i v)
+{
+    const __m256i m = _mm256_setr_epi8(1,0,3,2,5,4,7,6,9,8,11,10,13,12,15,14,
+				       1,0,3,2,5,4,7,6,9,8,11,10,13,12,15,14);
+    return _mm256_shuffle_epi8(v,m);
+}
+
+NCX_AVX2 static inline __m256i
+avx2_swap32(__m256i v)
+{
+    const __m256i m = _mm256_setr_epi8(3,2,1,0,7,6,5,4,11,10,9,8,15,14,13,12,
+				       3,2,1,0,7,6,5,4,11,10,9,8,15,14,13,12);
+    return _mm256_shuffle_epi8(v,m);
+}
+
+NCX_AVX2 static inline __m256i
+avx2_swap64(__m256i v)
+{
+    const __m256i m = _mm256_setr_epi8(7,6,5,4,3,2,1,0,15,14,13,12,11,10,9,8,
+				       7,6,5,4,3,2,1,0,15,14,13,12,11,10,9,8);
+    return _mm256_shuffle_epi8(v,m);
+}
+
+#define AVX2_LOAD(p) _mm256_loadu_si256((const __m256i*)(p))
+#define AVX2_STORE(p,v) _mm256_storeu_si256((__m256i*)(p),(v))
+
+NCX_SSE2 static size_t
+sse2_swapn2b(void *dst, const void *src, size_t nn)
+{
+    size_t i;
+    const char* ip = (const char*)src;
+    char* op = (char*)dst;
+    for(i=0;i+8<=nn;i+=8,ip+=16,op+=16)
+	SSE2_STORE(op,sse2_swap16(SSE2_LOAD(ip)));
+    return i;
+}
+
+NCX_SSE2 static size_t
+sse2_swapn4b(void *dst, const void *src, size_t nn)
+{
+    size_t i;
+    const char* ip = (const char*)src;
+    char* op = (char*)dst;
+    for(i=0;i+4<=nn;i+=4,ip+=16,op+=16)
+	SSE2_STORE(op,sse2_swap32(SSE2_LOAD(ip)));
+    return i;
+}
+
+NCX_SSE2 static size_t
+sse2_swapn8b(void *dst, const void *src, size_t nn)
+{
+    size_t i;
+    const char* ip = (const char*)src;
+    char* op = (char*)dst;
+    for(i=0;i+2<=nn;i+=2,ip+=16,op+=16)
+	SSE2_STORE(op,sse2_swap64(SSE2_LOAD(ip)));
+    return i;
+}
+
+NCX_SSE2 static size_t
+sse2_getn_float_double(const void *xp, size_t nelems, double *tp)
+{
+    size_t i;
+    const char* ip = (const char*)xp;
+    for(i=0;i+4<=nelems;i+=4,ip+=16,tp+=4) {
+	__m128 f = _mm_castsi128_ps(sse2_swap32(SSE2_LOAD(ip)));
+	_mm_storeu_pd(tp,_mm_cvtps_pd(f));
+	_mm_storeu_pd(tp+2,_mm_cvtps_pd(_mm_movehl_ps(f,f)));
+    }
+    return i;
+}
+
+NCX_SSE2 static size_t
+sse2_getn_double_float(const void *xp, size_t nelems, float *tp)
+{
+    size_t i;
+    const char* ip = (const char*)xp;
+    const __m128d hi = _mm_set1_pd(FLT_MAX);
+    const __m128d lo = _mm_set1_pd(-FLT_MAX);
+    for(i=0;i+4<=nelems;i+=4,ip+=32,tp+=4) {
+	__m128d a = _mm_castsi128_pd(sse2_swap64(SSE2_LOAD(ip)));
+	__m128d b = _mm_castsi128_pd(sse2_swap64(SSE2_LOAD(ip+16)));
+	__m128d bad = _mm_or_pd(_mm_or_pd(_mm_cmpgt_pd(a,hi),_mm_cmplt_pd(a,lo)),
+				_mm_or_pd(_mm_cmpgt_pd(b,hi),_mm_cmplt_pd(b,lo)));
+	if(_mm_movemask_pd(bad)) break;
+	_mm_storeu_ps(tp,_mm_movelh_ps(_mm_cvtpd_ps(a),_mm_cvtpd_ps(b)));
+    }
+    return i;
+}
+
+NCX_SSE2 static size_t
+sse2_getn_short_float(const void *xp, size_t nelems, float *tp)
+{
+    size_t i;
+    const char* ip = (const char*)xp;
+    for(i=0;i+8<=nelems;i+=8,ip+=16,tp+=8) {
+	__m128i v = sse2_swap16(SSE2_LOAD(ip));
+	/* sign extend by parking each short in the top half of an int */
+	__m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(v,v),16);
+	__m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(v,v),16);
+	_mm_storeu_ps(tp,_mm_cvtepi32_ps(lo));
+	_mm_storeu_ps(tp+4,_mm_cvtepi32_ps(hi));
+    }
+    return i;
+}
+
+NCX_SSE2 static size_t
+sse2_getn_int_float(const void *xp, size_t nelems, float *tp)
+{
+    size_t i;
+    const char* ip = (const char*)xp;
+    for(i=0;i+4<=nelems;i+=4,ip+=16,tp+=4)
+	_mm_storeu_ps(tp,_mm_cvtepi32_ps(sse2_swap32(SSE2_LOAD(ip))));
+    return i;
+}
+
+NCX_SSE2 static size_t
+sse2_putn_double_float(void *xp, size_t nelems, const float *tp)
+{
+    size_t i;
+    char* op = (char*)xp;
+    const __m128 hi = _mm_set1_ps(FLT_MAX);
+    const __m128 lo = _mm_set1_ps(-FLT_MAX);
+    for(i=0;i+4<=nelems;i+=4,op+=32,tp+=4) {
+	__m128 f = _mm_loadu_ps(tp);
+	/* infinities are range errors too */
+	if(_mm_movemask_ps(_mm_or_ps(_mm_cmpgt_ps(f,hi),_mm_cmplt_ps(f,lo)))) break;
+	SSE2_STORE(op,sse2_swap64(_mm_castpd_si128(_mm_cvtps_pd(f))));
+	SSE2_STORE(op+16,sse2_swap64(_mm_castpd_si128(_mm_cvtps_pd(_mm_movehl_ps(f,f)))));
+    }
+    return i;
+}
+
+NCX_SSE2 static size_t
+sse2_putn_float_double(void *xp, size_t nelems, const double *tp)
+{
+    size_t i;
+    char* op = (char*)xp;
+    const __m128d hi = _mm_set1_pd(FLT_MAX);
+    const __m128d lo = _mm_set1_pd(-FLT_MAX);
+    for(i=0;i+4<=nelems;i+=4,op+=16,tp+=4) {
+	__m128d a = _mm_loadu_pd(tp);
+	__m128d b = _mm_loadu_pd(tp+2);
+	__m128d bad = _mm_or_pd(_mm_or_pd(_mm_cmpgt_pd(a,hi),_mm_cmplt_pd(a,lo)),
+				_mm_or_pd(_mm_cmpgt_pd(b,hi),_mm_cmplt_pd(b,lo)));
+	if(_mm_movemask_pd(bad)) break;
+	SSE2_STORE(op,sse2_swap32(_mm_castps_si128(_mm_movelh_ps(_mm_cvtpd_ps(a),_mm_cvtpd_ps(b)))));
+    }
+    return i;
+}
+
+NCX_AVX2 static size_t
+avx2_swapn2b(void *dst, const void *src, size_t nn)
+{
+    size_t i;
+    const char* ip = (const char*)src;
+    char* op = (char*)dst;
+    for(i=0;i+16<=nn;i+=16,ip+=32,op+=32)
+	AVX2_STORE(op,avx2_swap16(AVX2_LOAD(ip)));
+    return i;
+}
+
+NCX_AVX2 static size_t
+avx2_swapn4b(void *dst, const void *src, size_t nn)
+{
+    size_t i;
+    const char* ip = (const char*)src;
+    char* op = (char*)dst;
+    for(i=0;i+8<=nn;i+=8,ip+=32,op+=32)
+	AVX2_STORE(op,avx2_swap32(AVX2_LOAD(ip)));
+    return i;
+}
+
+NCX_AVX2 static size_t
+avx2_swapn8b(void *dst, const void *src, size_t nn)
+{
+    size_t i;
+    const char* ip = (const char*)src;
+    char* op = (char*)dst;
+    for(i=0;i+4<=nn;i+=4,ip+=32,op+=32)
+	AVX2_STORE(op,avx2_swap64(AVX2_LOAD(ip)));
+    return i;
+}
+
+NCX_AVX2 static size_t
+avx2_getn_float_double(const void *xp, size_t nelems, double *tp)
+{
+    size_t i;
+    const char* ip = (const char*)xp;
+    for(i=0;i+8<=nelems;i+=8,ip+=32,tp+=8) {
+	__m256 f = _mm256_castsi256_ps(avx2_swap32(AVX2_LOAD(ip)));
+	_mm256_storeu_pd(tp,_mm256_cvtps_pd(_mm256_castps256_ps128(f)));
+	_mm256_storeu_pd(tp+4,_mm256_cvtps_pd(_mm256_extractf128_ps(f,1)));
+    }
+    return i;
+}
+
+NCX_AVX2 static size_t
+avx2_getn_double_float(const void *xp, size_t nelems, float *tp)
+{
+    size_t i;
+    const char* ip = (const char*)xp;
+    const __m256d hi = _mm256_set1_pd(FLT_MAX);
+    const __m256d lo = _mm256_set1_pd(-FLT_MAX);
+    for(i=0;i+8<=nelems;i+=8,ip+=64,tp+=8) {
+	__m256d a = _mm256_castsi256_pd(avx2_swap64(AVX2_LOAD(ip)));
+	__m256d b = _mm256_castsi256_pd(avx2_swap64(AVX2_LOAD(ip+32)));
+	__m256d bad = _mm256_or_pd(
+	    _mm256_or_pd(_mm256_cmp_pd(a,hi,_CMP_GT_OQ),_mm256_cmp_pd(a,lo,_CMP_LT_OQ)),
+	    _mm256_or_pd(_mm256_cmp_pd(b,hi,_CMP_GT_OQ),_mm256_cmp_pd(b,lo,_CMP_LT_OQ)));
+	if(_mm256_movemask_pd(bad)) break;
+	_mm_storeu_ps(tp,_mm256_cvtpd_ps(a));
+	_mm_storeu_ps(tp+4,_mm256_cvtpd_ps(b));
+    }
+    return i;
+}
+
+NCX_AVX2 static size_t
+avx2_getn_short_float(const void *xp, size_t nelems, float *tp)
+{
+    size_t i;
+    const char* ip = (const char*)xp;
+    for(i=0;i+16<=nelems;i+=16,ip+=32,tp+=16) {
+	__m256i v = avx2_swap16(AVX2_LOAD(ip));
+	__m256i lo = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(v));
+	__m256i hi = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(v,1));
+	_mm256_storeu_ps(tp,_mm256_cvtepi32_ps(lo));
+	_mm256_storeu_ps(tp+8,_mm256_cvtepi32_ps(hi));
+    }
+    return i;
+}
+
+NCX_AVX2 static size_t
+avx2_getn_int_float(const void *xp, size_t nelems, float *tp)
+{
+    size_t i;
+    const char* ip = (const char*)xp;
+    for(i=0;i+8<=nelems;i+=8,ip+=32,tp+=8)
+	_mm256_storeu_ps(tp,_mm256_cvtepi32_ps(avx2_swap32(AVX2_LOAD(ip))));
+    return i;
+}
+
+NCX_AVX2 static size_t
+avx2_putn_double_float(void *xp, size_t nelems, const float *tp)
+{
+    size_t i;
+    char* op = (char*)xp;
+    const __m256 hi = _mm256_set1_ps(FLT_MAX);
+    const __m256 lo = _mm256_set1_ps(-FLT_MAX);
+    for(i=0;i+8<=nelems;i+=8,op+=64,tp+=8) {
+	__m256 f = _mm256_loadu_ps(tp);
+	/* infinities are range errors too */
+	if(_mm256_movemask_ps(_mm256_or_ps(_mm256_cmp_ps(f,hi,_CMP_GT_OQ),_mm256_cmp_ps(f,lo,_CMP_LT_OQ)))) break;
+	AVX2_STORE(op,avx2_swap64(_mm256_castpd_si256(_mm256_cvtps_pd(_mm256_castps256_ps128(f)))));
+	AVX2_STORE(op+32,avx2_swap64(_mm256_castpd_si256(_mm256_cvtps_pd(_mm256_extractf128_ps(f,1)))));
+    }
+    return i;
+}
+
+NCX_AVX2 static size_t
+avx2_putn_float_double(void *xp, size_t nelems, const double *tp)
+{
+    size_t i;
+    char* op = (char*)xp;
+    const __m256d hi = _mm256_set1_pd(FLT_MAX);
+    const __m256d lo = _mm256_set1_pd(-FLT_MAX);
+    for(i=0;i+8<=nelems;i+=8,op+=32,tp+=8) {
+	__m256d a = _mm256_loadu_pd(tp);
+	__m256d b = _mm256_loadu_pd(tp+4);
+	__m256d bad = _mm256_or_pd(
+	    _mm256_or_pd(_mm256_cmp_pd(a,hi,_CMP_GT_OQ),_mm256_cmp_pd(a,lo,_CMP_LT_OQ)),
+	    _mm256_or_pd(_mm256_cmp_pd(b,hi,_CMP_GT_OQ),_mm256_cmp_pd(b,lo,_CMP_LT_OQ)));
+	if(_mm256_movemask_pd(bad)) break;
+	AVX2_STORE(op,avx2_swap32(_mm256_castps_si256(
+	    _mm256_set_m128(_mm256_cvtpd_ps(b),_mm256_cvtpd_ps(a)))));
+    }
+    return i;
+}
+
+#endif /*NCX_SIMD_X86*/
+
+/**************************************************/
+/* aarch64: NEON */
+
+#ifdef NCX_SIMD_NEON
+
+#define NEON_LOAD(p) vld1q_u8((const uint8_t*)(p))
+#define NEON_STORE(p,v) vst1q_u8((uint8_t*)(p),(v))
+
+static size_t
+neon_swapn2b(void *dst, const void *src, size_t nn)
+{
+    size_t i;
+    const char* ip = (const char*)src;
+    char* op = (char*)dst;
+    for(i=0;i+8<=nn;i+=8,ip+=16,op+=16)
+	NEON_STORE(op,vrev16q_u8(NEON_LOAD(ip)));
+    return i;
+}
+
+static size_t
+neon_swapn4b(void *dst, const void *src, size_t nn)
+{
+    size_t i;
+    const char* ip = (const char*)src;
+    char* op = (char*)dst;
+    for(i=0;i+4<=nn;i+=4,ip+=16,op+=16)
+	NEON_STORE(op,vrev32q_u8(NEON_LOAD(ip)));
+    return i;
+}
+
+static size_t
+neon_swapn8b(void *dst, const void *src, size_t nn)
+{
+    size_t i;
+    const char* ip = (const char*)src;
+    char* op = (char*)dst;
+    for(i=0;i+2<=nn;i+=2,ip+=16,op+=16)
+	NEON_STORE(op,vrev64q_u8(NEON_LOAD(ip)));
+    return i;
+}
+
+static size_t
+neon_getn_float_double(const void *xp, size_t nelems, double *tp)
+{
+    size_t i;
+    const char* ip = (const char*)xp;
+    for(i=0;i+4<=nelems;i+=4,ip+=16,tp+=4) {
+	float32x4_t f = vreinterpretq_f32_u8(vrev32q_u8(NEON_LOAD(ip)));
+	vst1q_f64(tp,vcvt_f64_f32(vget_low_f32(f)));
+	vst1q_f64(tp+2,vcvt_high_f64_f32(f));
+    }
+    return i;
+}
+
+static size_t
+neon_getn_double_float(const void *xp, size_t nelems, float *tp)
+{
+    size_t i;
+    const char* ip = (const char*)xp;
+    const float64x2_t max = vdupq_n_f64(FLT_MAX);
+    for(i=0;i+4<=nelems;i+=4,ip+=32,tp+=4) {
+	float64x2_t a = vreinterpretq_f64_u8(vrev64q_u8(NEON_LOAD(ip)));
+	float64x2_t b = vreinterpretq_f64_u8(vrev64q_u8(NEON_LOAD(ip+16)));
+	/* |x| > FLT_MAX; false for NaN, like the scalar tests */
+	uint64x2_t bad = vorrq_u64(vcagtq_f64(a,max),vcagtq_f64(b,max));
+	if(vmaxvq_u32(vreinterpretq_u32_u64(bad))) break;
+	vst1q_f32(tp,vcvt_high_f32_f64(vcvt_f32_f64(a),b));
+    }
+    return i;
+}
+
+static size_t
+neon_getn_short_float(const void *xp, size_t nelems, float *tp)
+{
+    size_t i;
+    const char* ip = (const char*)xp;
+    for(i=0;i+8<=nelems;i+=8,ip+=16,tp+=8) {
+	int16x8_t v = vreinterpretq_s16_u8(vrev16q_u8(NEON_LOAD(ip)));
+	vst1q_f32(tp,vcvtq_f32_s32(vmovl_s16(vget_low_s16(v))));
+	vst1q_f32(tp+4,vcvtq_f32_s32(vmovl_high_s16(v)));
+    }
+    return i;
+}
+
+static size_t
+neon_getn_int_float(const void *xp, size_t nelems, float *tp)
+{
+    size_t i;
+    const char* ip = (const char*)xp;
+    for(i=0;i+4<=nelems;i+=4,ip+=16,tp+=4)
+	vst1q_f32(tp,vcvtq_f32_s32(vreinterpretq_s32_u8(vrev32q_u8(NEON_LOAD(ip)))));
+    return i;
+}
+
+static size_t
+neon_putn_double_float(void *xp, size_t nelems, const float *tp)
+{
+    size_t i;
+    char* op = (char*)xp;
+    const float32x4_t max = vdupq_n_f32(FLT_MAX);
+    for(i=0;i+4<=nelems;i+=4,op+=32,tp+=4) {
+	float32x4_t f = vld1q_f32(tp);
+	/* infinities are range errors too */
+	if(vmaxvq_u32(vcagtq_f32(f,max))) break;
+	NEON_STORE(op,vrev64q_u8(vreinterpretq_u8_f64(vcvt_f64_f32(vget_low_f32(f)))));
+	NEON_STORE(op+16,vrev64q_u8(vreinterpretq_u8_f64(vcvt_high_f64_f32(f))));
+    }
+    return i;
+}
+
+static size_t
+neon_putn_float_double(void *xp, size_t nelems, const double *tp)
+{
+    size_t i;
+    char* op = (char*)xp;
+    const float64x2_t max = vdupq_n_f64(FLT_MAX);
+    for(i=0;i+4<=nelems;i+=4,op+=16,tp+=4) {
+	float64x2_t a = vld1q_f64(tp);
+	float64x2_t b = vld1q_f64(tp+2);
+	uint64x2_t bad = vorrq_u64(vcagtq_f64(a,max),vcagtq_f64(b,max));
+	if(vmaxvq_u32(vreinterpretq_u32_u64(bad))) break;
+	NEON_STORE(op,vrev32q_u8(vreinterpretq_u8_f32(vcvt_high_f32_f64(vcvt_f32_f64(a),b))));
+    }
+    return i;
+}
+
+#endif /*NCX_SIMD_NEON*/
+
+/**************************************************/
+/* Dispatch */
+
+#ifdef NCX_SIMD_X86
+#define NCX_DISPATCH(name,args) \
+    switch (ncx_simd_isa()) { \
+    case NCX_ISA_AVX2: return avx2_##name args; \
+    case NCX_ISA_SSE2: return sse2_##name args; \
+    default: return 0; \
+    }
+#else
+#define NCX_DISPATCH(name,args) \
+    return (ncx_simd_isa() == NCX_ISA_NEON ? neon_##name args : 0);
+#endif
+
+size_t
+ncx_simd_swapn2b(void *dst, const void *src, size_t nn)
+{
+    NCX_DISPATCH(swapn2b,(dst,src,nn))
+}
+
+size_t
+ncx_simd_swapn4b(void *dst, const void *src, size_t nn)
+{
+    NCX_DISPATCH(swapn4b,(dst,src,nn))
+}
+
+size_t
+ncx_simd_swapn8b(void *dst, const void *src, size_t nn)
+{
+    NCX_DISPATCH(swapn8b,(dst,src,nn))
+}
+
+size_t
+ncx_simd_getn_float_double(const void *xp, size_t nelems, double *tp)
+{
+    NCX_DISPATCH(getn_float_double,(xp,nelems,tp))
+}
+
+size_t
+ncx_simd_getn_double_float(const void *xp, size_t nelems, float *tp)
+{
+    NCX_DISPATCH(getn_double_float,(xp,nelems,tp))
+}
+
+size_t
+ncx_simd_getn_short_float(const void *xp, size_t nelems, float *tp)
+{
+    NCX_DISPATCH(getn_short_float,(xp,nelems,tp))
+}
+
+size_t
+ncx_simd_getn_int_float(const void *xp, size_t nelems, float *tp)
+{
+    NCX_DISPATCH(getn_int_float,(xp,nelems,tp))
+}
+
+size_t
+ncx_simd_putn_double_float(void *xp, size_t nelems, const float *tp)
+{
+    NCX_DISPATCH(putn_double_float,(xp,nelems,tp))
+}
+
+size_t
+ncx_simd_putn_float_double(void *xp, size_t nelems, const double *tp)
+{
+    NCX_DISPATCH(putn_float_double,(xp,nelems,tp))
+}
+
+#endif /*NCX_SIMD*/
@@ -0,0 +1,68 @@
+/*
+ *	Copyright 2018, University Corporation for Atmospheric Research
+ *	See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ */
+
+#ifndef _NCX_SIMD_H_
+#define _NCX_SIMD_H_
+
+#include <stddef.h>	/* size_t */
+
+/*
+ * Vector kernels for the hottest ncx conversions.
+ *
+ * The external representation is big endian, so on little endian
+ * hosts every same-type copy is a byte swap and every widening
+ * conversion is a byte swap followed by a convert. The generic
+ * ncx_getn/ncx_putn loops do that one element at a time; the kernels
+ * below do it a vector at a time.
+ *
+ * Each kernel converts a prefix of the nelems elements it is given
+ * and returns the length of that prefix, which may be zero. The
+ * caller converts the remainder with the scalar code, so a kernel
+ * never has to deal with a ragged tail, unaligned leftovers or a
+ * range error: the narrowing kernels simply stop in front of the
+ * first vector holding a value that does not fit and leave the
+ * error (and ERANGE_FILL) handling to the scalar path.
+ *
+ * The instruction set is chosen once, at the first call: AVX2 or
+ * SSE2 on x86 and NEON on aarch64. Setting the environment variable
+ * NETCDF_NCX_SIMD to "none", "sse2", "avx2" or "neon" caps that
+ * choice, which is mostly useful for testing and benchmarking the
+ * fallbacks on a machine that has the wider units.
+ *
+ * The NEON kernels have not yet been built or run on aarch64, so they
+ * are only compiled in when NCX_SIMD_ENABLE_NEON is defined (e.g. in
+ * CFLAGS); run nc_test/tst_ncxconv before relying on them.
+ */
+
+#if !defined(WORDS_BIGENDIAN) && !defined(NCX_NO_SIMD)
+# if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#  define NCX_SIMD 1
+#  define NCX_SIMD_X86 1
+# elif defined(__aarch64__) && defined(__ARM_NEON) && defined(NCX_SIMD_ENABLE_NEON)
+#  define NCX_SIMD 1
+#  define NCX_SIMD_NEON 1
+# endif
+#endif
+
+#ifdef NCX_SIMD
+
+/* Byte swap nn 2, 4 or 8 byte items; dst == src is fine */
+extern size_t ncx_simd_swapn2b(void *dst, const void *src, size_t nn);
+extern size_t ncx_simd_swapn4b(void *dst, const void *src, size_t nn);
+extern size_t ncx_simd_swapn8b(void *dst, const void *src, size_t nn);
+
+/* External (big endian) xtype to internal itype */
+extern size_t ncx_simd_getn_float_double(const void *xp, size_t nelems, double *tp);
+extern size_t ncx_simd_getn_double_float(const void *xp, size_t nelems, float *tp);
+extern size_t ncx_simd_getn_short_float(const void *xp, size_t nelems, float *tp);
+extern size_t ncx_simd_getn_int_float(const void *xp, size_t nelems, float *tp);
+
+/* Internal itype to external (big endian) xtype */
+extern size_t ncx_simd_putn_double_float(void *xp, size_t nelems, const float *tp);
+extern size_t ncx_simd_putn_float_double(void *xp, size_t nelems, const double *tp);
+
+#endif /* NCX_SIMD */
+
+#endif /* _NCX_SIMD_H_ */
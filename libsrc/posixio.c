@@ -42,6 +42,12 @@
 #define NC_NOERR 0
 #endif
 
+/* Read-ahead needs a thread to do the reading */
+#if defined(HAVE_PTHREAD_H) && !defined(_WIN32)
+#define PX_READAHEAD 1
+#include <pthread.h>
+#endif
+
 #ifndef SEEK_SET
 #define SEEK_SET 0
 #define SEEK_CUR 1
@@ -49,6 +55,8 @@
 #endif
 
 #include "ncpathmgr.h"
+#include "ncuri.h"
+#include "ncrc.h"
 #include "ncio.h"
 #include "fbits.h"
 #include "rnd.h"
@@ -399,6 +407,62 @@ px_pgin(ncio *const nciop,
     return NC_NOERR;
 }
 
+#ifdef PX_READAHEAD
+/* Read-ahead for sequential scans of files opened read-only.
+
+   When NETCDF.READAHEAD is set in the .rc database to a number of
+   extents, the file gets a window of that many buffers of
+   NETCDF.READAHEAD.SIZE bytes (rounded up to a multiple of the block
+   size), and a thread that fills them. Each time px_get() pages in
+   data at the offset where the previous page-in ended, or from the
+   window itself, the window is moved up to start at the extent
+   holding the end of that page-in and the extents in it that are not
+   yet buffered are queued for the thread. Page-ins are then copied
+   out of the window when they can be, so reading the next part of
+   the file overlaps with whatever the caller is doing with this one.
+
+   Any other page-in is read directly, as without read-ahead, and
+   cancels the queued extents that have not been started.
+
+   Extents are aligned to their size, so an extent is found from an
+   offset. Only extents that start below the file size at open (or at
+   the last sync) are queued, and a page-in that is not all in the
+   window reads the rest directly, so a file that grows after open is
+   still read correctly.
+*/
+
+#ifndef PX_READAHEAD_SIZE
+#define PX_READAHEAD_SIZE 1048576 /* default NETCDF.READAHEAD.SIZE */
+#endif
+
+#define RA_FREE 0	/* unused */
+#define RA_QUEUED 1	/* waiting for the thread */
+#define RA_BUSY 2	/* being read by the thread */
+#define RA_READY 3	/* holds data (or an error) */
+
+typedef struct px_raslot {
+	off_t offset;	/* file offset of the extent */
+	size_t cnt;	/* bytes read, short at EOF */
+	int state;	/* RA_* */
+	int status;	/* error from the read */
+	void *base;
+} px_raslot;
+
+typedef struct px_readahead {
+	size_t nslots;
+	size_t extent;	/* bytes per slot */
+	px_raslot *slots;
+	off_t filesize;	/* extents past this are not queued */
+	off_t expect;	/* where a sequential page-in would start */
+	int shutdown;
+	pthread_mutex_t lock;
+	pthread_cond_t work;	/* signalled when a slot is queued or on shutdown */
+	pthread_cond_t ready;	/* signalled when a slot is read */
+	pthread_t thread;
+	int fd;
+} px_readahead;
+#endif /*PX_READAHEAD*/
+
 /* This struct is for POSIX systems, with NC_SHARE not in effect. If
    NC_SHARE is used, see ncio_spx.
 
@@ -413,6 +477,7 @@ px_pgin(ncio *const nciop,
    of data in the buffer.
    bf_refcount - buffer reference count.
    slave - used in moves.
+   ra - read-ahead window, or NULL.
 */
 typedef struct ncio_px {
 	size_t blksz;
@@ -426,6 +491,9 @@ typedef struct ncio_px {
 	int	bf_refcount;
 	/* chain for double buffering in px_move */
 	struct ncio_px *slave;
+#ifdef PX_READAHEAD
+	struct px_readahead *ra;
+#endif
 } ncio_px;
 
 
@@ -489,6 +557,303 @@ ncio_px_rel(ncio *const nciop, off_t offset, int rflags)
 	return px_rel(pxp, offset, rflags);
 }
 
+#ifdef PX_READAHEAD
+/* The read-ahead thread: read queued extents, lowest offset first */
+static void *
+px_ra_worker(void *arg)
+{
+	px_readahead *const ra = (px_readahead *)arg;
+
+	pthread_mutex_lock(&ra->lock);
+	while(!ra->shutdown)
+	{
+		px_raslot *slot = NULL;
+		size_t ii, cnt = 0;
+		int status = NC_NOERR;
+
+		for(ii = 0; ii < ra->nslots; ii++)
+		{
+			px_raslot *const sp = &ra->slots[ii];
+			if(sp->state == RA_QUEUED
+				 && (slot == NULL || sp->offset < slot->offset))
+				slot = sp;
+		}
+		if(slot == NULL)
+		{
+			pthread_cond_wait(&ra->work, &ra->lock);
+			continue;
+		}
+		slot->state = RA_BUSY;
+		pthread_mutex_unlock(&ra->lock);
+
+		while(cnt < ra->extent)
+		{
+			const ssize_t nread = pread(ra->fd,
+				(char *)slot->base + cnt, ra->extent - cnt,
+				slot->offset + (off_t)cnt);
+			if(nread == -1 && errno == EINTR)
+				continue;
+			if(nread == -1)
+			{
+				status = errno;
+				break;
+			}
+			if(nread == 0)
+				break; /* EOF */
+			cnt += (size_t)nread;
+		}
+
+		pthread_mutex_lock(&ra->lock);
+		slot->cnt = cnt;
+		slot->status = status;
+		slot->state = RA_READY;
+		pthread_cond_broadcast(&ra->ready);
+	}
+	pthread_mutex_unlock(&ra->lock);
+	return NULL;
+}
+
+/* Find the slot for the extent at offset. Called with the lock held. */
+static px_raslot *
+px_ra_slot(px_readahead *const ra, off_t offset)
+{
+	size_t ii;
+	for(ii = 0; ii < ra->nslots; ii++)
+	{
+		if(ra->slots[ii].state != RA_FREE && ra->slots[ii].offset == offset)
+			return &ra->slots[ii];
+	}
+	return NULL;
+}
+
+/* Move the window up to start at the extent holding offset, and queue
+   the extents in it that are not buffered. Called with the lock held.
+*/
+static void
+px_ra_queue(px_readahead *const ra, off_t offset)
+{
+	const off_t lo = _RNDDOWN(offset, (off_t)ra->extent);
+	const off_t hi = lo + (off_t)(ra->nslots * ra->extent);
+	off_t off;
+	int queued = 0;
+
+	for(off = lo; off < hi && off < ra->filesize; off += (off_t)ra->extent)
+	{
+		px_raslot *slot = NULL;
+		size_t ii;
+
+		if(px_ra_slot(ra, off) != NULL)
+			continue;
+		/* reuse a slot that is not in the window */
+		for(ii = 0; ii < ra->nslots; ii++)
+		{
+			px_raslot *const sp = &ra->slots[ii];
+			if(sp->state == RA_FREE
+				 || (sp->state != RA_BUSY
+					 && (sp->offset < lo || sp->offset >= hi)))
+			{
+				slot = sp;
+				break;
+			}
+		}
+		if(slot == NULL)
+			break;
+		slot->offset = off;
+		slot->cnt = 0;
+		slot->status = NC_NOERR;
+		slot->state = RA_QUEUED;
+		queued = 1;
+	}
+	if(queued)
+		pthread_cond_signal(&ra->work);
+}
+
+/* px_pgin() by way of the read-ahead window */
+static int
+px_ra_pgin(ncio *const nciop, ncio_px *const pxp,
+	off_t const offset, const size_t extent,
+	void *const vp, size_t *nreadp, off_t *posp)
+{
+	px_readahead *const ra = pxp->ra;
+	size_t have = 0; /* bytes copied out of the window */
+	size_t ii;
+
+	if(ra == NULL)
+		return px_pgin(nciop, offset, extent, vp, nreadp, posp);
+
+	pthread_mutex_lock(&ra->lock);
+	while(have < extent)
+	{
+		const off_t at = offset + (off_t)have;
+		const off_t base = _RNDDOWN(at, (off_t)ra->extent);
+		px_raslot *const slot = px_ra_slot(ra, base);
+		size_t skip, nn;
+
+		if(slot == NULL)
+			break;
+		while(slot->state != RA_READY)
+			pthread_cond_wait(&ra->ready, &ra->lock);
+		skip = (size_t)(at - base);
+		if(slot->status != NC_NOERR || skip >= slot->cnt)
+		{
+			/* leave the error or EOF to px_pgin() */
+			slot->state = RA_FREE;
+			break;
+		}
+		nn = MIN(extent - have, slot->cnt - skip);
+		(void) memcpy((char *)vp + have, (char *)slot->base + skip, nn);
+		have += nn;
+		if(skip + nn == ra->extent)
+			slot->state = RA_FREE; /* used up */
+	}
+	if(have > 0 || offset == ra->expect)
+		px_ra_queue(ra, offset + (off_t)extent);
+	else
+	{
+		/* not sequential, stop reading ahead */
+		for(ii = 0; ii < ra->nslots; ii++)
+		{
+			if(ra->slots[ii].state == RA_QUEUED)
+				ra->slots[ii].state = RA_FREE;
+		}
+	}
+	ra->expect = offset + (off_t)extent;
+	pthread_mutex_unlock(&ra->lock);
+
+	if(have < extent)
+	{
+		size_t nread = 0;
+		const int status = px_pgin(nciop,
+			 offset + (off_t)have,
+			 extent - have,
+			 (char *)vp + have,
+			 &nread,
+			 posp);
+		if(status != NC_NOERR)
+			return status;
+		have += nread;
+	}
+	*nreadp = have;
+	return NC_NOERR;
+}
+
+/* Empty the window, so that the next page-in reads the file. */
+static void
+px_ra_reset(ncio *const nciop, px_readahead *const ra)
+{
+	size_t ii;
+	off_t filesize;
+
+	pthread_mutex_lock(&ra->lock);
+	for(ii = 0; ii < ra->nslots; ii++)
+	{
+		while(ra->slots[ii].state == RA_BUSY)
+			pthread_cond_wait(&ra->ready, &ra->lock);
+		ra->slots[ii].state = RA_FREE;
+	}
+	ra->expect = OFF_NONE;
+	if(ncio_px_filesize(nciop, &filesize) == NC_NOERR)
+		ra->filesize = filesize;
+	pthread_mutex_unlock(&ra->lock);
+}
+
+/* Stop the read-ahead thread and reclaim the window */
+static void
+px_ra_free(ncio_px *const pxp)
+{
+	px_readahead *const ra = pxp->ra;
+	size_t ii;
+
+	if(ra == NULL)
+		return;
+	pthread_mutex_lock(&ra->lock);
+	ra->shutdown = 1;
+	pthread_cond_broadcast(&ra->work);
+	pthread_mutex_unlock(&ra->lock);
+	(void) pthread_join(ra->thread, NULL);
+
+	pthread_cond_destroy(&ra->ready);
+	pthread_cond_destroy(&ra->work);
+	pthread_mutex_destroy(&ra->lock);
+	for(ii = 0; ii < ra->nslots; ii++)
+		free(ra->slots[ii].base);
+	free(ra->slots);
+	free(ra);
+	pxp->ra = NULL;
+}
+
+/* Set up read-ahead as asked for by NETCDF.READAHEAD and
+   NETCDF.READAHEAD.SIZE. Read-ahead is only an optimization, so if
+   it cannot be set up the file is simply read without it.
+*/
+static void
+px_ra_init(ncio *const nciop, ncio_px *const pxp)
+{
+	const char *value;
+	size_t nslots = 0, size = PX_READAHEAD_SIZE, ii;
+	off_t filesize;
+	px_readahead *ra = NULL;
+
+	if((value = NC_rclookup("NETCDF.READAHEAD", NULL, NULL)) != NULL)
+	{
+		long n = strtol(value, NULL, 10);
+		if(n > 0) nslots = (size_t)n;
+	}
+	if(nslots == 0)
+		return;
+	if((value = NC_rclookup("NETCDF.READAHEAD.SIZE", NULL, NULL)) != NULL)
+	{
+		long long n = strtoll(value, NULL, 10);
+		if(n > 0) size = (size_t)n;
+	}
+	if(ncio_px_filesize(nciop, &filesize) != NC_NOERR)
+		return;
+
+	if((ra = (px_readahead *)calloc(1, sizeof(px_readahead))) == NULL)
+		return;
+	ra->nslots = nslots;
+	ra->extent = _RNDUP(size, pxp->blksz);
+	ra->filesize = filesize;
+	ra->expect = OFF_NONE;
+	ra->fd = nciop->fd;
+	if((ra->slots = (px_raslot *)calloc(nslots, sizeof(px_raslot))) == NULL)
+		goto fail;
+	for(ii = 0; ii < nslots; ii++)
+	{
+		if((ra->slots[ii].base = malloc(ra->extent)) == NULL)
+			goto fail;
+	}
+	pthread_mutex_init(&ra->lock, NULL);
+	pthread_cond_init(&ra->work, NULL);
+	pthread_cond_init(&ra->ready, NULL);
+	if(pthread_create(&ra->thread, NULL, px_ra_worker, ra) != 0)
+	{
+		pthread_cond_destroy(&ra->ready);
+		pthread_cond_destroy(&ra->work);
+		pthread_mutex_destroy(&ra->lock);
+		goto fail;
+	}
+#ifdef POSIX_FADV_SEQUENTIAL
+	/* and let the kernel know too */
+	(void) posix_fadvise(nciop->fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+	pxp->ra = ra;
+	return;
+
+fail:
+	if(ra->slots != NULL)
+	{
+		for(ii = 0; ii < nslots; ii++)
+			free(ra->slots[ii].base);
+		free(ra->slots);
+	}
+	free(ra);
+}
+#else /*!PX_READAHEAD*/
+#define px_ra_pgin(nciop, pxp, offset, extent, vp, nreadp, posp) \
+	px_pgin(nciop, offset, extent, vp, nreadp, posp)
+#endif /*PX_READAHEAD*/
+
 /* POSIX get. This will "make a region available." Since we're using
    buffered IO, this means that if needed, we'll fetch a new page from
    the file, otherwise, just return a pointer to what's in memory
@@ -566,7 +931,7 @@ px_get(ncio *const nciop, ncio_px *const pxp,
 			void *const middle =
 			 	(void *)((char *)pxp->bf_base + pxp->blksz);
 			assert(pxp->bf_extent == pxp->blksz);
-			status = px_pgin(nciop,
+			status = px_ra_pgin(nciop, pxp,
 				 pxp->bf_offset + (off_t)pxp->blksz,
 				 pxp->blksz,
 				 middle,
@@ -638,7 +1003,7 @@ px_get(ncio *const nciop, ncio_px *const pxp,
 			/* page in upper */
 			void *const middle =
 			 	(void *)((char *)pxp->bf_base + pxp->blksz);
-			status = px_pgin(nciop,
+			status = px_ra_pgin(nciop, pxp,
 				 pxp->bf_offset + (off_t)pxp->blksz,
 				 pxp->blksz,
 				 middle,
@@ -685,7 +1050,7 @@ px_get(ncio *const nciop, ncio_px *const pxp,
 			upper_cnt = pxp->bf_cnt;
 		}
 		/* read page below into lower half */
-		status = px_pgin(nciop,
+		status = px_ra_pgin(nciop, pxp,
 			 blkoffset,
 			 pxp->blksz,
 			 pxp->bf_base,
@@ -722,7 +1087,7 @@ px_get(ncio *const nciop, ncio_px *const pxp,
 	}
 
 pgin:
-	status = px_pgin(nciop,
+	status = px_ra_pgin(nciop, pxp,
 		 blkoffset,
 		 blkextent,
 		 pxp->bf_base,
@@ -833,6 +1198,9 @@ fprintf(stderr, "\tdouble_buffr %ld %ld %ld\n",
 		pxp->slave->bf_rflags = 0;
 		pxp->slave->bf_refcount = 0;
 		pxp->slave->slave = NULL;
+#ifdef PX_READAHEAD
+		pxp->slave->ra = NULL;
+#endif
 	}
 
 	pxp->slave->pos = pxp->pos;
@@ -998,6 +1366,10 @@ ncio_px_sync(ncio *const nciop)
 	     */
 	    pxp->bf_offset = OFF_NONE;
 	    pxp->bf_cnt = 0;
+#ifdef PX_READAHEAD
+	    if(pxp->ra != NULL)
+		px_ra_reset(nciop, pxp->ra);
+#endif
 	}
 	return status;
 }
@@ -1012,6 +1384,10 @@ ncio_px_freepvt(void *const pvt)
 	if(pxp == NULL)
 		return;
 
+#ifdef PX_READAHEAD
+	px_ra_free(pxp);
+#endif
+
 	if(pxp->slave != NULL)
 	{
 		if(pxp->slave->bf_base != NULL)
@@ -1111,7 +1487,9 @@ ncio_px_init(ncio *const nciop)
 	pxp->bf_refcount = 0;
 	pxp->bf_base = NULL;
 	pxp->slave = NULL;
-
+#ifdef PX_READAHEAD
+	pxp->ra = NULL;
+#endif
 }
 
 /* Begin spx */
@@ -1805,6 +2183,11 @@ posixio_open(const char *path,
 			goto unwind_open;
 	}
 
+#ifdef PX_READAHEAD
+	if(!fIsSet(nciop->ioflags, NC_SHARE) && !fIsSet(nciop->ioflags, NC_WRITE))
+		px_ra_init(nciop, (ncio_px *)nciop->pvt);
+#endif
+
 	*nciopp = nciop;
 	return NC_NOERR;
 
@@ -1892,6 +2275,10 @@ ncio_px_close(ncio *nciop, int doUnlink)
 	int status = NC_NOERR;
 	if(nciop == NULL)
 		return EINVAL;
+#ifdef PX_READAHEAD
+	/* the read-ahead thread must be done with the fd */
+	px_ra_free((ncio_px *)nciop->pvt);
+#endif
 	if(nciop->fd > 0) {
 	    status = nciop->sync(nciop);
 	    (void) close(nciop->fd);
@@ -34,10 +34,12 @@ dnl
 
 static int
 readNCv(const NC3_INFO* ncp, const NC_var* varp, const size_t* start,
-        const size_t nelems, void* value, const nc_type memtype);
+        const size_t nelems, const size_t step, void* value,
+        const nc_type memtype);
 static int
 writeNCv(NC3_INFO* ncp, const NC_var* varp, const size_t* start,
-         const size_t nelems, const void* value, const nc_type memtype);
+         const size_t nelems, const size_t step, const void* value,
+         const nc_type memtype);
 
 
 /* #define ODEBUG 1 */
@@ -625,8 +627,9 @@ NC_varoffset(const NC3_INFO* ncp, const NC_var *varp, const size_t *coord)
 
 
 dnl
-dnl Output 'nelems' items of contiguous data of type "Type"
-dnl for variable 'varp' at 'start'.
+dnl Output 'nelems' items of data of type "Type" for variable 'varp'
+dnl at 'start', 'step' elements apart along the fastest varying
+dnl dimension (1 for contiguous data).
 dnl "Xtype" had better match 'varp->type'.
 dnl---
 dnl
@@ -636,7 +639,8 @@ define(`PUTNCVX',dnl
 `dnl
 static int
 putNCvx_$1_$2(NC3_INFO* ncp, const NC_var *varp,
-		 const size_t *start, size_t nelems, const $2 *value)
+		 const size_t *start, size_t nelems, size_t step,
+		 const $2 *value)
 {
 	off_t offset = NC_varoffset(ncp, varp, start);
 	size_t remaining = varp->xsz * nelems;
@@ -656,6 +660,46 @@ putNCvx_$1_$2(NC3_INFO* ncp, const NC_var *varp,
         status = NC3_inq_var_fill(varp, fillp);
 #endif
 
+	if(step != 1)
+	{
+		/* Update as many items as fit in one chunk with a single
+		 * read-modify-write of the extent that encloses them. */
+		const size_t xstep = varp->xsz * step;
+		const size_t per = ncp->chunk < varp->xsz ? 1
+				 : (ncp->chunk - varp->xsz) / xstep + 1;
+
+		while(nelems > 0)
+		{
+			const size_t nput = MIN(nelems, per);
+			const size_t extent = (nput - 1) * xstep + varp->xsz;
+			size_t ii;
+
+			int lstatus = ncio_get(ncp->nciop, offset, extent,
+					 RGN_WRITE, &xp);
+			if(lstatus != NC_NOERR)
+				return lstatus;
+
+			for(ii = 0; ii < nput; ii++)
+			{
+				void *xq = (char *)xp + ii * xstep;
+				lstatus = ncx_putn_$1_$2(&xq, 1, value + ii ifelse(`$1',`char',,`,fillp'));
+				if(lstatus != NC_NOERR && status == NC_NOERR)
+					status = lstatus;
+			}
+
+			(void) ncio_rel(ncp->nciop, offset,
+					 RGN_MODIFIED);
+
+			nelems -= nput;
+			offset += (off_t)(nput * xstep);
+			value += nput;
+		}
+#ifdef ERANGE_FILL
+		free(fillp);
+#endif
+		return status;
+	}
+
 	for(;;)
 	{
 		size_t extent = MIN(remaining, ncp->chunk);
@@ -810,21 +854,65 @@ define(`GETNCVX',dnl
 `dnl
 static int
 getNCvx_$1_$2(const NC3_INFO* ncp, const NC_var *varp,
-		 const size_t *start, size_t nelems, $2 *value)
+		 const size_t *start, size_t nelems, size_t step, $2 *value)
 {
 	off_t offset = NC_varoffset(ncp, varp, start);
 	size_t remaining = varp->xsz * nelems;
 	int status = NC_NOERR;
 	const void *xp;
+	size_t chunk;
 
 	if(nelems == 0)
 		return NC_NOERR;
 
 	assert(value != NULL);
 
+	/* A resident file hands back a pointer into its memory, so there
+	 * is nothing to gain by chopping the run up: convert it in one go.
+	 */
+	chunk = ncio_resident(ncp->nciop)
+		? (nelems - 1) * step * varp->xsz + varp->xsz : ncp->chunk;
+
+	if(step != 1)
+	{
+		/* Fetch as many items as fit in one chunk with a single
+		 * ncio_get of the extent that encloses them, and pick
+		 * them out of it. */
+		const size_t xstep = varp->xsz * step;
+		const size_t per = chunk < varp->xsz ? 1
+				 : (chunk - varp->xsz) / xstep + 1;
+
+		while(nelems > 0)
+		{
+			const size_t nget = MIN(nelems, per);
+			const size_t extent = (nget - 1) * xstep + varp->xsz;
+			size_t ii;
+
+			int lstatus = ncio_get(ncp->nciop, offset, extent,
+					 0, (void **)&xp);	/* cast away const */
+			if(lstatus != NC_NOERR)
+				return lstatus;
+
+			for(ii = 0; ii < nget; ii++)
+			{
+				const void *xq = (const char *)xp + ii * xstep;
+				lstatus = ncx_getn_$1_$2(&xq, 1, value + ii);
+				if(lstatus != NC_NOERR && status == NC_NOERR)
+					status = lstatus;
+			}
+
+			(void) ncio_rel(ncp->nciop, offset, 0);
+
+			nelems -= nget;
+			offset += (off_t)(nget * xstep);
+			value += nget;
+		}
+		return status;
+	}
+
 	for(;;)
 	{
-		size_t extent = MIN(remaining, ncp->chunk);
+		size_t extent = MIN(remaining, chunk);
 		size_t nget = ncx_howmany(varp->type, extent);
 
 		int lstatus = ncio_get(ncp->nciop, offset, extent,
@@ -1133,326 +1221,327 @@ ifelse($1, text,dnl
 
 static int
 readNCv(const NC3_INFO* ncp, const NC_var* varp, const size_t* start,
-        const size_t nelems, void* value, const nc_type memtype)
+        const size_t nelems, const size_t step, void* value,
+        const nc_type memtype)
 {
     int status = NC_NOERR;
     switch (CASE(varp->type,memtype)) {
 
     case CASE(NC_CHAR,NC_CHAR):
     case CASE(NC_CHAR,NC_UBYTE):
-    return getNCvx_schar_schar(ncp,varp,start,nelems,(signed char*)value);
+    return getNCvx_schar_schar(ncp,varp,start,nelems,step,(signed char*)value);
     break;
     case CASE(NC_BYTE,NC_BYTE):
-        return getNCvx_schar_schar(ncp,varp,start,nelems, (schar*)value);
+        return getNCvx_schar_schar(ncp,varp,start,nelems,step,(schar*)value);
 	break;
     case CASE(NC_BYTE,NC_UBYTE):
         if (fIsSet(ncp->flags,NC_64BIT_DATA))
-            return getNCvx_schar_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+            return getNCvx_schar_uchar(ncp,varp,start,nelems,step,(unsigned char*)value);
         else
             /* for CDF-1 and CDF-2, NC_BYTE is treated the same type as uchar memtype */
-            return getNCvx_uchar_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+            return getNCvx_uchar_uchar(ncp,varp,start,nelems,step,(unsigned char*)value);
 	break;
     case CASE(NC_BYTE,NC_SHORT):
-        return getNCvx_schar_short(ncp,varp,start,nelems,(short*)value);
+        return getNCvx_schar_short(ncp,varp,start,nelems,step,(short*)value);
 	break;
     case CASE(NC_BYTE,NC_INT):
-        return getNCvx_schar_int(ncp,varp,start,nelems,(int*)value);
+        return getNCvx_schar_int(ncp,varp,start,nelems,step,(int*)value);
 	break;
     case CASE(NC_BYTE,NC_FLOAT):
-        return getNCvx_schar_float(ncp,varp,start,nelems,(float*)value);
+        return getNCvx_schar_float(ncp,varp,start,nelems,step,(float*)value);
 	break;
     case CASE(NC_BYTE,NC_DOUBLE):
-        return getNCvx_schar_double(ncp,varp,start,nelems,(double *)value);
+        return getNCvx_schar_double(ncp,varp,start,nelems,step,(double *)value);
 	break;
     case CASE(NC_BYTE,NC_INT64):
-        return getNCvx_schar_longlong(ncp,varp,start,nelems,(long long*)value);
+        return getNCvx_schar_longlong(ncp,varp,start,nelems,step,(long long*)value);
 	break;
     case CASE(NC_BYTE,NC_UINT):
-        return getNCvx_schar_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return getNCvx_schar_uint(ncp,varp,start,nelems,step,(unsigned int*)value);
 	break;
     case CASE(NC_BYTE,NC_UINT64):
-        return getNCvx_schar_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return getNCvx_schar_ulonglong(ncp,varp,start,nelems,step,(unsigned long long*)value);
     	break;
     case CASE(NC_BYTE,NC_USHORT):
-        return getNCvx_schar_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return getNCvx_schar_ushort(ncp,varp,start,nelems,step,(unsigned short*)value);
 	break;
     case CASE(NC_SHORT,NC_BYTE):
-        return getNCvx_short_schar(ncp,varp,start,nelems,(schar*)value);
+        return getNCvx_short_schar(ncp,varp,start,nelems,step,(schar*)value);
 	break;
     case CASE(NC_SHORT,NC_UBYTE):
-        return getNCvx_short_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        return getNCvx_short_uchar(ncp,varp,start,nelems,step,(unsigned char*)value);
 	break;
     case CASE(NC_SHORT,NC_SHORT):
-        return getNCvx_short_short(ncp,varp,start,nelems,(short*)value);
+        return getNCvx_short_short(ncp,varp,start,nelems,step,(short*)value);
 	break;
     case CASE(NC_SHORT,NC_INT):
-        return getNCvx_short_int(ncp,varp,start,nelems,(int*)value);
+        return getNCvx_short_int(ncp,varp,start,nelems,step,(int*)value);
 	break;
    case CASE(NC_SHORT,NC_FLOAT):
-        return getNCvx_short_float(ncp,varp,start,nelems,(float*)value);
+        return getNCvx_short_float(ncp,varp,start,nelems,step,(float*)value);
 	break;
     case CASE(NC_SHORT,NC_DOUBLE):
-        return getNCvx_short_double(ncp,varp,start,nelems,(double*)value);
+        return getNCvx_short_double(ncp,varp,start,nelems,step,(double*)value);
 	break;
     case CASE(NC_SHORT,NC_INT64):
-        return getNCvx_short_longlong(ncp,varp,start,nelems,(long long*)value);
+        return getNCvx_short_longlong(ncp,varp,start,nelems,step,(long long*)value);
    	break;
     case CASE(NC_SHORT,NC_UINT):
-        return getNCvx_short_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return getNCvx_short_uint(ncp,varp,start,nelems,step,(unsigned int*)value);
     	break;
     case CASE(NC_SHORT,NC_UINT64):
-        return getNCvx_short_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return getNCvx_short_ulonglong(ncp,varp,start,nelems,step,(unsigned long long*)value);
 	break;
     case CASE(NC_SHORT,NC_USHORT):
-        return getNCvx_short_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return getNCvx_short_ushort(ncp,varp,start,nelems,step,(unsigned short*)value);
 	break;
 
     case CASE(NC_INT,NC_BYTE):
-        return getNCvx_int_schar(ncp,varp,start,nelems,(schar*)value);
+        return getNCvx_int_schar(ncp,varp,start,nelems,step,(schar*)value);
 	break;
     case CASE(NC_INT,NC_UBYTE):
-        return getNCvx_int_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        return getNCvx_int_uchar(ncp,varp,start,nelems,step,(unsigned char*)value);
 	break;
     case CASE(NC_INT,NC_SHORT):
-        return getNCvx_int_short(ncp,varp,start,nelems,(short*)value);
+        return getNCvx_int_short(ncp,varp,start,nelems,step,(short*)value);
 	break;
     case CASE(NC_INT,NC_INT):
-        return getNCvx_int_int(ncp,varp,start,nelems,(int*)value);
+        return getNCvx_int_int(ncp,varp,start,nelems,step,(int*)value);
 	break;
     case CASE(NC_INT,NC_FLOAT):
-        return getNCvx_int_float(ncp,varp,start,nelems,(float*)value);
+        return getNCvx_int_float(ncp,varp,start,nelems,step,(float*)value);
 	break;
     case CASE(NC_INT,NC_DOUBLE):
-        return getNCvx_int_double(ncp,varp,start,nelems,(double*)value);
+        return getNCvx_int_double(ncp,varp,start,nelems,step,(double*)value);
 	break;
     case CASE(NC_INT,NC_INT64):
-        return getNCvx_int_longlong(ncp,varp,start,nelems,(long long*)value);
+        return getNCvx_int_longlong(ncp,varp,start,nelems,step,(long long*)value);
 	break;
     case CASE(NC_INT,NC_UINT):
-        return getNCvx_int_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return getNCvx_int_uint(ncp,varp,start,nelems,step,(unsigned int*)value);
 	break;
     case CASE(NC_INT,NC_UINT64):
-        return getNCvx_int_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return getNCvx_int_ulonglong(ncp,varp,start,nelems,step,(unsigned long long*)value);
 	break;
     case CASE(NC_INT,NC_USHORT):
-        return getNCvx_int_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return getNCvx_int_ushort(ncp,varp,start,nelems,step,(unsigned short*)value);
 	break;
 
     case CASE(NC_FLOAT,NC_BYTE):
-        return getNCvx_float_schar(ncp,varp,start,nelems,(schar*)value);
+        return getNCvx_float_schar(ncp,varp,start,nelems,step,(schar*)value);
 	break;
     case CASE(NC_FLOAT,NC_UBYTE):
-        return getNCvx_float_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        return getNCvx_float_uchar(ncp,varp,start,nelems,step,(unsigned char*)value);
 	break;
     case CASE(NC_FLOAT,NC_SHORT):
-        return getNCvx_float_short(ncp,varp,start,nelems,(short*)value);
+        return getNCvx_float_short(ncp,varp,start,nelems,step,(short*)value);
 	break;
     case CASE(NC_FLOAT,NC_INT):
-        return getNCvx_float_int(ncp,varp,start,nelems,(int*)value);
+        return getNCvx_float_int(ncp,varp,start,nelems,step,(int*)value);
 	break;
     case CASE(NC_FLOAT,NC_FLOAT):
-        return getNCvx_float_float(ncp,varp,start,nelems,(float*)value);
+        return getNCvx_float_float(ncp,varp,start,nelems,step,(float*)value);
 	break;
     case CASE(NC_FLOAT,NC_DOUBLE):
-        return getNCvx_float_double(ncp,varp,start,nelems,(double*)value);
+        return getNCvx_float_double(ncp,varp,start,nelems,step,(double*)value);
 	break;
     case CASE(NC_FLOAT,NC_INT64):
-        return getNCvx_float_longlong(ncp,varp,start,nelems,(long long*)value);
+        return getNCvx_float_longlong(ncp,varp,start,nelems,step,(long long*)value);
 	break;
     case CASE(NC_FLOAT,NC_UINT):
-        return getNCvx_float_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return getNCvx_float_uint(ncp,varp,start,nelems,step,(unsigned int*)value);
 	break;
     case CASE(NC_FLOAT,NC_UINT64):
-        return getNCvx_float_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return getNCvx_float_ulonglong(ncp,varp,start,nelems,step,(unsigned long long*)value);
 	break;
     case CASE(NC_FLOAT,NC_USHORT):
-        return getNCvx_float_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return getNCvx_float_ushort(ncp,varp,start,nelems,step,(unsigned short*)value);
 	break;
 
     case CASE(NC_DOUBLE,NC_BYTE):
-        return getNCvx_double_schar(ncp,varp,start,nelems,(schar*)value);
+        return getNCvx_double_schar(ncp,varp,start,nelems,step,(schar*)value);
 	break;
     case CASE(NC_DOUBLE,NC_UBYTE):
-        return getNCvx_double_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        return getNCvx_double_uchar(ncp,varp,start,nelems,step,(unsigned char*)value);
 	break;
     case CASE(NC_DOUBLE,NC_SHORT):
-        return getNCvx_double_short(ncp,varp,start,nelems,(short*)value);
+        return getNCvx_double_short(ncp,varp,start,nelems,step,(short*)value);
 	break;
     case CASE(NC_DOUBLE,NC_INT):
-        return getNCvx_double_int(ncp,varp,start,nelems,(int*)value);
+        return getNCvx_double_int(ncp,varp,start,nelems,step,(int*)value);
 	break;
     case CASE(NC_DOUBLE,NC_FLOAT):
-        return getNCvx_double_float(ncp,varp,start,nelems,(float*)value);
+        return getNCvx_double_float(ncp,varp,start,nelems,step,(float*)value);
 	break;
     case CASE(NC_DOUBLE,NC_DOUBLE):
-        return getNCvx_double_double(ncp,varp,start,nelems,(double*)value);
+        return getNCvx_double_double(ncp,varp,start,nelems,step,(double*)value);
 	break;
     case CASE(NC_DOUBLE,NC_INT64):
-        return getNCvx_double_longlong(ncp,varp,start,nelems,(long long*)value);
+        return getNCvx_double_longlong(ncp,varp,start,nelems,step,(long long*)value);
 	break;
     case CASE(NC_DOUBLE,NC_UINT):
-        return getNCvx_double_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return getNCvx_double_uint(ncp,varp,start,nelems,step,(unsigned int*)value);
 	break;
     case CASE(NC_DOUBLE,NC_UINT64):
-        return getNCvx_double_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return getNCvx_double_ulonglong(ncp,varp,start,nelems,step,(unsigned long long*)value);
 	break;
     case CASE(NC_DOUBLE,NC_USHORT):
-        return getNCvx_double_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return getNCvx_double_ushort(ncp,varp,start,nelems,step,(unsigned short*)value);
 	break;
 
     case CASE(NC_UBYTE,NC_UBYTE):
-        return getNCvx_uchar_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        return getNCvx_uchar_uchar(ncp,varp,start,nelems,step,(unsigned char*)value);
 	break;
     case CASE(NC_UBYTE,NC_BYTE):
-        return getNCvx_uchar_schar(ncp,varp,start,nelems,(schar*)value);
+        return getNCvx_uchar_schar(ncp,varp,start,nelems,step,(schar*)value);
 	break;
     case CASE(NC_UBYTE,NC_SHORT):
-        return getNCvx_uchar_short(ncp,varp,start,nelems,(short*)value);
+        return getNCvx_uchar_short(ncp,varp,start,nelems,step,(short*)value);
 	break;
     case CASE(NC_UBYTE,NC_INT):
-        return getNCvx_uchar_int(ncp,varp,start,nelems,(int*)value);
+        return getNCvx_uchar_int(ncp,varp,start,nelems,step,(int*)value);
 	break;
     case CASE(NC_UBYTE,NC_FLOAT):
-        return getNCvx_uchar_float(ncp,varp,start,nelems,(float*)value);
+        return getNCvx_uchar_float(ncp,varp,start,nelems,step,(float*)value);
 	break;
     case CASE(NC_UBYTE,NC_DOUBLE):
-        return getNCvx_uchar_double(ncp,varp,start,nelems,(double *)value);
+        return getNCvx_uchar_double(ncp,varp,start,nelems,step,(double *)value);
 	break;
     case CASE(NC_UBYTE,NC_INT64):
-        return getNCvx_uchar_longlong(ncp,varp,start,nelems,(long long*)value);
+        return getNCvx_uchar_longlong(ncp,varp,start,nelems,step,(long long*)value);
 	break;
     case CASE(NC_UBYTE,NC_UINT):
-        return getNCvx_uchar_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return getNCvx_uchar_uint(ncp,varp,start,nelems,step,(unsigned int*)value);
 	break;
     case CASE(NC_UBYTE,NC_UINT64):
-        return getNCvx_uchar_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return getNCvx_uchar_ulonglong(ncp,varp,start,nelems,step,(unsigned long long*)value);
 	break;
     case CASE(NC_UBYTE,NC_USHORT):
-        return getNCvx_uchar_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return getNCvx_uchar_ushort(ncp,varp,start,nelems,step,(unsigned short*)value);
 	break;
 
     case CASE(NC_USHORT,NC_BYTE):
-        return getNCvx_ushort_schar(ncp,varp,start,nelems,(schar*)value);
+        return getNCvx_ushort_schar(ncp,varp,start,nelems,step,(schar*)value);
 	break;
     case CASE(NC_USHORT,NC_UBYTE):
-        return getNCvx_ushort_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        return getNCvx_ushort_uchar(ncp,varp,start,nelems,step,(unsigned char*)value);
 	break;
     case CASE(NC_USHORT,NC_SHORT):
-        return getNCvx_ushort_short(ncp,varp,start,nelems,(short*)value);
+        return getNCvx_ushort_short(ncp,varp,start,nelems,step,(short*)value);
 	break;
     case CASE(NC_USHORT,NC_INT):
-        return getNCvx_ushort_int(ncp,varp,start,nelems,(int*)value);
+        return getNCvx_ushort_int(ncp,varp,start,nelems,step,(int*)value);
 	break;
     case CASE(NC_USHORT,NC_FLOAT):
-        return getNCvx_ushort_float(ncp,varp,start,nelems,(float*)value);
+        return getNCvx_ushort_float(ncp,varp,start,nelems,step,(float*)value);
 	break;
     case CASE(NC_USHORT,NC_DOUBLE):
-        return getNCvx_ushort_double(ncp,varp,start,nelems,(double*)value);
+        return getNCvx_ushort_double(ncp,varp,start,nelems,step,(double*)value);
 	break;
     case CASE(NC_USHORT,NC_INT64):
-        return getNCvx_ushort_longlong(ncp,varp,start,nelems,(long long*)value);
+        return getNCvx_ushort_longlong(ncp,varp,start,nelems,step,(long long*)value);
 	break;
     case CASE(NC_USHORT,NC_UINT):
-        return getNCvx_ushort_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return getNCvx_ushort_uint(ncp,varp,start,nelems,step,(unsigned int*)value);
 	break;
     case CASE(NC_USHORT,NC_UINT64):
-        return getNCvx_ushort_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return getNCvx_ushort_ulonglong(ncp,varp,start,nelems,step,(unsigned long long*)value);
 	break;
     case CASE(NC_USHORT,NC_USHORT):
-        return getNCvx_ushort_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return getNCvx_ushort_ushort(ncp,varp,start,nelems,step,(unsigned short*)value);
 	break;
 
     case CASE(NC_UINT,NC_BYTE):
-        return getNCvx_uint_schar(ncp,varp,start,nelems,(schar*)value);
+        return getNCvx_uint_schar(ncp,varp,start,nelems,step,(schar*)value);
 	break;
     case CASE(NC_UINT,NC_UBYTE):
-        return getNCvx_uint_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        return getNCvx_uint_uchar(ncp,varp,start,nelems,step,(unsigned char*)value);
 	break;
     case CASE(NC_UINT,NC_SHORT):
-        return getNCvx_uint_short(ncp,varp,start,nelems,(short*)value);
+        return getNCvx_uint_short(ncp,varp,start,nelems,step,(short*)value);
 	break;
     case CASE(NC_UINT,NC_INT):
-        return getNCvx_uint_int(ncp,varp,start,nelems,(int*)value);
+        return getNCvx_uint_int(ncp,varp,start,nelems,step,(int*)value);
 	break;
     case CASE(NC_UINT,NC_FLOAT):
-        return getNCvx_uint_float(ncp,varp,start,nelems,(float*)value);
+        return getNCvx_uint_float(ncp,varp,start,nelems,step,(float*)value);
 	break;
     case CASE(NC_UINT,NC_DOUBLE):
-        return getNCvx_uint_double(ncp,varp,start,nelems,(double*)value);
+        return getNCvx_uint_double(ncp,varp,start,nelems,step,(double*)value);
 	break;
     case CASE(NC_UINT,NC_INT64):
-        return getNCvx_uint_longlong(ncp,varp,start,nelems,(long long*)value);
+        return getNCvx_uint_longlong(ncp,varp,start,nelems,step,(long long*)value);
 	break;
     case CASE(NC_UINT,NC_UINT):
-        return getNCvx_uint_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return getNCvx_uint_uint(ncp,varp,start,nelems,step,(unsigned int*)value);
 	break;
     case CASE(NC_UINT,NC_UINT64):
-        return getNCvx_uint_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return getNCvx_uint_ulonglong(ncp,varp,start,nelems,step,(unsigned long long*)value);
 	break;
     case CASE(NC_UINT,NC_USHORT):
-        return getNCvx_uint_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return getNCvx_uint_ushort(ncp,varp,start,nelems,step,(unsigned short*)value);
 	break;
 
     case CASE(NC_INT64,NC_BYTE):
-        return getNCvx_longlong_schar(ncp,varp,start,nelems,(schar*)value);
+        return getNCvx_longlong_schar(ncp,varp,start,nelems,step,(schar*)value);
 	break;
     case CASE(NC_INT64,NC_UBYTE):
-        return getNCvx_longlong_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        return getNCvx_longlong_uchar(ncp,varp,start,nelems,step,(unsigned char*)value);
 	break;
     case CASE(NC_INT64,NC_SHORT):
-        return getNCvx_longlong_short(ncp,varp,start,nelems,(short*)value);
+        return getNCvx_longlong_short(ncp,varp,start,nelems,step,(short*)value);
 	break;
     case CASE(NC_INT64,NC_INT):
-        return getNCvx_longlong_int(ncp,varp,start,nelems,(int*)value);
+        return getNCvx_longlong_int(ncp,varp,start,nelems,step,(int*)value);
 	break;
     case CASE(NC_INT64,NC_FLOAT):
-        return getNCvx_longlong_float(ncp,varp,start,nelems,(float*)value);
+        return getNCvx_longlong_float(ncp,varp,start,nelems,step,(float*)value);
 	break;
     case CASE(NC_INT64,NC_DOUBLE):
-        return getNCvx_longlong_double(ncp,varp,start,nelems,(double*)value);
+        return getNCvx_longlong_double(ncp,varp,start,nelems,step,(double*)value);
 	break;
     case CASE(NC_INT64,NC_INT64):
-        return getNCvx_longlong_longlong(ncp,varp,start,nelems,(long long*)value);
+        return getNCvx_longlong_longlong(ncp,varp,start,nelems,step,(long long*)value);
 	break;
     case CASE(NC_INT64,NC_UINT):
-        return getNCvx_longlong_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return getNCvx_longlong_uint(ncp,varp,start,nelems,step,(unsigned int*)value);
 	break;
     case CASE(NC_INT64,NC_UINT64):
-        return getNCvx_longlong_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return getNCvx_longlong_ulonglong(ncp,varp,start,nelems,step,(unsigned long long*)value);
 	break;
     case CASE(NC_INT64,NC_USHORT):
-        return getNCvx_longlong_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return getNCvx_longlong_ushort(ncp,varp,start,nelems,step,(unsigned short*)value);
 	break;
 
     case CASE(NC_UINT64,NC_BYTE):
-        return getNCvx_ulonglong_schar(ncp,varp,start,nelems,(schar*)value);
+        return getNCvx_ulonglong_schar(ncp,varp,start,nelems,step,(schar*)value);
 	break;
     case CASE(NC_UINT64,NC_UBYTE):
-        return getNCvx_ulonglong_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        return getNCvx_ulonglong_uchar(ncp,varp,start,nelems,step,(unsigned char*)value);
 	break;
     case CASE(NC_UINT64,NC_SHORT):
-        return getNCvx_ulonglong_short(ncp,varp,start,nelems,(short*)value);
+        return getNCvx_ulonglong_short(ncp,varp,start,nelems,step,(short*)value);
 	break;
     case CASE(NC_UINT64,NC_INT):
-        return getNCvx_ulonglong_int(ncp,varp,start,nelems,(int*)value);
+        return getNCvx_ulonglong_int(ncp,varp,start,nelems,step,(int*)value);
 	break;
     case CASE(NC_UINT64,NC_FLOAT):
-        return getNCvx_ulonglong_float(ncp,varp,start,nelems,(float*)value);
+        return getNCvx_ulonglong_float(ncp,varp,start,nelems,step,(float*)value);
 	break;
     case CASE(NC_UINT64,NC_DOUBLE):
-        return getNCvx_ulonglong_double(ncp,varp,start,nelems,(double*)value);
+        return getNCvx_ulonglong_double(ncp,varp,start,nelems,step,(double*)value);
 	break;
     case CASE(NC_UINT64,NC_INT64):
-        return getNCvx_ulonglong_longlong(ncp,varp,start,nelems,(long long*)value);
+        return getNCvx_ulonglong_longlong(ncp,varp,start,nelems,step,(long long*)value);
 	break;
     case CASE(NC_UINT64,NC_UINT):
-        return getNCvx_ulonglong_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return getNCvx_ulonglong_uint(ncp,varp,start,nelems,step,(unsigned int*)value);
 	break;
     case CASE(NC_UINT64,NC_UINT64):
-        return getNCvx_ulonglong_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return getNCvx_ulonglong_ulonglong(ncp,varp,start,nelems,step,(unsigned long long*)value);
 	break;
     case CASE(NC_UINT64,NC_USHORT):
-        return getNCvx_ulonglong_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return getNCvx_ulonglong_ushort(ncp,varp,start,nelems,step,(unsigned short*)value);
 	break;
 
     default:
@@ -1465,318 +1554,319 @@ readNCv(const NC3_INFO* ncp, const NC_var* varp, const size_t* start,
 
 static int
 writeNCv(NC3_INFO* ncp, const NC_var* varp, const size_t* start,
-         const size_t nelems, const void* value, const nc_type memtype)
+         const size_t nelems, const size_t step, const void* value,
+         const nc_type memtype)
 {
     int status = NC_NOERR;
     switch (CASE(varp->type,memtype)) {
 
     case CASE(NC_CHAR,NC_CHAR):
     case CASE(NC_CHAR,NC_UBYTE):
-        return putNCvx_char_char(ncp,varp,start,nelems,(char*)value);
+        return putNCvx_char_char(ncp,varp,start,nelems,step,(char*)value);
 	break;
     case CASE(NC_BYTE,NC_BYTE):
-        return putNCvx_schar_schar(ncp,varp,start,nelems,(schar*)value);
+        return putNCvx_schar_schar(ncp,varp,start,nelems,step,(schar*)value);
 	break;
     case CASE(NC_BYTE,NC_UBYTE):
         if (fIsSet(ncp->flags,NC_64BIT_DATA))
-            return putNCvx_schar_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+            return putNCvx_schar_uchar(ncp,varp,start,nelems,step,(unsigned char*)value);
         else
             /* for CDF-1 and CDF-2, NC_BYTE is treated the same type as uchar memtype */
-            return putNCvx_uchar_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+            return putNCvx_uchar_uchar(ncp,varp,start,nelems,step,(unsigned char*)value);
 	break;
     case CASE(NC_BYTE,NC_SHORT):
-        return putNCvx_schar_short(ncp,varp,start,nelems,(short*)value);
+        return putNCvx_schar_short(ncp,varp,start,nelems,step,(short*)value);
 	break;
     case CASE(NC_BYTE,NC_INT):
-        return putNCvx_schar_int(ncp,varp,start,nelems,(int*)value);
+        return putNCvx_schar_int(ncp,varp,start,nelems,step,(int*)value);
 	break;
     case CASE(NC_BYTE,NC_FLOAT):
-        return putNCvx_schar_float(ncp,varp,start,nelems,(float*)value);
+        return putNCvx_schar_float(ncp,varp,start,nelems,step,(float*)value);
 	break;
     case CASE(NC_BYTE,NC_DOUBLE):
-        return putNCvx_schar_double(ncp,varp,start,nelems,(double *)value);
+        return putNCvx_schar_double(ncp,varp,start,nelems,step,(double *)value);
 	break;
     case CASE(NC_BYTE,NC_INT64):
-        return putNCvx_schar_longlong(ncp,varp,start,nelems,(long long*)value);
+        return putNCvx_schar_longlong(ncp,varp,start,nelems,step,(long long*)value);
 	break;
     case CASE(NC_BYTE,NC_UINT):
-        return putNCvx_schar_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return putNCvx_schar_uint(ncp,varp,start,nelems,step,(unsigned int*)value);
 	break;
     case CASE(NC_BYTE,NC_UINT64):
-        return putNCvx_schar_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return putNCvx_schar_ulonglong(ncp,varp,start,nelems,step,(unsigned long long*)value);
 	break;
     case CASE(NC_BYTE,NC_USHORT):
-        return putNCvx_schar_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return putNCvx_schar_ushort(ncp,varp,start,nelems,step,(unsigned short*)value);
 	break;
     case CASE(NC_SHORT,NC_BYTE):
-        return putNCvx_short_schar(ncp,varp,start,nelems,(schar*)value);
+        return putNCvx_short_schar(ncp,varp,start,nelems,step,(schar*)value);
 	break;
     case CASE(NC_SHORT,NC_UBYTE):
-        return putNCvx_short_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        return putNCvx_short_uchar(ncp,varp,start,nelems,step,(unsigned char*)value);
 	break;
     case CASE(NC_SHORT,NC_SHORT):
-        return putNCvx_short_short(ncp,varp,start,nelems,(short*)value);
+        return putNCvx_short_short(ncp,varp,start,nelems,step,(short*)value);
 	break;
     case CASE(NC_SHORT,NC_INT):
-        return putNCvx_short_int(ncp,varp,start,nelems,(int*)value);
+        return putNCvx_short_int(ncp,varp,start,nelems,step,(int*)value);
 	break;
     case CASE(NC_SHORT,NC_FLOAT):
-        return putNCvx_short_float(ncp,varp,start,nelems,(float*)value);
+        return putNCvx_short_float(ncp,varp,start,nelems,step,(float*)value);
 	break;
     case CASE(NC_SHORT,NC_DOUBLE):
-        return putNCvx_short_double(ncp,varp,start,nelems,(double*)value);
+        return putNCvx_short_double(ncp,varp,start,nelems,step,(double*)value);
 	break;
     case CASE(NC_SHORT,NC_INT64):
-        return putNCvx_short_longlong(ncp,varp,start,nelems,(long long*)value);
+        return putNCvx_short_longlong(ncp,varp,start,nelems,step,(long long*)value);
 	break;
     case CASE(NC_SHORT,NC_UINT):
-        return putNCvx_short_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return putNCvx_short_uint(ncp,varp,start,nelems,step,(unsigned int*)value);
 	break;
     case CASE(NC_SHORT,NC_UINT64):
-        return putNCvx_short_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return putNCvx_short_ulonglong(ncp,varp,start,nelems,step,(unsigned long long*)value);
 	break;
     case CASE(NC_SHORT,NC_USHORT):
-        return putNCvx_short_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return putNCvx_short_ushort(ncp,varp,start,nelems,step,(unsigned short*)value);
 	break;
     case CASE(NC_INT,NC_BYTE):
-        return putNCvx_int_schar(ncp,varp,start,nelems,(schar*)value);
+        return putNCvx_int_schar(ncp,varp,start,nelems,step,(schar*)value);
 	break;
     case CASE(NC_INT,NC_UBYTE):
-        return putNCvx_int_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        return putNCvx_int_uchar(ncp,varp,start,nelems,step,(unsigned char*)value);
 	break;
     case CASE(NC_INT,NC_SHORT):
-        return putNCvx_int_short(ncp,varp,start,nelems,(short*)value);
+        return putNCvx_int_short(ncp,varp,start,nelems,step,(short*)value);
 	break;
     case CASE(NC_INT,NC_INT):
-        return putNCvx_int_int(ncp,varp,start,nelems,(int*)value);
+        return putNCvx_int_int(ncp,varp,start,nelems,step,(int*)value);
 	break;
     case CASE(NC_INT,NC_FLOAT):
-        return putNCvx_int_float(ncp,varp,start,nelems,(float*)value);
+        return putNCvx_int_float(ncp,varp,start,nelems,step,(float*)value);
 	break;
     case CASE(NC_INT,NC_DOUBLE):
-        return putNCvx_int_double(ncp,varp,start,nelems,(double*)value);
+        return putNCvx_int_double(ncp,varp,start,nelems,step,(double*)value);
 	break;
     case CASE(NC_INT,NC_INT64):
-        return putNCvx_int_longlong(ncp,varp,start,nelems,(long long*)value);
+        return putNCvx_int_longlong(ncp,varp,start,nelems,step,(long long*)value);
 	break;
     case CASE(NC_INT,NC_UINT):
-        return putNCvx_int_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return putNCvx_int_uint(ncp,varp,start,nelems,step,(unsigned int*)value);
 	break;
     case CASE(NC_INT,NC_UINT64):
-        return putNCvx_int_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return putNCvx_int_ulonglong(ncp,varp,start,nelems,step,(unsigned long long*)value);
 	break;
     case CASE(NC_INT,NC_USHORT):
-        return putNCvx_int_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return putNCvx_int_ushort(ncp,varp,start,nelems,step,(unsigned short*)value);
 	break;
     case CASE(NC_FLOAT,NC_BYTE):
-        return putNCvx_float_schar(ncp,varp,start,nelems,(schar*)value);
+        return putNCvx_float_schar(ncp,varp,start,nelems,step,(schar*)value);
 	break;
     case CASE(NC_FLOAT,NC_UBYTE):
-        return putNCvx_float_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        return putNCvx_float_uchar(ncp,varp,start,nelems,step,(unsigned char*)value);
 	break;
     case CASE(NC_FLOAT,NC_SHORT):
-        return putNCvx_float_short(ncp,varp,start,nelems,(short*)value);
+        return putNCvx_float_short(ncp,varp,start,nelems,step,(short*)value);
 	break;
     case CASE(NC_FLOAT,NC_INT):
-        return putNCvx_float_int(ncp,varp,start,nelems,(int*)value);
+        return putNCvx_float_int(ncp,varp,start,nelems,step,(int*)value);
 	break;
     case CASE(NC_FLOAT,NC_FLOAT):
-        return putNCvx_float_float(ncp,varp,start,nelems,(float*)value);
+        return putNCvx_float_float(ncp,varp,start,nelems,step,(float*)value);
 	break;
     case CASE(NC_FLOAT,NC_DOUBLE):
-        return putNCvx_float_double(ncp,varp,start,nelems,(double*)value);
+        return putNCvx_float_double(ncp,varp,start,nelems,step,(double*)value);
 	break;
     case CASE(NC_FLOAT,NC_INT64):
-        return putNCvx_float_longlong(ncp,varp,start,nelems,(long long*)value);
+        return putNCvx_float_longlong(ncp,varp,start,nelems,step,(long long*)value);
 	break;
     case CASE(NC_FLOAT,NC_UINT):
-        return putNCvx_float_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return putNCvx_float_uint(ncp,varp,start,nelems,step,(unsigned int*)value);
 	break;
     case CASE(NC_FLOAT,NC_UINT64):
-        return putNCvx_float_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return putNCvx_float_ulonglong(ncp,varp,start,nelems,step,(unsigned long long*)value);
 	break;
     case CASE(NC_FLOAT,NC_USHORT):
-        return putNCvx_float_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return putNCvx_float_ushort(ncp,varp,start,nelems,step,(unsigned short*)value);
 	break;
     case CASE(NC_DOUBLE,NC_BYTE):
-        return putNCvx_double_schar(ncp,varp,start,nelems,(schar*)value);
+        return putNCvx_double_schar(ncp,varp,start,nelems,step,(schar*)value);
 	break;
     case CASE(NC_DOUBLE,NC_UBYTE):
-        return putNCvx_double_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        return putNCvx_double_uchar(ncp,varp,start,nelems,step,(unsigned char*)value);
 	break;
     case CASE(NC_DOUBLE,NC_SHORT):
-        return putNCvx_double_short(ncp,varp,start,nelems,(short*)value);
+        return putNCvx_double_short(ncp,varp,start,nelems,step,(short*)value);
 	break;
     case CASE(NC_DOUBLE,NC_INT):
-        return putNCvx_double_int(ncp,varp,start,nelems,(int*)value);
+        return putNCvx_double_int(ncp,varp,start,nelems,step,(int*)value);
 	break;
     case CASE(NC_DOUBLE,NC_FLOAT):
-        return putNCvx_double_float(ncp,varp,start,nelems,(float*)value);
+        return putNCvx_double_float(ncp,varp,start,nelems,step,(float*)value);
 	break;
     case CASE(NC_DOUBLE,NC_DOUBLE):
-        return putNCvx_double_double(ncp,varp,start,nelems,(double*)value);
+        return putNCvx_double_double(ncp,varp,start,nelems,step,(double*)value);
 	break;
     case CASE(NC_DOUBLE,NC_INT64):
-        return putNCvx_double_longlong(ncp,varp,start,nelems,(long long*)value);
+        return putNCvx_double_longlong(ncp,varp,start,nelems,step,(long long*)value);
 	break;
     case CASE(NC_DOUBLE,NC_UINT):
-        return putNCvx_double_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return putNCvx_double_uint(ncp,varp,start,nelems,step,(unsigned int*)value);
 	break;
     case CASE(NC_DOUBLE,NC_UINT64):
-        return putNCvx_double_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return putNCvx_double_ulonglong(ncp,varp,start,nelems,step,(unsigned long long*)value);
 	break;
     case CASE(NC_DOUBLE,NC_USHORT):
-        return putNCvx_double_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return putNCvx_double_ushort(ncp,varp,start,nelems,step,(unsigned short*)value);
 	break;
     case CASE(NC_UBYTE,NC_UBYTE):
-        return putNCvx_uchar_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        return putNCvx_uchar_uchar(ncp,varp,start,nelems,step,(unsigned char*)value);
 	break;
     case CASE(NC_UBYTE,NC_BYTE):
-        return putNCvx_uchar_schar(ncp,varp,start,nelems,(schar*)value);
+        return putNCvx_uchar_schar(ncp,varp,start,nelems,step,(schar*)value);
 	break;
     case CASE(NC_UBYTE,NC_SHORT):
-        return putNCvx_uchar_short(ncp,varp,start,nelems,(short*)value);
+        return putNCvx_uchar_short(ncp,varp,start,nelems,step,(short*)value);
 	break;
     case CASE(NC_UBYTE,NC_INT):
-        return putNCvx_uchar_int(ncp,varp,start,nelems,(int*)value);
+        return putNCvx_uchar_int(ncp,varp,start,nelems,step,(int*)value);
 	break;
     case CASE(NC_UBYTE,NC_FLOAT):
-        return putNCvx_uchar_float(ncp,varp,start,nelems,(float*)value);
+        return putNCvx_uchar_float(ncp,varp,start,nelems,step,(float*)value);
 	break;
     case CASE(NC_UBYTE,NC_DOUBLE):
-        return putNCvx_uchar_double(ncp,varp,start,nelems,(double *)value);
+        return putNCvx_uchar_double(ncp,varp,start,nelems,step,(double *)value);
 	break;
     case CASE(NC_UBYTE,NC_INT64):
-        return putNCvx_uchar_longlong(ncp,varp,start,nelems,(long long*)value);
+        return putNCvx_uchar_longlong(ncp,varp,start,nelems,step,(long long*)value);
 	break;
     case CASE(NC_UBYTE,NC_UINT):
-        return putNCvx_uchar_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return putNCvx_uchar_uint(ncp,varp,start,nelems,step,(unsigned int*)value);
 	break;
     case CASE(NC_UBYTE,NC_UINT64):
-        return putNCvx_uchar_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return putNCvx_uchar_ulonglong(ncp,varp,start,nelems,step,(unsigned long long*)value);
 	break;
     case CASE(NC_UBYTE,NC_USHORT):
-        return putNCvx_uchar_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return putNCvx_uchar_ushort(ncp,varp,start,nelems,step,(unsigned short*)value);
 	break;
     case CASE(NC_USHORT,NC_BYTE):
-        return putNCvx_ushort_schar(ncp,varp,start,nelems,(schar*)value);
+        return putNCvx_ushort_schar(ncp,varp,start,nelems,step,(schar*)value);
 	break;
     case CASE(NC_USHORT,NC_UBYTE):
-        return putNCvx_ushort_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        return putNCvx_ushort_uchar(ncp,varp,start,nelems,step,(unsigned char*)value);
 	break;
     case CASE(NC_USHORT,NC_SHORT):
-        return putNCvx_ushort_short(ncp,varp,start,nelems,(short*)value);
+        return putNCvx_ushort_short(ncp,varp,start,nelems,step,(short*)value);
 	break;
     case CASE(NC_USHORT,NC_INT):
-        return putNCvx_ushort_int(ncp,varp,start,nelems,(int*)value);
+        return putNCvx_ushort_int(ncp,varp,start,nelems,step,(int*)value);
 	break;
     case CASE(NC_USHORT,NC_FLOAT):
-        return putNCvx_ushort_float(ncp,varp,start,nelems,(float*)value);
+        return putNCvx_ushort_float(ncp,varp,start,nelems,step,(float*)value);
 	break;
     case CASE(NC_USHORT,NC_DOUBLE):
-        return putNCvx_ushort_double(ncp,varp,start,nelems,(double*)value);
+        return putNCvx_ushort_double(ncp,varp,start,nelems,step,(double*)value);
 	break;
     case CASE(NC_USHORT,NC_INT64):
-        return putNCvx_ushort_longlong(ncp,varp,start,nelems,(long long*)value);
+        return putNCvx_ushort_longlong(ncp,varp,start,nelems,step,(long long*)value);
 	break;
     case CASE(NC_USHORT,NC_UINT):
-        return putNCvx_ushort_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return putNCvx_ushort_uint(ncp,varp,start,nelems,step,(unsigned int*)value);
 	break;
     case CASE(NC_USHORT,NC_UINT64):
-        return putNCvx_ushort_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return putNCvx_ushort_ulonglong(ncp,varp,start,nelems,step,(unsigned long long*)value);
 	break;
     case CASE(NC_USHORT,NC_USHORT):
-        return putNCvx_ushort_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return putNCvx_ushort_ushort(ncp,varp,start,nelems,step,(unsigned short*)value);
 	break;
     case CASE(NC_UINT,NC_BYTE):
-        return putNCvx_uint_schar(ncp,varp,start,nelems,(schar*)value);
+        return putNCvx_uint_schar(ncp,varp,start,nelems,step,(schar*)value);
 	break;
     case CASE(NC_UINT,NC_UBYTE):
-        return putNCvx_uint_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        return putNCvx_uint_uchar(ncp,varp,start,nelems,step,(unsigned char*)value);
 	break;
     case CASE(NC_UINT,NC_SHORT):
-        return putNCvx_uint_short(ncp,varp,start,nelems,(short*)value);
+        return putNCvx_uint_short(ncp,varp,start,nelems,step,(short*)value);
 	break;
     case CASE(NC_UINT,NC_INT):
-        return putNCvx_uint_int(ncp,varp,start,nelems,(int*)value);
+        return putNCvx_uint_int(ncp,varp,start,nelems,step,(int*)value);
 	break;
     case CASE(NC_UINT,NC_FLOAT):
-        return putNCvx_uint_float(ncp,varp,start,nelems,(float*)value);
+        return putNCvx_uint_float(ncp,varp,start,nelems,step,(float*)value);
 	break;
     case CASE(NC_UINT,NC_DOUBLE):
-        return putNCvx_uint_double(ncp,varp,start,nelems,(double*)value);
+        return putNCvx_uint_double(ncp,varp,start,nelems,step,(double*)value);
 	break;
     case CASE(NC_UINT,NC_INT64):
-        return putNCvx_uint_longlong(ncp,varp,start,nelems,(long long*)value);
+        return putNCvx_uint_longlong(ncp,varp,start,nelems,step,(long long*)value);
 	break;
     case CASE(NC_UINT,NC_UINT):
-        return putNCvx_uint_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return putNCvx_uint_uint(ncp,varp,start,nelems,step,(unsigned int*)value);
 	break;
     case CASE(NC_UINT,NC_UINT64):
-        return putNCvx_uint_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return putNCvx_uint_ulonglong(ncp,varp,start,nelems,step,(unsigned long long*)value);
 	break;
     case CASE(NC_UINT,NC_USHORT):
-        return putNCvx_uint_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return putNCvx_uint_ushort(ncp,varp,start,nelems,step,(unsigned short*)value);
 	break;
     case CASE(NC_INT64,NC_BYTE):
-        return putNCvx_longlong_schar(ncp,varp,start,nelems,(schar*)value);
+        return putNCvx_longlong_schar(ncp,varp,start,nelems,step,(schar*)value);
 	break;
     case CASE(NC_INT64,NC_UBYTE):
-        return putNCvx_longlong_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        return putNCvx_longlong_uchar(ncp,varp,start,nelems,step,(unsigned char*)value);
 	break;
     case CASE(NC_INT64,NC_SHORT):
-        return putNCvx_longlong_short(ncp,varp,start,nelems,(short*)value);
+        return putNCvx_longlong_short(ncp,varp,start,nelems,step,(short*)value);
 	break;
     case CASE(NC_INT64,NC_INT):
-        return putNCvx_longlong_int(ncp,varp,start,nelems,(int*)value);
+        return putNCvx_longlong_int(ncp,varp,start,nelems,step,(int*)value);
 	break;
     case CASE(NC_INT64,NC_FLOAT):
-        return putNCvx_longlong_float(ncp,varp,start,nelems,(float*)value);
+        return putNCvx_longlong_float(ncp,varp,start,nelems,step,(float*)value);
 	break;
     case CASE(NC_INT64,NC_DOUBLE):
-        return putNCvx_longlong_double(ncp,varp,start,nelems,(double*)value);
+        return putNCvx_longlong_double(ncp,varp,start,nelems,step,(double*)value);
 	break;
     case CASE(NC_INT64,NC_INT64):
-        return putNCvx_longlong_longlong(ncp,varp,start,nelems,(long long*)value);
+        return putNCvx_longlong_longlong(ncp,varp,start,nelems,step,(long long*)value);
 	break;
     case CASE(NC_INT64,NC_UINT):
-        return putNCvx_longlong_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return putNCvx_longlong_uint(ncp,varp,start,nelems,step,(unsigned int*)value);
 	break;
     case CASE(NC_INT64,NC_UINT64):
-        return putNCvx_longlong_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return putNCvx_longlong_ulonglong(ncp,varp,start,nelems,step,(unsigned long long*)value);
 	break;
     case CASE(NC_INT64,NC_USHORT):
-        return putNCvx_longlong_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return putNCvx_longlong_ushort(ncp,varp,start,nelems,step,(unsigned short*)value);
 	break;
     case CASE(NC_UINT64,NC_BYTE):
-        return putNCvx_ulonglong_schar(ncp,varp,start,nelems,(schar*)value);
+        return putNCvx_ulonglong_schar(ncp,varp,start,nelems,step,(schar*)value);
 	break;
     case CASE(NC_UINT64,NC_UBYTE):
-        return putNCvx_ulonglong_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        return putNCvx_ulonglong_uchar(ncp,varp,start,nelems,step,(unsigned char*)value);
 	break;
     case CASE(NC_UINT64,NC_SHORT):
-        return putNCvx_ulonglong_short(ncp,varp,start,nelems,(short*)value);
+        return putNCvx_ulonglong_short(ncp,varp,start,nelems,step,(short*)value);
 	break;
     case CASE(NC_UINT64,NC_INT):
-        return putNCvx_ulonglong_int(ncp,varp,start,nelems,(int*)value);
+        return putNCvx_ulonglong_int(ncp,varp,start,nelems,step,(int*)value);
 	break;
     case CASE(NC_UINT64,NC_FLOAT):
-        return putNCvx_ulonglong_float(ncp,varp,start,nelems,(float*)value);
+        return putNCvx_ulonglong_float(ncp,varp,start,nelems,step,(float*)value);
 	break;
     case CASE(NC_UINT64,NC_DOUBLE):
-        return putNCvx_ulonglong_double(ncp,varp,start,nelems,(double*)value);
+        return putNCvx_ulonglong_double(ncp,varp,start,nelems,step,(double*)value);
 	break;
     case CASE(NC_UINT64,NC_INT64):
-        return putNCvx_ulonglong_longlong(ncp,varp,start,nelems,(long long*)value);
+        return putNCvx_ulonglong_longlong(ncp,varp,start,nelems,step,(long long*)value);
 	break;
     case CASE(NC_UINT64,NC_UINT):
-        return putNCvx_ulonglong_uint(ncp,varp,start,nelems,(unsigned int*)value);
+        return putNCvx_ulonglong_uint(ncp,varp,start,nelems,step,(unsigned int*)value);
 	break;
     case CASE(NC_UINT64,NC_UINT64):
-        return putNCvx_ulonglong_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+        return putNCvx_ulonglong_ulonglong(ncp,varp,start,nelems,step,(unsigned long long*)value);
 	break;
     case CASE(NC_UINT64,NC_USHORT):
-        return putNCvx_ulonglong_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+        return putNCvx_ulonglong_ushort(ncp,varp,start,nelems,step,(unsigned short*)value);
 	break;
 
     default:
@@ -1788,6 +1878,155 @@ writeNCv(NC3_INFO* ncp, const NC_var* varp, const size_t* start,
 
 /**************************************************/
 
+/*
+ * Read the (already checked) hyperslab 'start', 'edges' of a
+ * non-scalar variable, one maximal contiguous run at a time.
+ */
+static int
+getNCslab(const NC3_INFO* nc3, const NC_var* varp,
+	const size_t *start, const size_t *edges,
+	signed char *value, nc_type memtype)
+{
+    int status = NC_NOERR;
+    int ii;
+    size_t iocount;
+    const size_t memtypelen = (size_t)nctypelen(memtype);
+
+    /*
+     * find max contiguous
+     *   and accumulate max count for a single io operation
+     */
+    ii = NCiocount(nc3, varp, edges, &iocount);
+
+    if(ii == -1)
+    {
+        return( readNCv(nc3, varp, start, iocount, 1, (void*)value, memtype) );
+    }
+
+    assert(ii >= 0);
+
+    { /* inline */
+    ALLOC_ONSTACK(coord, size_t, varp->ndims);
+    ALLOC_ONSTACK(upper, size_t, varp->ndims);
+    const size_t index = (size_t)ii;
+
+    /* copy in starting indices */
+    (void) memcpy(coord, start, varp->ndims * sizeof(size_t));
+
+    /* set up in maximum indices */
+    set_upper(upper, start, edges, &upper[varp->ndims]);
+
+    /* ripple counter */
+    while(*coord < *upper)
+    {
+        const int lstatus = readNCv(nc3, varp, coord, iocount, 1, (void*)value, memtype);
+	if(lstatus != NC_NOERR)
+        {
+            if(lstatus != NC_ERANGE)
+            {
+                status = lstatus;
+                /* fatal for the loop */
+                break;
+            }
+            /* else NC_ERANGE, not fatal for the loop */
+            if(status == NC_NOERR)
+                status = lstatus;
+        }
+        value += (iocount * memtypelen);
+        odo1(start, upper, coord, &upper[index], &coord[index]);
+    }
+
+    FREE_ONSTACK(upper);
+    FREE_ONSTACK(coord);
+    } /* end inline */
+
+    return status;
+}
+
+/*
+ * Convert nelems values of the type of 'varp' from the external data
+ * at 'xp' into 'value', with no change of type.
+ */
+static int
+getNCxn(const NC_var* varp, const void* xp, size_t nelems, void* value)
+{
+    switch (varp->type) {
+    case NC_CHAR:
+    case NC_BYTE:
+        return ncx_getn_schar_schar(&xp, nelems, (schar*)value);
+    case NC_UBYTE:
+        return ncx_getn_uchar_uchar(&xp, nelems, (uchar*)value);
+    case NC_SHORT:
+        return ncx_getn_short_short(&xp, nelems, (short*)value);
+    case NC_USHORT:
+        return ncx_getn_ushort_ushort(&xp, nelems, (unsigned short*)value);
+    case NC_INT:
+        return ncx_getn_int_int(&xp, nelems, (int*)value);
+    case NC_UINT:
+        return ncx_getn_uint_uint(&xp, nelems, (unsigned int*)value);
+    case NC_FLOAT:
+        return ncx_getn_float_float(&xp, nelems, (float*)value);
+    case NC_DOUBLE:
+        return ncx_getn_double_double(&xp, nelems, (double*)value);
+    case NC_INT64:
+        return ncx_getn_longlong_longlong(&xp, nelems, (long long*)value);
+    case NC_UINT64:
+        return ncx_getn_ulonglong_ulonglong(&xp, nelems, (unsigned long long*)value);
+    default:
+        return NC_EBADTYPE;
+    }
+}
+
+/*
+ * As getNCslab with no change of type, but copy out of 'xp', the
+ * external data already fetched from file offset 'offset', which
+ * must hold the whole hyperslab.
+ */
+static int
+getNCslabx(const NC3_INFO* nc3, const NC_var* varp,
+	const size_t *start, const size_t *edges,
+	const char *xp, off_t offset, signed char *value)
+{
+    int status = NC_NOERR;
+    int ii;
+    size_t iocount;
+    const size_t memtypelen = (size_t)nctypelen(varp->type);
+
+    ii = NCiocount(nc3, varp, edges, &iocount);
+
+    if(ii == -1)
+    {
+        return getNCxn(varp, xp + (NC_varoffset(nc3, varp, start) - offset),
+                       iocount, value);
+    }
+
+    assert(ii >= 0);
+
+    { /* inline */
+    ALLOC_ONSTACK(coord, size_t, varp->ndims);
+    ALLOC_ONSTACK(upper, size_t, varp->ndims);
+    const size_t index = (size_t)ii;
+
+    (void) memcpy(coord, start, varp->ndims * sizeof(size_t));
+    set_upper(upper, start, edges, &upper[varp->ndims]);
+
+    while(*coord < *upper)
+    {
+        status = getNCxn(varp, xp + (NC_varoffset(nc3, varp, coord) - offset),
+                         iocount, value);
+        if(status != NC_NOERR)
+            break;
+        value += (iocount * memtypelen);
+        odo1(start, upper, coord, &upper[index], &coord[index]);
+    }
+
+    FREE_ONSTACK(upper);
+    FREE_ONSTACK(coord);
+    } /* end inline */
+
+    return status;
+}
+
 int
 NC3_get_vara(int ncid, int varid,
 	    const size_t *start, const size_t *edges0,
@@ -1798,9 +2037,6 @@ NC3_get_vara(int ncid, int varid,
     NC* nc;
     NC3_INFO* nc3;
     NC_var *varp;
-    int ii;
-    size_t iocount;
-    size_t memtypelen;
     signed char* value = (signed char*) value0; /* legally allow ptr arithmetic */
     const size_t* edges = edges0; /* so we can modify for special cases */
     size_t modedges[NC_MAX_VAR_DIMS];
@@ -1845,12 +2081,9 @@ NC3_get_vara(int ncid, int varid,
     if(status != NC_NOERR)
         return status;
 
-    /* Get the size of the memtype */
-    memtypelen = (size_t)nctypelen(memtype);
-
     if(varp->ndims == 0) /* scalar variable */
     {
-        return( readNCv(nc3, varp, start, 1, (void*)value, memtype) );
+        return( readNCv(nc3, varp, start, 1, 1, (void*)value, memtype) );
     }
 
     if(IS_RECVAR(varp))
@@ -1860,61 +2093,337 @@ NC3_get_vara(int ncid, int varid,
         if(varp->ndims == 1 && nc3->recsize <= varp->len)
         {
             /* one dimensional && the only record variable  */
-            return( readNCv(nc3, varp, start, *edges, (void*)value, memtype) );
+            return( readNCv(nc3, varp, start, *edges, 1, (void*)value, memtype) );
         }
     }
 
-    /*
-     * find max contiguous
-     *   and accumulate max count for a single io operation
-     */
-    ii = NCiocount(nc3, varp, edges, &iocount);
+    return getNCslab(nc3, varp, start, edges, value, memtype);
+}
 
-    if(ii == -1)
+/*
+ * Read hyperslabs of several variables. Record variables are
+ * interleaved record by record, so rather than going over the record
+ * section once per variable, fetch it once, a group of records per
+ * ncio_get, and pick out the part of every variable in each record,
+ * in file order.
+ */
+int
+NC3_get_vara_multi(int ncid, int nvars, const int *varids,
+	    const size_t *const *starts, const size_t *const *counts,
+	    void *const *values)
+{
+    int status = NC_NOERR;
+    NC* nc;
+    NC3_INFO* nc3;
+    const NC_var **varps = NULL;
+    size_t **edgesp = NULL;	/* edges of each request, see below */
+    int *order = NULL;		/* interleaved record variables, in file order */
+    int ii, jj, nrecvars = 0;
+    size_t recno, reclo = 0, rechi = 0;
+    size_t span, perget, nget;
+    off_t lo, hi = 0;
+
+    status = NC_check_id(ncid, &nc);
+    if(status != NC_NOERR)
+        return status;
+    nc3 = NC3_DATA(nc);
+
+    if(NC_indef(nc3))
+        return NC_EINDEFINE;
+
+    varps = (const NC_var **)calloc((size_t)nvars, sizeof(NC_var *));
+    edgesp = (size_t **)calloc((size_t)nvars, sizeof(size_t *));
+    order = (int *)calloc((size_t)nvars, sizeof(int));
+    if(varps == NULL || edgesp == NULL || order == NULL)
+        {status = NC_ENOMEM; goto done;}
+
+    /* Check every request before reading anything */
+    for(ii = 0; ii < nvars; ii++)
     {
-        return( readNCv(nc3, varp, start, iocount, (void*)value, memtype) );
+        NC_var *varp;
+        const size_t *start = starts[ii];
+
+        status = NC_lookupvar(nc3, varids[ii], &varp);
+        if(status != NC_NOERR)
+            goto done;
+        varps[ii] = varp;
+        if(varp->ndims == 0)
+            continue;
+        if(start == NULL)
+            {status = NC_EINVALCOORDS; goto done;}
+
+        /* Room for the edges, then the start and edges of one record */
+        edgesp[ii] = (size_t *)malloc(3 * varp->ndims * sizeof(size_t));
+        if(edgesp[ii] == NULL)
+            {status = NC_ENOMEM; goto done;}
+        if(counts[ii] != NULL)
+            (void)memcpy(edgesp[ii], counts[ii], varp->ndims * sizeof(size_t));
+        else
+        {
+            (void)memcpy(edgesp[ii], varp->shape, varp->ndims * sizeof(size_t));
+            if(IS_RECVAR(varp))
+                edgesp[ii][0] = NC_get_numrecs(nc3);
+        }
+
+        status = NCcoordck(nc3, varp, start);
+        if(status != NC_NOERR)
+            goto done;
+        status = NCedgeck(nc3, varp, start, edgesp[ii]);
+        if(status != NC_NOERR)
+            goto done;
+
+        /* nothing to read */
+        for(jj = 0; jj < (int)varp->ndims; jj++)
+            if(edgesp[ii][jj] == 0)
+                break;
+        if(jj < (int)varp->ndims)
+        {
+            varps[ii] = NULL;
+            continue;
+        }
+
+        if(IS_RECVAR(varp))
+        {
+            const size_t *edges = edgesp[ii];
+            if(*start + *edges > NC_get_numrecs(nc3))
+                {status = NC_EEDGE; goto done;}
+            if(!(varp->ndims == 1 && nc3->recsize <= varp->len))
+            {
+                if(nrecvars == 0 || *start < reclo)
+                    reclo = *start;
+                if(nrecvars == 0 || *start + *edges > rechi)
+                    rechi = *start + *edges;
+                /* insert in order of offset within a record */
+                for(jj = nrecvars; jj > 0 && varps[order[jj-1]]->begin > varp->begin; jj--)
+                    order[jj] = order[jj-1];
+                order[jj] = ii;
+                nrecvars++;
+            }
+        }
     }
 
-    assert(ii >= 0);
+    /* Everything that is not interleaved is read as by NC3_get_vara */
+    for(ii = 0; ii < nvars; ii++)
+    {
+        const NC_var *varp = varps[ii];
+        const size_t *start = starts[ii];
+        const size_t *edges = edgesp[ii];
+
+        if(varp == NULL)
+            continue;
+        if(varp->ndims == 0)
+            status = readNCv(nc3, varp, start, 1, 1, values[ii], varp->type);
+        else if(!IS_RECVAR(varp))
+            status = getNCslab(nc3, varp, start, edges, (signed char *)values[ii], varp->type);
+        else if(varp->ndims == 1 && nc3->recsize <= varp->len)
+            status = readNCv(nc3, varp, start, *edges, 1, values[ii], varp->type);
+        if(status != NC_NOERR)
+            goto done;
+    }
 
-    { /* inline */
-    ALLOC_ONSTACK(coord, size_t, varp->ndims);
-    ALLOC_ONSTACK(upper, size_t, varp->ndims);
-    const size_t index = (size_t)ii;
+    if(nrecvars == 0)
+        goto done;
 
-    /* copy in starting indices */
-    (void) memcpy(coord, start, varp->ndims * sizeof(size_t));
+    for(jj = 0; jj < nrecvars; jj++)
+    {
+        const int kk = order[jj];
+        const size_t ndims = varps[kk]->ndims;
 
-    /* set up in maximum indices */
-    set_upper(upper, start, edges, &upper[varp->ndims]);
+        (void)memcpy(edgesp[kk] + ndims, starts[kk], ndims * sizeof(size_t));
+        (void)memcpy(edgesp[kk] + 2 * ndims, edgesp[kk], ndims * sizeof(size_t));
+        edgesp[kk][2 * ndims] = 1;
+    }
 
-    /* ripple counter */
-    while(*coord < *upper)
+    /*
+     * Fetch the part of the record section holding the variables one
+     * ncio_get extent per group of records, as many records as fit in
+     * a chunk, and copy out each variable's slice of every record in
+     * it. The extent runs from the first variable in the first record
+     * of the group to the end of the last variable in its last record.
+     */
+    lo = varps[order[0]]->begin;
+    for(jj = 0; jj < nrecvars; jj++)
     {
-        const int lstatus = readNCv(nc3, varp, coord, iocount, (void*)value, memtype);
-	if(lstatus != NC_NOERR)
+        const NC_var *varp = varps[order[jj]];
+        size_t ndx, perrec = varp->xsz;
+        for(ndx = 1; ndx < varp->ndims; ndx++)
+            perrec *= varp->shape[ndx];
+        if(varp->begin + (off_t)perrec > hi)
+            hi = varp->begin + (off_t)perrec;
+    }
+    span = (size_t)(hi - lo);
+    if(ncio_resident(nc3->nciop))
+        perget = rechi - reclo; /* no copy is made, so take it all */
+    else if(span <= nc3->chunk)
+        perget = 1 + (nc3->chunk - span) / nc3->recsize;
+    else
+        perget = 1;
+
+    for(recno = reclo; recno < rechi; recno += nget)
+    {
+        const off_t offset = lo + (off_t)recno * (off_t)nc3->recsize;
+        size_t extent;
+        const void *xp;
+
+        nget = MIN(perget, rechi - recno);
+        extent = (nget - 1) * nc3->recsize + span;
+        if(extent > nc3->chunk && !ncio_resident(nc3->nciop))
+            xp = NULL; /* a record too big for one extent */
+        else
         {
-            if(lstatus != NC_ERANGE)
+            status = ncio_get(nc3->nciop, offset, extent, 0, (void **)&xp);
+            if(status != NC_NOERR)
+                goto done;
+        }
+
+        for(ii = 0; ii < (int)nget; ii++)
+        {
+            for(jj = 0; jj < nrecvars; jj++)
             {
-                status = lstatus;
-                /* fatal for the loop */
-                break;
+                const int kk = order[jj];
+                const NC_var *varp = varps[kk];
+                const size_t first = starts[kk][0];
+                const size_t rec = recno + (size_t)ii;
+                size_t *rstart = edgesp[kk] + varp->ndims;
+                size_t *redges = rstart + varp->ndims;
+                size_t ndx, perrec = (size_t)nctypelen(varp->type);
+                signed char *value;
+
+                if(rec < first || rec >= first + edgesp[kk][0])
+                    continue;
+                for(ndx = 1; ndx < varp->ndims; ndx++)
+                    perrec *= redges[ndx];
+                rstart[0] = rec;
+                value = (signed char *)values[kk] + (rec - first) * perrec;
+                if(xp != NULL)
+                    status = getNCslabx(nc3, varp, rstart, redges,
+                                        (const char *)xp, offset, value);
+                else
+                    status = getNCslab(nc3, varp, rstart, redges,
+                                       value, varp->type);
+                if(status != NC_NOERR)
+                    break;
             }
-            /* else NC_ERANGE, not fatal for the loop */
-            if(status == NC_NOERR)
-                status = lstatus;
+            if(status != NC_NOERR)
+                break;
         }
-        value += (iocount * memtypelen);
-        odo1(start, upper, coord, &upper[index], &coord[index]);
-    }
 
-    FREE_ONSTACK(upper);
-    FREE_ONSTACK(coord);
-    } /* end inline */
+        if(xp != NULL)
+            (void) ncio_rel(nc3->nciop, offset, 0);
+        if(status != NC_NOERR)
+            goto done;
+    }
 
+done:
+    if(edgesp != NULL)
+    {
+        for(ii = 0; ii < nvars; ii++)
+            free(edgesp[ii]);
+        free(edgesp);
+    }
+    free(order);
+    free(varps);
     return status;
 }
 
+/*
+ * Return in *datap a read-only pointer to the external bytes of a
+ * byte, ubyte or char hyperslab, straight out of the memory of a
+ * diskless, in-memory or mmap'd file. The slab has to be a single
+ * contiguous run in the file; see nc_get_vara_ptr().
+ */
+int
+NC3_get_vara_ptr(int ncid, int varid,
+	    const size_t *start, const size_t *edges0,
+            const void **datap)
+{
+    int status = NC_NOERR;
+    NC* nc;
+    NC3_INFO* nc3;
+    NC_var *varp;
+    int ii;
+    size_t iocount, nelems;
+    const size_t* edges = edges0;
+    size_t modedges[NC_MAX_VAR_DIMS];
+    void *xp = NULL;
+
+    if(datap == NULL)
+        return NC_EINVAL;
+    *datap = NULL;
+
+    status = NC_check_id(ncid, &nc);
+    if(status != NC_NOERR)
+        return status;
+    nc3 = NC3_DATA(nc);
+
+    if(NC_indef(nc3))
+        return NC_EINDEFINE;
+
+    if(!ncio_resident(nc3->nciop))
+        return NC_EINMEMORY;
+
+    status = NC_lookupvar(nc3, varid, &varp);
+    if(status != NC_NOERR)
+        return status;
+
+    switch(varp->type) {
+    case NC_BYTE: case NC_UBYTE: case NC_CHAR:
+        break;
+    default:
+        return NC_EBADTYPE;
+    }
+
+    /* As in NC3_get_vara, NULL edges means the whole variable */
+    if(edges == NULL && varp->ndims > 0) {
+	if(varp->shape[0] == 0) {
+	    (void)memcpy((void*)modedges,(void*)varp->shape,
+                          sizeof(size_t)*varp->ndims);
+	    modedges[0] = NC_get_numrecs(nc3);
+	    edges = modedges;
+	} else
+	    edges = varp->shape;
+    }
+
+    status = NCcoordck(nc3, varp, start);
+    if(status != NC_NOERR)
+        return status;
+
+    status = NCedgeck(nc3, varp, start, edges);
+    if(status != NC_NOERR)
+        return status;
+
+    if(varp->ndims == 0) /* scalar variable */
+    {
+        nelems = 1;
+    }
+    else
+    {
+        if(IS_RECVAR(varp) && *start + *edges > NC_get_numrecs(nc3))
+            return NC_EEDGE;
+
+        for(nelems = 1, ii = 0; ii < (int)varp->ndims; ii++)
+            nelems *= edges[ii];
+        if(nelems == 0)
+            return NC_NOERR;
+
+        /* The whole slab has to be one contiguous run */
+        ii = NCiocount(nc3, varp, edges, &iocount);
+        if(ii != -1 && iocount != nelems)
+            return NC_EINVAL;
+    }
+
+    status = ncio_get(nc3->nciop, NC_varoffset(nc3, varp, start),
+                      varp->xsz * nelems, 0, &xp);
+    if(status != NC_NOERR)
+        return status;
+    /* The memory stays put after the release; only a later
+     * write that grows the file or a close can move it. */
+    (void) ncio_rel(nc3->nciop, NC_varoffset(nc3, varp, start), 0);
+
+    *datap = xp;
+    return NC_NOERR;
+}
+
 int
 NC3_put_vara(int ncid, int varid,
 	    const size_t *start, const size_t *edges0,
@@ -1980,7 +2489,7 @@ NC3_put_vara(int ncid, int varid,
 
     if(varp->ndims == 0) /* scalar variable */
     {
-        return( writeNCv(nc3, varp, start, 1, (void*)value, memtype) );
+        return( writeNCv(nc3, varp, start, 1, 1, (void*)value, memtype) );
     }
 
     if(IS_RECVAR(varp))
@@ -1993,7 +2502,7 @@ NC3_put_vara(int ncid, int varid,
             && nc3->recsize <= varp->len)
         {
             /* one dimensional && the only record variable  */
-            return( writeNCv(nc3, varp, start, *edges, (void*)value, memtype) );
+            return( writeNCv(nc3, varp, start, *edges, 1, (void*)value, memtype) );
         }
     }
 
@@ -2005,7 +2514,7 @@ NC3_put_vara(int ncid, int varid,
 
     if(ii == -1)
     {
-        return( writeNCv(nc3, varp, start, iocount, (void*)value, memtype) );
+        return( writeNCv(nc3, varp, start, iocount, 1, (void*)value, memtype) );
     }
 
     assert(ii >= 0);
@@ -2024,7 +2533,7 @@ NC3_put_vara(int ncid, int varid,
     /* ripple counter */
     while(*coord < *upper)
     {
-        const int lstatus = writeNCv(nc3, varp, coord, iocount, (void*)value, memtype);
+        const int lstatus = writeNCv(nc3, varp, coord, iocount, 1, (void*)value, memtype);
         if(lstatus != NC_NOERR)
         {
             if(lstatus != NC_ERANGE)
@@ -2047,3 +2556,329 @@ NC3_put_vara(int ncid, int varid,
 
     return status;
 }
+
+/*
+ * Check the strides of a strided access, and normalize them into
+ * 'mystride': a stride along a dimension of which at most one index
+ * is used makes no difference, so it is taken to be one.
+ * Set *unitp if all the (normalized) strides are one.
+ */
+static int
+NCstrideck(const NC_var *varp, const size_t *edges,
+	const ptrdiff_t *stride, size_t *mystride, int *unitp)
+{
+	size_t ii;
+
+	*unitp = 1;
+	for(ii = 0; ii < varp->ndims; ii++)
+	{
+		/* cast needed for braindead systems with signed size_t */
+		if(stride[ii] <= 0 || (unsigned long) stride[ii] >= X_INT_MAX)
+			return NC_ESTRIDE;
+		mystride[ii] = edges[ii] > 1 ? (size_t)stride[ii] : 1;
+		if(mystride[ii] != 1)
+			*unitp = 0;
+	}
+	return NC_NOERR;
+}
+
+/*
+ * Split a strided hyperslab into runs that readNCv() or writeNCv()
+ * can each handle with one call: the first *nouterp dimensions are
+ * walked with an odometer, and every position of that odometer is
+ * a run of *nelemsp items, *stepp items apart. Trailing dimensions
+ * that are wanted whole fold into the run.
+ */
+static void
+NCstriderun(const NC_var *varp, const size_t *start, const size_t *edges,
+	const size_t *mystride,
+	size_t *nouterp, size_t *nelemsp, size_t *stepp)
+{
+	/* Records are not contiguous, so a run never spans one */
+	const size_t first = IS_RECVAR(varp) ? 1 : 0;
+	size_t jj = varp->ndims - 1;
+	size_t block = 1;
+
+	while(jj > first && mystride[jj] == 1
+		&& start[jj] == 0 && edges[jj] == varp->shape[jj])
+	{
+		block *= varp->shape[jj];
+		jj--;
+	}
+
+	if(jj < first)
+	{
+		/* one dimensional record variable: a record at a time */
+		*nouterp = varp->ndims;
+		*nelemsp = 1;
+		*stepp = 1;
+	}
+	else if(mystride[jj] == 1)
+	{
+		*nouterp = jj;
+		*nelemsp = edges[jj] * block;
+		*stepp = 1;
+	}
+	else if(block == 1)
+	{
+		*nouterp = jj;
+		*nelemsp = edges[jj];
+		*stepp = mystride[jj];
+	}
+	else
+	{
+		*nouterp = jj + 1;
+		*nelemsp = block;
+		*stepp = 1;
+	}
+}
+
+int
+NC3_get_vars(int ncid, int varid,
+	    const size_t *start, const size_t *edges,
+	    const ptrdiff_t *stride, void *value0,
+	    nc_type memtype)
+{
+    int status = NC_NOERR;
+    NC* nc;
+    NC3_INFO* nc3;
+    NC_var *varp;
+    int unit, dd;
+    size_t ii, nouter, nelems, step;
+    size_t memtypelen;
+    signed char* value = (signed char*) value0; /* legally allow ptr arithmetic */
+    size_t mystride[NC_MAX_VAR_DIMS];
+    size_t reach[NC_MAX_VAR_DIMS];
+
+    if(stride == NULL || edges == NULL)
+        return NC3_get_vara(ncid, varid, start, edges, value0, memtype);
+
+    status = NC_check_id(ncid, &nc);
+    if(status != NC_NOERR)
+        return status;
+    nc3 = NC3_DATA(nc);
+
+    if(NC_indef(nc3))
+        return NC_EINDEFINE;
+
+    status = NC_lookupvar(nc3, varid, &varp);
+    if(status != NC_NOERR)
+        return status;
+
+    if(memtype == NC_NAT) memtype=varp->type;
+
+    if(memtype == NC_CHAR && varp->type != NC_CHAR)
+        return NC_ECHAR;
+    else if(memtype != NC_CHAR && varp->type == NC_CHAR)
+        return NC_ECHAR;
+
+    if(varp->ndims > 0 && start == NULL)
+        return NC_EINVALCOORDS;
+
+    status = NCstrideck(varp, edges, stride, mystride, &unit);
+    if(status != NC_NOERR)
+        return status;
+
+    if(unit)
+        return NC3_get_vara(ncid, varid, start, edges, value0, memtype);
+
+    status = NCcoordck(nc3, varp, start);
+    if(status != NC_NOERR)
+        return status;
+
+    status = NCedgeck(nc3, varp, start, edges);
+    if(status != NC_NOERR)
+        return status;
+
+    for(ii = 0; ii < varp->ndims; ii++)
+    {
+        if(edges[ii] == 0)
+            return NC_NOERR; /* nothing to get */
+        reach[ii] = (edges[ii] - 1) * mystride[ii] + 1;
+    }
+
+    /* The last index touched has to be in range too */
+    status = NCedgeck(nc3, varp, start, reach);
+    if(status != NC_NOERR)
+        return status;
+
+    if(IS_RECVAR(varp) && *start + *reach > NC_get_numrecs(nc3))
+        return NC_EEDGE;
+
+    memtypelen = (size_t)nctypelen(memtype);
+
+    NCstriderun(varp, start, edges, mystride, &nouter, &nelems, &step);
+
+    { /* inline */
+    ALLOC_ONSTACK(coord, size_t, varp->ndims);
+    ALLOC_ONSTACK(odom, size_t, varp->ndims);
+
+    (void) memcpy(coord, start, varp->ndims * sizeof(size_t));
+    (void) memset(odom, 0, varp->ndims * sizeof(size_t));
+
+    for(;;)
+    {
+        const int lstatus = readNCv(nc3, varp, coord, nelems, step, (void*)value, memtype);
+        if(lstatus != NC_NOERR)
+        {
+            if(lstatus != NC_ERANGE)
+            {
+                status = lstatus;
+                /* fatal for the loop */
+                break;
+            }
+            /* else NC_ERANGE, not fatal for the loop */
+            if(status == NC_NOERR)
+                status = lstatus;
+        }
+        value += (nelems * memtypelen);
+
+        /* odometer over the outer dimensions */
+        for(dd = (int)nouter - 1; dd >= 0; dd--)
+        {
+            if(++odom[dd] < edges[dd])
+            {
+                coord[dd] += mystride[dd];
+                break;
+            }
+            odom[dd] = 0;
+            coord[dd] = start[dd];
+        }
+        if(dd < 0)
+            break; /* normal loop exit */
+    }
+
+    FREE_ONSTACK(odom);
+    FREE_ONSTACK(coord);
+    } /* end inline */
+
+    return status;
+}
+
+int
+NC3_put_vars(int ncid, int varid,
+	    const size_t *start, const size_t *edges,
+	    const ptrdiff_t *stride, const void *value0,
+	    nc_type memtype)
+{
+    int status = NC_NOERR;
+    NC* nc;
+    NC3_INFO* nc3;
+    NC_var *varp;
+    int unit, dd;
+    size_t ii, nouter, nelems, step;
+    size_t memtypelen;
+    signed char* value = (signed char*) value0; /* legally allow ptr arithmetic */
+    size_t mystride[NC_MAX_VAR_DIMS];
+    size_t reach[NC_MAX_VAR_DIMS];
+
+    if(stride == NULL || edges == NULL)
+        return NC3_put_vara(ncid, varid, start, edges, value0, memtype);
+
+    status = NC_check_id(ncid, &nc);
+    if(status != NC_NOERR)
+        return status;
+    nc3 = NC3_DATA(nc);
+
+    if(NC_readonly(nc3))
+        return NC_EPERM;
+
+    if(NC_indef(nc3))
+        return NC_EINDEFINE;
+
+    status = NC_lookupvar(nc3, varid, &varp);
+    if(status != NC_NOERR)
+       return status; /*invalid varid */
+
+    if(memtype == NC_NAT) memtype=varp->type;
+
+    if(memtype == NC_CHAR && varp->type != NC_CHAR)
+        return NC_ECHAR;
+    else if(memtype != NC_CHAR && varp->type == NC_CHAR)
+        return NC_ECHAR;
+
+    if(varp->ndims > 0 && start == NULL)
+        return NC_EINVALCOORDS;
+
+    status = NCstrideck(varp, edges, stride, mystride, &unit);
+    if(status != NC_NOERR)
+        return status;
+
+    if(unit)
+        return NC3_put_vara(ncid, varid, start, edges, value0, memtype);
+
+    status = NCcoordck(nc3, varp, start);
+    if(status != NC_NOERR)
+        return status;
+    status = NCedgeck(nc3, varp, start, edges);
+    if(status != NC_NOERR)
+        return status;
+
+    for(ii = 0; ii < varp->ndims; ii++)
+    {
+        if(edges[ii] == 0)
+            return NC_NOERR; /* nothing to put */
+        reach[ii] = (edges[ii] - 1) * mystride[ii] + 1;
+    }
+
+    /* The last index touched has to be in range too */
+    status = NCedgeck(nc3, varp, start, reach);
+    if(status != NC_NOERR)
+        return status;
+
+    if(IS_RECVAR(varp))
+    {
+        status = NCvnrecs(nc3, *start + *reach);
+        if(status != NC_NOERR)
+            return status;
+    }
+
+    memtypelen = (size_t)nctypelen(memtype);
+
+    NCstriderun(varp, start, edges, mystride, &nouter, &nelems, &step);
+
+    { /* inline */
+    ALLOC_ONSTACK(coord, size_t, varp->ndims);
+    ALLOC_ONSTACK(odom, size_t, varp->ndims);
+
+    (void) memcpy(coord, start, varp->ndims * sizeof(size_t));
+    (void) memset(odom, 0, varp->ndims * sizeof(size_t));
+
+    for(;;)
+    {
+        const int lstatus = writeNCv(nc3, varp, coord, nelems, step, (void*)value, memtype);
+        if(lstatus != NC_NOERR)
+        {
+            if(lstatus != NC_ERANGE)
+            {
+                status = lstatus;
+                /* fatal for the loop */
+                break;
+            }
+            /* else NC_ERANGE, not fatal for the loop */
+            if(status == NC_NOERR)
+                status = lstatus;
+        }
+        value += (nelems * memtypelen);
+
+        /* odometer over the outer dimensions */
+        for(dd = (int)nouter - 1; dd >= 0; dd--)
+        {
+            if(++odom[dd] < edges[dd])
+            {
+                coord[dd] += mystride[dd];
+                break;
+            }
+            odom[dd] = 0;
+            coord[dd] = start[dd];
+        }
+        if(dd < 0)
+            break; /* normal loop exit */
+    }
+
+    FREE_ONSTACK(odom);
+    FREE_ONSTACK(coord);
+    } /* end inline */
+
+    return status;
+}
@@ -2182,6 +2182,8 @@ NC_NOTNC4_def_var_quantize,
 NC_NOTNC4_inq_var_quantize,
 
 NC_NOOP_inq_filter_avail,
+
+NCDEFAULT_get_vara_multi,
 };
 
 /** @internal Pointer to the PnetCDF dispatch table. */
@@ -0,0 +1,128 @@
+/*
+  Copyright 2018, UCAR/Unidata
+  See COPYRIGHT file for copying and redistribution conditions.
+
+  This program benchmarks a record-by-record scan of a CDF5 file with
+  and without the posixio read-ahead window (the NETCDF.READAHEAD and
+  NETCDF.READAHEAD.SIZE .rc keys).
+
+  The file's pages are dropped from the page cache before each scan,
+  where the system allows it, so that the reads go to the disk.
+
+  Usage: bm_readahead [megabytes [extents [extent_size]]]
+*/
+
+#include <nc_tests.h>
+#include <err_macros.h>
+#include <time.h>
+#include <sys/time.h> /* Extra high precision time info. */
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#define FILE_NAME "bm_readahead.nc"
+#define MILLION 1000000
+#define NVARS 8
+#define NX 32768 /* floats per record of each variable */
+
+/* Prototype from tst_utils.c. */
+int nc4_timeval_subtract(struct timeval *result, struct timeval *x,
+                         struct timeval *y);
+
+/* Ask the system to forget the cached pages of the file */
+static void
+drop_cache(void)
+{
+#ifdef POSIX_FADV_DONTNEED
+    int fd;
+    if ((fd = open(FILE_NAME, O_RDONLY)) >= 0)
+    {
+        (void)fsync(fd);
+        (void)posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        close(fd);
+    }
+#endif
+}
+
+/* Read every record of every variable, converting to double, and
+ * return the time taken in seconds. */
+static int
+scan(size_t nrec, double *data, double *secs)
+{
+    struct timeval start_time, end_time, diff_time;
+    size_t start[2] = {0, 0}, count[2] = {1, NX};
+    int ncid, v;
+
+    drop_cache();
+    if (gettimeofday(&start_time, NULL)) ERR;
+    if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+    for (start[0] = 0; start[0] < nrec; start[0]++)
+        for (v = 0; v < NVARS; v++)
+            if (nc_get_vara_double(ncid, v, start, count, data)) ERR;
+    if (nc_close(ncid)) ERR;
+    if (gettimeofday(&end_time, NULL)) ERR;
+    if (nc4_timeval_subtract(&diff_time, &end_time, &start_time)) ERR;
+    *secs = (double)diff_time.tv_sec + (double)diff_time.tv_usec / MILLION;
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    size_t mb = 512, nrec, r;
+    const char *extents = "8";
+    const char *extent_size = "1048576";
+    size_t start[2] = {0, 0}, count[2] = {1, NX};
+    int ncid, dimid[2], varid, v, x;
+    float *fdata;
+    double *data;
+    double off_secs, on_secs;
+    char name[NC_MAX_NAME + 1];
+
+    if (argc > 1) mb = (size_t)atol(argv[1]);
+    if (argc > 2) extents = argv[2];
+    if (argc > 3) extent_size = argv[3];
+    nrec = (mb * 1048576) / (NVARS * NX * sizeof(float));
+    if (nrec == 0) nrec = 1;
+
+    printf("Benchmarking read-ahead on a %d MB scan...\n",
+           (int)(nrec * NVARS * NX * sizeof(float) / 1048576));
+    if (!(fdata = malloc(NX * sizeof(float)))) ERR;
+    if (!(data = malloc(NX * sizeof(double)))) ERR;
+    for (x = 0; x < NX; x++)
+        fdata[x] = (float)x;
+
+    /* Create the file. */
+    if (nc_create(FILE_NAME, NC_CLOBBER|NC_64BIT_DATA, &ncid)) ERR;
+    if (nc_def_dim(ncid, "rec", NC_UNLIMITED, &dimid[0])) ERR;
+    if (nc_def_dim(ncid, "x", NX, &dimid[1])) ERR;
+    for (v = 0; v < NVARS; v++)
+    {
+        snprintf(name, sizeof(name), "var_%d", v);
+        if (nc_def_var(ncid, name, NC_FLOAT, 2, dimid, &varid)) ERR;
+    }
+    if (nc_enddef(ncid)) ERR;
+    for (r = 0; r < nrec; r++)
+    {
+        start[0] = r;
+        for (v = 0; v < NVARS; v++)
+            if (nc_put_vara_float(ncid, v, start, count, fdata)) ERR;
+    }
+    if (nc_close(ncid)) ERR;
+
+    if (nc_rc_set("NETCDF.READAHEAD", "0")) ERR;
+    if (scan(nrec, data, &off_secs)) ERR;
+    if (nc_rc_set("NETCDF.READAHEAD", extents)) ERR;
+    if (nc_rc_set("NETCDF.READAHEAD.SIZE", extent_size)) ERR;
+    if (scan(nrec, data, &on_secs)) ERR;
+
+    printf("read-ahead\textents\tsize\tread time(s)\n");
+    printf("off\t\t-\t-\t%.3f\n", off_secs);
+    printf("on\t\t%s\t%s\t%.3f\n", extents, extent_size, on_secs);
+
+    free(fdata);
+    free(data);
+    (void)remove(FILE_NAME);
+    FINAL_RESULTS;
+}
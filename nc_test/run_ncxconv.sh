@@ -0,0 +1,24 @@
+#!/bin/sh
+
+if test "x$srcdir" = x ; then srcdir=`pwd`; fi
+. ../test_common.sh
+
+set -e
+
+# Check the classic format conversions with the widest vector kernels
+# the cpu has, then capped to SSE2 and to the scalar code, so every
+# path is exercised on one machine.
+
+echo ""
+echo "*** Testing ncx conversions with the default kernels"
+${execdir}/tst_ncxconv
+
+echo ""
+echo "*** Testing ncx conversions with the SSE2 kernels"
+NETCDF_NCX_SIMD=sse2 ${execdir}/tst_ncxconv
+
+echo ""
+echo "*** Testing ncx conversions without vector kernels"
+NETCDF_NCX_SIMD=none ${execdir}/tst_ncxconv
+
+exit 0
@@ -0,0 +1,203 @@
+/* This is part of the netCDF package. Copyright 2018 University
+   Corporation for Atmospheric Research/Unidata. See COPYRIGHT file
+   for conditions of use.
+
+   Test nc_get_vara_ptr() and reads of diskless, in-memory and mmap'd
+   classic files.
+*/
+
+#include "config.h"
+#include <nc_tests.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "err_macros.h"
+#include "netcdf.h"
+#include "netcdf_mem.h"
+
+#define FILE_NAME "tst_getptr.nc"
+#define NY 3
+#define NX 4
+#define NREC 2
+#define NS 6000 /* more than a page of shorts */
+
+static const signed char bdata[NY*NX] = {0,1,2,3, 10,11,12,13, -20,-21,-22,-23};
+static const char cdata[NREC][NX] = {{'a','b','c','d'},{'e','f','g','h'}};
+static const unsigned char udata[NREC] = {200, 201};
+static short sdata[NS];
+
+/* Create the test file with the given mode; leave it open in data mode */
+static int
+create_file(const char* path, int cmode, int* ncidp)
+{
+    int ncid, dimids[2], rdimids[2], varid, i;
+    size_t start[2] = {0,0}, count[2] = {NREC,NX};
+
+    for(i = 0; i < NS; i++) sdata[i] = (short)(i - NS/2);
+
+    if(nc_create(path, cmode, &ncid)) ERR;
+    if(nc_def_dim(ncid, "rec", NC_UNLIMITED, &rdimids[0])) ERR;
+    if(nc_def_dim(ncid, "y", NY, &dimids[0])) ERR;
+    if(nc_def_dim(ncid, "x", NX, &dimids[1])) ERR;
+    rdimids[1] = dimids[1];
+    if(nc_def_var(ncid, "b", NC_BYTE, 2, dimids, &varid)) ERR;
+    if(nc_def_var(ncid, "f", NC_FLOAT, 2, dimids, &varid)) ERR;
+    if(nc_def_dim(ncid, "s", NS, &dimids[0])) ERR;
+    if(nc_def_var(ncid, "s", NC_SHORT, 1, dimids, &varid)) ERR;
+    if(nc_def_var(ncid, "c", NC_CHAR, 2, rdimids, &varid)) ERR;
+    if(nc_def_var(ncid, "u", NC_BYTE, 0, NULL, &varid)) ERR;
+    if(nc_def_var(ncid, "r", NC_BYTE, 1, rdimids, &varid)) ERR;
+    if(nc_enddef(ncid)) ERR;
+
+    if(nc_put_var_schar(ncid, 0, bdata)) ERR;
+    if(nc_put_var_short(ncid, 2, sdata)) ERR;
+    if(nc_put_vara_text(ncid, 3, start, count, &cdata[0][0])) ERR;
+    if(nc_put_var_schar(ncid, 4, (const signed char*)&udata[0])) ERR;
+    if(nc_put_vara_schar(ncid, 5, start, count, (const signed char*)udata)) ERR;
+    *ncidp = ncid;
+    return 0;
+}
+
+/* Check every nc_get_vara_ptr() case against an open resident file */
+static int
+check_ptrs(int ncid)
+{
+    const void* p = NULL;
+    size_t start[2], count[2];
+    short s[NS];
+
+    /* Whole fixed variable */
+    if(nc_get_vara_ptr(ncid, 0, (size_t[]){0,0}, NULL, &p)) ERR;
+    if(memcmp(p, bdata, sizeof(bdata))) ERR;
+
+    /* Trailing rows */
+    start[0] = 1; start[1] = 0; count[0] = 2; count[1] = NX;
+    if(nc_get_vara_ptr(ncid, 0, start, count, &p)) ERR;
+    if(memcmp(p, bdata + NX, 2*NX)) ERR;
+
+    /* Part of one row */
+    start[0] = 2; start[1] = 1; count[0] = 1; count[1] = 3;
+    if(nc_get_vara_ptr(ncid, 0, start, count, &p)) ERR;
+    if(memcmp(p, bdata + 2*NX + 1, 3)) ERR;
+
+    /* Two partial rows are not one run */
+    start[0] = 0; start[1] = 1; count[0] = 2; count[1] = 2;
+    if(nc_get_vara_ptr(ncid, 0, start, count, &p) != NC_EINVAL) ERR;
+    if(p != NULL) ERR;
+
+    /* Empty slab */
+    count[0] = 0;
+    if(nc_get_vara_ptr(ncid, 0, start, count, &p)) ERR;
+    if(p != NULL) ERR;
+
+    /* Bad coordinates */
+    start[0] = NY; start[1] = 0; count[0] = 1; count[1] = NX;
+    if(nc_get_vara_ptr(ncid, 0, start, count, &p) != NC_EINVALCOORDS) ERR;
+
+    /* Only byte, ubyte and char */
+    if(nc_get_vara_ptr(ncid, 1, (size_t[]){0,0}, NULL, &p) != NC_EBADTYPE) ERR;
+    if(nc_get_vara_ptr(ncid, 2, (size_t[]){0}, NULL, &p) != NC_EBADTYPE) ERR;
+    if(nc_get_vara_ptr(ncid, 0, (size_t[]){0,0}, NULL, NULL) != NC_EINVAL) ERR;
+
+    /* One record at a time of a record variable that is not alone */
+    start[0] = 1; start[1] = 0; count[0] = 1; count[1] = NX;
+    if(nc_get_vara_ptr(ncid, 3, start, count, &p)) ERR;
+    if(memcmp(p, cdata[1], NX)) ERR;
+    start[0] = 0; count[0] = 2;
+    if(nc_get_vara_ptr(ncid, 3, start, count, &p) != NC_EINVAL) ERR;
+    start[0] = 1; count[0] = 2;
+    if(nc_get_vara_ptr(ncid, 3, start, count, &p) != NC_EEDGE) ERR;
+
+    /* Scalar */
+    if(nc_get_vara_ptr(ncid, 4, NULL, NULL, &p)) ERR;
+    if(*(const unsigned char*)p != udata[0]) ERR;
+
+    /* Each record of the 1-d record variable */
+    start[0] = 1; count[0] = 1;
+    if(nc_get_vara_ptr(ncid, 5, start, count, &p)) ERR;
+    if(*(const unsigned char*)p != udata[1]) ERR;
+
+    /* Ordinary reads still agree */
+    memset(s, 0, sizeof(s));
+    if(nc_get_var_short(ncid, 2, s)) ERR;
+    if(memcmp(s, sdata, sizeof(s))) ERR;
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    int ncid;
+    const void* p = NULL;
+
+    printf("\n*** Testing nc_get_vara_ptr.\n");
+    printf("*** testing diskless create...");
+    {
+        if(create_file(FILE_NAME, NC_CLOBBER|NC_DISKLESS|NC_PERSIST, &ncid)) ERR;
+        if(check_ptrs(ncid)) ERR;
+        if(nc_redef(ncid)) ERR;
+        if(nc_get_vara_ptr(ncid, 0, (size_t[]){0,0}, NULL, &p) != NC_EINDEFINE) ERR;
+        if(nc_close(ncid)) ERR;
+    }
+    SUMMARIZE_ERR;
+    printf("*** testing ordinary file...");
+    {
+        if(nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+        if(nc_get_vara_ptr(ncid, 0, (size_t[]){0,0}, NULL, &p) != NC_EINMEMORY) ERR;
+        if(nc_close(ncid)) ERR;
+    }
+    SUMMARIZE_ERR;
+    printf("*** testing diskless open...");
+    {
+        if(nc_open(FILE_NAME, NC_NOWRITE|NC_DISKLESS, &ncid)) ERR;
+        if(check_ptrs(ncid)) ERR;
+        if(nc_close(ncid)) ERR;
+    }
+    SUMMARIZE_ERR;
+    printf("*** testing nc_open_mem...");
+    {
+        FILE* f;
+        long size;
+        char* mem;
+
+        if(!(f = fopen(FILE_NAME, "rb"))) ERR;
+        if(fseek(f, 0, SEEK_END)) ERR;
+        if((size = ftell(f)) <= 0) ERR;
+        rewind(f);
+        if(!(mem = malloc((size_t)size))) ERR;
+        if(fread(mem, 1, (size_t)size, f) != (size_t)size) ERR;
+        fclose(f);
+
+        if(nc_open_mem(FILE_NAME, NC_NOWRITE, (size_t)size, mem, &ncid)) ERR;
+        if(check_ptrs(ncid)) ERR;
+        /* No copy: the pointer is into the caller's memory */
+        if(nc_get_vara_ptr(ncid, 0, (size_t[]){0,0}, NULL, &p)) ERR;
+        if((const char*)p < mem || (const char*)p >= mem + size) ERR;
+        if(nc_close(ncid)) ERR;
+        free(mem);
+    }
+    SUMMARIZE_ERR;
+#ifdef USE_MMAP
+    printf("*** testing mmap open...");
+    {
+        if(nc_open(FILE_NAME, NC_NOWRITE|NC_MMAP, &ncid)) ERR;
+        if(check_ptrs(ncid)) ERR;
+        if(nc_close(ncid)) ERR;
+    }
+    SUMMARIZE_ERR;
+#endif
+#ifdef USE_HDF5
+    printf("*** testing netCDF-4 file...");
+    {
+        int varid;
+
+        if(nc_create(FILE_NAME, NC_CLOBBER|NC_NETCDF4|NC_DISKLESS, &ncid)) ERR;
+        if(nc_def_var(ncid, "b", NC_BYTE, 0, NULL, &varid)) ERR;
+        if(nc_enddef(ncid)) ERR;
+        if(nc_get_vara_ptr(ncid, varid, NULL, NULL, &p) != NC_ENOTNC3) ERR;
+        if(nc_close(ncid)) ERR;
+    }
+    SUMMARIZE_ERR;
+#endif
+    FINAL_RESULTS;
+}
@@ -0,0 +1,260 @@
+/* This is part of the netCDF package. Copyright 2018 University
+   Corporation for Atmospheric Research/Unidata. See COPYRIGHT file
+   for conditions of use.
+
+   Test nc_get_vara_multi() against one nc_get_vara() per variable.
+*/
+
+#include "config.h"
+#include <nc_tests.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "err_macros.h"
+#include "netcdf.h"
+
+#define FILE_NAME "tst_multi.nc"
+#define NREC 7
+#define NY 3
+#define NX 5
+#define NFIX 4
+#define NB 40
+#define NVARS 7
+/* I/O chunks that hold a few records, and less than one of b */
+#define SMALLCHUNK 1024
+#define TINYCHUNK 256
+
+/* Variables in definition order; the record variables are defined
+   in a different order from their use below. */
+#define V_SCALAR 0
+#define V_FIX 1
+#define V_REC_SHORT 2
+#define V_REC_DOUBLE 3
+#define V_REC_CHAR 4
+#define V_REC_INT 5
+#define V_REC_BIG 6
+
+static short sdata[NREC][NY][NX];
+static double ddata[NREC][NX];
+static char cdata[NREC][NY];
+static int idata[NREC];
+static double bdata[NREC][NB];
+static float fdata[NFIX][NX];
+static double scalar = 3.25;
+
+static int
+create_file(int cmode)
+{
+    int ncid, dimids[3], varid, r, y, x;
+
+    for(r = 0; r < NREC; r++) {
+        for(y = 0; y < NY; y++) {
+            for(x = 0; x < NX; x++)
+                sdata[r][y][x] = (short)(r*100 + y*10 + x);
+            cdata[r][y] = (char)('a' + r*NY + y);
+        }
+        for(x = 0; x < NX; x++)
+            ddata[r][x] = r + x/8.0;
+        idata[r] = -r;
+        for(x = 0; x < NB; x++)
+            bdata[r][x] = r*1000 + x;
+    }
+    for(y = 0; y < NFIX; y++)
+        for(x = 0; x < NX; x++)
+            fdata[y][x] = (float)(y*NX + x);
+
+    if(nc_create(FILE_NAME, cmode, &ncid)) ERR;
+    if(nc_def_dim(ncid, "rec", NC_UNLIMITED, &dimids[0])) ERR;
+    if(nc_def_dim(ncid, "y", NY, &dimids[1])) ERR;
+    if(nc_def_dim(ncid, "x", NX, &dimids[2])) ERR;
+    if(nc_def_var(ncid, "scalar", NC_DOUBLE, 0, NULL, &varid)) ERR;
+    {
+        int fdimids[2];
+        if(nc_def_dim(ncid, "fix", NFIX, &fdimids[0])) ERR;
+        fdimids[1] = dimids[2];
+        if(nc_def_var(ncid, "f", NC_FLOAT, 2, fdimids, &varid)) ERR;
+    }
+    if(nc_def_var(ncid, "s", NC_SHORT, 3, dimids, &varid)) ERR;
+    {
+        int ddimids[2];
+        ddimids[0] = dimids[0]; ddimids[1] = dimids[2];
+        if(nc_def_var(ncid, "d", NC_DOUBLE, 2, ddimids, &varid)) ERR;
+    }
+    if(nc_def_var(ncid, "c", NC_CHAR, 2, dimids, &varid)) ERR;
+    if(nc_def_var(ncid, "i", NC_INT, 1, dimids, &varid)) ERR;
+    {
+        int bdimids[2];
+        bdimids[0] = dimids[0];
+        if(nc_def_dim(ncid, "nb", NB, &bdimids[1])) ERR;
+        if(nc_def_var(ncid, "b", NC_DOUBLE, 2, bdimids, &varid)) ERR;
+    }
+    if(nc_enddef(ncid)) ERR;
+
+    if(nc_put_var(ncid, V_SCALAR, &scalar)) ERR;
+    if(nc_put_var(ncid, V_FIX, fdata)) ERR;
+    {
+        size_t start[3] = {0,0,0}, count[3] = {NREC,NY,NX};
+        if(nc_put_vara(ncid, V_REC_SHORT, start, count, sdata)) ERR;
+        count[1] = NX;
+        if(nc_put_vara(ncid, V_REC_DOUBLE, start, count, ddata)) ERR;
+        count[1] = NY;
+        if(nc_put_vara(ncid, V_REC_CHAR, start, count, cdata)) ERR;
+        if(nc_put_vara(ncid, V_REC_INT, start, count, idata)) ERR;
+        count[1] = NB;
+        if(nc_put_vara(ncid, V_REC_BIG, start, count, bdata)) ERR;
+    }
+    if(nc_close(ncid)) ERR;
+    return 0;
+}
+
+/* Read the given requests both ways and compare */
+static int
+check_multi(int ncid, int nvars, const int *varids,
+            const size_t *const *starts, const size_t *const *counts)
+{
+    static const size_t sizes[NVARS] = {
+        sizeof(double), sizeof(float), sizeof(short),
+        sizeof(double), sizeof(char), sizeof(int), sizeof(double)};
+    void *want[NVARS], *got[NVARS];
+    size_t nbytes[NVARS];
+    int i, ndims, d;
+
+    for(i = 0; i < nvars; i++) {
+        size_t n = 1, shape[NC_MAX_VAR_DIMS];
+        int dimids[NC_MAX_VAR_DIMS];
+        if(nc_inq_varndims(ncid, varids[i], &ndims)) ERR;
+        if(nc_inq_vardimid(ncid, varids[i], dimids)) ERR;
+        for(d = 0; d < ndims; d++) {
+            if(nc_inq_dimlen(ncid, dimids[d], &shape[d])) ERR;
+            n *= counts[i] ? counts[i][d] : shape[d];
+        }
+        nbytes[i] = n * sizes[varids[i]];
+        if(!(want[i] = calloc(1, nbytes[i] + 1))) ERR;
+        if(!(got[i] = calloc(1, nbytes[i] + 1))) ERR;
+        if(nc_get_vara(ncid, varids[i], starts[i], counts[i], want[i])) ERR;
+    }
+    if(nc_get_vara_multi(ncid, nvars, varids, starts, counts, got)) ERR;
+    for(i = 0; i < nvars; i++) {
+        if(memcmp(want[i], got[i], nbytes[i] + 1)) ERR;
+        free(want[i]);
+        free(got[i]);
+    }
+    return 0;
+}
+
+static int
+run_checks(int ncid)
+{
+    /* Every variable, whole */
+    {
+        int varids[NVARS] = {V_REC_INT, V_REC_SHORT, V_FIX, V_REC_CHAR,
+                             V_SCALAR, V_REC_BIG, V_REC_DOUBLE};
+        size_t z[3] = {0,0,0};
+        const size_t *starts[NVARS] = {z, z, z, z, NULL, z, z};
+        const size_t *counts[NVARS] = {NULL, NULL, NULL, NULL, NULL, NULL, NULL};
+        if(check_multi(ncid, NVARS, varids, starts, counts)) ERR;
+    }
+
+    /* The small record variables, whole */
+    {
+        int varids[4] = {V_REC_INT, V_REC_SHORT, V_REC_CHAR, V_REC_DOUBLE};
+        size_t z[3] = {0,0,0};
+        const size_t *starts[4] = {z, z, z, z};
+        const size_t *counts[4] = {NULL, NULL, NULL, NULL};
+        if(check_multi(ncid, 4, varids, starts, counts)) ERR;
+    }
+
+    /* Overlapping but different record ranges and inner slabs */
+    {
+        int varids[4] = {V_REC_CHAR, V_REC_DOUBLE, V_REC_SHORT, V_REC_INT};
+        size_t cs[2] = {5,1}, cc[2] = {2,2};
+        size_t ds[2] = {0,2}, dc[2] = {3,3};
+        size_t ss[3] = {2,1,1}, sc[3] = {4,2,3};
+        size_t is[1] = {6}, ic[1] = {1};
+        const size_t *starts[4] = {cs, ds, ss, is};
+        const size_t *counts[4] = {cc, dc, sc, ic};
+        if(check_multi(ncid, 4, varids, starts, counts)) ERR;
+    }
+
+    /* The same variable twice, one empty request, and a fixed slab */
+    {
+        int varids[4] = {V_REC_SHORT, V_REC_SHORT, V_REC_DOUBLE, V_FIX};
+        size_t s1[3] = {0,0,0}, c1[3] = {2,NY,NX};
+        size_t s2[3] = {1,2,0}, c2[3] = {5,1,NX};
+        size_t s3[2] = {NREC,0}, c3[2] = {0,NX};
+        size_t s4[2] = {1,1}, c4[2] = {2,3};
+        const size_t *starts[4] = {s1, s2, s3, s4};
+        const size_t *counts[4] = {c1, c2, c3, c4};
+        if(check_multi(ncid, 4, varids, starts, counts)) ERR;
+    }
+
+    /* Errors */
+    {
+        int varids[2] = {V_REC_SHORT, V_REC_INT};
+        size_t s1[3] = {0,0,0}, c1[3] = {1,NY,NX};
+        size_t s2[1] = {NREC-1}, c2[1] = {2};
+        const size_t *starts[2] = {s1, s2};
+        const size_t *counts[2] = {c1, c2};
+        short sbuf[NY*NX];
+        int ibuf[2];
+        void *bufs[2] = {sbuf, ibuf};
+
+        if(nc_get_vara_multi(ncid, 2, varids, starts, counts, bufs) != NC_EEDGE) ERR;
+        c2[0] = 1;
+        if(nc_get_vara_multi(ncid, 2, varids, starts, counts, bufs)) ERR;
+        if(ibuf[0] != idata[NREC-1]) ERR;
+        varids[1] = NVARS;
+        if(nc_get_vara_multi(ncid, 2, varids, starts, counts, bufs) != NC_ENOTVAR) ERR;
+        if(nc_get_vara_multi(ncid, -1, varids, starts, counts, bufs) != NC_EINVAL) ERR;
+        if(nc_get_vara_multi(ncid, 2, varids, starts, counts, NULL) != NC_EINVAL) ERR;
+        if(nc_get_vara_multi(ncid, 0, NULL, NULL, NULL, NULL)) ERR;
+    }
+    return 0;
+}
+
+static int
+test_multi(int cmode)
+{
+    int ncid;
+
+    if(create_file(cmode)) ERR;
+    if(nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+    if(run_checks(ncid)) ERR;
+    if(nc_close(ncid)) ERR;
+
+    if(!(cmode & NC_NETCDF4)) {
+        /* Groups of records cut short by the chunk */
+        size_t chunk = SMALLCHUNK;
+        if(nc__open(FILE_NAME, NC_NOWRITE, &chunk, &ncid)) ERR;
+        if(run_checks(ncid)) ERR;
+        if(nc_close(ncid)) ERR;
+        /* Records too big for one chunk */
+        chunk = TINYCHUNK;
+        if(nc__open(FILE_NAME, NC_NOWRITE, &chunk, &ncid)) ERR;
+        if(run_checks(ncid)) ERR;
+        if(nc_close(ncid)) ERR;
+        /* In memory, where every record goes in one extent */
+        if(nc_open(FILE_NAME, NC_NOWRITE|NC_DISKLESS, &ncid)) ERR;
+        if(run_checks(ncid)) ERR;
+        if(nc_close(ncid)) ERR;
+    }
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    printf("\n*** Testing nc_get_vara_multi.\n");
+    printf("*** testing classic file...");
+    if(test_multi(NC_CLOBBER)) ERR;
+    SUMMARIZE_ERR;
+    printf("*** testing CDF5 file...");
+    if(test_multi(NC_CLOBBER|NC_64BIT_DATA)) ERR;
+    SUMMARIZE_ERR;
+#ifdef USE_HDF5
+    printf("*** testing netCDF-4 file...");
+    if(test_multi(NC_CLOBBER|NC_NETCDF4)) ERR;
+    SUMMARIZE_ERR;
+#endif
+    FINAL_RESULTS;
+}
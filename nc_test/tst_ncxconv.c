@@ -0,0 +1,369 @@
+/*
+  Copyright 2018, UCAR/Unidata
+  See COPYRIGHT file for copying and redistribution conditions.
+
+  This is part of netCDF.
+
+  This program checks the bulk external<->internal conversions of the
+  classic format (ncx_getn_* and ncx_putn_*) against values encoded
+  and decoded by hand, and then reports the throughput of each
+  conversion. It concentrates on the pairs that have vector kernels:
+  the byte swapping same-type copies, float<->double, and short and
+  int to float. Starting offsets of 0..3 and odd counts make sure the
+  vector prefix, the scalar tail and unaligned buffers are all used.
+
+  Usage: tst_ncxconv [nelems [reps]]
+
+  The NETCDF_NCX_SIMD environment variable ("none", "sse2", ...)
+  selects the kernels to test; see run_ncxconv.sh.
+*/
+
+#include <config.h>
+#include <nc_tests.h>
+#include "err_macros.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+#include <limits.h>
+#include <math.h>
+#include <sys/time.h>
+#include <netcdf.h>
+#include <netcdf_mem.h>
+
+#define FILE_NAME "tst_ncxconv.nc"
+#define DEFAULT_NELEMS 4096
+#define DEFAULT_REPS 20
+
+/* Scratch room for the largest conversion plus an unaligning byte */
+#define SCRATCH(n) (((n)+1) * sizeof(double) + 1)
+
+struct pair {
+    nc_type xtype; /* external */
+    nc_type itype; /* internal */
+    int put;       /* also test itype -> xtype */
+};
+
+static const struct pair pairs[] = {
+    {NC_SHORT, NC_SHORT, 1},
+    {NC_INT, NC_INT, 1},
+    {NC_FLOAT, NC_FLOAT, 1},
+    {NC_DOUBLE, NC_DOUBLE, 1},
+    {NC_SHORT, NC_FLOAT, 0},
+    {NC_INT, NC_FLOAT, 0},
+    {NC_FLOAT, NC_DOUBLE, 1},
+    {NC_DOUBLE, NC_FLOAT, 1},
+};
+#define NPAIRS (sizeof(pairs)/sizeof(pairs[0]))
+
+static size_t
+typesize(nc_type t)
+{
+    switch (t) {
+    case NC_SHORT: return 2;
+    case NC_INT: case NC_FLOAT: return 4;
+    default: return 8;
+    }
+}
+
+static const char*
+tname(nc_type t)
+{
+    switch (t) {
+    case NC_SHORT: return "short";
+    case NC_INT: return "int";
+    case NC_FLOAT: return "float";
+    default: return "double";
+    }
+}
+
+static double
+now(void)
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (double)tv.tv_sec + 1.0e-6 * (double)tv.tv_usec;
+}
+
+static unsigned long long seed = 88172645463325252ULL;
+
+static unsigned long long
+next(void)
+{
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    return seed;
+}
+
+/* Store a native value of type t big endian at xp */
+static void
+encode(nc_type t, const void* vp, unsigned char* xp)
+{
+    unsigned long long u = 0;
+    size_t i, sz = typesize(t);
+    switch (t) {
+    case NC_SHORT: {unsigned short v; memcpy(&v,vp,2); u = v;} break;
+    case NC_INT: case NC_FLOAT: {unsigned int v; memcpy(&v,vp,4); u = v;} break;
+    default: memcpy(&u,vp,8); break;
+    }
+    for(i=0;i<sz;i++) xp[i] = (unsigned char)(u >> (8*(sz-1-i)));
+}
+
+/* Fill vp with n values of type t that exercise the edges of each
+   conversion: extreme and negative integers, integers too wide for a
+   float mantissa, subnormals, signed zeros. With wide set there are
+   also values that are range errors for a put or a narrowing get:
+   float infinities and doubles beyond float range. */
+static void
+makevalues(nc_type t, size_t n, void* vp, int wide)
+{
+    size_t i;
+    for(i=0;i<n;i++) {
+	unsigned long long r = next();
+	switch (t) {
+	case NC_SHORT: {
+	    short v = (short)r;
+	    if(i % 97 == 1) v = SHRT_MIN; else if(i % 97 == 2) v = SHRT_MAX;
+	    ((short*)vp)[i] = v;
+	    } break;
+	case NC_INT: {
+	    int v = (int)(unsigned int)r;
+	    if(i % 97 == 1) v = INT_MIN; else if(i % 97 == 2) v = INT_MAX;
+	    else if(i % 97 == 3) v = 16777217; /* rounds as a float */
+	    ((int*)vp)[i] = v;
+	    } break;
+	case NC_FLOAT: {
+	    float v = (float)((double)(long long)r / 1.0e9);
+	    if(i % 97 == 1) v = FLT_MAX; else if(i % 97 == 2) v = -FLT_MIN / 4;
+	    else if(i % 97 == 3) v = -0.0f; else if(wide && i % 97 == 4) v = (float)INFINITY;
+	    ((float*)vp)[i] = v;
+	    } break;
+	default: {
+	    double v = (double)(long long)r / 3.0e9;
+	    if(i % 97 == 1) v = FLT_MAX; else if(i % 97 == 2) v = -(double)FLT_MAX;
+	    else if(i % 97 == 3) v = 1.0e-42; else if(i % 97 == 4) v = -0.0;
+	    else if(wide && i % 97 == 5) v = DBL_MAX;
+	    ((double*)vp)[i] = v;
+	    } break;
+	}
+    }
+}
+
+/* Cast element i of vp (type from) to type to, into op */
+static void
+cast(nc_type from, const void* vp, size_t i, nc_type to, void* op)
+{
+    double d;
+    switch (from) {
+    case NC_SHORT:
+	if(to == NC_FLOAT) {float f = (float)((const short*)vp)[i]; memcpy(op,&f,4); return;}
+	memcpy(op,(const short*)vp+i,2); return;
+    case NC_INT:
+	if(to == NC_FLOAT) {float f = (float)((const int*)vp)[i]; memcpy(op,&f,4); return;}
+	memcpy(op,(const int*)vp+i,4); return;
+    case NC_FLOAT:
+	if(to == NC_DOUBLE) {d = (double)((const float*)vp)[i]; memcpy(op,&d,8); return;}
+	memcpy(op,(const float*)vp+i,4); return;
+    default:
+	if(to == NC_FLOAT) {float f = (float)((const double*)vp)[i]; memcpy(op,&f,4); return;}
+	memcpy(op,(const double*)vp+i,8); return;
+    }
+}
+
+/* Is element i of vp (type from) a range error when converted to
+   type to? Like the scalar code, puts treat infinities as errors. */
+static int
+out_of_range(nc_type from, const void* vp, size_t i, nc_type to, int put)
+{
+    double d;
+    if(from == NC_DOUBLE && to == NC_FLOAT) {
+	d = ((const double*)vp)[i];
+	return (d > FLT_MAX || d < -FLT_MAX);
+    }
+    if(from == NC_FLOAT && to == NC_DOUBLE && put)
+	return isinf(((const float*)vp)[i]);
+    return 0;
+}
+
+static int
+get_vara(int ncid, nc_type itype, size_t start, size_t count, void* ip)
+{
+    switch (itype) {
+    case NC_SHORT: return nc_get_vara_short(ncid,0,&start,&count,ip);
+    case NC_INT: return nc_get_vara_int(ncid,0,&start,&count,ip);
+    case NC_FLOAT: return nc_get_vara_float(ncid,0,&start,&count,ip);
+    default: return nc_get_vara_double(ncid,0,&start,&count,ip);
+    }
+}
+
+static int
+put_vara(int ncid, nc_type itype, size_t start, size_t count, const void* ip)
+{
+    switch (itype) {
+    case NC_SHORT: return nc_put_vara_short(ncid,0,&start,&count,ip);
+    case NC_INT: return nc_put_vara_int(ncid,0,&start,&count,ip);
+    case NC_FLOAT: return nc_put_vara_float(ncid,0,&start,&count,ip);
+    default: return nc_put_vara_double(ncid,0,&start,&count,ip);
+    }
+}
+
+/* Create an in-memory classic file with one n element variable of
+   type xtype, leaving it open for writing */
+static int
+create(nc_type xtype, size_t n, int* ncidp)
+{
+    int dimid, varid;
+    if (nc_create_mem(FILE_NAME, NC_CLOBBER, 0, ncidp)) ERR;
+    if (nc_def_dim(*ncidp, "n", n, &dimid)) ERR;
+    if (nc_def_var(*ncidp, "v", xtype, 1, &dimid, &varid)) ERR;
+    if (nc_enddef(*ncidp)) ERR;
+    return 0;
+}
+
+/* The variable is the last (and only) thing in the file, and n is a
+   multiple of 4, so its data is not padded */
+#define XDATA(mem,n,xtype) ((unsigned char*)(mem).memory + (mem).size - (n)*typesize(xtype))
+
+static int
+test_get(const struct pair* p, size_t n)
+{
+    int ncid, stat;
+    size_t i, start, xsz = typesize(p->xtype), isz = typesize(p->itype);
+    NC_memio mem;
+    void* values = malloc(n * xsz);
+    unsigned char* buf = malloc(SCRATCH(n));
+    unsigned char expect[8];
+
+    if(values == NULL || buf == NULL) ERR;
+    makevalues(p->xtype, n, values, 1);
+    if (create(p->xtype, n, &ncid)) ERR;
+    if (nc_close_memio(ncid, &mem)) ERR;
+    for(i=0;i<n;i++) encode(p->xtype, (char*)values + i*xsz, XDATA(mem,n,p->xtype) + i*xsz);
+    if (nc_open_mem(FILE_NAME, NC_NOWRITE, mem.size, mem.memory, &ncid)) ERR;
+
+    for(start=0;start<4;start++) {
+	size_t count = n - start - (start & 1);
+	/* odd starts also write to an unaligned buffer */
+	unsigned char* ip = buf + (start & 1);
+	int sawrange = 0;
+	stat = get_vara(ncid, p->itype, start, count, ip);
+	for(i=0;i<count;i++) {
+	    if(out_of_range(p->xtype, values, start+i, p->itype, 0)) {sawrange = 1; continue;}
+	    cast(p->xtype, values, start+i, p->itype, expect);
+	    if(memcmp(ip + i*isz, expect, isz) != 0) {
+		fprintf(stderr, "get %s->%s: start %zu element %zu differs\n",
+			tname(p->xtype), tname(p->itype), start, i);
+		ERR;
+	    }
+	}
+	if (stat != (sawrange ? NC_ERANGE : NC_NOERR)) ERR;
+    }
+    if (nc_close(ncid)) ERR;
+    free(mem.memory);
+    free(values);
+    free(buf);
+    return 0;
+}
+
+static int
+test_put(const struct pair* p, size_t n)
+{
+    int ncid, stat;
+    size_t i, start, xsz = typesize(p->xtype), isz = typesize(p->itype);
+    NC_memio mem;
+    void* values = malloc(n * isz);
+    unsigned char* buf = malloc(SCRATCH(n));
+    unsigned char cvt[8], expect[8];
+
+    if(values == NULL || buf == NULL) ERR;
+    makevalues(p->itype, n, values, 1);
+    for(start=0;start<4;start++) {
+	size_t count = n - start - (start & 1);
+	unsigned char* ip = buf + (start & 1);
+	int sawrange = 0;
+	memcpy(ip, (char*)values + start*isz, count*isz);
+	if (create(p->xtype, n, &ncid)) ERR;
+	stat = put_vara(ncid, p->itype, start, count, ip);
+	if (nc_close_memio(ncid, &mem)) ERR;
+	for(i=0;i<count;i++) {
+	    if(out_of_range(p->itype, values, start+i, p->xtype, 1)) {sawrange = 1; continue;}
+	    cast(p->itype, values, start+i, p->xtype, cvt);
+	    encode(p->xtype, cvt, expect);
+	    if(memcmp(XDATA(mem,n,p->xtype) + (start+i)*xsz, expect, xsz) != 0) {
+		fprintf(stderr, "put %s->%s: start %zu element %zu differs\n",
+			tname(p->itype), tname(p->xtype), start, i);
+		ERR;
+	    }
+	}
+	if (stat != (sawrange ? NC_ERANGE : NC_NOERR)) ERR;
+	free(mem.memory);
+    }
+    free(values);
+    free(buf);
+    return 0;
+}
+
+/* Report MB/s of internal data moved by reps whole-variable gets and
+   puts. The file lives in memory, so this is mostly conversion. */
+static int
+bench(const struct pair* p, size_t n, int reps)
+{
+    int ncid, r;
+    size_t i, xsz = typesize(p->xtype), isz = typesize(p->itype);
+    void* xvalues = malloc(n * xsz);
+    void* values = malloc(n * isz);
+    double t0, tget, tput = 0;
+    double mb = (double)(n * isz) * reps / 1.0e6;
+
+    if(xvalues == NULL || values == NULL) ERR;
+    makevalues(p->xtype, n, xvalues, 0);
+    for(i=0;i<n;i++) cast(p->xtype, xvalues, i, p->itype, (char*)values + i*isz);
+    if (create(p->xtype, n, &ncid)) ERR;
+    if(p->put) {
+	t0 = now();
+	for(r=0;r<reps;r++)
+	    if (put_vara(ncid, p->itype, 0, n, values)) ERR;
+	tput = now() - t0;
+    }
+    t0 = now();
+    for(r=0;r<reps;r++)
+	if (get_vara(ncid, p->itype, 0, n, values)) ERR;
+    tget = now() - t0;
+    if (nc_abort(ncid)) ERR;
+    printf("%-6s -> %-6s get %9.1f MB/s", tname(p->xtype), tname(p->itype),
+	   mb / (tget > 0 ? tget : 1e-9));
+    if(p->put)
+	printf("  put %9.1f MB/s", mb / (tput > 0 ? tput : 1e-9));
+    printf("\n");
+    free(xvalues);
+    free(values);
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    size_t i, n = DEFAULT_NELEMS;
+    int reps = DEFAULT_REPS;
+    const char* isa = getenv("NETCDF_NCX_SIMD");
+
+    if(argc > 1) n = (size_t)atol(argv[1]);
+    if(argc > 2) reps = atoi(argv[2]);
+    n = (n < 8 ? 8 : n) & ~(size_t)3; /* see XDATA */
+
+    printf("\n*** Testing ncx conversions (NETCDF_NCX_SIMD=%s, %zu elements).\n",
+	   isa == NULL ? "" : isa, n);
+    printf("*** testing bulk gets...");
+    for(i=0;i<NPAIRS;i++)
+	if (test_get(&pairs[i], n)) ERR;
+    SUMMARIZE_ERR;
+    printf("*** testing bulk puts...");
+    for(i=0;i<NPAIRS;i++)
+	if (pairs[i].put && test_put(&pairs[i], n)) ERR;
+    SUMMARIZE_ERR;
+    printf("*** conversion throughput:\n");
+    for(i=0;i<NPAIRS;i++)
+	if (bench(&pairs[i], n, reps)) ERR;
+    FINAL_RESULTS;
+}
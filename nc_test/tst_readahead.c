@@ -0,0 +1,157 @@
+/* This is part of the netCDF package. Copyright 2018 University
+   Corporation for Atmospheric Research/Unidata. See COPYRIGHT file
+   for conditions of use.
+
+   Test reads of classic files through the posixio read-ahead window
+   (NETCDF.READAHEAD).
+*/
+
+#include "config.h"
+#include <nc_tests.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "err_macros.h"
+#include "netcdf.h"
+
+#define FILE_NAME "tst_readahead.nc"
+#define NREC 60
+#define NX 3001 /* an odd record size, so extents and records do not line up */
+#define NVARS 3
+#define MORE 5 /* records added while the file is open */
+
+/* Value stored at an index of a variable */
+#define VAL(v,r,x) ((int)((v)*10000000 + (r)*10000 + (x)))
+
+static int buf[NX];
+
+static int
+check_rec(int ncid, int v, int r)
+{
+    size_t start[2], count[2];
+    int x;
+
+    start[0] = (size_t)r; start[1] = 0;
+    count[0] = 1; count[1] = NX;
+    if(nc_get_vara_int(ncid, v, start, count, buf)) ERR;
+    for(x = 0; x < NX; x++)
+        if(buf[x] != VAL(v, r, x)) ERR;
+    return 0;
+}
+
+static int
+put_recs(int ncid, int first, int last)
+{
+    size_t start[2], count[2];
+    int v, r, x;
+
+    count[0] = 1; count[1] = NX;
+    for(r = first; r < last; r++)
+        for(v = 0; v < NVARS; v++) {
+            for(x = 0; x < NX; x++)
+                buf[x] = VAL(v, r, x);
+            start[0] = (size_t)r; start[1] = 0;
+            if(nc_put_vara_int(ncid, v, start, count, buf)) ERR;
+        }
+    return 0;
+}
+
+static int
+create_file(int cmode)
+{
+    int ncid, dimids[2], varid, v;
+    char name[NC_MAX_NAME + 1];
+
+    if(nc_create(FILE_NAME, cmode, &ncid)) ERR;
+    if(nc_def_dim(ncid, "rec", NC_UNLIMITED, &dimids[0])) ERR;
+    if(nc_def_dim(ncid, "x", NX, &dimids[1])) ERR;
+    for(v = 0; v < NVARS; v++) {
+        snprintf(name, sizeof(name), "v%d", v);
+        if(nc_def_var(ncid, name, NC_INT, 2, dimids, &varid)) ERR;
+    }
+    if(nc_enddef(ncid)) ERR;
+    if(put_recs(ncid, 0, NREC)) ERR;
+    if(nc_close(ncid)) ERR;
+    return 0;
+}
+
+/* Read the file in several orders through a handle opened with the
+   given chunk size hint */
+static int
+test_reads(size_t chunk)
+{
+    int ncid, wncid, v, r;
+    size_t nrecs;
+
+    if(nc__open(FILE_NAME, NC_NOWRITE, &chunk, &ncid)) ERR;
+
+    /* Record by record, the way a scan goes */
+    for(r = 0; r < NREC; r++)
+        for(v = 0; v < NVARS; v++)
+            if(check_rec(ncid, v, r)) ERR;
+
+    /* One variable at a time, skipping over the others */
+    for(v = 0; v < NVARS; v++)
+        for(r = 0; r < NREC; r++)
+            if(check_rec(ncid, v, r)) ERR;
+
+    /* Backwards */
+    for(r = NREC - 1; r >= 0; r--)
+        for(v = NVARS - 1; v >= 0; v--)
+            if(check_rec(ncid, v, r)) ERR;
+
+    /* Scattered, then sequential from the middle */
+    for(r = 0; r < NREC; r++)
+        if(check_rec(ncid, r % NVARS, (r * 37) % NREC)) ERR;
+    for(r = NREC / 2; r < NREC; r++)
+        for(v = 0; v < NVARS; v++)
+            if(check_rec(ncid, v, r)) ERR;
+
+    /* Records added after open are seen after a sync */
+    if(nc_open(FILE_NAME, NC_WRITE, &wncid)) ERR;
+    if(put_recs(wncid, NREC, NREC + MORE)) ERR;
+    if(nc_close(wncid)) ERR;
+    if(nc_sync(ncid)) ERR;
+    if(nc_inq_dimlen(ncid, 0, &nrecs)) ERR;
+    if(nrecs != NREC + MORE) ERR;
+    for(r = NREC - 2; r < NREC + MORE; r++)
+        for(v = 0; v < NVARS; v++)
+            if(check_rec(ncid, v, r)) ERR;
+
+    if(nc_close(ncid)) ERR;
+    return 0;
+}
+
+static int
+test_file(int cmode)
+{
+    if(create_file(cmode)) ERR;
+    if(test_reads(0)) ERR;
+    if(create_file(cmode)) ERR;
+    if(test_reads(1024)) ERR;
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    printf("\n*** Testing posixio read-ahead.\n");
+    /* Small extents that are not a multiple of the block size */
+    if(nc_rc_set("NETCDF.READAHEAD", "3")) ERR;
+    if(nc_rc_set("NETCDF.READAHEAD.SIZE", "40000")) ERR;
+    printf("*** testing classic file...");
+    if(test_file(NC_CLOBBER)) ERR;
+    SUMMARIZE_ERR;
+    printf("*** testing CDF5 file...");
+    if(test_file(NC_CLOBBER|NC_64BIT_DATA)) ERR;
+    SUMMARIZE_ERR;
+    printf("*** testing one-extent window...");
+    if(nc_rc_set("NETCDF.READAHEAD", "1")) ERR;
+    if(test_file(NC_CLOBBER)) ERR;
+    SUMMARIZE_ERR;
+    printf("*** testing without read-ahead...");
+    if(nc_rc_set("NETCDF.READAHEAD", "0")) ERR;
+    if(test_file(NC_CLOBBER)) ERR;
+    SUMMARIZE_ERR;
+    FINAL_RESULTS;
+}
@@ -0,0 +1,176 @@
+/* This is part of the netCDF package. Copyright 2018 University
+   Corporation for Atmospheric Research/Unidata. See COPYRIGHT file
+   for conditions of use.
+
+   Test strided and mapped access to classic files with variables
+   large enough that a run spans several I/O chunks.
+*/
+
+#include "config.h"
+#include <nc_tests.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "err_macros.h"
+#include "netcdf.h"
+
+#define FILE_NAME "tst_strided.nc"
+#define NREC 5
+#define NY 40
+#define NX 3000 /* a row of doubles is several chunks */
+#define NFIX 100000
+
+/* Value stored at an index of the record variable */
+#define RVAL(r,y,x) ((double)((r)*1000000 + (y)*10000 + (x)))
+
+static double rec[NREC][NY][NX];
+static double buf[NREC*NY*NX];
+
+static int
+check_vars(int ncid, int varid, const size_t* start, const size_t* count,
+           const ptrdiff_t* stride)
+{
+    size_t r, y, x, n = 0;
+
+    if(nc_get_vars_double(ncid, varid, start, count, stride, buf)) ERR;
+    for(r = 0; r < count[0]; r++)
+        for(y = 0; y < count[1]; y++)
+            for(x = 0; x < count[2]; x++, n++) {
+                size_t ri = start[0] + r*(size_t)stride[0];
+                size_t yi = start[1] + y*(size_t)stride[1];
+                size_t xi = start[2] + x*(size_t)stride[2];
+                if(buf[n] != rec[ri][yi][xi]) ERR;
+            }
+    return 0;
+}
+
+static int
+test_file(int cmode)
+{
+    int ncid, dimids[3], rvarid, fvarid, ovarid;
+    size_t r, y, x, i;
+    size_t start[3], count[3];
+    ptrdiff_t stride[3], imap[3];
+    static int ival[NFIX];
+    static short sval[NFIX];
+
+    for(r = 0; r < NREC; r++)
+        for(y = 0; y < NY; y++)
+            for(x = 0; x < NX; x++)
+                rec[r][y][x] = RVAL(r,y,x);
+    for(i = 0; i < NFIX; i++) ival[i] = (int)i;
+
+    if(nc_create(FILE_NAME, cmode, &ncid)) ERR;
+    if(nc_def_dim(ncid, "rec", NC_UNLIMITED, &dimids[0])) ERR;
+    if(nc_def_dim(ncid, "y", NY, &dimids[1])) ERR;
+    if(nc_def_dim(ncid, "x", NX, &dimids[2])) ERR;
+    if(nc_def_var(ncid, "r", NC_DOUBLE, 3, dimids, &rvarid)) ERR;
+    if(nc_def_var(ncid, "o", NC_BYTE, 1, dimids, &ovarid)) ERR;
+    if(nc_def_dim(ncid, "n", NFIX, &dimids[1])) ERR;
+    if(nc_def_var(ncid, "f", NC_INT, 1, &dimids[1], &fvarid)) ERR;
+    if(nc_enddef(ncid)) ERR;
+
+    start[0] = start[1] = start[2] = 0;
+    count[0] = NREC; count[1] = NY; count[2] = NX;
+    if(nc_put_vara_double(ncid, rvarid, start, count, &rec[0][0][0])) ERR;
+    if(nc_put_var_int(ncid, fvarid, ival)) ERR;
+
+    /* Stride along the fastest dimension only */
+    stride[0] = 1; stride[1] = 1; stride[2] = 7;
+    start[0] = 1; start[1] = 2; start[2] = 5;
+    count[0] = 3; count[1] = 4; count[2] = (NX - 5 + 6) / 7;
+    if(check_vars(ncid, rvarid, start, count, stride)) ERR;
+
+    /* Strides wider than a chunk */
+    stride[2] = 1500; count[2] = 2; start[2] = 1;
+    if(check_vars(ncid, rvarid, start, count, stride)) ERR;
+
+    /* Stride along the outer dimensions, whole rows */
+    stride[0] = 2; stride[1] = 13; stride[2] = 1;
+    start[0] = 0; start[1] = 1; start[2] = 0;
+    count[0] = 3; count[1] = 3; count[2] = NX;
+    if(check_vars(ncid, rvarid, start, count, stride)) ERR;
+
+    /* Everything strided */
+    stride[0] = 4; stride[1] = 3; stride[2] = 11;
+    start[0] = 0; start[1] = 0; start[2] = 2;
+    count[0] = 2; count[1] = NY/3; count[2] = (NX - 2 + 10) / 11;
+    if(check_vars(ncid, rvarid, start, count, stride)) ERR;
+
+    /* Out of range */
+    count[2] = (NX - 2 + 10) / 11 + 1;
+    if(nc_get_vars_double(ncid, rvarid, start, count, stride, buf) != NC_EEDGE) ERR;
+    count[0] = 3; count[2] = 1;
+    if(nc_get_vars_double(ncid, rvarid, start, count, stride, buf) != NC_EEDGE) ERR;
+    stride[1] = 0;
+    if(nc_get_vars_double(ncid, rvarid, start, count, stride, buf) != NC_ESTRIDE) ERR;
+
+    /* Converting, and a 1-D fixed variable */
+    stride[0] = 9;
+    start[0] = 3; count[0] = (NFIX - 3 + 8) / 9;
+    if(nc_get_vars_short(ncid, fvarid, start, count, stride, sval) != NC_ERANGE) ERR;
+    for(i = 0; i < count[0]; i++) {
+        int want = (int)(start[0] + i*9);
+        if(want <= 32767 && sval[i] != want) ERR;
+    }
+
+    /* Put every third element of a row, then check that only those
+       changed */
+    stride[0] = 1; stride[1] = 1; stride[2] = 3;
+    start[0] = 2; start[1] = 5; start[2] = 1;
+    count[0] = 1; count[1] = 2; count[2] = (NX - 1 + 2) / 3;
+    for(i = 0; i < count[1]*count[2]; i++) buf[i] = -(double)i;
+    if(nc_put_vars_double(ncid, rvarid, start, count, stride, buf)) ERR;
+    for(y = 0; y < count[1]; y++)
+        for(x = 0; x < count[2]; x++)
+            rec[2][5+y][1+3*x] = -(double)(y*count[2] + x);
+    stride[2] = 1; start[2] = 0; count[2] = NX; count[0] = NREC; start[0] = 0;
+    count[1] = NY; start[1] = 0;
+    if(check_vars(ncid, rvarid, start, count, stride)) ERR;
+
+    /* A strided put past the last record adds records */
+    stride[0] = 2; start[0] = NREC; count[0] = 2;
+    stride[1] = 1; start[1] = 0; count[1] = 1;
+    stride[2] = 100; start[2] = 0; count[2] = NX/100;
+    for(i = 0; i < 2*count[2]; i++) buf[i] = (double)i;
+    if(nc_put_vars_double(ncid, rvarid, start, count, stride, buf)) ERR;
+    if(nc_inq_dimlen(ncid, dimids[0], &r)) ERR;
+    if(r != NREC + 3) ERR;
+
+    /* Transposed read through varm: buf[x][y] = rec[4][y][x] */
+    start[0] = 4; start[1] = 0; start[2] = 0;
+    count[0] = 1; count[1] = NY; count[2] = NX;
+    stride[0] = 1; stride[1] = 1; stride[2] = 1;
+    imap[0] = NY*NX; imap[1] = 1; imap[2] = NY;
+    if(nc_get_varm_double(ncid, rvarid, start, count, stride, imap, buf)) ERR;
+    for(y = 0; y < NY; y++)
+        for(x = 0; x < NX; x++)
+            if(buf[x*NY + y] != rec[4][y][x]) ERR;
+
+    /* Strided varm with a contiguous memory map */
+    stride[2] = 5; count[2] = NX/5;
+    imap[0] = NY*(NX/5); imap[1] = NX/5; imap[2] = 1;
+    if(nc_get_varm_double(ncid, rvarid, start, count, stride, imap, buf)) ERR;
+    for(y = 0; y < NY; y++)
+        for(x = 0; x < NX/5; x++)
+            if(buf[y*(NX/5) + x] != rec[4][y][5*x]) ERR;
+
+    if(nc_close(ncid)) ERR;
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    printf("\n*** Testing strided access to classic files.\n");
+    printf("*** testing classic file...");
+    if(test_file(NC_CLOBBER)) ERR;
+    SUMMARIZE_ERR;
+    printf("*** testing CDF5 file...");
+    if(test_file(NC_CLOBBER|NC_64BIT_DATA)) ERR;
+    SUMMARIZE_ERR;
+    printf("*** testing diskless file...");
+    if(test_file(NC_CLOBBER|NC_DISKLESS)) ERR;
+    SUMMARIZE_ERR;
+    FINAL_RESULTS;
+}
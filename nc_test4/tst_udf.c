@@ -177,6 +177,9 @@ init_dispatchers(void)
 #if NC_DISPATCH_VERSION >= 5
     tst_dispatcher.inq_filter_avail = NC_NOOP_inq_filter_avail;
 #endif
+#if NC_DISPATCH_VERSION >= 6
+    tst_dispatcher.get_vara_multi = NCDEFAULT_get_vara_multi;
+#endif
 
     /* --- tst_dispatcher_bad_version (same but wrong ABI version) --- */
     memcpy(&tst_dispatcher_bad_version, &tst_dispatcher,
@@ -242,6 +242,9 @@ init_dispatchers(void)
 #endif
 #if NC_DISPATCH_VERSION >= 5
         dsp->inq_filter_avail = NC_NOOP_inq_filter_avail;
+#endif
+#if NC_DISPATCH_VERSION >= 6
+        dsp->get_vara_multi = NCDEFAULT_get_vara_multi;
 #endif
     }
 }
@@ -166,6 +166,9 @@ tst_udf_self_load_init(void)
 #endif
 #if NC_DISPATCH_VERSION >= 5
         tst_self_load_dispatcher.inq_filter_avail = NC_NOOP_inq_filter_avail;
+#endif
+#if NC_DISPATCH_VERSION >= 6
+        tst_self_load_dispatcher.get_vara_multi = NCDEFAULT_get_vara_multi;
 #endif
         initialized = 1;
     }
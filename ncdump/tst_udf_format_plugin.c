@@ -165,5 +165,6 @@ tst_udf_format_init(void)
     dispatcher.inq_var_filter_ids = NC_NOOP_inq_var_filter_ids;
     dispatcher.inq_var_filter_info = NC_NOOP_inq_var_filter_info;
     dispatcher.inq_filter_avail = NC_NOOP_inq_filter_avail;
+    dispatcher.get_vara_multi = NCDEFAULT_get_vara_multi;
     return &dispatcher;
 }
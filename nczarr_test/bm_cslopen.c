@@ -0,0 +1,126 @@
+/* This is part of the netCDF package.
+   Copyright 2018 University Corporation for Atmospheric Research/Unidata
+   See COPYRIGHT file for conditions of use.
+
+   Benchmark opening a consolidated store with many variables:
+   every group, array and attribute fetch during open is a key
+   lookup in the consolidated metadata. The store is synthesized
+   directly as a .zgroup plus a .zmetadata object, so only the
+   open is measured. With ngroups > 0 the variables are spread
+   over that many subgroups of the root group.
+
+   Usage: bm_cslopen [nvars [nreps [ngroups]]]
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <direct.h>
+#define mkdir(path,mode) _mkdir(path)
+#endif
+
+#include "netcdf.h"
+#include "timer_utils.h"
+
+#define PATH "tmp_bm_cslopen.file"
+#define URL "file://" PATH "#mode=zarr,file,consolidated"
+
+#define NVARS 10000
+#define NREPS 3
+#define NGROUPS 0
+#define MAXGROUPS 100000
+
+#define ERR(r) {fprintf(stderr,"fail: line %d: (%d) %s\n",__LINE__,(r),nc_strerror((r))); exit(1);}
+#define CHECK(expr) {int stat_ = (expr); if(stat_) ERR(stat_);}
+
+static void
+writeobject(const char* name, const char* content)
+{
+    FILE* f = fopen(name,"wb");
+    if(f == NULL || fputs(content,f) < 0) {fprintf(stderr,"fail: cannot write %s\n",name); exit(1);}
+    fclose(f);
+}
+
+/* A pure zarr store with n one-dimensional int variables in ngroups groups */
+static void
+synthesize(int n, int ngroups)
+{
+    FILE* f = NULL;
+    int i;
+    char group[32];
+
+    (void)mkdir(PATH,0777);
+    writeobject(PATH "/.zgroup","{\"zarr_format\": 2}");
+    writeobject(PATH "/.zattrs","{}");
+    if((f = fopen(PATH "/.zmetadata","wb")) == NULL) {fprintf(stderr,"fail: cannot write .zmetadata\n"); exit(1);}
+    fprintf(f,"{\"zarr_consolidated_format\": 1, \"metadata\": {\".zgroup\": {\"zarr_format\": 2}, \".zattrs\": {}");
+    for(i=0;i<ngroups;i++)
+	fprintf(f,", \"g%d/.zgroup\": {\"zarr_format\": 2}, \"g%d/.zattrs\": {}",i,i);
+    for(i=0;i<n;i++) {
+	group[0] = '\0';
+	if(ngroups > 0) snprintf(group,sizeof(group),"g%d/",i % ngroups);
+	fprintf(f,", \"%sv%d/.zarray\": {\"zarr_format\": 2, \"shape\": [4], \"dtype\": \"<i4\", \"chunks\": [4],"
+		  " \"fill_value\": 0, \"order\": \"C\", \"compressor\": null, \"filters\": null}",group,i);
+	fprintf(f,", \"%sv%d/.zattrs\": {\"_ARRAY_DIMENSIONS\": [\"x\"]}",group,i);
+    }
+    fprintf(f,"}}");
+    fclose(f);
+}
+
+/* Count the variables of a group and all its subgroups */
+static int
+countvars(int grpid)
+{
+    int nvars, ngrps, i;
+    int* grpids = NULL;
+
+    CHECK(nc_inq_nvars(grpid,&nvars));
+    CHECK(nc_inq_grps(grpid,&ngrps,NULL));
+    if(ngrps > 0) {
+	if((grpids = (int*)malloc(sizeof(int)*(size_t)ngrps)) == NULL) ERR(NC_ENOMEM);
+	CHECK(nc_inq_grps(grpid,NULL,grpids));
+	for(i=0;i<ngrps;i++) nvars += countvars(grpids[i]);
+	free(grpids);
+    }
+    return nvars;
+}
+
+int
+main(int argc, char **argv)
+{
+    int ncid, nvars, i;
+    int n = NVARS;
+    int nreps = NREPS;
+    int ngroups = NGROUPS;
+    Nanotime start, stop, delta;
+    long long best = -1;
+
+    if(argc > 1) n = atoi(argv[1]);
+    if(argc > 2) nreps = atoi(argv[2]);
+    if(argc > 3) ngroups = atoi(argv[3]);
+    if(n <= 0 || nreps <= 0 || ngroups < 0 || ngroups > MAXGROUPS)
+	{fprintf(stderr,"usage: bm_cslopen [nvars [nreps [ngroups]]]\n"); exit(1);}
+
+    NCT_inittimer();
+    synthesize(n,ngroups);
+
+    for(i=0;i<nreps;i++) {
+	NCT_marktime(&start);
+	CHECK(nc_open(URL,NC_NOWRITE,&ncid));
+	nvars = countvars(ncid);
+	CHECK(nc_close(ncid));
+	NCT_marktime(&stop);
+	NCT_elapsedtime(&start,&stop,&delta);
+	if(nvars != n) {fprintf(stderr,"fail: found %d variables, expected %d\n",nvars,n); exit(1);}
+	if(best < 0 || NCT_nanoseconds(delta) < best) best = NCT_nanoseconds(delta);
+    }
+
+    printf("open consolidated, %d variables in %d groups: %.3f ms (%.2f us/variable, best of %d)\n",
+	   n,ngroups,(double)best/1.0e6,(double)best/(1.0e3*n),nreps);
+    return 0;
+}
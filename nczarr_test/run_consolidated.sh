@@ -0,0 +1,24 @@
+#!/bin/sh
+
+if test "x$srcdir" = x ; then srcdir=`pwd`; fi
+. ../test_common.sh
+
+. "$top_srcdir/nczarr_test/test_nczarr.sh"
+
+set -e
+
+s3isolate "testdir_consolidated"
+THISDIR=`pwd`
+cd $ISOPATH
+
+# This shell script tests that consolidated metadata (.zmetadata)
+# describes the same dataset as the per-object metadata
+
+echo "*** Test: write and read consolidated metadata"
+${execdir}/test_zconsolidated
+
+echo "*** Test: compare consolidated and per-object metadata"
+url="file://tmp_zconsolidated.file#mode=nczarr,file"
+${NCDUMP} -n tmp_zconsolidated "${url},consolidated" > tmp_zconsolidated_csl.cdl
+NCZARR_CONSOLIDATED=FALSE ${NCDUMP} -n tmp_zconsolidated "${url}" > tmp_zconsolidated.cdl
+diff -b tmp_zconsolidated.cdl tmp_zconsolidated_csl.cdl
@@ -21,6 +21,7 @@ testmisc $1
 testmulti $1
 testrep $1
 testorder $1
+testthreads $1
 }
 
 # Function to remove selected -s attributes from file;
@@ -177,6 +178,32 @@ ${execdir}/testfilter_order read $fileurl >tmp_order_rd_$zext.txt
 diff -b -w ${srcdir}/../nc_test4/ref_filter_order_read.txt tmp_order_rd_$zext.txt
 }
 
+testthreads() {
+zext=$1
+echo "*** Testing concurrent reads of filtered chunks for storage format $zext"
+fileargs tmp_unfiltered
+deletemap $zext $file
+${NCGEN} -4 -lb -o $fileurl ${srcdir}/../nc_test4/ref_unfiltered.cdl
+fileurl0=$fileurl
+fileargs tmp_threads
+deletemap $zext $file
+# Chunk the last dimension so every row read by ncdump spans several chunks
+${NCCOPY} -M0 -F "/g/var,307,9" -c "/g/var:2,2,2,1" $fileurl0 $fileurl
+${NCDUMP} -n threads $fileurl > ./tmp_threads1_$zext.txt
+fileargs tmp_threads "mode=nczarr,$zext&nthreads=4"
+${NCDUMP} -n threads $fileurl > ./tmp_threads4_$zext.txt
+diff -b -w ./tmp_threads1_$zext.txt ./tmp_threads4_$zext.txt
+echo "*** Pass: concurrent reads for storage format $zext"
+echo "*** Testing concurrent writes of filtered chunks for storage format $zext"
+fileargs tmp_threadsw
+deletemap $zext $file
+fileargs tmp_threadsw "mode=nczarr,$zext&nthreads=4"
+${NCCOPY} -M0 -F "/g/var,307,9" -c "/g/var:2,2,2,1" $fileurl0 $fileurl
+${NCDUMP} -n threads $fileurl > ./tmp_threadsw_$zext.txt
+diff -b -w ./tmp_threads1_$zext.txt ./tmp_threadsw_$zext.txt
+echo "*** Pass: concurrent writes for storage format $zext"
+}
+
 testset file
 if test "x$FEATURE_NCZARR_ZIP" = xyes ; then testset zip ; fi
 if test "x$FEATURE_S3TESTS" = xyes ; then testset s3 ; fi
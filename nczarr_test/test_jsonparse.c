@@ -0,0 +1,194 @@
+/* This is part of the netCDF package.
+   Copyright 2018 University Corporation for Atmospheric Research/Unidata
+   See COPYRIGHT file for conditions of use.
+
+   Test the JSON parse modes: the event (callback) parser must
+   report every value, and an arena parse must produce the same
+   tree as an ordinary parse and stay usable when modified.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "ncjson.h"
+
+#define FAIL(msg) {fprintf(stderr,"fail: line %d: %s\n",__LINE__,(msg)); exit(1);}
+#define CHECK(expr) {if((expr) != NCJ_OK) FAIL(#expr);}
+
+#define NKEYS 40 /* enough for the dict to be indexed */
+
+static const char* text =
+"{\"zarr_format\": 2, \"shape\": [10, 20], \"dtype\": \"<f8\", \"fill_value\": -1.5e3,"
+" \"order\": \"C\", \"compressor\": null, \"filters\": [], \"ok\": true,"
+" \"nested\": {\"a\": [1, [2, {\"b\": \"esc\\\"aped\"}]], \"c\": {}}}";
+
+/* Count the events and sum the integer values */
+struct Events {int begins; int ends; int keys; int values; int nulls; long long sum; int stopat;};
+
+static int
+begin(void* state, int sort)
+{
+    struct Events* ev = (struct Events*)state;
+    (void)sort;
+    ev->begins++;
+    return NCJ_OK;
+}
+
+static int
+end(void* state, int sort)
+{
+    struct Events* ev = (struct Events*)state;
+    (void)sort;
+    ev->ends++;
+    return NCJ_OK;
+}
+
+static int
+key(void* state, const char* k, size_t len)
+{
+    struct Events* ev = (struct Events*)state;
+    if(strlen(k) != len) return NCJ_ERR;
+    ev->keys++;
+    return NCJ_OK;
+}
+
+static int
+value(void* state, int sort, const char* t, size_t len)
+{
+    struct Events* ev = (struct Events*)state;
+    if(strlen(t) != len) return NCJ_ERR;
+    ev->values++;
+    if(sort == NCJ_NULL) ev->nulls++;
+    if(sort == NCJ_INT) ev->sum += atoll(t);
+    if(ev->stopat > 0 && ev->values == ev->stopat) return NCJ_ERR;
+    return NCJ_OK;
+}
+
+static void
+testevents(void)
+{
+    struct Events ev;
+    NCJcallbacks cb = {begin,end,key,value};
+    NCJcallbacks valuesonly = {NULL,NULL,NULL,value};
+
+    memset(&ev,0,sizeof(ev));
+    CHECK(NCJparsecb(strlen(text),text,0,&cb,&ev));
+    if(ev.begins != 8 || ev.ends != 8) FAIL("wrong number of containers");
+    if(ev.keys != 12) FAIL("wrong number of keys");
+    if(ev.values != 11 || ev.nulls != 1) FAIL("wrong number of values");
+    if(ev.sum != 2+10+20+1+2) FAIL("wrong integer values");
+
+    memset(&ev,0,sizeof(ev));
+    CHECK(NCJparsecb(strlen(text),text,0,&valuesonly,&ev));
+    if(ev.values != 11) FAIL("wrong number of values");
+
+    /* A callback can stop the parse */
+    memset(&ev,0,sizeof(ev));
+    ev.stopat = 3;
+    if(NCJparsecb(strlen(text),text,0,&cb,&ev) == NCJ_OK) FAIL("parse not stopped");
+    if(ev.values != 3) FAIL("parse continued after stop");
+
+    /* Malformed input */
+    memset(&ev,0,sizeof(ev));
+    if(NCJparsecb(6,"[1, 2}",0,&cb,&ev) == NCJ_OK) FAIL("malformed text accepted");
+    if(NCJparsecb(8,"{\"a\" 1}",0,&cb,&ev) == NCJ_OK) FAIL("malformed text accepted");
+}
+
+static void
+testarena(void)
+{
+    NCjson* json = NULL;
+    NCjson* jarena = NULL;
+    NCjson* jclone = NULL;
+    NCjson* jtmp = NULL;
+    const NCjson* jvalue = NULL;
+    char* expected = NULL;
+    char* result = NULL;
+    char* big = NULL;
+    char name[32];
+    size_t pos;
+    int i;
+
+    CHECK(NCJparse(text,0,&json));
+    CHECK(NCJparse(text,NCJFLAG_ARENA,&jarena));
+    CHECK(NCJunparse(json,0,&expected));
+    CHECK(NCJunparse(jarena,0,&result));
+    if(strcmp(expected,result) != 0) FAIL("arena parse differs");
+    free(result); result = NULL;
+
+    /* Clones of arena nodes are independent */
+    CHECK(NCJclone(NCJdictlookup(jarena,"nested"),&jclone));
+
+    /* Modify the arena tree */
+    CHECK(NCJinsertstring(jarena,"added","value"));
+    CHECK(NCJnewstring(NCJ_INT,"7",&jtmp));
+    CHECK(NCJoverwrite(jarena,"zarr_format",jtmp));
+    jtmp = NULL;
+    CHECK(NCJappendint((NCjson*)NCJdictlookup(jarena,"shape"),30));
+    CHECK(NCJappendint((NCjson*)NCJdictlookup(jarena,"filters"),1));
+    CHECK(NCJdictget(jarena,"shape",&jvalue));
+    if(NCJarraylength(jvalue) != 3 || strcmp(NCJstring(NCJith(jvalue,2)),"30") != 0)
+	FAIL("wrong array after append");
+    if(strcmp(NCJstring(NCJdictlookup(jarena,"added")),"value") != 0)
+	FAIL("wrong value after insert");
+    if(strcmp(NCJstring(NCJdictlookup(jarena,"zarr_format")),"7") != 0)
+	FAIL("wrong value after overwrite");
+    NCJreclaim(jarena); jarena = NULL;
+
+    CHECK(NCJunparse(jclone,0,&result));
+    if(strstr(expected,result) == NULL) FAIL("clone of arena subtree differs");
+    free(result); result = NULL;
+
+    /* A dict that is large enough to be indexed */
+    if((big = (char*)malloc(NKEYS*32+2)) == NULL) FAIL("out of memory");
+    strcpy(big,"{");
+    for(i=0;i<NKEYS;i++) {
+	pos = strlen(big);
+	snprintf(big+pos,32,"%s\"k%d\": %d",(i == 0 ? "" : ", "),i,i);
+    }
+    strcat(big,"}");
+    CHECK(NCJparse(big,NCJFLAG_ARENA,&jarena));
+    for(i=0;i<NKEYS;i++) {
+	snprintf(name,sizeof(name),"k%d",i);
+	jvalue = NCJdictlookup(jarena,name);
+	if(jvalue == NULL || atoi(NCJstring(jvalue)) != i) FAIL("wrong lookup in arena dict");
+    }
+    for(i=NKEYS;i<2*NKEYS;i++) {
+	snprintf(name,sizeof(name),"k%d",i);
+	CHECK(NCJinsertint(jarena,name,i));
+    }
+    for(i=0;i<2*NKEYS;i++) {
+	snprintf(name,sizeof(name),"k%d",i);
+	jvalue = NCJdictlookup(jarena,name);
+	if(jvalue == NULL || atoi(NCJstring(jvalue)) != i) FAIL("wrong lookup after insert");
+    }
+    NCJreclaim(jarena); jarena = NULL;
+
+    /* Malformed input must not leak the arena */
+    if(NCJparse("{\"a\": [1, {\"b\": 2}}",NCJFLAG_ARENA,&jarena) == NCJ_OK) FAIL("malformed text accepted");
+
+    free(big);
+    free(expected);
+    NCJreclaim(jclone);
+    NCJreclaim(json);
+}
+
+int
+main(int argc, char **argv)
+{
+    (void)argc; (void)argv;
+
+    printf("*** Test JSON event parse...");
+    testevents();
+    printf("passed\n");
+
+    printf("*** Test JSON arena parse...");
+    testarena();
+    printf("passed\n");
+
+    return 0;
+}
@@ -0,0 +1,180 @@
+/* This is part of the netCDF package.
+   Copyright 2018 University Corporation for Atmospheric Research/Unidata
+   See COPYRIGHT file for conditions of use.
+
+   Test Zarr V3 storage: write a dataset with mode v3, check that
+   only zarr.json metadata objects and V3 chunk keys are produced,
+   then re-open it (plain, consolidated, sharded, and pure zarr)
+   and read everything back.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+#include "netcdf.h"
+
+#define PATH "tmp_zarrv3.file"
+
+#define NX 6
+#define NY 8
+#define NS 5
+
+#define ERR(r) {fprintf(stderr,"fail: line %d: (%d) %s\n",__LINE__,(r),nc_strerror((r))); exit(1);}
+#define CHECK(expr) {int stat_ = (expr); if(stat_) ERR(stat_);}
+#define FAIL(msg) {fprintf(stderr,"fail: line %d: %s\n",__LINE__,(msg)); exit(1);}
+
+static int data[NX][NY];
+static double fdata[NX];
+static const char text[NS+1] = "hello";
+
+static int
+exists(const char* path)
+{
+#ifdef HAVE_UNISTD_H
+    return (access(path,F_OK) == 0);
+#else
+    FILE* f = fopen(path,"r");
+    if(f != NULL) fclose(f);
+    return (f != NULL);
+#endif
+}
+
+static void
+create(const char* url, int purezarr)
+{
+    int ncid, grpid, varid, fvarid, cvarid, dimids[2], sdimid;
+    size_t chunks[2] = {2,4};
+    size_t fchunks[1] = {4};
+    double fill = -1.5;
+    size_t start[1] = {0};
+    size_t count[1] = {NX-2};
+    int scale = NX;
+
+    CHECK(nc_create(url,NC_NETCDF4|NC_CLOBBER,&ncid));
+    CHECK(nc_def_dim(ncid,"x",NX,&dimids[0]));
+    CHECK(nc_def_dim(ncid,"y",NY,&dimids[1]));
+    CHECK(nc_put_att_text(ncid,NC_GLOBAL,"title",strlen("zarr v3"),"zarr v3"));
+    CHECK(nc_def_var(ncid,"v",NC_INT,2,dimids,&varid));
+    CHECK(nc_def_var_chunking(ncid,varid,NC_CHUNKED,chunks));
+    CHECK(nc_put_att_int(ncid,varid,"scale",NC_INT,1,&scale));
+    CHECK(nc_def_var(ncid,"f",NC_DOUBLE,1,dimids,&fvarid));
+    CHECK(nc_def_var_chunking(ncid,fvarid,NC_CHUNKED,fchunks));
+    CHECK(nc_def_var_fill(ncid,fvarid,NC_FILL,&fill));
+    if(!purezarr) {
+	CHECK(nc_def_grp(ncid,"g",&grpid));
+	CHECK(nc_def_dim(grpid,"s",NS,&sdimid));
+	CHECK(nc_def_var(grpid,"c",NC_CHAR,1,&sdimid,&cvarid));
+    }
+    CHECK(nc_enddef(ncid));
+    CHECK(nc_put_var_int(ncid,varid,&data[0][0]));
+    /* Leave the tail of f unwritten so the fill value shows */
+    CHECK(nc_put_vara_double(ncid,fvarid,start,count,fdata));
+    if(!purezarr)
+	CHECK(nc_put_var_text(grpid,cvarid,text));
+    CHECK(nc_close(ncid));
+}
+
+static void
+verify(const char* url, int purezarr, int line)
+{
+    int ncid, grpid, varid, x, y, ndims, dimids[2];
+    int result[NX][NY];
+    double fresult[NX];
+    char tresult[NS+1];
+    char title[64];
+    size_t len;
+    int scale = 0;
+
+    CHECK(nc_open(url,NC_NOWRITE,&ncid));
+    CHECK(nc_inq_varid(ncid,"v",&varid));
+    CHECK(nc_inq_var(ncid,varid,NULL,NULL,&ndims,dimids,NULL));
+    if(ndims != 2) FAIL("wrong rank");
+    CHECK(nc_inq_dimlen(ncid,dimids[1],&len));
+    if(len != NY) FAIL("wrong dimension length");
+    memset(result,0,sizeof(result));
+    CHECK(nc_get_var_int(ncid,varid,&result[0][0]));
+    for(x=0;x<NX;x++) for(y=0;y<NY;y++) {
+	if(result[x][y] != data[x][y]) {
+	    fprintf(stderr,"line %d: mismatch [%d][%d]: %d != %d\n",line,x,y,result[x][y],data[x][y]);
+	    exit(1);
+	}
+    }
+    CHECK(nc_get_att_int(ncid,varid,"scale",&scale));
+    if(scale != NX) FAIL("wrong attribute value");
+    CHECK(nc_inq_attlen(ncid,NC_GLOBAL,"title",&len));
+    if(len != strlen("zarr v3")) FAIL("wrong attribute length");
+    CHECK(nc_get_att_text(ncid,NC_GLOBAL,"title",title));
+    if(memcmp(title,"zarr v3",len) != 0) FAIL("wrong attribute text");
+
+    CHECK(nc_inq_varid(ncid,"f",&varid));
+    CHECK(nc_get_var_double(ncid,varid,fresult));
+    for(x=0;x<NX;x++) {
+	double expected = (x < NX-2 ? fdata[x] : -1.5);
+	if(fresult[x] != expected) {
+	    fprintf(stderr,"line %d: mismatch f[%d]: %g != %g\n",line,x,fresult[x],expected);
+	    exit(1);
+	}
+    }
+
+    if(!purezarr) {
+	CHECK(nc_inq_grp_ncid(ncid,"g",&grpid));
+	CHECK(nc_inq_varid(grpid,"c",&varid));
+	memset(tresult,0,sizeof(tresult));
+	CHECK(nc_get_var_text(grpid,varid,tresult));
+	if(memcmp(tresult,text,NS) != 0) FAIL("wrong char data");
+    }
+    CHECK(nc_close(ncid));
+}
+
+int
+main(int argc, char **argv)
+{
+    int x, y;
+
+    (void)argc; (void)argv;
+
+    for(x=0;x<NX;x++) for(y=0;y<NY;y++) data[x][y] = x*NY+y;
+    for(x=0;x<NX;x++) fdata[x] = 0.25*x;
+
+    printf("*** Test Zarr V3 create...");
+    create("file://" PATH "#mode=nczarr,file,v3",0);
+    if(!exists(PATH "/zarr.json") || !exists(PATH "/v/zarr.json") || !exists(PATH "/g/c/zarr.json"))
+	FAIL("missing zarr.json");
+    if(exists(PATH "/.zgroup") || exists(PATH "/v/.zarray") || exists(PATH "/.zattrs"))
+	FAIL("V2 metadata written");
+    if(!exists(PATH "/v/c/0/0") || !exists(PATH "/v/c/2/1"))
+	FAIL("missing V3 chunk key");
+    printf("passed\n");
+
+    printf("*** Test Zarr V3 read...");
+    verify("file://" PATH "#mode=nczarr,file",0,__LINE__);
+    printf("passed\n");
+
+    printf("*** Test Zarr V3 consolidated...");
+    create("file://" PATH "#mode=nczarr,file,v3,consolidated",0);
+    verify("file://" PATH "#mode=nczarr,file,consolidated",0,__LINE__);
+    verify("file://" PATH "#mode=nczarr,file",0,__LINE__);
+    printf("passed\n");
+
+    printf("*** Test Zarr V3 sharded...");
+    create("file://" PATH "#mode=nczarr,file,v3&shard=2",0);
+    /* 3x2 chunks packed 2x2 per shard => shards 0..1 x 0 */
+    if(!exists(PATH "/v/c/0/0") || !exists(PATH "/v/c/1/0") || exists(PATH "/v/c/0/1"))
+	FAIL("wrong shard layout");
+    verify("file://" PATH "#mode=nczarr,file",0,__LINE__);
+    printf("passed\n");
+
+    printf("*** Test Zarr V3 pure zarr...");
+    create("file://" PATH "#mode=zarr,file,v3",1);
+    verify("file://" PATH "#mode=zarr,file",1,__LINE__);
+    printf("passed\n");
+
+    return 0;
+}
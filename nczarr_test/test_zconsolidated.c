@@ -0,0 +1,157 @@
+/* This is part of the netCDF package.
+   Copyright 2018 University Corporation for Atmospheric Research/Unidata
+   See COPYRIGHT file for conditions of use.
+
+   Test consolidated (.zmetadata) metadata in nested groups:
+   changes made through a handle must be visible through that
+   same handle, and must be in the .zmetadata written at close,
+   both for a created dataset and for one opened for writing.
+   run_consolidated.sh compares the result with a plain open.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "netcdf.h"
+
+#define PATH "tmp_zconsolidated.file"
+#define URL "file://" PATH "#mode=nczarr,file"
+#define CSLURL URL ",consolidated"
+
+#define NX 4
+
+#define ERR(r) {fprintf(stderr,"fail: line %d: (%d) %s\n",__LINE__,(r),nc_strerror((r))); exit(1);}
+#define CHECK(expr) {int stat_ = (expr); if(stat_) ERR(stat_);}
+#define FAIL(msg) {fprintf(stderr,"fail: line %d: %s\n",__LINE__,(msg)); exit(1);}
+
+static void
+checkvar(int grpid, const char* name, int base)
+{
+    int varid, x;
+    int data[NX];
+
+    CHECK(nc_inq_varid(grpid,name,&varid));
+    CHECK(nc_get_var_int(grpid,varid,data));
+    for(x=0;x<NX;x++)
+	if(data[x] != base+x) FAIL(name);
+}
+
+static void
+putvar(int grpid, const char* name, int base)
+{
+    int varid, x;
+    int data[NX];
+
+    for(x=0;x<NX;x++) data[x] = base+x;
+    CHECK(nc_inq_varid(grpid,name,&varid));
+    CHECK(nc_put_var_int(grpid,varid,data));
+}
+
+static void
+checkatt(int grpid, const char* name, const char* value)
+{
+    size_t len;
+    char text[64];
+
+    CHECK(nc_inq_attlen(grpid,NC_GLOBAL,name,&len));
+    if(len != strlen(value)) FAIL(name);
+    CHECK(nc_get_att_text(grpid,NC_GLOBAL,name,text));
+    if(memcmp(text,value,len) != 0) FAIL(name);
+}
+
+static void
+getgroups(int ncid, int* g1p, int* g2p)
+{
+    CHECK(nc_inq_grp_ncid(ncid,"g1",g1p));
+    CHECK(nc_inq_grp_ncid(*g1p,"g2",g2p));
+}
+
+/* What every open must see once the dataset is complete */
+static void
+checkall(int ncid)
+{
+    int g1, g2, nvars;
+
+    getgroups(ncid,&g1,&g2);
+    checkvar(ncid,"rv",0);
+    checkvar(g1,"v1",100);
+    checkvar(g1,"w1",300);
+    checkvar(g2,"v2",200);
+    checkvar(g2,"w2",400);
+    CHECK(nc_inq_nvars(g2,&nvars));
+    if(nvars != 2) FAIL("g2 variables");
+    checkatt(ncid,"title","root");
+    checkatt(g2,"a","x");
+    checkatt(g2,"b","added");
+}
+
+int
+main(void)
+{
+    int ncid, g1, g2, dimid, varid;
+    FILE* f = NULL;
+
+    printf("*** Test create of nested groups...");
+    CHECK(nc_create(CSLURL,NC_NETCDF4|NC_CLOBBER,&ncid));
+    CHECK(nc_def_dim(ncid,"x",NX,&dimid));
+    CHECK(nc_def_var(ncid,"rv",NC_INT,1,&dimid,&varid));
+    CHECK(nc_put_att_text(ncid,NC_GLOBAL,"title",4,"root"));
+    CHECK(nc_def_grp(ncid,"g1",&g1));
+    CHECK(nc_def_var(g1,"v1",NC_INT,1,&dimid,&varid));
+    CHECK(nc_def_grp(g1,"g2",&g2));
+    CHECK(nc_def_var(g2,"v2",NC_INT,1,&dimid,&varid));
+    CHECK(nc_put_att_text(g2,NC_GLOBAL,"a",8,"original"));
+    CHECK(nc_enddef(ncid));
+    putvar(ncid,"rv",0);
+    putvar(g1,"v1",100);
+    putvar(g2,"v2",200);
+    /* Add to a group whose metadata has already been written */
+    CHECK(nc_redef(ncid));
+    CHECK(nc_def_var(g1,"w1",NC_INT,1,&dimid,&varid));
+    CHECK(nc_enddef(ncid));
+    putvar(g1,"w1",300);
+    checkvar(g1,"v1",100);
+    checkvar(g1,"w1",300);
+    checkvar(g2,"v2",200);
+    checkatt(g2,"a","original");
+    CHECK(nc_close(ncid));
+    if((f = fopen(PATH "/.zmetadata","rb")) == NULL) FAIL("no .zmetadata");
+    fclose(f);
+    printf("passed\n");
+
+    printf("*** Test update of an existing dataset...");
+    CHECK(nc_open(CSLURL,NC_WRITE,&ncid));
+    getgroups(ncid,&g1,&g2);
+    checkatt(g2,"a","original");
+    CHECK(nc_redef(ncid));
+    CHECK(nc_put_att_text(g2,NC_GLOBAL,"b",5,"added"));
+    CHECK(nc_def_var(g2,"w2",NC_INT,1,&dimid,&varid));
+    CHECK(nc_enddef(ncid));
+    putvar(g2,"w2",400);
+    checkvar(g2,"v2",200);
+    checkvar(g2,"w2",400);
+    checkatt(g2,"b","added");
+    CHECK(nc_close(ncid));
+    /* Replace by a shorter value, so that the metadata shrinks */
+    CHECK(nc_open(CSLURL,NC_WRITE,&ncid));
+    getgroups(ncid,&g1,&g2);
+    CHECK(nc_put_att_text(g2,NC_GLOBAL,"a",1,"x"));
+    checkall(ncid);
+    CHECK(nc_close(ncid));
+    printf("passed\n");
+
+    printf("*** Test read with and without .zmetadata...");
+    CHECK(nc_open(CSLURL,NC_NOWRITE,&ncid));
+    checkall(ncid);
+    CHECK(nc_close(ncid));
+    CHECK(nc_open(URL,NC_NOWRITE,&ncid));
+    checkall(ncid);
+    CHECK(nc_close(ncid));
+    printf("passed\n");
+
+    return 0;
+}
@@ -0,0 +1,184 @@
+/* This is part of the netCDF package.
+   Copyright 2018 University Corporation for Atmospheric Research/Unidata
+   See COPYRIGHT file for conditions of use.
+
+   Test that reads of whole chunks, which go straight to the caller's
+   memory, see the same data as reads through the chunk cache: for
+   stored chunks, partial edge chunks, chunks never written (filled),
+   chunks only partly written, and chunks modified but not yet
+   written out; with the chunks kept in the cache and without.
+   A chunk object that is too short must be reported.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "netcdf.h"
+
+#define PATH "tmp_zdirect.file"
+#define URL "file://" PATH "#mode=nczarr,file"
+
+/* Chunks span whole rows, so whole-variable reads take whole chunks
+   directly; the last chunk of each variable is a partial edge chunk */
+#define NZ 11
+#define NY 3
+#define NX 4
+#define CZ 3
+#define FILL -7
+#define DFILL -1.25
+
+#define ERR(r) {fprintf(stderr,"fail: line %d: (%d) %s\n",__LINE__,(r),nc_strerror((r))); exit(1);}
+#define CHECK(expr) {int stat_ = (expr); if(stat_) ERR(stat_);}
+#define FAIL(msg) {fprintf(stderr,"fail: line %d: %s\n",__LINE__,(msg)); exit(1);}
+
+/* The expected content of v (int) and d (double) */
+static int vmodel[NZ][NY][NX];
+static double dmodel[NZ][NY][NX];
+
+/* Write planes [z0,z1) of both variables */
+static void
+putplanes(int ncid, size_t z0, size_t z1, int base)
+{
+    size_t start[3] = {z0,0,0}, count[3] = {z1-z0,NY,NX};
+    size_t z, y, x;
+    for(z=z0;z<z1;z++)
+	for(y=0;y<NY;y++)
+	    for(x=0;x<NX;x++) {
+		vmodel[z][y][x] = base + (int)(z*100 + y*10 + x);
+		dmodel[z][y][x] = vmodel[z][y][x] + 0.5;
+	    }
+    CHECK(nc_put_vara_int(ncid,0,start,count,&vmodel[z0][0][0]));
+    CHECK(nc_put_vara_double(ncid,1,start,count,&dmodel[z0][0][0]));
+}
+
+/* Read one value at a time, which never covers a whole chunk */
+static void
+verifycached(int ncid)
+{
+    size_t index[3];
+    int v;
+    double d;
+    for(index[0]=0;index[0]<NZ;index[0]++)
+	for(index[1]=0;index[1]<NY;index[1]++)
+	    for(index[2]=0;index[2]<NX;index[2]++) {
+		CHECK(nc_get_var1_int(ncid,0,index,&v));
+		CHECK(nc_get_var1_double(ncid,1,index,&d));
+		if(v != vmodel[index[0]][index[1]][index[2]]) FAIL("wrong int in cached read");
+		if(d != dmodel[index[0]][index[1]][index[2]]) FAIL("wrong double in cached read");
+	    }
+}
+
+/* Read the variables whole and in whole-chunk slabs */
+static void
+verifydirect(int ncid)
+{
+    static int v[NZ][NY][NX];
+    static double d[NZ][NY][NX];
+    size_t start[3] = {CZ,0,0}, count[3] = {2*CZ,NY,NX};
+
+    memset(v,0,sizeof(v));
+    memset(d,0,sizeof(d));
+    CHECK(nc_get_var_int(ncid,0,&v[0][0][0]));
+    CHECK(nc_get_var_double(ncid,1,&d[0][0][0]));
+    if(memcmp(v,vmodel,sizeof(v)) != 0) FAIL("wrong int in whole read");
+    if(memcmp(d,dmodel,sizeof(d)) != 0) FAIL("wrong double in whole read");
+    CHECK(nc_get_vara_int(ncid,0,start,count,&v[0][0][0]));
+    if(memcmp(v,vmodel[CZ],sizeof(int)*2*CZ*NY*NX) != 0) FAIL("wrong int in chunk slab read");
+}
+
+/* Open read-only with the given cache and compare both kinds of reads,
+   in both orders */
+static void
+verify(size_t cachesize, float preemption)
+{
+    int ncid, varid;
+
+    CHECK(nc_open(URL,NC_NOWRITE,&ncid));
+    for(varid=0;varid<2;varid++)
+	CHECK(nc_set_var_chunk_cache(ncid,varid,cachesize,16,preemption));
+    verifydirect(ncid); /* cold */
+    verifycached(ncid);
+    verifydirect(ncid); /* warm, if the cache kept the chunks */
+    CHECK(nc_close(ncid));
+
+    CHECK(nc_open(URL,NC_NOWRITE,&ncid));
+    for(varid=0;varid<2;varid++)
+	CHECK(nc_set_var_chunk_cache(ncid,varid,cachesize,16,preemption));
+    verifycached(ncid);
+    verifydirect(ncid);
+    CHECK(nc_close(ncid));
+}
+
+static void
+verifyall(void)
+{
+    verify(1<<20,0.5f); /* the chunks of a request stay in the cache */
+    verify(1<<20,1.0f); /* fully read chunks are not kept */
+    verify(64,0.5f); /* too small for a single chunk */
+}
+
+int
+main(void)
+{
+    int ncid, dimids[3], varid;
+    size_t chunks[3] = {CZ,NY,NX};
+    int fill = FILL;
+    double dfill = DFILL;
+    size_t z, y, x;
+
+    printf("*** Test direct chunk reads against cached reads...");
+    for(z=0;z<NZ;z++)
+	for(y=0;y<NY;y++)
+	    for(x=0;x<NX;x++) {
+		vmodel[z][y][x] = FILL;
+		dmodel[z][y][x] = DFILL;
+	    }
+
+    CHECK(nc_create(URL,NC_CLOBBER|NC_NETCDF4,&ncid));
+    CHECK(nc_def_dim(ncid,"z",NZ,&dimids[0]));
+    CHECK(nc_def_dim(ncid,"y",NY,&dimids[1]));
+    CHECK(nc_def_dim(ncid,"x",NX,&dimids[2]));
+    CHECK(nc_def_var(ncid,"v",NC_INT,3,dimids,&varid));
+    CHECK(nc_def_var_chunking(ncid,varid,NC_CHUNKED,chunks));
+    CHECK(nc_def_var_fill(ncid,varid,NC_FILL,&fill));
+    CHECK(nc_def_var(ncid,"d",NC_DOUBLE,3,dimids,&varid));
+    CHECK(nc_def_var_chunking(ncid,varid,NC_CHUNKED,chunks));
+    CHECK(nc_def_var_fill(ncid,varid,NC_FILL,&dfill));
+    CHECK(nc_enddef(ncid));
+    /* Chunk 0 whole, chunk 1 never, chunk 2 one plane, edge chunk 3 whole */
+    putplanes(ncid,0,CZ,0);
+    putplanes(ncid,2*CZ+1,2*CZ+2,0);
+    putplanes(ncid,3*CZ,NZ,0);
+    CHECK(nc_close(ncid));
+    verifyall();
+
+    /* A writable file: the fill chunks read directly must still be
+       written out, and chunks modified in the cache must be seen */
+    CHECK(nc_open(URL,NC_WRITE,&ncid));
+    verifydirect(ncid);
+    putplanes(ncid,CZ+1,CZ+2,5000); /* into the unwritten chunk */
+    putplanes(ncid,0,CZ,6000); /* replaces a whole chunk */
+    verifydirect(ncid);
+    verifycached(ncid);
+    CHECK(nc_close(ncid));
+    verifyall();
+
+    /* A chunk object shorter than a chunk is an error, not fill */
+    {
+	static int v[NZ][NY][NX];
+	FILE* f = NULL;
+	if((f = fopen(PATH "/v/0.0.0","wb")) == NULL) FAIL("cannot rewrite chunk");
+	fwrite(vmodel,sizeof(int),1,f);
+	fclose(f);
+	CHECK(nc_open(URL,NC_NOWRITE,&ncid));
+	if(nc_get_var_int(ncid,0,&v[0][0][0]) != NC_ENCZARR) FAIL("short chunk not detected");
+	CHECK(nc_close(ncid));
+    }
+
+    printf("*** PASS\n");
+    return 0;
+}
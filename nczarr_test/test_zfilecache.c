@@ -0,0 +1,92 @@
+/* This is part of the netCDF package.
+   Copyright 2018 University Corporation for Atmospheric Research/Unidata
+   See COPYRIGHT file for conditions of use.
+
+   Test the open file cache of the file storage format: a
+   variable with more chunks than the cache holds is written,
+   rewritten and read back, serially and concurrently, so that
+   descriptors are evicted while others are in use.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "netcdf.h"
+
+#define PATH "tmp_zfilecache.file"
+#define URL "file://" PATH "#mode=nczarr,file"
+#define URLTHREADS "file://" PATH "#mode=nczarr,file&nthreads=4"
+
+#define NCHUNKS 300 /* more than the default number of open files */
+#define CHUNK 4
+#define NX (NCHUNKS*CHUNK)
+
+#define ERR(r) {fprintf(stderr,"fail: line %d: (%d) %s\n",__LINE__,(r),nc_strerror((r))); exit(1);}
+#define CHECK(expr) {int stat_ = (expr); if(stat_) ERR(stat_);}
+#define FAIL(msg) {fprintf(stderr,"fail: line %d: %s\n",__LINE__,(msg)); exit(1);}
+
+static int data[NX];
+static int result[NX];
+
+static void
+verify(const char* url, int bias)
+{
+    int ncid, varid, x;
+
+    CHECK(nc_open(url,NC_NOWRITE,&ncid));
+    CHECK(nc_inq_varid(ncid,"v",&varid));
+    /* Read twice so the second pass finds some files open */
+    CHECK(nc_get_var_int(ncid,varid,result));
+    memset(result,0,sizeof(result));
+    CHECK(nc_get_var_int(ncid,varid,result));
+    for(x=0;x<NX;x++)
+	if(result[x] != x + (x % 2 ? bias : 0)) FAIL("wrong data");
+    CHECK(nc_close(ncid));
+}
+
+int
+main(int argc, char **argv)
+{
+    int ncid, dimid, varid, x;
+    size_t chunk = CHUNK;
+    size_t start, count;
+
+    (void)argc; (void)argv;
+
+    printf("*** Test open file cache write...");
+    CHECK(nc_create(URL,NC_NETCDF4|NC_CLOBBER,&ncid));
+    CHECK(nc_def_dim(ncid,"x",NX,&dimid));
+    CHECK(nc_def_var(ncid,"v",NC_INT,1,&dimid,&varid));
+    CHECK(nc_def_var_chunking(ncid,varid,NC_CHUNKED,&chunk));
+    CHECK(nc_enddef(ncid));
+    for(x=0;x<NX;x++) data[x] = x;
+    CHECK(nc_put_var_int(ncid,varid,data));
+    CHECK(nc_close(ncid));
+    verify(URL,0);
+    printf("passed\n");
+
+    printf("*** Test open file cache rewrite...");
+    CHECK(nc_open(URLTHREADS,NC_WRITE,&ncid));
+    CHECK(nc_inq_varid(ncid,"v",&varid));
+    for(x=0;x<NX;x++) data[x] = x + (x % 2 ? 1000 : 0);
+    /* Write one chunk at a time, then the whole variable */
+    for(start=0;start<NX;start+=CHUNK) {
+	count = CHUNK;
+	CHECK(nc_put_vara_int(ncid,varid,&start,&count,data+start));
+    }
+    CHECK(nc_sync(ncid));
+    CHECK(nc_put_var_int(ncid,varid,data));
+    CHECK(nc_close(ncid));
+    printf("passed\n");
+
+    printf("*** Test open file cache concurrent read...");
+    verify(URLTHREADS,1000);
+    verify(URL,1000);
+    printf("passed\n");
+
+    return 0;
+}
@@ -0,0 +1,149 @@
+/* This is part of the netCDF package.
+   Copyright 2018 University Corporation for Atmospheric Research/Unidata
+   See COPYRIGHT file for conditions of use.
+
+   Test the chunk inventory: a read-only open with mode=inventory
+   must read a sparse variable correctly, filling the chunks that
+   are not stored, and must take the set of stored chunks from a
+   single listing; so a chunk stored by someone else after that
+   listing is not seen, while it is seen without the inventory.
+   The file store is listed one level at a time, the in-memory
+   store with one recursive listing.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <direct.h>
+#define mkdir(path,mode) _mkdir(path)
+#endif
+
+#include "netcdf.h"
+
+#define PATH "tmp_zinventory.file"
+
+#define N 8
+#define C 2
+
+#define ERR(r) {fprintf(stderr,"fail: line %d: (%d) %s\n",__LINE__,(r),nc_strerror((r))); exit(1);}
+#define CHECK(expr) {int stat_ = (expr); if(stat_) ERR(stat_);}
+#define FAIL(msg) {fprintf(stderr,"fail: line %d: %s\n",__LINE__,(msg)); exit(1);}
+
+static int data[N][N];
+
+static void
+copyfile(const char* from, const char* to)
+{
+    char buf[1024];
+    size_t n;
+    FILE* f = fopen(from,"rb");
+    FILE* t = fopen(to,"wb");
+    if(f == NULL || t == NULL) FAIL("cannot copy chunk");
+    while((n = fread(buf,1,sizeof(buf),f)) > 0) fwrite(buf,1,n,t);
+    fclose(f);
+    fclose(t);
+}
+
+/* Value of element (y,x) when only chunks (0,0) and (3,3) are stored */
+static int
+expected(int y, int x)
+{
+    if((y/C == 0 && x/C == 0) || (y/C == 3 && x/C == 3)) return y*N+x;
+    return NC_FILL_INT;
+}
+
+static void
+test(const char* url, const char* dir11, const char* chunk11, const char* chunk00)
+{
+    char urlinv[256];
+    int ncid, ncid2, dimids[2], varid, y, x, value;
+    size_t chunks[2] = {C,C};
+    size_t start[2], count[2];
+    int result[N][N];
+
+    snprintf(urlinv,sizeof(urlinv),"%s%s",url,",inventory");
+
+    CHECK(nc_create(url,NC_NETCDF4|NC_CLOBBER,&ncid));
+    CHECK(nc_def_dim(ncid,"y",N,&dimids[0]));
+    CHECK(nc_def_dim(ncid,"x",N,&dimids[1]));
+    CHECK(nc_def_var(ncid,"v",NC_INT,2,dimids,&varid));
+    CHECK(nc_def_var_chunking(ncid,varid,NC_CHUNKED,chunks));
+    CHECK(nc_enddef(ncid));
+    for(y=0;y<N;y++) for(x=0;x<N;x++) data[y][x] = y*N+x;
+    /* Store only chunks (0,0) and (3,3), a row at a time */
+    count[0] = 1; count[1] = C;
+    for(y=0;y<C;y++) {
+	start[0] = (size_t)y; start[1] = 0;
+	CHECK(nc_put_vara_int(ncid,varid,start,count,&data[start[0]][start[1]]));
+	start[0] = (size_t)(N-C+y); start[1] = N-C;
+	CHECK(nc_put_vara_int(ncid,varid,start,count,&data[start[0]][start[1]]));
+    }
+    CHECK(nc_close(ncid));
+
+    CHECK(nc_open(urlinv,NC_NOWRITE,&ncid));
+    CHECK(nc_inq_varid(ncid,"v",&varid));
+    /* One element at a time through the chunk cache */
+    for(y=0;y<N;y++) for(x=0;x<N;x++) {
+	start[0] = (size_t)y; start[1] = (size_t)x;
+	CHECK(nc_get_var1_int(ncid,varid,start,&value));
+	if(value != expected(y,x)) FAIL("wrong element");
+    }
+    /* Whole chunks straight into memory */
+    memset(result,0,sizeof(result));
+    CHECK(nc_get_var_int(ncid,varid,&result[0][0]));
+    for(y=0;y<N;y++) for(x=0;x<N;x++)
+	if(result[y][x] != expected(y,x)) FAIL("wrong data");
+
+    start[0] = C; start[1] = C;
+    if(chunk00 != NULL) {
+	/* Store chunk (1,1) behind the library's back */
+	if(dir11 != NULL) (void)mkdir(dir11,0777);
+	copyfile(chunk00,chunk11);
+    } else {
+	/* Store chunk (1,1) through another handle on the same store */
+	value = 0;
+	CHECK(nc_open(url,NC_WRITE,&ncid2));
+	CHECK(nc_put_var1_int(ncid2,varid,start,&value));
+	CHECK(nc_close(ncid2));
+    }
+    CHECK(nc_set_var_chunk_cache(ncid,varid,0,0,0.75f)); /* forget cached chunks */
+    CHECK(nc_get_var1_int(ncid,varid,start,&value));
+    if(value != NC_FILL_INT) FAIL("inventory not used");
+    CHECK(nc_open(url,NC_NOWRITE,&ncid2));
+    CHECK(nc_get_var1_int(ncid2,varid,start,&value));
+    if(value != 0) FAIL("wrong data without inventory");
+    CHECK(nc_close(ncid2));
+    CHECK(nc_close(ncid));
+
+    /* A writable open ignores the inventory */
+    CHECK(nc_open(urlinv,NC_WRITE,&ncid));
+    CHECK(nc_get_var1_int(ncid,varid,start,&value));
+    if(value != 0) FAIL("inventory used for a writable dataset");
+    CHECK(nc_close(ncid));
+}
+
+int
+main(int argc, char **argv)
+{
+    (void)argc; (void)argv;
+
+    printf("*** Test chunk inventory...");
+    test("file://" PATH "#mode=nczarr,file",NULL,PATH "/v/1.1",PATH "/v/0.0");
+    printf("passed\n");
+
+    printf("*** Test chunk inventory with nested chunk keys...");
+    test("file://" PATH "#mode=nczarr,file,v3",PATH "/v/c/1",PATH "/v/c/1/1",PATH "/v/c/0/0");
+    printf("passed\n");
+
+    printf("*** Test chunk inventory from a recursive listing...");
+    test("file://tmp_zinventory.zarr#mode=nczarr,mem",NULL,NULL,NULL);
+    test("file://tmp_zinventory.zarr#mode=nczarr,mem,v3",NULL,NULL,NULL);
+    printf("passed\n");
+
+    return 0;
+}
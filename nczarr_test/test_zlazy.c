@@ -0,0 +1,138 @@
+/* This is part of the netCDF package.
+   Copyright 2018 University Corporation for Atmospheric Research/Unidata
+   See COPYRIGHT file for conditions of use.
+
+   Test lazy reading of variable metadata: a read-only open
+   must not read the metadata of a variable until it is used,
+   so damaging one variable's .zarray only affects that variable.
+   A variable that cannot be represented must be left out as
+   a writable open does.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "netcdf.h"
+
+#define PATH "tmp_zlazy.file"
+#define URL "file://" PATH "#mode=nczarr,file"
+
+#define NVARS 3
+#define NX 5
+
+#define ERR(r) {fprintf(stderr,"fail: line %d: (%d) %s\n",__LINE__,(r),nc_strerror((r))); exit(1);}
+#define CHECK(expr) {int stat_ = (expr); if(stat_) ERR(stat_);}
+#define FAIL(msg) {fprintf(stderr,"fail: line %d: %s\n",__LINE__,(msg)); exit(1);}
+
+static void
+create(void)
+{
+    int ncid, dimid, varid, i, x;
+    int data[NX];
+    char name[NC_MAX_NAME+1];
+
+    CHECK(nc_create(URL,NC_NETCDF4|NC_CLOBBER,&ncid));
+    CHECK(nc_def_dim(ncid,"x",NX,&dimid));
+    for(i=0;i<NVARS;i++) {
+	snprintf(name,sizeof(name),"v%d",i);
+	CHECK(nc_def_var(ncid,name,NC_INT,1,&dimid,&varid));
+    }
+    CHECK(nc_enddef(ncid));
+    for(i=0;i<NVARS;i++) {
+	for(x=0;x<NX;x++) data[x] = 100*i+x;
+	CHECK(nc_put_var_int(ncid,i,data));
+    }
+    CHECK(nc_close(ncid));
+}
+
+/* Replace the .zarray of v1 */
+static void
+rewrite(const char* zarray)
+{
+    FILE* f = NULL;
+    if((f = fopen(PATH "/v1/.zarray","wb")) == NULL) FAIL("cannot rewrite .zarray");
+    fputs(zarray,f);
+    fclose(f);
+}
+
+/* v1 must be absent and v0 and v2 must be varids 0 and 1 */
+static void
+checksuppressed(int mode)
+{
+    int ncid, varid, nvars, ndims, i, x;
+    int varids[NVARS];
+    int result[NX];
+    char name[NC_MAX_NAME+1];
+    static const char* names[] = {"v0","v2"};
+
+    CHECK(nc_open(URL,mode,&ncid));
+    if(nc_inq_varid(ncid,"v1",&varid) != NC_ENOTVAR) FAIL("suppressed variable found");
+    CHECK(nc_inq_nvars(ncid,&nvars));
+    if(nvars != NVARS-1) FAIL("wrong number of variables");
+    CHECK(nc_inq_varids(ncid,&nvars,varids));
+    if(nvars != NVARS-1) FAIL("wrong number of varids");
+    for(i=0;i<nvars;i++) {
+	if(varids[i] != i) FAIL("varids not renumbered");
+	CHECK(nc_inq_var(ncid,i,name,NULL,&ndims,NULL,NULL));
+	if(strcmp(name,names[i]) != 0 || ndims != 1) FAIL("wrong metadata");
+	CHECK(nc_get_var_int(ncid,i,result));
+	for(x=0;x<NX;x++) if(result[x] != 200*i+x) FAIL("wrong data");
+    }
+    if(nc_inq_varndims(ncid,NVARS-1,&ndims) != NC_ENOTVAR) FAIL("stale varid accepted");
+    CHECK(nc_close(ncid));
+}
+
+int
+main(int argc, char **argv)
+{
+    int ncid, varid, nvars, ndims, x;
+    int result[NX];
+    char name[NC_MAX_NAME+1];
+    nc_type xtype;
+
+    (void)argc; (void)argv;
+
+    printf("*** Test lazy variable metadata create...");
+    create();
+    /* Damage the metadata of v1 */
+    rewrite("{\"zarr_format\": 2}");
+    printf("passed\n");
+
+    printf("*** Test lazy variable metadata read...");
+    CHECK(nc_open(URL,NC_NOWRITE,&ncid));
+    CHECK(nc_inq_nvars(ncid,&nvars));
+    if(nvars != NVARS) FAIL("wrong number of variables");
+    CHECK(nc_inq_varid(ncid,"v2",&varid));
+    CHECK(nc_inq_var(ncid,varid,name,&xtype,&ndims,NULL,NULL));
+    if(strcmp(name,"v2") != 0 || xtype != NC_INT || ndims != 1) FAIL("wrong v2 metadata");
+    CHECK(nc_get_var_int(ncid,varid,result));
+    for(x=0;x<NX;x++) if(result[x] != 200+x) FAIL("wrong v2 data");
+    CHECK(nc_inq_varid(ncid,"v0",&varid));
+    CHECK(nc_get_var_int(ncid,varid,result));
+    for(x=0;x<NX;x++) if(result[x] != x) FAIL("wrong v0 data");
+    /* Only now is the damage seen */
+    CHECK(nc_inq_varid(ncid,"v1",&varid));
+    if(nc_inq_varndims(ncid,varid,&ndims) == NC_NOERR) FAIL("damaged .zarray not detected");
+    CHECK(nc_close(ncid));
+    printf("passed\n");
+
+    printf("*** Test eager variable metadata read...");
+    /* A writable open reads everything up front */
+    if(nc_open(URL,NC_WRITE,&ncid) == NC_NOERR) FAIL("damaged .zarray not detected");
+    printf("passed\n");
+
+    printf("*** Test suppressed variable...");
+    create();
+    /* Zarr has no representation for an empty shape here */
+    rewrite("{\"zarr_format\": 2, \"shape\": [], \"dtype\": \"<i4\", \"chunks\": [],"
+            " \"fill_value\": null, \"order\": \"C\", \"compressor\": null, \"filters\": null}");
+    checksuppressed(NC_NOWRITE);
+    checksuppressed(NC_WRITE);
+    printf("passed\n");
+
+    return 0;
+}
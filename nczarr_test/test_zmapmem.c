@@ -0,0 +1,119 @@
+/* This is part of the netCDF package.
+   Copyright 2018 University Corporation for Atmospheric Research/Unidata
+   See COPYRIGHT file for conditions of use.
+
+   Test the in-memory NCZarr map: create, close, re-open,
+   extract with nc_close_memio and inject with nc_open_memio,
+   all without touching the file system.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+#include "netcdf.h"
+#include "netcdf_mem.h"
+
+#define URL1 "file://tmp_zmapmem1.zarr#mode=nczarr,mem"
+#define URL2 "file://tmp_zmapmem2.zarr#mode=nczarr,mem"
+#define PATH1 "tmp_zmapmem1.zarr"
+#define PATH2 "tmp_zmapmem2.zarr"
+
+#define NX 4
+#define NY 6
+
+#define ERR(r) {fprintf(stderr,"fail: line %d: (%d) %s\n",__LINE__,(r),nc_strerror((r))); exit(1);}
+#define CHECK(expr) {int stat_ = (expr); if(stat_) ERR(stat_);}
+
+static int data[NX][NY];
+
+/* Read back the variable and compare to the original */
+static void
+verify(int ncid, int line)
+{
+    int varid;
+    int x, y;
+    int result[NX][NY];
+
+    CHECK(nc_inq_varid(ncid,"v",&varid));
+    memset(result,0,sizeof(result));
+    CHECK(nc_get_var_int(ncid,varid,&result[0][0]));
+    for(x=0;x<NX;x++) {
+        for(y=0;y<NY;y++) {
+	    if(result[x][y] != data[x][y]) {
+	        fprintf(stderr,"line %d: mismatch [%d][%d]: %d != %d\n",line,x,y,result[x][y],data[x][y]);
+		exit(1);
+	    }
+	}
+    }
+}
+
+static int
+exists(const char* path)
+{
+#ifdef HAVE_UNISTD_H
+    return (access(path,F_OK) == 0);
+#else
+    FILE* f = fopen(path,"r");
+    if(f != NULL) fclose(f);
+    return (f != NULL);
+#endif
+}
+
+int
+main(int argc, char **argv)
+{
+    int ncid, varid, dimids[2];
+    size_t chunks[2] = {2,3};
+    int x, y, stat;
+    NC_memio image;
+
+    (void)argc; (void)argv;
+
+    for(x=0;x<NX;x++) for(y=0;y<NY;y++) data[x][y] = x*NY+y;
+
+    printf("*** Test in-memory create and re-open...");
+    CHECK(nc_create(URL1,NC_NETCDF4|NC_CLOBBER,&ncid));
+    CHECK(nc_def_dim(ncid,"x",NX,&dimids[0]));
+    CHECK(nc_def_dim(ncid,"y",NY,&dimids[1]));
+    CHECK(nc_def_var(ncid,"v",NC_INT,2,dimids,&varid));
+    CHECK(nc_def_var_chunking(ncid,varid,NC_CHUNKED,chunks));
+    CHECK(nc_put_var_int(ncid,varid,&data[0][0]));
+    CHECK(nc_close(ncid));
+    CHECK(nc_open(URL1,NC_NOWRITE,&ncid));
+    verify(ncid,__LINE__);
+    CHECK(nc_close(ncid));
+    if(exists(PATH1)) {fprintf(stderr,"fail: %s was created on disk\n",PATH1); exit(1);}
+    printf("passed\n");
+
+    printf("*** Test in-memory extract and inject...");
+    CHECK(nc_open(URL1,NC_NOWRITE,&ncid));
+    memset(&image,0,sizeof(image));
+    CHECK(nc_close_memio(ncid,&image));
+    if(image.memory == NULL || image.size == 0) ERR(NC_EINMEMORY);
+    /* The extracted store is no longer available */
+    if((stat = nc_open(URL1,NC_NOWRITE,&ncid)) == NC_NOERR) ERR(NC_EINTERNAL);
+    /* Inject it under another name and modify it */
+    CHECK(nc_open_memio(URL2,NC_WRITE,&image,&ncid));
+    free(image.memory);
+    verify(ncid,__LINE__);
+    CHECK(nc_inq_varid(ncid,"v",&varid));
+    data[1][2] = -1;
+    CHECK(nc_put_var_int(ncid,varid,&data[0][0]));
+    CHECK(nc_close(ncid));
+    CHECK(nc_open(URL2,NC_NOWRITE,&ncid));
+    verify(ncid,__LINE__);
+    memset(&image,0,sizeof(image));
+    CHECK(nc_close_memio(ncid,&image));
+    if(exists(PATH2)) {fprintf(stderr,"fail: %s was created on disk\n",PATH2); exit(1);}
+    free(image.memory);
+    printf("passed\n");
+
+    return 0;
+}
@@ -0,0 +1,137 @@
+/* This is part of the netCDF package.
+   Copyright 2018 University Corporation for Atmospheric Research/Unidata
+   See COPYRIGHT file for conditions of use.
+
+   Test memory-mapped chunks: partial reads of a read-only dataset
+   opened with mode=mmap must see the same data as ordinary reads,
+   including reads that evict mapped chunks from a small cache,
+   the mode must be ignored by a writable open, and a damaged
+   chunk must be reported rather than touched beyond its end.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "netcdf.h"
+
+#define PATH "tmp_zmmap.file"
+#define URL "file://" PATH "#mode=nczarr,file"
+#define URLMMAP "file://" PATH "#mode=nczarr,file,mmap"
+
+#define NY 12
+#define NX 10
+#define CY 4
+#define CX 5
+
+#define ERR(r) {fprintf(stderr,"fail: line %d: (%d) %s\n",__LINE__,(r),nc_strerror((r))); exit(1);}
+#define CHECK(expr) {int stat_ = (expr); if(stat_) ERR(stat_);}
+#define FAIL(msg) {fprintf(stderr,"fail: line %d: %s\n",__LINE__,(msg)); exit(1);}
+
+static int data[NY][NX];
+
+/* Read the variable one row at a time, so every read goes through
+   the chunk cache; a small cache makes the reads evict chunks */
+static void
+verify(const char* url, int smallcache)
+{
+    int ncid, varid, y, x;
+    int row[NX];
+    size_t start[2], count[2];
+    char* s = NULL;
+    size_t index = 3;
+
+    CHECK(nc_open(url,NC_NOWRITE,&ncid));
+    CHECK(nc_inq_varid(ncid,"v",&varid));
+    if(smallcache) /* room for two chunks of 80 bytes */
+	CHECK(nc_set_var_chunk_cache(ncid,varid,200,2,0.5f));
+    for(y=0;y<NY;y++) {
+	start[0] = (size_t)y; start[1] = 0;
+	count[0] = 1; count[1] = NX;
+	CHECK(nc_get_vara_int(ncid,varid,start,count,row));
+	for(x=0;x<NX;x++)
+	    if(row[x] != data[y][x]) FAIL("wrong data");
+    }
+    /* and a column at a time, which goes back to evicted chunks */
+    for(x=0;x<NX;x++) {
+	int col[NY];
+	start[0] = 0; start[1] = (size_t)x;
+	count[0] = NY; count[1] = 1;
+	CHECK(nc_get_vara_int(ncid,varid,start,count,col));
+	for(y=0;y<NY;y++)
+	    if(col[y] != data[y][x]) FAIL("wrong data");
+    }
+    /* Strings are never mapped */
+    CHECK(nc_inq_varid(ncid,"s",&varid));
+    CHECK(nc_get_var1_string(ncid,varid,&index,&s));
+    if(strcmp(s,"three") != 0) FAIL("wrong string");
+    CHECK(nc_free_string(1,&s));
+    CHECK(nc_close(ncid));
+}
+
+int
+main(int argc, char **argv)
+{
+    int ncid, dimids[2], varid, svarid, y, x;
+    size_t chunks[2] = {CY,CX};
+    size_t start[2], count[2];
+    size_t sstart = 0, scount = 4;
+    const char* strings[4] = {"zero","one","two","three"};
+    int value;
+    FILE* f = NULL;
+
+    (void)argc; (void)argv;
+
+    printf("*** Test mapped chunk read...");
+    CHECK(nc_create(URL,NC_NETCDF4|NC_CLOBBER,&ncid));
+    CHECK(nc_def_dim(ncid,"y",NY,&dimids[0]));
+    CHECK(nc_def_dim(ncid,"x",NX,&dimids[1]));
+    CHECK(nc_def_var(ncid,"v",NC_INT,2,dimids,&varid));
+    CHECK(nc_def_var_chunking(ncid,varid,NC_CHUNKED,chunks));
+    CHECK(nc_def_var(ncid,"s",NC_STRING,1,&dimids[0],&svarid));
+    CHECK(nc_enddef(ncid));
+    for(y=0;y<NY;y++) for(x=0;x<NX;x++) data[y][x] = y*NX+x;
+    CHECK(nc_put_var_int(ncid,varid,&data[0][0]));
+    CHECK(nc_put_vara_string(ncid,svarid,&sstart,&scount,strings));
+    CHECK(nc_close(ncid));
+    verify(URL,0);
+    verify(URLMMAP,0);
+    printf("passed\n");
+
+    printf("*** Test mapped chunk eviction...");
+    verify(URL,1);
+    verify(URLMMAP,1);
+    printf("passed\n");
+
+    printf("*** Test mapped chunk mode ignored for write...");
+    CHECK(nc_open(URLMMAP,NC_WRITE,&ncid));
+    CHECK(nc_inq_varid(ncid,"v",&varid));
+    for(y=0;y<NY;y++) {
+	start[0] = (size_t)y; start[1] = (size_t)(y % NX);
+	count[0] = 1; count[1] = 1;
+	CHECK(nc_get_vara_int(ncid,varid,start,count,&value));
+	value += 100;
+	CHECK(nc_put_vara_int(ncid,varid,start,count,&value));
+	data[y][y % NX] += 100;
+    }
+    CHECK(nc_close(ncid));
+    verify(URLMMAP,0);
+    printf("passed\n");
+
+    printf("*** Test mapped chunk damage...");
+    /* Truncate one chunk */
+    if((f = fopen(PATH "/v/0.1","wb")) == NULL) FAIL("cannot truncate chunk");
+    fwrite(data,sizeof(int),3,f);
+    fclose(f);
+    CHECK(nc_open(URLMMAP,NC_NOWRITE,&ncid));
+    CHECK(nc_inq_varid(ncid,"v",&varid));
+    start[0] = 0; start[1] = CX; count[0] = 1; count[1] = 1;
+    if(nc_get_vara_int(ncid,varid,start,count,&value) == NC_NOERR) FAIL("short chunk not detected");
+    CHECK(nc_close(ncid));
+    printf("passed\n");
+
+    return 0;
+}
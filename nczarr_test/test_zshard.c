@@ -0,0 +1,142 @@
+/* This is part of the netCDF package.
+   Copyright 2018 University Corporation for Atmospheric Research/Unidata
+   See COPYRIGHT file for conditions of use.
+
+   Test sharded chunk storage: write with the shard fragment key,
+   check that chunks are packed into shard objects, then re-open
+   without the key, read back, and partially rewrite.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+#include "netcdf.h"
+
+#define PATH "tmp_zshard.file"
+#define URLSHARD "file://" PATH "#mode=nczarr,file&shard=2"
+#define URL "file://" PATH "#mode=nczarr,file"
+#define URLTHREADS "file://" PATH "#mode=nczarr,file&nthreads=4"
+
+#define NX 8
+#define NY 12
+
+#define ERR(r) {fprintf(stderr,"fail: line %d: (%d) %s\n",__LINE__,(r),nc_strerror((r))); exit(1);}
+#define CHECK(expr) {int stat_ = (expr); if(stat_) ERR(stat_);}
+
+static int data[NX][NY];
+
+/* Read back the variable and compare to the original */
+static void
+verify(int ncid, int line)
+{
+    int varid;
+    int x, y;
+    int result[NX][NY];
+    int sub[3][5];
+    size_t start[2] = {3,4};
+    size_t count[2] = {3,5};
+
+    CHECK(nc_inq_varid(ncid,"v",&varid));
+    memset(result,0,sizeof(result));
+    CHECK(nc_get_var_int(ncid,varid,&result[0][0]));
+    for(x=0;x<NX;x++) {
+        for(y=0;y<NY;y++) {
+	    if(result[x][y] != data[x][y]) {
+	        fprintf(stderr,"line %d: mismatch [%d][%d]: %d != %d\n",line,x,y,result[x][y],data[x][y]);
+		exit(1);
+	    }
+	}
+    }
+    /* A subset crossing shard boundaries */
+    CHECK(nc_get_vara_int(ncid,varid,start,count,&sub[0][0]));
+    for(x=0;x<3;x++) {
+        for(y=0;y<5;y++) {
+	    if(sub[x][y] != data[x+3][y+4]) {
+	        fprintf(stderr,"line %d: subset mismatch [%d][%d]: %d != %d\n",line,x,y,sub[x][y],data[x+3][y+4]);
+		exit(1);
+	    }
+	}
+    }
+}
+
+static int
+exists(const char* path)
+{
+#ifdef HAVE_UNISTD_H
+    return (access(path,F_OK) == 0);
+#else
+    FILE* f = fopen(path,"r");
+    if(f != NULL) fclose(f);
+    return (f != NULL);
+#endif
+}
+
+int
+main(int argc, char **argv)
+{
+    int ncid, varid, dimids[2];
+    size_t chunks[2] = {2,3};
+    size_t start[2] = {2,3};
+    size_t count[2] = {3,4};
+    int patch[3][4];
+    int x, y;
+
+    (void)argc; (void)argv;
+
+    for(x=0;x<NX;x++) for(y=0;y<NY;y++) data[x][y] = x*NY+y;
+
+    printf("*** Test sharded create...");
+    CHECK(nc_create(URLSHARD,NC_NETCDF4|NC_CLOBBER,&ncid));
+    CHECK(nc_def_dim(ncid,"x",NX,&dimids[0]));
+    CHECK(nc_def_dim(ncid,"y",NY,&dimids[1]));
+    CHECK(nc_def_var(ncid,"v",NC_INT,2,dimids,&varid));
+    CHECK(nc_def_var_chunking(ncid,varid,NC_CHUNKED,chunks));
+    CHECK(nc_put_var_int(ncid,varid,&data[0][0]));
+    CHECK(nc_close(ncid));
+    /* 4x4 chunks packed 2x2 per shard => shards 0..1 x 0..1 */
+    if(!exists(PATH "/v/0.0") || !exists(PATH "/v/1.1")) {fprintf(stderr,"fail: missing shard\n"); exit(1);}
+    if(exists(PATH "/v/3.3")) {fprintf(stderr,"fail: chunk stored outside of its shard\n"); exit(1);}
+    printf("passed\n");
+
+    printf("*** Test sharded read...");
+    CHECK(nc_open(URL,NC_NOWRITE,&ncid));
+    verify(ncid,__LINE__);
+    CHECK(nc_close(ncid));
+    printf("passed\n");
+
+    printf("*** Test sharded partial rewrite...");
+    CHECK(nc_open(URL,NC_WRITE,&ncid));
+    CHECK(nc_inq_varid(ncid,"v",&varid));
+    for(x=0;x<3;x++) for(y=0;y<4;y++) {
+	patch[x][y] = -(x*4+y+1);
+	data[x+2][y+3] = patch[x][y];
+    }
+    CHECK(nc_put_vara_int(ncid,varid,start,count,&patch[0][0]));
+    verify(ncid,__LINE__);
+    CHECK(nc_close(ncid));
+    CHECK(nc_open(URL,NC_NOWRITE,&ncid));
+    verify(ncid,__LINE__);
+    CHECK(nc_close(ncid));
+    printf("passed\n");
+
+    printf("*** Test sharded read with threads...");
+    CHECK(nc_open(URLTHREADS,NC_WRITE,&ncid));
+    verify(ncid,__LINE__);
+    CHECK(nc_inq_varid(ncid,"v",&varid));
+    for(x=0;x<NX;x++) for(y=0;y<NY;y++) data[x][y] += 1000;
+    CHECK(nc_put_var_int(ncid,varid,&data[0][0]));
+    CHECK(nc_close(ncid));
+    CHECK(nc_open(URLTHREADS,NC_NOWRITE,&ncid));
+    verify(ncid,__LINE__);
+    CHECK(nc_close(ncid));
+    printf("passed\n");
+
+    return 0;
+}
@@ -0,0 +1,164 @@
+/* This is part of the netCDF package.
+   Copyright 2018 University Corporation for Atmospheric Research/Unidata
+   See COPYRIGHT file for conditions of use.
+
+   Test strided writes and reads of multi-byte types stored with
+   the non-native byte order: the values must come back as written,
+   and the stored chunks must hold them byte-swapped.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "netcdf.h"
+
+#define PATH "tmp_zstrided.file"
+#define URL "file://" PATH "#mode=nczarr,file"
+
+#define NY 9
+#define NX 17
+#define CY 4
+#define CX 5
+#define NTYPES 4
+
+#define ERR(r) {fprintf(stderr,"fail: line %d: (%d) %s\n",__LINE__,(r),nc_strerror((r))); exit(1);}
+#define CHECK(expr) {int stat_ = (expr); if(stat_) ERR(stat_);}
+#define FAIL(msg) {fprintf(stderr,"fail: line %d: %s\n",__LINE__,(msg)); exit(1);}
+
+static const nc_type types[NTYPES] = {NC_SHORT, NC_INT, NC_DOUBLE, NC_INT64};
+static const char* names[NTYPES] = {"s", "i", "d", "l"};
+
+/* The expected content of every variable, as doubles */
+static double model[NY][NX];
+
+/* Convert count values of type xtype between doubles and memory */
+static void
+todata(nc_type xtype, size_t count, const double* src, void* dst)
+{
+    size_t i;
+    for(i=0;i<count;i++) {
+	switch (xtype) {
+	case NC_SHORT: ((short*)dst)[i] = (short)src[i]; break;
+	case NC_INT: ((int*)dst)[i] = (int)src[i]; break;
+	case NC_DOUBLE: ((double*)dst)[i] = src[i]; break;
+	case NC_INT64: ((long long*)dst)[i] = (long long)src[i]; break;
+	default: FAIL("type");
+	}
+    }
+}
+
+static double
+fromdata(nc_type xtype, const void* src, size_t i)
+{
+    switch (xtype) {
+    case NC_SHORT: return ((const short*)src)[i];
+    case NC_INT: return ((const int*)src)[i];
+    case NC_DOUBLE: return ((const double*)src)[i];
+    case NC_INT64: return (double)((const long long*)src)[i];
+    default: FAIL("type");
+    }
+    return 0;
+}
+
+/* Read every variable whole and with a stride, and compare against the model */
+static void
+verify(int ncid)
+{
+    int t;
+    size_t y, x, i;
+    unsigned char buf[NY*NX*8];
+    size_t start[2] = {0,1}, count[2] = {5,6};
+    ptrdiff_t stride[2] = {2,3};
+
+    for(t=0;t<NTYPES;t++) {
+	int varid;
+	CHECK(nc_inq_varid(ncid,names[t],&varid));
+	CHECK(nc_get_var(ncid,varid,buf));
+	for(y=0;y<NY;y++)
+	    for(x=0;x<NX;x++)
+		if(fromdata(types[t],buf,y*NX+x) != model[y][x]) FAIL("wrong data in whole read");
+	CHECK(nc_get_vars(ncid,varid,start,count,stride,buf));
+	for(i=0,y=0;y<count[0];y++)
+	    for(x=0;x<count[1];x++,i++)
+		if(fromdata(types[t],buf,i) != model[start[0]+y*(size_t)stride[0]][start[1]+x*(size_t)stride[1]])
+		    FAIL("wrong data in strided read");
+    }
+}
+
+/* The first value of chunk 0.0 must be stored byte-swapped */
+static void
+checkstored(int t)
+{
+    char path[1024];
+    FILE* f = NULL;
+    unsigned char stored[8], native[8];
+    size_t size = (types[t] == NC_SHORT ? 2 : types[t] == NC_INT ? 4 : 8);
+    size_t i;
+
+    snprintf(path,sizeof(path),"%s/%s/0.0",PATH,names[t]);
+    if((f = fopen(path,"rb")) == NULL) FAIL("no chunk");
+    if(fread(stored,1,size,f) != size) FAIL("short chunk");
+    fclose(f);
+    todata(types[t],1,&model[0][0],native);
+    for(i=0;i<size;i++)
+	if(stored[i] != native[size-1-i]) FAIL("chunk not stored in the requested byte order");
+}
+
+int
+main(void)
+{
+    int ncid, dimids[2], varid, t;
+    int one = 1;
+    int endian = (*(char*)&one == 1 ? NC_ENDIAN_BIG : NC_ENDIAN_LITTLE); /* not native */
+    size_t chunks[2] = {CY,CX};
+    size_t y, x, i;
+    unsigned char buf[NY*NX*8];
+    double dbuf[NY*NX];
+    size_t start[2] = {1,2}, count[2] = {4,5};
+    ptrdiff_t stride[2] = {2,3};
+
+    printf("*** Test strided access to non-native byte order...");
+    for(y=0;y<NY;y++)
+	for(x=0;x<NX;x++)
+	    model[y][x] = (double)(y*1000 + x + 1);
+
+    CHECK(nc_create(URL,NC_CLOBBER|NC_NETCDF4,&ncid));
+    CHECK(nc_def_dim(ncid,"y",NY,&dimids[0]));
+    CHECK(nc_def_dim(ncid,"x",NX,&dimids[1]));
+    for(t=0;t<NTYPES;t++) {
+	CHECK(nc_def_var(ncid,names[t],types[t],2,dimids,&varid));
+	CHECK(nc_def_var_chunking(ncid,varid,NC_CHUNKED,chunks));
+	CHECK(nc_def_var_endian(ncid,varid,endian));
+    }
+    CHECK(nc_enddef(ncid));
+    for(t=0;t<NTYPES;t++) {
+	todata(types[t],NY*NX,&model[0][0],buf);
+	CHECK(nc_put_var(ncid,t,buf));
+    }
+
+    /* Overwrite every third column of every other row, across chunks */
+    for(i=0,y=0;y<count[0];y++)
+	for(x=0;x<count[1];x++,i++) {
+	    dbuf[i] = -(double)(i+1);
+	    model[start[0]+y*(size_t)stride[0]][start[1]+x*(size_t)stride[1]] = dbuf[i];
+	}
+    for(t=0;t<NTYPES;t++) {
+	todata(types[t],count[0]*count[1],dbuf,buf);
+	CHECK(nc_put_vars(ncid,t,start,count,stride,buf));
+    }
+    verify(ncid);
+    CHECK(nc_close(ncid));
+
+    /* and again from the stored chunks */
+    for(t=0;t<NTYPES;t++)
+	checkstored(t);
+    CHECK(nc_open(URL,NC_NOWRITE,&ncid));
+    verify(ncid);
+    CHECK(nc_close(ncid));
+    printf("*** PASS\n");
+    return 0;
+}
@@ -209,6 +209,7 @@ makeurl(const char* file, NCZM_IMPL impl, struct UTOptions* options)
 	switch (impl) {
 	case NCZM_FILE:
 	case NCZM_ZIP:
+	case NCZM_MEM:
             /* Massage file to make it usable as URL path */
 	    urlpath = strdup(file);
 	    for(p=urlpath;*p;p++) {if(*p == '\\') *p = '/';}
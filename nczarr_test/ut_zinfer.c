@@ -29,8 +29,12 @@ static char *KV2nczarr[][2] = {
     {NULL, NULL},
 };
 
+#define MOCK_V3_GROUP_NCZARR                                                   \
+  "{\"zarr_format\":3, \"node_type\":\"group\", \"attributes\": "          \
+  "{\"_nczarr_superblock\": {\"version\": \"2.0.0\"}}}"
+
 static char *KV3[][2] = {
-    {"/zarr.json", ""},
+    {"/zarr.json", MOCK_V3_GROUP_NCZARR},
     {NULL, NULL},
 };
 
@@ -220,12 +224,26 @@ int test_NCZ_infer_nczarr_format() {
     return 6;
   }
 
-  // TODO:
-  // zinfo.format.zarr = 3;
-  // KV_ptr = KV3;
-  // zinfo.map = mockmap();
-  // zinfo.metadata = *NCZ_metadata_handler3;
-  // ret = NCZ_infer_nczarr_format(&file);
+  freemockmap(zinfo.map);
+
+  zinfo.format.zarr = 3;
+  KV_ptr = KV3;
+  zinfo.map = mockmap();
+  zinfo.metadata = *NCZ_metadata_handler3;
+  ret = NCZ_infer_nczarr_format(&file);
+  freemockmap(zinfo.map);
+  if (ret != NC_NOERR) {
+    fprintf(stderr, "Failed! Unexpected error (%d) for version 3\n", ret);
+    return 7;
+  }
+  if (NCZARRFORMAT2 != zinfo.format.nczarr) {
+    fprintf(stderr,
+            "Failed! Wrong nczarr version detected for version 3 "
+            "(" NCZARR_FORMAT_VERSION_TEMPLATE ") expected %d\n",
+            zinfo.format.nczarr, NCZARRFORMAT2);
+    return 8;
+  }
+  NCJreclaim(zinfo.metadata.jnodes);
 
   return 0;
 }
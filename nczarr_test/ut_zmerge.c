@@ -0,0 +1,131 @@
+/*
+ *	Copyright 2018, University Corporation for Atmospheric Research
+ *      See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ */
+
+/*
+Test NCZ_mergeslices: walking the merged chunk and memory slices must
+visit exactly the same (chunk offset, memory offset) pairs, in the same
+order, as walking the slices they were merged from.
+*/
+
+#include "ut_includes.h"
+
+#define NCASES 2000
+#define MAXRANK 4
+#define MAXLEN 6
+#define MAXPAIRS 200000
+
+static size64_t pairs[2][MAXPAIRS][2];
+
+/* Walk the slices in lockstep the way NCZ_transfer does */
+static size_t
+walk(int rank, const NCZSlice* slpslices, const NCZSlice* memslices, size64_t (*out)[2])
+{
+    size_t n = 0;
+    NCZOdometer* slpodom = nczodom_fromslices(rank,slpslices);
+    NCZOdometer* memodom = nczodom_fromslices(rank,memslices);
+    for(;nczodom_more(slpodom);nczodom_next(slpodom),nczodom_next(memodom)) {
+	if(!nczodom_more(memodom)) {n = MAXPAIRS+1; break;} /* slices of different shape */
+	if(n == MAXPAIRS) {n = MAXPAIRS+1; break;}
+	out[n][0] = nczodom_offset(slpodom);
+	out[n][1] = nczodom_offset(memodom);
+	n++;
+    }
+    if(nczodom_more(memodom)) n = MAXPAIRS+1;
+    nczodom_free(slpodom);
+    nczodom_free(memodom);
+    return n;
+}
+
+/* A slice of count elements in a dimension of length len */
+static void
+makeslice(NCZSlice* slice, size64_t count, size64_t len, int full)
+{
+    size64_t stride, start;
+    if(full) {
+	slice->start = 0; slice->stride = 1; slice->stop = len; slice->len = len;
+	return;
+    }
+    stride = 1 + (size64_t)(rand() % 3);
+    while(stride > 1 && (count-1)*stride >= len) stride--;
+    start = (size64_t)rand() % (len - (count-1)*stride);
+    slice->start = start;
+    slice->stride = stride;
+    slice->stop = start + (count-1)*stride + 1;
+    slice->len = len;
+}
+
+static int
+testcase(int rank, const NCZSlice* slpslices, const NCZSlice* memslices)
+{
+    NCZSlice slpmerged[MAXRANK], memmerged[MAXRANK];
+    int merged;
+    size_t n0, n1;
+
+    memcpy(slpmerged,slpslices,sizeof(NCZSlice)*(size_t)rank);
+    memcpy(memmerged,memslices,sizeof(NCZSlice)*(size_t)rank);
+    merged = NCZ_mergeslices(rank,slpmerged,memmerged);
+    if(merged < 1 || merged > rank) {fprintf(stderr,"Failed! rank %d merged to %d\n",rank,merged); return 1;}
+    n0 = walk(rank,slpslices,memslices,pairs[0]);
+    n1 = walk(merged,slpmerged,memmerged,pairs[1]);
+    if(n0 > MAXPAIRS) {fprintf(stderr,"Failed! bad test case\n"); return 1;}
+    if(n1 != n0) {fprintf(stderr,"Failed! merged walk has %zu values, expected %zu\n",n1,n0); return 1;}
+    if(memcmp(pairs[0],pairs[1],sizeof(pairs[0][0])*n0) != 0)
+	{fprintf(stderr,"Failed! merged walk visits different values\n"); return 1;}
+    return 0;
+}
+
+int
+main(int argc, char** argv)
+{
+    int i, r, rank, merged;
+    NCZSlice slp[MAXRANK], mem[MAXRANK];
+
+    fprintf(stderr,"Testing NCZ_mergeslices\n");
+
+    /* A slab covering whole lat/lon chunk extents is one run per chunk */
+    slp[0].start = 1; slp[0].stride = 1; slp[0].stop = 3; slp[0].len = 4;
+    mem[0].start = 5; mem[0].stride = 1; mem[0].stop = 7; mem[0].len = 9;
+    makeslice(&slp[1],5,5,1); makeslice(&mem[1],5,5,1);
+    makeslice(&slp[2],6,6,1); makeslice(&mem[2],6,6,1);
+    if(testcase(3,slp,mem)) return 1;
+    if((merged = NCZ_mergeslices(3,slp,mem)) != 1 || slp[0].len != 4*5*6 || mem[0].len != 9*5*6)
+	{fprintf(stderr,"Failed! whole trailing dimensions were not merged\n"); return 1;}
+
+    /* A strided trailing dimension stops the merge */
+    makeslice(&slp[0],2,4,1); makeslice(&mem[0],2,4,1);
+    slp[1].start = 0; slp[1].stride = 2; slp[1].stop = 5; slp[1].len = 6; mem[1] = slp[1];
+    if((merged = NCZ_mergeslices(2,slp,mem)) != 2)
+	{fprintf(stderr,"Failed! strided dimension was merged\n"); return 1;}
+
+    srand(17);
+    for(i=0;i<NCASES;i++) {
+	rank = 1 + rand() % MAXRANK;
+	for(r=0;r<rank;r++) {
+	    size64_t slplen = 1 + (size64_t)(rand() % MAXLEN);
+	    size64_t memlen = slplen + (size64_t)(rand() % 3);
+	    size64_t count = 1 + (size64_t)rand() % slplen;
+	    /* Mostly whole dimensions, so that there is something to merge */
+	    int full = (rand() % 3 != 0);
+	    makeslice(&slp[r],(full ? slplen : count),slplen,full);
+	    makeslice(&mem[r],(full ? slplen : count),(full ? slplen : memlen),full);
+	    /* Sometimes a whole chunk dimension lands in a wider memory row */
+	    if(!full && rand() % 4 == 0) {
+		makeslice(&slp[r],slplen,slplen,1);
+		makeslice(&mem[r],slplen,memlen,0);
+		mem[r].stride = 1;
+		mem[r].stop = mem[r].start + slplen;
+	    }
+	}
+	if(testcase(rank,slp,mem)) {
+	    for(r=0;r<rank;r++)
+		fprintf(stderr,"\t[%d] slp=%llu:%llu:%llu|%llu mem=%llu:%llu:%llu|%llu\n",r,
+			slp[r].start,slp[r].stop,slp[r].stride,slp[r].len,
+			mem[r].start,mem[r].stop,mem[r].stride,mem[r].len);
+	    return 1;
+	}
+    }
+    fprintf(stderr,"*** PASS\n");
+    return 0;
+}
@@ -0,0 +1,250 @@
+/*
+ *	Copyright 2018, University Corporation for Atmospheric Research
+ *      See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ */
+
+/*
+Test that chunk reads overlap when the file has a worker pool:
+the map of an open dataset is replaced by a mock that passes every
+operation through to the real map, but holds each chunk read until
+a second one is in flight (or a timeout passes). The mock claims the
+format of the S3 map when that is built, so this also checks that
+S3 reads are allowed to run concurrently.
+*/
+
+#include "ut_includes.h"
+
+#if defined(HAVE_PTHREAD_H) && !defined(_WIN32)
+#define USEPTHREADS
+#include <pthread.h>
+#include <sys/time.h>
+#endif
+
+#ifdef USEPTHREADS
+
+#define URL "file://tmp_zoverlap.zarr#mode=nczarr,mem"
+#define NX 32
+#define CX 4
+#define TIMEOUT 2 /* seconds a chunk read waits for company */
+#define NCZM_MOCK_V1 1
+
+typedef struct Mock {
+    NCZMAP map;
+    NCZMAP* real;
+} Mock;
+
+static struct Gate {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    int inflight;
+    int maxinflight;
+    int serial; /* a read timed out; stop waiting */
+} gate;
+
+/* Chunk keys end in a segment beginning with a digit */
+static int
+ischunk(const char* key)
+{
+    const char* p = strrchr(key,'/');
+    p = (p == NULL ? key : p+1);
+    return (*p >= '0' && *p <= '9');
+}
+
+static void
+enter(const char* key)
+{
+    struct timeval now;
+    struct timespec deadline;
+
+    if(!ischunk(key)) return;
+    gettimeofday(&now,NULL);
+    deadline.tv_sec = now.tv_sec + TIMEOUT;
+    deadline.tv_nsec = now.tv_usec * 1000;
+    pthread_mutex_lock(&gate.lock);
+    gate.inflight++;
+    if(gate.inflight > gate.maxinflight) gate.maxinflight = gate.inflight;
+    pthread_cond_broadcast(&gate.cond);
+    while(gate.maxinflight < 2 && !gate.serial) {
+        if(pthread_cond_timedwait(&gate.cond,&gate.lock,&deadline) != 0)
+            gate.serial = 1;
+    }
+    pthread_mutex_unlock(&gate.lock);
+}
+
+static void
+leave(const char* key)
+{
+    if(!ischunk(key)) return;
+    pthread_mutex_lock(&gate.lock);
+    gate.inflight--;
+    pthread_mutex_unlock(&gate.lock);
+}
+
+#define REAL(map) (((Mock*)(map))->real)
+
+static int
+mockclose(NCZMAP* map, int deleteit)
+{
+    return nczmap_close(REAL(map),deleteit);
+}
+
+static int
+mockexists(NCZMAP* map, const char* key)
+{
+    return nczmap_exists(REAL(map),key);
+}
+
+static int
+mocklen(NCZMAP* map, const char* key, size64_t* sizep)
+{
+    return nczmap_len(REAL(map),key,sizep);
+}
+
+static int
+mockread(NCZMAP* map, const char* key, size64_t start, size64_t count, void* content)
+{
+    int stat;
+    enter(key);
+    stat = nczmap_read(REAL(map),key,start,count,content);
+    leave(key);
+    return stat;
+}
+
+static int
+mockwrite(NCZMAP* map, const char* key, size64_t count, const void* content)
+{
+    return nczmap_write(REAL(map),key,count,content);
+}
+
+static int
+mocksearch(NCZMAP* map, const char* prefix, NClist* matches)
+{
+    return nczmap_search(REAL(map),prefix,matches);
+}
+
+static int
+mockreadobject(NCZMAP* map, const char* key, size64_t* sizep, void** contentp)
+{
+    int stat;
+    enter(key);
+    stat = nczmap_readobject(REAL(map),key,sizep,contentp);
+    leave(key);
+    return stat;
+}
+
+static NCZMAP_API mockapi = {
+    NCZM_MOCK_V1,
+    mockclose,
+    mockexists,
+    mocklen,
+    mockread,
+    mockwrite,
+    mocksearch,
+    mockreadobject,
+    NULL, /* mapobject */
+    NULL, /* unmapobject */
+    NULL, /* flush */
+    NULL, /* listall */
+};
+
+#define FAIL(msg) do {fprintf(stderr,"Failed! %s\n",msg); return 1;} while(0)
+#define CHECK(expr) do {int stat_ = (expr); if(stat_) {fprintf(stderr,"Failed! line %d: %s\n",__LINE__,nc_strerror(stat_)); return 1;}} while(0)
+
+static int
+create(void)
+{
+    int ncid, dimid, varid, x;
+    size_t chunks[1] = {CX};
+    int data[NX];
+
+    for(x=0;x<NX;x++) data[x] = x;
+    CHECK(nc_create(URL,NC_NETCDF4|NC_CLOBBER,&ncid));
+    CHECK(nc_def_dim(ncid,"x",NX,&dimid));
+    CHECK(nc_def_var(ncid,"v",NC_INT,1,&dimid,&varid));
+    CHECK(nc_def_var_chunking(ncid,varid,NC_CHUNKED,chunks));
+    CHECK(nc_enddef(ncid));
+    CHECK(nc_put_var_int(ncid,varid,data));
+    CHECK(nc_close(ncid));
+    return 0;
+}
+
+/* Read the whole variable through the mock; return the most reads in flight */
+static int
+readall(const char* url, NCZM_IMPL format, int* maxinflightp)
+{
+    int ncid, varid, x, stat;
+    int data[NX];
+    NC_GRP_INFO_T* grp = NULL;
+    NC_FILE_INFO_T* file = NULL;
+    NCZ_FILE_INFO_T* zfile = NULL;
+    Mock mock;
+
+    CHECK(nc_open(url,NC_NOWRITE,&ncid));
+    CHECK(nc_inq_varid(ncid,"v",&varid));
+    CHECK(nc4_find_grp_h5(ncid,&grp,&file));
+    zfile = (NCZ_FILE_INFO_T*)file->format_file_info;
+    memset(&mock,0,sizeof(mock));
+    mock.map = *zfile->map;
+    mock.map.format = format;
+    mock.map.api = &mockapi;
+    mock.real = zfile->map;
+    pthread_mutex_lock(&gate.lock);
+    gate.inflight = 0;
+    gate.maxinflight = 0;
+    gate.serial = 0;
+    pthread_mutex_unlock(&gate.lock);
+
+    zfile->map = &mock.map;
+    memset(data,0,sizeof(data));
+    stat = nc_get_var_int(ncid,varid,data);
+    zfile->map = mock.real;
+    CHECK(stat);
+    CHECK(nc_close(ncid));
+    for(x=0;x<NX;x++)
+        if(data[x] != x) FAIL("wrong data");
+    *maxinflightp = gate.maxinflight;
+    return 0;
+}
+
+static int
+test_overlap(const char* what, NCZM_IMPL format)
+{
+    int maxinflight = 0;
+
+    fprintf(stderr,"Testing overlapped reads as %s\n",what);
+    if(nczmap_features(format) & NCZM_NOCONCURRENCY) FAIL("map does not allow concurrent reads");
+    if(readall(URL "&nthreads=4",format,&maxinflight)) return 1;
+    if(maxinflight < 2) FAIL("chunk reads did not overlap");
+    /* One worker reads one chunk at a time */
+    if(readall(URL "&nthreads=1",format,&maxinflight)) return 1;
+    if(maxinflight != 1) FAIL("chunk reads overlapped without a pool");
+    return 0;
+}
+
+int
+main(int argc, char** argv)
+{
+    int stat = 0;
+    NC_UNUSED(argc);
+    NC_UNUSED(argv);
+    pthread_mutex_init(&gate.lock,NULL);
+    pthread_cond_init(&gate.cond,NULL);
+    if(!stat) stat = create();
+    if(!stat) stat = test_overlap("mem",NCZM_MEM);
+#ifdef NETCDF_ENABLE_S3
+    if(!stat) stat = test_overlap("s3",NCZM_S3);
+#endif
+    if(!stat) fprintf(stderr,"*** PASS\n");
+    return stat;
+}
+
+#else /*!USEPTHREADS*/
+
+int
+main(int argc, char** argv)
+{
+    fprintf(stderr,"*** SKIP: no threads\n");
+    return 0;
+}
+
+#endif /*USEPTHREADS*/
@@ -0,0 +1,310 @@
+/*
+ *	Copyright 2018, University Corporation for Atmospheric Research
+ *      See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ */
+
+/* Test the deferred write queue (zqueue.c) against an in-memory store */
+
+#include "ut_includes.h"
+#include "zqueue.h"
+
+#if defined(HAVE_PTHREAD_H) && !defined(_WIN32)
+#define USEPTHREADS
+#include <pthread.h>
+#endif
+
+#ifdef USEPTHREADS
+
+#define MAXKEYS 8
+
+typedef struct Store {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    int gate; /* writes block while the gate is closed */
+    int inflight; /* writes blocked at the gate */
+    int nctxs; /* contexts created */
+    int nfreed; /* contexts reclaimed */
+    size_t nkeys;
+    struct Object {
+        char* key;
+        char* content;
+        size64_t count;
+        int nwrites;
+    } objects[MAXKEYS];
+} Store;
+
+static Store store;
+
+static struct Object*
+lookup(const char* key)
+{
+    size_t i;
+    for(i=0;i<store.nkeys;i++)
+        if(strcmp(store.objects[i].key,key)==0) return &store.objects[i];
+    return NULL;
+}
+
+static int
+mocknewctx(void* state, void** ctxp)
+{
+    pthread_mutex_lock(&store.lock);
+    store.nctxs++;
+    pthread_mutex_unlock(&store.lock);
+    NC_UNUSED(state);
+    *ctxp = &store;
+    return NC_NOERR;
+}
+
+static void
+mockfreectx(void* state, void* ctx)
+{
+    NC_UNUSED(state);
+    NC_UNUSED(ctx);
+    pthread_mutex_lock(&store.lock);
+    store.nfreed++;
+    pthread_mutex_unlock(&store.lock);
+}
+
+/* Keys beginning with 'x' fail; x1 slowly */
+static int
+mockwrite(void* state, void* ctx, const char* key, size64_t count, const void* content)
+{
+    struct Object* o = NULL;
+
+    NC_UNUSED(state);
+    NC_UNUSED(ctx);
+    if(strcmp(key,"x1")==0) {usleep(100000); return NC_EACCESS;}
+    if(strcmp(key,"x2")==0) return NC_EPERM;
+    pthread_mutex_lock(&store.lock);
+    store.inflight++;
+    pthread_cond_broadcast(&store.cond);
+    while(store.gate)
+        pthread_cond_wait(&store.cond,&store.lock);
+    store.inflight--;
+    if((o = lookup(key)) == NULL) {
+        o = &store.objects[store.nkeys++];
+        o->key = strdup(key);
+    }
+    nullfree(o->content);
+    o->content = (char*)malloc(count);
+    memcpy(o->content,content,count);
+    o->count = count;
+    o->nwrites++;
+    pthread_mutex_unlock(&store.lock);
+    return NC_NOERR;
+}
+
+static const NCZqueueops mockops = {mocknewctx, mockfreectx, mockwrite};
+
+static void
+resetstore(void)
+{
+    size_t i;
+    for(i=0;i<store.nkeys;i++) {
+        nullfree(store.objects[i].key);
+        nullfree(store.objects[i].content);
+    }
+    memset(store.objects,0,sizeof(store.objects));
+    store.nkeys = 0;
+    store.gate = 0;
+    store.inflight = 0;
+    store.nctxs = 0;
+    store.nfreed = 0;
+}
+
+static void
+setgate(int closed)
+{
+    pthread_mutex_lock(&store.lock);
+    store.gate = closed;
+    pthread_cond_broadcast(&store.cond);
+    pthread_mutex_unlock(&store.lock);
+}
+
+/* Wait until n writes are blocked at the gate */
+static void
+awaitinflight(int n)
+{
+    pthread_mutex_lock(&store.lock);
+    while(store.inflight < n)
+        pthread_cond_wait(&store.cond,&store.lock);
+    pthread_mutex_unlock(&store.lock);
+}
+
+static int
+put(NCZqueue* q, const char* key, char c, size64_t count)
+{
+    char* content = (char*)malloc(count);
+    memset(content,c,count);
+    return NCZ_queuewrite(q,strdup(key),count,content);
+}
+
+/* Check that key was last written with count copies of c */
+static int
+check(const char* key, char c, size64_t count)
+{
+    struct Object* o = lookup(key);
+    size64_t i;
+    if(o == NULL || o->count != count) return 0;
+    for(i=0;i<count;i++)
+        if(o->content[i] != c) return 0;
+    return 1;
+}
+
+struct Writer {
+    NCZqueue* q;
+    const char* key;
+    char c;
+    size64_t count;
+    int stat;
+    int done;
+};
+
+static void*
+writer(void* arg)
+{
+    struct Writer* w = (struct Writer*)arg;
+    w->stat = put(w->q,w->key,w->c,w->count);
+    pthread_mutex_lock(&store.lock);
+    w->done = 1;
+    pthread_mutex_unlock(&store.lock);
+    return NULL;
+}
+
+static int
+isdone(struct Writer* w)
+{
+    int done;
+    pthread_mutex_lock(&store.lock);
+    done = w->done;
+    pthread_mutex_unlock(&store.lock);
+    return done;
+}
+
+#define FAIL(msg) do {fprintf(stderr,"Failed! %s\n",msg); return 1;} while(0)
+
+static int
+test_sync(void)
+{
+    NCZqueue* q = NULL;
+    fprintf(stderr,"Testing synchronous fallback\n");
+    if(NCZ_queuenew(1,100,&mockops,NULL,&q) || q != NULL) FAIL("one worker should mean no queue");
+    if(NCZ_queueflush(NULL)) FAIL("flush of no queue");
+    NCZ_queuewait(NULL,"a");
+    NCZ_queuefree(NULL);
+    return 0;
+}
+
+static int
+test_merge(void)
+{
+    NCZqueue* q = NULL;
+    fprintf(stderr,"Testing merge of queued writes\n");
+    resetstore();
+    if(NCZ_queuenew(2,1000,&mockops,NULL,&q)) FAIL("queuenew");
+    setgate(1);
+    if(put(q,"b",'b',10) || put(q,"c",'c',10)) FAIL("write");
+    awaitinflight(2); /* both workers are busy */
+    if(put(q,"a",'1',10) || put(q,"a",'2',20) || put(q,"a",'3',5)) FAIL("write");
+    setgate(0);
+    NCZ_queuewait(q,"a");
+    if(!check("a",'3',5)) FAIL("a does not hold the last write");
+    if(lookup("a")->nwrites != 1) FAIL("queued writes of a were not merged");
+    /* A write of a key in flight waits for it, so writes complete in order */
+    if(NCZ_queueflush(q)) FAIL("flush");
+    setgate(1);
+    if(put(q,"b",'4',10)) FAIL("write");
+    awaitinflight(1);
+    setgate(0);
+    if(put(q,"b",'5',10)) FAIL("write");
+    if(NCZ_queueflush(q)) FAIL("flush");
+    if(!check("b",'5',10) || !check("c",'c',10)) FAIL("wrong content after flush");
+    if(lookup("b")->nwrites != 3) FAIL("b written out of order");
+    NCZ_queuefree(q);
+    if(store.nctxs > 2 || store.nfreed != store.nctxs) FAIL("contexts leaked");
+    return 0;
+}
+
+static int
+test_backpressure(void)
+{
+    NCZqueue* q = NULL;
+    pthread_t t;
+    struct Writer w = {NULL,"a",'2',30,0,0};
+
+    fprintf(stderr,"Testing the bound on queued bytes\n");
+    resetstore();
+    if(NCZ_queuenew(2,100,&mockops,NULL,&q)) FAIL("queuenew");
+    setgate(1);
+    if(put(q,"b",'b',40) || put(q,"c",'c',40)) FAIL("write");
+    awaitinflight(2);
+    if(put(q,"a",'1',10)) FAIL("write"); /* queued: 90 bytes held */
+    /* Merging 30 bytes into a would hold 110 */
+    w.q = q;
+    if(pthread_create(&t,NULL,writer,&w)) FAIL("pthread_create");
+    usleep(200000);
+    if(isdone(&w)) FAIL("merge did not wait for room");
+    setgate(0);
+    pthread_join(t,NULL);
+    if(w.stat) FAIL("write");
+    if(NCZ_queueflush(q)) FAIL("flush");
+    if(!check("a",'2',30)) FAIL("a does not hold the last write");
+    /* The same for a write of a new key */
+    setgate(1);
+    if(put(q,"b",'b',60) || put(q,"c",'c',30)) FAIL("write");
+    awaitinflight(2);
+    w.key = "d"; w.done = 0;
+    if(pthread_create(&t,NULL,writer,&w)) FAIL("pthread_create");
+    usleep(200000);
+    if(isdone(&w)) FAIL("write did not wait for room");
+    setgate(0);
+    pthread_join(t,NULL);
+    if(w.stat) FAIL("write");
+    /* Free without a flush still completes every write */
+    NCZ_queuefree(q);
+    if(!check("d",'2',30)) FAIL("close did not complete the writes");
+    return 0;
+}
+
+static int
+test_errors(void)
+{
+    NCZqueue* q = NULL;
+    fprintf(stderr,"Testing error reporting\n");
+    resetstore();
+    if(NCZ_queuenew(2,1000,&mockops,NULL,&q)) FAIL("queuenew");
+    /* x2 fails first, but x1 was written first */
+    if(put(q,"x1",'x',10) || put(q,"x2",'x',10) || put(q,"a",'a',10)) FAIL("write");
+    if(NCZ_queueflush(q) != NC_EACCESS) FAIL("flush did not report the earliest error");
+    if(!check("a",'a',10)) FAIL("a was not written");
+    if(put(q,"a",'b',10)) FAIL("write");
+    if(NCZ_queueflush(q) != NC_EACCESS) FAIL("error was not sticky");
+    NCZ_queuefree(q);
+    return 0;
+}
+
+int
+main(int argc, char** argv)
+{
+    int stat = 0;
+    pthread_mutex_init(&store.lock,NULL);
+    pthread_cond_init(&store.cond,NULL);
+    if(!stat) stat = test_sync();
+    if(!stat) stat = test_merge();
+    if(!stat) stat = test_backpressure();
+    if(!stat) stat = test_errors();
+    resetstore();
+    if(!stat) fprintf(stderr,"*** PASS\n");
+    return stat;
+}
+
+#else /*!USEPTHREADS*/
+
+int
+main(int argc, char** argv)
+{
+    fprintf(stderr,"*** SKIP: no threads\n");
+    return 0;
+}
+
+#endif /*USEPTHREADS*/
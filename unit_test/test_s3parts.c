@@ -0,0 +1,99 @@
+/*********************************************************************
+ *   Copyright 2018, UCAR/Unidata
+ *   See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ *********************************************************************/
+
+/**
+Test the division of an object into the parts of an S3 multipart upload
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "netcdf.h"
+#include "ncuri.h"
+#include "ncs3sdk.h"
+
+#define MiB (1024ULL*1024ULL)
+#define GiB (1024ULL*MiB)
+#define TiB (1024ULL*GiB)
+
+typedef struct Test {
+    unsigned long long count;
+    unsigned long long partsize; /* requested */
+    int stat;
+    unsigned long long expectedsize;
+    size_t expectedparts;
+} Test;
+
+static Test TESTS[] = {
+/* parts of the requested size */
+{64*MiB, 16*MiB, NC_NOERR, 16*MiB, 4},
+{64*MiB+1, 16*MiB, NC_NOERR, 16*MiB, 5},
+{64*MiB-1, 16*MiB, NC_NOERR, 16*MiB, 4},
+/* raised to the 5 MiB minimum */
+{12*MiB, 1*MiB, NC_NOERR, 5*MiB, 3},
+{12*MiB, 0, NC_NOERR, 5*MiB, 3},
+/* lowered to the 5 GiB maximum */
+{12*GiB, 8*GiB, NC_NOERR, 5*GiB, 3},
+/* at the limit of 10000 parts */
+{10000*5*MiB, 5*MiB, NC_NOERR, 5*MiB, 10000},
+{10000*5*MiB+1, 5*MiB, NC_NOERR, 5*MiB+1, 10000},
+{1*TiB, 16*MiB, NC_NOERR, 109951163ULL, 10000},
+{5*TiB, 5*GiB, NC_NOERR, 5*GiB, 1024},
+{10000*5*GiB, 5*MiB, NC_NOERR, 5*GiB, 10000},
+/* too large for 10000 parts of at most 5 GiB */
+{10000*5*GiB+1, 5*MiB, NC_EINVAL, 0, 0},
+{0, 0, 0, 0, 0}
+};
+
+/* Every part but the last has the same size, within the S3 limits */
+static int
+valid(unsigned long long count, unsigned long long partsize, size_t nparts)
+{
+    if(partsize < NCS3MINPARTSIZE || partsize > NCS3MAXPARTSIZE) return 0;
+    if(nparts == 0 || nparts > NCS3MAXPARTS) return 0;
+    if((unsigned long long)(nparts-1) * partsize >= count) return 0; /* last part is empty */
+    if((unsigned long long)nparts * partsize < count) return 0; /* content not covered */
+    return 1;
+}
+
+int
+main(int argc, char** argv)
+{
+    int failcount = 0;
+    Test* test;
+    unsigned long long partsize;
+    size_t nparts;
+    int stat, i;
+
+    for(test=TESTS;test->count;test++) {
+	partsize = 0; nparts = 0;
+	stat = NC_s3multipartsplit(test->count,test->partsize,&partsize,&nparts);
+	if(stat != test->stat
+	   || (stat == NC_NOERR && (partsize != test->expectedsize || nparts != test->expectedparts
+	                            || !valid(test->count,partsize,nparts)))) {
+	    fprintf(stderr,"*** Fail: count=%llu partsize=%llu: stat=%d partsize=%llu nparts=%zu; expected stat=%d partsize=%llu nparts=%zu\n",
+		test->count,test->partsize,stat,partsize,nparts,
+		test->stat,test->expectedsize,test->expectedparts);
+	    failcount++;
+	}
+    }
+
+    /* Objects of every size up to the largest that fits */
+    srand(31);
+    for(i=0;i<100000;i++) {
+	unsigned long long count = 1 + ((((unsigned long long)rand() << 31) ^ (unsigned long long)rand()) % (NCS3MAXPARTS*NCS3MAXPARTSIZE));
+	unsigned long long request = ((unsigned long long)rand() % 4) * (unsigned long long)rand() * 4096;
+	if((stat = NC_s3multipartsplit(count,request,&partsize,&nparts))
+	   || !valid(count,partsize,nparts)) {
+	    fprintf(stderr,"*** Fail: count=%llu partsize=%llu: stat=%d partsize=%llu nparts=%zu\n",
+		count,request,stat,partsize,nparts);
+	    failcount++;
+	    break;
+	}
+    }
+
+    fprintf(stderr,"%s test_s3parts\n",failcount > 0 ? "***FAIL":"***PASS");
+    return (failcount > 0 ? 1 : 0);
+}
@@ -0,0 +1,210 @@
+/*********************************************************************
+ *   Copyright 2018, UCAR/Unidata
+ *   See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ *********************************************************************/
+
+/**
+Test the reuse of connections by the internal S3 client: request
+handles opened one after the other on the same endpoint must share
+one connection, and concurrent handles must each keep theirs for
+later handles. The endpoint is a minimal HTTP server on the loopback
+interface, run by this program, that counts the connections it
+accepts.
+*/
+
+#include "config.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include "netcdf.h"
+#include "ncuri.h"
+#include "ncs3sdk.h"
+#include "nch5s3comms.h"
+
+#define CONTENT "abcd"
+#define MAXCONNS 16
+#define NOPENS 20
+
+static struct Server {
+    int listener;
+    int port;
+    pthread_mutex_t lock;
+    int naccepted;
+} server;
+
+static int
+accepted(void)
+{
+    int n;
+    pthread_mutex_lock(&server.lock);
+    n = server.naccepted;
+    pthread_mutex_unlock(&server.lock);
+    return n;
+}
+
+/* Answer every complete request in buf; return the no. of bytes used */
+static size_t
+respond(int fd, const char* buf, size_t len)
+{
+    size_t used = 0;
+    char reply[256];
+
+    for(;;) {
+	const char* start = buf + used;
+	const char* end = NULL;
+	size_t i;
+	for(i=0;i+3<len-used;i++) {
+	    if(memcmp(start+i,"\r\n\r\n",4)==0) {end = start+i+4; break;}
+	}
+	if(end == NULL) break;
+	snprintf(reply,sizeof(reply),"HTTP/1.1 200 OK\r\nContent-Length: %d\r\nContent-Type: binary/octet-stream\r\n\r\n%s",
+		 (int)strlen(CONTENT),(strncmp(start,"HEAD ",5)==0 ? "" : CONTENT));
+	if(write(fd,reply,strlen(reply)) < 0) break;
+	used = (size_t)(end - buf);
+    }
+    return used;
+}
+
+static void*
+serve(void* arg)
+{
+    struct pollfd fds[1+MAXCONNS];
+    char bufs[MAXCONNS][4096];
+    size_t lens[MAXCONNS];
+    int nfds = 1, i;
+
+    (void)arg;
+    fds[0].fd = server.listener;
+    fds[0].events = POLLIN;
+    for(;;) {
+	if(poll(fds,(nfds_t)nfds,-1) < 0) break;
+	if(fds[0].revents & (POLLHUP|POLLERR|POLLNVAL)) break; /* listener shut down */
+	if(fds[0].revents & POLLIN) {
+	    int fd = accept(server.listener,NULL,NULL);
+	    if(fd < 0) break; /* listener closed */
+	    if(nfds == 1+MAXCONNS) {close(fd); continue;}
+	    fds[nfds].fd = fd;
+	    fds[nfds].events = POLLIN;
+	    fds[nfds].revents = 0;
+	    lens[nfds-1] = 0;
+	    nfds++;
+	    pthread_mutex_lock(&server.lock);
+	    server.naccepted++;
+	    pthread_mutex_unlock(&server.lock);
+	}
+	for(i=1;i<nfds;i++) {
+	    ssize_t n;
+	    size_t used;
+	    if(!(fds[i].revents & (POLLIN|POLLHUP|POLLERR))) continue;
+	    n = read(fds[i].fd,bufs[i-1]+lens[i-1],sizeof(bufs[i-1])-lens[i-1]);
+	    if(n <= 0) {
+		/* Closed by the client */
+		close(fds[i].fd);
+		fds[i] = fds[nfds-1];
+		memcpy(bufs[i-1],bufs[nfds-2],lens[nfds-2]);
+		lens[i-1] = lens[nfds-2];
+		nfds--;
+		i--;
+		continue;
+	    }
+	    lens[i-1] += (size_t)n;
+	    used = respond(fds[i].fd,bufs[i-1],lens[i-1]);
+	    memmove(bufs[i-1],bufs[i-1]+used,lens[i-1]-used);
+	    lens[i-1] -= used;
+	}
+    }
+    for(i=1;i<nfds;i++) close(fds[i].fd);
+    return NULL;
+}
+
+static int
+startserver(pthread_t* thread)
+{
+    struct sockaddr_in addr;
+    socklen_t addrlen = sizeof(addr);
+
+    pthread_mutex_init(&server.lock,NULL);
+    if((server.listener = socket(AF_INET,SOCK_STREAM,0)) < 0) return 0;
+    memset(&addr,0,sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = 0;
+    if(bind(server.listener,(struct sockaddr*)&addr,sizeof(addr)) < 0) return 0;
+    if(listen(server.listener,MAXCONNS) < 0) return 0;
+    if(getsockname(server.listener,(struct sockaddr*)&addr,&addrlen) < 0) return 0;
+    server.port = ntohs(addr.sin_port);
+    if(pthread_create(thread,NULL,serve,NULL)) return 0;
+    return 1;
+}
+
+/* Fetch the object through handle and check the reply */
+static int
+fetch(s3r_t* handle, const char* url)
+{
+    s3r_buf_t data = {0,NULL};
+    long httpcode = 0;
+    int ok;
+
+    if(NCH5_s3comms_s3r_head(handle,url,NULL,NULL,&httpcode,NULL) || httpcode != 200) return 0;
+    if(NCH5_s3comms_s3r_getobject(handle,url,&data,&httpcode) || httpcode != 200) return 0;
+    ok = (data.count == strlen(CONTENT) && memcmp(data.content,CONTENT,data.count)==0);
+    free(data.content);
+    return ok;
+}
+
+#define FAIL(msg) {fprintf(stderr,"fail: line %d: %s\n",__LINE__,(msg)); exit(1);}
+
+int
+main(int argc, char** argv)
+{
+    pthread_t thread;
+    char root[64];
+    char url[128];
+    s3r_t* a = NULL;
+    s3r_t* b = NULL;
+    int i;
+
+    (void)argc; (void)argv;
+    if(!startserver(&thread)) FAIL("cannot start the server");
+    snprintf(root,sizeof(root),"http://127.0.0.1:%d",server.port);
+    snprintf(url,sizeof(url),"%s/bucket/key",root);
+
+    printf("*** Test one connection for handles opened in turn...");
+    for(i=0;i<NOPENS;i++) {
+	if((a = NCH5_s3comms_s3r_open(root,NCS3,NULL,NULL,NULL)) == NULL) FAIL("open");
+	if(!fetch(a,url)) FAIL("fetch");
+	if(NCH5_s3comms_s3r_close(a)) FAIL("close");
+    }
+    if(accepted() != 1) {fprintf(stderr,"%d connections\n",accepted()); FAIL("connection not reused");}
+    printf("passed\n");
+
+    printf("*** Test one connection per concurrent handle...");
+    for(i=0;i<NOPENS;i++) {
+	if((a = NCH5_s3comms_s3r_open(root,NCS3,NULL,NULL,NULL)) == NULL) FAIL("open");
+	if((b = NCH5_s3comms_s3r_open(root,NCS3,NULL,NULL,NULL)) == NULL) FAIL("open");
+	if(!fetch(a,url) || !fetch(b,url)) FAIL("fetch");
+	if(NCH5_s3comms_s3r_close(a) || NCH5_s3comms_s3r_close(b)) FAIL("close");
+    }
+    if(accepted() != 2) {fprintf(stderr,"%d connections\n",accepted()); FAIL("connections not reused");}
+    printf("passed\n");
+
+    printf("*** Test that finalize closes the idle connections...");
+    (void)NCH5_s3comms_finalize();
+    if((a = NCH5_s3comms_s3r_open(root,NCS3,NULL,NULL,NULL)) == NULL) FAIL("open");
+    if(!fetch(a,url)) FAIL("fetch");
+    if(NCH5_s3comms_s3r_close(a)) FAIL("close");
+    if(accepted() != 3) {fprintf(stderr,"%d connections\n",accepted()); FAIL("idle connection survived finalize");}
+    (void)NCH5_s3comms_finalize();
+    printf("passed\n");
+
+    shutdown(server.listener,SHUT_RDWR);
+    close(server.listener);
+    pthread_join(thread,NULL);
+    return 0;
+}
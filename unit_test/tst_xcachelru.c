@@ -0,0 +1,134 @@
+/*********************************************************************
+ *   Copyright 2018, UCAR/Unidata
+ *   See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ *********************************************************************/
+
+/**
+Measure the per-operation cost of using NCxcache as an LRU cache
+in the way the NCZarr chunk cache uses it: entries carry their own
+list node, are keyed by a vector of chunk indices, and a miss evicts
+the least recently used entry. The average cost of hit, promote,
+and evict should stay flat as the number of entries grows.
+*/
+
+#include "config.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "netcdf.h"
+#include "ncexhash.h"
+#include "ncxcache.h"
+
+#include "timer_utils.h"
+
+#ifdef _WIN32
+#define srandom srand
+#define random (long)rand
+#endif
+
+#define RANK 3
+#define DEFAULTSEED 1
+#define LEAFLEN 32
+
+/* Approximate average times; if we get out of this range, then
+   something is drastically wrong */
+static const struct TimeRange hitrange = {0,5000};
+static const struct TimeRange evictrange = {0,10000};
+
+static Nanotime hittime[2];
+static Nanotime evicttime[2];
+
+#define CHECK(expr) check((expr),__LINE__)
+static void check(int stat, int line)
+{
+    if(stat) {
+	fprintf(stderr,"%d: (%d)%s\n",line,stat,nc_strerror(stat));
+	fflush(stderr);
+	exit(1);
+    }
+}
+
+/* Mimic NCZCacheEntry: the list node must be first */
+typedef struct Entry {
+    struct List {void* next; void* prev; void* unused;} list;
+    unsigned long long indices[RANK];
+    ncexhashkey_t hashkey;
+} Entry;
+
+static int N[] = {1000, 10000, 100000, 0};
+
+static void
+setindices(Entry* e, size_t n)
+{
+    /* Spread the linear index over RANK dimensions of extent 1000 */
+    int r;
+    for(r=RANK-1;r>=0;r--) {e->indices[r] = n % 1000; n /= 1000;}
+    e->hashkey = ncxcachekey(e->indices,sizeof(e->indices));
+}
+
+int
+main(int argc, char** argv)
+{
+    int* np = NULL;
+
+    NCT_inittimer();
+    srandom(DEFAULTSEED);
+
+    for(np=N;*np;np++) {
+	size_t i, ns = (size_t)*np;
+	NCxcache* cache = NULL;
+	Entry* entries = NULL;
+	Entry* e = NULL;
+
+	fprintf(stderr,"entries=%zu:\n",ns);
+
+	/* Twice as many entries as the cache holds, so half are misses */
+	if((entries = calloc(2*ns,sizeof(Entry)))==NULL) CHECK(NC_ENOMEM);
+	for(i=0;i<2*ns;i++) setindices(&entries[i],i);
+	CHECK(ncxcachenew(LEAFLEN,&cache));
+	for(i=0;i<ns;i++) CHECK(ncxcacheinsert(cache,entries[i].hashkey,&entries[i]));
+	assert((size_t)ncxcachecount(cache) == ns);
+
+	/* Hit: lookup and promote to the front of the LRU chain */
+	NCT_marktime(&hittime[0]);
+	for(i=0;i<ns;i++) {
+	    void* content = NULL;
+	    e = &entries[(size_t)random() % ns];
+	    CHECK(ncxcachelookup(cache,e->hashkey,&content));
+	    CHECK(ncxcachetouch(cache,e->hashkey));
+	    if(content != e || ncxcachefirst(cache) != e) CHECK(NC_EINTERNAL);
+	}
+	NCT_marktime(&hittime[1]);
+	NCT_reporttime((unsigned)ns, hittime, hitrange, "hit");
+
+	/* Miss: evict the least recently used entry and insert a new one */
+	NCT_marktime(&evicttime[0]);
+	for(i=0;i<ns;i++) {
+	    void* content = NULL;
+	    Entry* victim = ncxcachelast(cache);
+	    if(victim == NULL) CHECK(NC_EINTERNAL);
+	    CHECK(ncxcacheremove(cache,victim->hashkey,&content));
+	    if(content != victim) CHECK(NC_EINTERNAL);
+	    e = &entries[ns+i];
+	    CHECK(ncxcacheinsert(cache,e->hashkey,e));
+	}
+	NCT_marktime(&evicttime[1]);
+	NCT_reporttime((unsigned)ns, evicttime, evictrange, "evict");
+	assert((size_t)ncxcachecount(cache) == ns);
+
+	/* Only the newcomers should be left, most recent first */
+	for(i=0,e=ncxcachefirst(cache);e != NULL;i++,e=ncxcachenext(cache,e->hashkey)) {
+	    if(i >= ns || e != &entries[(2*ns-1)-i]) {
+	        fprintf(stderr,"lru order failure: [%zu]\n",i);
+		CHECK(NC_EINTERNAL);
+	    }
+	}
+	fprintf(stderr,"\tlru order: passed\n");
+
+	ncxcachefree(cache);
+	free(entries);
+    }
+    return 0;
+}